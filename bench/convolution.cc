@@ -155,7 +155,7 @@ void xnnpack_convolution_q8(benchmark::State& state, const char* net) {
     benchmark::Counter::kIsRate);
 }
 
-void xnnpack_convolution_f32(benchmark::State& state, const char* net) {
+void xnnpack_convolution_f32(benchmark::State& state, const char* net, uint32_t flags = 0) {
   const size_t batch_size = state.range(0);
   const size_t input_height = state.range(1);
   const size_t input_width = state.range(2);
@@ -218,7 +218,7 @@ void xnnpack_convolution_f32(benchmark::State& state, const char* net) {
       input_pixel_stride, output_pixel_stride,
       kernel.data(), bias.data(),
       -std::numeric_limits<float>::infinity(), +std::numeric_limits<float>::infinity(),
-      0 /* flags */, &convolution_op);
+      flags, &convolution_op);
     if (status != xnn_status_success) {
       state.SkipWithError("failed to create FP32 Convolution operator");
       return;
@@ -269,6 +269,123 @@ void xnnpack_convolution_f32(benchmark::State& state, const char* net) {
     benchmark::Counter::kIsRate);
 }
 
+// Alternates the input size of one operator among several resolutions, as in a service which accepts images of
+// different sizes, and measures the latency of setup and run together.
+void xnnpack_convolution_f32_changing_size(benchmark::State& state, const char* net, size_t shape_cache_size) {
+  const size_t batch_size = state.range(0);
+  const size_t max_input_height = state.range(1);
+  const size_t max_input_width = state.range(2);
+  const size_t kernel_height = state.range(3);
+  const size_t kernel_width = state.range(4);
+  const size_t padding_height = state.range(5);
+  const size_t padding_width = state.range(6);
+  const size_t subsampling = state.range(7);
+  const size_t dilation = state.range(8);
+  const size_t groups = state.range(9);
+  const size_t group_input_channels = state.range(10);
+  const size_t group_output_channels = state.range(11);
+
+  std::random_device random_device;
+  auto rng = std::mt19937(random_device());
+  auto f32rng = std::bind(std::uniform_real_distribution<float>(0.0f, 1.0f), rng);
+
+  const size_t output_pixel_stride = groups * group_output_channels;
+  const size_t input_pixel_stride = groups * group_input_channels;
+  const size_t effective_kernel_height = (kernel_height - 1) * dilation + 1;
+  const size_t effective_kernel_width = (kernel_width - 1) * dilation + 1;
+  const size_t padding_left = padding_width / 2;
+  const size_t padding_top = padding_height / 2;
+  const size_t padding_right = padding_width - padding_left;
+  const size_t padding_bottom = padding_height - padding_top;
+
+  // Input sizes from 1/2 to 1 of the maximum size, in steps of 1/8.
+  const size_t num_sizes = 5;
+  std::vector<size_t> input_heights(num_sizes);
+  std::vector<size_t> input_widths(num_sizes);
+  for (size_t i = 0; i < num_sizes; i++) {
+    input_heights[i] = std::max<size_t>(max_input_height * (8 - i) / 8, effective_kernel_height);
+    input_widths[i] = std::max<size_t>(max_input_width * (8 - i) / 8, effective_kernel_width);
+  }
+
+  const size_t max_output_height = (max_input_height + padding_height - effective_kernel_height) / subsampling + 1;
+  const size_t max_output_width = (max_input_width + padding_width - effective_kernel_width) / subsampling + 1;
+  std::vector<float> input(
+    batch_size * max_input_height * max_input_width * input_pixel_stride + XNN_EXTRA_BYTES / sizeof(float));
+  std::generate(input.begin(), input.end(), std::ref(f32rng));
+  std::vector<float> kernel(groups * group_output_channels * kernel_height * kernel_width * group_input_channels);
+  std::generate(kernel.begin(), kernel.end(), std::ref(f32rng));
+  std::vector<float> bias(groups * group_output_channels);
+  std::generate(bias.begin(), bias.end(), std::ref(f32rng));
+  std::vector<float> output(batch_size * max_output_height * max_output_width * output_pixel_stride);
+
+  xnn_status status = xnn_initialize();
+  if (status != xnn_status_success) {
+    state.SkipWithError("failed to initialize XNNPACK");
+    return;
+  }
+
+  xnn_operator_t convolution_op = nullptr;
+  status = xnn_create_convolution2d_nhwc_f32(
+    padding_top, padding_right, padding_bottom, padding_left,
+    kernel_height, kernel_width,
+    subsampling, subsampling,
+    dilation, dilation,
+    groups, group_input_channels, group_output_channels,
+    input_pixel_stride, output_pixel_stride,
+    kernel.data(), bias.data(),
+    -std::numeric_limits<float>::infinity(), +std::numeric_limits<float>::infinity(),
+    0 /* flags */, &convolution_op);
+  if (status != xnn_status_success) {
+    state.SkipWithError("failed to create FP32 Convolution operator");
+    return;
+  }
+
+  if (shape_cache_size != 0) {
+    status = xnn_enable_operator_shape_cache(convolution_op, shape_cache_size);
+    if (status != xnn_status_success) {
+      state.SkipWithError("failed to enable shape cache for FP32 Convolution operator");
+      return;
+    }
+  }
+
+  size_t size_index = 0;
+  uint64_t flops = 0;
+  for (auto _ : state) {
+    const size_t input_height = input_heights[size_index];
+    const size_t input_width = input_widths[size_index];
+    size_index = (size_index + 1) % num_sizes;
+
+    status = xnn_setup_convolution2d_nhwc_f32(
+      convolution_op,
+      batch_size, input_height, input_width,
+      input.data(), output.data(),
+      nullptr /* thread pool */);
+    if (status != xnn_status_success) {
+      state.SkipWithError("failed to setup FP32 Convolution operator");
+      return;
+    }
+
+    status = xnn_run_operator(convolution_op, nullptr /* thread pool */);
+    if (status != xnn_status_success) {
+      state.SkipWithError("failed to run FP32 Convolution operator");
+      return;
+    }
+
+    const size_t output_height = (input_height + padding_height - effective_kernel_height) / subsampling + 1;
+    const size_t output_width = (input_width + padding_width - effective_kernel_width) / subsampling + 1;
+    flops += uint64_t(2) * batch_size * output_height * output_width *
+      groups * group_input_channels * group_output_channels * kernel_height * kernel_width;
+  }
+
+  status = xnn_delete_operator(convolution_op);
+  if (status != xnn_status_success) {
+    state.SkipWithError("failed to delete FP32 Convolution operator");
+    return;
+  }
+
+  state.counters["FLOPS"] = benchmark::Counter(flops, benchmark::Counter::kIsRate);
+}
+
 #ifdef BENCHMARK_TENSORFLOW_LITE
 void tflite_convolution_f32(benchmark::State& state, const char* net) {
   const size_t batch_size = state.range(0);
@@ -1747,6 +1864,19 @@ BENCHMARK_CAPTURE(xnnpack_convolution_f32, srcnn915, "SRCNN (9-1-5)")->Apply(SRC
 BENCHMARK_CAPTURE(xnnpack_convolution_f32, srcnn935, "SRCNN (9-3-5)")->Apply(SRCNN935)->UseRealTime();
 BENCHMARK_CAPTURE(xnnpack_convolution_f32, srcnn955, "SRCNN (9-5-5)")->Apply(SRCNN955)->UseRealTime();
 
+// Direct IGEMM convolution for the layers which use the Winograd algorithm by default, for comparison.
+BENCHMARK_CAPTURE(xnnpack_convolution_f32, resnet18_no_winograd, "ResNet-18", XNN_FLAG_DISABLE_WINOGRAD)
+  ->Apply(ResNet18)->UseRealTime();
+BENCHMARK_CAPTURE(xnnpack_convolution_f32, resnet50_no_winograd, "ResNet-50", XNN_FLAG_DISABLE_WINOGRAD)
+  ->Apply(ResNet50)->UseRealTime();
+BENCHMARK_CAPTURE(xnnpack_convolution_f32, vgg_no_winograd, "VGG", XNN_FLAG_DISABLE_WINOGRAD)
+  ->Apply(VGG)->UseRealTime();
+
+BENCHMARK_CAPTURE(xnnpack_convolution_f32_changing_size, mobilenet_v1, "MobileNet v1", 0 /* no shape cache */)
+  ->Apply(MobileNetV1)->UseRealTime();
+BENCHMARK_CAPTURE(xnnpack_convolution_f32_changing_size, mobilenet_v1_shape_cache, "MobileNet v1", 8 /* shapes */)
+  ->Apply(MobileNetV1)->UseRealTime();
+
 BENCHMARK_CAPTURE(xnnpack_convolution_q8, mobilenet_v1, "MobileNet v1")->Apply(MobileNetV1)->UseRealTime();
 BENCHMARK_CAPTURE(xnnpack_convolution_q8, mobilenet_v2, "MobileNet v2")->Apply(MobileNetV2)->UseRealTime();
 BENCHMARK_CAPTURE(xnnpack_convolution_q8, mobilenet_v3_small, "MobileNet v3 Small")->Apply(MobileNetV3Small)->UseRealTime();
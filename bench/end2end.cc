@@ -4,9 +4,13 @@
 // LICENSE file in the root directory of this source tree.
 
 #include <algorithm>
+#include <cinttypes>
 #include <cmath>
+#include <cstdio>
 #include <functional>
 #include <random>
+#include <set>
+#include <string>
 #include <vector>
 
 #include <xnnpack.h>
@@ -16,38 +20,59 @@
 #include "models/models.h"
 
 
-static void MobileNetV1(benchmark::State& state) {
-  if (xnn_initialize() != xnn_status_success) {
-    state.SkipWithError("failed to initialize XNNPACK");
+// Print a per-operator profile of the model once per process: where the time goes, which micro-kernel and tile each
+// operator uses, and how far each operator is from the compute and bandwidth rooflines.
+static void PrintProfileSummary(const char* model_name, const std::vector<xnn_operator_profile>& profiles) {
+  static std::set<std::string> printed_models;
+  if (!printed_models.insert(model_name).second) {
     return;
   }
 
-  auto execution_plan = models::MobileNetV1(nullptr);
-  if (execution_plan.empty()) {
-    state.SkipWithError("failed to create MobileNet v1");
-    return;
+  uint64_t total_time_ns = 0;
+  for (const xnn_operator_profile& profile : profiles) {
+    total_time_ns += profile.total_time_ns;
   }
 
-  for (auto _ : state) {
-    for (const std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)>& op : execution_plan) {
-      xnn_status status = xnn_run_operator(op.get(), nullptr);
-      if (status != xnn_status_success) {
-        state.SkipWithError("failed to run MobileNet v1");
-        return;
-      }
+  std::fprintf(stderr, "%s: per-operator profile\n", model_name);
+  std::fprintf(stderr, "%4s  %-34s %-22s %-11s %7s %10s %6s %9s %9s %9s\n",
+    "#", "operator", "micro-kernel", "tile", "threads", "time, us", "%", "GFLOP/s", "GB/s", "FLOP/B");
+  for (size_t i = 0; i < profiles.size(); i++) {
+    const xnn_operator_profile& profile = profiles[i];
+    if (profile.run_count == 0) {
+      continue;
+    }
+    const double time_ns = double(profile.total_time_ns) / double(profile.run_count);
+    char tile[32] = "";
+    if (profile.kr != 0) {
+      std::snprintf(tile, sizeof(tile), "%" PRIu32 "x%" PRIu32 "x%" PRIu32, profile.mr, profile.nr, profile.kr);
+    } else if (profile.nr != 0) {
+      std::snprintf(tile, sizeof(tile), "%" PRIu32 "x%" PRIu32, profile.mr, profile.nr);
+    } else if (profile.mr != 0) {
+      std::snprintf(tile, sizeof(tile), "%" PRIu32, profile.mr);
     }
+    std::fprintf(stderr, "%4zu  %-34s %-22s %-11s %7zu %10.1f %6.2f %9.2f %9.2f %9.2f\n",
+      i, profile.operator_name, profile.ukernel_name, tile, profile.num_threads,
+      time_ns * 1.0e-3,
+      100.0 * double(profile.total_time_ns) / double(total_time_ns),
+      double(profile.flops) / time_ns,
+      double(profile.bytes) / time_ns,
+      profile.bytes != 0 ? double(profile.flops) / double(profile.bytes) : 0.0);
   }
 }
 
-static void MobileNetV2(benchmark::State& state) {
+static void End2EndBenchmark(
+  benchmark::State& state,
+  const char* model_name,
+  models::ExecutionPlanFactory model_factory)
+{
   if (xnn_initialize() != xnn_status_success) {
     state.SkipWithError("failed to initialize XNNPACK");
     return;
   }
 
-  auto execution_plan = models::MobileNetV2(nullptr);
+  auto execution_plan = model_factory(nullptr);
   if (execution_plan.empty()) {
-    state.SkipWithError("failed to create MobileNet v2");
+    state.SkipWithError("failed to create a model");
     return;
   }
 
@@ -55,11 +80,49 @@ static void MobileNetV2(benchmark::State& state) {
     for (const std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)>& op : execution_plan) {
       xnn_status status = xnn_run_operator(op.get(), nullptr);
       if (status != xnn_status_success) {
-        state.SkipWithError("failed to run MobileNet v2");
+        state.SkipWithError("failed to run a model");
         return;
       }
     }
   }
+
+  // Profile in separate runs to keep timer reads out of the measured loop.
+  const size_t profile_runs = 10;
+  for (const std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)>& op : execution_plan) {
+    xnn_enable_operator_profiling(op.get(), true);
+  }
+  for (size_t run = 0; run < profile_runs; run++) {
+    for (const std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)>& op : execution_plan) {
+      xnn_run_operator(op.get(), nullptr);
+    }
+  }
+
+  std::vector<xnn_operator_profile> profiles(execution_plan.size());
+  uint64_t flops = 0;
+  uint64_t bytes = 0;
+  for (size_t i = 0; i < execution_plan.size(); i++) {
+    if (xnn_get_operator_profile(execution_plan[i].get(), &profiles[i]) != xnn_status_success) {
+      state.SkipWithError("failed to profile a model");
+      return;
+    }
+    flops += profiles[i].flops;
+    bytes += profiles[i].bytes;
+  }
+
+  state.counters["FLOPS"] = benchmark::Counter(
+    uint64_t(state.iterations()) * flops, benchmark::Counter::kIsRate);
+  state.counters["bytes"] = benchmark::Counter(
+    uint64_t(state.iterations()) * bytes, benchmark::Counter::kIsRate);
+
+  PrintProfileSummary(model_name, profiles);
+}
+
+static void MobileNetV1(benchmark::State& state) {
+  End2EndBenchmark(state, "MobileNet v1", models::MobileNetV1);
+}
+
+static void MobileNetV2(benchmark::State& state) {
+  End2EndBenchmark(state, "MobileNet v2", models::MobileNetV2);
 }
 
 BENCHMARK(MobileNetV1)->Unit(benchmark::kMicrosecond)->UseRealTime();
@@ -67,4 +130,4 @@ BENCHMARK(MobileNetV2)->Unit(benchmark::kMicrosecond)->UseRealTime();
 
 #ifndef XNNPACK_BENCHMARK_NO_MAIN
 BENCHMARK_MAIN();
-#endif
\ No newline at end of file
+#endif
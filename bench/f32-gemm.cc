@@ -35,12 +35,16 @@
 
 static void GEMMBenchmark(benchmark::State& state,
   xnn_f32_gemm_ukernel_function gemm,
-  size_t mr, size_t nr, size_t kr, size_t sr)
+  size_t mr, size_t nr, size_t kr, size_t sr,
+  benchmark::utils::IsaCheckFunction isa_check = nullptr)
 {
   if (!cpuinfo_initialize()) {
     state.SkipWithError("cpuinfo initialization failed");
     return;
   }
+  if (isa_check && !isa_check(state)) {
+    return;
+  }
 
   const size_t mc = state.range(0);
   const size_t nc = state.range(1);
@@ -66,7 +70,7 @@ static void GEMMBenchmark(benchmark::State& state,
     benchmark::utils::divideRoundUp<size_t>(benchmark::utils::GetMaxCacheSize(),
       sizeof(float) * (w_elements + c_elements));
 
-  std::vector<float, AlignedAllocator<float, 32>> w(w_elements * num_buffers);
+  std::vector<float, AlignedAllocator<float, 64>> w(w_elements * num_buffers);
   std::fill(w.begin(), w.end(), 0.0f);
   xnn_pack_f32_gemm_goi_w(1 /* groups */, nc, kc, nr, kr, sr, k.data(), b.data(), w.data());
   std::vector<float> c(c_elements * num_buffers);
@@ -102,15 +106,137 @@ static void GEMMBenchmark(benchmark::State& state,
     uint64_t(state.iterations()) * 2 * mc * nc * kc, benchmark::Counter::kIsRate);
 }
 
+// Runs GEMM with the same KC/MC/NC cache blocking as the library: K is split into KC blocks, and every KC x NR panel of
+// packed weights is multiplied by all MR-row tiles of an MC x KC block of A, with MR x NR tiles of intermediate results
+// accumulated through the GEMMINC micro-kernel.
+static void GEMMBlockedBenchmark(benchmark::State& state,
+  xnn_f32_gemm_ukernel_function gemm,
+  xnn_f32_gemminc_ukernel_function gemminc,
+  size_t mr, size_t nr, size_t kr, size_t sr,
+  benchmark::utils::IsaCheckFunction isa_check = nullptr)
+{
+  if (!cpuinfo_initialize()) {
+    state.SkipWithError("cpuinfo initialization failed");
+    return;
+  }
+  if (isa_check && !isa_check(state)) {
+    return;
+  }
+
+  const size_t mc = state.range(0);
+  const size_t nc = state.range(1);
+  const size_t kc = state.range(2);
+
+  const size_t nc_stride = benchmark::utils::roundUp(nc, nr);
+  const size_t kc_stride = benchmark::utils::roundUp(kc, kr);
+
+  const size_t l1_size = cpuinfo_get_l1d_cache(0)->size / std::max<uint32_t>(cpuinfo_get_l1d_cache(0)->processor_count, 1);
+  const size_t l2_size = cpuinfo_get_l2_cache(0)->size / std::max<uint32_t>(cpuinfo_get_l2_cache(0)->processor_count, 1);
+  const size_t kc_block = std::max<size_t>(l1_size / 2 / (nr * sizeof(float)) / (kr * sr), 1) * (kr * sr);
+  const size_t nc_block = std::max<size_t>(l2_size / 2 / (kc_block * sizeof(float)) / nr, 1) * nr;
+  const size_t mc_block = std::max<size_t>(l2_size / 4 / (kc_block * sizeof(float)) / mr, 1) * mr;
+  state.counters["KC"] = kc_block;
+
+  std::random_device random_device;
+  auto rng = std::mt19937(random_device());
+  auto f32rng = std::bind(std::uniform_real_distribution<float>(), rng);
+
+  std::vector<float> a(mc * kc);
+  std::generate(a.begin(), a.end(), std::ref(f32rng));
+  std::vector<float> k(nc * kc);
+  std::generate(k.begin(), k.end(), std::ref(f32rng));
+  std::vector<float> b(nc);
+  std::generate(b.begin(), b.end(), std::ref(f32rng));
+
+  const size_t w_elements = nc_stride * kc_stride + nc_stride;
+  const size_t c_elements = mc * nc;
+  const size_t num_buffers = 1 +
+    benchmark::utils::divideRoundUp<size_t>(benchmark::utils::GetMaxCacheSize(),
+      sizeof(float) * (w_elements + c_elements));
+
+  std::vector<float, AlignedAllocator<float, 64>> w(w_elements * num_buffers);
+  std::fill(w.begin(), w.end(), 0.0f);
+  xnn_pack_f32_gemm_goi_w(1 /* groups */, nc, kc, nr, kr, sr, k.data(), b.data(), w.data());
+  std::vector<float> c(c_elements * num_buffers);
+  std::fill(c.begin(), c.end(), std::nanf(""));
+  std::vector<float, AlignedAllocator<float, 64>> acc(
+    benchmark::utils::roundUp(mc, mr) * nc_stride);
+
+  xnn_f32_output_params output_params =
+    xnn_compute_f32_output_params(-std::numeric_limits<float>::infinity(), +std::numeric_limits<float>::infinity());
+
+  size_t buffer_index = 0;
+  for (auto _ : state) {
+    // Use circular buffers (exceeding cache size) and prefetch to control cache state:
+    // - A is always in L1 cache (if fits, otherwise L2, L3, etc)
+    // - W is not in cache (for any cache level)
+    // - C is not in cache (for any cache level)
+    state.PauseTiming();
+    benchmark::utils::prefetchToL1(a.data(), a.size() * sizeof(float));
+    buffer_index = (buffer_index + 1) % num_buffers;
+    state.ResumeTiming();
+
+    const float* w_buffer = w.data() + buffer_index * nc_stride * (kc_stride + 1);
+    float* c_buffer = c.data() + buffer_index * mc * nc;
+    for (size_t m_block = 0; m_block < mc; m_block += mc_block) {
+      const size_t m_block_end = std::min(mc, m_block + mc_block);
+      for (size_t n_block = 0; n_block < nc; n_block += nc_block) {
+        const size_t n_block_end = std::min(nc, n_block + nc_block);
+        for (size_t k_block = 0; k_block < kc; k_block += kc_block) {
+          const size_t kb = std::min(kc - k_block, kc_block);
+          for (size_t n = n_block; n < n_block_end; n += nr) {
+            const size_t nb = std::min(n_block_end - n, nr);
+            const float* w_panel = w_buffer + n * (kc_stride + 1);
+            for (size_t m = m_block; m < m_block_end; m += mr) {
+              const size_t mb = std::min(m_block_end - m, mr);
+              float* acc_tile = acc.data() + m * nc_stride + n * mr;
+              if (k_block == 0) {
+                gemm(
+                  mb, nb, kb * sizeof(float),
+                  a.data() + m * kc, kc * sizeof(float),
+                  w_panel,
+                  acc_tile, nr * sizeof(float), nr * sizeof(float),
+                  &output_params);
+              } else if (k_block + kb != kc) {
+                gemminc(
+                  mb, nb, kb * sizeof(float),
+                  a.data() + m * kc + k_block, kc * sizeof(float),
+                  w_panel + nr + k_block * nr,
+                  acc_tile, nr * sizeof(float), nr * sizeof(float),
+                  acc_tile, &output_params);
+              } else {
+                gemminc(
+                  mb, nb, kb * sizeof(float),
+                  a.data() + m * kc + k_block, kc * sizeof(float),
+                  w_panel + nr + k_block * nr,
+                  c_buffer + m * nc + n, nc * sizeof(float), nr * sizeof(float),
+                  acc_tile, &output_params);
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+  state.counters["Freq"] = benchmark::utils::GetCurrentCpuFrequency();
+  state.counters["FLOPS"] = benchmark::Counter(
+    uint64_t(state.iterations()) * 2 * mc * nc * kc, benchmark::Counter::kIsRate);
+}
+
 static void PPMM1PBenchmark(benchmark::State& state,
   xnn_f32_ppmm_ukernel_function ppmm,
   xnn_x32_packx_ukernel_function packx,
-  size_t mr, size_t nr)
+  size_t mr, size_t nr,
+  benchmark::utils::IsaCheckFunction isa_check = nullptr)
 {
   if (!cpuinfo_initialize()) {
     state.SkipWithError("cpuinfo initialization failed");
     return;
   }
+  if (isa_check && !isa_check(state)) {
+    return;
+  }
 
   const size_t mc = state.range(0);
   const size_t nc = state.range(1);
@@ -137,7 +263,7 @@ static void PPMM1PBenchmark(benchmark::State& state,
     benchmark::utils::divideRoundUp<size_t>(benchmark::utils::GetMaxCacheSize(),
       sizeof(float) * (w_elements + c_elements));
 
-  std::vector<float, AlignedAllocator<float, 32>> w(w_elements * num_buffers);
+  std::vector<float, AlignedAllocator<float, 64>> w(w_elements * num_buffers);
   std::fill(w.begin(), w.end(), 0.0f);
   xnn_pack_f32_gemm_goi_w(1 /* groups */, nc, kc, nr, 1 /* kr */, 1 /* sr */, k.data(), b.data(), w.data());
   std::vector<float> c(c_elements * num_buffers);
@@ -177,12 +303,16 @@ static void PPMM1PBenchmark(benchmark::State& state,
 static void PPMM2PBenchmark(benchmark::State& state,
   xnn_f32_ppmm_ukernel_function ppmm,
   xnn_x32_packx_ukernel_function packx,
-  size_t mr, size_t nr)
+  size_t mr, size_t nr,
+  benchmark::utils::IsaCheckFunction isa_check = nullptr)
 {
   if (!cpuinfo_initialize()) {
     state.SkipWithError("cpuinfo initialization failed");
     return;
   }
+  if (isa_check && !isa_check(state)) {
+    return;
+  }
 
   const size_t mc = state.range(0);
   const size_t nc = state.range(1);
@@ -210,7 +340,7 @@ static void PPMM2PBenchmark(benchmark::State& state,
     benchmark::utils::divideRoundUp<size_t>(benchmark::utils::GetMaxCacheSize(),
       sizeof(float) * (w_elements + c_elements));
 
-  std::vector<float, AlignedAllocator<float, 32>> w(w_elements * num_buffers);
+  std::vector<float, AlignedAllocator<float, 64>> w(w_elements * num_buffers);
   std::fill(w.begin(), w.end(), 0.0f);
   xnn_pack_f32_gemm_goi_w(1 /* groups */, nc, kc, nr, 1 /* kr */, 1 /* sr */, k.data(), b.data(), w.data());
   std::vector<float> c(c_elements * num_buffers);
@@ -334,6 +464,24 @@ static void ruy_st(benchmark::State& state, const char* net)
 }
 #endif  // BENCHMARK_RUY
 
+// Large matrices where packed weights don't fit into L2 cache, to compare unblocked and cache-blocked GEMM.
+static void LargeGemmArguments(benchmark::internal::Benchmark* b) {
+  b->ArgNames({"M", "N", "K"});
+
+  /*       M     N     K  */
+  b->Args({ 49, 2048,  512});
+  b->Args({ 49,  512, 2048});
+  b->Args({196, 1024, 1024});
+  b->Args({196, 2048, 2048});
+  b->Args({256, 1000, 2048});
+  b->Args({512,  512,  512});
+  b->Args({512, 1024, 1024});
+  b->Args({512, 2048, 2048});
+}
+
+#define BENCHMARK_LARGE_GEMM(gemm_fn) \
+  BENCHMARK_CAPTURE(gemm_fn, large, "Large")->Apply(LargeGemmArguments)->UseRealTime();
+
 
 #if XNN_ARCH_ARM64 && XNN_ENABLE_ASSEMBLY
   static void sgemm_1x12__aarch64_neonfma_cortex_a53(benchmark::State& state, const char* net) {
@@ -397,6 +545,16 @@ static void ruy_st(benchmark::State& state, const char* net)
   BENCHMARK_GEMM(sgemm_6x8__aarch64_neonfma_cortex_a75)
   BENCHMARK_GEMM(sgemm_6x8__aarch64_neonfma_ld64)
   BENCHMARK_GEMM(sgemm_6x8__aarch64_neonfma_ld128)
+
+  static void sgemm_6x8_blocked__aarch64_neonfma_cortex_a57(benchmark::State& state, const char* net) {
+    GEMMBlockedBenchmark(state,
+      xnn_f32_gemm_ukernel_6x8__aarch64_neonfma_cortex_a57,
+      xnn_f32_gemminc_ukernel_6x8__aarch64_neonfma_cortex_a57,
+      6, 8, 1, 1);
+  }
+
+  BENCHMARK_LARGE_GEMM(sgemm_6x8__aarch64_neonfma_cortex_a57)
+  BENCHMARK_LARGE_GEMM(sgemm_6x8_blocked__aarch64_neonfma_cortex_a57)
 #endif  // XNN_ARCH_ARM64
 
 #if XNN_ARCH_ARM || XNN_ARCH_ARM64
@@ -471,6 +629,13 @@ static void ruy_st(benchmark::State& state, const char* net)
 
   BENCHMARK_GEMM(sppmm_4x8_unipass__neonfma)
   BENCHMARK_GEMM(sppmm_4x8_twopass__neonfma)
+
+  static void sgemm_4x8_blocked__neon_ld128(benchmark::State& state, const char* net) {
+    GEMMBlockedBenchmark(state, xnn_f32_gemm_ukernel_4x8__neon_ld128, xnn_f32_gemminc_ukernel_4x8__neon_ld128, 4, 8, 1, 1);
+  }
+
+  BENCHMARK_LARGE_GEMM(sgemm_4x8__neon_ld128)
+  BENCHMARK_LARGE_GEMM(sgemm_4x8_blocked__neon_ld128)
 #endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
 
 #if XNN_ARCH_X86 || XNN_ARCH_X86_64
@@ -506,6 +671,46 @@ static void ruy_st(benchmark::State& state, const char* net)
     PPMM2PBenchmark(state, xnn_f32_ppmm_ukernel_4x8__sse, xnn_x32_packx_ukernel_4x__sse, 4, 8);
   }
 
+  static void sgemm_1x16__fma3_broadcast(benchmark::State& state, const char* net) {
+    GEMMBenchmark(state, xnn_f32_gemm_ukernel_1x16__fma3_broadcast, 1, 16, 1, 1, benchmark::utils::CheckFMA3);
+  }
+
+  static void sgemm_4x16__fma3_broadcast(benchmark::State& state, const char* net) {
+    GEMMBenchmark(state, xnn_f32_gemm_ukernel_4x16__fma3_broadcast, 4, 16, 1, 1, benchmark::utils::CheckFMA3);
+  }
+
+  static void sgemm_5x16__fma3_broadcast(benchmark::State& state, const char* net) {
+    GEMMBenchmark(state, xnn_f32_gemm_ukernel_5x16__fma3_broadcast, 5, 16, 1, 1, benchmark::utils::CheckFMA3);
+  }
+
+  static void sgemm_6x16__fma3_broadcast(benchmark::State& state, const char* net) {
+    GEMMBenchmark(state, xnn_f32_gemm_ukernel_6x16__fma3_broadcast, 6, 16, 1, 1, benchmark::utils::CheckFMA3);
+  }
+
+  static void sppmm_4x16_unipass__fma3(benchmark::State& state, const char* net) {
+    PPMM1PBenchmark(state, xnn_f32_ppmm_ukernel_4x16__fma3, xnn_x32_packx_ukernel_4x__sse, 4, 16, benchmark::utils::CheckFMA3);
+  }
+
+  static void sppmm_4x16_twopass__fma3(benchmark::State& state, const char* net) {
+    PPMM2PBenchmark(state, xnn_f32_ppmm_ukernel_4x16__fma3, xnn_x32_packx_ukernel_4x__sse, 4, 16, benchmark::utils::CheckFMA3);
+  }
+
+  static void sgemm_1x16__avx512f_broadcast(benchmark::State& state, const char* net) {
+    GEMMBenchmark(state, xnn_f32_gemm_ukernel_1x16__avx512f_broadcast, 1, 16, 1, 1, benchmark::utils::CheckAVX512F);
+  }
+
+  static void sgemm_4x16__avx512f_broadcast(benchmark::State& state, const char* net) {
+    GEMMBenchmark(state, xnn_f32_gemm_ukernel_4x16__avx512f_broadcast, 4, 16, 1, 1, benchmark::utils::CheckAVX512F);
+  }
+
+  static void sgemm_7x16__avx512f_broadcast(benchmark::State& state, const char* net) {
+    GEMMBenchmark(state, xnn_f32_gemm_ukernel_7x16__avx512f_broadcast, 7, 16, 1, 1, benchmark::utils::CheckAVX512F);
+  }
+
+  static void sgemm_8x32__avx512f_broadcast(benchmark::State& state, const char* net) {
+    GEMMBenchmark(state, xnn_f32_gemm_ukernel_8x32__avx512f_broadcast, 8, 32, 1, 1, benchmark::utils::CheckAVX512F);
+  }
+
   BENCHMARK_GEMM(sgemm_1x8__sse_load1)
   BENCHMARK_GEMM(sgemm_4x8__sse_load1)
   BENCHMARK_GEMM(sgemm_1x8__sse_dup)
@@ -514,6 +719,35 @@ static void ruy_st(benchmark::State& state, const char* net)
   BENCHMARK_GEMM(sgemm_4x8s4__sse)
   BENCHMARK_GEMM(sppmm_4x8_unipass__sse)
   BENCHMARK_GEMM(sppmm_4x8_twopass__sse)
+  BENCHMARK_GEMM(sgemm_1x16__fma3_broadcast)
+  BENCHMARK_GEMM(sgemm_4x16__fma3_broadcast)
+  BENCHMARK_GEMM(sgemm_5x16__fma3_broadcast)
+  BENCHMARK_GEMM(sgemm_6x16__fma3_broadcast)
+  BENCHMARK_GEMM(sppmm_4x16_unipass__fma3)
+  BENCHMARK_GEMM(sppmm_4x16_twopass__fma3)
+  BENCHMARK_GEMM(sgemm_1x16__avx512f_broadcast)
+  BENCHMARK_GEMM(sgemm_4x16__avx512f_broadcast)
+  BENCHMARK_GEMM(sgemm_7x16__avx512f_broadcast)
+  BENCHMARK_GEMM(sgemm_8x32__avx512f_broadcast)
+
+  static void sgemm_5x16_blocked__fma3_broadcast(benchmark::State& state, const char* net) {
+    GEMMBlockedBenchmark(state,
+      xnn_f32_gemm_ukernel_5x16__fma3_broadcast,
+      xnn_f32_gemminc_ukernel_5x16__fma3_broadcast,
+      5, 16, 1, 1, benchmark::utils::CheckFMA3);
+  }
+
+  static void sgemm_7x16_blocked__avx512f_broadcast(benchmark::State& state, const char* net) {
+    GEMMBlockedBenchmark(state,
+      xnn_f32_gemm_ukernel_7x16__avx512f_broadcast,
+      xnn_f32_gemminc_ukernel_7x16__avx512f_broadcast,
+      7, 16, 1, 1, benchmark::utils::CheckAVX512F);
+  }
+
+  BENCHMARK_LARGE_GEMM(sgemm_5x16__fma3_broadcast)
+  BENCHMARK_LARGE_GEMM(sgemm_5x16_blocked__fma3_broadcast)
+  BENCHMARK_LARGE_GEMM(sgemm_7x16__avx512f_broadcast)
+  BENCHMARK_LARGE_GEMM(sgemm_7x16_blocked__avx512f_broadcast)
 #endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
 
 #if !XNN_ARCH_WASM && !XNN_ARCH_ASMJS
@@ -23,12 +23,16 @@
 
 
 static void SpMMBenchmark(benchmark::State& state,
-  xnn_f32_spmm_ukernel_function spmm, uint32_t mr, uint32_t nr, float sparsity)
+  xnn_f32_spmm_ukernel_function spmm, uint32_t mr, uint32_t nr, float sparsity,
+  benchmark::utils::IsaCheckFunction isa_check = nullptr)
 {
   if (!cpuinfo_initialize()) {
     state.SkipWithError("cpuinfo initialization failed");
     return;
   }
+  if (isa_check && !isa_check(state)) {
+    return;
+  }
 
   const size_t mc = state.range(0);
   const size_t nc = state.range(1);
@@ -259,8 +263,93 @@ static void SpMMBenchmark(benchmark::State& state,
     SpMMBenchmark(state, xnn_f32_spmm_ukernel_8x1__sse, 8, 1, 0.8f);
   }
 
+  static void spmm80_16x1__sse(benchmark::State& state, const char* net) {
+    SpMMBenchmark(state, xnn_f32_spmm_ukernel_16x1__sse, 16, 1, 0.8f);
+  }
+
+  static void spmm80_32x1__sse(benchmark::State& state, const char* net) {
+    SpMMBenchmark(state, xnn_f32_spmm_ukernel_32x1__sse, 32, 1, 0.8f);
+  }
+
+  static void spmm80_4x2__sse(benchmark::State& state, const char* net) {
+    SpMMBenchmark(state, xnn_f32_spmm_ukernel_4x2__sse, 4, 2, 0.8f);
+  }
+
+  static void spmm80_8x2__sse(benchmark::State& state, const char* net) {
+    SpMMBenchmark(state, xnn_f32_spmm_ukernel_8x2__sse, 8, 2, 0.8f);
+  }
+
+  static void spmm80_16x2__sse(benchmark::State& state, const char* net) {
+    SpMMBenchmark(state, xnn_f32_spmm_ukernel_16x2__sse, 16, 2, 0.8f);
+  }
+
+  static void spmm80_4x4__sse(benchmark::State& state, const char* net) {
+    SpMMBenchmark(state, xnn_f32_spmm_ukernel_4x4__sse, 4, 4, 0.8f);
+  }
+
+  static void spmm80_8x4__sse(benchmark::State& state, const char* net) {
+    SpMMBenchmark(state, xnn_f32_spmm_ukernel_8x4__sse, 8, 4, 0.8f);
+  }
+
+  static void spmm80_8x1__fma3(benchmark::State& state, const char* net) {
+    SpMMBenchmark(state, xnn_f32_spmm_ukernel_8x1__fma3, 8, 1, 0.8f, benchmark::utils::CheckFMA3);
+  }
+
+  static void spmm80_16x1__fma3(benchmark::State& state, const char* net) {
+    SpMMBenchmark(state, xnn_f32_spmm_ukernel_16x1__fma3, 16, 1, 0.8f, benchmark::utils::CheckFMA3);
+  }
+
+  static void spmm80_32x1__fma3(benchmark::State& state, const char* net) {
+    SpMMBenchmark(state, xnn_f32_spmm_ukernel_32x1__fma3, 32, 1, 0.8f, benchmark::utils::CheckFMA3);
+  }
+
+  static void spmm80_16x2__fma3(benchmark::State& state, const char* net) {
+    SpMMBenchmark(state, xnn_f32_spmm_ukernel_16x2__fma3, 16, 2, 0.8f, benchmark::utils::CheckFMA3);
+  }
+
+  static void spmm80_32x2__fma3(benchmark::State& state, const char* net) {
+    SpMMBenchmark(state, xnn_f32_spmm_ukernel_32x2__fma3, 32, 2, 0.8f, benchmark::utils::CheckFMA3);
+  }
+
+  static void spmm80_16x4__fma3(benchmark::State& state, const char* net) {
+    SpMMBenchmark(state, xnn_f32_spmm_ukernel_16x4__fma3, 16, 4, 0.8f, benchmark::utils::CheckFMA3);
+  }
+
+  static void spmm80_16x1__avx512f(benchmark::State& state, const char* net) {
+    SpMMBenchmark(state, xnn_f32_spmm_ukernel_16x1__avx512f, 16, 1, 0.8f, benchmark::utils::CheckAVX512F);
+  }
+
+  static void spmm80_32x1__avx512f(benchmark::State& state, const char* net) {
+    SpMMBenchmark(state, xnn_f32_spmm_ukernel_32x1__avx512f, 32, 1, 0.8f, benchmark::utils::CheckAVX512F);
+  }
+
+  static void spmm80_32x2__avx512f(benchmark::State& state, const char* net) {
+    SpMMBenchmark(state, xnn_f32_spmm_ukernel_32x2__avx512f, 32, 2, 0.8f, benchmark::utils::CheckAVX512F);
+  }
+
+  static void spmm80_32x4__avx512f(benchmark::State& state, const char* net) {
+    SpMMBenchmark(state, xnn_f32_spmm_ukernel_32x4__avx512f, 32, 4, 0.8f, benchmark::utils::CheckAVX512F);
+  }
+
   BENCHMARK_GEMM(spmm80_4x1__sse)
   BENCHMARK_GEMM(spmm80_8x1__sse)
+  BENCHMARK_GEMM(spmm80_16x1__sse)
+  BENCHMARK_GEMM(spmm80_32x1__sse)
+  BENCHMARK_GEMM(spmm80_4x2__sse)
+  BENCHMARK_GEMM(spmm80_8x2__sse)
+  BENCHMARK_GEMM(spmm80_16x2__sse)
+  BENCHMARK_GEMM(spmm80_4x4__sse)
+  BENCHMARK_GEMM(spmm80_8x4__sse)
+  BENCHMARK_GEMM(spmm80_8x1__fma3)
+  BENCHMARK_GEMM(spmm80_16x1__fma3)
+  BENCHMARK_GEMM(spmm80_32x1__fma3)
+  BENCHMARK_GEMM(spmm80_16x2__fma3)
+  BENCHMARK_GEMM(spmm80_32x2__fma3)
+  BENCHMARK_GEMM(spmm80_16x4__fma3)
+  BENCHMARK_GEMM(spmm80_16x1__avx512f)
+  BENCHMARK_GEMM(spmm80_32x1__avx512f)
+  BENCHMARK_GEMM(spmm80_32x2__avx512f)
+  BENCHMARK_GEMM(spmm80_32x4__avx512f)
 #endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
 
 static void spmm80_1x1__scalar(benchmark::State& state, const char* net) {
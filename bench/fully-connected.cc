@@ -0,0 +1,165 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <cpuinfo.h>
+#include <pthreadpool.h>
+#include <xnnpack.h>
+
+#include <benchmark/benchmark.h>
+#include "bench/utils.h"
+
+
+void xnnpack_fully_connected_f32(benchmark::State& state, const char* net) {
+  const size_t batch_size = state.range(0);
+  const size_t input_channels = state.range(1);
+  const size_t output_channels = state.range(2);
+  const size_t num_threads = state.range(3);
+
+  std::random_device random_device;
+  auto rng = std::mt19937(random_device());
+  auto f32rng = std::bind(std::uniform_real_distribution<float>(0.0f, 1.0f), rng);
+
+  std::vector<float> input(batch_size * input_channels + XNN_EXTRA_BYTES / sizeof(float));
+  std::generate(input.begin(), input.end(), std::ref(f32rng));
+  std::vector<float> kernel(output_channels * input_channels);
+  std::generate(kernel.begin(), kernel.end(), std::ref(f32rng));
+  std::vector<float> bias(output_channels);
+  std::generate(bias.begin(), bias.end(), std::ref(f32rng));
+  const size_t output_elements = batch_size * output_channels;
+
+  xnn_status status = xnn_initialize();
+  if (status != xnn_status_success) {
+    state.SkipWithError("failed to initialize XNNPACK");
+    return;
+  }
+
+  if (!cpuinfo_initialize()) {
+    state.SkipWithError("cpuinfo initialization failed");
+    return;
+  }
+  pthreadpool_t threadpool = nullptr;
+  if (num_threads > 1) {
+    threadpool = pthreadpool_create(num_threads);
+  }
+
+  const size_t num_buffers = 1 +
+    benchmark::utils::divideRoundUp<size_t>(benchmark::utils::GetMaxCacheSize(),
+      sizeof(float) * (kernel.size() + bias.size() + output_elements));
+  std::vector<float> output(output_elements * num_buffers);
+
+  std::vector<xnn_operator_t> fully_connected_operators(num_buffers);
+  for (xnn_operator_t& fully_connected_op : fully_connected_operators) {
+    status = xnn_create_fully_connected_nc_f32(
+      input_channels, output_channels,
+      input_channels /* input stride */, output_channels /* output stride */,
+      kernel.data(), bias.data(),
+      -std::numeric_limits<float>::infinity(), +std::numeric_limits<float>::infinity(),
+      0 /* flags */, &fully_connected_op);
+    if (status != xnn_status_success) {
+      state.SkipWithError("failed to create FP32 Fully Connected operator");
+      return;
+    }
+  }
+
+  for (size_t i = 0; i < fully_connected_operators.size(); i++) {
+    status = xnn_setup_fully_connected_nc_f32(
+      fully_connected_operators[i],
+      batch_size,
+      input.data(), output.data() + i * output_elements,
+      threadpool);
+    if (status != xnn_status_success) {
+      state.SkipWithError("failed to setup FP32 Fully Connected operator");
+      return;
+    }
+  }
+
+  size_t buffer_index = 0;
+  for (auto _ : state) {
+    state.PauseTiming();
+    benchmark::utils::prefetchToL1(input.data(), input.size() * sizeof(float));
+    buffer_index = (buffer_index + 1) % num_buffers;
+    state.ResumeTiming();
+
+    status = xnn_run_operator(fully_connected_operators[buffer_index], threadpool);
+    if (status != xnn_status_success) {
+      state.SkipWithError("failed to run FP32 Fully Connected operator");
+      return;
+    }
+  }
+
+  for (xnn_operator_t& fully_connected_op : fully_connected_operators) {
+    status = xnn_delete_operator(fully_connected_op);
+    if (status != xnn_status_success) {
+      state.SkipWithError("failed to delete FP32 Fully Connected operator");
+      return;
+    }
+    fully_connected_op = nullptr;
+  }
+  if (threadpool != nullptr) {
+    pthreadpool_destroy(threadpool);
+  }
+
+  state.counters["Freq"] = benchmark::utils::GetCurrentCpuFrequency();
+  state.counters["FLOPS"] = benchmark::Counter(
+    uint64_t(state.iterations()) * 2 * batch_size * input_channels * output_channels,
+    benchmark::Counter::kIsRate);
+}
+
+// Sweep batch size over the classifier layers to expose the switch from GEMM to PPMM micro-kernels.
+static void MobileNetV1(benchmark::internal::Benchmark* b) {
+  b->ArgNames({"N", "Cin", "Cout", "T"});
+
+  for (int32_t n : {1, 2, 4, 8, 12, 16, 24, 32, 64, 128, 256}) {
+    /*       N   Cin  Cout  T */
+    b->Args({n, 1024, 1001, 1});
+  }
+}
+
+static void MobileNetV2(benchmark::internal::Benchmark* b) {
+  b->ArgNames({"N", "Cin", "Cout", "T"});
+
+  for (int32_t n : {1, 2, 4, 8, 12, 16, 24, 32, 64, 128, 256}) {
+    /*       N   Cin  Cout  T */
+    b->Args({n, 1280, 1001, 1});
+  }
+}
+
+static void InceptionV3(benchmark::internal::Benchmark* b) {
+  b->ArgNames({"N", "Cin", "Cout", "T"});
+
+  for (int32_t n : {1, 2, 4, 8, 12, 16, 24, 32, 64, 128, 256}) {
+    /*       N   Cin  Cout  T */
+    b->Args({n, 2048, 1001, 1});
+  }
+}
+
+// Sweep thread count over single-batch layers with large K to expose the switch from GEMM to split-K GEMM.
+static void VGG(benchmark::internal::Benchmark* b) {
+  b->ArgNames({"N", "Cin", "Cout", "T"});
+
+  for (int32_t t : {1, 2, 4, 8, 16}) {
+    /*       N    Cin  Cout  T */
+    b->Args({1, 25088, 4096, t});
+    b->Args({1,  4096, 4096, t});
+    b->Args({1,  4096, 1000, t});
+  }
+}
+
+BENCHMARK_CAPTURE(xnnpack_fully_connected_f32, mobilenet_v1, "MobileNet v1")->Apply(MobileNetV1)->UseRealTime();
+BENCHMARK_CAPTURE(xnnpack_fully_connected_f32, mobilenet_v2, "MobileNet v2")->Apply(MobileNetV2)->UseRealTime();
+BENCHMARK_CAPTURE(xnnpack_fully_connected_f32, inception_v3, "Inception v3")->Apply(InceptionV3)->UseRealTime();
+BENCHMARK_CAPTURE(xnnpack_fully_connected_f32, vgg, "VGG")->Apply(VGG)->UseRealTime();
+
+#ifndef XNNPACK_BENCHMARK_NO_MAIN
+BENCHMARK_MAIN();
+#endif
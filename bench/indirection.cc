@@ -0,0 +1,258 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <random>
+#include <vector>
+
+#ifdef __GLIBC__
+  #include <malloc.h>
+#endif
+
+#include <xnnpack.h>
+
+#include <benchmark/benchmark.h>
+
+
+// High-resolution Convolution and Max Pooling operators with regular (pointer) and compact (32-bit offset)
+// indirection buffers. Reports run time, and memory which setup allocates for the indirection buffer. Double-buffered
+// variants setup the operator for alternating input buffers before every run.
+
+// Returns the number of bytes allocated on the heap, or 0 if it is not available. Unlike resident set size, it
+// accounts for allocations which reuse memory freed by previous benchmarks.
+static size_t AllocatedMemory() {
+#if defined(__GLIBC__) && defined(__GLIBC_PREREQ)
+  #if __GLIBC_PREREQ(2, 33)
+    const struct mallinfo2 info = mallinfo2();
+  #else
+    const struct mallinfo info = mallinfo();
+  #endif
+  return size_t(info.uordblks) + size_t(info.hblkhd);
+#else
+  return 0;
+#endif
+}
+
+static void RunOperator(
+    benchmark::State& state,
+    xnn_operator_t op,
+    std::function<xnn_status(size_t)> setup,
+    size_t num_buffers,
+    size_t flops_per_run)
+{
+  // Only the indirection buffer is allocated in setup: inputs, outputs, and packed weights already exist.
+  const size_t allocated_before = AllocatedMemory();
+  for (size_t buffer = 0; buffer < num_buffers; buffer++) {
+    if (setup(buffer) != xnn_status_success) {
+      state.SkipWithError("failed to setup operator");
+      xnn_delete_operator(op);
+      return;
+    }
+  }
+  const size_t allocated_after = AllocatedMemory();
+
+  size_t buffer = 0;
+  for (auto _ : state) {
+    if (num_buffers > 1) {
+      if (setup(buffer) != xnn_status_success) {
+        state.SkipWithError("failed to setup operator");
+        break;
+      }
+      buffer = (buffer + 1) % num_buffers;
+    }
+    if (xnn_run_operator(op, nullptr /* thread pool */) != xnn_status_success) {
+      state.SkipWithError("failed to run operator");
+      break;
+    }
+  }
+  xnn_delete_operator(op);
+
+  if (flops_per_run != 0) {
+    state.counters["FLOPS"] = benchmark::Counter(
+      uint64_t(state.iterations()) * flops_per_run, benchmark::Counter::kIsRate);
+  }
+  if (allocated_before != 0 && allocated_after >= allocated_before) {
+    state.counters["indirection"] = benchmark::Counter(
+      double(allocated_after - allocated_before), benchmark::Counter::kDefaults, benchmark::Counter::OneK::kIs1024);
+  }
+}
+
+static void Convolution(benchmark::State& state, bool depthwise, bool compact, size_t num_buffers) {
+  const size_t input_height = state.range(0);
+  const size_t input_width = state.range(1);
+  const size_t input_channels = state.range(2);
+  const size_t output_channels = depthwise ? input_channels : state.range(3);
+  const size_t groups = depthwise ? input_channels : 1;
+  const size_t group_input_channels = input_channels / groups;
+  const size_t group_output_channels = output_channels / groups;
+  const size_t kernel_size = 3;
+
+  if (xnn_initialize() != xnn_status_success) {
+    state.SkipWithError("failed to initialize XNNPACK");
+    return;
+  }
+
+  std::random_device random_device;
+  auto rng = std::mt19937(random_device());
+  auto f32rng = std::bind(std::uniform_real_distribution<float>(0.0f, 1.0f), rng);
+
+  std::vector<std::vector<float>> inputs(num_buffers);
+  for (std::vector<float>& input : inputs) {
+    input.resize(input_height * input_width * input_channels + XNN_EXTRA_BYTES / sizeof(float));
+    std::generate(input.begin(), input.end(), std::ref(f32rng));
+  }
+  std::vector<float> kernel(output_channels * kernel_size * kernel_size * group_input_channels);
+  std::generate(kernel.begin(), kernel.end(), std::ref(f32rng));
+  std::vector<float> bias(output_channels);
+  std::generate(bias.begin(), bias.end(), std::ref(f32rng));
+  std::vector<float> output(input_height * input_width * output_channels);
+  std::fill(output.begin(), output.end(), 1.0f);
+
+  xnn_operator_t convolution_op = nullptr;
+  xnn_status status = xnn_create_convolution2d_nhwc_f32(
+    1, 1, 1, 1, kernel_size, kernel_size, 1, 1, 1, 1,
+    groups, group_input_channels, group_output_channels,
+    input_channels, output_channels,
+    kernel.data(), bias.data(),
+    -std::numeric_limits<float>::infinity(), +std::numeric_limits<float>::infinity(),
+    compact ? XNN_FLAG_COMPACT_INDIRECTION : 0, &convolution_op);
+  if (status != xnn_status_success) {
+    state.SkipWithError("failed to create FP32 Convolution operator");
+    return;
+  }
+
+  RunOperator(state, convolution_op,
+    [&](size_t buffer) {
+      return xnn_setup_convolution2d_nhwc_f32(
+        convolution_op, 1 /* batch size */, input_height, input_width,
+        inputs[buffer].data(), output.data(), nullptr /* thread pool */);
+    },
+    num_buffers,
+    2 * input_height * input_width * kernel_size * kernel_size * groups * group_input_channels * group_output_channels);
+}
+
+static void MaxPooling(benchmark::State& state, bool compact, size_t num_buffers) {
+  const size_t input_height = state.range(0);
+  const size_t input_width = state.range(1);
+  const size_t channels = state.range(2);
+  const size_t output_height = (input_height - 1) / 2 + 1;
+  const size_t output_width = (input_width - 1) / 2 + 1;
+
+  if (xnn_initialize() != xnn_status_success) {
+    state.SkipWithError("failed to initialize XNNPACK");
+    return;
+  }
+
+  std::random_device random_device;
+  auto rng = std::mt19937(random_device());
+  auto f32rng = std::bind(std::uniform_real_distribution<float>(0.0f, 1.0f), rng);
+
+  std::vector<std::vector<float>> inputs(num_buffers);
+  for (std::vector<float>& input : inputs) {
+    input.resize(input_height * input_width * channels + XNN_EXTRA_BYTES / sizeof(float));
+    std::generate(input.begin(), input.end(), std::ref(f32rng));
+  }
+  std::vector<float> output(output_height * output_width * channels);
+  std::fill(output.begin(), output.end(), 1.0f);
+
+  xnn_operator_t pooling_op = nullptr;
+  xnn_status status = xnn_create_max_pooling2d_nhwc_f32(
+    1, 1, 1, 1, 3, 3, 2, 2, 1, 1,
+    channels, channels /* input pixel stride */, channels /* output pixel stride */,
+    -std::numeric_limits<float>::infinity(), +std::numeric_limits<float>::infinity(),
+    compact ? XNN_FLAG_COMPACT_INDIRECTION : 0, &pooling_op);
+  if (status != xnn_status_success) {
+    state.SkipWithError("failed to create FP32 Max Pooling operator");
+    return;
+  }
+
+  RunOperator(state, pooling_op,
+    [&](size_t buffer) {
+      return xnn_setup_max_pooling2d_nhwc_f32(
+        pooling_op, 1 /* batch size */, input_height, input_width,
+        inputs[buffer].data(), output.data(), nullptr /* thread pool */);
+    },
+    num_buffers,
+    0 /* FLOPS */);
+}
+
+static void conv3x3_regular(benchmark::State& state) {
+  Convolution(state, false /* depthwise */, false /* compact */, 1 /* buffers */);
+}
+
+static void conv3x3_compact(benchmark::State& state) {
+  Convolution(state, false /* depthwise */, true /* compact */, 1 /* buffers */);
+}
+
+static void dwconv3x3_regular(benchmark::State& state) {
+  Convolution(state, true /* depthwise */, false /* compact */, 1 /* buffers */);
+}
+
+static void dwconv3x3_compact(benchmark::State& state) {
+  Convolution(state, true /* depthwise */, true /* compact */, 1 /* buffers */);
+}
+
+static void dwconv3x3_regular_double_buffered(benchmark::State& state) {
+  Convolution(state, true /* depthwise */, false /* compact */, 2 /* buffers */);
+}
+
+static void dwconv3x3_compact_double_buffered(benchmark::State& state) {
+  Convolution(state, true /* depthwise */, true /* compact */, 2 /* buffers */);
+}
+
+static void maxpool3x3s2_regular(benchmark::State& state) {
+  MaxPooling(state, false /* compact */, 1 /* buffers */);
+}
+
+static void maxpool3x3s2_compact(benchmark::State& state) {
+  MaxPooling(state, true /* compact */, 1 /* buffers */);
+}
+
+static void maxpool3x3s2_regular_double_buffered(benchmark::State& state) {
+  MaxPooling(state, false /* compact */, 2 /* buffers */);
+}
+
+static void maxpool3x3s2_compact_double_buffered(benchmark::State& state) {
+  MaxPooling(state, true /* compact */, 2 /* buffers */);
+}
+
+static void ConvolutionArguments(benchmark::internal::Benchmark* b) {
+  b->ArgNames({"H", "W", "Cin", "Cout"});
+  b->Args({ 512,  512, 16, 16});
+  b->Args({1024, 1024,  8,  8});
+  b->Args({2048, 2048,  4,  4});
+}
+
+static void DepthwiseConvolutionArguments(benchmark::internal::Benchmark* b) {
+  b->ArgNames({"H", "W", "C"});
+  b->Args({ 512,  512, 32});
+  b->Args({1024, 1024, 16});
+  b->Args({2048, 2048,  8});
+}
+
+static void MaxPoolingArguments(benchmark::internal::Benchmark* b) {
+  b->ArgNames({"H", "W", "C"});
+  b->Args({ 512,  512, 32});
+  b->Args({1024, 1024, 16});
+  b->Args({2048, 2048,  8});
+}
+
+BENCHMARK(conv3x3_regular)->Apply(ConvolutionArguments)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(conv3x3_compact)->Apply(ConvolutionArguments)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(dwconv3x3_regular)->Apply(DepthwiseConvolutionArguments)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(dwconv3x3_compact)->Apply(DepthwiseConvolutionArguments)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(dwconv3x3_regular_double_buffered)->Apply(DepthwiseConvolutionArguments)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(dwconv3x3_compact_double_buffered)->Apply(DepthwiseConvolutionArguments)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(maxpool3x3s2_regular)->Apply(MaxPoolingArguments)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(maxpool3x3s2_compact)->Apply(MaxPoolingArguments)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(maxpool3x3s2_regular_double_buffered)->Apply(MaxPoolingArguments)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(maxpool3x3s2_compact_double_buffered)->Apply(MaxPoolingArguments)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+#ifndef XNNPACK_BENCHMARK_NO_MAIN
+BENCHMARK_MAIN();
+#endif
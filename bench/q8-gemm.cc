@@ -36,12 +36,16 @@
 
 static void GEMMBenchmark(benchmark::State& state,
   xnn_q8_gemm_ukernel_function q8gemm,
-  size_t mr, size_t nr, size_t kr)
+  size_t mr, size_t nr, size_t kr,
+  benchmark::utils::IsaCheckFunction isa_check = nullptr)
 {
   if (!cpuinfo_initialize()) {
     state.SkipWithError("cpuinfo initialization failed");
     return;
   }
+  if (isa_check && !isa_check(state)) {
+    return;
+  }
 
   const size_t mc = state.range(0);
   const size_t nc = state.range(1);
@@ -316,8 +320,18 @@ static void ruy_st(benchmark::State& state, const char* net)
     GEMMBenchmark(state, xnn_q8_gemm_ukernel_2x4c8__sse2, 2, 4, 8);
   }
 
+  static void q8gemm_4x8c2__sse41(benchmark::State& state, const char* net) {
+    GEMMBenchmark(state, xnn_q8_gemm_ukernel_4x8c2__sse41, 4, 8, 2, benchmark::utils::CheckSSE41);
+  }
+
+  static void q8gemm_4x16c2__avx2(benchmark::State& state, const char* net) {
+    GEMMBenchmark(state, xnn_q8_gemm_ukernel_4x16c2__avx2, 4, 16, 2, benchmark::utils::CheckAVX2);
+  }
+
   BENCHMARK_GEMM(q8gemm_4x4c2__sse2)
   BENCHMARK_GEMM(q8gemm_2x4c8__sse2)
+  BENCHMARK_GEMM(q8gemm_4x8c2__sse41)
+  BENCHMARK_GEMM(q8gemm_4x16c2__avx2)
 #endif
 
 #ifdef BENCHMARK_RUY
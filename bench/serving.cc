@@ -0,0 +1,196 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <functional>
+#include <limits>
+#include <random>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+  #include <unistd.h>
+#endif
+
+#include <xnnpack.h>
+
+#include <benchmark/benchmark.h>
+
+
+// Multi-layer perceptron served by several threads, each processing its own stream of single-batch requests.
+// Compares two ways to serve concurrent requests:
+// - Shared weights: operators are created once, and every serving thread runs its own execution contexts of them.
+// - Cloned operators: every serving thread creates its own copy of every operator, including packed weights.
+
+static const size_t kRequestsPerThread = 16;
+
+// Returns resident set size of the process in bytes, or 0 if it is not available.
+static size_t ResidentSetSize() {
+#ifdef __linux__
+  FILE* statm = fopen("/proc/self/statm", "r");
+  if (statm == nullptr) {
+    return 0;
+  }
+  unsigned long total_pages = 0, resident_pages = 0;
+  const int num_values = fscanf(statm, "%lu %lu", &total_pages, &resident_pages);
+  fclose(statm);
+  if (num_values != 2) {
+    return 0;
+  }
+  return size_t(resident_pages) * size_t(sysconf(_SC_PAGESIZE));
+#else
+  return 0;
+#endif
+}
+
+static void ServeMLP(benchmark::State& state, bool share_weights) {
+  const size_t num_layers = state.range(0);
+  const size_t channels = state.range(1);
+  const size_t num_threads = state.range(2);
+
+  if (xnn_initialize() != xnn_status_success) {
+    state.SkipWithError("failed to initialize XNNPACK");
+    return;
+  }
+
+  std::random_device random_device;
+  auto rng = std::mt19937(random_device());
+  auto f32rng = std::bind(std::uniform_real_distribution<float>(-1.0f, 1.0f), rng);
+
+  std::vector<std::vector<float>> kernels(num_layers, std::vector<float>(channels * channels));
+  std::vector<std::vector<float>> biases(num_layers, std::vector<float>(channels));
+  for (size_t layer = 0; layer < num_layers; layer++) {
+    std::generate(kernels[layer].begin(), kernels[layer].end(), std::ref(f32rng));
+    std::generate(biases[layer].begin(), biases[layer].end(), std::ref(f32rng));
+  }
+
+  // Memory used by per-request state and packed weights, excluding the unpacked weights above.
+  const size_t rss_before = ResidentSetSize();
+
+  auto create_layer = [&](size_t layer, xnn_operator_t* op_out) {
+    return xnn_create_fully_connected_nc_f32(
+      channels, channels, channels, channels,
+      kernels[layer].data(), biases[layer].data(),
+      0.0f, std::numeric_limits<float>::infinity(),
+      0 /* flags */, op_out);
+  };
+
+  // Operators shared by all serving threads.
+  std::vector<xnn_operator_t> shared_operators;
+  if (share_weights) {
+    shared_operators.resize(num_layers, nullptr);
+    for (size_t layer = 0; layer < num_layers; layer++) {
+      if (create_layer(layer, &shared_operators[layer]) != xnn_status_success) {
+        state.SkipWithError("failed to create FP32 Fully Connected operator");
+        return;
+      }
+    }
+  }
+
+  // Per-thread operators: execution contexts of the shared operators, or full copies.
+  std::vector<std::vector<xnn_operator_t>> thread_operators(num_threads, std::vector<xnn_operator_t>(num_layers));
+  for (size_t thread = 0; thread < num_threads; thread++) {
+    for (size_t layer = 0; layer < num_layers; layer++) {
+      const xnn_status status = share_weights ?
+        xnn_create_execution_context(shared_operators[layer], &thread_operators[thread][layer]) :
+        create_layer(layer, &thread_operators[thread][layer]);
+      if (status != xnn_status_success) {
+        state.SkipWithError("failed to create per-thread operator");
+        return;
+      }
+    }
+  }
+
+  // Ping-pong activation buffers for every serving thread.
+  std::vector<std::vector<float>> activations(num_threads * 2,
+    std::vector<float>(channels + XNN_EXTRA_BYTES / sizeof(float)));
+  for (size_t thread = 0; thread < num_threads; thread++) {
+    std::generate(activations[thread * 2].begin(), activations[thread * 2].end(), std::ref(f32rng));
+  }
+
+  std::vector<xnn_status> thread_status(num_threads, xnn_status_success);
+  auto serve = [&](size_t thread) {
+    for (size_t request = 0; request < kRequestsPerThread; request++) {
+      for (size_t layer = 0; layer < num_layers; layer++) {
+        const float* input = activations[thread * 2 + layer % 2].data();
+        float* output = activations[thread * 2 + (layer + 1) % 2].data();
+        xnn_status status = xnn_setup_fully_connected_nc_f32(
+          thread_operators[thread][layer], 1 /* batch size */, input, output, nullptr /* thread pool */);
+        if (status == xnn_status_success) {
+          status = xnn_run_operator(thread_operators[thread][layer], nullptr /* thread pool */);
+        }
+        if (status != xnn_status_success) {
+          thread_status[thread] = status;
+          return;
+        }
+      }
+    }
+  };
+
+  // Warm up, so that all per-thread buffers are allocated and resident before memory is measured.
+  for (size_t thread = 0; thread < num_threads; thread++) {
+    serve(thread);
+  }
+  const size_t rss_after = ResidentSetSize();
+
+  for (auto _ : state) {
+    std::vector<std::thread> threads;
+    for (size_t thread = 0; thread < num_threads; thread++) {
+      threads.emplace_back(serve, thread);
+    }
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+  }
+
+  if (std::any_of(thread_status.cbegin(), thread_status.cend(),
+      [](xnn_status status) { return status != xnn_status_success; }))
+  {
+    state.SkipWithError("failed to serve request");
+  }
+
+  for (size_t thread = 0; thread < num_threads; thread++) {
+    for (xnn_operator_t op : thread_operators[thread]) {
+      xnn_delete_operator(op);
+    }
+  }
+  for (xnn_operator_t op : shared_operators) {
+    xnn_delete_operator(op);
+  }
+
+  state.counters["requests"] = benchmark::Counter(
+    uint64_t(state.iterations()) * num_threads * kRequestsPerThread, benchmark::Counter::kIsRate);
+  state.counters["FLOPS"] = benchmark::Counter(
+    uint64_t(state.iterations()) * num_threads * kRequestsPerThread * num_layers * 2 * channels * channels,
+    benchmark::Counter::kIsRate);
+  if (rss_before != 0 && rss_after > rss_before) {
+    state.counters["RSS"] = benchmark::Counter(double(rss_after - rss_before), benchmark::Counter::kDefaults,
+      benchmark::Counter::OneK::kIs1024);
+  }
+}
+
+static void shared_weights(benchmark::State& state) {
+  ServeMLP(state, true /* share weights */);
+}
+
+static void cloned_operators(benchmark::State& state) {
+  ServeMLP(state, false /* share weights */);
+}
+
+static void ServingArguments(benchmark::internal::Benchmark* b) {
+  b->ArgNames({"layers", "channels", "threads"});
+  for (int threads : {1, 2, 4, 8}) {
+    b->Args({4, 1024, threads});
+  }
+}
+
+BENCHMARK(shared_weights)->Apply(ServingArguments)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(cloned_operators)->Apply(ServingArguments)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+#ifndef XNNPACK_BENCHMARK_NO_MAIN
+BENCHMARK_MAIN();
+#endif
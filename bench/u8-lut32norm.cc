@@ -0,0 +1,76 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <cpuinfo.h>
+
+#include <benchmark/benchmark.h>
+#include "bench/utils.h"
+#include <xnnpack/AlignedAllocator.h>
+#include <xnnpack/common.h>
+#include <xnnpack/lut.h>
+#include <xnnpack/params.h>
+
+
+static void u8_lut32norm(
+  benchmark::State& state,
+  xnn_u8_lut32norm_ukernel_function u8_lut32norm)
+{
+  const size_t n = state.range(0);
+
+  std::random_device random_device;
+  auto rng = std::mt19937(random_device());
+  auto u8rng = std::bind(std::uniform_int_distribution<uint8_t>(), rng);
+  // Limit table entries so that the sum over n elements, scaled by 256, does not overflow 32 bits.
+  auto u32rng = std::bind(
+    std::uniform_int_distribution<uint32_t>(1, std::numeric_limits<uint32_t>::max() / (257 * n)), rng);
+
+  std::vector<uint8_t, AlignedAllocator<uint8_t, 64>> x(n);
+  std::vector<uint32_t, AlignedAllocator<uint32_t, 64>> t(256);
+  std::vector<uint8_t, AlignedAllocator<uint8_t, 64>> y(n);
+  std::generate(x.begin(), x.end(), std::ref(u8rng));
+  std::generate(t.begin(), t.end(), std::ref(u32rng));
+
+  for (auto _ : state) {
+    u8_lut32norm(n, x.data(), t.data(), y.data());
+  }
+
+  state.counters["Freq"] = benchmark::utils::GetCurrentCpuFrequency();
+
+  state.counters["elements"] =
+    benchmark::Counter(uint64_t(state.iterations()) * n, benchmark::Counter::kIsRate);
+
+  state.counters["bytes"] =
+    benchmark::Counter(uint64_t(state.iterations()) * 2 * n * sizeof(uint8_t), benchmark::Counter::kIsRate);
+}
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  BENCHMARK_CAPTURE(u8_lut32norm, sse2, xnn_u8_lut32norm_ukernel__sse2)
+    ->RangeMultiplier(10)
+    ->Range(10, 100000)
+    ->UseRealTime();
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  BENCHMARK_CAPTURE(u8_lut32norm, neon, xnn_u8_lut32norm_ukernel__neon)
+    ->RangeMultiplier(10)
+    ->Range(10, 100000)
+    ->UseRealTime();
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+BENCHMARK_CAPTURE(u8_lut32norm, scalar, xnn_u8_lut32norm_ukernel__scalar)
+  ->RangeMultiplier(10)
+  ->Range(10, 100000)
+  ->UseRealTime();
+
+#ifndef XNNPACK_BENCHMARK_NO_MAIN
+BENCHMARK_MAIN();
+#endif
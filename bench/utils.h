@@ -9,6 +9,9 @@
 #include <cstdint>
 
 namespace benchmark {
+
+class State;
+
 namespace utils {
 
 uint32_t wipeCache();
@@ -21,6 +24,30 @@ uint64_t GetCurrentCpuFrequency();
 // Can overestimate, but not underestimate LLC size.
 size_t GetMaxCacheSize();
 
+// Pointer to a function that checks if the host processor supports the instruction set extension required by a
+// micro-kernel. If the check fails, the function reports an error through the benchmark state and returns false.
+typedef bool (*IsaCheckFunction)(benchmark::State& state);
+
+// Check if x86 SSSE3 extension is supported.
+// If SSSE3 is unsupported, report error in benchmark state, and return false.
+bool CheckSSSE3(benchmark::State& state);
+
+// Check if x86 SSE4.1 extension is supported.
+// If SSE4.1 is unsupported, report error in benchmark state, and return false.
+bool CheckSSE41(benchmark::State& state);
+
+// Check if x86 AVX2 extension is supported.
+// If AVX2 is unsupported, report error in benchmark state, and return false.
+bool CheckAVX2(benchmark::State& state);
+
+// Check if x86 FMA3 extension is supported.
+// If FMA3 is unsupported, report error in benchmark state, and return false.
+bool CheckFMA3(benchmark::State& state);
+
+// Check if x86 AVX512F extension is supported.
+// If AVX512F is unsupported, report error in benchmark state, and return false.
+bool CheckAVX512F(benchmark::State& state);
+
 template <class T>
 inline T divideRoundUp(T x, T q) {
   return x / q + T(x % q != 0);
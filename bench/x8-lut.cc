@@ -0,0 +1,83 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include <cpuinfo.h>
+
+#include <benchmark/benchmark.h>
+#include "bench/utils.h"
+#include <xnnpack.h>
+#include <xnnpack/AlignedAllocator.h>
+#include <xnnpack/common.h>
+#include <xnnpack/lut.h>
+#include <xnnpack/params.h>
+
+
+static void x8_lut(
+  benchmark::State& state,
+  xnn_x8_lut_ukernel_function x8_lut,
+  benchmark::utils::IsaCheckFunction isa_check = nullptr)
+{
+  if (isa_check && !isa_check(state)) {
+    return;
+  }
+
+  const size_t n = state.range(0);
+
+  std::random_device random_device;
+  auto rng = std::mt19937(random_device());
+  auto u8rng = std::bind(std::uniform_int_distribution<uint8_t>(), rng);
+
+  std::vector<uint8_t, AlignedAllocator<uint8_t, 64>> x(n + XNN_EXTRA_BYTES / sizeof(uint8_t));
+  std::vector<uint8_t, AlignedAllocator<uint8_t, 64>> t(256);
+  std::vector<uint8_t, AlignedAllocator<uint8_t, 64>> y(n);
+  std::generate(x.begin(), x.end(), std::ref(u8rng));
+  std::generate(t.begin(), t.end(), std::ref(u8rng));
+
+  for (auto _ : state) {
+    x8_lut(n, x.data(), t.data(), y.data());
+  }
+
+  state.counters["Freq"] = benchmark::utils::GetCurrentCpuFrequency();
+
+  state.counters["elements"] =
+    benchmark::Counter(uint64_t(state.iterations()) * n, benchmark::Counter::kIsRate);
+
+  state.counters["bytes"] =
+    benchmark::Counter(uint64_t(state.iterations()) * 2 * n * sizeof(uint8_t), benchmark::Counter::kIsRate);
+}
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  BENCHMARK_CAPTURE(x8_lut, ssse3_x16, xnn_x8_lut_ukernel__ssse3_x16, benchmark::utils::CheckSSSE3)
+    ->RangeMultiplier(10)
+    ->Range(1000, 100000000)
+    ->UseRealTime();
+
+  BENCHMARK_CAPTURE(x8_lut, avx2_x32, xnn_x8_lut_ukernel__avx2_x32, benchmark::utils::CheckAVX2)
+    ->RangeMultiplier(10)
+    ->Range(1000, 100000000)
+    ->UseRealTime();
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  BENCHMARK_CAPTURE(x8_lut, neon_x16, xnn_x8_lut_ukernel__neon_x16)
+    ->RangeMultiplier(10)
+    ->Range(1000, 100000000)
+    ->UseRealTime();
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+BENCHMARK_CAPTURE(x8_lut, scalar, xnn_x8_lut_ukernel__scalar)
+  ->RangeMultiplier(10)
+  ->Range(1000, 100000000)
+  ->UseRealTime();
+
+#ifndef XNNPACK_BENCHMARK_NO_MAIN
+BENCHMARK_MAIN();
+#endif
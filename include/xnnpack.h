@@ -30,6 +30,37 @@ extern "C" {
 /// The operator assumes NHWC layout for the input, regardless of the output layout.
 #define XNN_FLAG_INPUT_NHWC 0x00000002
 
+/// The operator stores its indirection buffer as 32-bit offsets relative to the input image, rather than as pointers.
+/// This halves the indirection buffer size with 64-bit pointers, and for depthwise Convolution and Max Pooling
+/// operators makes it independent of the batch size.
+/// Supported by Convolution operators which use IGEMM or DWCONV micro-kernels, and by Max Pooling operators.
+/// Other operators, and inputs too large for 32-bit offsets, use regular indirection buffers.
+#define XNN_FLAG_COMPACT_INDIRECTION 0x00000004
+
+/// Don't use the Winograd algorithm for 3x3 stride-1 Convolution operators.
+/// By default, F32 Convolution operators with 3x3 kernels, unit stride and dilation, no groups, and enough input and
+/// output channels compute convolution with the Winograd F(4x4, 3x3) algorithm: it does 4x fewer multiplications than
+/// direct convolution, but rounding errors are larger.
+#define XNN_FLAG_DISABLE_WINOGRAD 0x00000008
+
+/// Store packed weights of the operator in IEEE half-precision format, and convert them to single-precision inside
+/// the micro-kernel. Halves the memory traffic for weights in the operators limited by memory bandwidth, such as Fully
+/// Connected operators with small batch size, at the cost of rounding the weights to 11 significant bits.
+/// Supported by F32 Fully Connected operators, and by F32 Convolution operators with 1x1 kernels, unit stride, and no
+/// padding. Mutually exclusive with XNN_FLAG_INT8_WEIGHTS.
+#define XNN_FLAG_FP16_WEIGHTS 0x00000010
+
+/// Store packed weights of the operator as signed 8-bit integers with a per-output-channel scale, and dequantize them
+/// inside the micro-kernel. Quarters the memory traffic for weights, at the cost of symmetric 8-bit quantization of
+/// the weights. Supported by the same operators as XNN_FLAG_FP16_WEIGHTS.
+#define XNN_FLAG_INT8_WEIGHTS 0x00000020
+
+/// Don't use the sparse representation of weights in F32 Convolution and Fully Connected operators.
+/// By default, F32 Fully Connected operators, and F32 Convolution operators with 1x1 kernels, unit stride, and no
+/// padding, count non-zero kernel elements at creation, and multiply sparse enough kernels with SpMM micro-kernels
+/// instead of GEMM. Operators with sparse weights don't support serialization of packed weights.
+#define XNN_FLAG_DISABLE_SPARSE_WEIGHTS 0x00000040
+
 /// Status code for any XNNPACK function call.
 enum xnn_status {
   /// The call succeeded, and all output arguments now contain valid data.
@@ -71,6 +102,628 @@ enum xnn_status xnn_run_operator(
 enum xnn_status xnn_delete_operator(
     xnn_operator_t op);
 
+/// Create an execution context for an operator.
+///
+/// An execution context is an operator handle which shares the immutable state of the original operator (packed
+/// weights, lookup tables, and micro-kernel selection), but owns the state which xnn_setup_* functions produce and
+/// xnn_run_operator consumes (indirection buffers, work buffers, and parallelization parameters). Execution contexts
+/// of the same operator can be setup and run concurrently from different threads, with a single copy of packed weights
+/// in memory.
+///
+/// An execution context is setup with the same xnn_setup_* function as the original operator, run with
+/// xnn_run_operator, and deleted with xnn_delete_operator. All execution contexts must be deleted before the original
+/// operator.
+///
+/// @param op - the operator to create an execution context for. If op is an execution context itself, the new
+///             execution context shares the immutable state of the original operator.
+/// @param context_out - pointer to the variable that will be initialized with a handle to the execution context upon
+///                      successful return.
+/// @retval xnn_status_unsupported_parameter - the operator does not support execution contexts. Operators in SpNCHW
+///                                            layout allocate part of their immutable state at setup time, and are
+///                                            not supported.
+enum xnn_status xnn_create_execution_context(
+    xnn_operator_t op,
+    xnn_operator_t* context_out);
+
+/// Version of the packed weights format produced by xnn_export_operator_packed_weights.
+#define XNN_PACKED_WEIGHTS_VERSION 1
+
+/// Query the size of the serialized packed weights of an operator.
+///
+/// Serialization of packed weights is supported for F32 Convolution and F32 Fully Connected operators, unless they use
+/// the sparse representation of weights (see XNN_FLAG_DISABLE_SPARSE_WEIGHTS).
+///
+/// @param op - the operator to query.
+/// @param size_out - pointer to the variable that will be initialized with the size in bytes of the serialized
+///                   packed weights upon successful return.
+/// @retval xnn_status_unsupported_parameter - the operator does not support serialization of packed weights.
+enum xnn_status xnn_get_operator_packed_weights_size(
+    xnn_operator_t op,
+    size_t* size_out);
+
+/// Serialize packed weights of an operator, together with their layout, into a blob.
+///
+/// The blob is tagged with the version of the format, the target architecture, and the micro-kernel tile, and can be
+/// loaded only by an operator with the same parameters created on a compatible host via a *_from_packed_weights
+/// create function.
+///
+/// @param op - the operator with the packed weights to serialize.
+/// @param blob_size - size of the blob buffer, must be at least the size returned by
+///                    xnn_get_operator_packed_weights_size.
+/// @param blob - pointer to the blob buffer.
+enum xnn_status xnn_export_operator_packed_weights(
+    xnn_operator_t op,
+    size_t blob_size,
+    void* blob);
+
+/// Profile of an operator, collected by xnn_run_operator after profiling is enabled with
+/// xnn_enable_operator_profiling.
+struct xnn_operator_profile {
+  /// Human-readable name of the operator type, e.g. "Convolution (NHWC, F32)".
+  const char* operator_name;
+  /// Human-readable name of the micro-kernel type chosen for the last setup, e.g. "GEMM" or "DWCONV".
+  const char* ukernel_name;
+  /// Tile of the micro-kernel: MR x NR x KR for GEMM-like micro-kernels, MR for micro-kernels tiled in one dimension
+  /// (e.g. number of taps in DWCONV). Unused dimensions are zero.
+  uint32_t mr;
+  uint32_t nr;
+  uint32_t kr;
+  /// Number of compute passes in one run, e.g. 2 when A is packed into panels before PPMM, or when the partial
+  /// results of split-K GEMM are reduced in a separate pass.
+  uint32_t num_passes;
+  /// Number of dimensions in the parallelization of the main compute pass, and its range and tile.
+  uint32_t parallelization_dims;
+  size_t parallelization_range[6];
+  size_t parallelization_tile[2];
+  /// Number of threads in the thread pool passed to the last xnn_run_operator call.
+  size_t num_threads;
+  /// Arithmetic operations in one run, as derived from the setup parameters. A multiply-add counts as two operations,
+  /// and integer operations in quantized operators are counted too.
+  uint64_t flops;
+  /// Compulsory memory traffic in one run, as derived from the setup parameters: bytes of inputs and outputs, and
+  /// bytes of static weights.
+  uint64_t bytes;
+  /// Number of xnn_run_operator calls since profiling was enabled.
+  uint64_t run_count;
+  /// Wall time of all runs, of the fastest run, and of the last run, in nanoseconds.
+  uint64_t total_time_ns;
+  uint64_t min_time_ns;
+  uint64_t last_time_ns;
+};
+
+/// Enable or disable profiling of an operator in xnn_run_operator.
+///
+/// Profiling adds two timer reads to every run of the operator. Enabling profiling resets the collected statistics.
+///
+/// @param op - the operator to profile.
+/// @param enable - true to start collecting statistics, false to stop.
+enum xnn_status xnn_enable_operator_profiling(
+    xnn_operator_t op,
+    bool enable);
+
+/// Query the profile of an operator.
+///
+/// @param op - the operator to query. The operator must be successfully setup.
+/// @param profile_out - pointer to the structure that will be initialized with the operator profile upon successful
+///                      return. Statistics of runs are zero if profiling of the operator is not enabled.
+enum xnn_status xnn_get_operator_profile(
+    xnn_operator_t op,
+    struct xnn_operator_profile* profile_out);
+
+/// Enable or disable caching of setup state for recently used input shapes.
+///
+/// When the input height or width changes, xnn_setup_* functions rebuild the indirection buffer of the operator. With
+/// the shape cache enabled, the indirection buffer and the compute parameters for the previous input shape are kept,
+/// and switching back to a cached shape costs only a lookup. The cache holds up to max_shapes shapes besides the
+/// current one, and evicts the least recently used shape when full.
+///
+/// The shape cache is supported for Convolution operators in NHWC layout.
+///
+/// @param op - the operator to enable the shape cache for.
+/// @param max_shapes - maximum number of cached shapes. Zero disables the cache and releases all cached state.
+/// @retval xnn_status_unsupported_parameter - the operator does not support the shape cache.
+enum xnn_status xnn_enable_operator_shape_cache(
+    xnn_operator_t op,
+    size_t max_shapes);
+
+/// Maximum number of dimensions in a tensor shape.
+#define XNN_MAX_TENSOR_DIMS 6
+
+/// Invalid Value ID.
+#define XNN_INVALID_VALUE_ID UINT32_MAX
+
+/// The Value is an external input of the Subgraph: its data is provided by the user in xnn_setup_runtime.
+#define XNN_VALUE_FLAG_EXTERNAL_INPUT  0x00000001
+
+/// The Value is an external output of the Subgraph: its data is provided by the user in xnn_setup_runtime.
+#define XNN_VALUE_FLAG_EXTERNAL_OUTPUT 0x00000002
+
+/// Type of elements in a Value.
+enum xnn_datatype {
+  /// Invalid data type. Valid Values never have this datatype.
+  xnn_datatype_invalid = 0,
+  /// IEEE754 single-precision floating-point.
+  xnn_datatype_fp32 = 1,
+};
+
+/// Subgraph is an abstract representation of a neural network model.
+/// Subgraph objects are used to define Values (tensors) and Nodes (operators) comprising the model.
+typedef struct xnn_subgraph* xnn_subgraph_t;
+
+/// Create an empty Subgraph object.
+///
+/// @param external_value_ids - number of Value IDs to reserve for communication with external graph representation.
+///                             The Subgraph object would avoid creating internal Value IDs in the
+///                             [0, external_value_ids-1] range.
+/// @param flags - binary features of the subgraph. No supported flags are currently defined.
+/// @param subgraph_out - pointer to the variable that will be initialized with a handle to the Subgraph object upon
+///                       successful return.
+enum xnn_status xnn_create_subgraph(
+    uint32_t external_value_ids,
+    uint32_t flags,
+    xnn_subgraph_t* subgraph_out);
+
+/// Destroy a Subgraph object, as well as Values, and Nodes associated with the subgraph.
+///
+/// @param subgraph - the Subgraph object to destroy.
+enum xnn_status xnn_delete_subgraph(
+    xnn_subgraph_t subgraph);
+
+/// Define a tensor-type Value and add it to a Subgraph.
+///
+/// @param subgraph - a Subgraph object that will own the created Value.
+/// @param datatype - type of the tensor elements.
+/// @param num_dims - number of dimensions in the shape.
+/// @param dims - pointer to an array of @a num_dims shape dimensions. If num_dims is 0, this pointer can be NULL.
+///               XNNPACK does not keep any pointers to this array after the function returns.
+/// @param data - pointer to static data used for tensor initialization. If the tensor is not statically initialized,
+///               this pointer must be is NULL. If non-NULL, the life-time of the static data must exceed the life-time
+///               of the Subgraph object, and of any Runtime objects created from the Subgraph.
+/// @param external_id - external ID for the Value. The ID must be within the range of reversed Value IDs specified on
+///                      the Subgraph creation. If the external ID is XNN_INVALID_VALUE_ID, an internal ID will be
+///                      created for the Value.
+/// @param flags - binary features of the Value. Supported values are any combination of XNN_VALUE_FLAG_EXTERNAL_INPUT
+///                and XNN_VALUE_FLAG_EXTERNAL_OUTPUT.
+/// @param id_out - pointer to the variable that will be initialized with the Value ID upon successful return. If a
+///                 valid @a external_id was provided, the variable will be initialized with the @a external_id value.
+enum xnn_status xnn_define_tensor_value(
+    xnn_subgraph_t subgraph,
+    enum xnn_datatype datatype,
+    size_t num_dims,
+    const size_t* dims,
+    const void* data,
+    uint32_t external_id,
+    uint32_t flags,
+    uint32_t* id_out);
+
+/// Define a 2D Convolution Node and add it to a Subgraph.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param input_padding_top - implicit zero-padding above 2D input data.
+/// @param input_padding_right - implicit zero-padding to the right of 2D input data.
+/// @param input_padding_bottom - implicit zero-padding below 2D input data.
+/// @param input_padding_left - implicit zero-padding to the left of 2D input data.
+/// @param kernel_height - kernel (filter) height.
+/// @param kernel_width - kernel (filter) width.
+/// @param subsampling_height - height of subsampling region for convolution output (convolution height stride).
+/// @param subsampling_width - width of subsampling region for convolution output (convolution width stride).
+/// @param dilation_height - dilation of kernel elements along the height dimension.
+/// @param dilation_width - dilation of kernel elements along the width dimension.
+/// @param groups - number of convolution groups.
+/// @param group_input_channels - number of input channels per group.
+/// @param group_output_channels - number of output channels per group.
+/// @param output_min - lower bound for clipping output values.
+/// @param output_max - upper bound for clipping output values.
+/// @param input_id - Value ID for the input tensor. The input tensor must be a 4D tensor defined in the @a subgraph
+///                   with [N, IH, IW, groups * group_input_channels] dimensions
+/// @param filter_id - Value ID for the filter tensor. The filter tensor must ge a 4D tensor defined in the @a subgraph
+///                    with [groups * group_output_channels, kernel_height, kernel_width, group_input_channels]
+///                    dimensions.
+/// @param bias_id - Value ID for the bias tensor. The bias tensor must be a 1D tensor defined in the @a subgraph with
+///                  [groups * group_output_channels] dimensions.
+/// @param output_id - Value ID for the output tensor. The output tensor must be a 4D tensor defined in the @a subgraph
+///                    with [N, OH, OW, groups * group_output_channels] dimensions.
+/// @param flags - binary features of the 2D Convolution Node. No supported flags are currently defined.
+enum xnn_status xnn_define_convolution_2d(
+    xnn_subgraph_t subgraph,
+    uint32_t input_padding_top,
+    uint32_t input_padding_right,
+    uint32_t input_padding_bottom,
+    uint32_t input_padding_left,
+    uint32_t kernel_height,
+    uint32_t kernel_width,
+    uint32_t subsampling_height,
+    uint32_t subsampling_width,
+    uint32_t dilation_height,
+    uint32_t dilation_width,
+    uint32_t groups,
+    size_t group_input_channels,
+    size_t group_output_channels,
+    float output_min,
+    float output_max,
+    uint32_t input_id,
+    uint32_t filter_id,
+    uint32_t bias_id,
+    uint32_t output_id,
+    uint32_t flags);
+
+/// Define a 2D Depthwise Convolution Node and add it to a Subgraph.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param input_padding_top - implicit zero-padding above 2D input data.
+/// @param input_padding_right - implicit zero-padding to the right of 2D input data.
+/// @param input_padding_bottom - implicit zero-padding below 2D input data.
+/// @param input_padding_left - implicit zero-padding to the left of 2D input data.
+/// @param kernel_height - kernel (filter) height.
+/// @param kernel_width - kernel (filter) width.
+/// @param subsampling_height - height of subsampling region for convolution output (convolution height stride).
+/// @param subsampling_width - width of subsampling region for convolution output (convolution width stride).
+/// @param dilation_height - dilation of kernel elements along the height dimension.
+/// @param dilation_width - dilation of kernel elements along the width dimension.
+/// @param depth_multiplier - ratio of output channels to input channels.
+/// @param input_channels - number of input channels.
+/// @param output_min - lower bound for clipping output values.
+/// @param output_max - upper bound for clipping output values.
+/// @param input_id - Value ID for the input tensor. The input tensor must be a 4D tensor defined in the @a subgraph
+///                   with [N, IH, IW, input_channels] dimensions
+/// @param filter_id - Value ID for the filter tensor. The filter tensor must ge a 4D tensor defined in the @a subgraph
+///                    with [1, kernel_height, kernel_width, input_channels * depth_multiplier] dimensions.
+/// @param bias_id - Value ID for the bias tensor. The bias tensor must be a 1D tensor defined in the @a subgraph with
+///                  [input_channels * depth_multiplier] dimensions.
+/// @param output_id - Value ID for the output tensor. The output tensor must be a 4D tensor defined in the @a subgraph
+///                    with [N, OH, OW, input_channels * depth_multiplier] dimensions.
+/// @param flags - binary features of the 2D Depthwise Convolution Node. No supported flags are currently defined.
+enum xnn_status xnn_define_depthwise_convolution_2d(
+    xnn_subgraph_t subgraph,
+    uint32_t input_padding_top,
+    uint32_t input_padding_right,
+    uint32_t input_padding_bottom,
+    uint32_t input_padding_left,
+    uint32_t kernel_height,
+    uint32_t kernel_width,
+    uint32_t subsampling_height,
+    uint32_t subsampling_width,
+    uint32_t dilation_height,
+    uint32_t dilation_width,
+    uint32_t depth_multiplier,
+    size_t input_channels,
+    float output_min,
+    float output_max,
+    uint32_t input_id,
+    uint32_t filter_id,
+    uint32_t bias_id,
+    uint32_t output_id,
+    uint32_t flags);
+
+/// Define a Fully Connected Node and add it to a Subgraph.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param output_min - lower bound for clipping output values.
+/// @param output_max - upper bound for clipping output values.
+/// @param input_id - Value ID for the input tensor. The input tensor must be an N-dimensional tensor defined in the
+///                   @a subgraph, with the last dimension equal to the number of input channels.
+/// @param filter_id - Value ID for the filter tensor. The filter tensor must ge a 2D tensor defined in the @a subgraph
+///                    with [output_channels, input_channels] dimensions.
+/// @param bias_id - Value ID for the bias tensor. The bias tensor must be a 1D tensor defined in the @a subgraph with
+///                  [output_channels] dimensions.
+/// @param output_id - Value ID for the output tensor. The output tensor must be defined in the @a subgraph with the
+///                    same leading dimensions as the input tensor, and the last dimension equal to output_channels.
+/// @param flags - binary features of the Fully Connected Node. No supported flags are currently defined.
+enum xnn_status xnn_define_fully_connected(
+    xnn_subgraph_t subgraph,
+    float output_min,
+    float output_max,
+    uint32_t input_id,
+    uint32_t filter_id,
+    uint32_t bias_id,
+    uint32_t output_id,
+    uint32_t flags);
+
+/// Define a 2D Average Pooling Node and add it to a Subgraph.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param input_padding_top - implicit zero-padding above 2D input data.
+/// @param input_padding_right - implicit zero-padding to the right of 2D input data.
+/// @param input_padding_bottom - implicit zero-padding below 2D input data.
+/// @param input_padding_left - implicit zero-padding to the left of 2D input data.
+/// @param pooling_height - pooling (kernel) height.
+/// @param pooling_width - pooling (kernel) width.
+/// @param stride_height - displacing of the pooling window in the vertical dimension of the input pixels corresponding
+///                        to vertically adjacent output pixels.
+/// @param stride_width - displacing of the pooling window in the horizontal dimension of the input pixels corresponding
+///                       to horizontally adjacent output pixels.
+/// @param output_min - lower bound for clipping output values.
+/// @param output_max - upper bound for clipping output values.
+/// @param input_id - Value ID for the input tensor. The input tensor must be a 4D tensor defined in the @a subgraph
+///                   with [N, IH, IW, channels] dimensions
+/// @param output_id - Value ID for the output tensor. The output tensor must be a 4D tensor defined in the @a subgraph
+///                    with [N, OH, OW, channels] dimensions.
+/// @param flags - binary features of the 2D Average Pooling Node. No supported flags are currently defined.
+enum xnn_status xnn_define_average_pooling_2d(
+    xnn_subgraph_t subgraph,
+    uint32_t input_padding_top,
+    uint32_t input_padding_right,
+    uint32_t input_padding_bottom,
+    uint32_t input_padding_left,
+    uint32_t pooling_height,
+    uint32_t pooling_width,
+    uint32_t stride_height,
+    uint32_t stride_width,
+    float output_min,
+    float output_max,
+    uint32_t input_id,
+    uint32_t output_id,
+    uint32_t flags);
+
+/// Define a 2D Max Pooling Node and add it to a Subgraph.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param input_padding_top - implicit padding above 2D input data.
+/// @param input_padding_right - implicit padding to the right of 2D input data.
+/// @param input_padding_bottom - implicit padding below 2D input data.
+/// @param input_padding_left - implicit padding to the left of 2D input data.
+/// @param pooling_height - pooling (kernel) height.
+/// @param pooling_width - pooling (kernel) width.
+/// @param stride_height - displacing of the pooling window in the vertical dimension of the input pixels corresponding
+///                        to vertically adjacent output pixels.
+/// @param stride_width - displacing of the pooling window in the horizontal dimension of the input pixels corresponding
+///                       to horizontally adjacent output pixels.
+/// @param dilation_height - dilation of pooling elements along the height dimension.
+/// @param dilation_width - dilation of pooling elements along the width dimension.
+/// @param output_min - lower bound for clipping output values.
+/// @param output_max - upper bound for clipping output values.
+/// @param input_id - Value ID for the input tensor. The input tensor must be a 4D tensor defined in the @a subgraph
+///                   with [N, IH, IW, channels] dimensions
+/// @param output_id - Value ID for the output tensor. The output tensor must be a 4D tensor defined in the @a subgraph
+///                    with [N, OH, OW, channels] dimensions.
+/// @param flags - binary features of the 2D Max Pooling Node. No supported flags are currently defined.
+enum xnn_status xnn_define_max_pooling_2d(
+    xnn_subgraph_t subgraph,
+    uint32_t input_padding_top,
+    uint32_t input_padding_right,
+    uint32_t input_padding_bottom,
+    uint32_t input_padding_left,
+    uint32_t pooling_height,
+    uint32_t pooling_width,
+    uint32_t stride_height,
+    uint32_t stride_width,
+    uint32_t dilation_height,
+    uint32_t dilation_width,
+    float output_min,
+    float output_max,
+    uint32_t input_id,
+    uint32_t output_id,
+    uint32_t flags);
+
+/// Define a 2D Global Average Pooling Node and add it to a Subgraph.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param output_min - lower bound for clipping output values.
+/// @param output_max - upper bound for clipping output values.
+/// @param input_id - Value ID for the input tensor. The input tensor must be a 4D tensor defined in the @a subgraph
+///                   with [N, H, W, channels] dimensions
+/// @param output_id - Value ID for the output tensor. The output tensor must be a 4D tensor defined in the @a subgraph
+///                    with [N, 1, 1, channels] dimensions, or a 2D tensor with [N, channels] dimensions.
+/// @param flags - binary features of the 2D Global Average Pooling Node. No supported flags are currently defined.
+enum xnn_status xnn_define_global_average_pooling_2d(
+    xnn_subgraph_t subgraph,
+    float output_min,
+    float output_max,
+    uint32_t input_id,
+    uint32_t output_id,
+    uint32_t flags);
+
+/// Define a 2-Input Add Node and add it to a Subgraph.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param output_min - lower bound for clipping output values.
+/// @param output_max - upper bound for clipping output values.
+/// @param input1_id - Value ID for the first input tensor. The input tensor must be defined in the @a subgraph.
+/// @param input2_id - Value ID for the second input tensor. The input tensor must be defined in the @a subgraph with
+///                    the same shape as the first input tensor.
+/// @param output_id - Value ID for the output tensor. The output tensor must be defined in the @a subgraph with the
+///                    same shape as the input tensors.
+/// @param flags - binary features of the Add Node. No supported flags are currently defined.
+enum xnn_status xnn_define_add2(
+    xnn_subgraph_t subgraph,
+    float output_min,
+    float output_max,
+    uint32_t input1_id,
+    uint32_t input2_id,
+    uint32_t output_id,
+    uint32_t flags);
+
+/// Define a Clamp Node and add it to a Subgraph.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param output_min - lower bound for clipping output values.
+/// @param output_max - upper bound for clipping output values.
+/// @param input_id - Value ID for the input tensor. The input tensor must be defined in the @a subgraph.
+/// @param output_id - Value ID for the output tensor. The output tensor must be defined in the @a subgraph with the
+///                    same shape as the input tensor.
+/// @param flags - binary features of the Clamp Node. No supported flags are currently defined.
+enum xnn_status xnn_define_clamp(
+    xnn_subgraph_t subgraph,
+    float output_min,
+    float output_max,
+    uint32_t input_id,
+    uint32_t output_id,
+    uint32_t flags);
+
+/// Define a HardSwish Node and add it to a Subgraph.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param input_id - Value ID for the input tensor. The input tensor must be defined in the @a subgraph.
+/// @param output_id - Value ID for the output tensor. The output tensor must be defined in the @a subgraph with the
+///                    same shape as the input tensor.
+/// @param flags - binary features of the HardSwish Node. No supported flags are currently defined.
+enum xnn_status xnn_define_hardswish(
+    xnn_subgraph_t subgraph,
+    uint32_t input_id,
+    uint32_t output_id,
+    uint32_t flags);
+
+/// Runtime is a combination of an execution plan for subgraph Nodes and a memory manager for subgraph Values.
+typedef struct xnn_runtime* xnn_runtime_t;
+
+/// Create a Runtime object from a subgraph.
+///
+/// The Runtime creates one operator for every Node in the Subgraph, and plans a single memory arena for all internal
+/// Values: Values whose lifetimes (from the Node producing the Value to the last Node consuming it) do not overlap
+/// share memory.
+///
+/// @param subgraph - a Subgraph object with all Values and Nodes that would be handled by the runtime. No Values or
+///                   Nodes can be added to the runtime once it is constructed.
+/// @param threadpool - the thread pool to be used for parallelisation of computations in the runtime. If the thread
+///                     pool is NULL, the computation would run on the caller thread without parallelization.
+/// @param flags - binary features of the runtime. No supported flags are currently defined.
+/// @param runtime_out - pointer to the variable that will be initialized with a handle to the Runtime object upon
+///                      successful return. Once constructed, the Runtime object is independent of the Subgraph object
+///                      used to create it.
+enum xnn_status xnn_create_runtime(
+    xnn_subgraph_t subgraph,
+    pthreadpool_t threadpool,
+    uint32_t flags,
+    xnn_runtime_t* runtime_out);
+
+struct xnn_external_value {
+  uint32_t id;
+  void* data;
+};
+
+/// Setup data pointers for external inputs and outputs in a Runtime object.
+///
+/// @param runtime - a Runtime object created with @ref xnn_create_runtime.
+/// @param num_external_values - the number of external inputs and outputs specified in this call. This number must
+///                              match the number of external inputs and outputs in the runtime, i.e. all external
+///                              inputs and outputs in the runtime must be specified in one call.
+/// @param external_values - array with location information for all external inputs and outputs in the runtime.
+enum xnn_status xnn_setup_runtime(
+    xnn_runtime_t runtime,
+    size_t num_external_values,
+    const struct xnn_external_value* external_values);
+
+/// Execute forward pass for all operators in the runtime.
+///
+/// @param runtime - the Runtime object with the execution plan to invoke.
+enum xnn_status xnn_invoke_runtime(
+    xnn_runtime_t runtime);
+
+/// Destroy a Runtime object, as well as operators and memory associated with it.
+///
+/// @param runtime - the Runtime object to destroy.
+enum xnn_status xnn_delete_runtime(
+    xnn_runtime_t runtime);
+
+#ifndef XNN_NO_F16_OPERATORS
+
+// F16 operators take IEEE half-precision inputs, weights, and outputs, passed as arrays of 16-bit words. Clamping
+// bounds are specified in single precision and rounded to half precision when the operator is created.
+
+enum xnn_status xnn_create_add_nc_f16(
+    size_t channels,
+    size_t a_stride,
+    size_t b_stride,
+    size_t sum_stride,
+    float sum_min,
+    float sum_max,
+    uint32_t flags,
+    xnn_operator_t* add_op_out);
+
+enum xnn_status xnn_setup_add_nc_f16(
+    xnn_operator_t add_op,
+    size_t batch_size,
+    const void* a,
+    const void* b,
+    void* sum,
+    pthreadpool_t threadpool);
+
+enum xnn_status xnn_create_clamp_nc_f16(
+    size_t channels,
+    size_t input_stride,
+    size_t output_stride,
+    float output_min,
+    float output_max,
+    uint32_t flags,
+    xnn_operator_t* clamp_op_out);
+
+enum xnn_status xnn_setup_clamp_nc_f16(
+    xnn_operator_t clamp_op,
+    size_t batch_size,
+    const void* input,
+    void* output,
+    pthreadpool_t threadpool);
+
+enum xnn_status xnn_create_convolution2d_nhwc_f16(
+    uint32_t input_padding_top,
+    uint32_t input_padding_right,
+    uint32_t input_padding_bottom,
+    uint32_t input_padding_left,
+    uint32_t kernel_height,
+    uint32_t kernel_width,
+    uint32_t subsampling_height,
+    uint32_t subsampling_width,
+    uint32_t dilation_height,
+    uint32_t dilation_width,
+    uint32_t groups,
+    size_t group_input_channels,
+    size_t group_output_channels,
+    size_t input_pixel_stride,
+    size_t output_pixel_stride,
+    const void* kernel,
+    const void* bias,
+    float output_min,
+    float output_max,
+    uint32_t flags,
+    xnn_operator_t* convolution_op_out);
+
+enum xnn_status xnn_setup_convolution2d_nhwc_f16(
+    xnn_operator_t convolution_op,
+    size_t batch_size,
+    size_t input_height,
+    size_t input_width,
+    const void* input,
+    void* output,
+    pthreadpool_t threadpool);
+
+enum xnn_status xnn_create_fully_connected_nc_f16(
+    size_t input_channels,
+    size_t output_channels,
+    size_t input_stride,
+    size_t output_stride,
+    const void* kernel,
+    const void* bias,
+    float output_min,
+    float output_max,
+    uint32_t flags,
+    xnn_operator_t* fully_connected_op_out);
+
+enum xnn_status xnn_setup_fully_connected_nc_f16(
+    xnn_operator_t fully_connected_op,
+    size_t batch_size,
+    const void* input,
+    void* output,
+    pthreadpool_t threadpool);
+
+enum xnn_status xnn_create_global_average_pooling_nwc_f16(
+    size_t channels,
+    size_t input_stride,
+    size_t output_stride,
+    float output_min,
+    float output_max,
+    uint32_t flags,
+    xnn_operator_t* global_average_pooling_op_out);
+
+enum xnn_status xnn_setup_global_average_pooling_nwc_f16(
+    xnn_operator_t global_average_pooling_op,
+    size_t batch_size,
+    size_t width,
+    const void* input,
+    void* output,
+    pthreadpool_t threadpool);
+
+#endif  // XNN_NO_F16_OPERATORS
+
 #ifndef XNN_NO_F32_OPERATORS
 
 enum xnn_status xnn_create_add_nc_f32(
@@ -91,6 +744,28 @@ enum xnn_status xnn_setup_add_nc_f32(
     float* sum,
     pthreadpool_t threadpool);
 
+/// Elementwise binary operators with N-dimensional broadcasting (xnn_*_nd_*).
+///
+/// Input shapes are aligned on the innermost dimension, and a dimension of size 1 in one input is broadcasted to the
+/// size of the corresponding dimension in the other input, following NumPy rules. Shapes are passed to the setup
+/// function and may have up to XNN_MAX_TENSOR_DIMS dimensions; the output has the broadcasted shape.
+enum xnn_status xnn_create_add_nd_f32(
+    float output_min,
+    float output_max,
+    uint32_t flags,
+    xnn_operator_t* add_op_out);
+
+enum xnn_status xnn_setup_add_nd_f32(
+    xnn_operator_t add_op,
+    size_t num_input1_dims,
+    const size_t* input1_shape,
+    size_t num_input2_dims,
+    const size_t* input2_shape,
+    const float* input1,
+    const float* input2,
+    float* output,
+    pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_argmax_pooling2d_nhwc_f32(
     uint32_t input_padding_top,
     uint32_t input_padding_right,
@@ -181,6 +856,35 @@ enum xnn_status xnn_create_convolution2d_nhwc_f32(
     uint32_t flags,
     xnn_operator_t* convolution_op_out);
 
+/// Create an F32 Convolution operator from packed weights serialized with xnn_export_operator_packed_weights.
+///
+/// The packed weights are used in place, without copying: the blob must be aligned on a 64-byte boundary (e.g. come
+/// from mmap), and must stay valid and unmodified until the operator is deleted.
+///
+/// @retval xnn_status_unsupported_hardware - the blob was serialized for a different architecture or micro-kernel.
+enum xnn_status xnn_create_convolution2d_nhwc_f32_from_packed_weights(
+    uint32_t input_padding_top,
+    uint32_t input_padding_right,
+    uint32_t input_padding_bottom,
+    uint32_t input_padding_left,
+    uint32_t kernel_height,
+    uint32_t kernel_width,
+    uint32_t subsampling_height,
+    uint32_t subsampling_width,
+    uint32_t dilation_height,
+    uint32_t dilation_width,
+    uint32_t groups,
+    size_t group_input_channels,
+    size_t group_output_channels,
+    size_t input_pixel_stride,
+    size_t output_pixel_stride,
+    const void* packed_weights,
+    size_t packed_weights_size,
+    float output_min,
+    float output_max,
+    uint32_t flags,
+    xnn_operator_t* convolution_op_out);
+
 enum xnn_status xnn_setup_convolution2d_nhwc_f32(
     xnn_operator_t convolution_op,
     size_t batch_size,
@@ -224,6 +928,23 @@ enum xnn_status xnn_setup_deconvolution2d_nhwc_f32(
     float* output,
     pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_divide_nd_f32(
+    float output_min,
+    float output_max,
+    uint32_t flags,
+    xnn_operator_t* divide_op_out);
+
+enum xnn_status xnn_setup_divide_nd_f32(
+    xnn_operator_t divide_op,
+    size_t num_input1_dims,
+    const size_t* input1_shape,
+    size_t num_input2_dims,
+    const size_t* input2_shape,
+    const float* input1,
+    const float* input2,
+    float* output,
+    pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_fully_connected_nc_f32(
     size_t input_channels,
     size_t output_channels,
@@ -236,6 +957,24 @@ enum xnn_status xnn_create_fully_connected_nc_f32(
     uint32_t flags,
     xnn_operator_t* fully_connected_op_out);
 
+/// Create an F32 Fully Connected operator from packed weights serialized with xnn_export_operator_packed_weights.
+///
+/// The packed weights are used in place, without copying: the blob must be aligned on a 64-byte boundary (e.g. come
+/// from mmap), and must stay valid and unmodified until the operator is deleted.
+///
+/// @retval xnn_status_unsupported_hardware - the blob was serialized for a different architecture or micro-kernel.
+enum xnn_status xnn_create_fully_connected_nc_f32_from_packed_weights(
+    size_t input_channels,
+    size_t output_channels,
+    size_t input_stride,
+    size_t output_stride,
+    const void* packed_weights,
+    size_t packed_weights_size,
+    float output_min,
+    float output_max,
+    uint32_t flags,
+    xnn_operator_t* fully_connected_op_out);
+
 enum xnn_status xnn_setup_fully_connected_nc_f32(
     xnn_operator_t fully_connected_op,
     size_t batch_size,
@@ -302,6 +1041,53 @@ enum xnn_status xnn_setup_max_pooling2d_nhwc_f32(
     float* output,
     pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_maximum_nd_f32(
+    uint32_t flags,
+    xnn_operator_t* maximum_op_out);
+
+enum xnn_status xnn_setup_maximum_nd_f32(
+    xnn_operator_t maximum_op,
+    size_t num_input1_dims,
+    const size_t* input1_shape,
+    size_t num_input2_dims,
+    const size_t* input2_shape,
+    const float* input1,
+    const float* input2,
+    float* output,
+    pthreadpool_t threadpool);
+
+enum xnn_status xnn_create_minimum_nd_f32(
+    uint32_t flags,
+    xnn_operator_t* minimum_op_out);
+
+enum xnn_status xnn_setup_minimum_nd_f32(
+    xnn_operator_t minimum_op,
+    size_t num_input1_dims,
+    const size_t* input1_shape,
+    size_t num_input2_dims,
+    const size_t* input2_shape,
+    const float* input1,
+    const float* input2,
+    float* output,
+    pthreadpool_t threadpool);
+
+enum xnn_status xnn_create_multiply_nd_f32(
+    float output_min,
+    float output_max,
+    uint32_t flags,
+    xnn_operator_t* multiply_op_out);
+
+enum xnn_status xnn_setup_multiply_nd_f32(
+    xnn_operator_t multiply_op,
+    size_t num_input1_dims,
+    const size_t* input1_shape,
+    size_t num_input2_dims,
+    const size_t* input2_shape,
+    const float* input1,
+    const float* input2,
+    float* output,
+    pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_prelu_nc_f32(
     size_t channels,
     size_t input_stride,
@@ -319,6 +1105,65 @@ enum xnn_status xnn_setup_prelu_nc_f32(
     float* output,
     pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_sigmoid_nc_f32(
+    size_t channels,
+    size_t input_stride,
+    size_t output_stride,
+    uint32_t flags,
+    xnn_operator_t* sigmoid_op_out);
+
+enum xnn_status xnn_setup_sigmoid_nc_f32(
+    xnn_operator_t sigmoid_op,
+    size_t batch_size,
+    const float* input,
+    float* output,
+    pthreadpool_t threadpool);
+
+enum xnn_status xnn_create_softmax_nc_f32(
+    size_t channels,
+    size_t input_stride,
+    size_t output_stride,
+    uint32_t flags,
+    xnn_operator_t* softmax_op_out);
+
+enum xnn_status xnn_setup_softmax_nc_f32(
+    xnn_operator_t softmax_op,
+    size_t batch_size,
+    const float* input,
+    float* output,
+    pthreadpool_t threadpool);
+
+enum xnn_status xnn_create_subtract_nd_f32(
+    float output_min,
+    float output_max,
+    uint32_t flags,
+    xnn_operator_t* subtract_op_out);
+
+enum xnn_status xnn_setup_subtract_nd_f32(
+    xnn_operator_t subtract_op,
+    size_t num_input1_dims,
+    const size_t* input1_shape,
+    size_t num_input2_dims,
+    const size_t* input2_shape,
+    const float* input1,
+    const float* input2,
+    float* output,
+    pthreadpool_t threadpool);
+
+enum xnn_status xnn_create_tanh_nc_f32(
+    size_t channels,
+    size_t input_stride,
+    size_t output_stride,
+    uint32_t flags,
+    xnn_operator_t* tanh_op_out);
+
+enum xnn_status xnn_setup_tanh_nc_f32(
+    xnn_operator_t tanh_op,
+    size_t batch_size,
+    const float* input,
+    float* output,
+    pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_convolution2d_spnchw_f32(
     uint32_t input_padding_top,
     uint32_t input_padding_right,
@@ -454,6 +1299,29 @@ enum xnn_status xnn_setup_add_nc_q8(
     uint8_t* sum,
     pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_add_nd_q8(
+    uint8_t input1_zero_point,
+    float input1_scale,
+    uint8_t input2_zero_point,
+    float input2_scale,
+    uint8_t output_zero_point,
+    float output_scale,
+    uint8_t output_min,
+    uint8_t output_max,
+    uint32_t flags,
+    xnn_operator_t* add_op_out);
+
+enum xnn_status xnn_setup_add_nd_q8(
+    xnn_operator_t add_op,
+    size_t num_input1_dims,
+    const size_t* input1_shape,
+    size_t num_input2_dims,
+    const size_t* input2_shape,
+    const uint8_t* input1,
+    const uint8_t* input2,
+    uint8_t* output,
+    pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_average_pooling2d_nhwc_q8(
     uint32_t input_padding_top,
     uint32_t input_padding_right,
@@ -522,6 +1390,48 @@ enum xnn_status xnn_setup_convolution2d_nhwc_q8(
     uint8_t* output,
     pthreadpool_t threadpool);
 
+/// Create a Convolution operator with per-output-channel kernel quantization.
+///
+/// Differs from xnn_create_convolution2d_nhwc_q8 only in kernel_scale, which points to groups * group_output_channels
+/// scales, one for each output channel. The kernel zero point is shared by all output channels.
+enum xnn_status xnn_create_convolution2d_nhwc_q8c(
+    uint32_t input_padding_top,
+    uint32_t input_padding_right,
+    uint32_t input_padding_bottom,
+    uint32_t input_padding_left,
+    uint32_t kernel_height,
+    uint32_t kernel_width,
+    uint32_t subsampling_height,
+    uint32_t subsampling_width,
+    uint32_t dilation_height,
+    uint32_t dilation_width,
+    uint32_t groups,
+    size_t group_input_channels,
+    size_t group_output_channels,
+    size_t input_pixel_stride,
+    size_t output_pixel_stride,
+    uint8_t input_zero_point,
+    float input_scale,
+    uint8_t kernel_zero_point,
+    const float* kernel_scale,
+    const uint8_t* kernel,
+    const int32_t* bias,
+    uint8_t output_zero_point,
+    float output_scale,
+    uint8_t output_min,
+    uint8_t output_max,
+    uint32_t flags,
+    xnn_operator_t* convolution_op_out);
+
+enum xnn_status xnn_setup_convolution2d_nhwc_q8c(
+    xnn_operator_t convolution_op,
+    size_t batch_size,
+    size_t input_height,
+    size_t input_width,
+    const uint8_t* input,
+    uint8_t* output,
+    pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_deconvolution2d_nhwc_q8(
     uint32_t output_padding_top,
     uint32_t output_padding_right,
@@ -587,6 +1497,64 @@ enum xnn_status xnn_setup_fully_connected_nc_q8(
     uint8_t* output,
     pthreadpool_t threadpool);
 
+/// Create a Fully Connected operator with per-output-channel kernel quantization.
+///
+/// Differs from xnn_create_fully_connected_nc_q8 only in kernel_scale, which points to output_channels scales, one
+/// for each output channel. The kernel zero point is shared by all output channels.
+enum xnn_status xnn_create_fully_connected_nc_q8c(
+    size_t input_channels,
+    size_t output_channels,
+    size_t input_stride,
+    size_t output_stride,
+    uint8_t input_zero_point,
+    float input_scale,
+    uint8_t kernel_zero_point,
+    const float* kernel_scale,
+    const uint8_t* kernel,
+    const int32_t* bias,
+    uint8_t output_zero_point,
+    float output_scale,
+    uint8_t output_min,
+    uint8_t output_max,
+    uint32_t flags,
+    xnn_operator_t* fully_connected_op_out);
+
+enum xnn_status xnn_setup_fully_connected_nc_q8c(
+    xnn_operator_t fully_connected_op,
+    size_t batch_size,
+    const uint8_t* input,
+    uint8_t* output,
+    pthreadpool_t threadpool);
+
+/// Create a Fully Connected operator with F32 inputs and outputs, which computes in 8-bit integer arithmetic.
+///
+/// The F32 kernel is quantized to 8 bits with a single scale and zero point when the operator is created. Every row of
+/// the input is quantized to 8 bits with its own scale, chosen from the range of the row, when the operator runs.
+/// Products are accumulated in 32-bit integers and dequantized to F32 before the bias is added.
+///
+/// @param kernel - F32 kernel with output_channels rows of input_channels elements each.
+/// @param bias - F32 bias with output_channels elements.
+/// @param output_min - lower bound for the F32 output.
+/// @param output_max - upper bound for the F32 output.
+enum xnn_status xnn_create_fully_connected_nc_q8dq(
+    size_t input_channels,
+    size_t output_channels,
+    size_t input_stride,
+    size_t output_stride,
+    const float* kernel,
+    const float* bias,
+    float output_min,
+    float output_max,
+    uint32_t flags,
+    xnn_operator_t* fully_connected_op_out);
+
+enum xnn_status xnn_setup_fully_connected_nc_q8dq(
+    xnn_operator_t fully_connected_op,
+    size_t batch_size,
+    const float* input,
+    float* output,
+    pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_global_average_pooling_nwc_q8(
     size_t channels,
     size_t input_stride,
@@ -629,6 +1597,29 @@ enum xnn_status xnn_setup_leaky_relu_nc_q8(
     uint8_t* output,
     pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_multiply_nd_q8(
+    uint8_t input1_zero_point,
+    float input1_scale,
+    uint8_t input2_zero_point,
+    float input2_scale,
+    uint8_t output_zero_point,
+    float output_scale,
+    uint8_t output_min,
+    uint8_t output_max,
+    uint32_t flags,
+    xnn_operator_t* multiply_op_out);
+
+enum xnn_status xnn_setup_multiply_nd_q8(
+    xnn_operator_t multiply_op,
+    size_t num_input1_dims,
+    const size_t* input1_shape,
+    size_t num_input2_dims,
+    const size_t* input2_shape,
+    const uint8_t* input1,
+    const uint8_t* input2,
+    uint8_t* output,
+    pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_sigmoid_nc_q8(
     size_t channels,
     size_t input_stride,
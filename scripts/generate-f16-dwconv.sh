@@ -0,0 +1,17 @@
+#!/bin/sh
+# Copyright 2019 Google LLC
+#
+# This source code is licensed under the BSD-style license found in the
+# LICENSE file in the root directory of this source tree.
+
+#################################### Scalar ###################################
+tools/xngen src/f16-dwconv/up-scalar.c.in -D CR=1 -D MR=9 -D AR=2 -o src/f16-dwconv/up1x9-scalar.c
+
+########################## ARM NEON with FP16 compute #########################
+tools/xngen src/f16-dwconv/up-neonfp16arith.c.in -D CR=8 -D MR=9 -D AR=2 -o src/f16-dwconv/up8x9-neonfp16arith.c
+
+################################### x86 F16C ##################################
+tools/xngen src/f16-dwconv/up-f16c.c.in -D CR=8 -D MR=9 -D AR=2 -o src/f16-dwconv/up8x9-f16c.c
+
+################################## Unit tests #################################
+tools/generate-dwconv-test.py --spec test/f16-dwconv.yaml --output test/f16-dwconv.cc
@@ -6,10 +6,18 @@
 
 ########################## ARM NEON with FP16 compute #########################
 ### LD64 micro-kernels
+tools/xngen src/f16-gemm/neonfp16arith-ld64.c.in -D MR=1 -D NR=8 -o src/f16-gemm/1x8-neonfp16arith-ld64.c
 tools/xngen src/f16-gemm/neonfp16arith-ld64.c.in -D MR=4 -D NR=8 -o src/f16-gemm/4x8-neonfp16arith-ld64.c
 tools/xngen src/f16-gemm/neonfp16arith-ld64.c.in -D MR=6 -D NR=8 -o src/f16-gemm/6x8-neonfp16arith-ld64.c
 tools/xngen src/f16-gemm/neonfp16arith-ld64.c.in -D MR=8 -D NR=8 -o src/f16-gemm/8x8-neonfp16arith-ld64.c
 
+################################### x86 F16C ##################################
+tools/xngen src/f16-gemm/f16c.c.in -D MR=1 -D NR=8 -o src/f16-gemm/1x8-f16c.c
+tools/xngen src/f16-gemm/f16c.c.in -D MR=4 -D NR=8 -o src/f16-gemm/4x8-f16c.c
+
+#################################### Scalar ###################################
+tools/xngen src/f16-gemm/scalar.c.in -D MR=1 -D NR=4 -o src/f16-gemm/1x4-scalar.c
+tools/xngen src/f16-gemm/scalar.c.in -D MR=4 -D NR=4 -o src/f16-gemm/4x4-scalar.c
 
 ################################## Unit tests #################################
 tools/generate-gemm-test.py --spec test/f16-gemm.yaml --output test/f16-gemm.cc
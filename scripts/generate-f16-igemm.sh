@@ -0,0 +1,23 @@
+#!/bin/sh
+# Copyright 2019 Google LLC
+#
+# This source code is licensed under the BSD-style license found in the
+# LICENSE file in the root directory of this source tree.
+
+########################## ARM NEON with FP16 compute #########################
+### LD64 micro-kernels
+tools/xngen src/f16-igemm/neonfp16arith-ld64.c.in -D MR=1 -D NR=8 -o src/f16-igemm/1x8-neonfp16arith-ld64.c
+tools/xngen src/f16-igemm/neonfp16arith-ld64.c.in -D MR=4 -D NR=8 -o src/f16-igemm/4x8-neonfp16arith-ld64.c
+tools/xngen src/f16-igemm/neonfp16arith-ld64.c.in -D MR=6 -D NR=8 -o src/f16-igemm/6x8-neonfp16arith-ld64.c
+tools/xngen src/f16-igemm/neonfp16arith-ld64.c.in -D MR=8 -D NR=8 -o src/f16-igemm/8x8-neonfp16arith-ld64.c
+
+################################### x86 F16C ##################################
+tools/xngen src/f16-igemm/f16c.c.in -D MR=1 -D NR=8 -o src/f16-igemm/1x8-f16c.c
+tools/xngen src/f16-igemm/f16c.c.in -D MR=4 -D NR=8 -o src/f16-igemm/4x8-f16c.c
+
+#################################### Scalar ###################################
+tools/xngen src/f16-igemm/scalar.c.in -D MR=1 -D NR=4 -o src/f16-igemm/1x4-scalar.c
+tools/xngen src/f16-igemm/scalar.c.in -D MR=4 -D NR=4 -o src/f16-igemm/4x4-scalar.c
+
+################################## Unit tests #################################
+tools/generate-gemm-test.py --spec test/f16-igemm.yaml --output test/f16-igemm.cc
@@ -9,21 +9,33 @@ tools/xngen src/f32-dwconv/up-scalar.c.in -D CR=1 -D MR=4  -D AR=2 -o src/f32-dw
 tools/xngen src/f32-dwconv/up-scalar.c.in -D CR=1 -D MR=9  -D AR=2 -o src/f32-dwconv/up1x9-scalar.c
 tools/xngen src/f32-dwconv/up-scalar.c.in -D CR=1 -D MR=25 -D AR=2 -o src/f32-dwconv/up1x25-scalar.c
 
+tools/xngen src/f32-dwconv/mp-scalar.c.in -D CR=1 -D QR=4 -D AR=2 -o src/f32-dwconv/mp1x4-scalar.c
+
 ################################### ARM NEON ##################################
 tools/xngen src/f32-dwconv/up-neon.c.in -D CR=4 -D MR=9 -D AR=1 -D FMA=0 -o src/f32-dwconv/up4x9-neon.c
 tools/xngen src/f32-dwconv/up-neon.c.in -D CR=4 -D MR=9 -D AR=1 -D FMA=1 -o src/f32-dwconv/up4x9-neonfma.c
 tools/xngen src/f32-dwconv/up-neon.c.in -D CR=8 -D MR=9 -D AR=1 -D FMA=1 -o src/f32-dwconv/up8x9-neonfma.c
 
+tools/xngen src/f32-dwconv/mp-neon.c.in -D CR=4 -D QR=4 -D AR=2 -D FMA=0 -o src/f32-dwconv/mp4x4-neon.c
+tools/xngen src/f32-dwconv/mp-neon.c.in -D CR=4 -D QR=4 -D AR=2 -D FMA=1 -o src/f32-dwconv/mp4x4-neonfma.c
+
 #################################### PSIMD ####################################
 tools/xngen src/f32-dwconv/up-psimd.c.in -D CR=4 -D MR=4 -D AR=2 -o src/f32-dwconv/up4x4-psimd.c
 tools/xngen src/f32-dwconv/up-psimd.c.in -D CR=4 -D MR=9 -D AR=2 -o src/f32-dwconv/up4x9-psimd.c
 tools/xngen src/f32-dwconv/up-psimd.c.in -D CR=4 -D MR=25 -D AR=2 -o src/f32-dwconv/up4x25-psimd.c
 
+tools/xngen src/f32-dwconv/mp-psimd.c.in -D CR=4 -D QR=4 -D AR=2 -o src/f32-dwconv/mp4x4-psimd.c
+
 ################################### x86 SSE ###################################
 tools/xngen src/f32-dwconv/up-sse.c.in -D CR=4 -D MR=4 -D AR=2 -o src/f32-dwconv/up4x4-sse.c
 tools/xngen src/f32-dwconv/up-sse.c.in -D CR=4 -D MR=9 -D AR=2 -o src/f32-dwconv/up4x9-sse.c
 tools/xngen src/f32-dwconv/up-sse.c.in -D CR=4 -D MR=25 -D AR=2 -o src/f32-dwconv/up4x25-sse.c
 
+tools/xngen src/f32-dwconv/mp-sse.c.in -D CR=4 -D QR=4 -D AR=2 -o src/f32-dwconv/mp4x4-sse.c
+
+################################### x86 AVX ###################################
+tools/xngen src/f32-dwconv/mp-avx.c.in -D CR=8 -D QR=4 -D AR=2 -o src/f32-dwconv/mp8x4-avx.c
+
 
 ################################## Unit tests #################################
 tools/generate-dwconv-test.py --spec test/f32-dwconv.yaml --output test/f32-dwconv.cc
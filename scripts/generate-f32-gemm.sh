@@ -72,5 +72,17 @@ tools/xngen src/f32-gemm/sse-shuffle.c.in -D MR=1 -D NR=8 -D INC=0 -o src/f32-ge
 tools/xngen src/f32-gemm/sse-shuffle.c.in -D MR=4 -D NR=8 -D INC=0 -o src/f32-gemm/4x8s4-sse.c
 
 
+################################## x86 FMA3 ###################################
+tools/xngen src/f32-gemm/fma3-broadcast.c.in -D MR=1 -D NR=16 -D INC=0 -o src/f32-gemm/1x16-fma3-broadcast.c
+tools/xngen src/f32-gemm/fma3-broadcast.c.in -D MR=4 -D NR=16 -D INC=0 -o src/f32-gemm/4x16-fma3-broadcast.c
+tools/xngen src/f32-gemm/fma3-broadcast.c.in -D MR=5 -D NR=16 -D INC=0 -o src/f32-gemm/5x16-fma3-broadcast.c
+tools/xngen src/f32-gemm/fma3-broadcast.c.in -D MR=6 -D NR=16 -D INC=0 -o src/f32-gemm/6x16-fma3-broadcast.c
+
+################################# x86 AVX512F #################################
+tools/xngen src/f32-gemm/avx512f-broadcast.c.in -D MR=1 -D NR=16 -D INC=0 -o src/f32-gemm/1x16-avx512f-broadcast.c
+tools/xngen src/f32-gemm/avx512f-broadcast.c.in -D MR=4 -D NR=16 -D INC=0 -o src/f32-gemm/4x16-avx512f-broadcast.c
+tools/xngen src/f32-gemm/avx512f-broadcast.c.in -D MR=7 -D NR=16 -D INC=0 -o src/f32-gemm/7x16-avx512f-broadcast.c
+tools/xngen src/f32-gemm/avx512f-broadcast.c.in -D MR=8 -D NR=32 -D INC=0 -o src/f32-gemm/8x32-avx512f-broadcast.c
+
 ################################## Unit tests #################################
 tools/generate-gemm-test.py --spec test/f32-gemm.yaml --output test/f32-gemm.cc
@@ -68,5 +68,17 @@ tools/xngen src/f32-gemm/sse-shuffle.c.in -D MR=1 -D NR=8 -D INC=1 -o src/f32-ge
 tools/xngen src/f32-gemm/sse-shuffle.c.in -D MR=4 -D NR=8 -D INC=1 -o src/f32-gemminc/4x8s4-sse.c
 
 
+################################## x86 FMA3 ###################################
+tools/xngen src/f32-gemm/fma3-broadcast.c.in -D MR=1 -D NR=16 -D INC=1 -o src/f32-gemminc/1x16-fma3-broadcast.c
+tools/xngen src/f32-gemm/fma3-broadcast.c.in -D MR=4 -D NR=16 -D INC=1 -o src/f32-gemminc/4x16-fma3-broadcast.c
+tools/xngen src/f32-gemm/fma3-broadcast.c.in -D MR=5 -D NR=16 -D INC=1 -o src/f32-gemminc/5x16-fma3-broadcast.c
+tools/xngen src/f32-gemm/fma3-broadcast.c.in -D MR=6 -D NR=16 -D INC=1 -o src/f32-gemminc/6x16-fma3-broadcast.c
+
+################################# x86 AVX512F #################################
+tools/xngen src/f32-gemm/avx512f-broadcast.c.in -D MR=1 -D NR=16 -D INC=1 -o src/f32-gemminc/1x16-avx512f-broadcast.c
+tools/xngen src/f32-gemm/avx512f-broadcast.c.in -D MR=4 -D NR=16 -D INC=1 -o src/f32-gemminc/4x16-avx512f-broadcast.c
+tools/xngen src/f32-gemm/avx512f-broadcast.c.in -D MR=7 -D NR=16 -D INC=1 -o src/f32-gemminc/7x16-avx512f-broadcast.c
+tools/xngen src/f32-gemm/avx512f-broadcast.c.in -D MR=8 -D NR=32 -D INC=1 -o src/f32-gemminc/8x32-avx512f-broadcast.c
+
 ################################## Unit tests #################################
 tools/generate-gemm-test.py --spec test/f32-gemminc.yaml --output test/f32-gemminc.cc
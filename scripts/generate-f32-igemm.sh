@@ -59,5 +59,17 @@ tools/xngen src/f32-igemm/sse-shuffle.c.in -D MR=4 -D NR=8 -o src/f32-igemm/4x8s
 tools/xngen src/f32-igemm/MRx2c4-sse.c.in -D MR=4 -D NR=2 -o src/f32-igemm/4x2c4-sse.c
 
 
+################################## x86 FMA3 ###################################
+tools/xngen src/f32-igemm/fma3-broadcast.c.in -D MR=1 -D NR=16 -o src/f32-igemm/1x16-fma3-broadcast.c
+tools/xngen src/f32-igemm/fma3-broadcast.c.in -D MR=4 -D NR=16 -o src/f32-igemm/4x16-fma3-broadcast.c
+tools/xngen src/f32-igemm/fma3-broadcast.c.in -D MR=5 -D NR=16 -o src/f32-igemm/5x16-fma3-broadcast.c
+tools/xngen src/f32-igemm/fma3-broadcast.c.in -D MR=6 -D NR=16 -o src/f32-igemm/6x16-fma3-broadcast.c
+
+################################# x86 AVX512F #################################
+tools/xngen src/f32-igemm/avx512f-broadcast.c.in -D MR=1 -D NR=16 -o src/f32-igemm/1x16-avx512f-broadcast.c
+tools/xngen src/f32-igemm/avx512f-broadcast.c.in -D MR=4 -D NR=16 -o src/f32-igemm/4x16-avx512f-broadcast.c
+tools/xngen src/f32-igemm/avx512f-broadcast.c.in -D MR=7 -D NR=16 -o src/f32-igemm/7x16-avx512f-broadcast.c
+tools/xngen src/f32-igemm/avx512f-broadcast.c.in -D MR=8 -D NR=32 -o src/f32-igemm/8x32-avx512f-broadcast.c
+
 ################################## Unit tests #################################
 tools/generate-gemm-test.py --spec test/f32-igemm.yaml --output test/f32-igemm.cc
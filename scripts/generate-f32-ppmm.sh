@@ -22,6 +22,9 @@ tools/xngen src/f32-ppmm/psimd.c.in -D MR=4 -D NR=8 -o src/f32-ppmm/4x8-psimd.c
 ################################### x86 SSE ###################################
 tools/xngen src/f32-ppmm/sse.c.in -D MR=4 -D NR=8 -o src/f32-ppmm/4x8-sse.c
 
+################################## x86 FMA3 ###################################
+tools/xngen src/f32-ppmm/fma3.c.in -D MR=4 -D NR=16 -o src/f32-ppmm/4x16-fma3.c
+
 
 ################################## Unit tests #################################
 tools/generate-gemm-test.py --spec test/f32-ppmm.yaml --output test/f32-ppmm.cc
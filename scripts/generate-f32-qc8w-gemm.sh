@@ -0,0 +1,24 @@
+#!/bin/sh
+# Copyright 2019 Google LLC
+#
+# This source code is licensed under the BSD-style license found in the
+# LICENSE file in the root directory of this source tree.
+
+#################################### Scalar ###################################
+tools/xngen src/f32-qc8w-gemm/scalar.c.in -D MR=1 -D NR=4 -o src/f32-qc8w-gemm/1x4-scalar.c
+tools/xngen src/f32-qc8w-gemm/scalar.c.in -D MR=4 -D NR=4 -o src/f32-qc8w-gemm/4x4-scalar.c
+
+################################### ARM NEON ##################################
+tools/xngen src/f32-qc8w-gemm/neon.c.in -D MR=1 -D NR=8 -o src/f32-qc8w-gemm/1x8-neon.c
+tools/xngen src/f32-qc8w-gemm/neon.c.in -D MR=4 -D NR=8 -o src/f32-qc8w-gemm/4x8-neon.c
+
+################################### x86 SSE2 ##################################
+tools/xngen src/f32-qc8w-gemm/sse2.c.in -D MR=1 -D NR=8 -o src/f32-qc8w-gemm/1x8-sse2.c
+tools/xngen src/f32-qc8w-gemm/sse2.c.in -D MR=4 -D NR=8 -o src/f32-qc8w-gemm/4x8-sse2.c
+
+################################### x86 AVX ###################################
+tools/xngen src/f32-qc8w-gemm/avx.c.in -D MR=1 -D NR=16 -o src/f32-qc8w-gemm/1x16-avx.c
+tools/xngen src/f32-qc8w-gemm/avx.c.in -D MR=4 -D NR=16 -o src/f32-qc8w-gemm/4x16-avx.c
+
+################################## Unit tests #################################
+tools/generate-gemm-test.py --spec test/f32-qc8w-gemm.yaml --output test/f32-qc8w-gemm.cc
@@ -49,6 +49,28 @@ tools/xngen src/f32-spmm/neon-pipelined.c.in -D MR=16 -D NR=1 -D FMA=1 -o src/f3
 ### Microkernels without unrolling
 tools/xngen src/f32-spmm/sse.c.in -D MR=4 -D NR=1 -D UNROLL=1 -o src/f32-spmm/4x1-sse.c
 tools/xngen src/f32-spmm/sse.c.in -D MR=8 -D NR=1 -D UNROLL=1 -o src/f32-spmm/8x1-sse.c
+tools/xngen src/f32-spmm/sse.c.in -D MR=16 -D NR=1 -D UNROLL=1 -o src/f32-spmm/16x1-sse.c
+tools/xngen src/f32-spmm/sse.c.in -D MR=32 -D NR=1 -D UNROLL=1 -o src/f32-spmm/32x1-sse.c
+### Microkernels for blocks of several output channels
+tools/xngen src/f32-spmm/sse-blocked.c.in -D MR=4 -D NR=2 -o src/f32-spmm/4x2-sse.c
+tools/xngen src/f32-spmm/sse-blocked.c.in -D MR=8 -D NR=2 -o src/f32-spmm/8x2-sse.c
+tools/xngen src/f32-spmm/sse-blocked.c.in -D MR=16 -D NR=2 -o src/f32-spmm/16x2-sse.c
+tools/xngen src/f32-spmm/sse-blocked.c.in -D MR=4 -D NR=4 -o src/f32-spmm/4x4-sse.c
+tools/xngen src/f32-spmm/sse-blocked.c.in -D MR=8 -D NR=4 -o src/f32-spmm/8x4-sse.c
+
+################################## x86 FMA3 ###################################
+tools/xngen src/f32-spmm/fma3.c.in -D MR=8 -D NR=1 -o src/f32-spmm/8x1-fma3.c
+tools/xngen src/f32-spmm/fma3.c.in -D MR=16 -D NR=1 -o src/f32-spmm/16x1-fma3.c
+tools/xngen src/f32-spmm/fma3.c.in -D MR=32 -D NR=1 -o src/f32-spmm/32x1-fma3.c
+tools/xngen src/f32-spmm/fma3.c.in -D MR=16 -D NR=2 -o src/f32-spmm/16x2-fma3.c
+tools/xngen src/f32-spmm/fma3.c.in -D MR=32 -D NR=2 -o src/f32-spmm/32x2-fma3.c
+tools/xngen src/f32-spmm/fma3.c.in -D MR=16 -D NR=4 -o src/f32-spmm/16x4-fma3.c
+
+################################# x86 AVX512F #################################
+tools/xngen src/f32-spmm/avx512f.c.in -D MR=16 -D NR=1 -o src/f32-spmm/16x1-avx512f.c
+tools/xngen src/f32-spmm/avx512f.c.in -D MR=32 -D NR=1 -o src/f32-spmm/32x1-avx512f.c
+tools/xngen src/f32-spmm/avx512f.c.in -D MR=32 -D NR=2 -o src/f32-spmm/32x2-avx512f.c
+tools/xngen src/f32-spmm/avx512f.c.in -D MR=32 -D NR=4 -o src/f32-spmm/32x4-avx512f.c
 
 
 ################################## Unit tests #################################
@@ -0,0 +1,60 @@
+#!/bin/sh
+# Copyright 2019 Google LLC
+#
+# This source code is licensed under the BSD-style license found in the
+# LICENSE file in the root directory of this source tree.
+
+#################################### Scalar ###################################
+tools/xngen src/f32-vbinary/vop-scalar.c.in -D OP=DIV -D BATCH_TILE=2 -o src/f32-vbinary/vdiv-scalar-x2.c
+tools/xngen src/f32-vbinary/vop-scalar.c.in -D OP=MAX -D BATCH_TILE=2 -o src/f32-vbinary/vmax-scalar-x2.c
+tools/xngen src/f32-vbinary/vop-scalar.c.in -D OP=MIN -D BATCH_TILE=2 -o src/f32-vbinary/vmin-scalar-x2.c
+
+tools/xngen src/f32-vbinary/vopc-scalar.c.in -D OP=ADD -D BATCH_TILE=2 -o src/f32-vbinary/vaddc-scalar-x2.c
+tools/xngen src/f32-vbinary/vopc-scalar.c.in -D OP=DIV -D BATCH_TILE=2 -o src/f32-vbinary/vdivc-scalar-x2.c
+tools/xngen src/f32-vbinary/vopc-scalar.c.in -D OP=RDIV -D BATCH_TILE=2 -o src/f32-vbinary/vrdivc-scalar-x2.c
+tools/xngen src/f32-vbinary/vopc-scalar.c.in -D OP=MAX -D BATCH_TILE=2 -o src/f32-vbinary/vmaxc-scalar-x2.c
+tools/xngen src/f32-vbinary/vopc-scalar.c.in -D OP=MIN -D BATCH_TILE=2 -o src/f32-vbinary/vminc-scalar-x2.c
+tools/xngen src/f32-vbinary/vopc-scalar.c.in -D OP=MUL -D BATCH_TILE=2 -o src/f32-vbinary/vmulc-scalar-x2.c
+tools/xngen src/f32-vbinary/vopc-scalar.c.in -D OP=SUB -D BATCH_TILE=2 -o src/f32-vbinary/vsubc-scalar-x2.c
+tools/xngen src/f32-vbinary/vopc-scalar.c.in -D OP=RSUB -D BATCH_TILE=2 -o src/f32-vbinary/vrsubc-scalar-x2.c
+
+#################################### PSIMD ####################################
+tools/xngen src/f32-vbinary/vop-psimd.c.in -D OP=DIV -D BATCH_TILE=8 -o src/f32-vbinary/vdiv-psimd-x8.c
+tools/xngen src/f32-vbinary/vop-psimd.c.in -D OP=MAX -D BATCH_TILE=8 -o src/f32-vbinary/vmax-psimd-x8.c
+tools/xngen src/f32-vbinary/vop-psimd.c.in -D OP=MIN -D BATCH_TILE=8 -o src/f32-vbinary/vmin-psimd-x8.c
+
+tools/xngen src/f32-vbinary/vopc-psimd.c.in -D OP=ADD -D BATCH_TILE=8 -o src/f32-vbinary/vaddc-psimd-x8.c
+tools/xngen src/f32-vbinary/vopc-psimd.c.in -D OP=DIV -D BATCH_TILE=8 -o src/f32-vbinary/vdivc-psimd-x8.c
+tools/xngen src/f32-vbinary/vopc-psimd.c.in -D OP=RDIV -D BATCH_TILE=8 -o src/f32-vbinary/vrdivc-psimd-x8.c
+tools/xngen src/f32-vbinary/vopc-psimd.c.in -D OP=MAX -D BATCH_TILE=8 -o src/f32-vbinary/vmaxc-psimd-x8.c
+tools/xngen src/f32-vbinary/vopc-psimd.c.in -D OP=MIN -D BATCH_TILE=8 -o src/f32-vbinary/vminc-psimd-x8.c
+tools/xngen src/f32-vbinary/vopc-psimd.c.in -D OP=MUL -D BATCH_TILE=8 -o src/f32-vbinary/vmulc-psimd-x8.c
+tools/xngen src/f32-vbinary/vopc-psimd.c.in -D OP=SUB -D BATCH_TILE=8 -o src/f32-vbinary/vsubc-psimd-x8.c
+tools/xngen src/f32-vbinary/vopc-psimd.c.in -D OP=RSUB -D BATCH_TILE=8 -o src/f32-vbinary/vrsubc-psimd-x8.c
+
+################################### x86 SSE ###################################
+tools/xngen src/f32-vbinary/vop-sse.c.in -D OP=DIV -D BATCH_TILE=8 -o src/f32-vbinary/vdiv-sse-x8.c
+tools/xngen src/f32-vbinary/vop-sse.c.in -D OP=MAX -D BATCH_TILE=8 -o src/f32-vbinary/vmax-sse-x8.c
+tools/xngen src/f32-vbinary/vop-sse.c.in -D OP=MIN -D BATCH_TILE=8 -o src/f32-vbinary/vmin-sse-x8.c
+
+tools/xngen src/f32-vbinary/vopc-sse.c.in -D OP=ADD -D BATCH_TILE=8 -o src/f32-vbinary/vaddc-sse-x8.c
+tools/xngen src/f32-vbinary/vopc-sse.c.in -D OP=DIV -D BATCH_TILE=8 -o src/f32-vbinary/vdivc-sse-x8.c
+tools/xngen src/f32-vbinary/vopc-sse.c.in -D OP=RDIV -D BATCH_TILE=8 -o src/f32-vbinary/vrdivc-sse-x8.c
+tools/xngen src/f32-vbinary/vopc-sse.c.in -D OP=MAX -D BATCH_TILE=8 -o src/f32-vbinary/vmaxc-sse-x8.c
+tools/xngen src/f32-vbinary/vopc-sse.c.in -D OP=MIN -D BATCH_TILE=8 -o src/f32-vbinary/vminc-sse-x8.c
+tools/xngen src/f32-vbinary/vopc-sse.c.in -D OP=MUL -D BATCH_TILE=8 -o src/f32-vbinary/vmulc-sse-x8.c
+tools/xngen src/f32-vbinary/vopc-sse.c.in -D OP=SUB -D BATCH_TILE=8 -o src/f32-vbinary/vsubc-sse-x8.c
+tools/xngen src/f32-vbinary/vopc-sse.c.in -D OP=RSUB -D BATCH_TILE=8 -o src/f32-vbinary/vrsubc-sse-x8.c
+
+################################## Unit tests #################################
+tools/generate-vbinary-test.py --tester VBinOpMicrokernelTester --spec test/f32-vdiv.yaml --output test/f32-vdiv.cc
+tools/generate-vbinary-test.py --tester VBinOpMicrokernelTester --spec test/f32-vmax.yaml --output test/f32-vmax.cc
+tools/generate-vbinary-test.py --tester VBinOpMicrokernelTester --spec test/f32-vmin.yaml --output test/f32-vmin.cc
+tools/generate-vbinary-test.py --tester VBinOpCMicrokernelTester --spec test/f32-vaddc.yaml --output test/f32-vaddc.cc
+tools/generate-vbinary-test.py --tester VBinOpCMicrokernelTester --spec test/f32-vdivc.yaml --output test/f32-vdivc.cc
+tools/generate-vbinary-test.py --tester VBinOpCMicrokernelTester --spec test/f32-vrdivc.yaml --output test/f32-vrdivc.cc
+tools/generate-vbinary-test.py --tester VBinOpCMicrokernelTester --spec test/f32-vmaxc.yaml --output test/f32-vmaxc.cc
+tools/generate-vbinary-test.py --tester VBinOpCMicrokernelTester --spec test/f32-vminc.yaml --output test/f32-vminc.cc
+tools/generate-vbinary-test.py --tester VBinOpCMicrokernelTester --spec test/f32-vmulc.yaml --output test/f32-vmulc.cc
+tools/generate-vbinary-test.py --tester VBinOpCMicrokernelTester --spec test/f32-vsubc.yaml --output test/f32-vsubc.cc
+tools/generate-vbinary-test.py --tester VBinOpCMicrokernelTester --spec test/f32-vrsubc.yaml --output test/f32-vrsubc.cc
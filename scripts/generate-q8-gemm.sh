@@ -0,0 +1,11 @@
+#!/bin/sh
+# Copyright 2019 Google LLC
+#
+# This source code is licensed under the BSD-style license found in the
+# LICENSE file in the root directory of this source tree.
+
+################################# x86 SSE4.1 ##################################
+tools/xngen src/q8-gemm/MRx8c2-sse41.c.in -D MR=4 -o src/q8-gemm/4x8c2-sse41.c
+
+################################## x86 AVX2 ###################################
+tools/xngen src/q8-gemm/MRx16c2-avx2.c.in -D MR=4 -o src/q8-gemm/4x16c2-avx2.c
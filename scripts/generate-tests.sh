@@ -9,6 +9,14 @@ tools/generate-gemm-test.py --spec test/q8-gemm.yaml --output test/q8-gemm.cc
 tools/generate-gemm-test.py --spec test/q8-igemm.yaml --output test/q8-igemm.cc
 tools/generate-dwconv-test.py --spec test/q8-dwconv.yaml --output test/q8-dwconv.cc
 
+### Tests for Q8C micro-kernels
+tools/generate-gemm-test.py --spec test/q8c-gemm.yaml --output test/q8c-gemm.cc
+tools/generate-gemm-test.py --spec test/q8c-igemm.yaml --output test/q8c-igemm.cc
+tools/generate-dwconv-test.py --spec test/q8c-dwconv.yaml --output test/q8c-dwconv.cc
+
+### Tests for Q8DQ micro-kernels
+tools/generate-gemm-test.py --spec test/q8dq-gemm.yaml --output test/q8dq-gemm.cc
+
 ### Tests for packing micro-kernels
 tools/generate-pack-test.py --spec test/x32-packx.yaml --output test/x32-packx.cc
 
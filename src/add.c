@@ -12,6 +12,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include <fp16.h>
+
 #include <xnnpack.h>
 #include <xnnpack/allocator.h>
 #include <xnnpack/operator.h>
@@ -151,6 +153,104 @@ error:
   return status;
 }
 
+enum xnn_status xnn_create_add_nc_f16(
+    size_t channels,
+    size_t a_stride,
+    size_t b_stride,
+    size_t sum_stride,
+    float sum_min,
+    float sum_max,
+    uint32_t flags,
+    xnn_operator_t* add_op_out)
+{
+  xnn_operator_t add_op = NULL;
+  enum xnn_status status = xnn_status_uninitialized;
+
+  if (!xnn_params.initialized) {
+    xnn_log_error("failed to create Add operator: XNNPACK is not initialized");
+    goto error;
+  }
+
+  status = xnn_status_invalid_parameter;
+
+  if (channels == 0) {
+    xnn_log_error(
+      "failed to create add operator with %zu channels: number of channels must be non-zero", channels);
+    goto error;
+  }
+
+  if (a_stride < channels) {
+    xnn_log_error(
+      "failed to create Add operator with A element stride of %zu: "
+      "stride must be at least as large as the number of channels (%zu)",
+      a_stride, channels);
+    goto error;
+  }
+
+  if (b_stride < channels) {
+    xnn_log_error(
+      "failed to create Add operator with B element stride of %zu: "
+      "stride must be at least as large as the number of channels (%zu)",
+      b_stride, channels);
+    goto error;
+  }
+
+  if (sum_stride < channels) {
+    xnn_log_error(
+      "failed to create Add operator with Sum element stride of %zu: "
+      "stride must be at least as large as the number of channels (%zu)",
+      sum_stride, channels);
+    goto error;
+  }
+
+  if (isnan(sum_min)) {
+    xnn_log_error(
+      "failed to create Add operator with NaN output lower bound: lower bound must be non-NaN");
+    goto error;
+  }
+
+  if (isnan(sum_max)) {
+    xnn_log_error(
+      "failed to create Add operator with NaN output upper bound: upper bound must be non-NaN");
+    goto error;
+  }
+
+  const struct xnn_f16_output_params sum_params = xnn_compute_f16_output_params(1.0f, sum_min, sum_max);
+  if (fp16_ieee_to_fp32_value(sum_params.min) >= fp16_ieee_to_fp32_value(sum_params.max)) {
+    xnn_log_error(
+      "failed to create Add operator with [%.7g, %.7g] output range: "
+      "lower bound must be below upper bound in half precision",
+      sum_min, sum_max);
+    goto error;
+  }
+
+  status = xnn_status_out_of_memory;
+
+  add_op = xnn_allocate_zero_memory(sizeof(struct xnn_operator));
+  if (add_op == NULL) {
+    xnn_log_error("failed to allocate %zu bytes for Add operator descriptor", sizeof(struct xnn_operator));
+    goto error;
+  }
+
+  add_op->channels = channels;
+  add_op->input_pixel_stride = a_stride;
+  add_op->input2_pixel_stride = b_stride;
+  add_op->output_pixel_stride = sum_stride;
+  add_op->f16_output_params = sum_params;
+
+  add_op->type = xnn_operator_type_add_f16;
+  add_op->ukernel.type = xnn_ukernel_type_add;
+
+  add_op->state = xnn_run_state_invalid;
+
+  *add_op_out = add_op;
+  return xnn_status_success;
+
+error:
+  xnn_delete_operator(add_op);
+  return status;
+}
+
 enum xnn_status xnn_create_add_nc_f32(
     size_t channels,
     size_t a_stride,
@@ -271,6 +371,8 @@ enum xnn_status xnn_setup_add_nc_q8(
     return xnn_status_success;
   }
 
+  add_op->batch_size = batch_size;
+
   const size_t channels = add_op->channels;
   const size_t a_stride = add_op->input_pixel_stride;
   const size_t b_stride = add_op->input2_pixel_stride;
@@ -282,7 +384,7 @@ enum xnn_status xnn_setup_add_nc_q8(
       .b = b,
       .y = sum,
       .params.q8 = add_op->q8_add_params,
-      .ukernel = xnn_params.q8.vadd,
+      .ukernel = xnn_params.q8.vadd.op_ukernel,
     };
     add_op->compute.type = xnn_parallelization_type_1d_tile_1d;
     add_op->compute.task_1d_tile_1d = (pthreadpool_task_1d_tile_1d_t) xnn_compute_add_contiguous;
@@ -298,7 +400,72 @@ enum xnn_status xnn_setup_add_nc_q8(
       .y_stride = sum_stride * sizeof(uint8_t),
       .n = channels,
       .params.q8 = add_op->q8_add_params,
-      .ukernel = xnn_params.q8.vadd,
+      .ukernel = xnn_params.q8.vadd.op_ukernel,
+    };
+    add_op->compute.type = xnn_parallelization_type_1d_tile_1d;
+    add_op->compute.task_1d_tile_1d = (pthreadpool_task_1d_tile_1d_t) xnn_compute_add_strided;
+    add_op->compute.range[0] = batch_size;
+    add_op->compute.tile[0] = 1;
+  }
+  add_op->state = xnn_run_state_ready;
+
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_setup_add_nc_f16(
+    xnn_operator_t add_op,
+    size_t batch_size,
+    const void* a,
+    const void* b,
+    void* sum,
+    pthreadpool_t threadpool)
+{
+  if (add_op->type != xnn_operator_type_add_f16) {
+    xnn_log_error("failed to setup Add (F16) operator: operator type mismatch");
+    return xnn_status_invalid_parameter;
+  }
+  add_op->state = xnn_run_state_invalid;
+
+  if (!xnn_params.initialized) {
+    xnn_log_error("failed to setup Add operator: XNNPACK is not initialized");
+    return xnn_status_uninitialized;
+  }
+
+  if (batch_size == 0) {
+    add_op->state = xnn_run_state_skip;
+    return xnn_status_success;
+  }
+
+  add_op->batch_size = batch_size;
+
+  const size_t channels = add_op->channels;
+  const size_t a_stride = add_op->input_pixel_stride;
+  const size_t b_stride = add_op->input2_pixel_stride;
+  const size_t sum_stride = add_op->output_pixel_stride;
+  if ((((a_stride ^ channels) | (b_stride ^ channels) | (sum_stride ^ channels)) == 0) || batch_size == 1) {
+    const size_t block_size = 4096;
+    add_op->context.add_contiguous = (struct add_contiguous_context) {
+      .a = a,
+      .b = b,
+      .y = sum,
+      .params.f16 = add_op->f16_output_params,
+      .ukernel = xnn_params.f16.vadd,
+    };
+    add_op->compute.type = xnn_parallelization_type_1d_tile_1d;
+    add_op->compute.task_1d_tile_1d = (pthreadpool_task_1d_tile_1d_t) xnn_compute_add_contiguous;
+    add_op->compute.range[0] = batch_size * channels * sizeof(uint16_t);
+    add_op->compute.tile[0] = block_size;
+  } else {
+    add_op->context.add_strided = (struct add_strided_context) {
+      .a = a,
+      .a_stride = a_stride * sizeof(uint16_t),
+      .b = b,
+      .b_stride = b_stride * sizeof(uint16_t),
+      .y = sum,
+      .y_stride = sum_stride * sizeof(uint16_t),
+      .n = channels * sizeof(uint16_t),
+      .params.f16 = add_op->f16_output_params,
+      .ukernel = xnn_params.f16.vadd,
     };
     add_op->compute.type = xnn_parallelization_type_1d_tile_1d;
     add_op->compute.task_1d_tile_1d = (pthreadpool_task_1d_tile_1d_t) xnn_compute_add_strided;
@@ -334,6 +501,8 @@ enum xnn_status xnn_setup_add_nc_f32(
     return xnn_status_success;
   }
 
+  add_op->batch_size = batch_size;
+
   const size_t channels = add_op->channels;
   const size_t a_stride = add_op->input_pixel_stride;
   const size_t b_stride = add_op->input2_pixel_stride;
@@ -345,7 +514,7 @@ enum xnn_status xnn_setup_add_nc_f32(
       .b = b,
       .y = sum,
       .params.f32 = add_op->f32_output_params,
-      .ukernel = xnn_params.f32.vadd,
+      .ukernel = xnn_params.f32.vadd.op_ukernel,
     };
     add_op->compute.type = xnn_parallelization_type_1d_tile_1d;
     add_op->compute.task_1d_tile_1d = (pthreadpool_task_1d_tile_1d_t) xnn_compute_add_contiguous;
@@ -361,7 +530,7 @@ enum xnn_status xnn_setup_add_nc_f32(
       .y_stride = sum_stride * sizeof(float),
       .n = channels * sizeof(float),
       .params.f32 = add_op->f32_output_params,
-      .ukernel = xnn_params.f32.vadd,
+      .ukernel = xnn_params.f32.vadd.op_ukernel,
     };
     add_op->compute.type = xnn_parallelization_type_1d_tile_1d;
     add_op->compute.task_1d_tile_1d = (pthreadpool_task_1d_tile_1d_t) xnn_compute_add_strided;
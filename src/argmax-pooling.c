@@ -209,19 +209,6 @@ enum xnn_status xnn_setup_argmax_pooling2d_nhwc_f32(
       argmax_pooling_op->kernel_width);
   argmax_pooling_op->output = output;
 
-  size_t valid_batch_size = 0;
-  if (input == argmax_pooling_op->last_input &&
-      input_height == argmax_pooling_op->last_input_height &&
-      input_width == argmax_pooling_op->last_input_width)
-  {
-    valid_batch_size = argmax_pooling_op->valid_batch_size;
-    if (batch_size <= valid_batch_size) {
-      argmax_pooling_op->compute.range[0] = batch_size;
-      argmax_pooling_op->state = xnn_run_state_ready;
-      return xnn_status_success;
-    }
-  }
-
   const size_t pooling_height = argmax_pooling_op->kernel_height;
   const size_t pooling_width = argmax_pooling_op->kernel_width;
   const size_t pooling_size = pooling_height * pooling_width;
@@ -229,20 +216,48 @@ enum xnn_status xnn_setup_argmax_pooling2d_nhwc_f32(
   const size_t output_width = argmax_pooling_op->output_width;
   const struct argmaxpool_parameters* ukernel = select_ukernel(pooling_size, xnn_params.f32.argmaxpool);
   const uint32_t mr = ukernel->mr;
+  const uint32_t qr = ukernel->qr;
 
   const size_t step_width = pooling_width;
   const size_t step_height = pooling_size + (output_width * step_width - 1) * pooling_height;
-  // Micro-kernel may read up to (mr - 1) elements after the end of indirection buffer.
-  const size_t indirection_buffer_size = sizeof(void*) * ((mr - 1) + batch_size * output_height * step_height);
+  const size_t multipass_adjustment = qr == 0 ? 0 : round_up(pooling_size - mr, qr) + mr - qr;
 
-  const void** indirection_buffer = (const void**) realloc(argmax_pooling_op->indirection_buffer, indirection_buffer_size);
+  // The indirection buffer stays valid when only the input pointer changes: setup rebases a cached copy of it to the
+  // new input pointer. It is extended incrementally for larger batches of the same input.
+  size_t valid_batch_size = 0;
+  if (input_height == argmax_pooling_op->last_input_height &&
+      input_width == argmax_pooling_op->last_input_width &&
+      (input == argmax_pooling_op->last_input || batch_size <= argmax_pooling_op->valid_batch_size))
+  {
+    valid_batch_size = argmax_pooling_op->valid_batch_size;
+  }
+
+  if (batch_size > valid_batch_size) {
+    // Micro-kernel may read up to (mr - 1) elements after the end of indirection buffer.
+    const size_t indirection_buffer_size = sizeof(void*) * ((mr - 1) + batch_size * output_height * step_height);
+
+    const void** indirection_buffer =
+      (const void**) realloc(argmax_pooling_op->indirection_buffer, indirection_buffer_size);
+    if (indirection_buffer == NULL) {
+      xnn_log_error("failed to allocate %zu bytes for indirection buffer", indirection_buffer_size);
+      return xnn_status_out_of_memory;
+    }
+    argmax_pooling_op->indirection_buffer = indirection_buffer;
+
+    xnn_indirection_init_maxpool2d(argmax_pooling_op, valid_batch_size, step_height, step_width, 2 /* log2(sizeof(float)) */);
+
+    argmax_pooling_op->last_input = input;
+    argmax_pooling_op->last_input_height = input_height;
+    argmax_pooling_op->last_input_width = input_width;
+    argmax_pooling_op->valid_batch_size = batch_size;
+  }
+
+  const void** indirection_buffer = xnn_indirection_rebase(
+    argmax_pooling_op, argmax_pooling_op->last_input, input, (mr - 1) + batch_size * output_height * step_height,
+    NULL /* zero */);
   if (indirection_buffer == NULL) {
-    xnn_log_error("failed to allocate %zu bytes for indirection buffer", indirection_buffer_size);
     return xnn_status_out_of_memory;
   }
-  argmax_pooling_op->indirection_buffer = indirection_buffer;
-
-  xnn_indirection_init_maxpool2d(argmax_pooling_op, valid_batch_size, step_height, step_width, 2 /* log2(sizeof(float)) */);
 
   const size_t channels = argmax_pooling_op->channels;
 
@@ -251,8 +266,6 @@ enum xnn_status xnn_setup_argmax_pooling2d_nhwc_f32(
   const size_t output_height_stride = output_width * output_width_stride;
   const size_t index_height_stride = output_width * channels * sizeof(uint32_t);
 
-  const uint32_t qr = ukernel->qr;
-  const size_t multipass_adjustment = qr == 0 ? 0 : round_up(pooling_size - mr, qr) + mr - qr;
   argmax_pooling_op->context.argmax_pooling = (struct argmax_pooling_context) {
       .indirect_input = indirection_buffer,
       .indirect_input_batch_stride = output_height * indirect_input_height_stride,
@@ -283,10 +296,5 @@ enum xnn_status xnn_setup_argmax_pooling2d_nhwc_f32(
   }
   argmax_pooling_op->state = xnn_run_state_ready;
 
-  argmax_pooling_op->last_input = input;
-  argmax_pooling_op->last_input_height = input_height;
-  argmax_pooling_op->last_input_width = input_width;
-  argmax_pooling_op->valid_batch_size = max(valid_batch_size, batch_size);
-
   return xnn_status_success;
 }
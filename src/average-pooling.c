@@ -405,19 +405,6 @@ enum xnn_status xnn_setup_average_pooling2d_nhwc_q8(
       average_pooling_op->stride_width);
   average_pooling_op->output = output;
 
-  size_t valid_batch_size = 0;
-  if (input == average_pooling_op->last_input &&
-      input_height == average_pooling_op->last_input_height &&
-      input_width == average_pooling_op->last_input_width)
-  {
-    valid_batch_size = average_pooling_op->valid_batch_size;
-    if (batch_size <= valid_batch_size) {
-      average_pooling_op->compute.range[0] = batch_size;
-      average_pooling_op->state = xnn_run_state_ready;
-      return xnn_status_success;
-    }
-  }
-
   const size_t pooling_height = average_pooling_op->kernel_height;
   const size_t pooling_width = average_pooling_op->kernel_width;
   const size_t pooling_size = pooling_height * pooling_width;
@@ -425,30 +412,56 @@ enum xnn_status xnn_setup_average_pooling2d_nhwc_q8(
   const size_t output_width = average_pooling_op->output_width;
   // Micro-kernel may read up to (mr - 1) elements after the end of indirection buffer.
   const uint32_t mr = xnn_params.q8.avgpool.mr;
+  const uint32_t qr = xnn_params.q8.avgpool.qr;
 
   const size_t step_width = min(average_pooling_op->stride_width, pooling_width);
   const size_t step_height = pooling_size + (output_width * step_width - 1) * pooling_height;
-  const size_t indirection_buffer_size = sizeof(void*) * ((mr - 1) + batch_size * output_height * step_height);
+  const size_t multipass_adjustment =
+    pooling_size > mr ? round_up(pooling_size - mr, qr) + mr - qr : 0;
+
+  // The indirection buffer stays valid when only the input pointer changes: setup rebases a cached copy of it to the
+  // new input pointer. It is extended incrementally for larger batches of the same input.
+  size_t valid_batch_size = 0;
+  if (input_height == average_pooling_op->last_input_height &&
+      input_width == average_pooling_op->last_input_width &&
+      (input == average_pooling_op->last_input || batch_size <= average_pooling_op->valid_batch_size))
+  {
+    valid_batch_size = average_pooling_op->valid_batch_size;
+  }
+
+  if (batch_size > valid_batch_size) {
+    const size_t indirection_buffer_size = sizeof(void*) * ((mr - 1) + batch_size * output_height * step_height);
+
+    const void** indirection_buffer =
+      (const void**) realloc(average_pooling_op->indirection_buffer, indirection_buffer_size);
+    if (indirection_buffer == NULL) {
+      xnn_log_error("failed to allocate %zu bytes for indirection buffer", indirection_buffer_size);
+      return xnn_status_out_of_memory;
+    }
+    average_pooling_op->indirection_buffer = indirection_buffer;
+
+    xnn_indirection_init_dwconv2d(
+      average_pooling_op, valid_batch_size, step_height, step_width, 0 /* log2(sizeof(uint8_t)) */);
 
-  const void** indirection_buffer = (const void**) realloc(average_pooling_op->indirection_buffer, indirection_buffer_size);
+    average_pooling_op->last_input = input;
+    average_pooling_op->last_input_height = input_height;
+    average_pooling_op->last_input_width = input_width;
+    average_pooling_op->valid_batch_size = batch_size;
+  }
+
+  const void** indirection_buffer = xnn_indirection_rebase(
+    average_pooling_op, average_pooling_op->last_input, input, (mr - 1) + batch_size * output_height * step_height,
+    average_pooling_op->zero_buffer);
   if (indirection_buffer == NULL) {
-    xnn_log_error("failed to allocate %zu bytes for indirection buffer", indirection_buffer_size);
     return xnn_status_out_of_memory;
   }
-  average_pooling_op->indirection_buffer = indirection_buffer;
-
-  xnn_indirection_init_dwconv2d(
-    average_pooling_op, valid_batch_size, step_height, step_width, 0 /* log2(sizeof(uint8_t)) */);
 
-  const uint32_t qr = xnn_params.q8.avgpool.qr;
   const size_t channels = average_pooling_op->channels;
 
   const size_t indirect_input_height_stride = step_height * sizeof(void*);
   const size_t output_width_stride = average_pooling_op->output_pixel_stride * sizeof(uint8_t);
   const size_t output_height_stride = output_width * output_width_stride;
 
-  const size_t multipass_adjustment =
-    pooling_size > mr ? round_up(pooling_size - mr, qr) + mr - qr : 0;
   average_pooling_op->context.average_pooling = (struct average_pooling_context) {
       .indirect_input = indirection_buffer,
       .indirect_input_batch_stride = output_height * indirect_input_height_stride,
@@ -477,11 +490,6 @@ enum xnn_status xnn_setup_average_pooling2d_nhwc_q8(
   }
   average_pooling_op->state = xnn_run_state_ready;
 
-  average_pooling_op->last_input = input;
-  average_pooling_op->last_input_height = input_height;
-  average_pooling_op->last_input_width = input_width;
-  average_pooling_op->valid_batch_size = max(valid_batch_size, batch_size);
-
   return xnn_status_success;
 }
 
@@ -532,19 +540,6 @@ enum xnn_status xnn_setup_average_pooling2d_nhwc_f32(
       average_pooling_op->stride_width);
   average_pooling_op->output = output;
 
-  size_t valid_batch_size = 0;
-  if (input == average_pooling_op->last_input &&
-      input_height == average_pooling_op->last_input_height &&
-      input_width == average_pooling_op->last_input_width)
-  {
-    valid_batch_size = average_pooling_op->valid_batch_size;
-    if (batch_size <= valid_batch_size) {
-      average_pooling_op->compute.range[0] = batch_size;
-      average_pooling_op->state = xnn_run_state_ready;
-      return xnn_status_success;
-    }
-  }
-
   const size_t pooling_height = average_pooling_op->kernel_height;
   const size_t pooling_width = average_pooling_op->kernel_width;
   const size_t pooling_size = pooling_height * pooling_width;
@@ -553,20 +548,52 @@ enum xnn_status xnn_setup_average_pooling2d_nhwc_f32(
   // Micro-kernel may read up to (mr - 1) elements after the end of indirection buffer.
   const uint32_t mr = xnn_params.f32.avgpool.mr;
   assert(mr == xnn_params.f32.pavgpool.mr);
+  const uint32_t qr = average_pooling_op->ukernel.type == xnn_ukernel_type_pixelwise_average_pooling ?
+    xnn_params.f32.pavgpool.qr : xnn_params.f32.avgpool.qr;
 
   const size_t step_width = min(average_pooling_op->stride_width, pooling_width);
   const size_t step_height = pooling_size + (output_width * step_width - 1) * pooling_height;
-  const size_t indirection_buffer_size = sizeof(void*) * ((mr - 1) + batch_size * output_height * step_height);
+  const size_t multipass_adjustment =
+    pooling_size > mr ? round_up(pooling_size - mr, qr) + mr - qr : 0;
 
-  const void** indirection_buffer = (const void**) realloc(average_pooling_op->indirection_buffer, indirection_buffer_size);
+  const bool input_size_changed = input_height != average_pooling_op->last_input_height ||
+    input_width != average_pooling_op->last_input_width;
+
+  // The indirection buffer stays valid when only the input pointer changes: setup rebases a cached copy of it to the
+  // new input pointer. It is extended incrementally for larger batches of the same input.
+  size_t valid_batch_size = 0;
+  if (!input_size_changed &&
+      (input == average_pooling_op->last_input || batch_size <= average_pooling_op->valid_batch_size))
+  {
+    valid_batch_size = average_pooling_op->valid_batch_size;
+  }
+
+  if (batch_size > valid_batch_size) {
+    const size_t indirection_buffer_size = sizeof(void*) * ((mr - 1) + batch_size * output_height * step_height);
+
+    const void** indirection_buffer =
+      (const void**) realloc(average_pooling_op->indirection_buffer, indirection_buffer_size);
+    if (indirection_buffer == NULL) {
+      xnn_log_error("failed to allocate %zu bytes for indirection buffer", indirection_buffer_size);
+      return xnn_status_out_of_memory;
+    }
+    average_pooling_op->indirection_buffer = indirection_buffer;
+
+    xnn_indirection_init_dwconv2d(
+      average_pooling_op, valid_batch_size, step_height, step_width, 2 /* log2(sizeof(float)) */);
+
+    average_pooling_op->last_input = input;
+    average_pooling_op->last_input_height = input_height;
+    average_pooling_op->last_input_width = input_width;
+    average_pooling_op->valid_batch_size = batch_size;
+  }
+
+  const void** indirection_buffer = xnn_indirection_rebase(
+    average_pooling_op, average_pooling_op->last_input, input, (mr - 1) + batch_size * output_height * step_height,
+    average_pooling_op->zero_buffer);
   if (indirection_buffer == NULL) {
-    xnn_log_error("failed to allocate %zu bytes for indirection buffer", indirection_buffer_size);
     return xnn_status_out_of_memory;
   }
-  average_pooling_op->indirection_buffer = indirection_buffer;
-
-  xnn_indirection_init_dwconv2d(
-    average_pooling_op, valid_batch_size, step_height, step_width, 2 /* log2(sizeof(float)) */);
 
   const size_t channels = average_pooling_op->channels;
 
@@ -577,9 +604,6 @@ enum xnn_status xnn_setup_average_pooling2d_nhwc_f32(
   switch (average_pooling_op->ukernel.type) {
     case xnn_ukernel_type_average_pooling:
     {
-      const uint32_t qr = xnn_params.f32.avgpool.qr;
-      const size_t multipass_adjustment =
-        pooling_size > mr ? round_up(pooling_size - mr, qr) + mr - qr : 0;
       average_pooling_op->context.average_pooling = (struct average_pooling_context) {
         .indirect_input = indirection_buffer,
         .indirect_input_batch_stride = output_height * indirect_input_height_stride,
@@ -606,13 +630,14 @@ enum xnn_status xnn_setup_average_pooling2d_nhwc_f32(
     }
     case xnn_ukernel_type_pixelwise_average_pooling:
     {
-      if (input_height != average_pooling_op->last_input_height ||
-          input_width != average_pooling_op->last_input_width)
-      {
+      if (input_size_changed) {
         const size_t pixelwise_buffer_size = output_height * output_width * sizeof(float);
         float* pixelwise_buffer = (float*) realloc(average_pooling_op->pixelwise_buffer, pixelwise_buffer_size);
         if (pixelwise_buffer == NULL) {
           xnn_log_error("failed to allocate %zu bytes for pixelwise buffer", pixelwise_buffer_size);
+          // Force re-initialization of the pixelwise buffer on the next setup.
+          average_pooling_op->last_input_height = 0;
+          average_pooling_op->last_input_width = 0;
           return xnn_status_out_of_memory;
         }
         average_pooling_op->pixelwise_buffer = pixelwise_buffer;
@@ -633,9 +658,6 @@ enum xnn_status xnn_setup_average_pooling2d_nhwc_f32(
         }
       }
 
-      const uint32_t qr = xnn_params.f32.pavgpool.qr;
-      const size_t multipass_adjustment =
-        pooling_size > mr ? round_up(pooling_size - mr, qr) + mr - qr : 0;
       average_pooling_op->context.pixelwise_average_pooling = (struct pixelwise_average_pooling_context) {
         .indirect_input = indirection_buffer,
         .indirect_input_batch_stride = output_height * indirect_input_height_stride,
@@ -670,10 +692,5 @@ enum xnn_status xnn_setup_average_pooling2d_nhwc_f32(
   average_pooling_op->compute.range[1] = output_height;
   average_pooling_op->state = xnn_run_state_ready;
 
-  average_pooling_op->last_input = input;
-  average_pooling_op->last_input_height = input_height;
-  average_pooling_op->last_input_width = input_width;
-  average_pooling_op->valid_batch_size = max(valid_batch_size, batch_size);
-
   return xnn_status_success;
 }
@@ -0,0 +1,705 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <inttypes.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <xnnpack.h>
+#include <xnnpack/allocator.h>
+#include <xnnpack/log.h>
+#include <xnnpack/math.h>
+#include <xnnpack/operator.h>
+#include <xnnpack/params.h>
+#include <xnnpack/requantization.h>
+
+
+static enum xnn_status create_binary_elementwise_nd_f32(
+    float output_min,
+    float output_max,
+    uint32_t flags,
+    enum xnn_operator_type operator_type,
+    const struct vbinary_parameters vbinary[restrict static 1],
+    const char* operator_name,
+    xnn_operator_t* binary_elementwise_op_out)
+{
+  xnn_operator_t binary_elementwise_op = NULL;
+  enum xnn_status status = xnn_status_uninitialized;
+
+  if (!xnn_params.initialized) {
+    xnn_log_error("failed to create %s operator: XNNPACK is not initialized", operator_name);
+    goto error;
+  }
+
+  status = xnn_status_invalid_parameter;
+
+  if (isnan(output_min)) {
+    xnn_log_error(
+      "failed to create %s operator with NaN output lower bound: lower bound must be non-NaN", operator_name);
+    goto error;
+  }
+
+  if (isnan(output_max)) {
+    xnn_log_error(
+      "failed to create %s operator with NaN output upper bound: upper bound must be non-NaN", operator_name);
+    goto error;
+  }
+
+  if (output_min >= output_max) {
+    xnn_log_error(
+      "failed to create %s operator with [%.7g, %.7g] output range: lower bound must be below upper bound",
+      operator_name, output_min, output_max);
+    goto error;
+  }
+
+  status = xnn_status_out_of_memory;
+
+  binary_elementwise_op = xnn_allocate_zero_memory(sizeof(struct xnn_operator));
+  if (binary_elementwise_op == NULL) {
+    xnn_log_error("failed to allocate %zu bytes for %s operator descriptor", sizeof(struct xnn_operator), operator_name);
+    goto error;
+  }
+
+  binary_elementwise_op->f32_output_params = xnn_compute_f32_output_params(output_min, output_max);
+
+  binary_elementwise_op->type = operator_type;
+  binary_elementwise_op->ukernel.type = xnn_ukernel_type_vbinary;
+  binary_elementwise_op->ukernel.vbinary = (struct xnn_ukernel_vbinary) {
+    .op_function = vbinary->op_ukernel,
+    .opc_function = vbinary->opc_ukernel,
+    .ropc_function = vbinary->ropc_ukernel,
+  };
+
+  binary_elementwise_op->state = xnn_run_state_invalid;
+
+  *binary_elementwise_op_out = binary_elementwise_op;
+  return xnn_status_success;
+
+error:
+  xnn_delete_operator(binary_elementwise_op);
+  return status;
+}
+
+static enum xnn_status validate_q8_quantization(
+    uint8_t output_min,
+    uint8_t output_max,
+    float input1_scale,
+    float input2_scale,
+    float output_scale,
+    const char* operator_name)
+{
+  if (input1_scale <= 0.0f || !isnormal(input1_scale)) {
+    xnn_log_error(
+      "failed to create %s operator with %.7g input 1 scale: scale must be finite, normalized, and positive",
+      operator_name, input1_scale);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (input2_scale <= 0.0f || !isnormal(input2_scale)) {
+    xnn_log_error(
+      "failed to create %s operator with %.7g input 2 scale: scale must be finite, normalized, and positive",
+      operator_name, input2_scale);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (output_scale <= 0.0f || !isnormal(output_scale)) {
+    xnn_log_error(
+      "failed to create %s operator with %.7g output scale: scale must be finite, normalized, and positive",
+      operator_name, output_scale);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (output_min >= output_max) {
+    xnn_log_error(
+      "failed to create %s operator with [%" PRIu8 ", %" PRIu8 "] output range: range min must be below range max",
+      operator_name, output_min, output_max);
+    return xnn_status_invalid_parameter;
+  }
+
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_create_add_nd_q8(
+    uint8_t input1_zero_point,
+    float input1_scale,
+    uint8_t input2_zero_point,
+    float input2_scale,
+    uint8_t output_zero_point,
+    float output_scale,
+    uint8_t output_min,
+    uint8_t output_max,
+    uint32_t flags,
+    xnn_operator_t* add_op_out)
+{
+  xnn_operator_t add_op = NULL;
+  enum xnn_status status = xnn_status_uninitialized;
+
+  if (!xnn_params.initialized) {
+    xnn_log_error("failed to create Add operator: XNNPACK is not initialized");
+    goto error;
+  }
+
+  status = validate_q8_quantization(output_min, output_max, input1_scale, input2_scale, output_scale, "Add");
+  if (status != xnn_status_success) {
+    goto error;
+  }
+
+  status = xnn_status_unsupported_parameter;
+
+  const float input1_output_scale = input1_scale / output_scale;
+  if (input1_output_scale < 0x1.0p-14f || input1_output_scale >= 0x1.0p+8f) {
+    xnn_log_error(
+      "failed to create Add operator with %.7g input 1-to-output scale ratio: "
+      "scale ratio must be in [2**-14, 2**8) range",
+      input1_output_scale);
+    goto error;
+  }
+
+  const float input2_output_scale = input2_scale / output_scale;
+  if (input2_output_scale < 0x1.0p-14f || input2_output_scale >= 0x1.0p+8f) {
+    xnn_log_error(
+      "failed to create Add operator with %.7g input 2-to-output scale ratio: "
+      "scale ratio must be in [2**-14, 2**8) range",
+      input2_output_scale);
+    goto error;
+  }
+
+  status = xnn_status_out_of_memory;
+
+  add_op = xnn_allocate_zero_memory(sizeof(struct xnn_operator));
+  if (add_op == NULL) {
+    xnn_log_error("failed to allocate %zu bytes for Add operator descriptor", sizeof(struct xnn_operator));
+    goto error;
+  }
+
+  add_op->q8_add_params = xnn_compute_q8_add_params(
+    input1_zero_point, input2_zero_point, output_zero_point,
+    input1_output_scale, input2_output_scale,
+    output_min, output_max);
+  add_op->swapped_params.q8_add_params = xnn_compute_q8_add_params(
+    input2_zero_point, input1_zero_point, output_zero_point,
+    input2_output_scale, input1_output_scale,
+    output_min, output_max);
+
+  add_op->type = xnn_operator_type_add_nd_q8;
+  add_op->ukernel.type = xnn_ukernel_type_vbinary;
+  add_op->ukernel.vbinary = (struct xnn_ukernel_vbinary) {
+    .op_function = xnn_params.q8.vadd.op_ukernel,
+    .opc_function = xnn_params.q8.vadd.opc_ukernel,
+    .ropc_function = xnn_params.q8.vadd.ropc_ukernel,
+  };
+
+  add_op->state = xnn_run_state_invalid;
+
+  *add_op_out = add_op;
+  return xnn_status_success;
+
+error:
+  xnn_delete_operator(add_op);
+  return status;
+}
+
+enum xnn_status xnn_create_multiply_nd_q8(
+    uint8_t input1_zero_point,
+    float input1_scale,
+    uint8_t input2_zero_point,
+    float input2_scale,
+    uint8_t output_zero_point,
+    float output_scale,
+    uint8_t output_min,
+    uint8_t output_max,
+    uint32_t flags,
+    xnn_operator_t* multiply_op_out)
+{
+  xnn_operator_t multiply_op = NULL;
+  enum xnn_status status = xnn_status_uninitialized;
+
+  if (!xnn_params.initialized) {
+    xnn_log_error("failed to create Multiply operator: XNNPACK is not initialized");
+    goto error;
+  }
+
+  status = validate_q8_quantization(output_min, output_max, input1_scale, input2_scale, output_scale, "Multiply");
+  if (status != xnn_status_success) {
+    goto error;
+  }
+
+  status = xnn_status_unsupported_parameter;
+
+  // Products of inputs are requantized with the same fixed-point scheme as Q8 GEMM accumulators.
+  const float requantization_scale = input1_scale * input2_scale / output_scale;
+  if (requantization_scale >= 1.0f || requantization_scale < 0x1.0p-32f) {
+    xnn_log_error(
+      "failed to create Multiply operator with %.7g input 1 scale, %.7g input 2 scale, and %.7g output scale: "
+      "requantization scale %.7g must be in [2**-32, 1.0) range",
+      input1_scale, input2_scale, output_scale, requantization_scale);
+    goto error;
+  }
+
+  status = xnn_status_out_of_memory;
+
+  multiply_op = xnn_allocate_zero_memory(sizeof(struct xnn_operator));
+  if (multiply_op == NULL) {
+    xnn_log_error("failed to allocate %zu bytes for Multiply operator descriptor", sizeof(struct xnn_operator));
+    goto error;
+  }
+
+  // Input 1 takes the role of the GEMM input, and input 2 takes the role of the GEMM kernel.
+  multiply_op->q8_gemm_params = xnn_compute_q8_gemm_params(
+    input1_zero_point, input2_zero_point,
+    requantization_scale, output_zero_point, output_min, output_max);
+  multiply_op->swapped_params.q8_gemm_params = xnn_compute_q8_gemm_params(
+    input2_zero_point, input1_zero_point,
+    requantization_scale, output_zero_point, output_min, output_max);
+
+  multiply_op->type = xnn_operator_type_multiply_nd_q8;
+  multiply_op->ukernel.type = xnn_ukernel_type_vbinary;
+  multiply_op->ukernel.vbinary = (struct xnn_ukernel_vbinary) {
+    .op_function = xnn_params.q8.vmul.op_ukernel,
+    .opc_function = xnn_params.q8.vmul.opc_ukernel,
+    .ropc_function = xnn_params.q8.vmul.ropc_ukernel,
+  };
+
+  multiply_op->state = xnn_run_state_invalid;
+
+  *multiply_op_out = multiply_op;
+  return xnn_status_success;
+
+error:
+  xnn_delete_operator(multiply_op);
+  return status;
+}
+
+enum xnn_status xnn_create_add_nd_f32(
+    float output_min,
+    float output_max,
+    uint32_t flags,
+    xnn_operator_t* add_op_out)
+{
+  return create_binary_elementwise_nd_f32(
+    output_min, output_max, flags, xnn_operator_type_add_nd_f32, &xnn_params.f32.vadd, "Add", add_op_out);
+}
+
+enum xnn_status xnn_create_divide_nd_f32(
+    float output_min,
+    float output_max,
+    uint32_t flags,
+    xnn_operator_t* divide_op_out)
+{
+  return create_binary_elementwise_nd_f32(
+    output_min, output_max, flags, xnn_operator_type_divide_nd_f32, &xnn_params.f32.vdiv, "Divide", divide_op_out);
+}
+
+enum xnn_status xnn_create_maximum_nd_f32(
+    uint32_t flags,
+    xnn_operator_t* maximum_op_out)
+{
+  return create_binary_elementwise_nd_f32(
+    -INFINITY, INFINITY, flags, xnn_operator_type_maximum_nd_f32, &xnn_params.f32.vmax, "Maximum", maximum_op_out);
+}
+
+enum xnn_status xnn_create_minimum_nd_f32(
+    uint32_t flags,
+    xnn_operator_t* minimum_op_out)
+{
+  return create_binary_elementwise_nd_f32(
+    -INFINITY, INFINITY, flags, xnn_operator_type_minimum_nd_f32, &xnn_params.f32.vmin, "Minimum", minimum_op_out);
+}
+
+enum xnn_status xnn_create_multiply_nd_f32(
+    float output_min,
+    float output_max,
+    uint32_t flags,
+    xnn_operator_t* multiply_op_out)
+{
+  return create_binary_elementwise_nd_f32(
+    output_min, output_max, flags, xnn_operator_type_multiply_nd_f32, &xnn_params.f32.vmul, "Multiply",
+    multiply_op_out);
+}
+
+enum xnn_status xnn_create_subtract_nd_f32(
+    float output_min,
+    float output_max,
+    uint32_t flags,
+    xnn_operator_t* subtract_op_out)
+{
+  return create_binary_elementwise_nd_f32(
+    output_min, output_max, flags, xnn_operator_type_subtract_nd_f32, &xnn_params.f32.vsub, "Subtract",
+    subtract_op_out);
+}
+
+static enum xnn_status setup_binary_elementwise_nd(
+    xnn_operator_t binary_elementwise_op,
+    enum xnn_operator_type expected_operator_type,
+    size_t num_input1_dims,
+    const size_t* input1_shape,
+    size_t num_input2_dims,
+    const size_t* input2_shape,
+    const void* input1,
+    const void* input2,
+    void* output,
+    uint32_t log2_element_size,
+    const void* params,
+    const void* swapped_params,
+    size_t params_size,
+    const char* operator_name)
+{
+  if (binary_elementwise_op->type != expected_operator_type) {
+    xnn_log_error("failed to setup %s operator: operator type mismatch", operator_name);
+    return xnn_status_invalid_parameter;
+  }
+  binary_elementwise_op->state = xnn_run_state_invalid;
+
+  if (!xnn_params.initialized) {
+    xnn_log_error("failed to setup %s operator: XNNPACK is not initialized", operator_name);
+    return xnn_status_uninitialized;
+  }
+
+  if (max(num_input1_dims, num_input2_dims) > XNN_MAX_TENSOR_DIMS) {
+    xnn_log_error(
+      "failed to setup %s operator with %zu and %zu dimensions in input shapes: "
+      "the number of input dimensions must not exceed %d",
+      operator_name, num_input1_dims, num_input2_dims, XNN_MAX_TENSOR_DIMS);
+    return xnn_status_unsupported_parameter;
+  }
+
+  // Collapse the shapes into the fewest dimensions: consecutive dimensions are merged while the set of broadcasted
+  // inputs stays the same, and dimensions where both inputs have size 1 are dropped. Compressed dimensions are
+  // ordered from the innermost.
+  size_t num_compressed_dims = 0;
+  size_t compressed_input1_shape[XNN_MAX_TENSOR_DIMS];
+  size_t compressed_input2_shape[XNN_MAX_TENSOR_DIMS];
+  size_t compressed_output_shape[XNN_MAX_TENSOR_DIMS];
+  for (size_t i = 0; i < XNN_MAX_TENSOR_DIMS; i++) {
+    compressed_input1_shape[i] = 1;
+    compressed_input2_shape[i] = 1;
+    compressed_output_shape[i] = 1;
+  }
+  bool broadcast_input1 = false;
+  bool broadcast_input2 = false;
+  bool first_nonunit = true;
+  const size_t num_common_dims = min(num_input1_dims, num_input2_dims);
+  for (size_t i = 1; i <= num_common_dims; i++) {
+    const size_t input1_dim = input1_shape[num_input1_dims - i];
+    const size_t input2_dim = input2_shape[num_input2_dims - i];
+    if (input1_dim == 1 && input2_dim == 1) {
+      continue;
+    }
+    assert(!broadcast_input1 || !broadcast_input2);
+
+    if (input1_dim == 1) {
+      if (!broadcast_input1) {
+        broadcast_input1 = true;
+        broadcast_input2 = false;
+        num_compressed_dims++;
+      }
+      compressed_input2_shape[num_compressed_dims - 1] *= input2_dim;
+      compressed_output_shape[num_compressed_dims - 1] *= input2_dim;
+    } else if (input2_dim == 1) {
+      if (!broadcast_input2) {
+        broadcast_input1 = false;
+        broadcast_input2 = true;
+        num_compressed_dims++;
+      }
+      compressed_input1_shape[num_compressed_dims - 1] *= input1_dim;
+      compressed_output_shape[num_compressed_dims - 1] *= input1_dim;
+    } else if (input1_dim == input2_dim) {
+      if (broadcast_input1 || broadcast_input2 || first_nonunit) {
+        broadcast_input1 = false;
+        broadcast_input2 = false;
+        num_compressed_dims++;
+      }
+      compressed_input1_shape[num_compressed_dims - 1] *= input1_dim;
+      compressed_input2_shape[num_compressed_dims - 1] *= input1_dim;
+      compressed_output_shape[num_compressed_dims - 1] *= input1_dim;
+    } else {
+      xnn_log_error(
+        "failed to setup %s operator: shape dimension #%zu of input1 (%zu) does not match "
+        "shape dimension #%zu of input2 (%zu)",
+        operator_name, num_input1_dims - i, input1_dim, num_input2_dims - i, input2_dim);
+      return xnn_status_invalid_parameter;
+    }
+    first_nonunit = false;
+  }
+  // Leading dimensions of the input with more dimensions are broadcasted in the other input.
+  if (num_input1_dims > num_input2_dims) {
+    if (!broadcast_input2) {
+      num_compressed_dims++;
+    }
+    for (size_t i = 0; i < num_input1_dims - num_input2_dims; i++) {
+      const size_t input1_dim = input1_shape[i];
+      compressed_input1_shape[num_compressed_dims - 1] *= input1_dim;
+      compressed_output_shape[num_compressed_dims - 1] *= input1_dim;
+    }
+  } else if (num_input2_dims > num_input1_dims) {
+    if (!broadcast_input1) {
+      num_compressed_dims++;
+    }
+    for (size_t i = 0; i < num_input2_dims - num_input1_dims; i++) {
+      const size_t input2_dim = input2_shape[i];
+      compressed_input2_shape[num_compressed_dims - 1] *= input2_dim;
+      compressed_output_shape[num_compressed_dims - 1] *= input2_dim;
+    }
+  }
+  num_compressed_dims = max(num_compressed_dims, 1);
+  assert(num_compressed_dims <= XNN_MAX_TENSOR_DIMS);
+
+  size_t output_elements = 1;
+  for (size_t i = 0; i < num_compressed_dims; i++) {
+    output_elements *= compressed_output_shape[i];
+  }
+  if (output_elements == 0) {
+    binary_elementwise_op->state = xnn_run_state_skip;
+    return xnn_status_success;
+  }
+
+  struct elementwise_binary_context* context = &binary_elementwise_op->context.elementwise_binary;
+  memset(context, 0, sizeof(struct elementwise_binary_context));
+  context->y = output;
+  context->elements = compressed_output_shape[0] << log2_element_size;
+
+  // Pick the micro-kernel by the broadcasting in the innermost dimension. When input 1 is broadcasted, the inputs are
+  // swapped to pass the broadcasted element as the second argument of the reversed micro-kernel.
+  const size_t* compressed_a_shape = compressed_input1_shape;
+  const size_t* compressed_b_shape = compressed_input2_shape;
+  if (compressed_input1_shape[0] == 1) {
+    context->a = input2;
+    context->b = input1;
+    compressed_a_shape = compressed_input2_shape;
+    compressed_b_shape = compressed_input1_shape;
+    context->ukernel = binary_elementwise_op->ukernel.vbinary.ropc_function;
+    memcpy(&context->params, swapped_params, params_size);
+  } else {
+    context->a = input1;
+    context->b = input2;
+    if (compressed_input2_shape[0] == 1) {
+      context->ukernel = binary_elementwise_op->ukernel.vbinary.opc_function;
+    } else {
+      context->ukernel = binary_elementwise_op->ukernel.vbinary.op_function;
+    }
+    memcpy(&context->params, params, params_size);
+  }
+
+  // Strides of broadcasted dimensions stay zero.
+  size_t a_stride = compressed_a_shape[0] << log2_element_size;
+  size_t b_stride = compressed_b_shape[0] << log2_element_size;
+  size_t y_stride = compressed_output_shape[0] << log2_element_size;
+  for (size_t i = 1; i < num_compressed_dims; i++) {
+    if (compressed_a_shape[i] != 1) {
+      context->a_stride[XNN_MAX_TENSOR_DIMS - 1 - i] = a_stride;
+    }
+    if (compressed_b_shape[i] != 1) {
+      context->b_stride[XNN_MAX_TENSOR_DIMS - 1 - i] = b_stride;
+    }
+    context->y_stride[XNN_MAX_TENSOR_DIMS - 1 - i] = y_stride;
+    a_stride *= compressed_a_shape[i];
+    b_stride *= compressed_b_shape[i];
+    y_stride *= compressed_output_shape[i];
+  }
+
+  binary_elementwise_op->compute.type = xnn_parallelization_type_5d_tile_2d;
+  binary_elementwise_op->compute.task_5d_tile_2d = (pthreadpool_task_5d_tile_2d_t) xnn_compute_elementwise_binary_5d;
+  binary_elementwise_op->compute.range[0] = compressed_output_shape[5];
+  binary_elementwise_op->compute.range[1] = compressed_output_shape[4];
+  binary_elementwise_op->compute.range[2] = compressed_output_shape[3];
+  binary_elementwise_op->compute.range[3] = compressed_output_shape[2];
+  binary_elementwise_op->compute.range[4] = compressed_output_shape[1];
+  binary_elementwise_op->compute.tile[0] = 1;
+  binary_elementwise_op->compute.tile[1] = 1;
+
+  // Element counts of the output and the inputs, for operator profiling.
+  size_t input1_elements = 1;
+  for (size_t i = 0; i < num_input1_dims; i++) {
+    input1_elements *= input1_shape[i];
+  }
+  size_t input2_elements = 1;
+  for (size_t i = 0; i < num_input2_dims; i++) {
+    input2_elements *= input2_shape[i];
+  }
+  binary_elementwise_op->batch_size = output_elements;
+  binary_elementwise_op->input_height = input1_elements;
+  binary_elementwise_op->input_width = input2_elements;
+
+  binary_elementwise_op->state = xnn_run_state_ready;
+
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_setup_add_nd_q8(
+    xnn_operator_t add_op,
+    size_t num_input1_dims,
+    const size_t* input1_shape,
+    size_t num_input2_dims,
+    const size_t* input2_shape,
+    const uint8_t* input1,
+    const uint8_t* input2,
+    uint8_t* output,
+    pthreadpool_t threadpool)
+{
+  return setup_binary_elementwise_nd(
+    add_op, xnn_operator_type_add_nd_q8,
+    num_input1_dims, input1_shape,
+    num_input2_dims, input2_shape,
+    input1, input2, output,
+    0 /* log2(sizeof(uint8_t)) */,
+    &add_op->q8_add_params, &add_op->swapped_params.q8_add_params, sizeof(add_op->q8_add_params),
+    "Add (ND, Q8)");
+}
+
+enum xnn_status xnn_setup_multiply_nd_q8(
+    xnn_operator_t multiply_op,
+    size_t num_input1_dims,
+    const size_t* input1_shape,
+    size_t num_input2_dims,
+    const size_t* input2_shape,
+    const uint8_t* input1,
+    const uint8_t* input2,
+    uint8_t* output,
+    pthreadpool_t threadpool)
+{
+  return setup_binary_elementwise_nd(
+    multiply_op, xnn_operator_type_multiply_nd_q8,
+    num_input1_dims, input1_shape,
+    num_input2_dims, input2_shape,
+    input1, input2, output,
+    0 /* log2(sizeof(uint8_t)) */,
+    &multiply_op->q8_gemm_params, &multiply_op->swapped_params.q8_gemm_params, sizeof(multiply_op->q8_gemm_params),
+    "Multiply (ND, Q8)");
+}
+
+static enum xnn_status setup_binary_elementwise_nd_f32(
+    xnn_operator_t binary_elementwise_op,
+    enum xnn_operator_type expected_operator_type,
+    size_t num_input1_dims,
+    const size_t* input1_shape,
+    size_t num_input2_dims,
+    const size_t* input2_shape,
+    const float* input1,
+    const float* input2,
+    float* output,
+    const char* operator_name)
+{
+  return setup_binary_elementwise_nd(
+    binary_elementwise_op, expected_operator_type,
+    num_input1_dims, input1_shape,
+    num_input2_dims, input2_shape,
+    input1, input2, output,
+    2 /* log2(sizeof(float)) */,
+    &binary_elementwise_op->f32_output_params, &binary_elementwise_op->f32_output_params,
+    sizeof(binary_elementwise_op->f32_output_params),
+    operator_name);
+}
+
+enum xnn_status xnn_setup_add_nd_f32(
+    xnn_operator_t add_op,
+    size_t num_input1_dims,
+    const size_t* input1_shape,
+    size_t num_input2_dims,
+    const size_t* input2_shape,
+    const float* input1,
+    const float* input2,
+    float* output,
+    pthreadpool_t threadpool)
+{
+  return setup_binary_elementwise_nd_f32(
+    add_op, xnn_operator_type_add_nd_f32,
+    num_input1_dims, input1_shape, num_input2_dims, input2_shape,
+    input1, input2, output,
+    "Add (ND, F32)");
+}
+
+enum xnn_status xnn_setup_divide_nd_f32(
+    xnn_operator_t divide_op,
+    size_t num_input1_dims,
+    const size_t* input1_shape,
+    size_t num_input2_dims,
+    const size_t* input2_shape,
+    const float* input1,
+    const float* input2,
+    float* output,
+    pthreadpool_t threadpool)
+{
+  return setup_binary_elementwise_nd_f32(
+    divide_op, xnn_operator_type_divide_nd_f32,
+    num_input1_dims, input1_shape, num_input2_dims, input2_shape,
+    input1, input2, output,
+    "Divide (ND, F32)");
+}
+
+enum xnn_status xnn_setup_maximum_nd_f32(
+    xnn_operator_t maximum_op,
+    size_t num_input1_dims,
+    const size_t* input1_shape,
+    size_t num_input2_dims,
+    const size_t* input2_shape,
+    const float* input1,
+    const float* input2,
+    float* output,
+    pthreadpool_t threadpool)
+{
+  return setup_binary_elementwise_nd_f32(
+    maximum_op, xnn_operator_type_maximum_nd_f32,
+    num_input1_dims, input1_shape, num_input2_dims, input2_shape,
+    input1, input2, output,
+    "Maximum (ND, F32)");
+}
+
+enum xnn_status xnn_setup_minimum_nd_f32(
+    xnn_operator_t minimum_op,
+    size_t num_input1_dims,
+    const size_t* input1_shape,
+    size_t num_input2_dims,
+    const size_t* input2_shape,
+    const float* input1,
+    const float* input2,
+    float* output,
+    pthreadpool_t threadpool)
+{
+  return setup_binary_elementwise_nd_f32(
+    minimum_op, xnn_operator_type_minimum_nd_f32,
+    num_input1_dims, input1_shape, num_input2_dims, input2_shape,
+    input1, input2, output,
+    "Minimum (ND, F32)");
+}
+
+enum xnn_status xnn_setup_multiply_nd_f32(
+    xnn_operator_t multiply_op,
+    size_t num_input1_dims,
+    const size_t* input1_shape,
+    size_t num_input2_dims,
+    const size_t* input2_shape,
+    const float* input1,
+    const float* input2,
+    float* output,
+    pthreadpool_t threadpool)
+{
+  return setup_binary_elementwise_nd_f32(
+    multiply_op, xnn_operator_type_multiply_nd_f32,
+    num_input1_dims, input1_shape, num_input2_dims, input2_shape,
+    input1, input2, output,
+    "Multiply (ND, F32)");
+}
+
+enum xnn_status xnn_setup_subtract_nd_f32(
+    xnn_operator_t subtract_op,
+    size_t num_input1_dims,
+    const size_t* input1_shape,
+    size_t num_input2_dims,
+    const size_t* input2_shape,
+    const float* input1,
+    const float* input2,
+    float* output,
+    pthreadpool_t threadpool)
+{
+  return setup_binary_elementwise_nd_f32(
+    subtract_op, xnn_operator_type_subtract_nd_f32,
+    num_input1_dims, input1_shape, num_input2_dims, input2_shape,
+    input1, input2, output,
+    "Subtract (ND, F32)");
+}
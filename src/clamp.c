@@ -11,6 +11,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include <fp16.h>
+
 #include <xnnpack.h>
 #include <xnnpack/allocator.h>
 #include <xnnpack/operator.h>
@@ -91,6 +93,94 @@ error:
   return status;
 }
 
+enum xnn_status xnn_create_clamp_nc_f16(
+    size_t channels,
+    size_t input_stride,
+    size_t output_stride,
+    float output_min,
+    float output_max,
+    uint32_t flags,
+    xnn_operator_t* clamp_op_out)
+{
+  xnn_operator_t clamp_op = NULL;
+  enum xnn_status status = xnn_status_uninitialized;
+
+  if (!xnn_params.initialized) {
+    xnn_log_error("failed to create Clamp operator: XNNPACK is not initialized");
+    goto error;
+  }
+
+  status = xnn_status_invalid_parameter;
+
+  if (channels == 0) {
+    xnn_log_error(
+      "failed to create Clamp operator with %zu channels: number of channels must be non-zero", channels);
+    goto error;
+  }
+
+  if (input_stride < channels) {
+    xnn_log_error(
+      "failed to create Clamp operator with input element stride of %zu: "
+      "stride must be at least as large as the number of channels (%zu)",
+      input_stride, channels);
+    goto error;
+  }
+
+  if (output_stride < channels) {
+    xnn_log_error(
+      "failed to create Clamp operator with output element stride of %zu: "
+      "stride must be at least as large as the number of channels (%zu)",
+      output_stride, channels);
+    goto error;
+  }
+
+  if (isnan(output_min)) {
+    xnn_log_error(
+      "failed to create Clamp operator with NaN output lower bound: lower bound must be non-NaN");
+    goto error;
+  }
+
+  if (isnan(output_max)) {
+    xnn_log_error(
+      "failed to create Clamp operator with NaN output upper bound: upper bound must be non-NaN");
+    goto error;
+  }
+
+  const struct xnn_f16_output_params output_params = xnn_compute_f16_output_params(1.0f, output_min, output_max);
+  if (fp16_ieee_to_fp32_value(output_params.min) >= fp16_ieee_to_fp32_value(output_params.max)) {
+    xnn_log_error(
+      "failed to create Clamp operator with [%.7g, %.7g] output range: "
+      "lower bound must be below upper bound in half precision",
+      output_min, output_max);
+    goto error;
+  }
+
+  status = xnn_status_out_of_memory;
+
+  clamp_op = xnn_allocate_zero_memory(sizeof(struct xnn_operator));
+  if (clamp_op == NULL) {
+    xnn_log_error("failed to allocate %zu bytes for Clamp operator descriptor", sizeof(struct xnn_operator));
+    goto error;
+  }
+
+  clamp_op->channels = channels;
+  clamp_op->input_pixel_stride = input_stride;
+  clamp_op->output_pixel_stride = output_stride;
+  clamp_op->f16_output_params = output_params;
+
+  clamp_op->type = xnn_operator_type_clamp_f16;
+  clamp_op->ukernel.type = xnn_ukernel_type_clamp;
+
+  clamp_op->state = xnn_run_state_invalid;
+
+  *clamp_op_out = clamp_op;
+  return xnn_status_success;
+
+error:
+  xnn_delete_operator(clamp_op);
+  return status;
+}
+
 enum xnn_status xnn_create_clamp_nc_f32(
     size_t channels,
     size_t input_stride,
@@ -200,6 +290,8 @@ enum xnn_status xnn_setup_clamp_nc_u8(
     return xnn_status_success;
   }
 
+  clamp_op->batch_size = batch_size;
+
   const size_t channels = clamp_op->channels;
   const size_t input_stride = clamp_op->input_pixel_stride;
   const size_t output_stride = clamp_op->output_pixel_stride;
@@ -237,6 +329,68 @@ enum xnn_status xnn_setup_clamp_nc_u8(
   return xnn_status_success;
 }
 
+enum xnn_status xnn_setup_clamp_nc_f16(
+    xnn_operator_t clamp_op,
+    size_t batch_size,
+    const void* input,
+    void* output,
+    pthreadpool_t threadpool)
+{
+  if (clamp_op->type != xnn_operator_type_clamp_f16) {
+    xnn_log_error("failed to setup Clamp (F16) operator: operator type mismatch");
+    return xnn_status_invalid_parameter;
+  }
+  clamp_op->state = xnn_run_state_invalid;
+
+  if (!xnn_params.initialized) {
+    xnn_log_error("failed to setup Clamp operator: XNNPACK is not initialized");
+    return xnn_status_uninitialized;
+  }
+
+  if (batch_size == 0) {
+    clamp_op->state = xnn_run_state_skip;
+    return xnn_status_success;
+  }
+
+  clamp_op->batch_size = batch_size;
+
+  const size_t channels = clamp_op->channels;
+  const size_t input_stride = clamp_op->input_pixel_stride;
+  const size_t output_stride = clamp_op->output_pixel_stride;
+  if ((((input_stride ^ channels) | (output_stride ^ channels)) == 0) || batch_size == 1) {
+    const size_t block_size = 4096;
+    clamp_op->context.univector_contiguous = (struct univector_contiguous_context) {
+      .x = input,
+      .x_stride = input_stride * sizeof(uint16_t),
+      .y = output,
+      .y_stride = output_stride * sizeof(uint16_t),
+      .ukernel = xnn_params.f16.clamp,
+      .params.f16_output = clamp_op->f16_output_params,
+    };
+    clamp_op->compute.type = xnn_parallelization_type_1d_tile_1d;
+    clamp_op->compute.task_1d_tile_1d = (pthreadpool_task_1d_tile_1d_t) xnn_compute_univector_contiguous;
+    clamp_op->compute.range[0] = batch_size * channels * sizeof(uint16_t);
+    clamp_op->compute.tile[0] = block_size;
+  } else {
+    clamp_op->context.univector_strided = (struct univector_strided_context) {
+      .n = channels * sizeof(uint16_t),
+      .x = input,
+      .x_stride = input_stride * sizeof(uint16_t),
+      .y = output,
+      .y_stride = output_stride * sizeof(uint16_t),
+      .ukernel = xnn_params.f16.clamp,
+      .params.f16_output = clamp_op->f16_output_params,
+    };
+    clamp_op->compute.type = xnn_parallelization_type_1d_tile_1d;
+    clamp_op->compute.task_1d_tile_1d = (pthreadpool_task_1d_tile_1d_t) xnn_compute_univector_strided;
+    clamp_op->compute.range[0] = batch_size;
+    clamp_op->compute.tile[0] = 1;
+  }
+  clamp_op->state = xnn_run_state_ready;
+
+  return xnn_status_success;
+}
+
 enum xnn_status xnn_setup_clamp_nc_f32(
     xnn_operator_t clamp_op,
     size_t batch_size,
@@ -260,6 +414,8 @@ enum xnn_status xnn_setup_clamp_nc_f32(
     return xnn_status_success;
   }
 
+  clamp_op->batch_size = batch_size;
+
   const size_t channels = clamp_op->channels;
   const size_t input_stride = clamp_op->input_pixel_stride;
   const size_t output_stride = clamp_op->output_pixel_stride;
@@ -21,6 +21,7 @@
 #include <xnnpack/pack.h>
 #include <xnnpack/params.h>
 #include <xnnpack/indirection.h>
+#include <xnnpack/sparse-weights.h>
 
 
 static inline size_t compute_output_dimension(
@@ -142,17 +143,17 @@ enum xnn_status xnn_create_convolution2d_spnchw_f32(
   enum xnn_ukernel_type ukernel_type;
   struct spchw_dwconv_parameters* dwconv_parameters = NULL;
   // Supported cases:
-  // + 1x1 convolution (no groups)
+  // + 1x1 convolution, including grouped, strided, and padded 1x1 convolution
   // + 3x3 stride-2 with 3 input channels and NHWC input layout
-  // + 3x3 stride-2 depthwise convolution with horizontal padding 1 & no vertical padding
-  // - 3x3 stride-1 depthwise convolution with horizontal padding 1 & no vertical padding
-  // - 5x5 stride-2 depthwise convolution with horizontal padding 2 & no vertical padding
-  // - 5x5 stride-1 depthwise convolution with horizontal padding 2 & no vertical padding
-  const bool any_padding = (input_padding_left | input_padding_top | input_padding_right | input_padding_bottom) != 0;
-  const bool is_1x1 = kernel_width == 1 && kernel_height == 1 && subsampling_height == 1 && subsampling_width == 1;
+  // + 3x3 stride-2 depthwise convolution with horizontal padding 1 & any vertical padding
+  // + 3x3 stride-1 depthwise convolution with horizontal padding 1 & any vertical padding
+  // + 5x5 stride-2 depthwise convolution with horizontal padding 2 & any vertical padding
+  // + 5x5 stride-1 depthwise convolution with horizontal padding 2 & any vertical padding
+  const bool is_1x1 = kernel_width == 1 && kernel_height == 1;
   const bool is_3x3 = kernel_width == 3 && kernel_height == 3 && dilation_height == 1 && dilation_width == 1;
+  const bool is_5x5 = kernel_width == 5 && kernel_height == 5 && dilation_height == 1 && dilation_width == 1;
   const bool nhwc_input = (flags & XNN_FLAG_INPUT_NHWC) != 0;
-  if (is_1x1 && !any_padding && !nhwc_input && groups == 1 && xnn_params.f32.spmm.ukernel != NULL) {
+  if (is_1x1 && !nhwc_input && xnn_params.f32.spmm.ukernel != NULL) {
     ukernel_type = xnn_ukernel_type_spmm;
   } else if (is_3x3 && subsampling_height == 2 && subsampling_width == 2 &&
     input_padding_top == 1 && input_padding_left == 1 && input_padding_bottom == 1 && input_padding_right == 1 &&
@@ -160,17 +161,29 @@ enum xnn_status xnn_create_convolution2d_spnchw_f32(
   {
     ukernel_type = xnn_ukernel_type_dconv2d_hwc2spchw;
   } else if (is_3x3 && subsampling_height == 1 && subsampling_width == 1 &&
-    input_padding_top == 0 && input_padding_left == 1 && input_padding_bottom == 0 && input_padding_right == 1 &&
+    input_padding_left == 1 && input_padding_right == 1 &&
     !nhwc_input && group_input_channels == 1 && group_output_channels == 1 && xnn_params.f32.spchw_dwconv3x3.ukernel != NULL)
   {
     ukernel_type = xnn_ukernel_type_dwconv;
     dwconv_parameters = &xnn_params.f32.spchw_dwconv3x3;
   } else if (is_3x3 && subsampling_height == 2 && subsampling_width == 2 &&
-    input_padding_top == 0 && input_padding_left == 1 && input_padding_bottom == 0 && input_padding_right == 1 &&
+    input_padding_left == 1 && input_padding_right == 1 &&
     !nhwc_input && group_input_channels == 1 && group_output_channels == 1 && xnn_params.f32.spchw_dwconv3x3s2.ukernel != NULL)
   {
     ukernel_type = xnn_ukernel_type_dwconv;
     dwconv_parameters = &xnn_params.f32.spchw_dwconv3x3s2;
+  } else if (is_5x5 && subsampling_height == 1 && subsampling_width == 1 &&
+    input_padding_left == 2 && input_padding_right == 2 &&
+    !nhwc_input && group_input_channels == 1 && group_output_channels == 1 && xnn_params.f32.spchw_dwconv5x5.ukernel != NULL)
+  {
+    ukernel_type = xnn_ukernel_type_dwconv;
+    dwconv_parameters = &xnn_params.f32.spchw_dwconv5x5;
+  } else if (is_5x5 && subsampling_height == 2 && subsampling_width == 2 &&
+    input_padding_left == 2 && input_padding_right == 2 &&
+    !nhwc_input && group_input_channels == 1 && group_output_channels == 1 && xnn_params.f32.spchw_dwconv5x5s2.ukernel != NULL)
+  {
+    ukernel_type = xnn_ukernel_type_dwconv;
+    dwconv_parameters = &xnn_params.f32.spchw_dwconv5x5s2;
   } else {
     xnn_log_error(
       "failed to create Convolution operator: only selected Convolution parameters are supported");
@@ -190,74 +203,24 @@ enum xnn_status xnn_create_convolution2d_spnchw_f32(
     {
       assert(kernel_height == 1);
       assert(kernel_width == 1);
-      assert(groups == 1);
 
-      size_t num_nonzeroes = 0;
-      size_t num_nonzero_blocks2 = 0;
-      size_t num_nonzero_blocks4 = 0;
-      for (size_t oc = 0; oc < round_down_po2(group_output_channels, 4); oc += 4) {
-        for (size_t ic = 0; ic < group_input_channels; ic++) {
-          const size_t row0_nonzero = (size_t) (kernel[oc * group_input_channels + ic] != 0.0f);
-          const size_t row1_nonzero = (size_t) (kernel[(oc + 1) * group_input_channels + ic] != 0.0f);
-          const size_t row2_nonzero = (size_t) (kernel[(oc + 2) * group_input_channels + ic] != 0.0f);
-          const size_t row3_nonzero = (size_t) (kernel[(oc + 3) * group_input_channels + ic] != 0.0f);
-          num_nonzeroes += row0_nonzero + row1_nonzero + row2_nonzero + row3_nonzero;
-          num_nonzero_blocks2 += (row0_nonzero | row1_nonzero) + (row2_nonzero | row3_nonzero);
-          num_nonzero_blocks4 += (row0_nonzero | row1_nonzero | row2_nonzero | row3_nonzero);
-        }
-      }
-      const size_t num_block4_nonzeroes = num_nonzeroes;
-      for (size_t oc = round_down_po2(group_output_channels, 4); oc < round_down_po2(group_output_channels, 2); oc += 2) {
-        for (size_t ic = 0; ic < group_input_channels; ic++) {
-          const size_t row0_nonzero = (size_t) (kernel[oc * group_input_channels + ic] != 0.0f);
-          const size_t row1_nonzero = (size_t) (kernel[(oc + 1) * group_input_channels + ic] != 0.0f);
-          num_nonzeroes += row0_nonzero + row1_nonzero;
-          num_nonzero_blocks2 += (row0_nonzero | row1_nonzero);
-        }
-      }
-      const size_t num_block2_nonzeroes = num_nonzeroes;
-      for (size_t oc = round_down_po2(group_output_channels, 2); oc < group_output_channels; oc++) {
-        for (size_t ic = 0; ic < group_input_channels; ic++) {
-          num_nonzeroes += (size_t) (kernel[oc * group_input_channels + ic] != 0.0f);
-        }
-      }
-      size_t output_channels_block_size = 1;
-      size_t num_output_channel_blocks = group_output_channels;
-      size_t num_nonzero_values = num_nonzeroes;
-      size_t num_nonzero_blocks = num_nonzeroes;
-      const struct spmm_parameters* spmm_parameters = &xnn_params.f32.spmm;
-      if (num_block4_nonzeroes * 5 >= num_nonzero_blocks4 * 18 && xnn_params.f32.spmm4.ukernel != NULL) {
-        // 4-channel blocks have 90%+ non-zeroes
-
-        output_channels_block_size = 4;
-        num_output_channel_blocks = num_output_channel_blocks / 4 + num_output_channel_blocks % 4;
-        spmm_parameters = &xnn_params.f32.spmm4;
-        // Non-zeroes which don't fit into whole 4-channel blocks, processed one-by-one
-        const size_t num_remaining_nonzeroes = num_nonzeroes - num_block4_nonzeroes;
-        num_nonzero_values = num_nonzero_blocks4 * 4 + num_remaining_nonzeroes;
-        num_nonzero_blocks = num_nonzero_blocks4 + num_remaining_nonzeroes;
-      } else if (num_block2_nonzeroes * 5 >= num_nonzero_blocks2 * 9 && xnn_params.f32.spmm2.ukernel != NULL) {
-        // 2-channel blocks have 90%+ non-zeroes
-
-        output_channels_block_size = 2;
-        num_output_channel_blocks = num_output_channel_blocks / 2 + num_output_channel_blocks % 2;
-        spmm_parameters = &xnn_params.f32.spmm2;
-        // Non-zeroes which don't fit into whole 2-channel blocks, processed one-by-one
-        const size_t num_remaining_nonzeroes = num_nonzeroes - num_block2_nonzeroes;
-        num_nonzero_values = num_nonzero_blocks2 * 2 + num_remaining_nonzeroes;
-        num_nonzero_blocks = num_nonzero_blocks2 + num_remaining_nonzeroes;
-      }
+      struct xnn_sparse_weights_layout layout;
+      xnn_init_f32_sparse_weights_layout(groups, group_output_channels, group_input_channels, kernel, &layout);
 
       // Sparse representation of weights consists of four components:
-      // 1. An array of float values storing non-zero kernel elements, and all (group_output_channels) bias elements.
+      // 1. An array of float values storing non-zero kernel elements, and all (output_channels) bias elements.
       //    All elements within non-zero block are assumed to be non-zero.
       // 2. An array of int32_t values storing increment for input pointer after each processed tile. This array is
       //    derived from scaled difference in array 2 using parameters to setup function.
       // 3. An array of uint32_t values storing the number of non-zero kernel elements per each output channel.
       // 4. An array of int32_t values storing scaled [by sizeof(input element)] difference between input channels
       //    corresponding to successive non-zero blocks.
+      const size_t output_channels = groups * group_output_channels;
+      const size_t num_nonzero_values = layout.num_nonzero_values;
+      const size_t num_nonzero_blocks = layout.num_nonzero_blocks;
+      const size_t num_output_channel_blocks = layout.num_output_channel_blocks;
       const size_t packed_weights_size = num_output_channel_blocks * sizeof(uint32_t) +
-        (num_nonzero_blocks * 2) * sizeof(int32_t) + (num_nonzero_values + group_output_channels) * sizeof(float);
+        (num_nonzero_blocks * 2) * sizeof(int32_t) + (num_nonzero_values + output_channels) * sizeof(float);
 
       convolution_op->packed_weights = xnn_allocate_memory(packed_weights_size);
       if (convolution_op->packed_weights == NULL) {
@@ -269,85 +232,21 @@ enum xnn_status xnn_create_convolution2d_spnchw_f32(
       convolution_op->num_output_channel_blocks = num_output_channel_blocks;
 
       float* nonzero_values = convolution_op->packed_weights;
-      int32_t* input_increments = (int32_t*) (nonzero_values + num_nonzero_values + group_output_channels);
+      int32_t* input_increments = (int32_t*) (nonzero_values + num_nonzero_values + output_channels);
       uint32_t* output_channel_nonzeros = (uint32_t*) (input_increments + num_nonzero_blocks);
       int32_t* input_channel_diffs = (int32_t*) (output_channel_nonzeros + num_output_channel_blocks);
-      memset(output_channel_nonzeros, 0, num_output_channel_blocks * sizeof(uint32_t));
 
-      status = xnn_status_unsupported_parameter;
-
-      size_t first_ic = 0, last_ic = 0;
-      bool first_nonzero = true;
-      for (size_t ocb = 0; ocb < round_down_po2(group_output_channels, output_channels_block_size); ocb += output_channels_block_size) {
-        for (size_t oco = 0; oco < output_channels_block_size; oco++) {
-          *nonzero_values++ = bias[ocb + oco];
-        }
-        for (size_t ic = 0; ic < group_input_channels; ic++) {
-          bool is_nonzero_block = false;
-          for (size_t oco = 0; oco < output_channels_block_size; oco++) {
-            is_nonzero_block |= (kernel[(ocb + oco) * group_input_channels + ic] != 0.0f);
-          }
-          if (is_nonzero_block) {
-            for (size_t oco = 0; oco < output_channels_block_size; oco++) {
-              *nonzero_values++ = kernel[(ocb + oco) * group_input_channels + ic];
-            }
-            if (first_nonzero) {
-              first_ic = ic;
-            } else {
-              const int64_t diff = (int64_t) ((uint64_t) ic - (uint64_t) last_ic) * (int64_t) sizeof(float);
-              if (diff != (int64_t) (int32_t) diff) {
-                xnn_log_error("failed to convert kernel to sparse representation: "
-                  "scaled difference in input channels exceeds int32_t range");
-                goto error;
-              }
-              *input_channel_diffs++ = (int32_t) diff;
-            }
-            first_nonzero = false;
-            last_ic = ic;
-            *output_channel_nonzeros += 1;
-          }
-        }
-        output_channel_nonzeros += 1;
-      }
-      for (size_t oc = round_down_po2(group_output_channels, output_channels_block_size); oc < group_output_channels; oc++) {
-        *nonzero_values++ = bias[oc];
-        for (size_t ic = 0; ic < group_input_channels; ic++) {
-          const float weight = kernel[oc * group_input_channels + ic];
-          if (weight != 0.0f) {
-            *nonzero_values++ = weight;
-            if (first_nonzero) {
-              first_ic = ic;
-            } else {
-              const int64_t diff = (int64_t) ((uint64_t) ic - (uint64_t) last_ic) * (int64_t) sizeof(float);
-              if (diff != (int64_t) (int32_t) diff) {
-                xnn_log_error("failed to convert kernel to sparse representation: "
-                  "scaled difference in input channels exceeds int32_t range");
-                goto error;
-              }
-              *input_channel_diffs++ = (int32_t) diff;
-            }
-            first_nonzero = false;
-            last_ic = ic;
-            *output_channel_nonzeros += 1;
-          }
-        }
-        output_channel_nonzeros += 1;
-      }
-      // If there are any non-zero elements, we have to return to the initial input channel.
-      if (!first_nonzero) {
-        const int64_t diff = (int64_t) ((uint64_t) first_ic - (uint64_t) last_ic) * (int64_t) sizeof(float);
-        if (diff != (int64_t) (int32_t) diff) {
-          xnn_log_error("failed to convert kernel to sparse representation: "
-            "scaled difference in input channels exceeds int32_t range");
-          goto error;
-        }
-        *input_channel_diffs++ = (int32_t) diff;
+      status = xnn_pack_f32_sparse_weights(
+        groups, group_output_channels, group_input_channels,
+        kernel, bias, &layout, sizeof(float),
+        nonzero_values, output_channel_nonzeros, input_channel_diffs, &convolution_op->first_input_channel);
+      if (status != xnn_status_success) {
+        goto error;
       }
-      convolution_op->first_input_channel = first_ic;
 
       convolution_op->ukernel.spmm = (struct xnn_ukernel_spmm) {
-        .function = spmm_parameters->ukernel,
-        .mr = spmm_parameters->mr,
+        .function = layout.spmm_parameters->ukernel,
+        .mr = layout.spmm_parameters->mr,
       };
 
       break;
@@ -515,6 +414,8 @@ static enum xnn_status setup_convolution2d_spnchw(
   convolution_op->input_height = input_height;
   convolution_op->input_width = input_width;
   convolution_op->input = input;
+  convolution_op->output_height = output_height;
+  convolution_op->output_width = output_width;
   convolution_op->output = output;
 
   switch (convolution_op->ukernel.type) {
@@ -528,8 +429,9 @@ static enum xnn_status setup_convolution2d_spnchw(
       convolution_op->num_nonzero_blocks = num_nonzero_blocks;
       convolution_op->num_output_channel_blocks = num_output_channel_blocks;
 
+      const size_t output_channels = groups * group_output_channels;
       float* nonzero_values = convolution_op->packed_weights;
-      int32_t* input_increments = (int32_t*) (nonzero_values + num_nonzero_values + convolution_op->group_output_channels);
+      int32_t* input_increments = (int32_t*) (nonzero_values + num_nonzero_values + output_channels);
       uint32_t* output_channel_nonzeros = (uint32_t*) (input_increments + num_nonzero_blocks);
       int32_t* input_channel_diffs = (int32_t*) (output_channel_nonzeros + num_output_channel_blocks);
 
@@ -538,7 +440,12 @@ static enum xnn_status setup_convolution2d_spnchw(
       // int32_t* input_increments = (int32_t*) (input_channel_diffs + num_nonzero_blocks);
       // const void* packed_weights = (const void*) (input_increments + num_nonzero_blocks);
 
-      const size_t input_size = input_height * input_width;
+      // With subsampling or padding, the micro-kernel reads a copy of the input with only the pixels used by the
+      // Convolution, gathered at run time into the packed_input buffer.
+      const bool is_subsampled = (convolution_op->stride_height | convolution_op->stride_width) != 1 ||
+        (convolution_op->padding_top | convolution_op->padding_right |
+         convolution_op->padding_bottom | convolution_op->padding_left) != 0;
+      const size_t input_size = is_subsampled ? output_height * output_width : input_height * input_width;
       for (size_t i = 0; i < num_nonzero_blocks; i++) {
         const int32_t diff = input_channel_diffs[i];
         const int64_t increment = (int64_t) diff * input_size;
@@ -551,8 +458,8 @@ static enum xnn_status setup_convolution2d_spnchw(
       }
 
       convolution_op->context.spmm = (struct spmm_context) {
-          .n = group_output_channels,
-          .a = input + (convolution_op->first_input_channel * input_size * sizeof(float)),
+          .n = output_channels,
+          .a = input + (convolution_op->first_input_channel * input_size << log2_input_element_size),
           .packed_weights = nonzero_values,
           .input_increments = input_increments,
           .output_channel_nonzeros = output_channel_nonzeros,
@@ -563,6 +470,39 @@ static enum xnn_status setup_convolution2d_spnchw(
       };
       memcpy(&convolution_op->context.spmm.params, params, sizeof(convolution_op->context.spmm.params));
 
+      if (is_subsampled) {
+        const size_t input_channels = groups * group_input_channels;
+        const size_t packed_a_batch_stride = input_channels * input_size << log2_input_element_size;
+        const size_t packed_input_size = batch_size * packed_a_batch_stride + XNN_EXTRA_BYTES;
+        if (packed_input_size > convolution_op->packed_input_size) {
+          xnn_release_memory(convolution_op->packed_input);
+          convolution_op->packed_input_size = 0;
+          convolution_op->packed_input = xnn_allocate_memory(packed_input_size);
+          if (convolution_op->packed_input == NULL) {
+            xnn_log_error("failed to allocate %zu bytes for subsampled input", packed_input_size);
+            return xnn_status_out_of_memory;
+          }
+          convolution_op->packed_input_size = packed_input_size;
+        }
+
+        convolution_op->context.spmm.a = (const void*) ((uintptr_t) convolution_op->packed_input +
+          (convolution_op->first_input_channel * input_size << log2_input_element_size));
+        convolution_op->context.spmm.batched_a_stride = packed_a_batch_stride;
+        convolution_op->context.spmm.input = input;
+        convolution_op->context.spmm.input_height = input_height;
+        convolution_op->context.spmm.input_width = input_width;
+        convolution_op->context.spmm.input_channels = input_channels;
+        convolution_op->context.spmm.input_channel_stride = input_height * input_width << log2_input_element_size;
+        convolution_op->context.spmm.input_batch_stride = input_batch_stride << log2_input_element_size;
+        convolution_op->context.spmm.output_width = output_width;
+        convolution_op->context.spmm.subsampling_height = convolution_op->stride_height;
+        convolution_op->context.spmm.subsampling_width = convolution_op->stride_width;
+        convolution_op->context.spmm.padding_top = convolution_op->padding_top;
+        convolution_op->context.spmm.padding_left = convolution_op->padding_left;
+        convolution_op->context.spmm.packed_a = convolution_op->packed_input;
+        convolution_op->context.spmm.packed_a_channel_stride = input_size << log2_input_element_size;
+      }
+
       const size_t mr = convolution_op->ukernel.spmm.mr;
       size_t mc = input_size;
       if (num_threads > 1) {
@@ -573,7 +513,8 @@ static enum xnn_status setup_convolution2d_spnchw(
         }
       }
       convolution_op->compute.type = xnn_parallelization_type_2d_tile_1d;
-      convolution_op->compute.task_2d_tile_1d = (pthreadpool_task_2d_tile_1d_t) xnn_compute_spmm;
+      convolution_op->compute.task_2d_tile_1d = is_subsampled ?
+        (pthreadpool_task_2d_tile_1d_t) xnn_compute_subsampled_spmm : (pthreadpool_task_2d_tile_1d_t) xnn_compute_spmm;
       convolution_op->compute.range[0] = batch_size;
       convolution_op->compute.range[1] = input_size;
       convolution_op->compute.tile[0] = mc;
@@ -630,10 +571,47 @@ static enum xnn_status setup_convolution2d_spnchw(
     }
     case xnn_ukernel_type_dwconv:
     {
+      const size_t kernel_height = convolution_op->kernel_height;
+      const size_t stride_height = convolution_op->stride_height;
+      const size_t padding_top = convolution_op->padding_top;
+      const size_t output_y_start = min(divide_round_up(padding_top, stride_height), output_height);
+      const size_t output_y_end = max(output_y_start, min(output_height,
+        input_height + padding_top >= kernel_height ? (input_height + padding_top - kernel_height) / stride_height + 1 : 0));
+      size_t padded_rows = 0;
+      if (output_y_start != 0) {
+        padded_rows = (output_y_start - 1) * stride_height + kernel_height;
+      }
+      if (output_y_end != output_height) {
+        padded_rows = max(padded_rows, (output_height - output_y_end - 1) * stride_height + kernel_height);
+      }
+      const size_t padded_input_stride = padded_rows * input_width << log2_input_element_size;
+      if (padded_rows != 0) {
+        const size_t packed_input_size = batch_size * groups * padded_input_stride + XNN_EXTRA_BYTES;
+        if (packed_input_size > convolution_op->packed_input_size) {
+          xnn_release_memory(convolution_op->packed_input);
+          convolution_op->packed_input_size = 0;
+          convolution_op->packed_input = xnn_allocate_memory(packed_input_size);
+          if (convolution_op->packed_input == NULL) {
+            xnn_log_error("failed to allocate %zu bytes for padded input", packed_input_size);
+            return xnn_status_out_of_memory;
+          }
+          convolution_op->packed_input_size = packed_input_size;
+        }
+      }
+
       xnn_update_f32_spchw_params((union xnn_f32_spchw_params*) params, input_width);
       convolution_op->context.dwconv2d = (struct dwconv2d_context) {
         .output_height = output_height,
+        .input_height = input_height,
         .input_width = input_width,
+        .groups = groups,
+        .kernel_height = kernel_height,
+        .subsampling_height = stride_height,
+        .input_padding_top = padding_top,
+        .output_y_start = output_y_start,
+        .output_y_end = output_y_end,
+        .padded_input = convolution_op->packed_input,
+        .padded_input_stride = padded_input_stride,
         .input = input,
         .input_channel_stride = input_height * input_width << log2_input_element_size,
         .input_batch_stride = input_batch_stride << log2_input_element_size,
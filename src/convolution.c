@@ -14,6 +14,8 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <fp16.h>
+
 #include <xnnpack.h>
 #include <xnnpack/allocator.h>
 #include <xnnpack/operator.h>
@@ -22,8 +24,11 @@
 #include <xnnpack/compute.h>
 #include <xnnpack/math.h>
 #include <xnnpack/pack.h>
+#include <xnnpack/packed-weights.h>
 #include <xnnpack/params.h>
+#include <xnnpack/sparse-weights.h>
 #include <xnnpack/indirection.h>
+#include <xnnpack/shape-cache.h>
 
 
 static inline size_t compute_output_dimension(
@@ -41,13 +46,53 @@ static const struct dwconv_parameters* find_dwigemm_ukernel(
     const struct dwconv_parameters* ukernel,
     size_t num_ukernels)
 {
+  // Prefer a unipass micro-kernel with exactly kernel_size taps, and fall back to the multipass micro-kernel.
+  const struct dwconv_parameters* multipass_ukernel = NULL;
   while (num_ukernels-- != 0) {
-    if (ukernel->mr == kernel_size) {
-      return ukernel;
+    if (ukernel->qr == 0) {
+      if (ukernel->mr == kernel_size) {
+        return ukernel;
+      }
+    } else if (multipass_ukernel == NULL) {
+      multipass_ukernel = ukernel;
     }
     ukernel++;
   }
-  return NULL;
+  return multipass_ukernel;
+}
+
+// Transforms 3x3 kernels in [output channels][3][3][input channels] layout into the Winograd F(4x4, 3x3) domain,
+// U := G g G^T, and extracts the [output channels][input channels] matrix for one of the 36 transformed positions.
+static void transform_winograd_kernel(
+    size_t position,
+    size_t output_channels,
+    size_t input_channels,
+    const float* kernel,
+    float* transformed_kernel)
+{
+  static const float g[6][3] = {
+    {  1.0f / 4.0f,           0.0f,          0.0f },
+    { -1.0f / 6.0f,  -1.0f / 6.0f,  -1.0f / 6.0f },
+    { -1.0f / 6.0f,   1.0f / 6.0f,  -1.0f / 6.0f },
+    {  1.0f / 24.0f,  1.0f / 12.0f,  1.0f / 6.0f },
+    {  1.0f / 24.0f, -1.0f / 12.0f,  1.0f / 6.0f },
+    {          0.0f,          0.0f,          1.0f },
+  };
+  const float* g_row = g[position / 6];
+  const float* g_column = g[position % 6];
+
+  for (size_t oc = 0; oc < output_channels; oc++) {
+    for (size_t ic = 0; ic < input_channels; ic++) {
+      double u = 0.0;
+      for (size_t ky = 0; ky < 3; ky++) {
+        for (size_t kx = 0; kx < 3; kx++) {
+          u += (double) g_row[ky] * (double) g_column[kx] *
+            (double) kernel[((oc * 3 + ky) * 3 + kx) * input_channels + ic];
+        }
+      }
+      transformed_kernel[oc * input_channels + ic] = (float) u;
+    }
+  }
 }
 
 enum xnn_status xnn_create_convolution2d_nhwc_q8(
@@ -259,7 +304,7 @@ enum xnn_status xnn_create_convolution2d_nhwc_q8(
     case xnn_ukernel_type_dwconv:
     {
       assert(dwconv_parameters != NULL);
-      assert(dwconv_parameters->mr == kernel_size);
+      assert(dwconv_parameters->qr != 0 || dwconv_parameters->mr == kernel_size);
 
       const uint32_t c_stride = round_up_po2(groups, dwconv_parameters->cr);
       const size_t packed_weights_size = (sizeof(uint8_t) * kernel_size + sizeof(int32_t)) * c_stride;
@@ -283,11 +328,19 @@ enum xnn_status xnn_create_convolution2d_nhwc_q8(
           kernel, bias, convolution_op->packed_weights);
       }
 
-      convolution_op->ukernel.dwconv = (struct xnn_ukernel_dwconv) {
-        .unipass_function = dwconv_parameters->up,
-        .mr = dwconv_parameters->mr,
-        .qr = dwconv_parameters->qr,
-      };
+      if (dwconv_parameters->qr != 0) {
+        convolution_op->ukernel.dwconv = (struct xnn_ukernel_dwconv) {
+          .multipass_function = dwconv_parameters->mp,
+          .mr = dwconv_parameters->mr,
+          .qr = dwconv_parameters->qr,
+        };
+      } else {
+        convolution_op->ukernel.dwconv = (struct xnn_ukernel_dwconv) {
+          .unipass_function = dwconv_parameters->up,
+          .mr = dwconv_parameters->mr,
+          .qr = dwconv_parameters->qr,
+        };
+      }
 
       zero_size = sizeof(uint8_t) * c_stride + XNN_EXTRA_BYTES;
       break;
@@ -381,6 +434,7 @@ enum xnn_status xnn_create_convolution2d_nhwc_q8(
   convolution_op->group_output_channels = group_output_channels;
   convolution_op->input_pixel_stride = input_pixel_stride;
   convolution_op->output_pixel_stride = output_pixel_stride;
+  convolution_op->compact_indirection = (flags & XNN_FLAG_COMPACT_INDIRECTION) != 0;
 
   convolution_op->kernel_zero_point = kernel_zero_point;
 
@@ -402,7 +456,7 @@ error:
   return status;
 }
 
-enum xnn_status xnn_create_convolution2d_nhwc_f32(
+enum xnn_status xnn_create_convolution2d_nhwc_q8c(
     uint32_t input_padding_top,
     uint32_t input_padding_right,
     uint32_t input_padding_bottom,
@@ -418,14 +472,21 @@ enum xnn_status xnn_create_convolution2d_nhwc_f32(
     size_t group_output_channels,
     size_t input_pixel_stride,
     size_t output_pixel_stride,
-    const float* kernel,
-    const float* bias,
-    float output_min,
-    float output_max,
+    uint8_t input_zero_point,
+    float input_scale,
+    uint8_t kernel_zero_point,
+    const float* kernel_scale,
+    const uint8_t* kernel,
+    const int32_t* bias,
+    uint8_t output_zero_point,
+    float output_scale,
+    uint8_t output_min,
+    uint8_t output_max,
     uint32_t flags,
     xnn_operator_t* convolution_op_out)
 {
   xnn_operator_t convolution_op = NULL;
+  float* requantization_scale = NULL;
   enum xnn_status status = xnn_status_uninitialized;
 
   if (!xnn_params.initialized) {
@@ -498,22 +559,34 @@ enum xnn_status xnn_create_convolution2d_nhwc_f32(
     goto error;
   }
 
-  if (isnan(output_min)) {
+  if (input_scale <= 0.0f || !isnormal(input_scale)) {
     xnn_log_error(
-      "failed to create Convolution operator with NaN output lower bound: lower bound must be non-NaN");
+      "failed to create Convolution operator with %.7g input scale: scale must be finite, normalized, and positive",
+      input_scale);
     goto error;
   }
 
-  if (isnan(output_max)) {
+  for (size_t oc = 0; oc < output_channels; oc++) {
+    if (kernel_scale[oc] <= 0.0f || !isnormal(kernel_scale[oc])) {
+      xnn_log_error(
+        "failed to create Convolution operator with %.7g kernel scale in output channel #%zu: "
+        "scale must be finite, normalized, and positive",
+        kernel_scale[oc], oc);
+      goto error;
+    }
+  }
+
+  if (output_scale <= 0.0f || !isnormal(output_scale)) {
     xnn_log_error(
-      "failed to create Convolution operator with NaN output upper bound: upper bound must be non-NaN");
+      "failed to create Convolution operator with %.7g output scale: scale must be finite, normalized, and positive",
+      output_scale);
     goto error;
   }
 
   if (output_min >= output_max) {
     xnn_log_error(
-      "failed to create Convolution operator with [%.7g, %.7g] output range: "
-      "lower bound must be below upper bound",
+      "failed to create Convolution operator with [%" PRIu8 ", %" PRIu8 "] output range: "
+      "range min must be below range max",
       output_min, output_max);
     goto error;
   }
@@ -526,6 +599,8 @@ enum xnn_status xnn_create_convolution2d_nhwc_f32(
     goto error;
   }
 
+  status = xnn_status_unsupported_parameter;
+
   const uint32_t effective_kernel_height = (kernel_height - 1) * dilation_height + 1;
   const uint32_t effective_kernel_width = (kernel_width - 1) * dilation_width + 1;
 
@@ -557,6 +632,17 @@ enum xnn_status xnn_create_convolution2d_nhwc_f32(
       effective_kernel_width, effective_kernel_height, input_padding_left, input_padding_right);
   }
 
+  for (size_t oc = 0; oc < output_channels; oc++) {
+    const float convolution_scale = input_scale * kernel_scale[oc] / output_scale;
+    if (convolution_scale >= 1.0f) {
+      xnn_log_error(
+        "failed to create Convolution operator with %.7g input scale, %.7g kernel scale in output channel #%zu, "
+        "and %.7g output scale: convolution scale %.7g is greater or equal to 1.0",
+        input_scale, kernel_scale[oc], oc, output_scale, convolution_scale);
+      goto error;
+    }
+  }
+
   status = xnn_status_out_of_memory;
 
   convolution_op = xnn_allocate_zero_memory(sizeof(struct xnn_operator));
@@ -565,19 +651,26 @@ enum xnn_status xnn_create_convolution2d_nhwc_f32(
     goto error;
   }
 
+  // Requantization scales are only needed while packing, where they are stored next to the bias.
+  requantization_scale = xnn_allocate_memory(output_channels * sizeof(float));
+  if (requantization_scale == NULL) {
+    xnn_log_error("failed to allocate %zu bytes for requantization scales", output_channels * sizeof(float));
+    goto error;
+  }
+  for (size_t oc = 0; oc < output_channels; oc++) {
+    requantization_scale[oc] = input_scale * kernel_scale[oc] / output_scale;
+  }
+
   const size_t kernel_size = kernel_height * kernel_width;
 
   enum xnn_ukernel_type ukernel_type = xnn_ukernel_type_none;
   const struct dwconv_parameters* dwconv_parameters = NULL;
   const bool any_padding = (input_padding_left | input_padding_top | input_padding_right | input_padding_bottom) != 0;
-  const bool unit_subsampling = (subsampling_width | subsampling_height) == 1;
-  if (group_input_channels == 1 && group_output_channels == 1 && kernel_size == 1 && unit_subsampling && !any_padding) {
-    ukernel_type = xnn_ukernel_type_vmulcaddc;
-  } else if (group_input_channels == 1 && group_output_channels == 1 && (dwconv_parameters =
-               find_dwigemm_ukernel(kernel_size, xnn_params.f32.dwconv, XNN_MAX_F32_DWCONV_UKERNELS)) != NULL)
+  if (group_input_channels == 1 && group_output_channels == 1 && groups > 1 &&
+      (dwconv_parameters = find_dwigemm_ukernel(kernel_size, &xnn_params.q8c.dwconv, 1)) != NULL)
   {
     ukernel_type = xnn_ukernel_type_dwconv;
-  } else if (kernel_size == 1 && unit_subsampling && !any_padding) {
+  } else if (kernel_size == 1 && subsampling_height == 1 && subsampling_width == 1 && !any_padding) {
     ukernel_type = xnn_ukernel_type_gemm;
   } else {
     ukernel_type = xnn_ukernel_type_igemm;
@@ -585,33 +678,14 @@ enum xnn_status xnn_create_convolution2d_nhwc_f32(
 
   size_t zero_size = 0;
   switch (ukernel_type) {
-    case xnn_ukernel_type_vmulcaddc:
-    {
-      const uint32_t c_stride = round_up_po2(groups, xnn_params.f32.vmulcaddc.cr);
-      const size_t packed_weights_size = 2 * sizeof(float) * c_stride;
-      convolution_op->packed_weights = xnn_allocate_memory(packed_weights_size);
-      if (convolution_op->packed_weights == NULL) {
-        xnn_log_error("failed to allocate %zu bytes for packed weights", packed_weights_size);
-        goto error;
-      }
-
-      xnn_pack_f32_vmulcaddc_w(
-        groups, xnn_params.f32.vmulcaddc.cr,
-        kernel, bias, convolution_op->packed_weights);
-
-      convolution_op->ukernel.vmulcaddc = (struct xnn_ukernel_vmulcaddc) {
-        .function = xnn_params.f32.vmulcaddc.ukernel,
-        .mr = xnn_params.f32.vmulcaddc.mr,
-      };
-      break;
-    }
     case xnn_ukernel_type_dwconv:
     {
       assert(dwconv_parameters != NULL);
+      assert(dwconv_parameters->qr == 0);
       assert(dwconv_parameters->mr == kernel_size);
 
       const uint32_t c_stride = round_up_po2(groups, dwconv_parameters->cr);
-      const size_t packed_weights_size = (kernel_size + 1) * sizeof(float) * c_stride;
+      const size_t packed_weights_size = (sizeof(uint8_t) * kernel_size + sizeof(int32_t) + sizeof(float)) * c_stride;
       convolution_op->packed_weights = xnn_allocate_memory(packed_weights_size);
       if (convolution_op->packed_weights == NULL) {
         xnn_log_error("failed to allocate %zu bytes for packed weights", packed_weights_size);
@@ -619,15 +693,17 @@ enum xnn_status xnn_create_convolution2d_nhwc_f32(
       }
 
       if (flags & XNN_FLAG_DEPTHWISE_CONVOLUTION) {
-        xnn_pack_f32_dwconv_hwg_w(
+        xnn_pack_q8c_dwconv_hwg_w(
           kernel_height, kernel_width,
           groups, dwconv_parameters->cr,
-          kernel, bias, convolution_op->packed_weights);
+          input_zero_point, kernel_zero_point,
+          kernel, bias, requantization_scale, convolution_op->packed_weights);
       } else {
-        xnn_pack_f32_dwconv_ghw_w(
+        xnn_pack_q8c_dwconv_ghw_w(
           kernel_height, kernel_width,
           groups, dwconv_parameters->cr,
-          kernel, bias, convolution_op->packed_weights);
+          input_zero_point, kernel_zero_point,
+          kernel, bias, requantization_scale, convolution_op->packed_weights);
       }
 
       convolution_op->ukernel.dwconv = (struct xnn_ukernel_dwconv) {
@@ -636,65 +712,66 @@ enum xnn_status xnn_create_convolution2d_nhwc_f32(
         .qr = dwconv_parameters->qr,
       };
 
-      zero_size = sizeof(float) * c_stride;
+      zero_size = sizeof(uint8_t) * c_stride + XNN_EXTRA_BYTES;
       break;
     }
     case xnn_ukernel_type_gemm:
     case xnn_ukernel_type_igemm:
     {
-      const uint32_t nr = xnn_params.f32.gemm.nr;
-      const uint32_t kr = UINT32_C(1) << xnn_params.f32.gemm.log2_kr;
-      const uint32_t sr = UINT32_C(1) << xnn_params.f32.gemm.log2_sr;
+      const uint32_t nr = xnn_params.q8c.gemm.nr;
+      const uint32_t kr = UINT32_C(1) << xnn_params.q8c.gemm.log2_kr;
       const uint32_t n_stride = round_up(group_output_channels, nr);
       const uint32_t k_stride = round_up_po2(group_input_channels, kr);
 
-      const size_t packed_group_weights_size = (kernel_size * k_stride + 1) * sizeof(float) * n_stride;
+      const size_t packed_group_weights_size =
+        (sizeof(uint8_t) * kernel_size * k_stride + sizeof(int32_t) + sizeof(float)) * n_stride;
       convolution_op->packed_weights = xnn_allocate_memory(packed_group_weights_size * groups);
       if (convolution_op->packed_weights == NULL) {
         xnn_log_error("failed to allocate %zu bytes for packed weights", packed_group_weights_size * groups);
         goto error;
       }
-      memset(convolution_op->packed_weights, 0, packed_group_weights_size * groups);
+      memset(convolution_op->packed_weights, kernel_zero_point, packed_group_weights_size * groups);
 
       switch (ukernel_type) {
         case xnn_ukernel_type_gemm:
-          xnn_pack_f32_gemm_goi_w(
+          xnn_pack_q8c_gemm_goi_w(
               groups, group_output_channels, group_input_channels,
-              nr, kr, sr,
-              kernel, bias, convolution_op->packed_weights);
+              nr, kr,
+              input_zero_point, kernel_zero_point,
+              kernel, bias, requantization_scale, convolution_op->packed_weights);
           convolution_op->ukernel.gemm = (struct xnn_ukernel_gemm) {
-            .mr = xnn_params.f32.gemm.mr,
+            .mr = xnn_params.q8c.gemm.mr,
             .nr = nr,
             .kr = kr,
-            .default_function = xnn_params.f32.gemm.gemm,
-            .mr1_function = xnn_params.f32.gemm.gemm1,
+            .default_function = xnn_params.q8c.gemm.gemm,
           };
           break;
         case xnn_ukernel_type_igemm:
           if (flags & XNN_FLAG_DEPTHWISE_CONVOLUTION) {
-            xnn_pack_f32_conv_kgo_w(
-              groups, group_output_channels, kernel_size,
-              nr, kr,
-              kernel, bias, convolution_op->packed_weights);
+            xnn_pack_q8c_conv_kgo_w(
+                groups, group_output_channels, kernel_size,
+                nr, kr,
+                input_zero_point, kernel_zero_point,
+                kernel, bias, requantization_scale, convolution_op->packed_weights);
           } else {
-            xnn_pack_f32_conv_goki_w(
-              groups, group_output_channels, kernel_size, group_input_channels,
-              nr, kr, sr,
-              kernel, bias, convolution_op->packed_weights);
+            xnn_pack_q8c_conv_goki_w(
+                groups, group_output_channels, kernel_size, group_input_channels,
+                nr, kr,
+                input_zero_point, kernel_zero_point,
+                kernel, bias, requantization_scale, convolution_op->packed_weights);
           }
           convolution_op->ukernel.igemm = (struct xnn_ukernel_igemm) {
-            .mr = xnn_params.f32.gemm.mr,
+            .mr = xnn_params.q8c.gemm.mr,
             .nr = nr,
             .kr = kr,
-            .default_function = xnn_params.f32.gemm.igemm,
-            .mr1_function = xnn_params.f32.gemm.igemm1,
+            .default_function = xnn_params.q8c.gemm.igemm,
           };
           break;
         default:
           XNN_UNREACHABLE;
       }
 
-      zero_size = sizeof(float) * k_stride;
+      zero_size = sizeof(uint8_t) * k_stride + XNN_EXTRA_BYTES;
       break;
     }
     default:
@@ -702,11 +779,12 @@ enum xnn_status xnn_create_convolution2d_nhwc_f32(
   }
 
   if (any_padding) {
-    void* zero_buffer = xnn_allocate_zero_memory(zero_size);
+    void* zero_buffer = xnn_allocate_memory(zero_size);
     if (zero_buffer == NULL) {
       xnn_log_error("failed to allocate %zu bytes for zero padding", zero_size);
       goto error;
     }
+    memset(zero_buffer, input_zero_point, zero_size);
     convolution_op->zero_buffer = zero_buffer;
   }
 
@@ -726,113 +804,1201 @@ enum xnn_status xnn_create_convolution2d_nhwc_f32(
   convolution_op->group_output_channels = group_output_channels;
   convolution_op->input_pixel_stride = input_pixel_stride;
   convolution_op->output_pixel_stride = output_pixel_stride;
+  convolution_op->compact_indirection = (flags & XNN_FLAG_COMPACT_INDIRECTION) != 0;
 
-  convolution_op->f32_output_params = xnn_compute_f32_output_params(output_min, output_max);
+  convolution_op->kernel_zero_point = kernel_zero_point;
 
-  convolution_op->type = xnn_operator_type_convolution_f32;
+  convolution_op->q8c_gemm_params =
+    xnn_compute_q8c_gemm_params(kernel_zero_point, output_zero_point, output_min, output_max);
+
+  convolution_op->type = xnn_operator_type_convolution_q8c;
   convolution_op->ukernel.type = ukernel_type;
 
   convolution_op->state = xnn_run_state_invalid;
 
+  xnn_release_memory(requantization_scale);
   *convolution_op_out = convolution_op;
   return xnn_status_success;
 
 error:
+  xnn_release_memory(requantization_scale);
   xnn_delete_operator(convolution_op);
   return status;
 }
 
-static enum xnn_status setup_convolution2d_nhwc(
-  xnn_operator_t convolution_op,
-  size_t batch_size,
-  size_t input_height,
-  size_t input_width,
-  const void* input,
-  void* output,
-  uint32_t log2_input_element_size,
-  uint32_t log2_filter_element_size,
-  uint32_t bias_element_size,
-  uint32_t log2_output_element_size,
-  const void* params,
-  size_t num_threads)
+enum xnn_status xnn_create_convolution2d_nhwc_f16(
+    uint32_t input_padding_top,
+    uint32_t input_padding_right,
+    uint32_t input_padding_bottom,
+    uint32_t input_padding_left,
+    uint32_t kernel_height,
+    uint32_t kernel_width,
+    uint32_t subsampling_height,
+    uint32_t subsampling_width,
+    uint32_t dilation_height,
+    uint32_t dilation_width,
+    uint32_t groups,
+    size_t group_input_channels,
+    size_t group_output_channels,
+    size_t input_pixel_stride,
+    size_t output_pixel_stride,
+    const void* kernel,
+    const void* bias,
+    float output_min,
+    float output_max,
+    uint32_t flags,
+    xnn_operator_t* convolution_op_out)
 {
-  convolution_op->state = xnn_run_state_invalid;
+  xnn_operator_t convolution_op = NULL;
+  enum xnn_status status = xnn_status_uninitialized;
 
   if (!xnn_params.initialized) {
-    xnn_log_error("failed to setup Convolution operator: XNNPACK is not initialized");
-    return xnn_status_uninitialized;
+    xnn_log_error("failed to create Convolution operator: XNNPACK is not initialized");
+    goto error;
   }
 
-  if (input_width == 0 || input_height == 0) {
+  status = xnn_status_invalid_parameter;
+
+  if (kernel_width == 0 || kernel_height == 0) {
     xnn_log_error(
-      "failed to setup Convolution operator with %zux%zu input: input dimensions must be non-zero",
-      input_width, input_height);
-    return xnn_status_invalid_parameter;
+      "failed to create Convolution operator with %" PRIu32 "x%" PRIu32 " kernel: kernel dimensions must be non-zero",
+      kernel_width, kernel_height);
+    goto error;
   }
 
-  if (batch_size == 0) {
-    convolution_op->state = xnn_run_state_skip;
-    return xnn_status_success;
+  if (subsampling_width == 0 || subsampling_height == 0) {
+    xnn_log_error(
+      "failed to create Convolution operator with %" PRIu32 "x%" PRIu32 " subsampling: "
+      "subsampling dimensions must be non-zero",
+      subsampling_width, subsampling_height);
+    goto error;
   }
 
-  convolution_op->batch_size = batch_size;
-  convolution_op->input_height = input_height;
-  convolution_op->input_width = input_width;
-  convolution_op->input = input;
+  if (dilation_width == 0 || dilation_height == 0) {
+    xnn_log_error(
+      "failed to create Convolution operator with %" PRIu32 "x%" PRIu32 " dilation: "
+      "dilation dimensions must be non-zero",
+      dilation_width, dilation_height);
+    goto error;
+  }
 
-  convolution_op->output_height = compute_output_dimension(
-      convolution_op->padding_top + input_height + convolution_op->padding_bottom,
-      convolution_op->kernel_height,
-      convolution_op->dilation_height,
-      convolution_op->stride_height);
-  convolution_op->output_width = compute_output_dimension(
-      convolution_op->padding_left + input_width + convolution_op->padding_right,
-      convolution_op->kernel_width,
-      convolution_op->dilation_width,
-      convolution_op->stride_width);
-  convolution_op->output = output;
+  if (groups == 0) {
+    xnn_log_error(
+      "failed to create Convolution operator with %" PRIu32 " groups: number of groups must be non-zero", groups);
+    goto error;
+  }
 
-  switch (convolution_op->ukernel.type) {
-    case xnn_ukernel_type_gemm:
-    {
-      // Convolution maps directly to GEMM and doesn't use indirection buffer.
+  if (group_input_channels == 0) {
+    xnn_log_error(
+      "failed to create Convolution operator with %zu input channels per group: "
+      "number of channels must be non-zero",
+      group_input_channels);
+    goto error;
+  }
 
-      const size_t output_height = convolution_op->output_height;
-      const size_t output_width = convolution_op->output_width;
-      const size_t output_size = output_height * output_width;
-      const size_t batch_output_size = batch_size * output_size;
+  if (group_output_channels == 0) {
+    xnn_log_error(
+      "failed to create Convolution operator with %zu output channels per group: "
+      "number of channels must be non-zero",
+      group_output_channels);
+    goto error;
+  }
 
-      const size_t groups = convolution_op->groups;
-      const size_t group_input_channels = convolution_op->group_input_channels;
-      const size_t w_stride = (round_up_po2(group_input_channels, convolution_op->ukernel.gemm.kr) << log2_filter_element_size) + bias_element_size;
-      const size_t group_output_channels = convolution_op->group_output_channels;
+  const size_t input_channels = groups * group_input_channels;
+  if (input_pixel_stride < input_channels) {
+    xnn_log_error(
+      "failed to create Convolution operator with input pixel stride of %zu: "
+      "stride must be at least as large as the number of input channels (%" PRIu32 "x%zu)",
+      input_pixel_stride, groups, group_input_channels);
+    goto error;
+  }
 
-      uint32_t mr = convolution_op->ukernel.gemm.mr;
-      const uint32_t nr = convolution_op->ukernel.gemm.nr;
-      xnn_gemm_ukernel_function gemm_ukernel = convolution_op->ukernel.gemm.default_function;
-      if (batch_output_size == 1 && convolution_op->ukernel.gemm.mr1_function != NULL) {
-        mr = 1;
-        gemm_ukernel = convolution_op->ukernel.gemm.mr1_function;
-      }
+  const size_t output_channels = groups * group_output_channels;
+  if (output_pixel_stride < output_channels) {
+    xnn_log_error(
+      "failed to create Convolution operator with output pixel stride of %zu: "
+      "stride must be at least as large as the number of output channels (%" PRIu32 "x%zu)",
+      output_pixel_stride, groups, group_output_channels);
+    goto error;
+  }
 
-      convolution_op->context.gemm = (struct gemm_context) {
-          .k_scaled = group_input_channels << log2_input_element_size,
-          .a = input,
+  if (isnan(output_min)) {
+    xnn_log_error(
+      "failed to create Convolution operator with NaN output lower bound: lower bound must be non-NaN");
+    goto error;
+  }
+
+  if (isnan(output_max)) {
+    xnn_log_error(
+      "failed to create Convolution operator with NaN output upper bound: upper bound must be non-NaN");
+    goto error;
+  }
+
+  const struct xnn_f16_output_params output_params = xnn_compute_f16_output_params(1.0f, output_min, output_max);
+  if (fp16_ieee_to_fp32_value(output_params.min) >= fp16_ieee_to_fp32_value(output_params.max)) {
+    xnn_log_error(
+      "failed to create Convolution operator with [%.7g, %.7g] output range: "
+      "lower bound must be below upper bound in half precision",
+      output_min, output_max);
+    goto error;
+  }
+
+  if ((flags & XNN_FLAG_DEPTHWISE_CONVOLUTION) != 0 && group_input_channels != 1) {
+    xnn_log_error(
+      "failed to create Depthwise Convolution operator with %zu input channels per group: "
+      "Depthwise Convolution must have exactly 1 input channel per group",
+      group_input_channels);
+    goto error;
+  }
+
+  const uint32_t effective_kernel_height = (kernel_height - 1) * dilation_height + 1;
+  const uint32_t effective_kernel_width = (kernel_width - 1) * dilation_width + 1;
+
+  if (input_padding_top >= effective_kernel_height) {
+    xnn_log_info(
+      "inefficiency in Convolution operator with %" PRIu32 "x%" PRIu32 " effective kernel and %" PRIu32 "+%" PRIu32 " height padding: "
+      "input top padding is greater or equal to effective kernel height",
+      effective_kernel_width, effective_kernel_height, input_padding_top, input_padding_bottom);
+  }
+
+  if (input_padding_bottom >= effective_kernel_height) {
+    xnn_log_info(
+      "inefficiency in Convolution operator with %" PRIu32 "x%" PRIu32 " effective kernel and %" PRIu32 "+%" PRIu32 " height padding: "
+      "input bottom padding is greater or equal to effective kernel height",
+      effective_kernel_width, effective_kernel_height, input_padding_top, input_padding_bottom);
+  }
+
+  if (input_padding_right >= effective_kernel_width) {
+    xnn_log_info(
+      "inefficiency in Convolution operator with %" PRIu32 "x%" PRIu32 " effective kernel and %" PRIu32 "+%" PRIu32 " width padding: "
+      "input right padding is greater or equal to effective kernel width",
+      effective_kernel_width, effective_kernel_height, input_padding_left, input_padding_right);
+  }
+
+  if (input_padding_left >= effective_kernel_width) {
+    xnn_log_info(
+      "inefficiency in Convolution operator with %" PRIu32 "x%" PRIu32 " effective kernel and %" PRIu32 "+%" PRIu32 " width padding: "
+      "input left padding is greater or equal to effective kernel width",
+      effective_kernel_width, effective_kernel_height, input_padding_left, input_padding_right);
+  }
+
+  status = xnn_status_out_of_memory;
+
+  convolution_op = xnn_allocate_zero_memory(sizeof(struct xnn_operator));
+  if (convolution_op == NULL) {
+    xnn_log_error("failed to allocate %zu bytes for Convolution operator descriptor", sizeof(struct xnn_operator));
+    goto error;
+  }
+
+  const size_t kernel_size = kernel_height * kernel_width;
+
+  enum xnn_ukernel_type ukernel_type = xnn_ukernel_type_none;
+  const struct dwconv_parameters* dwconv_parameters = NULL;
+  const bool any_padding = (input_padding_left | input_padding_top | input_padding_right | input_padding_bottom) != 0;
+  if (group_input_channels == 1 && group_output_channels == 1 &&
+      (dwconv_parameters = find_dwigemm_ukernel(kernel_size, &xnn_params.f16.dwconv, 1)) != NULL)
+  {
+    ukernel_type = xnn_ukernel_type_dwconv;
+  } else if (kernel_size == 1 && subsampling_height == 1 && subsampling_width == 1 && !any_padding) {
+    ukernel_type = xnn_ukernel_type_gemm;
+  } else {
+    ukernel_type = xnn_ukernel_type_igemm;
+  }
+
+  size_t zero_size = 0;
+  switch (ukernel_type) {
+    case xnn_ukernel_type_dwconv:
+    {
+      assert(dwconv_parameters != NULL);
+      assert(dwconv_parameters->qr == 0);
+      assert(dwconv_parameters->mr == kernel_size);
+
+      const uint32_t c_stride = round_up_po2(groups, dwconv_parameters->cr);
+      const size_t packed_weights_size = (kernel_size + 1) * sizeof(uint16_t) * c_stride;
+      convolution_op->packed_weights = xnn_allocate_memory(packed_weights_size);
+      if (convolution_op->packed_weights == NULL) {
+        xnn_log_error("failed to allocate %zu bytes for packed weights", packed_weights_size);
+        goto error;
+      }
+
+      if (flags & XNN_FLAG_DEPTHWISE_CONVOLUTION) {
+        xnn_pack_f16_dwconv_hwg_w(
+          kernel_height, kernel_width,
+          groups, dwconv_parameters->cr,
+          kernel, bias, convolution_op->packed_weights);
+      } else {
+        xnn_pack_f16_dwconv_ghw_w(
+          kernel_height, kernel_width,
+          groups, dwconv_parameters->cr,
+          kernel, bias, convolution_op->packed_weights);
+      }
+
+      convolution_op->ukernel.dwconv = (struct xnn_ukernel_dwconv) {
+        .unipass_function = dwconv_parameters->up,
+        .mr = dwconv_parameters->mr,
+        .qr = dwconv_parameters->qr,
+      };
+
+      zero_size = sizeof(uint16_t) * c_stride + XNN_EXTRA_BYTES;
+      break;
+    }
+    case xnn_ukernel_type_gemm:
+    case xnn_ukernel_type_igemm:
+    {
+      const uint32_t nr = xnn_params.f16.gemm.nr;
+      const uint32_t kr = UINT32_C(1) << xnn_params.f16.gemm.log2_kr;
+      const uint32_t n_stride = round_up(group_output_channels, nr);
+      const uint32_t k_stride = round_up_po2(group_input_channels, kr);
+
+      const size_t packed_group_weights_size = (kernel_size * k_stride + 1) * sizeof(uint16_t) * n_stride;
+      convolution_op->packed_weights = xnn_allocate_memory(packed_group_weights_size * groups);
+      if (convolution_op->packed_weights == NULL) {
+        xnn_log_error("failed to allocate %zu bytes for packed weights", packed_group_weights_size * groups);
+        goto error;
+      }
+      memset(convolution_op->packed_weights, 0, packed_group_weights_size * groups);
+
+      switch (ukernel_type) {
+        case xnn_ukernel_type_gemm:
+          xnn_pack_f16_gemm_goi_w(
+              groups, group_output_channels, group_input_channels,
+              nr, kr,
+              kernel, bias, convolution_op->packed_weights);
+          convolution_op->ukernel.gemm = (struct xnn_ukernel_gemm) {
+            .mr = xnn_params.f16.gemm.mr,
+            .nr = nr,
+            .kr = kr,
+            .default_function = xnn_params.f16.gemm.gemm,
+            .mr1_function = xnn_params.f16.gemm.gemm1,
+          };
+          break;
+        case xnn_ukernel_type_igemm:
+          if (flags & XNN_FLAG_DEPTHWISE_CONVOLUTION) {
+            xnn_pack_f16_conv_kgo_w(
+                groups, group_output_channels, kernel_size,
+                nr, kr,
+                kernel, bias, convolution_op->packed_weights);
+          } else {
+            xnn_pack_f16_conv_goki_w(
+                groups, group_output_channels, kernel_size, group_input_channels,
+                nr, kr,
+                kernel, bias, convolution_op->packed_weights);
+          }
+          convolution_op->ukernel.igemm = (struct xnn_ukernel_igemm) {
+            .mr = xnn_params.f16.gemm.mr,
+            .nr = nr,
+            .kr = kr,
+            .default_function = xnn_params.f16.gemm.igemm,
+            .mr1_function = xnn_params.f16.gemm.igemm1,
+          };
+          break;
+        default:
+          XNN_UNREACHABLE;
+      }
+
+      zero_size = sizeof(uint16_t) * k_stride + XNN_EXTRA_BYTES;
+      break;
+    }
+    default:
+      XNN_UNREACHABLE;
+  }
+
+  if (any_padding) {
+    void* zero_buffer = xnn_allocate_zero_memory(zero_size);
+    if (zero_buffer == NULL) {
+      xnn_log_error("failed to allocate %zu bytes for zero padding", zero_size);
+      goto error;
+    }
+    convolution_op->zero_buffer = zero_buffer;
+  }
+
+  convolution_op->padding_top = input_padding_top;
+  convolution_op->padding_right = input_padding_right;
+  convolution_op->padding_bottom = input_padding_bottom;
+  convolution_op->padding_left = input_padding_left;
+
+  convolution_op->kernel_height = kernel_height;
+  convolution_op->kernel_width = kernel_width;
+  convolution_op->stride_height = subsampling_height;
+  convolution_op->stride_width = subsampling_width;
+  convolution_op->dilation_height = dilation_height;
+  convolution_op->dilation_width = dilation_width;
+  convolution_op->groups = groups;
+  convolution_op->group_input_channels = group_input_channels;
+  convolution_op->group_output_channels = group_output_channels;
+  convolution_op->input_pixel_stride = input_pixel_stride;
+  convolution_op->output_pixel_stride = output_pixel_stride;
+  convolution_op->compact_indirection = (flags & XNN_FLAG_COMPACT_INDIRECTION) != 0;
+
+  convolution_op->f16_output_params = output_params;
+
+  convolution_op->type = xnn_operator_type_convolution_f16;
+  convolution_op->ukernel.type = ukernel_type;
+
+  convolution_op->state = xnn_run_state_invalid;
+
+  *convolution_op_out = convolution_op;
+  return xnn_status_success;
+
+error:
+  xnn_delete_operator(convolution_op);
+  return status;
+}
+
+static enum xnn_status create_convolution2d_nhwc_f32(
+    uint32_t input_padding_top,
+    uint32_t input_padding_right,
+    uint32_t input_padding_bottom,
+    uint32_t input_padding_left,
+    uint32_t kernel_height,
+    uint32_t kernel_width,
+    uint32_t subsampling_height,
+    uint32_t subsampling_width,
+    uint32_t dilation_height,
+    uint32_t dilation_width,
+    uint32_t groups,
+    size_t group_input_channels,
+    size_t group_output_channels,
+    size_t input_pixel_stride,
+    size_t output_pixel_stride,
+    const float* kernel,
+    const float* bias,
+    const void* packed_weights_blob,
+    size_t packed_weights_blob_size,
+    float output_min,
+    float output_max,
+    uint32_t flags,
+    xnn_operator_t* convolution_op_out)
+{
+  xnn_operator_t convolution_op = NULL;
+  enum xnn_status status = xnn_status_uninitialized;
+
+  if (!xnn_params.initialized) {
+    xnn_log_error("failed to create Convolution operator: XNNPACK is not initialized");
+    goto error;
+  }
+
+  status = xnn_status_invalid_parameter;
+
+  if (kernel_width == 0 || kernel_height == 0) {
+    xnn_log_error(
+      "failed to create Convolution operator with %" PRIu32 "x%" PRIu32 " kernel: kernel dimensions must be non-zero",
+      kernel_width, kernel_height);
+    goto error;
+  }
+
+  if (subsampling_width == 0 || subsampling_height == 0) {
+    xnn_log_error(
+      "failed to create Convolution operator with %" PRIu32 "x%" PRIu32 " subsampling: "
+      "subsampling dimensions must be non-zero",
+      subsampling_width, subsampling_height);
+    goto error;
+  }
+
+  if (dilation_width == 0 || dilation_height == 0) {
+    xnn_log_error(
+      "failed to create Convolution operator with %" PRIu32 "x%" PRIu32 " dilation: "
+      "dilation dimensions must be non-zero",
+      dilation_width, dilation_height);
+    goto error;
+  }
+
+  if (groups == 0) {
+    xnn_log_error(
+      "failed to create Convolution operator with %" PRIu32 " groups: number of groups must be non-zero", groups);
+    goto error;
+  }
+
+  if (group_input_channels == 0) {
+    xnn_log_error(
+      "failed to create Convolution operator with %zu input channels per group: "
+      "number of channels must be non-zero",
+      group_input_channels);
+    goto error;
+  }
+
+  if (group_output_channels == 0) {
+    xnn_log_error(
+      "failed to create Convolution operator with %zu output channels per group: "
+      "number of channels must be non-zero",
+      group_output_channels);
+    goto error;
+  }
+
+  const size_t input_channels = groups * group_input_channels;
+  if (input_pixel_stride < input_channels) {
+    xnn_log_error(
+      "failed to create Convolution operator with input pixel stride of %zu: "
+      "stride must be at least as large as the number of input channels (%" PRIu32 "x%zu)",
+      input_pixel_stride, groups, group_input_channels);
+    goto error;
+  }
+
+  const size_t output_channels = groups * group_output_channels;
+  if (output_pixel_stride < output_channels) {
+    xnn_log_error(
+      "failed to create Convolution operator with output pixel stride of %zu: "
+      "stride must be at least as large as the number of output channels (%" PRIu32 "x%zu)",
+      output_pixel_stride, groups, group_output_channels);
+    goto error;
+  }
+
+  if (isnan(output_min)) {
+    xnn_log_error(
+      "failed to create Convolution operator with NaN output lower bound: lower bound must be non-NaN");
+    goto error;
+  }
+
+  if (isnan(output_max)) {
+    xnn_log_error(
+      "failed to create Convolution operator with NaN output upper bound: upper bound must be non-NaN");
+    goto error;
+  }
+
+  if (output_min >= output_max) {
+    xnn_log_error(
+      "failed to create Convolution operator with [%.7g, %.7g] output range: "
+      "lower bound must be below upper bound",
+      output_min, output_max);
+    goto error;
+  }
+
+  if ((flags & XNN_FLAG_DEPTHWISE_CONVOLUTION) != 0 && group_input_channels != 1) {
+    xnn_log_error(
+      "failed to create Depthwise Convolution operator with %zu input channels per group: "
+      "Depthwise Convolution must have exactly 1 input channel per group",
+      group_input_channels);
+    goto error;
+  }
+
+  if ((flags & XNN_FLAG_FP16_WEIGHTS) && (flags & XNN_FLAG_INT8_WEIGHTS)) {
+    xnn_log_error(
+      "failed to create Convolution operator with both FP16 and INT8 weights flags: flags are mutually exclusive");
+    goto error;
+  }
+
+  if ((flags & XNN_FLAG_INT8_WEIGHTS) && kernel != NULL) {
+    const size_t kernel_elements = groups * group_output_channels * kernel_height * kernel_width * group_input_channels;
+    for (size_t i = 0; i < kernel_elements; i++) {
+      if (!isfinite(kernel[i])) {
+        xnn_log_error(
+          "failed to create Convolution operator with INT8 weights: kernel element #%zu is not finite", i);
+        goto error;
+      }
+    }
+  }
+
+  const uint32_t effective_kernel_height = (kernel_height - 1) * dilation_height + 1;
+  const uint32_t effective_kernel_width = (kernel_width - 1) * dilation_width + 1;
+
+  if (input_padding_top >= effective_kernel_height) {
+    xnn_log_info(
+      "inefficiency in Convolution operator with %" PRIu32 "x%" PRIu32 " effective kernel and %" PRIu32 "+%" PRIu32 " height padding: "
+      "input top padding is greater or equal to effective kernel height",
+      effective_kernel_width, effective_kernel_height, input_padding_top, input_padding_bottom);
+  }
+
+  if (input_padding_bottom >= effective_kernel_height) {
+    xnn_log_info(
+      "inefficiency in Convolution operator with %" PRIu32 "x%" PRIu32 " effective kernel and %" PRIu32 "+%" PRIu32 " height padding: "
+      "input bottom padding is greater or equal to effective kernel height",
+      effective_kernel_width, effective_kernel_height, input_padding_top, input_padding_bottom);
+  }
+
+  if (input_padding_right >= effective_kernel_width) {
+    xnn_log_info(
+      "inefficiency in Convolution operator with %" PRIu32 "x%" PRIu32 " effective kernel and %" PRIu32 "+%" PRIu32 " width padding: "
+      "input right padding is greater or equal to effective kernel width",
+      effective_kernel_width, effective_kernel_height, input_padding_left, input_padding_right);
+  }
+
+  if (input_padding_left >= effective_kernel_width) {
+    xnn_log_info(
+      "inefficiency in Convolution operator with %" PRIu32 "x%" PRIu32 " effective kernel and %" PRIu32 "+%" PRIu32 " width padding: "
+      "input left padding is greater or equal to effective kernel width",
+      effective_kernel_width, effective_kernel_height, input_padding_left, input_padding_right);
+  }
+
+  const size_t kernel_size = kernel_height * kernel_width;
+  const bool any_padding = (input_padding_left | input_padding_top | input_padding_right | input_padding_bottom) != 0;
+  const bool unit_subsampling = (subsampling_width | subsampling_height) == 1;
+
+  // Compressed weights are supported only by GEMM micro-kernels, i.e. for 1x1 convolutions without padding and
+  // subsampling.
+  const bool compressed_weights = (flags & (XNN_FLAG_FP16_WEIGHTS | XNN_FLAG_INT8_WEIGHTS)) != 0;
+  if (compressed_weights && !(kernel_size == 1 && unit_subsampling && !any_padding)) {
+    xnn_log_error(
+      "failed to create Convolution operator with %" PRIu32 "x%" PRIu32 " kernel, %" PRIu32 "x%" PRIu32 " subsampling, "
+      "and %" PRIu32 "+%" PRIu32 "x%" PRIu32 "+%" PRIu32" padding: "
+      "FP16 and INT8 weights are supported only for 1x1 kernels with unit subsampling and no padding",
+      kernel_height, kernel_width, subsampling_height, subsampling_width,
+      input_padding_top, input_padding_left, input_padding_bottom, input_padding_right);
+    status = xnn_status_unsupported_parameter;
+    goto error;
+  }
+
+  status = xnn_status_out_of_memory;
+
+  convolution_op = xnn_allocate_zero_memory(sizeof(struct xnn_operator));
+  if (convolution_op == NULL) {
+    xnn_log_error("failed to allocate %zu bytes for Convolution operator descriptor", sizeof(struct xnn_operator));
+    goto error;
+  }
+
+  enum xnn_ukernel_type ukernel_type = xnn_ukernel_type_none;
+  const struct dwconv_parameters* dwconv_parameters = NULL;
+  if (compressed_weights) {
+    ukernel_type = xnn_ukernel_type_gemm;
+  } else if (group_input_channels == 1 && group_output_channels == 1 && kernel_size == 1 && unit_subsampling && !any_padding) {
+    ukernel_type = xnn_ukernel_type_vmulcaddc;
+  } else if (group_input_channels == 1 && group_output_channels == 1 && (dwconv_parameters =
+               find_dwigemm_ukernel(kernel_size, xnn_params.f32.dwconv, XNN_MAX_F32_DWCONV_UKERNELS)) != NULL)
+  {
+    ukernel_type = xnn_ukernel_type_dwconv;
+  } else if (kernel_size == 1 && unit_subsampling && !any_padding) {
+    ukernel_type = xnn_ukernel_type_gemm;
+  } else if (groups == 1 && kernel_height == 3 && kernel_width == 3 && unit_subsampling &&
+             (dilation_height | dilation_width) == 1 && (flags & XNN_FLAG_DISABLE_WINOGRAD) == 0 &&
+             xnn_params.f32.winograd.input != NULL &&
+             group_input_channels >= xnn_params.f32.winograd.min_channels &&
+             group_output_channels >= xnn_params.f32.winograd.min_channels &&
+             xnn_params.f32.gemm.mr * xnn_params.f32.gemm.nr <= XNN_MAX_WINOGRAD_GEMM_TILE)
+  {
+    ukernel_type = xnn_ukernel_type_winograd;
+  } else {
+    ukernel_type = xnn_ukernel_type_igemm;
+  }
+
+  // Pruned 1x1 kernels are packed into sparse representation and multiplied with SpMM micro-kernels, unless the
+  // weights come from a serialized blob or use a compressed type.
+  if (ukernel_type == xnn_ukernel_type_gemm && kernel != NULL &&
+      (flags & (XNN_FLAG_FP16_WEIGHTS | XNN_FLAG_INT8_WEIGHTS | XNN_FLAG_DISABLE_SPARSE_WEIGHTS)) == 0)
+  {
+    status = xnn_init_operator_sparse_weights(
+      convolution_op, groups, group_output_channels, group_input_channels, kernel, bias);
+    if (status != xnn_status_success) {
+      goto error;
+    }
+    if (convolution_op->ukernel.type == xnn_ukernel_type_spmm) {
+      ukernel_type = xnn_ukernel_type_spmm;
+    }
+  }
+
+  struct xnn_packed_weights_header packed_weights_header = {
+    .operator_type = xnn_operator_type_convolution_f32,
+    .ukernel_type = ukernel_type,
+    .groups = groups,
+    .kernel_height = kernel_height,
+    .kernel_width = kernel_width,
+    .group_input_channels = group_input_channels,
+    .group_output_channels = group_output_channels,
+  };
+  size_t zero_size = 0;
+  switch (ukernel_type) {
+    case xnn_ukernel_type_vmulcaddc:
+    {
+      const uint32_t c_stride = round_up_po2(groups, xnn_params.f32.vmulcaddc.cr);
+      packed_weights_header.nr = xnn_params.f32.vmulcaddc.cr;
+      packed_weights_header.weights_size = 2 * sizeof(float) * c_stride;
+      status = xnn_init_operator_packed_weights(
+        convolution_op, &packed_weights_header, packed_weights_blob, packed_weights_blob_size);
+      if (status != xnn_status_success) {
+        goto error;
+      }
+
+      if (!convolution_op->packed_weights_external) {
+        xnn_pack_f32_vmulcaddc_w(
+          groups, xnn_params.f32.vmulcaddc.cr,
+          kernel, bias, convolution_op->packed_weights);
+      }
+
+      convolution_op->ukernel.vmulcaddc = (struct xnn_ukernel_vmulcaddc) {
+        .function = xnn_params.f32.vmulcaddc.ukernel,
+        .mr = xnn_params.f32.vmulcaddc.mr,
+      };
+      break;
+    }
+    case xnn_ukernel_type_dwconv:
+    {
+      assert(dwconv_parameters != NULL);
+      assert(dwconv_parameters->qr != 0 || dwconv_parameters->mr == kernel_size);
+
+      const uint32_t c_stride = round_up_po2(groups, dwconv_parameters->cr);
+      packed_weights_header.nr = dwconv_parameters->cr;
+      packed_weights_header.weights_size = (kernel_size + 1) * sizeof(float) * c_stride;
+      status = xnn_init_operator_packed_weights(
+        convolution_op, &packed_weights_header, packed_weights_blob, packed_weights_blob_size);
+      if (status != xnn_status_success) {
+        goto error;
+      }
+
+      if (!convolution_op->packed_weights_external) {
+        if (flags & XNN_FLAG_DEPTHWISE_CONVOLUTION) {
+          xnn_pack_f32_dwconv_hwg_w(
+            kernel_height, kernel_width,
+            groups, dwconv_parameters->cr,
+            kernel, bias, convolution_op->packed_weights);
+        } else {
+          xnn_pack_f32_dwconv_ghw_w(
+            kernel_height, kernel_width,
+            groups, dwconv_parameters->cr,
+            kernel, bias, convolution_op->packed_weights);
+        }
+      }
+
+      if (dwconv_parameters->qr != 0) {
+        convolution_op->ukernel.dwconv = (struct xnn_ukernel_dwconv) {
+          .multipass_function = dwconv_parameters->mp,
+          .mr = dwconv_parameters->mr,
+          .qr = dwconv_parameters->qr,
+        };
+      } else {
+        convolution_op->ukernel.dwconv = (struct xnn_ukernel_dwconv) {
+          .unipass_function = dwconv_parameters->up,
+          .mr = dwconv_parameters->mr,
+          .qr = dwconv_parameters->qr,
+        };
+      }
+
+      zero_size = sizeof(float) * c_stride;
+      break;
+    }
+    case xnn_ukernel_type_gemm:
+    case xnn_ukernel_type_igemm:
+    {
+      enum xnn_weights_type weights_type = xnn_weights_type_f32;
+      const struct gemm_parameters* gemm_parameters = &xnn_params.f32.gemm;
+      size_t filter_element_size = sizeof(float);
+      size_t bias_element_size = sizeof(float);
+      if (flags & XNN_FLAG_FP16_WEIGHTS) {
+        weights_type = xnn_weights_type_f16;
+        gemm_parameters = &xnn_params.f32.gemm_f16w;
+        filter_element_size = sizeof(uint16_t);
+      } else if (flags & XNN_FLAG_INT8_WEIGHTS) {
+        weights_type = xnn_weights_type_qc8;
+        gemm_parameters = &xnn_params.f32.gemm_qc8w;
+        filter_element_size = sizeof(int8_t);
+        bias_element_size = sizeof(float) + sizeof(float);
+      }
+
+      const uint32_t nr = gemm_parameters->nr;
+      const uint32_t kr = UINT32_C(1) << gemm_parameters->log2_kr;
+      const uint32_t sr = UINT32_C(1) << gemm_parameters->log2_sr;
+      const uint32_t n_stride = round_up(group_output_channels, nr);
+      const uint32_t k_stride = round_up_po2(group_input_channels, kr);
+
+      const size_t packed_group_weights_size =
+        (kernel_size * k_stride * filter_element_size + bias_element_size) * n_stride;
+      packed_weights_header.nr = nr;
+      packed_weights_header.kr = kr;
+      packed_weights_header.sr = sr;
+      packed_weights_header.weights_type = weights_type;
+      packed_weights_header.weights_size = packed_group_weights_size * groups;
+      status = xnn_init_operator_packed_weights(
+        convolution_op, &packed_weights_header, packed_weights_blob, packed_weights_blob_size);
+      if (status != xnn_status_success) {
+        goto error;
+      }
+      const bool pack_weights = !convolution_op->packed_weights_external;
+      if (pack_weights) {
+        memset(convolution_op->packed_weights, 0, packed_group_weights_size * groups);
+      }
+      convolution_op->weights_type = weights_type;
+
+      switch (ukernel_type) {
+        case xnn_ukernel_type_gemm:
+          if (pack_weights) {
+            switch (weights_type) {
+              case xnn_weights_type_f16:
+                xnn_pack_f32_f16w_gemm_goi_w(
+                    groups, group_output_channels, group_input_channels, nr,
+                    kernel, bias, convolution_op->packed_weights);
+                break;
+              case xnn_weights_type_qc8:
+                xnn_pack_f32_qc8w_gemm_goi_w(
+                    groups, group_output_channels, group_input_channels, nr,
+                    kernel, bias, convolution_op->packed_weights);
+                break;
+              default:
+                xnn_pack_f32_gemm_goi_w(
+                    groups, group_output_channels, group_input_channels,
+                    nr, kr, sr,
+                    kernel, bias, convolution_op->packed_weights);
+                break;
+            }
+          }
+          convolution_op->ukernel.gemm = (struct xnn_ukernel_gemm) {
+            .mr = gemm_parameters->mr,
+            .nr = nr,
+            .kr = kr,
+            .default_function = gemm_parameters->gemm,
+            .mr1_function = gemm_parameters->gemm1,
+          };
+          if (weights_type != xnn_weights_type_f32) {
+            // Only the plain GEMM micro-kernels support compressed weights.
+            break;
+          }
+          if (groups == 1 && xnn_params.f32.ppmm.ppmm != NULL && xnn_params.f32.ppmm.nr == nr && kr == 1 && sr == 1) {
+            convolution_op->ukernel.gemm.ppmm = (struct xnn_ukernel_ppmm) {
+              .function = xnn_params.f32.ppmm.ppmm,
+              .packx_function = xnn_params.f32.ppmm.packx,
+              .mr = xnn_params.f32.ppmm.mr,
+            };
+          }
+          if (groups == 1) {
+            convolution_op->ukernel.gemm.inc_function = xnn_params.f32.gemm.gemminc;
+          }
+          break;
+        case xnn_ukernel_type_igemm:
+          if (pack_weights) {
+            if (flags & XNN_FLAG_DEPTHWISE_CONVOLUTION) {
+              xnn_pack_f32_conv_kgo_w(
+                groups, group_output_channels, kernel_size,
+                nr, kr,
+                kernel, bias, convolution_op->packed_weights);
+            } else {
+              xnn_pack_f32_conv_goki_w(
+                groups, group_output_channels, kernel_size, group_input_channels,
+                nr, kr, sr,
+                kernel, bias, convolution_op->packed_weights);
+            }
+          }
+          convolution_op->ukernel.igemm = (struct xnn_ukernel_igemm) {
+            .mr = xnn_params.f32.gemm.mr,
+            .nr = nr,
+            .kr = kr,
+            .default_function = xnn_params.f32.gemm.igemm,
+            .mr1_function = xnn_params.f32.gemm.igemm1,
+          };
+          break;
+        default:
+          XNN_UNREACHABLE;
+      }
+
+      zero_size = sizeof(float) * k_stride;
+      break;
+    }
+    case xnn_ukernel_type_spmm:
+      // Weights are already packed into sparse representation.
+      break;
+    case xnn_ukernel_type_winograd:
+    {
+      // Weights for each of the 36 transformed positions are packed as a separate group of GEMM weights. Biases are
+      // packed only for the position (1, 1): the output transform adds it to every output pixel of the tile.
+      const uint32_t nr = xnn_params.f32.gemm.nr;
+      const uint32_t kr = UINT32_C(1) << xnn_params.f32.gemm.log2_kr;
+      const uint32_t sr = UINT32_C(1) << xnn_params.f32.gemm.log2_sr;
+      const uint32_t n_stride = round_up(group_output_channels, nr);
+      const uint32_t k_stride = round_up_po2(group_input_channels, kr);
+
+      const size_t packed_position_weights_size = (k_stride + 1) * sizeof(float) * n_stride;
+      packed_weights_header.nr = nr;
+      packed_weights_header.kr = kr;
+      packed_weights_header.sr = sr;
+      packed_weights_header.weights_size = packed_position_weights_size * 36;
+      status = xnn_init_operator_packed_weights(
+        convolution_op, &packed_weights_header, packed_weights_blob, packed_weights_blob_size);
+      if (status != xnn_status_success) {
+        goto error;
+      }
+
+      if (!convolution_op->packed_weights_external) {
+        status = xnn_status_out_of_memory;
+        const size_t transformed_kernel_size = group_output_channels * group_input_channels * sizeof(float);
+        float* transformed_kernel = xnn_allocate_memory(transformed_kernel_size);
+        float* zero_bias = xnn_allocate_zero_memory(group_output_channels * sizeof(float));
+        if (transformed_kernel == NULL || zero_bias == NULL) {
+          xnn_log_error("failed to allocate %zu bytes for transformed kernel", transformed_kernel_size);
+          xnn_release_memory(transformed_kernel);
+          xnn_release_memory(zero_bias);
+          goto error;
+        }
+
+        memset(convolution_op->packed_weights, 0, packed_position_weights_size * 36);
+        for (size_t position = 0; position < 36; position++) {
+          transform_winograd_kernel(position, group_output_channels, group_input_channels, kernel, transformed_kernel);
+          xnn_pack_f32_gemm_goi_w(
+              1, group_output_channels, group_input_channels,
+              nr, kr, sr,
+              transformed_kernel, position == 1 * 6 + 1 ? bias : zero_bias,
+              (float*) ((uintptr_t) convolution_op->packed_weights + position * packed_position_weights_size));
+        }
+        xnn_release_memory(transformed_kernel);
+        xnn_release_memory(zero_bias);
+      }
+
+      convolution_op->ukernel.winograd = (struct xnn_ukernel_winograd) {
+        .input_function = xnn_params.f32.winograd.input,
+        .gemm_function = xnn_params.f32.gemm.gemm,
+        .output_function = xnn_params.f32.winograd.output,
+        .mr = xnn_params.f32.gemm.mr,
+        .nr = nr,
+        .kr = kr,
+      };
+
+      // Input tiles extend past the bottom and right edges of the input unless the output size is a multiple of 4,
+      // and the input transform micro-kernel reads up to 3 channels past the end.
+      zero_size = sizeof(float) * group_input_channels + XNN_EXTRA_BYTES;
+      break;
+    }
+    default:
+      XNN_UNREACHABLE;
+  }
+
+  status = xnn_status_out_of_memory;
+
+  if (any_padding || ukernel_type == xnn_ukernel_type_winograd) {
+    void* zero_buffer = xnn_allocate_zero_memory(zero_size);
+    if (zero_buffer == NULL) {
+      xnn_log_error("failed to allocate %zu bytes for zero padding", zero_size);
+      goto error;
+    }
+    convolution_op->zero_buffer = zero_buffer;
+  }
+
+  convolution_op->padding_top = input_padding_top;
+  convolution_op->padding_right = input_padding_right;
+  convolution_op->padding_bottom = input_padding_bottom;
+  convolution_op->padding_left = input_padding_left;
+
+  convolution_op->kernel_height = kernel_height;
+  convolution_op->kernel_width = kernel_width;
+  convolution_op->stride_height = subsampling_height;
+  convolution_op->stride_width = subsampling_width;
+  convolution_op->dilation_height = dilation_height;
+  convolution_op->dilation_width = dilation_width;
+  convolution_op->groups = groups;
+  convolution_op->group_input_channels = group_input_channels;
+  convolution_op->group_output_channels = group_output_channels;
+  convolution_op->input_pixel_stride = input_pixel_stride;
+  convolution_op->output_pixel_stride = output_pixel_stride;
+  convolution_op->compact_indirection = (flags & XNN_FLAG_COMPACT_INDIRECTION) != 0;
+
+  convolution_op->f32_output_params = xnn_compute_f32_output_params(output_min, output_max);
+
+  convolution_op->type = xnn_operator_type_convolution_f32;
+  convolution_op->ukernel.type = ukernel_type;
+
+  convolution_op->state = xnn_run_state_invalid;
+
+  *convolution_op_out = convolution_op;
+  return xnn_status_success;
+
+error:
+  xnn_delete_operator(convolution_op);
+  return status;
+}
+
+enum xnn_status xnn_create_convolution2d_nhwc_f32(
+    uint32_t input_padding_top,
+    uint32_t input_padding_right,
+    uint32_t input_padding_bottom,
+    uint32_t input_padding_left,
+    uint32_t kernel_height,
+    uint32_t kernel_width,
+    uint32_t subsampling_height,
+    uint32_t subsampling_width,
+    uint32_t dilation_height,
+    uint32_t dilation_width,
+    uint32_t groups,
+    size_t group_input_channels,
+    size_t group_output_channels,
+    size_t input_pixel_stride,
+    size_t output_pixel_stride,
+    const float* kernel,
+    const float* bias,
+    float output_min,
+    float output_max,
+    uint32_t flags,
+    xnn_operator_t* convolution_op_out)
+{
+  return create_convolution2d_nhwc_f32(
+    input_padding_top, input_padding_right, input_padding_bottom, input_padding_left,
+    kernel_height, kernel_width,
+    subsampling_height, subsampling_width,
+    dilation_height, dilation_width,
+    groups, group_input_channels, group_output_channels,
+    input_pixel_stride, output_pixel_stride,
+    kernel, bias,
+    NULL /* packed weights */, 0 /* packed weights size */,
+    output_min, output_max,
+    flags,
+    convolution_op_out);
+}
+
+enum xnn_status xnn_create_convolution2d_nhwc_f32_from_packed_weights(
+    uint32_t input_padding_top,
+    uint32_t input_padding_right,
+    uint32_t input_padding_bottom,
+    uint32_t input_padding_left,
+    uint32_t kernel_height,
+    uint32_t kernel_width,
+    uint32_t subsampling_height,
+    uint32_t subsampling_width,
+    uint32_t dilation_height,
+    uint32_t dilation_width,
+    uint32_t groups,
+    size_t group_input_channels,
+    size_t group_output_channels,
+    size_t input_pixel_stride,
+    size_t output_pixel_stride,
+    const void* packed_weights,
+    size_t packed_weights_size,
+    float output_min,
+    float output_max,
+    uint32_t flags,
+    xnn_operator_t* convolution_op_out)
+{
+  if (packed_weights == NULL) {
+    xnn_log_error("failed to create Convolution operator from packed weights: packed weights must be non-NULL");
+    return xnn_status_invalid_parameter;
+  }
+
+  return create_convolution2d_nhwc_f32(
+    input_padding_top, input_padding_right, input_padding_bottom, input_padding_left,
+    kernel_height, kernel_width,
+    subsampling_height, subsampling_width,
+    dilation_height, dilation_width,
+    groups, group_input_channels, group_output_channels,
+    input_pixel_stride, output_pixel_stride,
+    NULL /* kernel */, NULL /* bias */,
+    packed_weights, packed_weights_size,
+    output_min, output_max,
+    flags,
+    convolution_op_out);
+}
+
+static enum xnn_status setup_convolution2d_nhwc(
+  xnn_operator_t convolution_op,
+  size_t batch_size,
+  size_t input_height,
+  size_t input_width,
+  const void* input,
+  void* output,
+  uint32_t log2_input_element_size,
+  uint32_t log2_filter_element_size,
+  uint32_t bias_element_size,
+  uint32_t log2_output_element_size,
+  const void* params,
+  size_t num_threads)
+{
+  convolution_op->state = xnn_run_state_invalid;
+
+  if (!xnn_params.initialized) {
+    xnn_log_error("failed to setup Convolution operator: XNNPACK is not initialized");
+    return xnn_status_uninitialized;
+  }
+
+  if (input_width == 0 || input_height == 0) {
+    xnn_log_error(
+      "failed to setup Convolution operator with %zux%zu input: input dimensions must be non-zero",
+      input_width, input_height);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (batch_size == 0) {
+    convolution_op->state = xnn_run_state_skip;
+    return xnn_status_success;
+  }
+
+  convolution_op->batch_size = batch_size;
+  convolution_op->input_height = input_height;
+  convolution_op->input_width = input_width;
+  convolution_op->input = input;
+
+  convolution_op->output_height = compute_output_dimension(
+      convolution_op->padding_top + input_height + convolution_op->padding_bottom,
+      convolution_op->kernel_height,
+      convolution_op->dilation_height,
+      convolution_op->stride_height);
+  convolution_op->output_width = compute_output_dimension(
+      convolution_op->padding_left + input_width + convolution_op->padding_right,
+      convolution_op->kernel_width,
+      convolution_op->dilation_width,
+      convolution_op->stride_width);
+  convolution_op->output = output;
+
+  switch (convolution_op->ukernel.type) {
+    case xnn_ukernel_type_spmm:
+    {
+      // Convolution maps directly to SpMM on MR-pixel blocks of the input transposed into panels, and the results are
+      // transposed back into output pixels.
+      const size_t batch_output_size = batch_size * convolution_op->output_height * convolution_op->output_width;
+      const size_t input_channels = convolution_op->groups * convolution_op->group_input_channels;
+      const size_t output_channels = convolution_op->groups * convolution_op->group_output_channels;
+
+      const size_t mr = convolution_op->ukernel.spmm.mr;
+      const size_t workspace_stride = mr * (input_channels + output_channels) << log2_output_element_size;
+      const size_t packed_input_size = divide_round_up(batch_output_size, mr) * workspace_stride + XNN_EXTRA_BYTES;
+      if (packed_input_size > convolution_op->packed_input_size) {
+        xnn_release_memory(convolution_op->packed_input);
+        convolution_op->packed_input_size = 0;
+        convolution_op->packed_input = xnn_allocate_memory(packed_input_size);
+        if (convolution_op->packed_input == NULL) {
+          xnn_log_error("failed to allocate %zu bytes for transposed input and output", packed_input_size);
+          return xnn_status_out_of_memory;
+        }
+        convolution_op->packed_input_size = packed_input_size;
+      }
+
+      const float* nonzero_values = convolution_op->packed_weights;
+      const int32_t* input_increments =
+        (const int32_t*) (nonzero_values + convolution_op->num_nonzero_values + output_channels);
+      const uint32_t* output_channel_nonzeros =
+        (const uint32_t*) (input_increments + convolution_op->num_nonzero_blocks);
+      convolution_op->context.nhwc_spmm = (struct nhwc_spmm_context) {
+          .k = input_channels,
+          .n = output_channels,
+          .a = input,
           .a_stride = convolution_op->input_pixel_stride << log2_input_element_size,
-          .packed_w = convolution_op->packed_weights,
-          .w_stride = w_stride,
-          .wg_stride = w_stride * round_up(group_output_channels, nr),
+          .packed_weights = nonzero_values,
+          .input_increments = input_increments,
+          .output_channel_nonzeros = output_channel_nonzeros,
+          .first_input_channel = convolution_op->first_input_channel,
           .c = output,
-          .cm_stride = convolution_op->output_pixel_stride << log2_output_element_size,
-          .cn_stride = nr << log2_output_element_size,
-          .cg_stride = group_output_channels << log2_output_element_size,
-          .log2_csize = log2_output_element_size,
-          .ukernel = gemm_ukernel,
+          .c_stride = convolution_op->output_pixel_stride << log2_output_element_size,
+          .workspace = convolution_op->packed_input,
+          .workspace_stride = workspace_stride,
+          .mr = mr,
+          .ukernel = convolution_op->ukernel.spmm.function,
       };
-      memcpy(&convolution_op->context.gemm.params, params, sizeof(convolution_op->context.gemm.params));
+      memcpy(&convolution_op->context.nhwc_spmm.params, params, sizeof(convolution_op->context.nhwc_spmm.params));
+
+      convolution_op->compute.type = xnn_parallelization_type_1d_tile_1d;
+      convolution_op->compute.task_1d_tile_1d = (pthreadpool_task_1d_tile_1d_t) xnn_compute_nhwc_spmm;
+      convolution_op->compute.range[0] = batch_output_size;
+      convolution_op->compute.tile[0] = mr;
+      convolution_op->compute2.type = xnn_parallelization_type_invalid;
+      convolution_op->state = xnn_run_state_ready;
+
+      return xnn_status_success;
+    }
+    case xnn_ukernel_type_gemm:
+    {
+      // Convolution maps directly to GEMM and doesn't use indirection buffer.
+
+      const size_t output_height = convolution_op->output_height;
+      const size_t output_width = convolution_op->output_width;
+      const size_t output_size = output_height * output_width;
+      const size_t batch_output_size = batch_size * output_size;
+
+      const size_t groups = convolution_op->groups;
+      const size_t group_input_channels = convolution_op->group_input_channels;
+      const size_t w_stride = (round_up_po2(group_input_channels, convolution_op->ukernel.gemm.kr) << log2_filter_element_size) + bias_element_size;
+      const size_t group_output_channels = convolution_op->group_output_channels;
+
+      uint32_t mr = convolution_op->ukernel.gemm.mr;
+      const uint32_t nr = convolution_op->ukernel.gemm.nr;
+
+      const struct xnn_ukernel_ppmm* ppmm = &convolution_op->ukernel.gemm.ppmm;
+      const bool use_ppmm = ppmm->function != NULL && batch_output_size >= XNN_PPMM_MIN_BATCH_SIZE;
+      // Block K and N to keep panels of packed weights in cache when they don't fit into L2 cache.
+      const struct gemm_blocking_parameters* blocking = &xnn_params.f32.gemm_blocking;
+      const bool use_blocking = !use_ppmm && convolution_op->ukernel.gemm.inc_function != NULL &&
+        blocking->kc != 0 && batch_output_size > mr && group_input_channels > blocking->kc &&
+        group_output_channels * (group_input_channels << log2_filter_element_size) > blocking->min_weights_size;
+      if (use_ppmm) {
+        // Pack input pixels once into MR-row panels, then stream the panels through the PPMM micro-kernel for every
+        // NR block of output channels.
+        mr = ppmm->mr;
+        const size_t packed_input_size = round_up(batch_output_size, mr) * (group_input_channels << log2_input_element_size);
+        if (packed_input_size > convolution_op->packed_input_size) {
+          xnn_release_memory(convolution_op->packed_input);
+          convolution_op->packed_input_size = 0;
+          convolution_op->packed_input = xnn_allocate_memory(packed_input_size);
+          if (convolution_op->packed_input == NULL) {
+            xnn_log_error("failed to allocate %zu bytes for packed input", packed_input_size);
+            return xnn_status_out_of_memory;
+          }
+          convolution_op->packed_input_size = packed_input_size;
+        }
+
+        convolution_op->context.ppmm = (struct ppmm_context) {
+            .k = group_input_channels,
+            .k_scaled = group_input_channels << log2_input_element_size,
+            .a = input,
+            .a_stride = convolution_op->input_pixel_stride << log2_input_element_size,
+            .packed_a = convolution_op->packed_input,
+            .packed_w = convolution_op->packed_weights,
+            .w_stride = w_stride,
+            .c = output,
+            .cm_stride = convolution_op->output_pixel_stride << log2_output_element_size,
+            .cn_stride = nr << log2_output_element_size,
+            .log2_csize = log2_output_element_size,
+            .packx_ukernel = ppmm->packx_function,
+            .ppmm_ukernel = ppmm->function,
+        };
+        memcpy(&convolution_op->context.ppmm.params, params, sizeof(convolution_op->context.ppmm.params));
+      } else if (use_blocking) {
+        const size_t acc_tile_size = mr * nr << log2_output_element_size;
+        const size_t acc_size = divide_round_up(batch_output_size, mr) * divide_round_up(group_output_channels, nr) * acc_tile_size;
+        if (acc_size > convolution_op->partial_output_size) {
+          xnn_release_memory(convolution_op->partial_output);
+          convolution_op->partial_output_size = 0;
+          convolution_op->partial_output = xnn_allocate_memory(acc_size);
+          if (convolution_op->partial_output == NULL) {
+            xnn_log_error("failed to allocate %zu bytes for partial output", acc_size);
+            return xnn_status_out_of_memory;
+          }
+          convolution_op->partial_output_size = acc_size;
+        }
+
+        convolution_op->context.blocked_gemm = (struct blocked_gemm_context) {
+            .k_scaled = group_input_channels << log2_input_element_size,
+            .kc_scaled = blocking->kc << log2_input_element_size,
+            .a = input,
+            .a_stride = convolution_op->input_pixel_stride << log2_input_element_size,
+            .packed_w = convolution_op->packed_weights,
+            .w_stride = w_stride,
+            .w_bias_stride = bias_element_size * nr,
+            .c = output,
+            .cm_stride = convolution_op->output_pixel_stride << log2_output_element_size,
+            .cn_stride = nr << log2_output_element_size,
+            .acc_c = convolution_op->partial_output,
+            .acc_m_stride = divide_round_up(group_output_channels, nr) * acc_tile_size,
+            .acc_n_stride = acc_tile_size,
+            .mr = mr,
+            .nr = nr,
+            .log2_csize = log2_output_element_size,
+            .gemm_ukernel = convolution_op->ukernel.gemm.default_function,
+            .gemminc_ukernel = convolution_op->ukernel.gemm.inc_function,
+            .params.f32 = xnn_compute_f32_output_params(-INFINITY, +INFINITY),
+        };
+        memcpy(&convolution_op->context.blocked_gemm.output_params, params, sizeof(convolution_op->context.blocked_gemm.output_params));
+      } else {
+        xnn_gemm_ukernel_function gemm_ukernel = convolution_op->ukernel.gemm.default_function;
+        if (batch_output_size == 1 && convolution_op->ukernel.gemm.mr1_function != NULL) {
+          mr = 1;
+          gemm_ukernel = convolution_op->ukernel.gemm.mr1_function;
+        }
+
+        convolution_op->context.gemm = (struct gemm_context) {
+            .k_scaled = group_input_channels << log2_input_element_size,
+            .a = input,
+            .a_stride = convolution_op->input_pixel_stride << log2_input_element_size,
+            .packed_w = convolution_op->packed_weights,
+            .w_stride = w_stride,
+            .wg_stride = w_stride * round_up(group_output_channels, nr),
+            .c = output,
+            .cm_stride = convolution_op->output_pixel_stride << log2_output_element_size,
+            .cn_stride = nr << log2_output_element_size,
+            .cg_stride = group_output_channels << log2_output_element_size,
+            .log2_csize = log2_output_element_size,
+            .ukernel = gemm_ukernel,
+        };
+        memcpy(&convolution_op->context.gemm.params, params, sizeof(convolution_op->context.gemm.params));
+      }
 
       size_t nc = group_output_channels;
-      if (num_threads > 1) {
+      if (use_blocking) {
+        nc = min(nc, blocking->nc);
+        if (num_threads > 1) {
+          // Split N into smaller blocks if there are not enough blocks to keep all threads busy.
+          const size_t num_mc_blocks = divide_round_up(batch_output_size, blocking->mc);
+          const size_t max_nc = round_up(divide_round_up(group_output_channels * num_mc_blocks, num_threads), nr);
+          nc = min(nc, max_nc);
+        }
+      } else if (num_threads > 1) {
         const size_t num_other_tiles = groups * divide_round_up(batch_output_size, mr);
         const size_t target_tiles_per_thread = 5;
         const size_t max_nc = divide_round_up(group_output_channels * num_other_tiles, num_threads * target_tiles_per_thread);
@@ -840,7 +2006,26 @@ static enum xnn_status setup_convolution2d_nhwc(
           nc = min(nc, divide_round_up(nc, max_nc * nr) * nr);
         }
       }
-      if (groups == 1) {
+      convolution_op->compute2.type = xnn_parallelization_type_invalid;
+      if (use_ppmm) {
+        convolution_op->compute.type = xnn_parallelization_type_1d_tile_1d;
+        convolution_op->compute.task_1d_tile_1d = (pthreadpool_task_1d_tile_1d_t) xnn_compute_packx;
+        convolution_op->compute.range[0] = batch_output_size;
+        convolution_op->compute.tile[0] = mr;
+        convolution_op->compute2.type = xnn_parallelization_type_2d_tile_2d;
+        convolution_op->compute2.task_2d_tile_2d = (pthreadpool_task_2d_tile_2d_t) xnn_compute_ppmm;
+        convolution_op->compute2.range[0] = batch_output_size;
+        convolution_op->compute2.range[1] = group_output_channels;
+        convolution_op->compute2.tile[0] = mr;
+        convolution_op->compute2.tile[1] = nc;
+      } else if (use_blocking) {
+        convolution_op->compute.type = xnn_parallelization_type_2d_tile_2d;
+        convolution_op->compute.task_2d_tile_2d = (pthreadpool_task_2d_tile_2d_t) xnn_compute_blocked_gemm;
+        convolution_op->compute.range[0] = batch_output_size;
+        convolution_op->compute.range[1] = group_output_channels;
+        convolution_op->compute.tile[0] = blocking->mc;
+        convolution_op->compute.tile[1] = nc;
+      } else if (groups == 1) {
         convolution_op->compute.type = xnn_parallelization_type_2d_tile_2d;
         convolution_op->compute.task_2d_tile_2d = (pthreadpool_task_2d_tile_2d_t) xnn_compute_gemm;
         convolution_op->compute.range[0] = batch_output_size;
@@ -879,10 +2064,15 @@ static enum xnn_status setup_convolution2d_nhwc(
       }
 
       const size_t tiled_output_size = round_up(output_size, mr);
-      const size_t indirection_buffer_size = sizeof(void*) * kernel_size * tiled_output_size;
-
-      if (input_height != convolution_op->last_input_height ||
-          input_width != convolution_op->last_input_width)
+      const bool compact_indirection = convolution_op->compact_indirection &&
+        kernel_size * mr <= XNN_MAX_REBASED_INDIRECTION_POINTERS &&
+        input_height * input_width * convolution_op->input_pixel_stride < (size_t) XNN_COMPACT_INDIRECTION_ZERO;
+      const size_t indirection_buffer_size =
+        (compact_indirection ? sizeof(uint32_t) : sizeof(void*)) * kernel_size * tiled_output_size;
+
+      if ((input_height != convolution_op->last_input_height ||
+           input_width != convolution_op->last_input_width) &&
+          !xnn_switch_operator_shape(convolution_op, input_height, input_width))
       {
         const void** indirection_buffer = (const void**) realloc(convolution_op->indirection_buffer, indirection_buffer_size);
         if (indirection_buffer == NULL) {
@@ -894,7 +2084,11 @@ static enum xnn_status setup_convolution2d_nhwc(
         convolution_op->last_input_height = input_height;
         convolution_op->last_input_width = input_width;
 
-        xnn_indirection_init_conv2d(convolution_op, mr, log2_input_element_size);
+        if (compact_indirection) {
+          xnn_indirection_init_conv2d_compact(convolution_op, mr);
+        } else {
+          xnn_indirection_init_conv2d(convolution_op, mr, log2_input_element_size);
+        }
       }
 
       const size_t group_input_channels = convolution_op->group_input_channels;
@@ -907,6 +2101,8 @@ static enum xnn_status setup_convolution2d_nhwc(
           .w_stride = w_stride,
           .indirect_a = convolution_op->indirection_buffer,
           .a_offset = (size_t) ((uintptr_t) input - (uintptr_t) convolution_op->last_input),
+          .a = input,
+          .log2_asize = log2_input_element_size,
           .zero = convolution_op->zero_buffer,
           .packed_w = convolution_op->packed_weights,
           .c = convolution_op->output,
@@ -922,32 +2118,42 @@ static enum xnn_status setup_convolution2d_nhwc(
       };
       memcpy(&convolution_op->context.igemm.params, params, sizeof(convolution_op->context.igemm.params));
 
-      size_t nc = group_output_channels;
-      if (num_threads > 1) {
-        const size_t num_other_tiles = groups * batch_size * divide_round_up(output_size, mr);
-        const size_t target_tiles_per_thread = 5;
-        const size_t max_nc = divide_round_up(group_output_channels * num_other_tiles, num_threads * target_tiles_per_thread);
-        if (max_nc < nc) {
-          nc = min(nc, divide_round_up(nc, max_nc * nr) * nr);
+      // Compute parameters depend only on the input shape, batch size, and number of threads, and are reused if none
+      // of them changed since they were computed.
+      if (batch_size != convolution_op->shape_cache.plan_batch_size ||
+          num_threads != convolution_op->shape_cache.plan_num_threads)
+      {
+        size_t nc = group_output_channels;
+        if (num_threads > 1) {
+          const size_t num_other_tiles = groups * batch_size * divide_round_up(output_size, mr);
+          const size_t target_tiles_per_thread = 5;
+          const size_t max_nc = divide_round_up(group_output_channels * num_other_tiles, num_threads * target_tiles_per_thread);
+          if (max_nc < nc) {
+            nc = min(nc, divide_round_up(nc, max_nc * nr) * nr);
+          }
         }
-      }
-      if (groups == 1) {
-        convolution_op->compute.type = xnn_parallelization_type_3d_tile_2d;
-        convolution_op->compute.task_3d_tile_2d = (pthreadpool_task_3d_tile_2d_t) xnn_compute_igemm;
-        convolution_op->compute.range[0] = batch_size;
-        convolution_op->compute.range[1] = output_size;
-        convolution_op->compute.range[2] = group_output_channels;
-        convolution_op->compute.tile[0] = mr;
-        convolution_op->compute.tile[1] = nc;
-      } else {
-        convolution_op->compute.type = xnn_parallelization_type_4d_tile_2d;
-        convolution_op->compute.task_4d_tile_2d = (pthreadpool_task_4d_tile_2d_t) xnn_compute_gigemm;
-        convolution_op->compute.range[0] = batch_size;
-        convolution_op->compute.range[1] = groups;
-        convolution_op->compute.range[2] = output_size;
-        convolution_op->compute.range[3] = group_output_channels;
-        convolution_op->compute.tile[0] = mr;
-        convolution_op->compute.tile[1] = nc;
+        if (groups == 1) {
+          convolution_op->compute.type = xnn_parallelization_type_3d_tile_2d;
+          convolution_op->compute.task_3d_tile_2d = compact_indirection ?
+            (pthreadpool_task_3d_tile_2d_t) xnn_compute_igemm_compact : (pthreadpool_task_3d_tile_2d_t) xnn_compute_igemm;
+          convolution_op->compute.range[0] = batch_size;
+          convolution_op->compute.range[1] = output_size;
+          convolution_op->compute.range[2] = group_output_channels;
+          convolution_op->compute.tile[0] = mr;
+          convolution_op->compute.tile[1] = nc;
+        } else {
+          convolution_op->compute.type = xnn_parallelization_type_4d_tile_2d;
+          convolution_op->compute.task_4d_tile_2d = compact_indirection ?
+            (pthreadpool_task_4d_tile_2d_t) xnn_compute_gigemm_compact : (pthreadpool_task_4d_tile_2d_t) xnn_compute_gigemm;
+          convolution_op->compute.range[0] = batch_size;
+          convolution_op->compute.range[1] = groups;
+          convolution_op->compute.range[2] = output_size;
+          convolution_op->compute.range[3] = group_output_channels;
+          convolution_op->compute.tile[0] = mr;
+          convolution_op->compute.tile[1] = nc;
+        }
+        convolution_op->shape_cache.plan_batch_size = batch_size;
+        convolution_op->shape_cache.plan_num_threads = num_threads;
       }
       convolution_op->state = xnn_run_state_ready;
 
@@ -955,19 +2161,6 @@ static enum xnn_status setup_convolution2d_nhwc(
     }
     case xnn_ukernel_type_dwconv:
     {
-      size_t valid_batch_size = 0;
-      if (input == convolution_op->last_input &&
-          input_height == convolution_op->last_input_height &&
-          input_width == convolution_op->last_input_width)
-      {
-        valid_batch_size = convolution_op->valid_batch_size;
-        if (batch_size <= valid_batch_size) {
-          convolution_op->compute.range[0] = batch_size * convolution_op->output_height;
-          convolution_op->state = xnn_run_state_ready;
-          return xnn_status_success;
-        }
-      }
-
       const size_t kernel_height = convolution_op->kernel_height;
       const size_t kernel_width = convolution_op->kernel_width;
       const size_t kernel_size = kernel_height * kernel_width;
@@ -975,42 +2168,198 @@ static enum xnn_status setup_convolution2d_nhwc(
       const size_t output_width = convolution_op->output_width;
       const size_t step_width = convolution_op->dilation_width == 1 ? convolution_op->stride_width : kernel_width;
       const size_t step_height = kernel_size + (output_width * step_width - 1) * kernel_height;
-      const size_t indirection_buffer_size = sizeof(void*) * batch_size * output_height * step_height;
 
-      const void** indirection_buffer =
-        (const void**) realloc(convolution_op->indirection_buffer, indirection_buffer_size);
-      if (indirection_buffer == NULL) {
-        xnn_log_error("failed to allocate %zu bytes for indirection buffer", indirection_buffer_size);
-        return xnn_status_out_of_memory;
+      if (input_height != convolution_op->last_input_height ||
+          input_width != convolution_op->last_input_width)
+      {
+        xnn_switch_operator_shape(convolution_op, input_height, input_width);
+      }
+
+      const bool compact_indirection = convolution_op->compact_indirection &&
+        kernel_size <= XNN_MAX_REBASED_INDIRECTION_POINTERS &&
+        input_height * input_width * convolution_op->input_pixel_stride < (size_t) XNN_COMPACT_INDIRECTION_ZERO;
+      if (compact_indirection) {
+        // Compact indirection buffer covers a single image, and does not depend on the input pointer or batch size.
+        if (input_height != convolution_op->last_input_height ||
+            input_width != convolution_op->last_input_width)
+        {
+          const size_t indirection_buffer_size = sizeof(uint32_t) * output_height * step_height;
+          const void** indirection_buffer =
+            (const void**) realloc(convolution_op->indirection_buffer, indirection_buffer_size);
+          if (indirection_buffer == NULL) {
+            xnn_log_error("failed to allocate %zu bytes for indirection buffer", indirection_buffer_size);
+            return xnn_status_out_of_memory;
+          }
+          convolution_op->indirection_buffer = indirection_buffer;
+
+          xnn_indirection_init_dwconv2d_compact(convolution_op, step_height, step_width);
+
+          convolution_op->last_input = input;
+          convolution_op->last_input_height = input_height;
+          convolution_op->last_input_width = input_width;
+          convolution_op->valid_batch_size = 0;
+        }
+      } else {
+        // The indirection buffer stays valid when only the input pointer changes: setup rebases a cached copy of it to
+        // the new input pointer. It is extended incrementally for larger batches of the same input.
+        size_t valid_batch_size = 0;
+        if (input_height == convolution_op->last_input_height &&
+            input_width == convolution_op->last_input_width &&
+            (input == convolution_op->last_input || batch_size <= convolution_op->valid_batch_size))
+        {
+          valid_batch_size = convolution_op->valid_batch_size;
+        }
+
+        if (batch_size > valid_batch_size) {
+          const size_t indirection_buffer_size = sizeof(void*) * batch_size * output_height * step_height;
+          const void** indirection_buffer =
+            (const void**) realloc(convolution_op->indirection_buffer, indirection_buffer_size);
+          if (indirection_buffer == NULL) {
+            xnn_log_error("failed to allocate %zu bytes for indirection buffer", indirection_buffer_size);
+            return xnn_status_out_of_memory;
+          }
+          convolution_op->indirection_buffer = indirection_buffer;
+
+          xnn_indirection_init_dwconv2d(convolution_op, valid_batch_size, step_height, step_width, log2_input_element_size);
+
+          convolution_op->last_input = input;
+          convolution_op->last_input_height = input_height;
+          convolution_op->last_input_width = input_width;
+          convolution_op->valid_batch_size = batch_size;
+        }
       }
-      convolution_op->indirection_buffer = indirection_buffer;
 
-      xnn_indirection_init_dwconv2d(convolution_op, valid_batch_size, step_height, step_width, log2_input_element_size);
+      const void** indirection_buffer = convolution_op->indirection_buffer;
+      if (!compact_indirection) {
+        indirection_buffer = xnn_indirection_rebase(
+          convolution_op, convolution_op->last_input, input, batch_size * output_height * step_height,
+          convolution_op->zero_buffer);
+        if (indirection_buffer == NULL) {
+          return xnn_status_out_of_memory;
+        }
+      }
 
       const size_t groups = convolution_op->groups;
+      const size_t output_row_stride = output_width * convolution_op->output_pixel_stride << log2_output_element_size;
       convolution_op->context.dwconv = (struct dwconv_context) {
           .groups = groups,
-          .indirection_buffer = convolution_op->indirection_buffer,
+          .indirection_buffer = indirection_buffer,
           .indirection_buffer_row_stride = step_height,
           .indirection_buffer_col_stride = kernel_height * step_width * sizeof(void*),
+          .input = input,
+          .input_batch_stride = input_height * input_width * convolution_op->input_pixel_stride << log2_input_element_size,
+          .log2_input_element_size = log2_input_element_size,
+          .zero = convolution_op->zero_buffer,
           .packed_weights = convolution_op->packed_weights,
           .output = convolution_op->output,
+          .output_batch_stride = output_height * output_row_stride,
           .output_width = output_width,
-          .output_row_stride = output_width * convolution_op->output_pixel_stride << log2_output_element_size,
+          .output_row_stride = output_row_stride,
+          .output_col_stride = convolution_op->output_pixel_stride << log2_output_element_size,
           .output_col_increment = (convolution_op->output_pixel_stride - groups) << log2_output_element_size,
-          .unipass_ukernel = convolution_op->ukernel.dwconv.unipass_function,
+          .kernel_size = kernel_size,
       };
       memcpy(&convolution_op->context.dwconv.params, params, sizeof(convolution_op->context.dwconv.params));
 
-      convolution_op->compute.type = xnn_parallelization_type_1d;
-      convolution_op->compute.task_1d = (pthreadpool_task_1d_t) xnn_compute_dwconv_unipass;
-      convolution_op->compute.range[0] = batch_size * output_height;
+      if (compact_indirection) {
+        convolution_op->compute.type = xnn_parallelization_type_2d;
+        if (convolution_op->ukernel.dwconv.qr != 0) {
+          convolution_op->context.dwconv.multipass_ukernel = convolution_op->ukernel.dwconv.multipass_function;
+          convolution_op->compute.task_2d = (pthreadpool_task_2d_t) xnn_compute_dwconv_multipass_compact;
+        } else {
+          convolution_op->context.dwconv.unipass_ukernel = convolution_op->ukernel.dwconv.unipass_function;
+          convolution_op->compute.task_2d = (pthreadpool_task_2d_t) xnn_compute_dwconv_unipass_compact;
+        }
+        convolution_op->compute.range[0] = batch_size;
+        convolution_op->compute.range[1] = output_height;
+      } else {
+        convolution_op->compute.type = xnn_parallelization_type_1d;
+        if (convolution_op->ukernel.dwconv.qr != 0) {
+          convolution_op->context.dwconv.multipass_ukernel = convolution_op->ukernel.dwconv.multipass_function;
+          convolution_op->compute.task_1d = (pthreadpool_task_1d_t) xnn_compute_dwconv_multipass;
+        } else {
+          convolution_op->context.dwconv.unipass_ukernel = convolution_op->ukernel.dwconv.unipass_function;
+          convolution_op->compute.task_1d = (pthreadpool_task_1d_t) xnn_compute_dwconv_unipass;
+        }
+        convolution_op->compute.range[0] = batch_size * output_height;
+      }
       convolution_op->state = xnn_run_state_ready;
 
-      convolution_op->last_input = input;
-      convolution_op->last_input_height = input_height;
-      convolution_op->last_input_width = input_width;
-      convolution_op->valid_batch_size = max(valid_batch_size, batch_size);
+      return xnn_status_success;
+    }
+    case xnn_ukernel_type_winograd:
+    {
+      const size_t output_height = convolution_op->output_height;
+      const size_t output_width = convolution_op->output_width;
+      const size_t tile_rows = divide_round_up(output_height, 4);
+      const size_t tile_columns = divide_round_up(output_width, 4);
+      const size_t num_tiles = batch_size * tile_rows * tile_columns;
+
+      const size_t group_input_channels = convolution_op->group_input_channels;
+      const size_t group_output_channels = convolution_op->group_output_channels;
+      const size_t tile_stride = group_input_channels << log2_input_element_size;
+      const size_t position_stride = num_tiles * tile_stride;
+      const size_t transformed_input_size = 36 * position_stride + XNN_EXTRA_BYTES;
+      if (transformed_input_size > convolution_op->transformed_input_size) {
+        xnn_release_memory(convolution_op->transformed_input);
+        convolution_op->transformed_input_size = 0;
+        convolution_op->transformed_input = xnn_allocate_memory(transformed_input_size);
+        if (convolution_op->transformed_input == NULL) {
+          xnn_log_error("failed to allocate %zu bytes for transformed input", transformed_input_size);
+          return xnn_status_out_of_memory;
+        }
+        convolution_op->transformed_input_size = transformed_input_size;
+      }
+
+      const uint32_t mr = convolution_op->ukernel.winograd.mr;
+      const uint32_t nr = convolution_op->ukernel.winograd.nr;
+      const size_t input_pixel_stride = convolution_op->input_pixel_stride << log2_input_element_size;
+      const size_t output_pixel_stride = convolution_op->output_pixel_stride << log2_output_element_size;
+      const size_t w_stride = (round_up_po2(group_input_channels, convolution_op->ukernel.winograd.kr) << log2_filter_element_size) + bias_element_size;
+      convolution_op->context.winograd = (struct winograd_context) {
+          .input_height = input_height,
+          .input_width = input_width,
+          .input = input,
+          .input_pixel_stride = input_pixel_stride,
+          .input_batch_stride = input_height * input_width * input_pixel_stride,
+          .zero = convolution_op->zero_buffer,
+          .padding_top = convolution_op->padding_top,
+          .padding_left = convolution_op->padding_left,
+          .tile_rows = tile_rows,
+          .tile_columns = tile_columns,
+          .channels = group_input_channels,
+          .transformed_input = convolution_op->transformed_input,
+          .tile_stride = tile_stride,
+          .position_stride = position_stride,
+          .k_scaled = group_input_channels << log2_input_element_size,
+          .packed_w = convolution_op->packed_weights,
+          .w_stride = w_stride,
+          .w_position_stride = w_stride * round_up(group_output_channels, nr),
+          .mr = mr,
+          .nr = nr,
+          .output_height = output_height,
+          .output_width = output_width,
+          .output = output,
+          .output_pixel_stride = output_pixel_stride,
+          .output_batch_stride = output_height * output_width * output_pixel_stride,
+          .input_ukernel = convolution_op->ukernel.winograd.input_function,
+          .gemm_ukernel = convolution_op->ukernel.winograd.gemm_function,
+          .output_ukernel = convolution_op->ukernel.winograd.output_function,
+          .gemm_params.f32 = xnn_compute_f32_output_params(-INFINITY, +INFINITY),
+      };
+      memcpy(&convolution_op->context.winograd.params, params, sizeof(convolution_op->context.winograd.params));
+
+      convolution_op->compute.type = xnn_parallelization_type_2d;
+      convolution_op->compute.task_2d = (pthreadpool_task_2d_t) xnn_compute_winograd_input;
+      convolution_op->compute.range[0] = batch_size * tile_rows;
+      convolution_op->compute.range[1] = tile_columns;
+      convolution_op->compute2.type = xnn_parallelization_type_2d_tile_2d;
+      convolution_op->compute2.task_2d_tile_2d = (pthreadpool_task_2d_tile_2d_t) xnn_compute_winograd_gemm;
+      convolution_op->compute2.range[0] = num_tiles;
+      convolution_op->compute2.range[1] = group_output_channels;
+      convolution_op->compute2.tile[0] = mr;
+      convolution_op->compute2.tile[1] = nr;
+      convolution_op->state = xnn_run_state_ready;
 
       return xnn_status_success;
     }
@@ -1077,6 +2426,58 @@ enum xnn_status xnn_setup_convolution2d_nhwc_q8(
     pthreadpool_get_threads_count(threadpool));
 }
 
+enum xnn_status xnn_setup_convolution2d_nhwc_q8c(
+    xnn_operator_t convolution_op,
+    size_t batch_size,
+    size_t input_height,
+    size_t input_width,
+    const uint8_t* input,
+    uint8_t* output,
+    pthreadpool_t threadpool)
+{
+  if (convolution_op->type != xnn_operator_type_convolution_q8c) {
+    xnn_log_error("failed to setup Convolution (Q8, per-channel) operator: operator type mismatch");
+    return xnn_status_invalid_parameter;
+  }
+
+  return setup_convolution2d_nhwc(
+    convolution_op,
+    batch_size, input_height, input_width,
+    input, output,
+    0 /* log2(sizeof(input element)) = log2(sizeof(uint8_t)) */,
+    0 /* log2(sizeof(filter element)) = log2(sizeof(uint8_t)) */,
+    sizeof(int32_t) + sizeof(float) /* sizeof(bias element) + sizeof(requantization scale) */,
+    0 /* log2(sizeof(output element)) = log2(sizeof(uint8_t)) */,
+    &convolution_op->q8c_gemm_params,
+    pthreadpool_get_threads_count(threadpool));
+}
+
+enum xnn_status xnn_setup_convolution2d_nhwc_f16(
+    xnn_operator_t convolution_op,
+    size_t batch_size,
+    size_t input_height,
+    size_t input_width,
+    const void* input,
+    void* output,
+    pthreadpool_t threadpool)
+{
+  if (convolution_op->type != xnn_operator_type_convolution_f16) {
+    xnn_log_error("failed to setup Convolution (F16) operator: operator type mismatch");
+    return xnn_status_invalid_parameter;
+  }
+
+  return setup_convolution2d_nhwc(
+    convolution_op,
+    batch_size, input_height, input_width,
+    input, output,
+    1 /* log2(sizeof(input element)) = log2(sizeof(uint16_t)) */,
+    1 /* log2(sizeof(filter element)) = log2(sizeof(uint16_t)) */,
+    sizeof(uint16_t) /* sizeof(bias element) */,
+    1 /* log2(sizeof(output element)) = log2(sizeof(uint16_t)) */,
+    &convolution_op->f16_output_params,
+    pthreadpool_get_threads_count(threadpool));
+}
+
 enum xnn_status xnn_setup_convolution2d_nhwc_f32(
     xnn_operator_t convolution_op,
     size_t batch_size,
@@ -1091,13 +2492,27 @@ enum xnn_status xnn_setup_convolution2d_nhwc_f32(
     return xnn_status_invalid_parameter;
   }
 
+  uint32_t log2_filter_element_size = 2 /* log2(sizeof(float)) */;
+  uint32_t bias_element_size = sizeof(float);
+  switch (convolution_op->weights_type) {
+    case xnn_weights_type_f16:
+      log2_filter_element_size = 1 /* log2(sizeof(uint16_t)) */;
+      break;
+    case xnn_weights_type_qc8:
+      log2_filter_element_size = 0 /* log2(sizeof(int8_t)) */;
+      bias_element_size = sizeof(float) + sizeof(float) /* sizeof(bias element) + sizeof(dequantization scale) */;
+      break;
+    default:
+      break;
+  }
+
   return setup_convolution2d_nhwc(
     convolution_op,
     batch_size, input_height, input_width,
     input, output,
     2 /* log2(sizeof(input element)) = log2(sizeof(float)) */,
-    2 /* log2(sizeof(filter element)) = log2(sizeof(float)) */,
-    sizeof(float) /* sizeof(bias element) */,
+    log2_filter_element_size,
+    bias_element_size,
     2 /* log2(sizeof(output element)) = log2(sizeof(float)) */,
     &convolution_op->f32_output_params,
     pthreadpool_get_threads_count(threadpool));
@@ -700,8 +700,11 @@ static enum xnn_status setup_subconv2d_path(
     deconvolution_op->last_input_width = input_width;
 
     xnn_indirection_init_subconv2d(deconvolution_op, mr, log2_input_element_size);
+    deconvolution_op->last_output = NULL;
+  }
 
-    // Initialize subconvolution parameters which depend on output dimensions or MR.
+  if (output != deconvolution_op->last_output) {
+    // Initialize subconvolution parameters which depend on output pointer, output dimensions, or MR.
     struct subconvolution_params* subconvolution_params = deconvolution_op->subconvolution_buffer;
     const size_t modulo_padding_top = deconvolution_op->padding_top % stride_height;
     const size_t modulo_padding_left = deconvolution_op->padding_left % stride_width;
@@ -718,6 +721,7 @@ static enum xnn_status setup_subconv2d_path(
         ++subconvolution_params;
       }
     }
+    deconvolution_op->last_output = output;
   }
 
   const size_t group_input_channels = deconvolution_op->group_input_channels;
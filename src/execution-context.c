@@ -0,0 +1,111 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <stddef.h>
+#include <string.h>
+
+#include <xnnpack.h>
+#include <xnnpack/allocator.h>
+#include <xnnpack/log.h>
+#include <xnnpack/operator.h>
+#include <xnnpack/params.h>
+
+
+enum xnn_status xnn_create_execution_context(
+    xnn_operator_t op,
+    xnn_operator_t* context_out)
+{
+  xnn_operator_t context = NULL;
+  enum xnn_status status = xnn_status_uninitialized;
+
+  if (!xnn_params.initialized) {
+    xnn_log_error("failed to create execution context: XNNPACK is not initialized");
+    goto error;
+  }
+
+  status = xnn_status_invalid_parameter;
+
+  if (op == NULL) {
+    xnn_log_error("failed to create execution context: operator is NULL");
+    goto error;
+  }
+
+  status = xnn_status_unsupported_parameter;
+
+  switch (op->type) {
+    case xnn_operator_type_convolution_spnchw_f32:
+    case xnn_operator_type_global_average_pooling_spnchw_f32:
+      xnn_log_error(
+        "failed to create execution context for operator type %d: operators in SpNCHW layout are not supported",
+        op->type);
+      goto error;
+    default:
+      break;
+  }
+
+  status = xnn_status_out_of_memory;
+
+  context = xnn_allocate_memory(sizeof(struct xnn_operator));
+  if (context == NULL) {
+    xnn_log_error("failed to allocate %zu bytes for execution context descriptor", sizeof(struct xnn_operator));
+    goto error;
+  }
+
+  // Share parameters, micro-kernels, packed weights, lookup table, and zero buffer with the parent operator.
+  memcpy(context, op, sizeof(struct xnn_operator));
+  context->parent = op->parent != NULL ? op->parent : op;
+
+  // Per-run state is produced by setup, and can't be shared between concurrent runs.
+  context->indirection_buffer = NULL;
+  context->a_sum = NULL;
+  context->pixelwise_buffer = NULL;
+  context->packed_input = NULL;
+  context->packed_input_size = 0;
+  context->partial_output = NULL;
+  context->partial_output_size = 0;
+  context->transformed_input = NULL;
+  context->transformed_input_size = 0;
+  context->subconvolution_buffer = NULL;
+  context->input = NULL;
+  context->input2 = NULL;
+  context->output = NULL;
+  context->valid_batch_size = 0;
+  context->last_input = NULL;
+  context->last_input_height = 0;
+  context->last_input_width = 0;
+  context->last_output = NULL;
+  memset(&context->rebased_indirection, 0, sizeof(context->rebased_indirection));
+  memset(&context->profiling, 0, sizeof(context->profiling));
+  memset(&context->shape_cache, 0, sizeof(context->shape_cache));
+  memset(&context->context, 0, sizeof(context->context));
+  context->state = xnn_run_state_invalid;
+
+  if (op->subconvolution_buffer != NULL) {
+    // Subconvolution parameters combine packed weights pointers set at create time with indirection pointers set at
+    // setup time.
+    const size_t subconvolution_buffer_size =
+      sizeof(struct subconvolution_params) * op->stride_height * op->stride_width;
+    context->subconvolution_buffer = xnn_allocate_memory(subconvolution_buffer_size);
+    if (context->subconvolution_buffer == NULL) {
+      xnn_log_error("failed to allocate %zu bytes for subconvolution buffer", subconvolution_buffer_size);
+      goto error;
+    }
+    memcpy(context->subconvolution_buffer, op->subconvolution_buffer, subconvolution_buffer_size);
+  }
+
+  if (op->shape_cache.max_entries != 0) {
+    status = xnn_enable_operator_shape_cache(context, op->shape_cache.max_entries);
+    if (status != xnn_status_success) {
+      goto error;
+    }
+  }
+
+  *context_out = context;
+  return xnn_status_success;
+
+error:
+  xnn_delete_operator(context);
+  return status;
+}
@@ -0,0 +1,56 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/clamp.h>
+
+
+void xnn_f16_clamp_ukernel__f16c(
+    size_t n,
+    const void* x_ptr,
+    void* y_ptr,
+    const struct xnn_f16_output_params params[restrict static 1])
+{
+  assert(n != 0);
+  assert(n % sizeof(uint16_t) == 0);
+
+  const uint16_t* x = (const uint16_t*) x_ptr;
+  uint16_t* y = (uint16_t*) y_ptr;
+  const __m256 vy_max = _mm256_set1_ps(_cvtsh_ss(params->max));
+  const __m256 vy_min = _mm256_set1_ps(_cvtsh_ss(params->min));
+
+  for (; n >= 8 * sizeof(uint16_t); n -= 8 * sizeof(uint16_t)) {
+    const __m256 vx = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) x));
+    x += 8;
+
+    const __m256 vy = _mm256_min_ps(_mm256_max_ps(vx, vy_min), vy_max);
+
+    _mm_storeu_si128((__m128i*) y, _mm256_cvtps_ph(vy, _MM_FROUND_NO_EXC));
+    y += 8;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    const __m256 vx = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) x));
+
+    const __m256 vy = _mm256_min_ps(_mm256_max_ps(vx, vy_min), vy_max);
+
+    __m128i vh = _mm256_cvtps_ph(vy, _MM_FROUND_NO_EXC);
+    if (n & 4 * sizeof(uint16_t)) {
+      _mm_storel_epi64((__m128i*) y, vh);
+      vh = _mm_unpackhi_epi64(vh, vh);
+      y += 4;
+    }
+    if (n & 2 * sizeof(uint16_t)) {
+      *((uint32_t*) y) = (uint32_t) _mm_cvtsi128_si32(vh);
+      vh = _mm_srli_epi64(vh, 32);
+      y += 2;
+    }
+    if (n & 1 * sizeof(uint16_t)) {
+      *y = (uint16_t) _mm_extract_epi16(vh, 0);
+    }
+  }
+}
@@ -0,0 +1,48 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <fp16.h>
+
+#include <xnnpack/clamp.h>
+#include <xnnpack/math.h>
+
+
+void xnn_f16_clamp_ukernel__scalar(
+    size_t n,
+    const void* x_ptr,
+    void* y_ptr,
+    const struct xnn_f16_output_params params[restrict static 1])
+{
+  assert(n != 0);
+  assert(n % sizeof(uint16_t) == 0);
+
+  const uint16_t* x = (const uint16_t*) x_ptr;
+  uint16_t* y = (uint16_t*) y_ptr;
+  const float vy_max = fp16_ieee_to_fp32_value(params->max);
+  const float vy_min = fp16_ieee_to_fp32_value(params->min);
+
+  for (; n >= 2 * sizeof(uint16_t); n -= 2 * sizeof(uint16_t)) {
+    const float vx0 = fp16_ieee_to_fp32_value(x[0]);
+    const float vx1 = fp16_ieee_to_fp32_value(x[1]);
+    x += 2;
+
+    float vy0 = math_max_f32(vx0, vy_min);
+    float vy1 = math_max_f32(vx1, vy_min);
+    vy0 = math_min_f32(vy0, vy_max);
+    vy1 = math_min_f32(vy1, vy_max);
+
+    y[0] = fp16_ieee_from_fp32_value(vy0);
+    y[1] = fp16_ieee_from_fp32_value(vy1);
+    y += 2;
+  }
+  if (n != 0) {
+    const float vx = fp16_ieee_to_fp32_value(*x);
+    float vy = math_max_f32(vx, vy_min);
+    vy = math_min_f32(vy, vy_max);
+    *y = fp16_ieee_from_fp32_value(vy);
+  }
+}
@@ -0,0 +1,99 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f16-dwconv/up-scalar.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <fp16.h>
+
+#include <xnnpack/dwconv.h>
+#include <xnnpack/math.h>
+
+
+void xnn_f16_dwconv_ukernel_up1x9__scalar(
+    size_t channels,
+    size_t output_width,
+    const void** input,
+    const void* weights,
+    void* output_ptr,
+    size_t input_stride,
+    size_t output_increment,
+    const struct xnn_f16_output_params params[restrict static 1])
+{
+  assert(channels != 0);
+  assert(output_width != 0);
+
+  uint16_t* output = (uint16_t*) output_ptr;
+  const float vmin = fp16_ieee_to_fp32_value(params->min);
+  const float vmax = fp16_ieee_to_fp32_value(params->max);
+  do {
+    const uint16_t* i0 = (const uint16_t*) input[0];
+    const uint16_t* i1 = (const uint16_t*) input[1];
+    const uint16_t* i2 = (const uint16_t*) input[2];
+    const uint16_t* i3 = (const uint16_t*) input[3];
+    const uint16_t* i4 = (const uint16_t*) input[4];
+    const uint16_t* i5 = (const uint16_t*) input[5];
+    const uint16_t* i6 = (const uint16_t*) input[6];
+    const uint16_t* i7 = (const uint16_t*) input[7];
+    const uint16_t* i8 = (const uint16_t*) input[8];
+    input = (const void**) ((uintptr_t) input + input_stride);
+
+    size_t c = channels;
+    const uint16_t* w = (const uint16_t*) weights;
+    do {
+      float vacc0 = fp16_ieee_to_fp32_value(w[0]);
+
+      const float vi0 = fp16_ieee_to_fp32_value(*i0++);
+      const float vk0 = fp16_ieee_to_fp32_value(w[1]);
+      vacc0 += vi0 * vk0;
+
+      const float vi1 = fp16_ieee_to_fp32_value(*i1++);
+      const float vk1 = fp16_ieee_to_fp32_value(w[2]);
+      float vacc1 = vi1 * vk1;
+
+      const float vi2 = fp16_ieee_to_fp32_value(*i2++);
+      const float vk2 = fp16_ieee_to_fp32_value(w[3]);
+      vacc0 += vi2 * vk2;
+
+      const float vi3 = fp16_ieee_to_fp32_value(*i3++);
+      const float vk3 = fp16_ieee_to_fp32_value(w[4]);
+      vacc1 += vi3 * vk3;
+
+      const float vi4 = fp16_ieee_to_fp32_value(*i4++);
+      const float vk4 = fp16_ieee_to_fp32_value(w[5]);
+      vacc0 += vi4 * vk4;
+
+      const float vi5 = fp16_ieee_to_fp32_value(*i5++);
+      const float vk5 = fp16_ieee_to_fp32_value(w[6]);
+      vacc1 += vi5 * vk5;
+
+      const float vi6 = fp16_ieee_to_fp32_value(*i6++);
+      const float vk6 = fp16_ieee_to_fp32_value(w[7]);
+      vacc0 += vi6 * vk6;
+
+      const float vi7 = fp16_ieee_to_fp32_value(*i7++);
+      const float vk7 = fp16_ieee_to_fp32_value(w[8]);
+      vacc1 += vi7 * vk7;
+
+      const float vi8 = fp16_ieee_to_fp32_value(*i8++);
+      const float vk8 = fp16_ieee_to_fp32_value(w[9]);
+      vacc0 += vi8 * vk8;
+
+      w += 10;
+
+      vacc0 += vacc1;
+
+      vacc0 = math_max_f32(vacc0, vmin);
+      vacc0 = math_min_f32(vacc0, vmax);
+
+      *output++ = fp16_ieee_from_fp32_value(vacc0);
+    } while (--c != 0);
+
+    output = (uint16_t*) ((uintptr_t) output + output_increment);
+  } while (--output_width != 0);
+}
@@ -0,0 +1,168 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f16-dwconv/up-f16c.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/dwconv.h>
+
+
+void xnn_f16_dwconv_ukernel_up8x9__f16c(
+    size_t channels,
+    size_t output_width,
+    const void** input,
+    const void* weights,
+    void* output_ptr,
+    size_t input_stride,
+    size_t output_increment,
+    const struct xnn_f16_output_params params[restrict static 1])
+{
+  assert(channels != 0);
+  assert(output_width != 0);
+
+  uint16_t* output = (uint16_t*) output_ptr;
+  const __m256 vmin = _mm256_set1_ps(_cvtsh_ss(params->min));
+  const __m256 vmax = _mm256_set1_ps(_cvtsh_ss(params->max));
+  do {
+    const uint16_t* i0 = (const uint16_t*) input[0];
+    const uint16_t* i1 = (const uint16_t*) input[1];
+    const uint16_t* i2 = (const uint16_t*) input[2];
+    const uint16_t* i3 = (const uint16_t*) input[3];
+    const uint16_t* i4 = (const uint16_t*) input[4];
+    const uint16_t* i5 = (const uint16_t*) input[5];
+    const uint16_t* i6 = (const uint16_t*) input[6];
+    const uint16_t* i7 = (const uint16_t*) input[7];
+    const uint16_t* i8 = (const uint16_t*) input[8];
+    input = (const void**) ((uintptr_t) input + input_stride);
+
+    size_t c = channels;
+    const uint16_t* w = (const uint16_t*) weights;
+    for (; c >= 8; c -= 8) {
+      __m256 vacc0 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) w));
+
+      const __m256 vi0 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i0));
+      const __m256 vk0 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 8)));
+      vacc0 = _mm256_add_ps(vacc0, _mm256_mul_ps(vi0, vk0));
+      i0 += 8;
+
+      const __m256 vi1 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i1));
+      const __m256 vk1 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 16)));
+      __m256 vacc1 = _mm256_mul_ps(vi1, vk1);
+      i1 += 8;
+
+      const __m256 vi2 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i2));
+      const __m256 vk2 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 24)));
+      vacc0 = _mm256_add_ps(vacc0, _mm256_mul_ps(vi2, vk2));
+      i2 += 8;
+
+      const __m256 vi3 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i3));
+      const __m256 vk3 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 32)));
+      vacc1 = _mm256_add_ps(vacc1, _mm256_mul_ps(vi3, vk3));
+      i3 += 8;
+
+      const __m256 vi4 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i4));
+      const __m256 vk4 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 40)));
+      vacc0 = _mm256_add_ps(vacc0, _mm256_mul_ps(vi4, vk4));
+      i4 += 8;
+
+      const __m256 vi5 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i5));
+      const __m256 vk5 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 48)));
+      vacc1 = _mm256_add_ps(vacc1, _mm256_mul_ps(vi5, vk5));
+      i5 += 8;
+
+      const __m256 vi6 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i6));
+      const __m256 vk6 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 56)));
+      vacc0 = _mm256_add_ps(vacc0, _mm256_mul_ps(vi6, vk6));
+      i6 += 8;
+
+      const __m256 vi7 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i7));
+      const __m256 vk7 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 64)));
+      vacc1 = _mm256_add_ps(vacc1, _mm256_mul_ps(vi7, vk7));
+      i7 += 8;
+
+      const __m256 vi8 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i8));
+      const __m256 vk8 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 72)));
+      vacc0 = _mm256_add_ps(vacc0, _mm256_mul_ps(vi8, vk8));
+      i8 += 8;
+
+      w += 80;
+
+      vacc0 = _mm256_add_ps(vacc0, vacc1);
+
+      vacc0 = _mm256_max_ps(vacc0, vmin);
+      vacc0 = _mm256_min_ps(vacc0, vmax);
+
+      _mm_storeu_si128((__m128i*) output, _mm256_cvtps_ph(vacc0, _MM_FROUND_NO_EXC));
+      output += 8;
+    }
+    if XNN_UNLIKELY(c != 0) {
+      __m256 vacc = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) w));
+
+      const __m256 vi0 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i0));
+      const __m256 vk0 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 8)));
+      vacc = _mm256_add_ps(vacc, _mm256_mul_ps(vi0, vk0));
+
+      const __m256 vi1 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i1));
+      const __m256 vk1 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 16)));
+      vacc = _mm256_add_ps(vacc, _mm256_mul_ps(vi1, vk1));
+
+      const __m256 vi2 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i2));
+      const __m256 vk2 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 24)));
+      vacc = _mm256_add_ps(vacc, _mm256_mul_ps(vi2, vk2));
+
+      const __m256 vi3 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i3));
+      const __m256 vk3 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 32)));
+      vacc = _mm256_add_ps(vacc, _mm256_mul_ps(vi3, vk3));
+
+      const __m256 vi4 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i4));
+      const __m256 vk4 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 40)));
+      vacc = _mm256_add_ps(vacc, _mm256_mul_ps(vi4, vk4));
+
+      const __m256 vi5 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i5));
+      const __m256 vk5 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 48)));
+      vacc = _mm256_add_ps(vacc, _mm256_mul_ps(vi5, vk5));
+
+      const __m256 vi6 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i6));
+      const __m256 vk6 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 56)));
+      vacc = _mm256_add_ps(vacc, _mm256_mul_ps(vi6, vk6));
+
+      const __m256 vi7 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i7));
+      const __m256 vk7 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 64)));
+      vacc = _mm256_add_ps(vacc, _mm256_mul_ps(vi7, vk7));
+
+      const __m256 vi8 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i8));
+      const __m256 vk8 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 72)));
+      vacc = _mm256_add_ps(vacc, _mm256_mul_ps(vi8, vk8));
+
+      w += 80;
+
+      vacc = _mm256_max_ps(vacc, vmin);
+      vacc = _mm256_min_ps(vacc, vmax);
+
+      __m128i vh = _mm256_cvtps_ph(vacc, _MM_FROUND_NO_EXC);
+      if (c & 4) {
+        _mm_storel_epi64((__m128i*) output, vh);
+        vh = _mm_unpackhi_epi64(vh, vh);
+        output += 4;
+      }
+      if (c & 2) {
+        *((uint32_t*) output) = (uint32_t) _mm_cvtsi128_si32(vh);
+        vh = _mm_srli_epi64(vh, 32);
+        output += 2;
+      }
+      if (c & 1) {
+        *output = (uint16_t) _mm_extract_epi16(vh, 0);
+        output += 1;
+      }
+    }
+
+    output = (uint16_t*) ((uintptr_t) output + output_increment);
+  } while (--output_width != 0);
+}
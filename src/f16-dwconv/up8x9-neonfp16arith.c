@@ -0,0 +1,151 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f16-dwconv/up-neonfp16arith.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/dwconv.h>
+
+
+void xnn_f16_dwconv_ukernel_up8x9__neonfp16arith(
+    size_t channels,
+    size_t output_width,
+    const void** input,
+    const void* weights,
+    void* output_ptr,
+    size_t input_stride,
+    size_t output_increment,
+    const struct xnn_f16_output_params params[restrict static 1])
+{
+  assert(channels != 0);
+  assert(output_width != 0);
+
+  __fp16* output = (__fp16*) output_ptr;
+  const float16x8_t vmax = vld1q_dup_f16((const __fp16*) &params->max);
+  const float16x8_t vmin = vld1q_dup_f16((const __fp16*) &params->min);
+  do {
+    const __fp16* i0 = (const __fp16*) input[0];
+    const __fp16* i1 = (const __fp16*) input[1];
+    const __fp16* i2 = (const __fp16*) input[2];
+    const __fp16* i3 = (const __fp16*) input[3];
+    const __fp16* i4 = (const __fp16*) input[4];
+    const __fp16* i5 = (const __fp16*) input[5];
+    const __fp16* i6 = (const __fp16*) input[6];
+    const __fp16* i7 = (const __fp16*) input[7];
+    const __fp16* i8 = (const __fp16*) input[8];
+    input = (const void**) ((uintptr_t) input + input_stride);
+
+    size_t c = channels;
+    const __fp16* w = (const __fp16*) weights;
+    for (; c >= 8; c -= 8) {
+      float16x8_t vacc0 = vld1q_f16(w); w += 8;
+
+      const float16x8_t vi0 = vld1q_f16(i0); i0 += 8;
+      const float16x8_t vk0 = vld1q_f16(w); w += 8;
+      vacc0 = vfmaq_f16(vacc0, vi0, vk0);
+
+      const float16x8_t vi1 = vld1q_f16(i1); i1 += 8;
+      const float16x8_t vk1 = vld1q_f16(w); w += 8;
+      float16x8_t vacc1 = vmulq_f16(vi1, vk1);
+
+      const float16x8_t vi2 = vld1q_f16(i2); i2 += 8;
+      const float16x8_t vk2 = vld1q_f16(w); w += 8;
+      vacc0 = vfmaq_f16(vacc0, vi2, vk2);
+
+      const float16x8_t vi3 = vld1q_f16(i3); i3 += 8;
+      const float16x8_t vk3 = vld1q_f16(w); w += 8;
+      vacc1 = vfmaq_f16(vacc1, vi3, vk3);
+
+      const float16x8_t vi4 = vld1q_f16(i4); i4 += 8;
+      const float16x8_t vk4 = vld1q_f16(w); w += 8;
+      vacc0 = vfmaq_f16(vacc0, vi4, vk4);
+
+      const float16x8_t vi5 = vld1q_f16(i5); i5 += 8;
+      const float16x8_t vk5 = vld1q_f16(w); w += 8;
+      vacc1 = vfmaq_f16(vacc1, vi5, vk5);
+
+      const float16x8_t vi6 = vld1q_f16(i6); i6 += 8;
+      const float16x8_t vk6 = vld1q_f16(w); w += 8;
+      vacc0 = vfmaq_f16(vacc0, vi6, vk6);
+
+      const float16x8_t vi7 = vld1q_f16(i7); i7 += 8;
+      const float16x8_t vk7 = vld1q_f16(w); w += 8;
+      vacc1 = vfmaq_f16(vacc1, vi7, vk7);
+
+      const float16x8_t vi8 = vld1q_f16(i8); i8 += 8;
+      const float16x8_t vk8 = vld1q_f16(w); w += 8;
+      vacc0 = vfmaq_f16(vacc0, vi8, vk8);
+
+      vacc0 = vaddq_f16(vacc0, vacc1);
+
+      vacc0 = vmaxq_f16(vacc0, vmin);
+      vacc0 = vminq_f16(vacc0, vmax);
+
+      vst1q_f16(output, vacc0); output += 8;
+    }
+    if XNN_UNLIKELY(c != 0) {
+      float16x8_t vacc = vld1q_f16(w); w += 8;
+
+      const float16x8_t vi0 = vld1q_f16(i0);
+      const float16x8_t vk0 = vld1q_f16(w); w += 8;
+      vacc = vfmaq_f16(vacc, vi0, vk0);
+
+      const float16x8_t vi1 = vld1q_f16(i1);
+      const float16x8_t vk1 = vld1q_f16(w); w += 8;
+      vacc = vfmaq_f16(vacc, vi1, vk1);
+
+      const float16x8_t vi2 = vld1q_f16(i2);
+      const float16x8_t vk2 = vld1q_f16(w); w += 8;
+      vacc = vfmaq_f16(vacc, vi2, vk2);
+
+      const float16x8_t vi3 = vld1q_f16(i3);
+      const float16x8_t vk3 = vld1q_f16(w); w += 8;
+      vacc = vfmaq_f16(vacc, vi3, vk3);
+
+      const float16x8_t vi4 = vld1q_f16(i4);
+      const float16x8_t vk4 = vld1q_f16(w); w += 8;
+      vacc = vfmaq_f16(vacc, vi4, vk4);
+
+      const float16x8_t vi5 = vld1q_f16(i5);
+      const float16x8_t vk5 = vld1q_f16(w); w += 8;
+      vacc = vfmaq_f16(vacc, vi5, vk5);
+
+      const float16x8_t vi6 = vld1q_f16(i6);
+      const float16x8_t vk6 = vld1q_f16(w); w += 8;
+      vacc = vfmaq_f16(vacc, vi6, vk6);
+
+      const float16x8_t vi7 = vld1q_f16(i7);
+      const float16x8_t vk7 = vld1q_f16(w); w += 8;
+      vacc = vfmaq_f16(vacc, vi7, vk7);
+
+      const float16x8_t vi8 = vld1q_f16(i8);
+      const float16x8_t vk8 = vld1q_f16(w); w += 8;
+      vacc = vfmaq_f16(vacc, vi8, vk8);
+
+      vacc = vmaxq_f16(vacc, vmin);
+      vacc = vminq_f16(vacc, vmax);
+
+      float16x4_t vacc_lo = vget_low_f16(vacc);
+      if (c & 4) {
+        vst1_f16(output, vacc_lo); output += 4;
+        vacc_lo = vget_high_f16(vacc);
+      }
+      if (c & 2) {
+        vst1_lane_u32(__builtin_assume_aligned(output, 1), vreinterpret_u32_f16(vacc_lo), 0); output += 2;
+        vacc_lo = vext_f16(vacc_lo, vacc_lo, 2);
+      }
+      if (c & 1) {
+        vst1_lane_f16(output, vacc_lo, 0); output += 1;
+      }
+    }
+
+    output = (__fp16*) ((uintptr_t) output + output_increment);
+  } while (--output_width != 0);
+}
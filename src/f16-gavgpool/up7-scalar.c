@@ -0,0 +1,81 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <fp16.h>
+
+#include <xnnpack/gavgpool.h>
+#include <xnnpack/math.h>
+
+
+void xnn_f16_gavgpool_ukernel_up7__scalar(
+    size_t m,
+    size_t n,
+    const void* input,
+    size_t input_stride,
+    const void* zero,
+    void* output_ptr,
+    const struct xnn_f16_output_params params[restrict static 1])
+{
+  assert(m != 0);
+  assert(m <= 7);
+  assert(n != 0);
+
+  const uint16_t* i0 = (const uint16_t*) input;
+  const uint16_t* i1 = (const uint16_t*) ((uintptr_t) i0 + input_stride);
+  if (m < 2) {
+    i1 = (const uint16_t*) zero;
+  }
+  const uint16_t* i2 = (const uint16_t*) ((uintptr_t) i1 + input_stride);
+  if (m <= 2) {
+    i2 = (const uint16_t*) zero;
+  }
+  const uint16_t* i3 = (const uint16_t*) ((uintptr_t) i2 + input_stride);
+  if (m < 4) {
+    i3 = (const uint16_t*) zero;
+  }
+  const uint16_t* i4 = (const uint16_t*) ((uintptr_t) i3 + input_stride);
+  if (m <= 4) {
+    i4 = (const uint16_t*) zero;
+  }
+  const uint16_t* i5 = (const uint16_t*) ((uintptr_t) i4 + input_stride);
+  if (m < 6) {
+    i5 = (const uint16_t*) zero;
+  }
+  const uint16_t* i6 = (const uint16_t*) ((uintptr_t) i5 + input_stride);
+  if (m <= 6) {
+    i6 = (const uint16_t*) zero;
+  }
+
+  uint16_t* output = (uint16_t*) output_ptr;
+  const float vscale = fp16_ieee_to_fp32_value(params->scale);
+  const float vmin = fp16_ieee_to_fp32_value(params->min);
+  const float vmax = fp16_ieee_to_fp32_value(params->max);
+  do {
+    const float vi0 = fp16_ieee_to_fp32_value(*i0++);
+    const float vi1 = fp16_ieee_to_fp32_value(*i1++);
+    const float vi2 = fp16_ieee_to_fp32_value(*i2++);
+    const float vi3 = fp16_ieee_to_fp32_value(*i3++);
+    const float vi4 = fp16_ieee_to_fp32_value(*i4++);
+    const float vi5 = fp16_ieee_to_fp32_value(*i5++);
+    const float vi6 = fp16_ieee_to_fp32_value(*i6++);
+
+    const float vsum01 = vi0 + vi1;
+    const float vsum23 = vi2 + vi3;
+    const float vsum45 = vi4 + vi5;
+
+    const float vsum016 = vsum01 + vi6;
+    const float vsum2345 = vsum23 + vsum45;
+
+    const float vsum = vsum016 + vsum2345;
+
+    float vout = vsum * vscale;
+    vout = math_max_f32(vout, vmin);
+    vout = math_min_f32(vout, vmax);
+
+    *output++ = fp16_ieee_from_fp32_value(vout);
+  } while (--n != 0);
+}
@@ -0,0 +1,111 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f16-gemm/scalar.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <fp16.h>
+
+#include <xnnpack/gemm.h>
+#include <xnnpack/math.h>
+
+
+void xnn_f16_gemm_ukernel_1x4__scalar(
+    size_t mr,
+    size_t nc,
+    size_t kc,
+    const void* restrict a,
+    size_t a_stride,
+    const void* restrict w,
+    void* restrict c,
+    size_t cm_stride,
+    size_t cn_stride,
+    const struct xnn_f16_output_params params[restrict static 1])
+{
+  assert(mr != 0);
+  assert(mr <= 1);
+  assert(nc != 0);
+  assert(kc != 0);
+  assert(kc % sizeof(uint16_t) == 0);
+  assert(a != NULL);
+  assert(w != NULL);
+  assert(c != NULL);
+
+  const uint16_t* a0 = a;
+  uint16_t* c0 = c;
+
+  const uint16_t* restrict b = w;
+  // Products are accumulated in single precision, and rounded to half precision only once for the output.
+  const float vscale = fp16_ieee_to_fp32_value(params->scale);
+  const float vmin = fp16_ieee_to_fp32_value(params->min);
+  const float vmax = fp16_ieee_to_fp32_value(params->max);
+  do {
+    float vacc00 = fp16_ieee_to_fp32_value(b[0]);
+    float vacc01 = fp16_ieee_to_fp32_value(b[1]);
+    float vacc02 = fp16_ieee_to_fp32_value(b[2]);
+    float vacc03 = fp16_ieee_to_fp32_value(b[3]);
+    b += 4;
+
+    size_t k = kc;
+    do {
+      const float va0 = fp16_ieee_to_fp32_value(*a0++);
+
+      const float vb0 = fp16_ieee_to_fp32_value(b[0]);
+      const float vb1 = fp16_ieee_to_fp32_value(b[1]);
+      const float vb2 = fp16_ieee_to_fp32_value(b[2]);
+      const float vb3 = fp16_ieee_to_fp32_value(b[3]);
+      b += 4;
+
+      vacc00 += va0 * vb0;
+      vacc01 += va0 * vb1;
+      vacc02 += va0 * vb2;
+      vacc03 += va0 * vb3;
+
+      k -= sizeof(uint16_t);
+    } while (k != 0);
+
+    vacc00 *= vscale;
+    vacc01 *= vscale;
+    vacc02 *= vscale;
+    vacc03 *= vscale;
+
+    vacc00 = math_max_f32(vacc00, vmin);
+    vacc01 = math_max_f32(vacc01, vmin);
+    vacc02 = math_max_f32(vacc02, vmin);
+    vacc03 = math_max_f32(vacc03, vmin);
+
+    vacc00 = math_min_f32(vacc00, vmax);
+    vacc01 = math_min_f32(vacc01, vmax);
+    vacc02 = math_min_f32(vacc02, vmax);
+    vacc03 = math_min_f32(vacc03, vmax);
+
+    if XNN_LIKELY(nc >= 4) {
+      c0[0] = fp16_ieee_from_fp32_value(vacc00);
+      c0[1] = fp16_ieee_from_fp32_value(vacc01);
+      c0[2] = fp16_ieee_from_fp32_value(vacc02);
+      c0[3] = fp16_ieee_from_fp32_value(vacc03);
+      c0 = (uint16_t*) ((uintptr_t) c0 + cn_stride);
+
+      a0 = (const uint16_t*) ((uintptr_t) a0 - kc);
+
+      nc -= 4;
+    } else {
+      if (nc & 2) {
+        c0[0] = fp16_ieee_from_fp32_value(vacc00);
+        c0[1] = fp16_ieee_from_fp32_value(vacc01);
+        vacc00 = vacc02;
+        c0 += 2;
+      }
+      if (nc & 1) {
+        c0[0] = fp16_ieee_from_fp32_value(vacc00);
+      }
+
+      nc = 0;
+    }
+  } while (nc != 0);
+}
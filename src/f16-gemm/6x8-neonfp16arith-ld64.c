@@ -88,12 +88,12 @@ void xnn_f16_gemm_ukernel_6x8__neonfp16arith_ld64(
       const float16x8_t vb01234567c0 = vld1q_f16(w); w = (const void*) ((uintptr_t) w + sizeof(float16x8_t));
 
       #if defined(__aarch64__)
-          vacc0x01234567 = vfmaq_lane_f16(vacc0x01234567, vb01234567c0, va0, 0);
-          vacc1x01234567 = vfmaq_lane_f16(vacc1x01234567, vb01234567c0, va1, 0);
-          vacc2x01234567 = vfmaq_lane_f16(vacc2x01234567, vb01234567c0, va2, 0);
-          vacc3x01234567 = vfmaq_lane_f16(vacc3x01234567, vb01234567c0, va3, 0);
-          vacc4x01234567 = vfmaq_lane_f16(vacc4x01234567, vb01234567c0, va4, 0);
-          vacc5x01234567 = vfmaq_lane_f16(vacc5x01234567, vb01234567c0, va5, 0);
+        vacc0x01234567 = vfmaq_lane_f16(vacc0x01234567, vb01234567c0, va0, 0);
+        vacc1x01234567 = vfmaq_lane_f16(vacc1x01234567, vb01234567c0, va1, 0);
+        vacc2x01234567 = vfmaq_lane_f16(vacc2x01234567, vb01234567c0, va2, 0);
+        vacc3x01234567 = vfmaq_lane_f16(vacc3x01234567, vb01234567c0, va3, 0);
+        vacc4x01234567 = vfmaq_lane_f16(vacc4x01234567, vb01234567c0, va4, 0);
+        vacc5x01234567 = vfmaq_lane_f16(vacc5x01234567, vb01234567c0, va5, 0);
       #else
         const float16x8_t va0c0 = vdupq_lane_f16(va0, 0);
         const float16x8_t va1c0 = vdupq_lane_f16(va1, 0);
@@ -112,12 +112,12 @@ void xnn_f16_gemm_ukernel_6x8__neonfp16arith_ld64(
       const float16x8_t vb01234567c1 = vld1q_f16(w); w = (const void*) ((uintptr_t) w + sizeof(float16x8_t));
 
       #if defined(__aarch64__)
-          vacc0x01234567 = vfmaq_lane_f16(vacc0x01234567, vb01234567c1, va0, 1);
-          vacc1x01234567 = vfmaq_lane_f16(vacc1x01234567, vb01234567c1, va1, 1);
-          vacc2x01234567 = vfmaq_lane_f16(vacc2x01234567, vb01234567c1, va2, 1);
-          vacc3x01234567 = vfmaq_lane_f16(vacc3x01234567, vb01234567c1, va3, 1);
-          vacc4x01234567 = vfmaq_lane_f16(vacc4x01234567, vb01234567c1, va4, 1);
-          vacc5x01234567 = vfmaq_lane_f16(vacc5x01234567, vb01234567c1, va5, 1);
+        vacc0x01234567 = vfmaq_lane_f16(vacc0x01234567, vb01234567c1, va0, 1);
+        vacc1x01234567 = vfmaq_lane_f16(vacc1x01234567, vb01234567c1, va1, 1);
+        vacc2x01234567 = vfmaq_lane_f16(vacc2x01234567, vb01234567c1, va2, 1);
+        vacc3x01234567 = vfmaq_lane_f16(vacc3x01234567, vb01234567c1, va3, 1);
+        vacc4x01234567 = vfmaq_lane_f16(vacc4x01234567, vb01234567c1, va4, 1);
+        vacc5x01234567 = vfmaq_lane_f16(vacc5x01234567, vb01234567c1, va5, 1);
       #else
         const float16x8_t va0c1 = vdupq_lane_f16(va0, 1);
         const float16x8_t va1c1 = vdupq_lane_f16(va1, 1);
@@ -136,12 +136,12 @@ void xnn_f16_gemm_ukernel_6x8__neonfp16arith_ld64(
       const float16x8_t vb01234567c2 = vld1q_f16(w); w = (const void*) ((uintptr_t) w + sizeof(float16x8_t));
 
       #if defined(__aarch64__)
-          vacc0x01234567 = vfmaq_lane_f16(vacc0x01234567, vb01234567c2, va0, 2);
-          vacc1x01234567 = vfmaq_lane_f16(vacc1x01234567, vb01234567c2, va1, 2);
-          vacc2x01234567 = vfmaq_lane_f16(vacc2x01234567, vb01234567c2, va2, 2);
-          vacc3x01234567 = vfmaq_lane_f16(vacc3x01234567, vb01234567c2, va3, 2);
-          vacc4x01234567 = vfmaq_lane_f16(vacc4x01234567, vb01234567c2, va4, 2);
-          vacc5x01234567 = vfmaq_lane_f16(vacc5x01234567, vb01234567c2, va5, 2);
+        vacc0x01234567 = vfmaq_lane_f16(vacc0x01234567, vb01234567c2, va0, 2);
+        vacc1x01234567 = vfmaq_lane_f16(vacc1x01234567, vb01234567c2, va1, 2);
+        vacc2x01234567 = vfmaq_lane_f16(vacc2x01234567, vb01234567c2, va2, 2);
+        vacc3x01234567 = vfmaq_lane_f16(vacc3x01234567, vb01234567c2, va3, 2);
+        vacc4x01234567 = vfmaq_lane_f16(vacc4x01234567, vb01234567c2, va4, 2);
+        vacc5x01234567 = vfmaq_lane_f16(vacc5x01234567, vb01234567c2, va5, 2);
       #else
         const float16x8_t va0c2 = vdupq_lane_f16(va0, 2);
         const float16x8_t va1c2 = vdupq_lane_f16(va1, 2);
@@ -160,12 +160,12 @@ void xnn_f16_gemm_ukernel_6x8__neonfp16arith_ld64(
       const float16x8_t vb01234567c3 = vld1q_f16(w); w = (const void*) ((uintptr_t) w + sizeof(float16x8_t));
 
       #if defined(__aarch64__)
-          vacc0x01234567 = vfmaq_lane_f16(vacc0x01234567, vb01234567c3, va0, 3);
-          vacc1x01234567 = vfmaq_lane_f16(vacc1x01234567, vb01234567c3, va1, 3);
-          vacc2x01234567 = vfmaq_lane_f16(vacc2x01234567, vb01234567c3, va2, 3);
-          vacc3x01234567 = vfmaq_lane_f16(vacc3x01234567, vb01234567c3, va3, 3);
-          vacc4x01234567 = vfmaq_lane_f16(vacc4x01234567, vb01234567c3, va4, 3);
-          vacc5x01234567 = vfmaq_lane_f16(vacc5x01234567, vb01234567c3, va5, 3);
+        vacc0x01234567 = vfmaq_lane_f16(vacc0x01234567, vb01234567c3, va0, 3);
+        vacc1x01234567 = vfmaq_lane_f16(vacc1x01234567, vb01234567c3, va1, 3);
+        vacc2x01234567 = vfmaq_lane_f16(vacc2x01234567, vb01234567c3, va2, 3);
+        vacc3x01234567 = vfmaq_lane_f16(vacc3x01234567, vb01234567c3, va3, 3);
+        vacc4x01234567 = vfmaq_lane_f16(vacc4x01234567, vb01234567c3, va4, 3);
+        vacc5x01234567 = vfmaq_lane_f16(vacc5x01234567, vb01234567c3, va5, 3);
       #else
         const float16x8_t va0c3 = vdupq_lane_f16(va0, 3);
         const float16x8_t va1c3 = vdupq_lane_f16(va1, 3);
@@ -253,12 +253,12 @@ void xnn_f16_gemm_ukernel_6x8__neonfp16arith_ld64(
 
       nc -= 8;
     } else {
-      float16x4_t vacc0x0123 = vget_low_f32(vacc0x01234567);
-      float16x4_t vacc1x0123 = vget_low_f32(vacc1x01234567);
-      float16x4_t vacc2x0123 = vget_low_f32(vacc2x01234567);
-      float16x4_t vacc3x0123 = vget_low_f32(vacc3x01234567);
-      float16x4_t vacc4x0123 = vget_low_f32(vacc4x01234567);
-      float16x4_t vacc5x0123 = vget_low_f32(vacc5x01234567);
+      float16x4_t vacc0x0123 = vget_low_f16(vacc0x01234567);
+      float16x4_t vacc1x0123 = vget_low_f16(vacc1x01234567);
+      float16x4_t vacc2x0123 = vget_low_f16(vacc2x01234567);
+      float16x4_t vacc3x0123 = vget_low_f16(vacc3x01234567);
+      float16x4_t vacc4x0123 = vget_low_f16(vacc4x01234567);
+      float16x4_t vacc5x0123 = vget_low_f16(vacc5x01234567);
       if (nc & 4) {
         vst1_f16(c0, vacc0x0123); c0 += 4;
         vst1_f16(c1, vacc1x0123); c1 += 4;
@@ -267,12 +267,12 @@ void xnn_f16_gemm_ukernel_6x8__neonfp16arith_ld64(
         vst1_f16(c4, vacc4x0123); c4 += 4;
         vst1_f16(c5, vacc5x0123); c5 += 4;
 
-        vacc0x0123 = vget_high_f32(vacc0x01234567);
-        vacc1x0123 = vget_high_f32(vacc1x01234567);
-        vacc2x0123 = vget_high_f32(vacc2x01234567);
-        vacc3x0123 = vget_high_f32(vacc3x01234567);
-        vacc4x0123 = vget_high_f32(vacc4x01234567);
-        vacc5x0123 = vget_high_f32(vacc5x01234567);
+        vacc0x0123 = vget_high_f16(vacc0x01234567);
+        vacc1x0123 = vget_high_f16(vacc1x01234567);
+        vacc2x0123 = vget_high_f16(vacc2x01234567);
+        vacc3x0123 = vget_high_f16(vacc3x01234567);
+        vacc4x0123 = vget_high_f16(vacc4x01234567);
+        vacc5x0123 = vget_high_f16(vacc5x01234567);
       }
       if (nc & 2) {
         vst1_lane_u32(__builtin_assume_aligned(c0, 1), vreinterpret_u32_f16(vacc0x0123), 0); c0 += 2;
@@ -0,0 +1,238 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f16-igemm/scalar.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <fp16.h>
+
+#include <xnnpack/igemm.h>
+#include <xnnpack/math.h>
+
+
+void xnn_f16_igemm_ukernel_4x4__scalar(
+    size_t mr,
+    size_t nc,
+    size_t kc,
+    size_t ks,
+    const void**restrict a,
+    const void*restrict w,
+    void*restrict c,
+    size_t cm_stride,
+    size_t cn_stride,
+    size_t a_offset,
+    const void* zero,
+    const struct xnn_f16_output_params params[restrict static 1])
+{
+  assert(mr != 0);
+  assert(mr <= 4);
+  assert(nc != 0);
+  assert(kc != 0);
+  assert(kc % sizeof(uint16_t) == 0);
+  assert(ks != 0);
+  assert(ks % (4 * sizeof(void*)) == 0);
+  assert(a_offset % sizeof(uint16_t) == 0);
+
+  uint16_t* c0 = c;
+  uint16_t* c1 = (uint16_t*) ((uintptr_t) c0 + cm_stride);
+  if XNN_UNPREDICTABLE(mr < 2) {
+    c1 = c0;
+  }
+  uint16_t* c2 = (uint16_t*) ((uintptr_t) c1 + cm_stride);
+  if XNN_UNPREDICTABLE(mr <= 2) {
+    c2 = c1;
+  }
+  uint16_t* c3 = (uint16_t*) ((uintptr_t) c2 + cm_stride);
+  if XNN_UNPREDICTABLE(mr != 4) {
+    c3 = c2;
+  }
+
+  const uint16_t* restrict b = w;
+  // Products are accumulated in single precision, and rounded to half precision only once for the output.
+  const float vscale = fp16_ieee_to_fp32_value(params->scale);
+  const float vmin = fp16_ieee_to_fp32_value(params->min);
+  const float vmax = fp16_ieee_to_fp32_value(params->max);
+  do {
+    float vacc00 = fp16_ieee_to_fp32_value(b[0]);
+    float vacc01 = fp16_ieee_to_fp32_value(b[1]);
+    float vacc02 = fp16_ieee_to_fp32_value(b[2]);
+    float vacc03 = fp16_ieee_to_fp32_value(b[3]);
+    float vacc10 = vacc00;
+    float vacc11 = vacc01;
+    float vacc12 = vacc02;
+    float vacc13 = vacc03;
+    float vacc20 = vacc00;
+    float vacc21 = vacc01;
+    float vacc22 = vacc02;
+    float vacc23 = vacc03;
+    float vacc30 = vacc00;
+    float vacc31 = vacc01;
+    float vacc32 = vacc02;
+    float vacc33 = vacc03;
+    b += 4;
+
+    size_t p = ks;
+    do {
+      const uint16_t* restrict a0 = (const uint16_t*) a[0];
+      if XNN_UNPREDICTABLE(a0 != zero) {
+        a0 = (const uint16_t*) ((uintptr_t) a0 + a_offset);
+      }
+      const uint16_t* restrict a1 = (const uint16_t*) a[1];
+      if XNN_UNPREDICTABLE(a1 != zero) {
+        a1 = (const uint16_t*) ((uintptr_t) a1 + a_offset);
+      }
+      const uint16_t* restrict a2 = (const uint16_t*) a[2];
+      if XNN_UNPREDICTABLE(a2 != zero) {
+        a2 = (const uint16_t*) ((uintptr_t) a2 + a_offset);
+      }
+      const uint16_t* restrict a3 = (const uint16_t*) a[3];
+      if XNN_UNPREDICTABLE(a3 != zero) {
+        a3 = (const uint16_t*) ((uintptr_t) a3 + a_offset);
+      }
+      a += 4;
+
+      size_t k = kc;
+      do {
+        const float va0 = fp16_ieee_to_fp32_value(*a0++);
+        const float va1 = fp16_ieee_to_fp32_value(*a1++);
+        const float va2 = fp16_ieee_to_fp32_value(*a2++);
+        const float va3 = fp16_ieee_to_fp32_value(*a3++);
+
+        const float vb0 = fp16_ieee_to_fp32_value(b[0]);
+        const float vb1 = fp16_ieee_to_fp32_value(b[1]);
+        const float vb2 = fp16_ieee_to_fp32_value(b[2]);
+        const float vb3 = fp16_ieee_to_fp32_value(b[3]);
+        b += 4;
+
+        vacc00 += va0 * vb0;
+        vacc01 += va0 * vb1;
+        vacc02 += va0 * vb2;
+        vacc03 += va0 * vb3;
+        vacc10 += va1 * vb0;
+        vacc11 += va1 * vb1;
+        vacc12 += va1 * vb2;
+        vacc13 += va1 * vb3;
+        vacc20 += va2 * vb0;
+        vacc21 += va2 * vb1;
+        vacc22 += va2 * vb2;
+        vacc23 += va2 * vb3;
+        vacc30 += va3 * vb0;
+        vacc31 += va3 * vb1;
+        vacc32 += va3 * vb2;
+        vacc33 += va3 * vb3;
+
+        k -= sizeof(uint16_t);
+      } while (k != 0);
+      p -= 4 * sizeof(void*);
+    } while (p != 0);
+
+    vacc00 *= vscale;
+    vacc01 *= vscale;
+    vacc02 *= vscale;
+    vacc03 *= vscale;
+    vacc10 *= vscale;
+    vacc11 *= vscale;
+    vacc12 *= vscale;
+    vacc13 *= vscale;
+    vacc20 *= vscale;
+    vacc21 *= vscale;
+    vacc22 *= vscale;
+    vacc23 *= vscale;
+    vacc30 *= vscale;
+    vacc31 *= vscale;
+    vacc32 *= vscale;
+    vacc33 *= vscale;
+
+    vacc00 = math_max_f32(vacc00, vmin);
+    vacc01 = math_max_f32(vacc01, vmin);
+    vacc02 = math_max_f32(vacc02, vmin);
+    vacc03 = math_max_f32(vacc03, vmin);
+    vacc10 = math_max_f32(vacc10, vmin);
+    vacc11 = math_max_f32(vacc11, vmin);
+    vacc12 = math_max_f32(vacc12, vmin);
+    vacc13 = math_max_f32(vacc13, vmin);
+    vacc20 = math_max_f32(vacc20, vmin);
+    vacc21 = math_max_f32(vacc21, vmin);
+    vacc22 = math_max_f32(vacc22, vmin);
+    vacc23 = math_max_f32(vacc23, vmin);
+    vacc30 = math_max_f32(vacc30, vmin);
+    vacc31 = math_max_f32(vacc31, vmin);
+    vacc32 = math_max_f32(vacc32, vmin);
+    vacc33 = math_max_f32(vacc33, vmin);
+
+    vacc00 = math_min_f32(vacc00, vmax);
+    vacc01 = math_min_f32(vacc01, vmax);
+    vacc02 = math_min_f32(vacc02, vmax);
+    vacc03 = math_min_f32(vacc03, vmax);
+    vacc10 = math_min_f32(vacc10, vmax);
+    vacc11 = math_min_f32(vacc11, vmax);
+    vacc12 = math_min_f32(vacc12, vmax);
+    vacc13 = math_min_f32(vacc13, vmax);
+    vacc20 = math_min_f32(vacc20, vmax);
+    vacc21 = math_min_f32(vacc21, vmax);
+    vacc22 = math_min_f32(vacc22, vmax);
+    vacc23 = math_min_f32(vacc23, vmax);
+    vacc30 = math_min_f32(vacc30, vmax);
+    vacc31 = math_min_f32(vacc31, vmax);
+    vacc32 = math_min_f32(vacc32, vmax);
+    vacc33 = math_min_f32(vacc33, vmax);
+
+    if XNN_LIKELY(nc >= 4) {
+      c3[0] = fp16_ieee_from_fp32_value(vacc30);
+      c3[1] = fp16_ieee_from_fp32_value(vacc31);
+      c3[2] = fp16_ieee_from_fp32_value(vacc32);
+      c3[3] = fp16_ieee_from_fp32_value(vacc33);
+      c3 = (uint16_t*) ((uintptr_t) c3 + cn_stride);
+      c2[0] = fp16_ieee_from_fp32_value(vacc20);
+      c2[1] = fp16_ieee_from_fp32_value(vacc21);
+      c2[2] = fp16_ieee_from_fp32_value(vacc22);
+      c2[3] = fp16_ieee_from_fp32_value(vacc23);
+      c2 = (uint16_t*) ((uintptr_t) c2 + cn_stride);
+      c1[0] = fp16_ieee_from_fp32_value(vacc10);
+      c1[1] = fp16_ieee_from_fp32_value(vacc11);
+      c1[2] = fp16_ieee_from_fp32_value(vacc12);
+      c1[3] = fp16_ieee_from_fp32_value(vacc13);
+      c1 = (uint16_t*) ((uintptr_t) c1 + cn_stride);
+      c0[0] = fp16_ieee_from_fp32_value(vacc00);
+      c0[1] = fp16_ieee_from_fp32_value(vacc01);
+      c0[2] = fp16_ieee_from_fp32_value(vacc02);
+      c0[3] = fp16_ieee_from_fp32_value(vacc03);
+      c0 = (uint16_t*) ((uintptr_t) c0 + cn_stride);
+
+      a = (const void**restrict) ((uintptr_t) a - ks);
+      nc -= 4;
+    } else {
+      if (nc & 2) {
+        c3[0] = fp16_ieee_from_fp32_value(vacc30);
+        c3[1] = fp16_ieee_from_fp32_value(vacc31);
+        vacc30 = vacc32;
+        c3 += 2;
+        c2[0] = fp16_ieee_from_fp32_value(vacc20);
+        c2[1] = fp16_ieee_from_fp32_value(vacc21);
+        vacc20 = vacc22;
+        c2 += 2;
+        c1[0] = fp16_ieee_from_fp32_value(vacc10);
+        c1[1] = fp16_ieee_from_fp32_value(vacc11);
+        vacc10 = vacc12;
+        c1 += 2;
+        c0[0] = fp16_ieee_from_fp32_value(vacc00);
+        c0[1] = fp16_ieee_from_fp32_value(vacc01);
+        vacc00 = vacc02;
+        c0 += 2;
+      }
+      if (nc & 1) {
+        c3[0] = fp16_ieee_from_fp32_value(vacc30);
+        c2[0] = fp16_ieee_from_fp32_value(vacc20);
+        c1[0] = fp16_ieee_from_fp32_value(vacc10);
+        c0[0] = fp16_ieee_from_fp32_value(vacc00);
+      }
+
+      nc = 0;
+    }
+  } while (nc != 0);
+}
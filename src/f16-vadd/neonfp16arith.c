@@ -0,0 +1,56 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/vadd.h>
+
+
+void xnn_f16_vadd_ukernel__neonfp16arith(
+    size_t n,
+    const void* a_ptr,
+    const void* b_ptr,
+    void* y_ptr,
+    const struct xnn_f16_output_params params[restrict static 1])
+{
+  assert(n != 0);
+  assert(n % sizeof(__fp16) == 0);
+
+  const __fp16* a = (const __fp16*) a_ptr;
+  const __fp16* b = (const __fp16*) b_ptr;
+  __fp16* y = (__fp16*) y_ptr;
+  const float16x8_t vy_max = vld1q_dup_f16((const __fp16*) &params->max);
+  const float16x8_t vy_min = vld1q_dup_f16((const __fp16*) &params->min);
+
+  for (; n >= 8 * sizeof(__fp16); n -= 8 * sizeof(__fp16)) {
+    const float16x8_t va = vld1q_f16(a); a += 8;
+    const float16x8_t vb = vld1q_f16(b); b += 8;
+
+    const float16x8_t vy = vminq_f16(vmaxq_f16(vaddq_f16(va, vb), vy_min), vy_max);
+
+    vst1q_f16(y, vy); y += 8;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    const float16x8_t va = vld1q_f16(a);
+    const float16x8_t vb = vld1q_f16(b);
+
+    const float16x8_t vy = vminq_f16(vmaxq_f16(vaddq_f16(va, vb), vy_min), vy_max);
+
+    float16x4_t vy_lo = vget_low_f16(vy);
+    if (n & 4 * sizeof(__fp16)) {
+      vst1_f16(y, vy_lo); y += 4;
+      vy_lo = vget_high_f16(vy);
+    }
+    if (n & 2 * sizeof(__fp16)) {
+      vst1_lane_u32(__builtin_assume_aligned(y, 1), vreinterpret_u32_f16(vy_lo), 0); y += 2;
+      vy_lo = vext_f16(vy_lo, vy_lo, 2);
+    }
+    if (n & 1 * sizeof(__fp16)) {
+      vst1_lane_f16(y, vy_lo, 0);
+    }
+  }
+}
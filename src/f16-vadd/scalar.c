@@ -0,0 +1,59 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <fp16.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/math.h>
+#include <xnnpack/vadd.h>
+
+
+void xnn_f16_vadd_ukernel__scalar(
+    size_t n,
+    const void* a_ptr,
+    const void* b_ptr,
+    void* y_ptr,
+    const struct xnn_f16_output_params params[restrict static 1])
+{
+  assert(n != 0);
+  assert(n % sizeof(uint16_t) == 0);
+
+  const uint16_t* a = (const uint16_t*) a_ptr;
+  const uint16_t* b = (const uint16_t*) b_ptr;
+  uint16_t* y = (uint16_t*) y_ptr;
+  const float vy_min = fp16_ieee_to_fp32_value(params->min);
+  const float vy_max = fp16_ieee_to_fp32_value(params->max);
+
+  for (; n >= 2 * sizeof(uint16_t); n -= 2 * sizeof(uint16_t)) {
+    const float va0 = fp16_ieee_to_fp32_value(a[0]);
+    const float va1 = fp16_ieee_to_fp32_value(a[1]);
+    a += 2;
+
+    const float vb0 = fp16_ieee_to_fp32_value(b[0]);
+    const float vb1 = fp16_ieee_to_fp32_value(b[1]);
+    b += 2;
+
+    float vy0 = va0 + vb0;
+    float vy1 = va1 + vb1;
+    vy0 = math_max_f32(vy0, vy_min);
+    vy1 = math_max_f32(vy1, vy_min);
+    vy0 = math_min_f32(vy0, vy_max);
+    vy1 = math_min_f32(vy1, vy_max);
+
+    y[0] = fp16_ieee_from_fp32_value(vy0);
+    y[1] = fp16_ieee_from_fp32_value(vy1);
+    y += 2;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    const float va = fp16_ieee_to_fp32_value(*a);
+    const float vb = fp16_ieee_to_fp32_value(*b);
+    float vy = va + vb;
+    vy = math_max_f32(vy, vy_min);
+    vy = math_min_f32(vy, vy_max);
+    *y = fp16_ieee_from_fp32_value(vy);
+  }
+}
@@ -0,0 +1,511 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xmmintrin.h>
+
+#include <xnnpack/dwconv.h>
+#include <xnnpack/math.h>
+
+
+void xnn_f32_dwconv_spchw_ukernel_5x5p2__sse(
+    size_t m,
+    size_t n,
+    const float* input,
+    const float* weights,
+    float* output,
+    size_t input_tuple_stride,
+    size_t output_tuple_stride,
+    size_t input_width_stride,
+    size_t output_width_stride,
+    const union xnn_f32_spchw_params params[restrict static 1])
+{
+  assert(n != 0);
+
+  const __m128 vmask = _mm_load_ps((const float*) params->sse.mask);
+  const __m128 vmax = _mm_load_ps(params->sse.max);
+  const __m128 vmin = _mm_load_ps(params->sse.min);
+
+  const size_t input_width_increment = input_width_stride - round_up_po2(n, 4) / 4 * input_tuple_stride;
+  const size_t output_width_increment = output_width_stride - (n - 1) / 4 * output_tuple_stride;
+
+  // No vertical padding.
+  const float* i0 = input;
+  const float* i1 = (const float*) ((uintptr_t) i0 + input_width_stride);
+  const float* i2 = (const float*) ((uintptr_t) i1 + input_width_stride);
+  const float* i3 = (const float*) ((uintptr_t) i2 + input_width_stride);
+  const float* i4 = (const float*) ((uintptr_t) i3 + input_width_stride);
+
+  const __m128 vbias = _mm_load1_ps(weights);
+  const __m128 vk00 = _mm_load1_ps(weights + 1);
+  const __m128 vk01 = _mm_load1_ps(weights + 2);
+  const __m128 vk02 = _mm_load1_ps(weights + 3);
+  const __m128 vk03 = _mm_load1_ps(weights + 4);
+  const __m128 vk04 = _mm_load1_ps(weights + 5);
+  const __m128 vk10 = _mm_load1_ps(weights + 6);
+  const __m128 vk11 = _mm_load1_ps(weights + 7);
+  const __m128 vk12 = _mm_load1_ps(weights + 8);
+  const __m128 vk13 = _mm_load1_ps(weights + 9);
+  const __m128 vk14 = _mm_load1_ps(weights + 10);
+  const __m128 vk20 = _mm_load1_ps(weights + 11);
+  const __m128 vk21 = _mm_load1_ps(weights + 12);
+  const __m128 vk22 = _mm_load1_ps(weights + 13);
+  const __m128 vk23 = _mm_load1_ps(weights + 14);
+  const __m128 vk24 = _mm_load1_ps(weights + 15);
+  const __m128 vk30 = _mm_load1_ps(weights + 16);
+  const __m128 vk31 = _mm_load1_ps(weights + 17);
+  const __m128 vk32 = _mm_load1_ps(weights + 18);
+  const __m128 vk33 = _mm_load1_ps(weights + 19);
+  const __m128 vk34 = _mm_load1_ps(weights + 20);
+  const __m128 vk40 = _mm_load1_ps(weights + 21);
+  const __m128 vk41 = _mm_load1_ps(weights + 22);
+  const __m128 vk42 = _mm_load1_ps(weights + 23);
+  const __m128 vk43 = _mm_load1_ps(weights + 24);
+  const __m128 vk44 = _mm_load1_ps(weights + 25);
+
+  do {
+    // vi0x3012 = ( vi02, vi01, vi00, vi03 )
+    __m128 vi0x3012 = _mm_setzero_ps();
+    // vi1x3012 = ( vi12, vi11, vi10, vi13 )
+    __m128 vi1x3012 = _mm_setzero_ps();
+    // vi2x3012 = ( vi22, vi21, vi20, vi23 )
+    __m128 vi2x3012 = _mm_setzero_ps();
+    // vi3x3012 = ( vi32, vi31, vi30, vi33 )
+    __m128 vi3x3012 = _mm_setzero_ps();
+    // vi4x3012 = ( vi42, vi41, vi40, vi43 )
+    __m128 vi4x3012 = _mm_setzero_ps();
+    // vi0x4567 = ( vi07, vi06, vi05, vi04 )
+    __m128 vi0x4567 = _mm_loadu_ps(i0);
+    i0 = (const float*) ((uintptr_t) i0 + input_tuple_stride);
+    // vi1x4567 = ( vi17, vi16, vi15, vi14 )
+    __m128 vi1x4567 = _mm_loadu_ps(i1);
+    i1 = (const float*) ((uintptr_t) i1 + input_tuple_stride);
+    // vi2x4567 = ( vi27, vi26, vi25, vi24 )
+    __m128 vi2x4567 = _mm_loadu_ps(i2);
+    i2 = (const float*) ((uintptr_t) i2 + input_tuple_stride);
+    // vi3x4567 = ( vi37, vi36, vi35, vi34 )
+    __m128 vi3x4567 = _mm_loadu_ps(i3);
+    i3 = (const float*) ((uintptr_t) i3 + input_tuple_stride);
+    // vi4x4567 = ( vi47, vi46, vi45, vi44 )
+    __m128 vi4x4567 = _mm_loadu_ps(i4);
+    i4 = (const float*) ((uintptr_t) i4 + input_tuple_stride);
+
+    size_t k = n;
+    for (; k > 8; k -= 4) {
+      __m128 vo4567p0 = vbias;
+
+      // vi0x89AB = ( vi0B, vi0A, vi09, vi08 )
+      const __m128 vi0x89AB = _mm_loadu_ps(i0);
+      i0 = (const float*) ((uintptr_t) i0 + input_tuple_stride);
+      // vi1x89AB = ( vi1B, vi1A, vi19, vi18 )
+      const __m128 vi1x89AB = _mm_loadu_ps(i1);
+      i1 = (const float*) ((uintptr_t) i1 + input_tuple_stride);
+      // vi2x89AB = ( vi2B, vi2A, vi29, vi28 )
+      const __m128 vi2x89AB = _mm_loadu_ps(i2);
+      i2 = (const float*) ((uintptr_t) i2 + input_tuple_stride);
+      // vi3x89AB = ( vi3B, vi3A, vi39, vi38 )
+      const __m128 vi3x89AB = _mm_loadu_ps(i3);
+      i3 = (const float*) ((uintptr_t) i3 + input_tuple_stride);
+      // vi4x89AB = ( vi4B, vi4A, vi49, vi48 )
+      const __m128 vi4x89AB = _mm_loadu_ps(i4);
+      i4 = (const float*) ((uintptr_t) i4 + input_tuple_stride);
+
+      vo4567p0 = _mm_add_ps(vo4567p0, _mm_mul_ps(vi0x4567, vk02));
+      __m128 vo4567p1 = _mm_mul_ps(vi1x4567, vk12);
+      vo4567p0 = _mm_add_ps(vo4567p0, _mm_mul_ps(vi2x4567, vk22));
+      vo4567p1 = _mm_add_ps(vo4567p1, _mm_mul_ps(vi3x4567, vk32));
+      vo4567p0 = _mm_add_ps(vo4567p0, _mm_mul_ps(vi4x4567, vk42));
+
+      // vi0x7456 = ( vi06, vi05, vi04, vi07 )
+      const __m128 vi0x7456 = _mm_shuffle_ps(vi0x4567, vi0x4567, _MM_SHUFFLE(2, 1, 0, 3));
+      // vi1x7456 = ( vi16, vi15, vi14, vi17 )
+      const __m128 vi1x7456 = _mm_shuffle_ps(vi1x4567, vi1x4567, _MM_SHUFFLE(2, 1, 0, 3));
+      // vi2x7456 = ( vi26, vi25, vi24, vi27 )
+      const __m128 vi2x7456 = _mm_shuffle_ps(vi2x4567, vi2x4567, _MM_SHUFFLE(2, 1, 0, 3));
+      // vi3x7456 = ( vi36, vi35, vi34, vi37 )
+      const __m128 vi3x7456 = _mm_shuffle_ps(vi3x4567, vi3x4567, _MM_SHUFFLE(2, 1, 0, 3));
+      // vi4x7456 = ( vi46, vi45, vi44, vi47 )
+      const __m128 vi4x7456 = _mm_shuffle_ps(vi4x4567, vi4x4567, _MM_SHUFFLE(2, 1, 0, 3));
+
+      // vi0x3456 = ( vi06, vi05, vi04, vi03 )
+      const __m128 vi0x3456 = _mm_move_ss(vi0x7456, vi0x3012);
+      // vi1x3456 = ( vi16, vi15, vi14, vi13 )
+      const __m128 vi1x3456 = _mm_move_ss(vi1x7456, vi1x3012);
+      // vi2x3456 = ( vi26, vi25, vi24, vi23 )
+      const __m128 vi2x3456 = _mm_move_ss(vi2x7456, vi2x3012);
+      // vi3x3456 = ( vi36, vi35, vi34, vi33 )
+      const __m128 vi3x3456 = _mm_move_ss(vi3x7456, vi3x3012);
+      // vi4x3456 = ( vi46, vi45, vi44, vi43 )
+      const __m128 vi4x3456 = _mm_move_ss(vi4x7456, vi4x3012);
+
+      vo4567p0 = _mm_add_ps(vo4567p0, _mm_mul_ps(vi0x3456, vk01));
+      vo4567p1 = _mm_add_ps(vo4567p1, _mm_mul_ps(vi1x3456, vk11));
+      vo4567p0 = _mm_add_ps(vo4567p0, _mm_mul_ps(vi2x3456, vk21));
+      vo4567p1 = _mm_add_ps(vo4567p1, _mm_mul_ps(vi3x3456, vk31));
+      vo4567p0 = _mm_add_ps(vo4567p0, _mm_mul_ps(vi4x3456, vk41));
+
+      // vi0x2345 = ( vi05, vi04, vi03, vi02 )
+      const __m128 vi0x2345 = _mm_shuffle_ps(vi0x3012, vi0x7456, _MM_SHUFFLE(2, 1, 0, 3));
+      // vi1x2345 = ( vi15, vi14, vi13, vi12 )
+      const __m128 vi1x2345 = _mm_shuffle_ps(vi1x3012, vi1x7456, _MM_SHUFFLE(2, 1, 0, 3));
+      // vi2x2345 = ( vi25, vi24, vi23, vi22 )
+      const __m128 vi2x2345 = _mm_shuffle_ps(vi2x3012, vi2x7456, _MM_SHUFFLE(2, 1, 0, 3));
+      // vi3x2345 = ( vi35, vi34, vi33, vi32 )
+      const __m128 vi3x2345 = _mm_shuffle_ps(vi3x3012, vi3x7456, _MM_SHUFFLE(2, 1, 0, 3));
+      // vi4x2345 = ( vi45, vi44, vi43, vi42 )
+      const __m128 vi4x2345 = _mm_shuffle_ps(vi4x3012, vi4x7456, _MM_SHUFFLE(2, 1, 0, 3));
+
+      vo4567p0 = _mm_add_ps(vo4567p0, _mm_mul_ps(vi0x2345, vk00));
+      vo4567p1 = _mm_add_ps(vo4567p1, _mm_mul_ps(vi1x2345, vk10));
+      vo4567p0 = _mm_add_ps(vo4567p0, _mm_mul_ps(vi2x2345, vk20));
+      vo4567p1 = _mm_add_ps(vo4567p1, _mm_mul_ps(vi3x2345, vk30));
+      vo4567p0 = _mm_add_ps(vo4567p0, _mm_mul_ps(vi4x2345, vk40));
+
+      vi0x3012 = vi0x7456;
+      vi1x3012 = vi1x7456;
+      vi2x3012 = vi2x7456;
+      vi3x3012 = vi3x7456;
+      vi4x3012 = vi4x7456;
+
+      // vi0x8567 = ( vi07, vi06, vi05, vi08 )
+      const __m128 vi0x8567 = _mm_move_ss(vi0x4567, vi0x89AB);
+      // vi1x8567 = ( vi17, vi16, vi15, vi18 )
+      const __m128 vi1x8567 = _mm_move_ss(vi1x4567, vi1x89AB);
+      // vi2x8567 = ( vi27, vi26, vi25, vi28 )
+      const __m128 vi2x8567 = _mm_move_ss(vi2x4567, vi2x89AB);
+      // vi3x8567 = ( vi37, vi36, vi35, vi38 )
+      const __m128 vi3x8567 = _mm_move_ss(vi3x4567, vi3x89AB);
+      // vi4x8567 = ( vi47, vi46, vi45, vi48 )
+      const __m128 vi4x8567 = _mm_move_ss(vi4x4567, vi4x89AB);
+
+      // vi0x5678 = ( vi08, vi07, vi06, vi05 )
+      const __m128 vi0x5678 = _mm_shuffle_ps(vi0x8567, vi0x8567, _MM_SHUFFLE(0, 3, 2, 1));
+      // vi1x5678 = ( vi18, vi17, vi16, vi15 )
+      const __m128 vi1x5678 = _mm_shuffle_ps(vi1x8567, vi1x8567, _MM_SHUFFLE(0, 3, 2, 1));
+      // vi2x5678 = ( vi28, vi27, vi26, vi25 )
+      const __m128 vi2x5678 = _mm_shuffle_ps(vi2x8567, vi2x8567, _MM_SHUFFLE(0, 3, 2, 1));
+      // vi3x5678 = ( vi38, vi37, vi36, vi35 )
+      const __m128 vi3x5678 = _mm_shuffle_ps(vi3x8567, vi3x8567, _MM_SHUFFLE(0, 3, 2, 1));
+      // vi4x5678 = ( vi48, vi47, vi46, vi45 )
+      const __m128 vi4x5678 = _mm_shuffle_ps(vi4x8567, vi4x8567, _MM_SHUFFLE(0, 3, 2, 1));
+
+      vo4567p0 = _mm_add_ps(vo4567p0, _mm_mul_ps(vi0x5678, vk03));
+      vo4567p1 = _mm_add_ps(vo4567p1, _mm_mul_ps(vi1x5678, vk13));
+      vo4567p0 = _mm_add_ps(vo4567p0, _mm_mul_ps(vi2x5678, vk23));
+      vo4567p1 = _mm_add_ps(vo4567p1, _mm_mul_ps(vi3x5678, vk33));
+      vo4567p0 = _mm_add_ps(vo4567p0, _mm_mul_ps(vi4x5678, vk43));
+
+      // vi0x6789 = ( vi09, vi08, vi07, vi06 )
+      const __m128 vi0x6789 = _mm_shuffle_ps(vi0x5678, vi0x89AB, _MM_SHUFFLE(1, 0, 2, 1));
+      // vi1x6789 = ( vi19, vi18, vi17, vi16 )
+      const __m128 vi1x6789 = _mm_shuffle_ps(vi1x5678, vi1x89AB, _MM_SHUFFLE(1, 0, 2, 1));
+      // vi2x6789 = ( vi29, vi28, vi27, vi26 )
+      const __m128 vi2x6789 = _mm_shuffle_ps(vi2x5678, vi2x89AB, _MM_SHUFFLE(1, 0, 2, 1));
+      // vi3x6789 = ( vi39, vi38, vi37, vi36 )
+      const __m128 vi3x6789 = _mm_shuffle_ps(vi3x5678, vi3x89AB, _MM_SHUFFLE(1, 0, 2, 1));
+      // vi4x6789 = ( vi49, vi48, vi47, vi46 )
+      const __m128 vi4x6789 = _mm_shuffle_ps(vi4x5678, vi4x89AB, _MM_SHUFFLE(1, 0, 2, 1));
+
+      vo4567p0 = _mm_add_ps(vo4567p0, _mm_mul_ps(vi0x6789, vk04));
+      vo4567p1 = _mm_add_ps(vo4567p1, _mm_mul_ps(vi1x6789, vk14));
+      vo4567p0 = _mm_add_ps(vo4567p0, _mm_mul_ps(vi2x6789, vk24));
+      vo4567p1 = _mm_add_ps(vo4567p1, _mm_mul_ps(vi3x6789, vk34));
+      vo4567p0 = _mm_add_ps(vo4567p0, _mm_mul_ps(vi4x6789, vk44));
+
+      vi0x4567 = vi0x89AB;
+      vi1x4567 = vi1x89AB;
+      vi2x4567 = vi2x89AB;
+      vi3x4567 = vi3x89AB;
+      vi4x4567 = vi4x89AB;
+
+      __m128 vo = _mm_add_ps(vo4567p0, vo4567p1);
+
+      vo = _mm_max_ps(vo, vmin);
+      vo = _mm_min_ps(vo, vmax);
+
+      _mm_storeu_ps(output, vo);
+      output = (float*) ((uintptr_t) output + output_tuple_stride);
+    }
+    // Always process the last block of 5..8 pixels.
+    if XNN_LIKELY(k > 4) {
+      __m128 vo4567p0 = vbias;
+
+      // vi0x89AB = ( vi0B, vi0A, vi09, vi08 )
+      __m128 vi0x89AB = _mm_loadu_ps(i0);
+      i0 = (const float*) ((uintptr_t) i0 + input_tuple_stride);
+      // vi1x89AB = ( vi1B, vi1A, vi19, vi18 )
+      __m128 vi1x89AB = _mm_loadu_ps(i1);
+      i1 = (const float*) ((uintptr_t) i1 + input_tuple_stride);
+      // vi2x89AB = ( vi2B, vi2A, vi29, vi28 )
+      __m128 vi2x89AB = _mm_loadu_ps(i2);
+      i2 = (const float*) ((uintptr_t) i2 + input_tuple_stride);
+      // vi3x89AB = ( vi3B, vi3A, vi39, vi38 )
+      __m128 vi3x89AB = _mm_loadu_ps(i3);
+      i3 = (const float*) ((uintptr_t) i3 + input_tuple_stride);
+      // vi4x89AB = ( vi4B, vi4A, vi49, vi48 )
+      __m128 vi4x89AB = _mm_loadu_ps(i4);
+      i4 = (const float*) ((uintptr_t) i4 + input_tuple_stride);
+
+      vi0x89AB = _mm_and_ps(vmask, vi0x89AB);
+      vi1x89AB = _mm_and_ps(vmask, vi1x89AB);
+      vi2x89AB = _mm_and_ps(vmask, vi2x89AB);
+      vi3x89AB = _mm_and_ps(vmask, vi3x89AB);
+      vi4x89AB = _mm_and_ps(vmask, vi4x89AB);
+
+      vo4567p0 = _mm_add_ps(vo4567p0, _mm_mul_ps(vi0x4567, vk02));
+      __m128 vo4567p1 = _mm_mul_ps(vi1x4567, vk12);
+      vo4567p0 = _mm_add_ps(vo4567p0, _mm_mul_ps(vi2x4567, vk22));
+      vo4567p1 = _mm_add_ps(vo4567p1, _mm_mul_ps(vi3x4567, vk32));
+      vo4567p0 = _mm_add_ps(vo4567p0, _mm_mul_ps(vi4x4567, vk42));
+
+      // vi0x7456 = ( vi06, vi05, vi04, vi07 )
+      const __m128 vi0x7456 = _mm_shuffle_ps(vi0x4567, vi0x4567, _MM_SHUFFLE(2, 1, 0, 3));
+      // vi1x7456 = ( vi16, vi15, vi14, vi17 )
+      const __m128 vi1x7456 = _mm_shuffle_ps(vi1x4567, vi1x4567, _MM_SHUFFLE(2, 1, 0, 3));
+      // vi2x7456 = ( vi26, vi25, vi24, vi27 )
+      const __m128 vi2x7456 = _mm_shuffle_ps(vi2x4567, vi2x4567, _MM_SHUFFLE(2, 1, 0, 3));
+      // vi3x7456 = ( vi36, vi35, vi34, vi37 )
+      const __m128 vi3x7456 = _mm_shuffle_ps(vi3x4567, vi3x4567, _MM_SHUFFLE(2, 1, 0, 3));
+      // vi4x7456 = ( vi46, vi45, vi44, vi47 )
+      const __m128 vi4x7456 = _mm_shuffle_ps(vi4x4567, vi4x4567, _MM_SHUFFLE(2, 1, 0, 3));
+
+      // vi0x3456 = ( vi06, vi05, vi04, vi03 )
+      const __m128 vi0x3456 = _mm_move_ss(vi0x7456, vi0x3012);
+      // vi1x3456 = ( vi16, vi15, vi14, vi13 )
+      const __m128 vi1x3456 = _mm_move_ss(vi1x7456, vi1x3012);
+      // vi2x3456 = ( vi26, vi25, vi24, vi23 )
+      const __m128 vi2x3456 = _mm_move_ss(vi2x7456, vi2x3012);
+      // vi3x3456 = ( vi36, vi35, vi34, vi33 )
+      const __m128 vi3x3456 = _mm_move_ss(vi3x7456, vi3x3012);
+      // vi4x3456 = ( vi46, vi45, vi44, vi43 )
+      const __m128 vi4x3456 = _mm_move_ss(vi4x7456, vi4x3012);
+
+      vo4567p0 = _mm_add_ps(vo4567p0, _mm_mul_ps(vi0x3456, vk01));
+      vo4567p1 = _mm_add_ps(vo4567p1, _mm_mul_ps(vi1x3456, vk11));
+      vo4567p0 = _mm_add_ps(vo4567p0, _mm_mul_ps(vi2x3456, vk21));
+      vo4567p1 = _mm_add_ps(vo4567p1, _mm_mul_ps(vi3x3456, vk31));
+      vo4567p0 = _mm_add_ps(vo4567p0, _mm_mul_ps(vi4x3456, vk41));
+
+      // vi0x2345 = ( vi05, vi04, vi03, vi02 )
+      const __m128 vi0x2345 = _mm_shuffle_ps(vi0x3012, vi0x7456, _MM_SHUFFLE(2, 1, 0, 3));
+      // vi1x2345 = ( vi15, vi14, vi13, vi12 )
+      const __m128 vi1x2345 = _mm_shuffle_ps(vi1x3012, vi1x7456, _MM_SHUFFLE(2, 1, 0, 3));
+      // vi2x2345 = ( vi25, vi24, vi23, vi22 )
+      const __m128 vi2x2345 = _mm_shuffle_ps(vi2x3012, vi2x7456, _MM_SHUFFLE(2, 1, 0, 3));
+      // vi3x2345 = ( vi35, vi34, vi33, vi32 )
+      const __m128 vi3x2345 = _mm_shuffle_ps(vi3x3012, vi3x7456, _MM_SHUFFLE(2, 1, 0, 3));
+      // vi4x2345 = ( vi45, vi44, vi43, vi42 )
+      const __m128 vi4x2345 = _mm_shuffle_ps(vi4x3012, vi4x7456, _MM_SHUFFLE(2, 1, 0, 3));
+
+      vo4567p0 = _mm_add_ps(vo4567p0, _mm_mul_ps(vi0x2345, vk00));
+      vo4567p1 = _mm_add_ps(vo4567p1, _mm_mul_ps(vi1x2345, vk10));
+      vo4567p0 = _mm_add_ps(vo4567p0, _mm_mul_ps(vi2x2345, vk20));
+      vo4567p1 = _mm_add_ps(vo4567p1, _mm_mul_ps(vi3x2345, vk30));
+      vo4567p0 = _mm_add_ps(vo4567p0, _mm_mul_ps(vi4x2345, vk40));
+
+      vi0x3012 = vi0x7456;
+      vi1x3012 = vi1x7456;
+      vi2x3012 = vi2x7456;
+      vi3x3012 = vi3x7456;
+      vi4x3012 = vi4x7456;
+
+      // vi0x8567 = ( vi07, vi06, vi05, vi08 )
+      const __m128 vi0x8567 = _mm_move_ss(vi0x4567, vi0x89AB);
+      // vi1x8567 = ( vi17, vi16, vi15, vi18 )
+      const __m128 vi1x8567 = _mm_move_ss(vi1x4567, vi1x89AB);
+      // vi2x8567 = ( vi27, vi26, vi25, vi28 )
+      const __m128 vi2x8567 = _mm_move_ss(vi2x4567, vi2x89AB);
+      // vi3x8567 = ( vi37, vi36, vi35, vi38 )
+      const __m128 vi3x8567 = _mm_move_ss(vi3x4567, vi3x89AB);
+      // vi4x8567 = ( vi47, vi46, vi45, vi48 )
+      const __m128 vi4x8567 = _mm_move_ss(vi4x4567, vi4x89AB);
+
+      // vi0x5678 = ( vi08, vi07, vi06, vi05 )
+      const __m128 vi0x5678 = _mm_shuffle_ps(vi0x8567, vi0x8567, _MM_SHUFFLE(0, 3, 2, 1));
+      // vi1x5678 = ( vi18, vi17, vi16, vi15 )
+      const __m128 vi1x5678 = _mm_shuffle_ps(vi1x8567, vi1x8567, _MM_SHUFFLE(0, 3, 2, 1));
+      // vi2x5678 = ( vi28, vi27, vi26, vi25 )
+      const __m128 vi2x5678 = _mm_shuffle_ps(vi2x8567, vi2x8567, _MM_SHUFFLE(0, 3, 2, 1));
+      // vi3x5678 = ( vi38, vi37, vi36, vi35 )
+      const __m128 vi3x5678 = _mm_shuffle_ps(vi3x8567, vi3x8567, _MM_SHUFFLE(0, 3, 2, 1));
+      // vi4x5678 = ( vi48, vi47, vi46, vi45 )
+      const __m128 vi4x5678 = _mm_shuffle_ps(vi4x8567, vi4x8567, _MM_SHUFFLE(0, 3, 2, 1));
+
+      vo4567p0 = _mm_add_ps(vo4567p0, _mm_mul_ps(vi0x5678, vk03));
+      vo4567p1 = _mm_add_ps(vo4567p1, _mm_mul_ps(vi1x5678, vk13));
+      vo4567p0 = _mm_add_ps(vo4567p0, _mm_mul_ps(vi2x5678, vk23));
+      vo4567p1 = _mm_add_ps(vo4567p1, _mm_mul_ps(vi3x5678, vk33));
+      vo4567p0 = _mm_add_ps(vo4567p0, _mm_mul_ps(vi4x5678, vk43));
+
+      // vi0x6789 = ( vi09, vi08, vi07, vi06 )
+      const __m128 vi0x6789 = _mm_shuffle_ps(vi0x5678, vi0x89AB, _MM_SHUFFLE(1, 0, 2, 1));
+      // vi1x6789 = ( vi19, vi18, vi17, vi16 )
+      const __m128 vi1x6789 = _mm_shuffle_ps(vi1x5678, vi1x89AB, _MM_SHUFFLE(1, 0, 2, 1));
+      // vi2x6789 = ( vi29, vi28, vi27, vi26 )
+      const __m128 vi2x6789 = _mm_shuffle_ps(vi2x5678, vi2x89AB, _MM_SHUFFLE(1, 0, 2, 1));
+      // vi3x6789 = ( vi39, vi38, vi37, vi36 )
+      const __m128 vi3x6789 = _mm_shuffle_ps(vi3x5678, vi3x89AB, _MM_SHUFFLE(1, 0, 2, 1));
+      // vi4x6789 = ( vi49, vi48, vi47, vi46 )
+      const __m128 vi4x6789 = _mm_shuffle_ps(vi4x5678, vi4x89AB, _MM_SHUFFLE(1, 0, 2, 1));
+
+      vo4567p0 = _mm_add_ps(vo4567p0, _mm_mul_ps(vi0x6789, vk04));
+      vo4567p1 = _mm_add_ps(vo4567p1, _mm_mul_ps(vi1x6789, vk14));
+      vo4567p0 = _mm_add_ps(vo4567p0, _mm_mul_ps(vi2x6789, vk24));
+      vo4567p1 = _mm_add_ps(vo4567p1, _mm_mul_ps(vi3x6789, vk34));
+      vo4567p0 = _mm_add_ps(vo4567p0, _mm_mul_ps(vi4x6789, vk44));
+
+      vi0x4567 = vi0x89AB;
+      vi1x4567 = vi1x89AB;
+      vi2x4567 = vi2x89AB;
+      vi3x4567 = vi3x89AB;
+      vi4x4567 = vi4x89AB;
+
+      __m128 vo = _mm_add_ps(vo4567p0, vo4567p1);
+
+      vo = _mm_max_ps(vo, vmin);
+      vo = _mm_min_ps(vo, vmax);
+
+      _mm_storeu_ps(output, vo);
+      output = (float*) ((uintptr_t) output + output_tuple_stride);
+      k -= 4;
+    }
+    assert(k >= 1);
+    assert(k <= 4);
+    {
+      __m128 vo4567p0 = vbias;
+
+      // This might have already happened if there are more than 4 pixels, but we can't count on it.
+      vi0x4567 = _mm_and_ps(vmask, vi0x4567);
+      vi1x4567 = _mm_and_ps(vmask, vi1x4567);
+      vi2x4567 = _mm_and_ps(vmask, vi2x4567);
+      vi3x4567 = _mm_and_ps(vmask, vi3x4567);
+      vi4x4567 = _mm_and_ps(vmask, vi4x4567);
+
+      vo4567p0 = _mm_add_ps(vo4567p0, _mm_mul_ps(vi0x4567, vk02));
+      __m128 vo4567p1 = _mm_mul_ps(vi1x4567, vk12);
+      vo4567p0 = _mm_add_ps(vo4567p0, _mm_mul_ps(vi2x4567, vk22));
+      vo4567p1 = _mm_add_ps(vo4567p1, _mm_mul_ps(vi3x4567, vk32));
+      vo4567p0 = _mm_add_ps(vo4567p0, _mm_mul_ps(vi4x4567, vk42));
+
+      // vi0x7456 = ( vi06, vi05, vi04, vi07 )
+      const __m128 vi0x7456 = _mm_shuffle_ps(vi0x4567, vi0x4567, _MM_SHUFFLE(2, 1, 0, 3));
+      // vi1x7456 = ( vi16, vi15, vi14, vi17 )
+      const __m128 vi1x7456 = _mm_shuffle_ps(vi1x4567, vi1x4567, _MM_SHUFFLE(2, 1, 0, 3));
+      // vi2x7456 = ( vi26, vi25, vi24, vi27 )
+      const __m128 vi2x7456 = _mm_shuffle_ps(vi2x4567, vi2x4567, _MM_SHUFFLE(2, 1, 0, 3));
+      // vi3x7456 = ( vi36, vi35, vi34, vi37 )
+      const __m128 vi3x7456 = _mm_shuffle_ps(vi3x4567, vi3x4567, _MM_SHUFFLE(2, 1, 0, 3));
+      // vi4x7456 = ( vi46, vi45, vi44, vi47 )
+      const __m128 vi4x7456 = _mm_shuffle_ps(vi4x4567, vi4x4567, _MM_SHUFFLE(2, 1, 0, 3));
+
+      // vi0x3456 = ( vi06, vi05, vi04, vi03 )
+      const __m128 vi0x3456 = _mm_move_ss(vi0x7456, vi0x3012);
+      // vi1x3456 = ( vi16, vi15, vi14, vi13 )
+      const __m128 vi1x3456 = _mm_move_ss(vi1x7456, vi1x3012);
+      // vi2x3456 = ( vi26, vi25, vi24, vi23 )
+      const __m128 vi2x3456 = _mm_move_ss(vi2x7456, vi2x3012);
+      // vi3x3456 = ( vi36, vi35, vi34, vi33 )
+      const __m128 vi3x3456 = _mm_move_ss(vi3x7456, vi3x3012);
+      // vi4x3456 = ( vi46, vi45, vi44, vi43 )
+      const __m128 vi4x3456 = _mm_move_ss(vi4x7456, vi4x3012);
+
+      vo4567p0 = _mm_add_ps(vo4567p0, _mm_mul_ps(vi0x3456, vk01));
+      vo4567p1 = _mm_add_ps(vo4567p1, _mm_mul_ps(vi1x3456, vk11));
+      vo4567p0 = _mm_add_ps(vo4567p0, _mm_mul_ps(vi2x3456, vk21));
+      vo4567p1 = _mm_add_ps(vo4567p1, _mm_mul_ps(vi3x3456, vk31));
+      vo4567p0 = _mm_add_ps(vo4567p0, _mm_mul_ps(vi4x3456, vk41));
+
+      // vi0x2345 = ( vi05, vi04, vi03, vi02 )
+      const __m128 vi0x2345 = _mm_shuffle_ps(vi0x3012, vi0x7456, _MM_SHUFFLE(2, 1, 0, 3));
+      // vi1x2345 = ( vi15, vi14, vi13, vi12 )
+      const __m128 vi1x2345 = _mm_shuffle_ps(vi1x3012, vi1x7456, _MM_SHUFFLE(2, 1, 0, 3));
+      // vi2x2345 = ( vi25, vi24, vi23, vi22 )
+      const __m128 vi2x2345 = _mm_shuffle_ps(vi2x3012, vi2x7456, _MM_SHUFFLE(2, 1, 0, 3));
+      // vi3x2345 = ( vi35, vi34, vi33, vi32 )
+      const __m128 vi3x2345 = _mm_shuffle_ps(vi3x3012, vi3x7456, _MM_SHUFFLE(2, 1, 0, 3));
+      // vi4x2345 = ( vi45, vi44, vi43, vi42 )
+      const __m128 vi4x2345 = _mm_shuffle_ps(vi4x3012, vi4x7456, _MM_SHUFFLE(2, 1, 0, 3));
+
+      vo4567p0 = _mm_add_ps(vo4567p0, _mm_mul_ps(vi0x2345, vk00));
+      vo4567p1 = _mm_add_ps(vo4567p1, _mm_mul_ps(vi1x2345, vk10));
+      vo4567p0 = _mm_add_ps(vo4567p0, _mm_mul_ps(vi2x2345, vk20));
+      vo4567p1 = _mm_add_ps(vo4567p1, _mm_mul_ps(vi3x2345, vk30));
+      vo4567p0 = _mm_add_ps(vo4567p0, _mm_mul_ps(vi4x2345, vk40));
+
+      const __m128 vzero = _mm_setzero_ps();
+      // vi0x8567 = ( vi07, vi06, vi05, vi08 )
+      const __m128 vi0x8567 = _mm_move_ss(vi0x4567, vzero);
+      // vi1x8567 = ( vi17, vi16, vi15, vi18 )
+      const __m128 vi1x8567 = _mm_move_ss(vi1x4567, vzero);
+      // vi2x8567 = ( vi27, vi26, vi25, vi28 )
+      const __m128 vi2x8567 = _mm_move_ss(vi2x4567, vzero);
+      // vi3x8567 = ( vi37, vi36, vi35, vi38 )
+      const __m128 vi3x8567 = _mm_move_ss(vi3x4567, vzero);
+      // vi4x8567 = ( vi47, vi46, vi45, vi48 )
+      const __m128 vi4x8567 = _mm_move_ss(vi4x4567, vzero);
+
+      // vi0x5678 = ( vi08, vi07, vi06, vi05 )
+      const __m128 vi0x5678 = _mm_shuffle_ps(vi0x8567, vi0x8567, _MM_SHUFFLE(0, 3, 2, 1));
+      // vi1x5678 = ( vi18, vi17, vi16, vi15 )
+      const __m128 vi1x5678 = _mm_shuffle_ps(vi1x8567, vi1x8567, _MM_SHUFFLE(0, 3, 2, 1));
+      // vi2x5678 = ( vi28, vi27, vi26, vi25 )
+      const __m128 vi2x5678 = _mm_shuffle_ps(vi2x8567, vi2x8567, _MM_SHUFFLE(0, 3, 2, 1));
+      // vi3x5678 = ( vi38, vi37, vi36, vi35 )
+      const __m128 vi3x5678 = _mm_shuffle_ps(vi3x8567, vi3x8567, _MM_SHUFFLE(0, 3, 2, 1));
+      // vi4x5678 = ( vi48, vi47, vi46, vi45 )
+      const __m128 vi4x5678 = _mm_shuffle_ps(vi4x8567, vi4x8567, _MM_SHUFFLE(0, 3, 2, 1));
+
+      vo4567p0 = _mm_add_ps(vo4567p0, _mm_mul_ps(vi0x5678, vk03));
+      vo4567p1 = _mm_add_ps(vo4567p1, _mm_mul_ps(vi1x5678, vk13));
+      vo4567p0 = _mm_add_ps(vo4567p0, _mm_mul_ps(vi2x5678, vk23));
+      vo4567p1 = _mm_add_ps(vo4567p1, _mm_mul_ps(vi3x5678, vk33));
+      vo4567p0 = _mm_add_ps(vo4567p0, _mm_mul_ps(vi4x5678, vk43));
+
+      // vi0x6789 = ( vi09, vi08, vi07, vi06 )
+      const __m128 vi0x6789 = _mm_shuffle_ps(vi0x5678, vzero, _MM_SHUFFLE(1, 0, 2, 1));
+      // vi1x6789 = ( vi19, vi18, vi17, vi16 )
+      const __m128 vi1x6789 = _mm_shuffle_ps(vi1x5678, vzero, _MM_SHUFFLE(1, 0, 2, 1));
+      // vi2x6789 = ( vi29, vi28, vi27, vi26 )
+      const __m128 vi2x6789 = _mm_shuffle_ps(vi2x5678, vzero, _MM_SHUFFLE(1, 0, 2, 1));
+      // vi3x6789 = ( vi39, vi38, vi37, vi36 )
+      const __m128 vi3x6789 = _mm_shuffle_ps(vi3x5678, vzero, _MM_SHUFFLE(1, 0, 2, 1));
+      // vi4x6789 = ( vi49, vi48, vi47, vi46 )
+      const __m128 vi4x6789 = _mm_shuffle_ps(vi4x5678, vzero, _MM_SHUFFLE(1, 0, 2, 1));
+
+      vo4567p0 = _mm_add_ps(vo4567p0, _mm_mul_ps(vi0x6789, vk04));
+      vo4567p1 = _mm_add_ps(vo4567p1, _mm_mul_ps(vi1x6789, vk14));
+      vo4567p0 = _mm_add_ps(vo4567p0, _mm_mul_ps(vi2x6789, vk24));
+      vo4567p1 = _mm_add_ps(vo4567p1, _mm_mul_ps(vi3x6789, vk34));
+      vo4567p0 = _mm_add_ps(vo4567p0, _mm_mul_ps(vi4x6789, vk44));
+
+      __m128 vo = _mm_add_ps(vo4567p0, vo4567p1);
+
+      vo = _mm_max_ps(vo, vmin);
+      vo = _mm_min_ps(vo, vmax);
+
+      if XNN_LIKELY(k & 4) {
+        _mm_storeu_ps(output, vo);
+      } else {
+        float* output_lo = output;
+        if (k & 2) {
+          _mm_storel_pi((__m64*) output_lo, vo);
+          output_lo += 2;
+          vo = _mm_movehl_ps(vo, vo);
+        }
+        if (k & 1) {
+          _mm_store_ss(output_lo, vo);
+        }
+      }
+    }
+
+    i0 = (const float*) ((uintptr_t) i0 + input_width_increment);
+    i1 = (const float*) ((uintptr_t) i1 + input_width_increment);
+    i2 = (const float*) ((uintptr_t) i2 + input_width_increment);
+    i3 = (const float*) ((uintptr_t) i3 + input_width_increment);
+    i4 = (const float*) ((uintptr_t) i4 + input_width_increment);
+    output = (float*) ((uintptr_t) output + output_width_increment);
+  } while (--m != 0);
+}
@@ -0,0 +1,291 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xmmintrin.h>
+
+#include <xnnpack/dwconv.h>
+#include <xnnpack/math.h>
+
+
+void xnn_f32_dwconv_spchw_ukernel_5x5s2p2__sse(
+    size_t m,
+    size_t n,
+    const float* input,
+    const float* weights,
+    float* output,
+    size_t input_tuple_stride,
+    size_t output_tuple_stride,
+    size_t input_width_stride,
+    size_t output_width_stride,
+    const union xnn_f32_spchw_params params[restrict static 1])
+{
+  assert(n != 0);
+
+  const __m128 vmask_even = _mm_load_ps((const float*) params->sse.mask_even);
+  const __m128 vmask_odd  = _mm_load_ps((const float*) params->sse.mask_odd);
+  const __m128 vmax = _mm_load_ps(params->sse.max);
+  const __m128 vmin = _mm_load_ps(params->sse.min);
+
+  const size_t input_width_increment = input_width_stride * 2 - input_tuple_stride * ((n - 1) / 4 + 1);
+  const size_t output_width_increment = output_width_stride - (n + 1) / 8 * output_tuple_stride;
+
+  // No vertical padding.
+  const float* i0 = input;
+  const float* i1 = (const float*) ((uintptr_t) i0 + input_width_stride);
+  const float* i2 = (const float*) ((uintptr_t) i1 + input_width_stride);
+  const float* i3 = (const float*) ((uintptr_t) i2 + input_width_stride);
+  const float* i4 = (const float*) ((uintptr_t) i3 + input_width_stride);
+
+  const __m128 vbias = _mm_load1_ps(weights);
+  const __m128 vk00 = _mm_load1_ps(weights + 1);
+  const __m128 vk01 = _mm_load1_ps(weights + 2);
+  const __m128 vk02 = _mm_load1_ps(weights + 3);
+  const __m128 vk03 = _mm_load1_ps(weights + 4);
+  const __m128 vk04 = _mm_load1_ps(weights + 5);
+  const __m128 vk10 = _mm_load1_ps(weights + 6);
+  const __m128 vk11 = _mm_load1_ps(weights + 7);
+  const __m128 vk12 = _mm_load1_ps(weights + 8);
+  const __m128 vk13 = _mm_load1_ps(weights + 9);
+  const __m128 vk14 = _mm_load1_ps(weights + 10);
+  const __m128 vk20 = _mm_load1_ps(weights + 11);
+  const __m128 vk21 = _mm_load1_ps(weights + 12);
+  const __m128 vk22 = _mm_load1_ps(weights + 13);
+  const __m128 vk23 = _mm_load1_ps(weights + 14);
+  const __m128 vk24 = _mm_load1_ps(weights + 15);
+  const __m128 vk30 = _mm_load1_ps(weights + 16);
+  const __m128 vk31 = _mm_load1_ps(weights + 17);
+  const __m128 vk32 = _mm_load1_ps(weights + 18);
+  const __m128 vk33 = _mm_load1_ps(weights + 19);
+  const __m128 vk34 = _mm_load1_ps(weights + 20);
+  const __m128 vk40 = _mm_load1_ps(weights + 21);
+  const __m128 vk41 = _mm_load1_ps(weights + 22);
+  const __m128 vk42 = _mm_load1_ps(weights + 23);
+  const __m128 vk43 = _mm_load1_ps(weights + 24);
+  const __m128 vk44 = _mm_load1_ps(weights + 25);
+
+  do {
+    __m128 vi0x0123 = _mm_setzero_ps();
+    __m128 vi1x0123 = _mm_setzero_ps();
+    __m128 vi2x0123 = _mm_setzero_ps();
+    __m128 vi3x0123 = _mm_setzero_ps();
+    __m128 vi4x0123 = _mm_setzero_ps();
+    __m128 vi0x4567 = _mm_loadu_ps(i0);
+    i0 = (const float*) ((uintptr_t) i0 + input_tuple_stride);
+    __m128 vi1x4567 = _mm_loadu_ps(i1);
+    i1 = (const float*) ((uintptr_t) i1 + input_tuple_stride);
+    __m128 vi2x4567 = _mm_loadu_ps(i2);
+    i2 = (const float*) ((uintptr_t) i2 + input_tuple_stride);
+    __m128 vi3x4567 = _mm_loadu_ps(i3);
+    i3 = (const float*) ((uintptr_t) i3 + input_tuple_stride);
+    __m128 vi4x4567 = _mm_loadu_ps(i4);
+    i4 = (const float*) ((uintptr_t) i4 + input_tuple_stride);
+
+    size_t k = n;
+    do {
+      __m128 vo468Ap0 = vbias;
+
+      __m128 vi0x89AB = _mm_setzero_ps();
+      __m128 vi1x89AB = _mm_setzero_ps();
+      __m128 vi2x89AB = _mm_setzero_ps();
+      __m128 vi3x89AB = _mm_setzero_ps();
+      __m128 vi4x89AB = _mm_setzero_ps();
+      if XNN_LIKELY(k > 4) {
+        vi0x89AB = _mm_loadu_ps(i0);
+        i0 = (const float*) ((uintptr_t) i0 + input_tuple_stride);
+        vi1x89AB = _mm_loadu_ps(i1);
+        i1 = (const float*) ((uintptr_t) i1 + input_tuple_stride);
+        vi2x89AB = _mm_loadu_ps(i2);
+        i2 = (const float*) ((uintptr_t) i2 + input_tuple_stride);
+        vi3x89AB = _mm_loadu_ps(i3);
+        i3 = (const float*) ((uintptr_t) i3 + input_tuple_stride);
+        vi4x89AB = _mm_loadu_ps(i4);
+        i4 = (const float*) ((uintptr_t) i4 + input_tuple_stride);
+      }
+
+      __m128 vi0xCDEF = _mm_setzero_ps();
+      __m128 vi1xCDEF = _mm_setzero_ps();
+      __m128 vi2xCDEF = _mm_setzero_ps();
+      __m128 vi3xCDEF = _mm_setzero_ps();
+      __m128 vi4xCDEF = _mm_setzero_ps();
+      if XNN_LIKELY(k > 8) {
+        vi0xCDEF = _mm_loadu_ps(i0);
+        i0 = (const float*) ((uintptr_t) i0 + input_tuple_stride);
+        vi1xCDEF = _mm_loadu_ps(i1);
+        i1 = (const float*) ((uintptr_t) i1 + input_tuple_stride);
+        vi2xCDEF = _mm_loadu_ps(i2);
+        i2 = (const float*) ((uintptr_t) i2 + input_tuple_stride);
+        vi3xCDEF = _mm_loadu_ps(i3);
+        i3 = (const float*) ((uintptr_t) i3 + input_tuple_stride);
+        vi4xCDEF = _mm_loadu_ps(i4);
+        i4 = (const float*) ((uintptr_t) i4 + input_tuple_stride);
+      }
+
+      __m128 vi0x468A = _mm_shuffle_ps(vi0x4567, vi0x89AB, _MM_SHUFFLE(2, 0, 2, 0));
+      __m128 vi0x579B = _mm_shuffle_ps(vi0x4567, vi0x89AB, _MM_SHUFFLE(3, 1, 3, 1));
+      __m128 vi1x468A = _mm_shuffle_ps(vi1x4567, vi1x89AB, _MM_SHUFFLE(2, 0, 2, 0));
+      __m128 vi1x579B = _mm_shuffle_ps(vi1x4567, vi1x89AB, _MM_SHUFFLE(3, 1, 3, 1));
+      __m128 vi2x468A = _mm_shuffle_ps(vi2x4567, vi2x89AB, _MM_SHUFFLE(2, 0, 2, 0));
+      __m128 vi2x579B = _mm_shuffle_ps(vi2x4567, vi2x89AB, _MM_SHUFFLE(3, 1, 3, 1));
+      __m128 vi3x468A = _mm_shuffle_ps(vi3x4567, vi3x89AB, _MM_SHUFFLE(2, 0, 2, 0));
+      __m128 vi3x579B = _mm_shuffle_ps(vi3x4567, vi3x89AB, _MM_SHUFFLE(3, 1, 3, 1));
+      __m128 vi4x468A = _mm_shuffle_ps(vi4x4567, vi4x89AB, _MM_SHUFFLE(2, 0, 2, 0));
+      __m128 vi4x579B = _mm_shuffle_ps(vi4x4567, vi4x89AB, _MM_SHUFFLE(3, 1, 3, 1));
+
+      if XNN_UNLIKELY(k <= 8) {
+        vi0x468A = _mm_and_ps(vmask_even, vi0x468A);
+        vi1x468A = _mm_and_ps(vmask_even, vi1x468A);
+        vi2x468A = _mm_and_ps(vmask_even, vi2x468A);
+        vi3x468A = _mm_and_ps(vmask_even, vi3x468A);
+        vi4x468A = _mm_and_ps(vmask_even, vi4x468A);
+        vi0x579B = _mm_and_ps(vmask_odd, vi0x579B);
+        vi1x579B = _mm_and_ps(vmask_odd, vi1x579B);
+        vi2x579B = _mm_and_ps(vmask_odd, vi2x579B);
+        vi3x579B = _mm_and_ps(vmask_odd, vi3x579B);
+        vi4x579B = _mm_and_ps(vmask_odd, vi4x579B);
+      }
+
+      // middle tap
+      vo468Ap0 = _mm_add_ps(vo468Ap0, _mm_mul_ps(vi0x468A, vk02));
+      __m128 vo468Ap1 = _mm_mul_ps(vi1x468A, vk12);
+      vo468Ap0 = _mm_add_ps(vo468Ap0, _mm_mul_ps(vi2x468A, vk22));
+      vo468Ap1 = _mm_add_ps(vo468Ap1, _mm_mul_ps(vi3x468A, vk32));
+      vo468Ap0 = _mm_add_ps(vo468Ap0, _mm_mul_ps(vi4x468A, vk42));
+
+      // one left
+      // vi0x3355 = ( vi05, vi05, vi03, vi03 )
+      const __m128 vi0x3355 = _mm_shuffle_ps(vi0x0123, vi0x579B, _MM_SHUFFLE(0, 0, 3, 3));
+      // vi1x3355 = ( vi15, vi15, vi13, vi13 )
+      const __m128 vi1x3355 = _mm_shuffle_ps(vi1x0123, vi1x579B, _MM_SHUFFLE(0, 0, 3, 3));
+      // vi2x3355 = ( vi25, vi25, vi23, vi23 )
+      const __m128 vi2x3355 = _mm_shuffle_ps(vi2x0123, vi2x579B, _MM_SHUFFLE(0, 0, 3, 3));
+      // vi3x3355 = ( vi35, vi35, vi33, vi33 )
+      const __m128 vi3x3355 = _mm_shuffle_ps(vi3x0123, vi3x579B, _MM_SHUFFLE(0, 0, 3, 3));
+      // vi4x3355 = ( vi45, vi45, vi43, vi43 )
+      const __m128 vi4x3355 = _mm_shuffle_ps(vi4x0123, vi4x579B, _MM_SHUFFLE(0, 0, 3, 3));
+      // vi0x3579 = ( vi09, vi07, vi05, vi03 )
+      const __m128 vi0x3579 = _mm_shuffle_ps(vi0x3355, vi0x579B, _MM_SHUFFLE(2, 1, 2, 0));
+      // vi1x3579 = ( vi19, vi17, vi15, vi13 )
+      const __m128 vi1x3579 = _mm_shuffle_ps(vi1x3355, vi1x579B, _MM_SHUFFLE(2, 1, 2, 0));
+      // vi2x3579 = ( vi29, vi27, vi25, vi23 )
+      const __m128 vi2x3579 = _mm_shuffle_ps(vi2x3355, vi2x579B, _MM_SHUFFLE(2, 1, 2, 0));
+      // vi3x3579 = ( vi39, vi37, vi35, vi33 )
+      const __m128 vi3x3579 = _mm_shuffle_ps(vi3x3355, vi3x579B, _MM_SHUFFLE(2, 1, 2, 0));
+      // vi4x3579 = ( vi49, vi47, vi45, vi43 )
+      const __m128 vi4x3579 = _mm_shuffle_ps(vi4x3355, vi4x579B, _MM_SHUFFLE(2, 1, 2, 0));
+
+      vo468Ap0 = _mm_add_ps(vo468Ap0, _mm_mul_ps(vi0x3579, vk01));
+      vo468Ap1 = _mm_add_ps(vo468Ap1, _mm_mul_ps(vi1x3579, vk11));
+      vo468Ap0 = _mm_add_ps(vo468Ap0, _mm_mul_ps(vi2x3579, vk21));
+      vo468Ap1 = _mm_add_ps(vo468Ap1, _mm_mul_ps(vi3x3579, vk31));
+      vo468Ap0 = _mm_add_ps(vo468Ap0, _mm_mul_ps(vi4x3579, vk41));
+
+      // two left
+      // vi0x2244 = ( vi04, vi04, vi02, vi02 )
+      const __m128 vi0x2244 = _mm_shuffle_ps(vi0x0123, vi0x468A, _MM_SHUFFLE(0, 0, 2, 2));
+      // vi1x2244 = ( vi14, vi14, vi12, vi12 )
+      const __m128 vi1x2244 = _mm_shuffle_ps(vi1x0123, vi1x468A, _MM_SHUFFLE(0, 0, 2, 2));
+      // vi2x2244 = ( vi24, vi24, vi22, vi22 )
+      const __m128 vi2x2244 = _mm_shuffle_ps(vi2x0123, vi2x468A, _MM_SHUFFLE(0, 0, 2, 2));
+      // vi3x2244 = ( vi34, vi34, vi32, vi32 )
+      const __m128 vi3x2244 = _mm_shuffle_ps(vi3x0123, vi3x468A, _MM_SHUFFLE(0, 0, 2, 2));
+      // vi4x2244 = ( vi44, vi44, vi42, vi42 )
+      const __m128 vi4x2244 = _mm_shuffle_ps(vi4x0123, vi4x468A, _MM_SHUFFLE(0, 0, 2, 2));
+      // vi0x2468 = ( vi08, vi06, vi04, vi02 )
+      const __m128 vi0x2468 = _mm_shuffle_ps(vi0x2244, vi0x468A, _MM_SHUFFLE(2, 1, 2, 0));
+      // vi1x2468 = ( vi18, vi16, vi14, vi12 )
+      const __m128 vi1x2468 = _mm_shuffle_ps(vi1x2244, vi1x468A, _MM_SHUFFLE(2, 1, 2, 0));
+      // vi2x2468 = ( vi28, vi26, vi24, vi22 )
+      const __m128 vi2x2468 = _mm_shuffle_ps(vi2x2244, vi2x468A, _MM_SHUFFLE(2, 1, 2, 0));
+      // vi3x2468 = ( vi38, vi36, vi34, vi32 )
+      const __m128 vi3x2468 = _mm_shuffle_ps(vi3x2244, vi3x468A, _MM_SHUFFLE(2, 1, 2, 0));
+      // vi4x2468 = ( vi48, vi46, vi44, vi42 )
+      const __m128 vi4x2468 = _mm_shuffle_ps(vi4x2244, vi4x468A, _MM_SHUFFLE(2, 1, 2, 0));
+
+      vo468Ap0 = _mm_add_ps(vo468Ap0, _mm_mul_ps(vi0x2468, vk00));
+      vo468Ap1 = _mm_add_ps(vo468Ap1, _mm_mul_ps(vi1x2468, vk10));
+      vo468Ap0 = _mm_add_ps(vo468Ap0, _mm_mul_ps(vi2x2468, vk20));
+      vo468Ap1 = _mm_add_ps(vo468Ap1, _mm_mul_ps(vi3x2468, vk30));
+      vo468Ap0 = _mm_add_ps(vo468Ap0, _mm_mul_ps(vi4x2468, vk40));
+
+      vi0x0123 = vi0x89AB;
+      vi1x0123 = vi1x89AB;
+      vi2x0123 = vi2x89AB;
+      vi3x0123 = vi3x89AB;
+      vi4x0123 = vi4x89AB;
+
+      // one right
+      vo468Ap0 = _mm_add_ps(vo468Ap0, _mm_mul_ps(vi0x579B, vk03));
+      vo468Ap1 = _mm_add_ps(vo468Ap1, _mm_mul_ps(vi1x579B, vk13));
+      vo468Ap0 = _mm_add_ps(vo468Ap0, _mm_mul_ps(vi2x579B, vk23));
+      vo468Ap1 = _mm_add_ps(vo468Ap1, _mm_mul_ps(vi3x579B, vk33));
+      vo468Ap0 = _mm_add_ps(vo468Ap0, _mm_mul_ps(vi4x579B, vk43));
+
+      // two right
+      // vi0xC68A = ( vi0A, vi08, vi06, vi0C )
+      const __m128 vi0xC68A = _mm_move_ss(vi0x468A, vi0xCDEF);
+      // vi1xC68A = ( vi1A, vi18, vi16, vi1C )
+      const __m128 vi1xC68A = _mm_move_ss(vi1x468A, vi1xCDEF);
+      // vi2xC68A = ( vi2A, vi28, vi26, vi2C )
+      const __m128 vi2xC68A = _mm_move_ss(vi2x468A, vi2xCDEF);
+      // vi3xC68A = ( vi3A, vi38, vi36, vi3C )
+      const __m128 vi3xC68A = _mm_move_ss(vi3x468A, vi3xCDEF);
+      // vi4xC68A = ( vi4A, vi48, vi46, vi4C )
+      const __m128 vi4xC68A = _mm_move_ss(vi4x468A, vi4xCDEF);
+      // vi0x68AC = ( vi0C, vi0A, vi08, vi06 )
+      const __m128 vi0x68AC = _mm_shuffle_ps(vi0xC68A, vi0xC68A, _MM_SHUFFLE(0, 3, 2, 1));
+      // vi1x68AC = ( vi1C, vi1A, vi18, vi16 )
+      const __m128 vi1x68AC = _mm_shuffle_ps(vi1xC68A, vi1xC68A, _MM_SHUFFLE(0, 3, 2, 1));
+      // vi2x68AC = ( vi2C, vi2A, vi28, vi26 )
+      const __m128 vi2x68AC = _mm_shuffle_ps(vi2xC68A, vi2xC68A, _MM_SHUFFLE(0, 3, 2, 1));
+      // vi3x68AC = ( vi3C, vi3A, vi38, vi36 )
+      const __m128 vi3x68AC = _mm_shuffle_ps(vi3xC68A, vi3xC68A, _MM_SHUFFLE(0, 3, 2, 1));
+      // vi4x68AC = ( vi4C, vi4A, vi48, vi46 )
+      const __m128 vi4x68AC = _mm_shuffle_ps(vi4xC68A, vi4xC68A, _MM_SHUFFLE(0, 3, 2, 1));
+
+      vo468Ap0 = _mm_add_ps(vo468Ap0, _mm_mul_ps(vi0x68AC, vk04));
+      vo468Ap1 = _mm_add_ps(vo468Ap1, _mm_mul_ps(vi1x68AC, vk14));
+      vo468Ap0 = _mm_add_ps(vo468Ap0, _mm_mul_ps(vi2x68AC, vk24));
+      vo468Ap1 = _mm_add_ps(vo468Ap1, _mm_mul_ps(vi3x68AC, vk34));
+      vo468Ap0 = _mm_add_ps(vo468Ap0, _mm_mul_ps(vi4x68AC, vk44));
+
+      vi0x4567 = vi0xCDEF;
+      vi1x4567 = vi1xCDEF;
+      vi2x4567 = vi2xCDEF;
+      vi3x4567 = vi3xCDEF;
+      vi4x4567 = vi4xCDEF;
+
+      __m128 vo = _mm_add_ps(vo468Ap0, vo468Ap1);
+
+      vo = _mm_max_ps(vo, vmin);
+      vo = _mm_min_ps(vo, vmax);
+
+      const size_t w = (k + 1) / 2;
+      if XNN_LIKELY(w >= 4) {
+        _mm_storeu_ps(output, vo);
+        output = (float*) ((uintptr_t) output + output_tuple_stride);
+      } else {
+        float* output_lo = output;
+        if (w & 2) {
+          _mm_storel_pi((__m64*) output_lo, vo);
+          output_lo += 2;
+          vo = _mm_movehl_ps(vo, vo);
+        }
+        if (w & 1) {
+          _mm_store_ss(output_lo, vo);
+        }
+      }
+      k = doz(k, 8);
+    } while (k != 0);
+
+    i0 = (const float*) ((uintptr_t) i0 + input_width_increment);
+    i1 = (const float*) ((uintptr_t) i1 + input_width_increment);
+    i2 = (const float*) ((uintptr_t) i2 + input_width_increment);
+    i3 = (const float*) ((uintptr_t) i3 + input_width_increment);
+    i4 = (const float*) ((uintptr_t) i4 + input_width_increment);
+    output = (float*) ((uintptr_t) output + output_width_increment);
+  } while (--m != 0);
+}
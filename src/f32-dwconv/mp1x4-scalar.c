@@ -0,0 +1,76 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-dwconv/mp-scalar.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xnnpack/dwconv.h>
+#include <xnnpack/math.h>
+
+
+void xnn_f32_dwconv_ukernel_mp1x4__scalar(
+    size_t channels,
+    size_t output_width,
+    size_t kernel_size,
+    const float** input,
+    const float* weights,
+    float* output,
+    size_t input_stride,
+    size_t output_increment,
+    const union xnn_f32_output_params params[restrict static 1])
+{
+  assert(channels != 0);
+  assert(output_width != 0);
+  assert(kernel_size != 0);
+
+  const float vmin = params->scalar.min;
+  const float vmax = params->scalar.max;
+  do {
+    size_t c = 0;
+    const float* w = weights;
+    do {
+      float vacc0 = *w++;
+      float vacc1 = 0.0f;
+
+      const float** i = input;
+      size_t k = kernel_size;
+      for (; k >= 4; k -= 4) {
+        const float vi0 = i[0][c];
+        const float vk0 = w[0];
+        vacc0 += vi0 * vk0;
+        const float vi1 = i[1][c];
+        const float vk1 = w[1];
+        vacc1 += vi1 * vk1;
+        const float vi2 = i[2][c];
+        const float vk2 = w[2];
+        vacc0 += vi2 * vk2;
+        const float vi3 = i[3][c];
+        const float vk3 = w[3];
+        vacc1 += vi3 * vk3;
+
+        i += 4;
+        w += 4;
+      }
+      for (; k != 0; k--) {
+        const float vi = (*i++)[c];
+        const float vk = *w++;
+        vacc0 += vi * vk;
+      }
+
+      vacc0 += vacc1;
+
+      vacc0 = math_max_f32(vacc0, vmin);
+      vacc0 = math_min_f32(vacc0, vmax);
+
+      *output++ = vacc0;
+    } while (++c != channels);
+
+    input = (const float**) ((uintptr_t) input + input_stride);
+    output = (float*) ((uintptr_t) output + output_increment);
+  } while (--output_width != 0);
+}
@@ -0,0 +1,91 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-dwconv/mp-neon.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/dwconv.h>
+
+
+void xnn_f32_dwconv_ukernel_mp4x4__neonfma(
+    size_t channels,
+    size_t output_width,
+    size_t kernel_size,
+    const float** input,
+    const float* weights,
+    float* output,
+    size_t input_stride,
+    size_t output_increment,
+    const union xnn_f32_output_params params[restrict static 1])
+{
+  assert(channels != 0);
+  assert(output_width != 0);
+  assert(kernel_size != 0);
+
+  const float32x4_t vmax = vld1q_dup_f32(&params->scalar.max);
+  const float32x4_t vmin = vld1q_dup_f32(&params->scalar.min);
+  do {
+    size_t c = channels;
+    size_t input_offset = 0;
+    const float* w = weights;
+    do {
+      float32x4_t vacc0 = vld1q_f32(w); w += 4;
+      float32x4_t vacc1 = vmovq_n_f32(0.0f);
+
+      const float** i = input;
+      size_t k = kernel_size;
+      for (; k >= 4; k -= 4) {
+        const float32x4_t vi0 = vld1q_f32((const float*) ((uintptr_t) i[0] + input_offset));
+        const float32x4_t vk0 = vld1q_f32(w); w += 4;
+        vacc0 = vfmaq_f32(vacc0, vi0, vk0);
+        const float32x4_t vi1 = vld1q_f32((const float*) ((uintptr_t) i[1] + input_offset));
+        const float32x4_t vk1 = vld1q_f32(w); w += 4;
+        vacc1 = vfmaq_f32(vacc1, vi1, vk1);
+        const float32x4_t vi2 = vld1q_f32((const float*) ((uintptr_t) i[2] + input_offset));
+        const float32x4_t vk2 = vld1q_f32(w); w += 4;
+        vacc0 = vfmaq_f32(vacc0, vi2, vk2);
+        const float32x4_t vi3 = vld1q_f32((const float*) ((uintptr_t) i[3] + input_offset));
+        const float32x4_t vk3 = vld1q_f32(w); w += 4;
+        vacc1 = vfmaq_f32(vacc1, vi3, vk3);
+
+        i += 4;
+      }
+      for (; k != 0; k--) {
+        const float32x4_t vi = vld1q_f32((const float*) ((uintptr_t) *i++ + input_offset));
+        const float32x4_t vk = vld1q_f32(w); w += 4;
+        vacc0 = vfmaq_f32(vacc0, vi, vk);
+      }
+
+      vacc0 = vaddq_f32(vacc0, vacc1);
+
+      vacc0 = vmaxq_f32(vacc0, vmin);
+      vacc0 = vminq_f32(vacc0, vmax);
+
+      if XNN_LIKELY(c >= 4) {
+        vst1q_f32(output, vacc0); output += 4;
+        input_offset += 4 * sizeof(float);
+        c -= 4;
+      } else {
+        float32x2_t vacc01 = vget_low_f32(vacc0);
+        if (c & 2) {
+          vst1_f32(output, vacc01); output += 2;
+          vacc01 = vget_high_f32(vacc0);
+        }
+        if (c & 1) {
+          vst1_lane_f32(output, vacc01, 0); output += 1;
+        }
+        c = 0;
+      }
+    } while (c != 0);
+
+    input = (const float**) ((uintptr_t) input + input_stride);
+    output = (float*) ((uintptr_t) output + output_increment);
+  } while (--output_width != 0);
+}
@@ -0,0 +1,96 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-dwconv/mp-psimd.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <psimd.h>
+
+#include <xnnpack/dwconv.h>
+
+
+void xnn_f32_dwconv_ukernel_mp4x4__psimd(
+    size_t channels,
+    size_t output_width,
+    size_t kernel_size,
+    const float** input,
+    const float* weights,
+    float* output,
+    size_t input_stride,
+    size_t output_increment,
+    const union xnn_f32_output_params params[restrict static 1])
+{
+  assert(channels != 0);
+  assert(output_width != 0);
+  assert(kernel_size != 0);
+
+  const psimd_f32 vmax = psimd_load_splat_f32(&params->scalar.max);
+  const psimd_f32 vmin = psimd_load_splat_f32(&params->scalar.min);
+  do {
+    size_t c = channels;
+    size_t input_offset = 0;
+    const float* w = weights;
+    do {
+      psimd_f32 vacc0 = psimd_load_f32(w);
+      w += 4;
+      psimd_f32 vacc1 = psimd_splat_f32(0.0f);
+
+      const float** i = input;
+      size_t k = kernel_size;
+      for (; k >= 4; k -= 4) {
+        const psimd_f32 vi0 = psimd_load_f32((const float*) ((uintptr_t) i[0] + input_offset));
+        const psimd_f32 vk0 = psimd_load_f32(w + 0);
+        vacc0 = psimd_qfma_f32(vacc0, vi0, vk0);
+        const psimd_f32 vi1 = psimd_load_f32((const float*) ((uintptr_t) i[1] + input_offset));
+        const psimd_f32 vk1 = psimd_load_f32(w + 4);
+        vacc1 = psimd_qfma_f32(vacc1, vi1, vk1);
+        const psimd_f32 vi2 = psimd_load_f32((const float*) ((uintptr_t) i[2] + input_offset));
+        const psimd_f32 vk2 = psimd_load_f32(w + 8);
+        vacc0 = psimd_qfma_f32(vacc0, vi2, vk2);
+        const psimd_f32 vi3 = psimd_load_f32((const float*) ((uintptr_t) i[3] + input_offset));
+        const psimd_f32 vk3 = psimd_load_f32(w + 12);
+        vacc1 = psimd_qfma_f32(vacc1, vi3, vk3);
+
+        i += 4;
+        w += 16;
+      }
+      for (; k != 0; k--) {
+        const psimd_f32 vi = psimd_load_f32((const float*) ((uintptr_t) *i++ + input_offset));
+        const psimd_f32 vk = psimd_load_f32(w);
+        w += 4;
+        vacc0 = psimd_qfma_f32(vacc0, vi, vk);
+      }
+
+      vacc0 = psimd_add_f32(vacc0, vacc1);
+
+      vacc0 = psimd_max_f32(vacc0, vmin);
+      vacc0 = psimd_min_f32(vacc0, vmax);
+
+      if XNN_LIKELY(c >= 4) {
+        psimd_store_f32(output, vacc0);
+        output += 4;
+        input_offset += 4 * sizeof(float);
+        c -= 4;
+      } else {
+        if (c & 2) {
+          psimd_store2_f32(output, vacc0);
+          vacc0 = psimd_concat_hi_f32(vacc0, vacc0);
+          output += 2;
+        }
+        if (c & 1) {
+          psimd_store1_f32(output, vacc0);
+          output += 1;
+        }
+        c = 0;
+      }
+    } while (c != 0);
+
+    input = (const float**) ((uintptr_t) input + input_stride);
+    output = (float*) ((uintptr_t) output + output_increment);
+  } while (--output_width != 0);
+}
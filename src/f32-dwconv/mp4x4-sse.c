@@ -0,0 +1,96 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-dwconv/mp-sse.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xmmintrin.h>
+
+#include <xnnpack/dwconv.h>
+
+
+void xnn_f32_dwconv_ukernel_mp4x4__sse(
+    size_t channels,
+    size_t output_width,
+    size_t kernel_size,
+    const float** input,
+    const float* weights,
+    float* output,
+    size_t input_stride,
+    size_t output_increment,
+    const union xnn_f32_output_params params[restrict static 1])
+{
+  assert(channels != 0);
+  assert(output_width != 0);
+  assert(kernel_size != 0);
+
+  const __m128 vmax = _mm_load_ps(params->sse.max);
+  const __m128 vmin = _mm_load_ps(params->sse.min);
+  do {
+    size_t c = channels;
+    size_t input_offset = 0;
+    const float* w = weights;
+    do {
+      __m128 vacc0 = _mm_load_ps(w);
+      w += 4;
+      __m128 vacc1 = _mm_setzero_ps();
+
+      const float** i = input;
+      size_t k = kernel_size;
+      for (; k >= 4; k -= 4) {
+        const __m128 vi0 = _mm_loadu_ps((const float*) ((uintptr_t) i[0] + input_offset));
+        const __m128 vk0 = _mm_load_ps(w + 0);
+        vacc0 = _mm_add_ps(vacc0, _mm_mul_ps(vi0, vk0));
+        const __m128 vi1 = _mm_loadu_ps((const float*) ((uintptr_t) i[1] + input_offset));
+        const __m128 vk1 = _mm_load_ps(w + 4);
+        vacc1 = _mm_add_ps(vacc1, _mm_mul_ps(vi1, vk1));
+        const __m128 vi2 = _mm_loadu_ps((const float*) ((uintptr_t) i[2] + input_offset));
+        const __m128 vk2 = _mm_load_ps(w + 8);
+        vacc0 = _mm_add_ps(vacc0, _mm_mul_ps(vi2, vk2));
+        const __m128 vi3 = _mm_loadu_ps((const float*) ((uintptr_t) i[3] + input_offset));
+        const __m128 vk3 = _mm_load_ps(w + 12);
+        vacc1 = _mm_add_ps(vacc1, _mm_mul_ps(vi3, vk3));
+
+        i += 4;
+        w += 16;
+      }
+      for (; k != 0; k--) {
+        const __m128 vi = _mm_loadu_ps((const float*) ((uintptr_t) *i++ + input_offset));
+        const __m128 vk = _mm_load_ps(w);
+        w += 4;
+        vacc0 = _mm_add_ps(vacc0, _mm_mul_ps(vi, vk));
+      }
+
+      vacc0 = _mm_add_ps(vacc0, vacc1);
+
+      vacc0 = _mm_max_ps(vacc0, vmin);
+      vacc0 = _mm_min_ps(vacc0, vmax);
+
+      if XNN_LIKELY(c >= 4) {
+        _mm_storeu_ps(output, vacc0);
+        output += 4;
+        input_offset += 4 * sizeof(float);
+        c -= 4;
+      } else {
+        if (c & 2) {
+          _mm_storel_pi((__m64*) output, vacc0);
+          vacc0 = _mm_movehl_ps(vacc0, vacc0);
+          output += 2;
+        }
+        if (c & 1) {
+          _mm_store_ss(output, vacc0);
+          output += 1;
+        }
+        c = 0;
+      }
+    } while (c != 0);
+
+    input = (const float**) ((uintptr_t) input + input_stride);
+    output = (float*) ((uintptr_t) output + output_increment);
+  } while (--output_width != 0);
+}
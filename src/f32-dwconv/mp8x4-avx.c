@@ -0,0 +1,139 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-dwconv/mp-avx.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/dwconv.h>
+
+
+static const int32_t mask_table[14] = {-1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0};
+
+void xnn_f32_dwconv_ukernel_mp8x4__avx(
+    size_t channels,
+    size_t output_width,
+    size_t kernel_size,
+    const float** input,
+    const float* weights,
+    float* output,
+    size_t input_stride,
+    size_t output_increment,
+    const union xnn_f32_output_params params[restrict static 1])
+{
+  assert(channels != 0);
+  assert(output_width != 0);
+  assert(kernel_size != 0);
+
+  const __m256 vmax = _mm256_broadcast_ps((const __m128*) params->sse.max);
+  const __m256 vmin = _mm256_broadcast_ps((const __m128*) params->sse.min);
+  do {
+    size_t c = channels;
+    size_t input_offset = 0;
+    const float* w = weights;
+    for (; c >= 8; c -= 8) {
+      __m256 vacc0 = _mm256_load_ps(w);
+      w += 8;
+      __m256 vacc1 = _mm256_setzero_ps();
+
+      const float** i = input;
+      size_t k = kernel_size;
+      for (; k >= 4; k -= 4) {
+        const __m256 vi0 = _mm256_loadu_ps((const float*) ((uintptr_t) i[0] + input_offset));
+        const __m256 vk0 = _mm256_load_ps(w + 0);
+        vacc0 = _mm256_add_ps(vacc0, _mm256_mul_ps(vi0, vk0));
+        const __m256 vi1 = _mm256_loadu_ps((const float*) ((uintptr_t) i[1] + input_offset));
+        const __m256 vk1 = _mm256_load_ps(w + 8);
+        vacc1 = _mm256_add_ps(vacc1, _mm256_mul_ps(vi1, vk1));
+        const __m256 vi2 = _mm256_loadu_ps((const float*) ((uintptr_t) i[2] + input_offset));
+        const __m256 vk2 = _mm256_load_ps(w + 16);
+        vacc0 = _mm256_add_ps(vacc0, _mm256_mul_ps(vi2, vk2));
+        const __m256 vi3 = _mm256_loadu_ps((const float*) ((uintptr_t) i[3] + input_offset));
+        const __m256 vk3 = _mm256_load_ps(w + 24);
+        vacc1 = _mm256_add_ps(vacc1, _mm256_mul_ps(vi3, vk3));
+
+        i += 4;
+        w += 32;
+      }
+      for (; k != 0; k--) {
+        const __m256 vi = _mm256_loadu_ps((const float*) ((uintptr_t) *i++ + input_offset));
+        const __m256 vk = _mm256_load_ps(w);
+        w += 8;
+        vacc0 = _mm256_add_ps(vacc0, _mm256_mul_ps(vi, vk));
+      }
+
+      vacc0 = _mm256_add_ps(vacc0, vacc1);
+
+      vacc0 = _mm256_max_ps(vacc0, vmin);
+      vacc0 = _mm256_min_ps(vacc0, vmax);
+
+      _mm256_storeu_ps(output, vacc0);
+      output += 8;
+      input_offset += 8 * sizeof(float);
+    }
+    if XNN_UNLIKELY(c != 0) {
+      // Masked loads keep the input reads within the last valid channel.
+      const __m256i vmask = _mm256_loadu_si256((const __m256i*) &mask_table[7 - c]);
+
+      __m256 vacc0 = _mm256_load_ps(w);
+      w += 8;
+      __m256 vacc1 = _mm256_setzero_ps();
+
+      const float** i = input;
+      size_t k = kernel_size;
+      for (; k >= 4; k -= 4) {
+        const __m256 vi0 = _mm256_maskload_ps((const float*) ((uintptr_t) i[0] + input_offset), vmask);
+        const __m256 vk0 = _mm256_load_ps(w + 0);
+        vacc0 = _mm256_add_ps(vacc0, _mm256_mul_ps(vi0, vk0));
+        const __m256 vi1 = _mm256_maskload_ps((const float*) ((uintptr_t) i[1] + input_offset), vmask);
+        const __m256 vk1 = _mm256_load_ps(w + 8);
+        vacc1 = _mm256_add_ps(vacc1, _mm256_mul_ps(vi1, vk1));
+        const __m256 vi2 = _mm256_maskload_ps((const float*) ((uintptr_t) i[2] + input_offset), vmask);
+        const __m256 vk2 = _mm256_load_ps(w + 16);
+        vacc0 = _mm256_add_ps(vacc0, _mm256_mul_ps(vi2, vk2));
+        const __m256 vi3 = _mm256_maskload_ps((const float*) ((uintptr_t) i[3] + input_offset), vmask);
+        const __m256 vk3 = _mm256_load_ps(w + 24);
+        vacc1 = _mm256_add_ps(vacc1, _mm256_mul_ps(vi3, vk3));
+
+        i += 4;
+        w += 32;
+      }
+      for (; k != 0; k--) {
+        const __m256 vi = _mm256_maskload_ps((const float*) ((uintptr_t) *i++ + input_offset), vmask);
+        const __m256 vk = _mm256_load_ps(w);
+        w += 8;
+        vacc0 = _mm256_add_ps(vacc0, _mm256_mul_ps(vi, vk));
+      }
+
+      vacc0 = _mm256_add_ps(vacc0, vacc1);
+
+      vacc0 = _mm256_max_ps(vacc0, vmin);
+      vacc0 = _mm256_min_ps(vacc0, vmax);
+
+      __m128 vacc0123 = _mm256_castps256_ps128(vacc0);
+      if (c & 4) {
+        _mm_storeu_ps(output, vacc0123);
+        vacc0123 = _mm256_extractf128_ps(vacc0, 1);
+        output += 4;
+      }
+      if (c & 2) {
+        _mm_storel_pi((__m64*) output, vacc0123);
+        vacc0123 = _mm_movehl_ps(vacc0123, vacc0123);
+        output += 2;
+      }
+      if (c & 1) {
+        _mm_store_ss(output, vacc0123);
+        output += 1;
+      }
+    }
+
+    input = (const float**) ((uintptr_t) input + input_stride);
+    output = (float*) ((uintptr_t) output + output_increment);
+  } while (--output_width != 0);
+}
@@ -0,0 +1,133 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-f16w-gemm/sse2.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <emmintrin.h>
+
+#include <xnnpack/gemm.h>
+
+
+void xnn_f32_f16w_gemm_ukernel_1x8__sse2(
+    size_t mr,
+    size_t nc,
+    size_t kc,
+    const float*restrict a,
+    size_t a_stride,
+    const uint16_t*restrict w,
+    float*restrict c,
+    size_t cm_stride,
+    size_t cn_stride,
+    const union xnn_f32_output_params params[restrict static 1])
+{
+  assert(mr != 0);
+  assert(mr <= 1);
+  assert(nc != 0);
+  assert(kc != 0);
+  assert(kc % sizeof(float) == 0);
+  assert(a != NULL);
+  assert(w != NULL);
+  assert(c != NULL);
+
+  const float* a0 = a;
+  float* c0 = c;
+
+  // Constants for conversion of IEEE half-precision weights to single-precision without F16C instructions:
+  // normalized numbers are rebiased by the exponent offset and scale, denormalized numbers are converted through the
+  // magic bias.
+  const __m128i vsign_mask = _mm_set1_epi32(0x80000000);
+  const __m128i vexp_offset = _mm_set1_epi32(0x70000000);
+  const __m128 vexp_scale = _mm_set1_ps(0x1.0p-112f);
+  const __m128i vmagic_mask = _mm_set1_epi32(0x3F000000);
+  const __m128 vmagic_bias = _mm_set1_ps(0.5f);
+  const __m128i vdenorm_cutoff = _mm_set1_epi32(0x04000000);
+  const __m128i vzero = _mm_setzero_si128();
+
+  do {
+    __m128 vacc0x0123 = _mm_loadu_ps((const float*) w + 0);
+    __m128 vacc0x4567 = _mm_loadu_ps((const float*) w + 4);
+    w += 16;
+
+    size_t k = kc;
+    do {
+      const __m128 va0 = _mm_load1_ps(a0);
+      a0 += 1;
+
+      const __m128i vh01234567 = _mm_loadu_si128((const __m128i*) (w + 0));
+      w += 8;
+
+      const __m128i vw0123 = _mm_unpacklo_epi16(vzero, vh01234567);
+      const __m128i vw4567 = _mm_unpackhi_epi16(vzero, vh01234567);
+
+      const __m128i vsign0123 = _mm_and_si128(vw0123, vsign_mask);
+      const __m128i vnonsign0123 = _mm_xor_si128(vw0123, vsign0123);
+      const __m128 vnorm0123 = _mm_mul_ps(
+        _mm_castsi128_ps(_mm_add_epi32(_mm_srli_epi32(vnonsign0123, 3), vexp_offset)), vexp_scale);
+      const __m128 vdenorm0123 = _mm_sub_ps(
+        _mm_castsi128_ps(_mm_or_si128(_mm_srli_epi32(vnonsign0123, 16), vmagic_mask)), vmagic_bias);
+      const __m128i vmask0123 = _mm_cmpgt_epi32(vdenorm_cutoff, vnonsign0123);
+      const __m128 vb0123 = _mm_or_ps(_mm_castsi128_ps(vsign0123),
+        _mm_or_ps(_mm_and_ps(_mm_castsi128_ps(vmask0123), vdenorm0123),
+          _mm_andnot_ps(_mm_castsi128_ps(vmask0123), vnorm0123)));
+      const __m128i vsign4567 = _mm_and_si128(vw4567, vsign_mask);
+      const __m128i vnonsign4567 = _mm_xor_si128(vw4567, vsign4567);
+      const __m128 vnorm4567 = _mm_mul_ps(
+        _mm_castsi128_ps(_mm_add_epi32(_mm_srli_epi32(vnonsign4567, 3), vexp_offset)), vexp_scale);
+      const __m128 vdenorm4567 = _mm_sub_ps(
+        _mm_castsi128_ps(_mm_or_si128(_mm_srli_epi32(vnonsign4567, 16), vmagic_mask)), vmagic_bias);
+      const __m128i vmask4567 = _mm_cmpgt_epi32(vdenorm_cutoff, vnonsign4567);
+      const __m128 vb4567 = _mm_or_ps(_mm_castsi128_ps(vsign4567),
+        _mm_or_ps(_mm_and_ps(_mm_castsi128_ps(vmask4567), vdenorm4567),
+          _mm_andnot_ps(_mm_castsi128_ps(vmask4567), vnorm4567)));
+
+      vacc0x0123 = _mm_add_ps(vacc0x0123, _mm_mul_ps(va0, vb0123));
+      vacc0x4567 = _mm_add_ps(vacc0x4567, _mm_mul_ps(va0, vb4567));
+
+      k -= sizeof(float);
+    } while (k != 0);
+
+    const __m128 vmax = _mm_load_ps(params->sse.max);
+    vacc0x0123 = _mm_min_ps(vacc0x0123, vmax);
+    vacc0x4567 = _mm_min_ps(vacc0x4567, vmax);
+
+    const __m128 vmin = _mm_load_ps(params->sse.min);
+    vacc0x0123 = _mm_max_ps(vacc0x0123, vmin);
+    vacc0x4567 = _mm_max_ps(vacc0x4567, vmin);
+
+    if XNN_LIKELY(nc >= 8) {
+      _mm_storeu_ps(c0, vacc0x0123);
+      _mm_storeu_ps(c0 + 4, vacc0x4567);
+      c0 = (float*) ((uintptr_t) c0 + cn_stride);
+
+      a0 = (const float*) ((uintptr_t) a0 - kc);
+
+      nc -= 8;
+    } else {
+      if (nc & 4) {
+        _mm_storeu_ps(c0, vacc0x0123);
+
+        vacc0x0123 = vacc0x4567;
+
+        c0 += 4;
+      }
+      if (nc & 2) {
+        _mm_storel_pi((__m64*) c0, vacc0x0123);
+
+        vacc0x0123 = _mm_movehl_ps(vacc0x0123, vacc0x0123);
+
+        c0 += 2;
+      }
+      if (nc & 1) {
+        _mm_store_ss(c0, vacc0x0123);
+      }
+
+      nc = 0;
+    }
+  } while (nc != 0);
+}
@@ -0,0 +1,78 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-gemm/avx512f-broadcast.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/gemm.h>
+
+
+void xnn_f32_gemm_ukernel_1x16__avx512f_broadcast(
+    size_t mr,
+    size_t nc,
+    size_t kc,
+    const float*restrict a,
+    size_t a_stride,
+    const float*restrict w,
+    float*restrict c,
+    size_t cm_stride,
+    size_t cn_stride,
+    const union xnn_f32_output_params params[restrict static 1])
+{
+  assert(mr != 0);
+  assert(mr <= 1);
+  assert(nc != 0);
+  assert(kc != 0);
+  assert(kc % sizeof(float) == 0);
+  assert(a != NULL);
+  assert(w != NULL);
+  assert(c != NULL);
+
+  const float* a0 = a;
+  float* c0 = c;
+
+  do {
+    __m512 vacc0x0123456789ABCDEF = _mm512_load_ps(w + 0);
+    w += 16;
+
+    size_t k = kc;
+    do {
+      const __m512 vb0123456789ABCDEF = _mm512_load_ps(w);
+      w += 16;
+
+      const __m512 va0 = _mm512_set1_ps(*a0);
+      vacc0x0123456789ABCDEF = _mm512_fmadd_ps(va0, vb0123456789ABCDEF, vacc0x0123456789ABCDEF);
+      a0 += 1;
+
+      k -= sizeof(float);
+    } while (k != 0);
+
+    const __m512 vmax = _mm512_broadcast_f32x4(_mm_load_ps(params->sse.max));
+    vacc0x0123456789ABCDEF = _mm512_min_ps(vacc0x0123456789ABCDEF, vmax);
+
+    const __m512 vmin = _mm512_broadcast_f32x4(_mm_load_ps(params->sse.min));
+    vacc0x0123456789ABCDEF = _mm512_max_ps(vacc0x0123456789ABCDEF, vmin);
+
+    if XNN_LIKELY(nc >= 16) {
+      _mm512_storeu_ps(c0, vacc0x0123456789ABCDEF);
+      c0 = (float*) ((uintptr_t) c0 + cn_stride);
+
+      a0 = (const float*) ((uintptr_t) a0 - kc);
+
+      nc -= 16;
+    } else {
+      // Store the last (nc % 16) columns with one masked store per row.
+      const __mmask16 vmask = _cvtu32_mask16((UINT32_C(1) << (nc & 15)) - UINT32_C(1));
+      _mm512_mask_storeu_ps(c0, vmask, vacc0x0123456789ABCDEF);
+
+      nc = 0;
+    }
+  } while (nc != 0);
+}
@@ -0,0 +1,261 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-gemm/avx512f-broadcast.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/gemm.h>
+
+
+void xnn_f32_gemminc_ukernel_8x32__avx512f_broadcast(
+    size_t mr,
+    size_t nc,
+    size_t kc,
+    const float*restrict a,
+    size_t a_stride,
+    const float*restrict w,
+    float*restrict c,
+    size_t cm_stride,
+    size_t cn_stride,
+    const float*restrict acc,
+    const union xnn_f32_output_params params[restrict static 1])
+{
+  assert(mr != 0);
+  assert(mr <= 8);
+  assert(nc != 0);
+  assert(kc != 0);
+  assert(kc % sizeof(float) == 0);
+  assert(a != NULL);
+  assert(w != NULL);
+  assert(c != NULL);
+  assert(acc != NULL);
+
+  const float* a0 = a;
+  float* c0 = c;
+  const float* a1 = (const float*) ((uintptr_t) a0 + a_stride);
+  float* c1 = (float*) ((uintptr_t) c0 + cm_stride);
+  if XNN_UNPREDICTABLE(mr < 2) {
+    a1 = a0;
+    c1 = c0;
+  }
+  const float* a2 = (const float*) ((uintptr_t) a1 + a_stride);
+  float* c2 = (float*) ((uintptr_t) c1 + cm_stride);
+  if XNN_UNPREDICTABLE(mr <= 2) {
+    a2 = a1;
+    c2 = c1;
+  }
+  const float* a3 = (const float*) ((uintptr_t) a2 + a_stride);
+  float* c3 = (float*) ((uintptr_t) c2 + cm_stride);
+  if XNN_UNPREDICTABLE(mr < 4) {
+    a3 = a2;
+    c3 = c2;
+  }
+  const float* a4 = (const float*) ((uintptr_t) a3 + a_stride);
+  float* c4 = (float*) ((uintptr_t) c3 + cm_stride);
+  if XNN_UNPREDICTABLE(mr <= 4) {
+    a4 = a3;
+    c4 = c3;
+  }
+  const float* a5 = (const float*) ((uintptr_t) a4 + a_stride);
+  float* c5 = (float*) ((uintptr_t) c4 + cm_stride);
+  if XNN_UNPREDICTABLE(mr < 6) {
+    a5 = a4;
+    c5 = c4;
+  }
+  const float* a6 = (const float*) ((uintptr_t) a5 + a_stride);
+  float* c6 = (float*) ((uintptr_t) c5 + cm_stride);
+  if XNN_UNPREDICTABLE(mr <= 6) {
+    a6 = a5;
+    c6 = c5;
+  }
+  const float* a7 = (const float*) ((uintptr_t) a6 + a_stride);
+  float* c7 = (float*) ((uintptr_t) c6 + cm_stride);
+  if XNN_UNPREDICTABLE(mr != 8) {
+    a7 = a6;
+    c7 = c6;
+  }
+
+  do {
+    __m512 vacc0x0123456789ABCDEF = _mm512_load_ps(acc + 0);
+    __m512 vacc0xGHIJKLMNOPQRSTUV = _mm512_load_ps(acc + 16);
+    __m512 vacc1x0123456789ABCDEF = _mm512_load_ps(acc + 32);
+    __m512 vacc1xGHIJKLMNOPQRSTUV = _mm512_load_ps(acc + 48);
+    __m512 vacc2x0123456789ABCDEF = _mm512_load_ps(acc + 64);
+    __m512 vacc2xGHIJKLMNOPQRSTUV = _mm512_load_ps(acc + 80);
+    __m512 vacc3x0123456789ABCDEF = _mm512_load_ps(acc + 96);
+    __m512 vacc3xGHIJKLMNOPQRSTUV = _mm512_load_ps(acc + 112);
+    __m512 vacc4x0123456789ABCDEF = _mm512_load_ps(acc + 128);
+    __m512 vacc4xGHIJKLMNOPQRSTUV = _mm512_load_ps(acc + 144);
+    __m512 vacc5x0123456789ABCDEF = _mm512_load_ps(acc + 160);
+    __m512 vacc5xGHIJKLMNOPQRSTUV = _mm512_load_ps(acc + 176);
+    __m512 vacc6x0123456789ABCDEF = _mm512_load_ps(acc + 192);
+    __m512 vacc6xGHIJKLMNOPQRSTUV = _mm512_load_ps(acc + 208);
+    __m512 vacc7x0123456789ABCDEF = _mm512_load_ps(acc + 224);
+    __m512 vacc7xGHIJKLMNOPQRSTUV = _mm512_load_ps(acc + 240);
+    acc += 256;
+
+    size_t k = kc;
+    do {
+      const __m512 vb0123456789ABCDEF = _mm512_load_ps(w);
+      const __m512 vbGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 16);
+      w += 32;
+
+      const __m512 va0 = _mm512_set1_ps(*a0);
+      vacc0x0123456789ABCDEF = _mm512_fmadd_ps(va0, vb0123456789ABCDEF, vacc0x0123456789ABCDEF);
+      vacc0xGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(va0, vbGHIJKLMNOPQRSTUV, vacc0xGHIJKLMNOPQRSTUV);
+      a0 += 1;
+      const __m512 va1 = _mm512_set1_ps(*a1);
+      vacc1x0123456789ABCDEF = _mm512_fmadd_ps(va1, vb0123456789ABCDEF, vacc1x0123456789ABCDEF);
+      vacc1xGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(va1, vbGHIJKLMNOPQRSTUV, vacc1xGHIJKLMNOPQRSTUV);
+      a1 += 1;
+      const __m512 va2 = _mm512_set1_ps(*a2);
+      vacc2x0123456789ABCDEF = _mm512_fmadd_ps(va2, vb0123456789ABCDEF, vacc2x0123456789ABCDEF);
+      vacc2xGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(va2, vbGHIJKLMNOPQRSTUV, vacc2xGHIJKLMNOPQRSTUV);
+      a2 += 1;
+      const __m512 va3 = _mm512_set1_ps(*a3);
+      vacc3x0123456789ABCDEF = _mm512_fmadd_ps(va3, vb0123456789ABCDEF, vacc3x0123456789ABCDEF);
+      vacc3xGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(va3, vbGHIJKLMNOPQRSTUV, vacc3xGHIJKLMNOPQRSTUV);
+      a3 += 1;
+      const __m512 va4 = _mm512_set1_ps(*a4);
+      vacc4x0123456789ABCDEF = _mm512_fmadd_ps(va4, vb0123456789ABCDEF, vacc4x0123456789ABCDEF);
+      vacc4xGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(va4, vbGHIJKLMNOPQRSTUV, vacc4xGHIJKLMNOPQRSTUV);
+      a4 += 1;
+      const __m512 va5 = _mm512_set1_ps(*a5);
+      vacc5x0123456789ABCDEF = _mm512_fmadd_ps(va5, vb0123456789ABCDEF, vacc5x0123456789ABCDEF);
+      vacc5xGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(va5, vbGHIJKLMNOPQRSTUV, vacc5xGHIJKLMNOPQRSTUV);
+      a5 += 1;
+      const __m512 va6 = _mm512_set1_ps(*a6);
+      vacc6x0123456789ABCDEF = _mm512_fmadd_ps(va6, vb0123456789ABCDEF, vacc6x0123456789ABCDEF);
+      vacc6xGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(va6, vbGHIJKLMNOPQRSTUV, vacc6xGHIJKLMNOPQRSTUV);
+      a6 += 1;
+      const __m512 va7 = _mm512_set1_ps(*a7);
+      vacc7x0123456789ABCDEF = _mm512_fmadd_ps(va7, vb0123456789ABCDEF, vacc7x0123456789ABCDEF);
+      vacc7xGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(va7, vbGHIJKLMNOPQRSTUV, vacc7xGHIJKLMNOPQRSTUV);
+      a7 += 1;
+
+      k -= sizeof(float);
+    } while (k != 0);
+
+    const __m512 vmax = _mm512_broadcast_f32x4(_mm_load_ps(params->sse.max));
+    vacc0x0123456789ABCDEF = _mm512_min_ps(vacc0x0123456789ABCDEF, vmax);
+    vacc1x0123456789ABCDEF = _mm512_min_ps(vacc1x0123456789ABCDEF, vmax);
+    vacc2x0123456789ABCDEF = _mm512_min_ps(vacc2x0123456789ABCDEF, vmax);
+    vacc3x0123456789ABCDEF = _mm512_min_ps(vacc3x0123456789ABCDEF, vmax);
+    vacc4x0123456789ABCDEF = _mm512_min_ps(vacc4x0123456789ABCDEF, vmax);
+    vacc5x0123456789ABCDEF = _mm512_min_ps(vacc5x0123456789ABCDEF, vmax);
+    vacc6x0123456789ABCDEF = _mm512_min_ps(vacc6x0123456789ABCDEF, vmax);
+    vacc7x0123456789ABCDEF = _mm512_min_ps(vacc7x0123456789ABCDEF, vmax);
+    vacc0xGHIJKLMNOPQRSTUV = _mm512_min_ps(vacc0xGHIJKLMNOPQRSTUV, vmax);
+    vacc1xGHIJKLMNOPQRSTUV = _mm512_min_ps(vacc1xGHIJKLMNOPQRSTUV, vmax);
+    vacc2xGHIJKLMNOPQRSTUV = _mm512_min_ps(vacc2xGHIJKLMNOPQRSTUV, vmax);
+    vacc3xGHIJKLMNOPQRSTUV = _mm512_min_ps(vacc3xGHIJKLMNOPQRSTUV, vmax);
+    vacc4xGHIJKLMNOPQRSTUV = _mm512_min_ps(vacc4xGHIJKLMNOPQRSTUV, vmax);
+    vacc5xGHIJKLMNOPQRSTUV = _mm512_min_ps(vacc5xGHIJKLMNOPQRSTUV, vmax);
+    vacc6xGHIJKLMNOPQRSTUV = _mm512_min_ps(vacc6xGHIJKLMNOPQRSTUV, vmax);
+    vacc7xGHIJKLMNOPQRSTUV = _mm512_min_ps(vacc7xGHIJKLMNOPQRSTUV, vmax);
+
+    const __m512 vmin = _mm512_broadcast_f32x4(_mm_load_ps(params->sse.min));
+    vacc0x0123456789ABCDEF = _mm512_max_ps(vacc0x0123456789ABCDEF, vmin);
+    vacc1x0123456789ABCDEF = _mm512_max_ps(vacc1x0123456789ABCDEF, vmin);
+    vacc2x0123456789ABCDEF = _mm512_max_ps(vacc2x0123456789ABCDEF, vmin);
+    vacc3x0123456789ABCDEF = _mm512_max_ps(vacc3x0123456789ABCDEF, vmin);
+    vacc4x0123456789ABCDEF = _mm512_max_ps(vacc4x0123456789ABCDEF, vmin);
+    vacc5x0123456789ABCDEF = _mm512_max_ps(vacc5x0123456789ABCDEF, vmin);
+    vacc6x0123456789ABCDEF = _mm512_max_ps(vacc6x0123456789ABCDEF, vmin);
+    vacc7x0123456789ABCDEF = _mm512_max_ps(vacc7x0123456789ABCDEF, vmin);
+    vacc0xGHIJKLMNOPQRSTUV = _mm512_max_ps(vacc0xGHIJKLMNOPQRSTUV, vmin);
+    vacc1xGHIJKLMNOPQRSTUV = _mm512_max_ps(vacc1xGHIJKLMNOPQRSTUV, vmin);
+    vacc2xGHIJKLMNOPQRSTUV = _mm512_max_ps(vacc2xGHIJKLMNOPQRSTUV, vmin);
+    vacc3xGHIJKLMNOPQRSTUV = _mm512_max_ps(vacc3xGHIJKLMNOPQRSTUV, vmin);
+    vacc4xGHIJKLMNOPQRSTUV = _mm512_max_ps(vacc4xGHIJKLMNOPQRSTUV, vmin);
+    vacc5xGHIJKLMNOPQRSTUV = _mm512_max_ps(vacc5xGHIJKLMNOPQRSTUV, vmin);
+    vacc6xGHIJKLMNOPQRSTUV = _mm512_max_ps(vacc6xGHIJKLMNOPQRSTUV, vmin);
+    vacc7xGHIJKLMNOPQRSTUV = _mm512_max_ps(vacc7xGHIJKLMNOPQRSTUV, vmin);
+
+    if XNN_LIKELY(nc >= 32) {
+      _mm512_storeu_ps(c7, vacc7x0123456789ABCDEF);
+      _mm512_storeu_ps(c7 + 16, vacc7xGHIJKLMNOPQRSTUV);
+      c7 = (float*) ((uintptr_t) c7 + cn_stride);
+      _mm512_storeu_ps(c6, vacc6x0123456789ABCDEF);
+      _mm512_storeu_ps(c6 + 16, vacc6xGHIJKLMNOPQRSTUV);
+      c6 = (float*) ((uintptr_t) c6 + cn_stride);
+      _mm512_storeu_ps(c5, vacc5x0123456789ABCDEF);
+      _mm512_storeu_ps(c5 + 16, vacc5xGHIJKLMNOPQRSTUV);
+      c5 = (float*) ((uintptr_t) c5 + cn_stride);
+      _mm512_storeu_ps(c4, vacc4x0123456789ABCDEF);
+      _mm512_storeu_ps(c4 + 16, vacc4xGHIJKLMNOPQRSTUV);
+      c4 = (float*) ((uintptr_t) c4 + cn_stride);
+      _mm512_storeu_ps(c3, vacc3x0123456789ABCDEF);
+      _mm512_storeu_ps(c3 + 16, vacc3xGHIJKLMNOPQRSTUV);
+      c3 = (float*) ((uintptr_t) c3 + cn_stride);
+      _mm512_storeu_ps(c2, vacc2x0123456789ABCDEF);
+      _mm512_storeu_ps(c2 + 16, vacc2xGHIJKLMNOPQRSTUV);
+      c2 = (float*) ((uintptr_t) c2 + cn_stride);
+      _mm512_storeu_ps(c1, vacc1x0123456789ABCDEF);
+      _mm512_storeu_ps(c1 + 16, vacc1xGHIJKLMNOPQRSTUV);
+      c1 = (float*) ((uintptr_t) c1 + cn_stride);
+      _mm512_storeu_ps(c0, vacc0x0123456789ABCDEF);
+      _mm512_storeu_ps(c0 + 16, vacc0xGHIJKLMNOPQRSTUV);
+      c0 = (float*) ((uintptr_t) c0 + cn_stride);
+
+      a7 = (const float*) ((uintptr_t) a7 - kc);
+      a6 = (const float*) ((uintptr_t) a6 - kc);
+      a5 = (const float*) ((uintptr_t) a5 - kc);
+      a4 = (const float*) ((uintptr_t) a4 - kc);
+      a3 = (const float*) ((uintptr_t) a3 - kc);
+      a2 = (const float*) ((uintptr_t) a2 - kc);
+      a1 = (const float*) ((uintptr_t) a1 - kc);
+      a0 = (const float*) ((uintptr_t) a0 - kc);
+
+      nc -= 32;
+    } else {
+      if (nc & 16) {
+        _mm512_storeu_ps(c7, vacc7x0123456789ABCDEF);
+        _mm512_storeu_ps(c6, vacc6x0123456789ABCDEF);
+        _mm512_storeu_ps(c5, vacc5x0123456789ABCDEF);
+        _mm512_storeu_ps(c4, vacc4x0123456789ABCDEF);
+        _mm512_storeu_ps(c3, vacc3x0123456789ABCDEF);
+        _mm512_storeu_ps(c2, vacc2x0123456789ABCDEF);
+        _mm512_storeu_ps(c1, vacc1x0123456789ABCDEF);
+        _mm512_storeu_ps(c0, vacc0x0123456789ABCDEF);
+
+        vacc7x0123456789ABCDEF = vacc7xGHIJKLMNOPQRSTUV;
+        vacc6x0123456789ABCDEF = vacc6xGHIJKLMNOPQRSTUV;
+        vacc5x0123456789ABCDEF = vacc5xGHIJKLMNOPQRSTUV;
+        vacc4x0123456789ABCDEF = vacc4xGHIJKLMNOPQRSTUV;
+        vacc3x0123456789ABCDEF = vacc3xGHIJKLMNOPQRSTUV;
+        vacc2x0123456789ABCDEF = vacc2xGHIJKLMNOPQRSTUV;
+        vacc1x0123456789ABCDEF = vacc1xGHIJKLMNOPQRSTUV;
+        vacc0x0123456789ABCDEF = vacc0xGHIJKLMNOPQRSTUV;
+
+        c7 += 16;
+        c6 += 16;
+        c5 += 16;
+        c4 += 16;
+        c3 += 16;
+        c2 += 16;
+        c1 += 16;
+        c0 += 16;
+      }
+      // Store the last (nc % 16) columns with one masked store per row.
+      const __mmask16 vmask = _cvtu32_mask16((UINT32_C(1) << (nc & 15)) - UINT32_C(1));
+      _mm512_mask_storeu_ps(c7, vmask, vacc7x0123456789ABCDEF);
+      _mm512_mask_storeu_ps(c6, vmask, vacc6x0123456789ABCDEF);
+      _mm512_mask_storeu_ps(c5, vmask, vacc5x0123456789ABCDEF);
+      _mm512_mask_storeu_ps(c4, vmask, vacc4x0123456789ABCDEF);
+      _mm512_mask_storeu_ps(c3, vmask, vacc3x0123456789ABCDEF);
+      _mm512_mask_storeu_ps(c2, vmask, vacc2x0123456789ABCDEF);
+      _mm512_mask_storeu_ps(c1, vmask, vacc1x0123456789ABCDEF);
+      _mm512_mask_storeu_ps(c0, vmask, vacc0x0123456789ABCDEF);
+
+      nc = 0;
+    }
+  } while (nc != 0);
+}
@@ -0,0 +1,119 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-qc8w-gemm/avx.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/gemm.h>
+
+
+void xnn_f32_qc8w_gemm_ukernel_1x16__avx(
+    size_t mr,
+    size_t nc,
+    size_t kc,
+    const float*restrict a,
+    size_t a_stride,
+    const int8_t*restrict w,
+    float*restrict c,
+    size_t cm_stride,
+    size_t cn_stride,
+    const union xnn_f32_output_params params[restrict static 1])
+{
+  assert(mr != 0);
+  assert(mr <= 1);
+  assert(nc != 0);
+  assert(kc != 0);
+  assert(kc % sizeof(float) == 0);
+  assert(a != NULL);
+  assert(w != NULL);
+  assert(c != NULL);
+
+  const float* a0 = a;
+  float* c0 = c;
+
+  do {
+    __m256 vacc0x01234567 = _mm256_setzero_ps();
+    __m256 vacc0x89ABCDEF = _mm256_setzero_ps();
+
+    size_t k = kc;
+    do {
+      const __m256 va0 = _mm256_broadcast_ss(a0);
+      a0 += 1;
+
+      const __m128i vq01234567 = _mm_loadl_epi64((const __m128i*) (w + 0));
+      const __m128i vq89ABCDEF = _mm_loadl_epi64((const __m128i*) (w + 8));
+      w += 16;
+
+      const __m256 vb01234567 = _mm256_cvtepi32_ps(_mm256_insertf128_si256(
+        _mm256_castsi128_si256(_mm_cvtepi8_epi32(vq01234567)), _mm_cvtepi8_epi32(_mm_srli_epi64(vq01234567, 32)), 1));
+      const __m256 vb89ABCDEF = _mm256_cvtepi32_ps(_mm256_insertf128_si256(
+        _mm256_castsi128_si256(_mm_cvtepi8_epi32(vq89ABCDEF)), _mm_cvtepi8_epi32(_mm_srli_epi64(vq89ABCDEF, 32)), 1));
+
+      vacc0x01234567 = _mm256_add_ps(vacc0x01234567, _mm256_mul_ps(va0, vb01234567));
+      vacc0x89ABCDEF = _mm256_add_ps(vacc0x89ABCDEF, _mm256_mul_ps(va0, vb89ABCDEF));
+
+      k -= sizeof(float);
+    } while (k != 0);
+
+    const __m256 vbias01234567 = _mm256_loadu_ps((const float*) w + 0);
+    const __m256 vbias89ABCDEF = _mm256_loadu_ps((const float*) w + 8);
+    const __m256 vscale01234567 = _mm256_loadu_ps((const float*) w + 16);
+    const __m256 vscale89ABCDEF = _mm256_loadu_ps((const float*) w + 24);
+    w += 128;
+    vacc0x01234567 = _mm256_add_ps(_mm256_mul_ps(vacc0x01234567, vscale01234567), vbias01234567);
+    vacc0x89ABCDEF = _mm256_add_ps(_mm256_mul_ps(vacc0x89ABCDEF, vscale89ABCDEF), vbias89ABCDEF);
+
+    const __m256 vmax = _mm256_broadcast_ps((const __m128*) params->sse.max);
+    vacc0x01234567 = _mm256_min_ps(vacc0x01234567, vmax);
+    vacc0x89ABCDEF = _mm256_min_ps(vacc0x89ABCDEF, vmax);
+
+    const __m256 vmin = _mm256_broadcast_ps((const __m128*) params->sse.min);
+    vacc0x01234567 = _mm256_max_ps(vacc0x01234567, vmin);
+    vacc0x89ABCDEF = _mm256_max_ps(vacc0x89ABCDEF, vmin);
+
+    if XNN_LIKELY(nc >= 16) {
+      _mm256_storeu_ps(c0, vacc0x01234567);
+      _mm256_storeu_ps(c0 + 8, vacc0x89ABCDEF);
+      c0 = (float*) ((uintptr_t) c0 + cn_stride);
+
+      a0 = (const float*) ((uintptr_t) a0 - kc);
+
+      nc -= 16;
+    } else {
+      if (nc & 8) {
+        _mm256_storeu_ps(c0, vacc0x01234567);
+
+        vacc0x01234567 = vacc0x89ABCDEF;
+
+        c0 += 8;
+      }
+      __m128 vacc0x0123 = _mm256_castps256_ps128(vacc0x01234567);
+      if (nc & 4) {
+        _mm_storeu_ps(c0, vacc0x0123);
+
+        vacc0x0123 = _mm256_extractf128_ps(vacc0x01234567, 1);
+
+        c0 += 4;
+      }
+      if (nc & 2) {
+        _mm_storel_pi((__m64*) c0, vacc0x0123);
+
+        vacc0x0123 = _mm_movehl_ps(vacc0x0123, vacc0x0123);
+
+        c0 += 2;
+      }
+      if (nc & 1) {
+        _mm_store_ss(c0, vacc0x0123);
+      }
+
+      nc = 0;
+    }
+  } while (nc != 0);
+}
@@ -0,0 +1,48 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <math.h>
+
+#include <xnnpack/math.h>
+#include <xnnpack/rmax.h>
+
+
+void xnn_f32_rabsmax_ukernel__scalar(
+    size_t n,
+    const float* x,
+    float* y)
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+
+  float vmax0 = 0.0f;
+  float vmax1 = 0.0f;
+  float vmax2 = 0.0f;
+  float vmax3 = 0.0f;
+  for (; n >= 16; n -= 16) {
+    const float vx0 = fabsf(x[0]);
+    const float vx1 = fabsf(x[1]);
+    const float vx2 = fabsf(x[2]);
+    const float vx3 = fabsf(x[3]);
+    x += 4;
+
+    vmax0 = math_max_f32(vx0, vmax0);
+    vmax1 = math_max_f32(vx1, vmax1);
+    vmax2 = math_max_f32(vx2, vmax2);
+    vmax3 = math_max_f32(vx3, vmax3);
+  }
+  const float vmax01 = math_max_f32(vmax0, vmax1);
+  const float vmax23 = math_max_f32(vmax2, vmax3);
+  float vmax = math_max_f32(vmax01, vmax23);
+  if XNN_UNLIKELY(n != 0) {
+    do {
+      const float vx = fabsf(*x++);
+      vmax = math_max_f32(vx, vmax);
+      n -= 4;
+    } while (n != 0);
+  }
+  *y = vmax;
+}
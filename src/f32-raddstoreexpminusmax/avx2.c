@@ -0,0 +1,209 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/raddstoreexpminusmax.h>
+
+
+static const int32_t mask_table[14] = {-1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0};
+
+void xnn_f32_raddstoreexpminusmax_ukernel__avx2_x32(
+    size_t n,
+    const float* x,
+    float* y,
+    float* sum,
+    float max)
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+
+  const __m256 vmagic_bias = _mm256_set1_ps(0x1.8000FEp23f);
+  // The smallest x for which expf(x) is normalized.
+  const __m256 vdenorm_cutoff = _mm256_set1_ps(-0x1.5D589Ep6f);
+  const __m256 vlog2e = _mm256_set1_ps(0x1.715476p+0f);
+  const __m256 vminus_ln2_hi = _mm256_set1_ps(-0x1.62E43p-1f);
+  const __m256 vminus_ln2_lo = _mm256_set1_ps(0x1.05C61p-29f);
+
+  const __m256 vc1 = _mm256_set1_ps(0x1.FFFFF6p-1f);
+  const __m256 vc2 = _mm256_set1_ps(0x1.FFFDC6p-2f);
+  const __m256 vc3 = _mm256_set1_ps(0x1.555A80p-3f);
+  const __m256 vc4 = _mm256_set1_ps(0x1.573A1Ap-5f);
+  const __m256 vc5 = _mm256_set1_ps(0x1.0F9F9Cp-7f);
+
+  const __m256 vi_max = _mm256_set1_ps(max);
+
+  __m256 vacc0 = _mm256_setzero_ps();
+  __m256 vacc1 = _mm256_setzero_ps();
+  __m256 vacc2 = _mm256_setzero_ps();
+  __m256 vacc3 = _mm256_setzero_ps();
+  for (; n >= 32 * sizeof(float); n -= 32 * sizeof(float)) {
+    const __m256 vi0 = _mm256_loadu_ps(x);
+    const __m256 vi1 = _mm256_loadu_ps(x + 8);
+    const __m256 vi2 = _mm256_loadu_ps(x + 16);
+    const __m256 vi3 = _mm256_loadu_ps(x + 24);
+    x += 32;
+
+    // Subtract maximum input x := i - i_max. This implies x <= 0.
+    const __m256 vx0 = _mm256_sub_ps(vi0, vi_max);
+    const __m256 vx1 = _mm256_sub_ps(vi1, vi_max);
+    const __m256 vx2 = _mm256_sub_ps(vi2, vi_max);
+    const __m256 vx3 = _mm256_sub_ps(vi3, vi_max);
+
+    // Compute reduced argument n := round(x / log(2)) with the magic bias trick. The magic bias includes the exponent
+    // bias of 127, so the low bits of vn are ready to be shifted into the exponent field.
+    __m256 vn0 = _mm256_fmadd_ps(vx0, vlog2e, vmagic_bias);
+    __m256 vn1 = _mm256_fmadd_ps(vx1, vlog2e, vmagic_bias);
+    __m256 vn2 = _mm256_fmadd_ps(vx2, vlog2e, vmagic_bias);
+    __m256 vn3 = _mm256_fmadd_ps(vx3, vlog2e, vmagic_bias);
+
+    // Create a floating-point number s (scale) such that s == 2**n for inputs which don't cause underflow.
+    const __m256 vs0 = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_castps_si256(vn0), 23));
+    const __m256 vs1 = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_castps_si256(vn1), 23));
+    const __m256 vs2 = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_castps_si256(vn2), 23));
+    const __m256 vs3 = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_castps_si256(vn3), 23));
+
+    // Subtract the large number back to get final n := round(x / log(2)).
+    vn0 = _mm256_sub_ps(vn0, vmagic_bias);
+    vn1 = _mm256_sub_ps(vn1, vmagic_bias);
+    vn2 = _mm256_sub_ps(vn2, vmagic_bias);
+    vn3 = _mm256_sub_ps(vn3, vmagic_bias);
+
+    // Compute reduced argument t := x - n * log(2) using two constants to represent log(2) (Cody-Waite).
+    __m256 vt0 = _mm256_fmadd_ps(vn0, vminus_ln2_hi, vx0);
+    __m256 vt1 = _mm256_fmadd_ps(vn1, vminus_ln2_hi, vx1);
+    __m256 vt2 = _mm256_fmadd_ps(vn2, vminus_ln2_hi, vx2);
+    __m256 vt3 = _mm256_fmadd_ps(vn3, vminus_ln2_hi, vx3);
+
+    vt0 = _mm256_fmadd_ps(vn0, vminus_ln2_lo, vt0);
+    vt1 = _mm256_fmadd_ps(vn1, vminus_ln2_lo, vt1);
+    vt2 = _mm256_fmadd_ps(vn2, vminus_ln2_lo, vt2);
+    vt3 = _mm256_fmadd_ps(vn3, vminus_ln2_lo, vt3);
+
+    // Compute degree-5 polynomial approximation for exp(t) on [-log(2)/2, log(2)/2].
+    __m256 vp0 = _mm256_fmadd_ps(vc5, vt0, vc4);
+    __m256 vp1 = _mm256_fmadd_ps(vc5, vt1, vc4);
+    __m256 vp2 = _mm256_fmadd_ps(vc5, vt2, vc4);
+    __m256 vp3 = _mm256_fmadd_ps(vc5, vt3, vc4);
+
+    vp0 = _mm256_fmadd_ps(vp0, vt0, vc3);
+    vp1 = _mm256_fmadd_ps(vp1, vt1, vc3);
+    vp2 = _mm256_fmadd_ps(vp2, vt2, vc3);
+    vp3 = _mm256_fmadd_ps(vp3, vt3, vc3);
+
+    vp0 = _mm256_fmadd_ps(vp0, vt0, vc2);
+    vp1 = _mm256_fmadd_ps(vp1, vt1, vc2);
+    vp2 = _mm256_fmadd_ps(vp2, vt2, vc2);
+    vp3 = _mm256_fmadd_ps(vp3, vt3, vc2);
+
+    vp0 = _mm256_fmadd_ps(vp0, vt0, vc1);
+    vp1 = _mm256_fmadd_ps(vp1, vt1, vc1);
+    vp2 = _mm256_fmadd_ps(vp2, vt2, vc1);
+    vp3 = _mm256_fmadd_ps(vp3, vt3, vc1);
+
+    // Reconstruct the final f value:
+    //   f = s * (1 + t * (c1 + t * (c2 + t * (c3 + t * (c4 + t * c5)))))
+    //     = s + (t * s) * p
+    vt0 = _mm256_mul_ps(vt0, vs0);
+    vt1 = _mm256_mul_ps(vt1, vs1);
+    vt2 = _mm256_mul_ps(vt2, vs2);
+    vt3 = _mm256_mul_ps(vt3, vs3);
+
+    __m256 vf0 = _mm256_fmadd_ps(vt0, vp0, vs0);
+    __m256 vf1 = _mm256_fmadd_ps(vt1, vp1, vs1);
+    __m256 vf2 = _mm256_fmadd_ps(vt2, vp2, vs2);
+    __m256 vf3 = _mm256_fmadd_ps(vt3, vp3, vs3);
+
+    // For inputs below denormal cutoff, replace output with +0.0f.
+    // Note that for NaN inputs, comparison result is false, and outputs are left unchanged.
+    vf0 = _mm256_andnot_ps(_mm256_cmp_ps(vx0, vdenorm_cutoff, _CMP_LT_OS), vf0);
+    vf1 = _mm256_andnot_ps(_mm256_cmp_ps(vx1, vdenorm_cutoff, _CMP_LT_OS), vf1);
+    vf2 = _mm256_andnot_ps(_mm256_cmp_ps(vx2, vdenorm_cutoff, _CMP_LT_OS), vf2);
+    vf3 = _mm256_andnot_ps(_mm256_cmp_ps(vx3, vdenorm_cutoff, _CMP_LT_OS), vf3);
+
+    _mm256_storeu_ps(y, vf0);
+    _mm256_storeu_ps(y + 8, vf1);
+    _mm256_storeu_ps(y + 16, vf2);
+    _mm256_storeu_ps(y + 24, vf3);
+    y += 32;
+
+    vacc0 = _mm256_add_ps(vacc0, vf0);
+    vacc1 = _mm256_add_ps(vacc1, vf1);
+    vacc2 = _mm256_add_ps(vacc2, vf2);
+    vacc3 = _mm256_add_ps(vacc3, vf3);
+  }
+  // Add up all accumulators to vacc0
+  vacc0 = _mm256_add_ps(vacc0, vacc1);
+  vacc2 = _mm256_add_ps(vacc2, vacc3);
+  vacc0 = _mm256_add_ps(vacc0, vacc2);
+
+  __m256 vacc = vacc0;
+  for (; n >= 8 * sizeof(float); n -= 8 * sizeof(float)) {
+    const __m256 vi = _mm256_loadu_ps(x);
+    x += 8;
+
+    const __m256 vx = _mm256_sub_ps(vi, vi_max);
+
+    __m256 vn = _mm256_fmadd_ps(vx, vlog2e, vmagic_bias);
+    const __m256 vs = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_castps_si256(vn), 23));
+    vn = _mm256_sub_ps(vn, vmagic_bias);
+
+    __m256 vt = _mm256_fmadd_ps(vn, vminus_ln2_hi, vx);
+    vt = _mm256_fmadd_ps(vn, vminus_ln2_lo, vt);
+
+    __m256 vp = _mm256_fmadd_ps(vc5, vt, vc4);
+    vp = _mm256_fmadd_ps(vp, vt, vc3);
+    vp = _mm256_fmadd_ps(vp, vt, vc2);
+    vp = _mm256_fmadd_ps(vp, vt, vc1);
+
+    vt = _mm256_mul_ps(vt, vs);
+    __m256 vf = _mm256_fmadd_ps(vt, vp, vs);
+    vf = _mm256_andnot_ps(_mm256_cmp_ps(vx, vdenorm_cutoff, _CMP_LT_OS), vf);
+
+    _mm256_storeu_ps(y, vf);
+    y += 8;
+
+    vacc = _mm256_add_ps(vacc, vf);
+  }
+  if (n != 0) {
+    assert(n >= 1 * sizeof(float));
+    assert(n <= 7 * sizeof(float));
+    const __m256i vmask = _mm256_loadu_si256((const __m256i*) ((uintptr_t) &mask_table[7] - n));
+
+    const __m256 vi = _mm256_maskload_ps(x, vmask);
+
+    const __m256 vx = _mm256_sub_ps(vi, vi_max);
+
+    __m256 vn = _mm256_fmadd_ps(vx, vlog2e, vmagic_bias);
+    const __m256 vs = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_castps_si256(vn), 23));
+    vn = _mm256_sub_ps(vn, vmagic_bias);
+
+    __m256 vt = _mm256_fmadd_ps(vn, vminus_ln2_hi, vx);
+    vt = _mm256_fmadd_ps(vn, vminus_ln2_lo, vt);
+
+    __m256 vp = _mm256_fmadd_ps(vc5, vt, vc4);
+    vp = _mm256_fmadd_ps(vp, vt, vc3);
+    vp = _mm256_fmadd_ps(vp, vt, vc2);
+    vp = _mm256_fmadd_ps(vp, vt, vc1);
+
+    vt = _mm256_mul_ps(vt, vs);
+    __m256 vf = _mm256_fmadd_ps(vt, vp, vs);
+    vf = _mm256_andnot_ps(_mm256_cmp_ps(vx, vdenorm_cutoff, _CMP_LT_OS), vf);
+
+    // Masked-off lanes were loaded as zeroes, and produce non-zero exponents. Zero them out before accumulating.
+    vf = _mm256_and_ps(vf, _mm256_castsi256_ps(vmask));
+    _mm256_maskstore_ps(y, vmask, vf);
+
+    vacc = _mm256_add_ps(vacc, vf);
+  }
+  // Reduce 8 elements in the SIMD register
+  __m128 vacc_lo = _mm_add_ps(_mm256_castps256_ps128(vacc), _mm256_extractf128_ps(vacc, 1));
+  vacc_lo = _mm_add_ps(vacc_lo, _mm_movehl_ps(vacc_lo, vacc_lo));
+  vacc_lo = _mm_add_ss(vacc_lo, _mm_movehdup_ps(vacc_lo));
+  _mm_store_ss(sum, vacc_lo);
+}
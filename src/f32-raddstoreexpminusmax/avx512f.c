@@ -0,0 +1,201 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/raddstoreexpminusmax.h>
+
+
+void xnn_f32_raddstoreexpminusmax_ukernel__avx512f_x64(
+    size_t n,
+    const float* x,
+    float* y,
+    float* sum,
+    float max)
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+
+  const __m512 vmagic_bias = _mm512_set1_ps(0x1.8000FEp23f);
+  // The smallest x for which expf(x) is normalized.
+  const __m512 vdenorm_cutoff = _mm512_set1_ps(-0x1.5D589Ep6f);
+  const __m512 vlog2e = _mm512_set1_ps(0x1.715476p+0f);
+  const __m512 vminus_ln2_hi = _mm512_set1_ps(-0x1.62E43p-1f);
+  const __m512 vminus_ln2_lo = _mm512_set1_ps(0x1.05C61p-29f);
+
+  const __m512 vc1 = _mm512_set1_ps(0x1.FFFFF6p-1f);
+  const __m512 vc2 = _mm512_set1_ps(0x1.FFFDC6p-2f);
+  const __m512 vc3 = _mm512_set1_ps(0x1.555A80p-3f);
+  const __m512 vc4 = _mm512_set1_ps(0x1.573A1Ap-5f);
+  const __m512 vc5 = _mm512_set1_ps(0x1.0F9F9Cp-7f);
+
+  const __m512 vi_max = _mm512_set1_ps(max);
+
+  __m512 vacc0 = _mm512_setzero_ps();
+  __m512 vacc1 = _mm512_setzero_ps();
+  __m512 vacc2 = _mm512_setzero_ps();
+  __m512 vacc3 = _mm512_setzero_ps();
+  for (; n >= 64 * sizeof(float); n -= 64 * sizeof(float)) {
+    const __m512 vi0 = _mm512_loadu_ps(x);
+    const __m512 vi1 = _mm512_loadu_ps(x + 16);
+    const __m512 vi2 = _mm512_loadu_ps(x + 32);
+    const __m512 vi3 = _mm512_loadu_ps(x + 48);
+    x += 64;
+
+    // Subtract maximum input x := i - i_max. This implies x <= 0.
+    const __m512 vx0 = _mm512_sub_ps(vi0, vi_max);
+    const __m512 vx1 = _mm512_sub_ps(vi1, vi_max);
+    const __m512 vx2 = _mm512_sub_ps(vi2, vi_max);
+    const __m512 vx3 = _mm512_sub_ps(vi3, vi_max);
+
+    // Compute reduced argument n := round(x / log(2)) with the magic bias trick. The magic bias includes the exponent
+    // bias of 127, so the low bits of vn are ready to be shifted into the exponent field.
+    __m512 vn0 = _mm512_fmadd_ps(vx0, vlog2e, vmagic_bias);
+    __m512 vn1 = _mm512_fmadd_ps(vx1, vlog2e, vmagic_bias);
+    __m512 vn2 = _mm512_fmadd_ps(vx2, vlog2e, vmagic_bias);
+    __m512 vn3 = _mm512_fmadd_ps(vx3, vlog2e, vmagic_bias);
+
+    // Create a floating-point number s (scale) such that s == 2**n for inputs which don't cause underflow.
+    const __m512 vs0 = _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_castps_si512(vn0), 23));
+    const __m512 vs1 = _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_castps_si512(vn1), 23));
+    const __m512 vs2 = _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_castps_si512(vn2), 23));
+    const __m512 vs3 = _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_castps_si512(vn3), 23));
+
+    // Subtract the large number back to get final n := round(x / log(2)).
+    vn0 = _mm512_sub_ps(vn0, vmagic_bias);
+    vn1 = _mm512_sub_ps(vn1, vmagic_bias);
+    vn2 = _mm512_sub_ps(vn2, vmagic_bias);
+    vn3 = _mm512_sub_ps(vn3, vmagic_bias);
+
+    // Compute reduced argument t := x - n * log(2) using two constants to represent log(2) (Cody-Waite).
+    __m512 vt0 = _mm512_fmadd_ps(vn0, vminus_ln2_hi, vx0);
+    __m512 vt1 = _mm512_fmadd_ps(vn1, vminus_ln2_hi, vx1);
+    __m512 vt2 = _mm512_fmadd_ps(vn2, vminus_ln2_hi, vx2);
+    __m512 vt3 = _mm512_fmadd_ps(vn3, vminus_ln2_hi, vx3);
+
+    vt0 = _mm512_fmadd_ps(vn0, vminus_ln2_lo, vt0);
+    vt1 = _mm512_fmadd_ps(vn1, vminus_ln2_lo, vt1);
+    vt2 = _mm512_fmadd_ps(vn2, vminus_ln2_lo, vt2);
+    vt3 = _mm512_fmadd_ps(vn3, vminus_ln2_lo, vt3);
+
+    // Compute degree-5 polynomial approximation for exp(t) on [-log(2)/2, log(2)/2].
+    __m512 vp0 = _mm512_fmadd_ps(vc5, vt0, vc4);
+    __m512 vp1 = _mm512_fmadd_ps(vc5, vt1, vc4);
+    __m512 vp2 = _mm512_fmadd_ps(vc5, vt2, vc4);
+    __m512 vp3 = _mm512_fmadd_ps(vc5, vt3, vc4);
+
+    vp0 = _mm512_fmadd_ps(vp0, vt0, vc3);
+    vp1 = _mm512_fmadd_ps(vp1, vt1, vc3);
+    vp2 = _mm512_fmadd_ps(vp2, vt2, vc3);
+    vp3 = _mm512_fmadd_ps(vp3, vt3, vc3);
+
+    vp0 = _mm512_fmadd_ps(vp0, vt0, vc2);
+    vp1 = _mm512_fmadd_ps(vp1, vt1, vc2);
+    vp2 = _mm512_fmadd_ps(vp2, vt2, vc2);
+    vp3 = _mm512_fmadd_ps(vp3, vt3, vc2);
+
+    vp0 = _mm512_fmadd_ps(vp0, vt0, vc1);
+    vp1 = _mm512_fmadd_ps(vp1, vt1, vc1);
+    vp2 = _mm512_fmadd_ps(vp2, vt2, vc1);
+    vp3 = _mm512_fmadd_ps(vp3, vt3, vc1);
+
+    // Reconstruct the final f value:
+    //   f = s * (1 + t * (c1 + t * (c2 + t * (c3 + t * (c4 + t * c5)))))
+    //     = s + (t * s) * p
+    vt0 = _mm512_mul_ps(vt0, vs0);
+    vt1 = _mm512_mul_ps(vt1, vs1);
+    vt2 = _mm512_mul_ps(vt2, vs2);
+    vt3 = _mm512_mul_ps(vt3, vs3);
+
+    // For inputs below denormal cutoff, replace output with +0.0f.
+    // Note that for NaN inputs, comparison result is false, and outputs are left unchanged.
+    const __mmask16 vvalid0 = _mm512_cmp_ps_mask(vx0, vdenorm_cutoff, _CMP_NLT_US);
+    const __mmask16 vvalid1 = _mm512_cmp_ps_mask(vx1, vdenorm_cutoff, _CMP_NLT_US);
+    const __mmask16 vvalid2 = _mm512_cmp_ps_mask(vx2, vdenorm_cutoff, _CMP_NLT_US);
+    const __mmask16 vvalid3 = _mm512_cmp_ps_mask(vx3, vdenorm_cutoff, _CMP_NLT_US);
+
+    const __m512 vf0 = _mm512_maskz_fmadd_ps(vvalid0, vt0, vp0, vs0);
+    const __m512 vf1 = _mm512_maskz_fmadd_ps(vvalid1, vt1, vp1, vs1);
+    const __m512 vf2 = _mm512_maskz_fmadd_ps(vvalid2, vt2, vp2, vs2);
+    const __m512 vf3 = _mm512_maskz_fmadd_ps(vvalid3, vt3, vp3, vs3);
+
+    _mm512_storeu_ps(y, vf0);
+    _mm512_storeu_ps(y + 16, vf1);
+    _mm512_storeu_ps(y + 32, vf2);
+    _mm512_storeu_ps(y + 48, vf3);
+    y += 64;
+
+    vacc0 = _mm512_add_ps(vacc0, vf0);
+    vacc1 = _mm512_add_ps(vacc1, vf1);
+    vacc2 = _mm512_add_ps(vacc2, vf2);
+    vacc3 = _mm512_add_ps(vacc3, vf3);
+  }
+  // Add up all accumulators to vacc0
+  vacc0 = _mm512_add_ps(vacc0, vacc1);
+  vacc2 = _mm512_add_ps(vacc2, vacc3);
+  vacc0 = _mm512_add_ps(vacc0, vacc2);
+
+  __m512 vacc = vacc0;
+  for (; n >= 16 * sizeof(float); n -= 16 * sizeof(float)) {
+    const __m512 vi = _mm512_loadu_ps(x);
+    x += 16;
+
+    const __m512 vx = _mm512_sub_ps(vi, vi_max);
+
+    __m512 vn = _mm512_fmadd_ps(vx, vlog2e, vmagic_bias);
+    const __m512 vs = _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_castps_si512(vn), 23));
+    vn = _mm512_sub_ps(vn, vmagic_bias);
+
+    __m512 vt = _mm512_fmadd_ps(vn, vminus_ln2_hi, vx);
+    vt = _mm512_fmadd_ps(vn, vminus_ln2_lo, vt);
+
+    __m512 vp = _mm512_fmadd_ps(vc5, vt, vc4);
+    vp = _mm512_fmadd_ps(vp, vt, vc3);
+    vp = _mm512_fmadd_ps(vp, vt, vc2);
+    vp = _mm512_fmadd_ps(vp, vt, vc1);
+
+    vt = _mm512_mul_ps(vt, vs);
+    const __mmask16 vvalid = _mm512_cmp_ps_mask(vx, vdenorm_cutoff, _CMP_NLT_US);
+    const __m512 vf = _mm512_maskz_fmadd_ps(vvalid, vt, vp, vs);
+
+    _mm512_storeu_ps(y, vf);
+    y += 16;
+
+    vacc = _mm512_add_ps(vacc, vf);
+  }
+  if (n != 0) {
+    // Prepare mask for valid 32-bit elements (depends on n).
+    n >>= 2 /* log2(sizeof(float)) */;
+    const __mmask16 vmask = _cvtu32_mask16((uint16_t) ((uint32_t) (UINT32_C(1) << n) - UINT32_C(1)));
+
+    const __m512 vi = _mm512_maskz_loadu_ps(vmask, x);
+
+    const __m512 vx = _mm512_sub_ps(vi, vi_max);
+
+    __m512 vn = _mm512_fmadd_ps(vx, vlog2e, vmagic_bias);
+    const __m512 vs = _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_castps_si512(vn), 23));
+    vn = _mm512_sub_ps(vn, vmagic_bias);
+
+    __m512 vt = _mm512_fmadd_ps(vn, vminus_ln2_hi, vx);
+    vt = _mm512_fmadd_ps(vn, vminus_ln2_lo, vt);
+
+    __m512 vp = _mm512_fmadd_ps(vc5, vt, vc4);
+    vp = _mm512_fmadd_ps(vp, vt, vc3);
+    vp = _mm512_fmadd_ps(vp, vt, vc2);
+    vp = _mm512_fmadd_ps(vp, vt, vc1);
+
+    vt = _mm512_mul_ps(vt, vs);
+    const __mmask16 vvalid = _mm512_cmp_ps_mask(vx, vdenorm_cutoff, _CMP_NLT_US);
+    const __m512 vf = _mm512_maskz_fmadd_ps(vvalid, vt, vp, vs);
+
+    _mm512_mask_storeu_ps(y, vmask, vf);
+
+    vacc = _mm512_mask_add_ps(vacc, vmask, vacc, vf);
+  }
+  *sum = _mm512_reduce_add_ps(vacc);
+}
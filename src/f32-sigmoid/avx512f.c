@@ -0,0 +1,162 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_f32_sigmoid_ukernel__avx512f_x32(
+    size_t n,
+    const float* x,
+    float* y,
+    const void* params)
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+
+  const __m512 vsign_mask = _mm512_castsi512_ps(_mm512_set1_epi32(0x80000000));
+  const __m512 vmagic_bias = _mm512_set1_ps(0x1.8000FEp23f);
+  // The smallest z for which expf(z) is normalized.
+  const __m512 vdenorm_cutoff = _mm512_set1_ps(-0x1.5D589Ep6f);
+  const __m512 vlog2e = _mm512_set1_ps(0x1.715476p+0f);
+  const __m512 vminus_ln2_hi = _mm512_set1_ps(-0x1.62E43p-1f);
+  const __m512 vminus_ln2_lo = _mm512_set1_ps(0x1.05C61p-29f);
+  const __m512 vone = _mm512_set1_ps(1.0f);
+
+  const __m512 vc1 = _mm512_set1_ps(0x1.FFFFF6p-1f);
+  const __m512 vc2 = _mm512_set1_ps(0x1.FFFDC6p-2f);
+  const __m512 vc3 = _mm512_set1_ps(0x1.555A80p-3f);
+  const __m512 vc4 = _mm512_set1_ps(0x1.573A1Ap-5f);
+  const __m512 vc5 = _mm512_set1_ps(0x1.0F9F9Cp-7f);
+
+  for (; n >= 32 * sizeof(float); n -= 32 * sizeof(float)) {
+    const __m512 vx0 = _mm512_loadu_ps(x);
+    const __m512 vx1 = _mm512_loadu_ps(x + 16);
+    x += 32;
+
+    // Compute z := -|x| by setting the sign bit. Computing exp(z) instead of exp(x) avoids overflow for large positive x.
+    const __m512 vz0 = _mm512_castsi512_ps(_mm512_or_epi32(_mm512_castps_si512(vx0), _mm512_castps_si512(vsign_mask)));
+    const __m512 vz1 = _mm512_castsi512_ps(_mm512_or_epi32(_mm512_castps_si512(vx1), _mm512_castps_si512(vsign_mask)));
+
+    // Compute reduced argument n := round(z / log(2)) with the magic bias trick. The magic bias includes the exponent
+    // bias of 127, so the low bits of vn are ready to be shifted into the exponent field.
+    __m512 vn0 = _mm512_fmadd_ps(vz0, vlog2e, vmagic_bias);
+    __m512 vn1 = _mm512_fmadd_ps(vz1, vlog2e, vmagic_bias);
+
+    // Create a floating-point number s (scale) such that s == 2**n for inputs which don't cause underflow.
+    const __m512 vs0 = _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_castps_si512(vn0), 23));
+    const __m512 vs1 = _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_castps_si512(vn1), 23));
+
+    // Subtract the large number back to get final n := round(z / log(2)).
+    vn0 = _mm512_sub_ps(vn0, vmagic_bias);
+    vn1 = _mm512_sub_ps(vn1, vmagic_bias);
+
+    // Compute reduced argument t := z - n * log(2) using two constants to represent log(2) (Cody-Waite).
+    __m512 vt0 = _mm512_fmadd_ps(vn0, vminus_ln2_hi, vz0);
+    __m512 vt1 = _mm512_fmadd_ps(vn1, vminus_ln2_hi, vz1);
+
+    vt0 = _mm512_fmadd_ps(vn0, vminus_ln2_lo, vt0);
+    vt1 = _mm512_fmadd_ps(vn1, vminus_ln2_lo, vt1);
+
+    // Compute degree-5 polynomial approximation for exp(t) on [-log(2)/2, log(2)/2].
+    __m512 vp0 = _mm512_fmadd_ps(vc5, vt0, vc4);
+    __m512 vp1 = _mm512_fmadd_ps(vc5, vt1, vc4);
+
+    vp0 = _mm512_fmadd_ps(vp0, vt0, vc3);
+    vp1 = _mm512_fmadd_ps(vp1, vt1, vc3);
+
+    vp0 = _mm512_fmadd_ps(vp0, vt0, vc2);
+    vp1 = _mm512_fmadd_ps(vp1, vt1, vc2);
+
+    vp0 = _mm512_fmadd_ps(vp0, vt0, vc1);
+    vp1 = _mm512_fmadd_ps(vp1, vt1, vc1);
+
+    // Reconstruct the exp(z) value:
+    //   e = s * (1 + t * (c1 + t * (c2 + t * (c3 + t * (c4 + t * c5)))))
+    //     = s + (t * s) * p
+    vt0 = _mm512_mul_ps(vt0, vs0);
+    vt1 = _mm512_mul_ps(vt1, vs1);
+
+    const __m512 ve0 = _mm512_fmadd_ps(vt0, vp0, vs0);
+    const __m512 ve1 = _mm512_fmadd_ps(vt1, vp1, vs1);
+
+    // Denominator of the sigmoid fraction: 1.0 + exp(z)
+    const __m512 vd0 = _mm512_add_ps(ve0, vone);
+    const __m512 vd1 = _mm512_add_ps(ve1, vone);
+
+    // Reconstruct sigmoid(-|x|) = exp(z) / (1.0 + exp(z))
+    __m512 vf0 = _mm512_div_ps(ve0, vd0);
+    __m512 vf1 = _mm512_div_ps(ve1, vd1);
+
+    // For inputs below denormal cutoff, replace output with +0.0f.
+    // Note that for NaN inputs, comparison result is false, and outputs are left unchanged.
+    vf0 = _mm512_maskz_mov_ps(_mm512_cmp_ps_mask(vz0, vdenorm_cutoff, _CMP_NLT_US), vf0);
+    vf1 = _mm512_maskz_mov_ps(_mm512_cmp_ps_mask(vz1, vdenorm_cutoff, _CMP_NLT_US), vf1);
+
+    // Reconstruct sigmoid(x) = x < 0 ? sigmoid(-|x|) : 1.0 - sigmoid(-|x|)
+    vf0 = _mm512_mask_sub_ps(vf0, _mm512_testn_epi32_mask(_mm512_castps_si512(vx0), _mm512_castps_si512(vsign_mask)), vone, vf0);
+    vf1 = _mm512_mask_sub_ps(vf1, _mm512_testn_epi32_mask(_mm512_castps_si512(vx1), _mm512_castps_si512(vsign_mask)), vone, vf1);
+
+    _mm512_storeu_ps(y, vf0);
+    _mm512_storeu_ps(y + 16, vf1);
+    y += 32;
+  }
+  for (; n >= 16 * sizeof(float); n -= 16 * sizeof(float)) {
+    const __m512 vx = _mm512_loadu_ps(x);
+    x += 16;
+
+    const __m512 vz = _mm512_castsi512_ps(_mm512_or_epi32(_mm512_castps_si512(vx), _mm512_castps_si512(vsign_mask)));
+    __m512 vn = _mm512_fmadd_ps(vz, vlog2e, vmagic_bias);
+    const __m512 vs = _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_castps_si512(vn), 23));
+    vn = _mm512_sub_ps(vn, vmagic_bias);
+    __m512 vt = _mm512_fmadd_ps(vn, vminus_ln2_hi, vz);
+    vt = _mm512_fmadd_ps(vn, vminus_ln2_lo, vt);
+    __m512 vp = _mm512_fmadd_ps(vc5, vt, vc4);
+    vp = _mm512_fmadd_ps(vp, vt, vc3);
+    vp = _mm512_fmadd_ps(vp, vt, vc2);
+    vp = _mm512_fmadd_ps(vp, vt, vc1);
+    vt = _mm512_mul_ps(vt, vs);
+    const __m512 ve = _mm512_fmadd_ps(vt, vp, vs);
+    const __m512 vd = _mm512_add_ps(ve, vone);
+    __m512 vf = _mm512_div_ps(ve, vd);
+    vf = _mm512_maskz_mov_ps(_mm512_cmp_ps_mask(vz, vdenorm_cutoff, _CMP_NLT_US), vf);
+    vf = _mm512_mask_sub_ps(vf, _mm512_testn_epi32_mask(_mm512_castps_si512(vx), _mm512_castps_si512(vsign_mask)), vone, vf);
+
+    _mm512_storeu_ps(y, vf);
+    y += 16;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    assert(n >= 1 * sizeof(float));
+    assert(n <= 15 * sizeof(float));
+    // Prepare mask for valid 32-bit elements (depends on n).
+    n >>= 2 /* log2(sizeof(float)) */;
+    const __mmask16 vmask = _cvtu32_mask16((uint16_t) ((uint32_t) (UINT32_C(1) << n) - UINT32_C(1)));
+
+    const __m512 vx = _mm512_maskz_loadu_ps(vmask, x);
+
+    const __m512 vz = _mm512_castsi512_ps(_mm512_or_epi32(_mm512_castps_si512(vx), _mm512_castps_si512(vsign_mask)));
+    __m512 vn = _mm512_fmadd_ps(vz, vlog2e, vmagic_bias);
+    const __m512 vs = _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_castps_si512(vn), 23));
+    vn = _mm512_sub_ps(vn, vmagic_bias);
+    __m512 vt = _mm512_fmadd_ps(vn, vminus_ln2_hi, vz);
+    vt = _mm512_fmadd_ps(vn, vminus_ln2_lo, vt);
+    __m512 vp = _mm512_fmadd_ps(vc5, vt, vc4);
+    vp = _mm512_fmadd_ps(vp, vt, vc3);
+    vp = _mm512_fmadd_ps(vp, vt, vc2);
+    vp = _mm512_fmadd_ps(vp, vt, vc1);
+    vt = _mm512_mul_ps(vt, vs);
+    const __m512 ve = _mm512_fmadd_ps(vt, vp, vs);
+    const __m512 vd = _mm512_add_ps(ve, vone);
+    __m512 vf = _mm512_div_ps(ve, vd);
+    vf = _mm512_maskz_mov_ps(_mm512_cmp_ps_mask(vz, vdenorm_cutoff, _CMP_NLT_US), vf);
+    vf = _mm512_mask_sub_ps(vf, _mm512_testn_epi32_mask(_mm512_castps_si512(vx), _mm512_castps_si512(vsign_mask)), vone, vf);
+
+    _mm512_mask_storeu_ps(y, vmask, vf);
+  }
+}
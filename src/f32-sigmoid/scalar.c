@@ -0,0 +1,144 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <math.h>
+
+#include <fp16/bitcasts.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_f32_sigmoid_ukernel__scalar_x2(
+    size_t n,
+    const float* x,
+    float* y,
+    const void* params)
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+
+  const float vmagic_bias = 0x1.8000FEp23f;
+  // The smallest z for which expf(z) is normalized.
+  const float vdenorm_cutoff = -0x1.5D589Ep6f;
+  const float vlog2e = 0x1.715476p+0f;
+  const float vminus_ln2_hi = -0x1.62E43p-1f;
+  const float vminus_ln2_lo = 0x1.05C61p-29f;
+  const float vone = 1.0f;
+
+  const float vc1 = 0x1.FFFFF6p-1f;
+  const float vc2 = 0x1.FFFDC6p-2f;
+  const float vc3 = 0x1.555A80p-3f;
+  const float vc4 = 0x1.573A1Ap-5f;
+  const float vc5 = 0x1.0F9F9Cp-7f;
+
+  for (; n >= 2 * sizeof(float); n -= 2 * sizeof(float)) {
+    const float vx0 = x[0];
+    const float vx1 = x[1];
+    x += 2;
+
+    // Compute z := -|x|. Computing exp(z) instead of exp(x) avoids overflow for large positive x.
+    const float vz0 = -fabsf(vx0);
+    const float vz1 = -fabsf(vx1);
+
+    // Compute reduced argument n := round(z / log(2)) with the magic bias trick. The magic bias includes the exponent
+    // bias of 127, so the low bits of vn are ready to be shifted into the exponent field.
+    float vn0 = vz0 * vlog2e + vmagic_bias;
+    float vn1 = vz1 * vlog2e + vmagic_bias;
+
+    // Create a floating-point number s (scale) such that s == 2**n for inputs which don't cause underflow.
+    const float vs0 = fp32_from_bits(fp32_to_bits(vn0) << 23);
+    const float vs1 = fp32_from_bits(fp32_to_bits(vn1) << 23);
+
+    // Subtract the large number back to get final n := round(z / log(2)).
+    vn0 -= vmagic_bias;
+    vn1 -= vmagic_bias;
+
+    // Compute reduced argument t := z - n * log(2) using two constants to represent log(2) (Cody-Waite).
+    float vt0 = vn0 * vminus_ln2_hi + vz0;
+    float vt1 = vn1 * vminus_ln2_hi + vz1;
+
+    vt0 = vn0 * vminus_ln2_lo + vt0;
+    vt1 = vn1 * vminus_ln2_lo + vt1;
+
+    // Compute degree-5 polynomial approximation for exp(t) on [-log(2)/2, log(2)/2].
+    float vp0 = vc5 * vt0 + vc4;
+    float vp1 = vc5 * vt1 + vc4;
+
+    vp0 = vp0 * vt0 + vc3;
+    vp1 = vp1 * vt1 + vc3;
+
+    vp0 = vp0 * vt0 + vc2;
+    vp1 = vp1 * vt1 + vc2;
+
+    vp0 = vp0 * vt0 + vc1;
+    vp1 = vp1 * vt1 + vc1;
+
+    // Reconstruct the exp(z) value:
+    //   e = s * (1 + t * (c1 + t * (c2 + t * (c3 + t * (c4 + t * c5)))))
+    //     = s + (t * s) * p
+    vt0 *= vs0;
+    vt1 *= vs1;
+
+    const float ve0 = vt0 * vp0 + vs0;
+    const float ve1 = vt1 * vp1 + vs1;
+
+    // Reconstruct sigmoid(-|x|) = exp(z) / (1.0 + exp(z))
+    float vf0 = ve0 / (ve0 + vone);
+    float vf1 = ve1 / (ve1 + vone);
+
+    // For inputs below denormal cutoff, replace output with +0.0f.
+    // Note that for NaN inputs, comparison result is false, and outputs are left unchanged.
+    if XNN_UNPREDICTABLE(vz0 < vdenorm_cutoff) {
+      vf0 = 0.0f;
+    }
+    if XNN_UNPREDICTABLE(vz1 < vdenorm_cutoff) {
+      vf1 = 0.0f;
+    }
+
+    // Reconstruct sigmoid(x) = x < 0 ? sigmoid(-|x|) : 1.0 - sigmoid(-|x|)
+    if XNN_UNPREDICTABLE(vx0 > 0.0f) {
+      vf0 = vone - vf0;
+    }
+    if XNN_UNPREDICTABLE(vx1 > 0.0f) {
+      vf1 = vone - vf1;
+    }
+
+    y[0] = vf0;
+    y[1] = vf1;
+    y += 2;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    const float vx = *x;
+
+    const float vz = -fabsf(vx);
+
+    float vn = vz * vlog2e + vmagic_bias;
+    const float vs = fp32_from_bits(fp32_to_bits(vn) << 23);
+    vn -= vmagic_bias;
+
+    float vt = vn * vminus_ln2_hi + vz;
+    vt = vn * vminus_ln2_lo + vt;
+
+    float vp = vc5 * vt + vc4;
+    vp = vp * vt + vc3;
+    vp = vp * vt + vc2;
+    vp = vp * vt + vc1;
+
+    vt *= vs;
+    const float ve = vt * vp + vs;
+
+    float vf = ve / (ve + vone);
+    if XNN_UNPREDICTABLE(vz < vdenorm_cutoff) {
+      vf = 0.0f;
+    }
+    if XNN_UNPREDICTABLE(vx > 0.0f) {
+      vf = vone - vf;
+    }
+
+    *y = vf;
+  }
+}
@@ -0,0 +1,357 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-spmm/fma3.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/spmm.h>
+
+
+void xnn_f32_spmm_ukernel_16x2__fma3(
+    uint32_t m,
+    uint32_t n,
+    const float*restrict a,
+    const float*restrict weights,
+    const int32_t*restrict widx_dmap,
+    const uint32_t*restrict nidx_nnzmap,
+    float*restrict c,
+    const union xnn_f32_output_params params[restrict static 1])
+{
+  assert(m != 0);
+
+  const __m256 vmin = _mm256_broadcast_ps((const __m128*) params->sse.min);
+  const __m256 vmax = _mm256_broadcast_ps((const __m128*) params->sse.max);
+  size_t i = m;
+  while XNN_LIKELY(i >= 16) {
+    const float*restrict w = weights;
+    const int32_t* dmap = widx_dmap;
+    const uint32_t* nnzmap = nidx_nnzmap;
+    size_t j = n;
+    while (j >= 2) {
+      uint32_t nnz = *nnzmap++;
+      __m256 vacc01234567c0 = _mm256_broadcast_ss(w); w += 1;
+      __m256 vacc89ABCDEFc0 = vacc01234567c0;
+      __m256 vacc01234567c1 = _mm256_broadcast_ss(w); w += 1;
+      __m256 vacc89ABCDEFc1 = vacc01234567c1;
+      if XNN_LIKELY(nnz != 0) {
+        do {
+          const intptr_t diff = *dmap++;
+          const __m256 va01234567 = _mm256_loadu_ps(a);
+          const __m256 va89ABCDEF = _mm256_loadu_ps(a + 8);
+          a = (const float*restrict) ((uintptr_t) a + (uintptr_t) diff);
+          const __m256 vb0 = _mm256_broadcast_ss(w + 0);
+          const __m256 vb1 = _mm256_broadcast_ss(w + 1);
+          w += 2;
+
+          vacc01234567c0 = _mm256_fmadd_ps(va01234567, vb0, vacc01234567c0);
+          vacc89ABCDEFc0 = _mm256_fmadd_ps(va89ABCDEF, vb0, vacc89ABCDEFc0);
+          vacc01234567c1 = _mm256_fmadd_ps(va01234567, vb1, vacc01234567c1);
+          vacc89ABCDEFc1 = _mm256_fmadd_ps(va89ABCDEF, vb1, vacc89ABCDEFc1);
+        } while (--nnz != 0);
+      }
+      __m256 vout01234567c0 = _mm256_min_ps(vacc01234567c0, vmax);
+      __m256 vout89ABCDEFc0 = _mm256_min_ps(vacc89ABCDEFc0, vmax);
+      __m256 vout01234567c1 = _mm256_min_ps(vacc01234567c1, vmax);
+      __m256 vout89ABCDEFc1 = _mm256_min_ps(vacc89ABCDEFc1, vmax);
+
+      vout01234567c0 = _mm256_max_ps(vout01234567c0, vmin);
+      vout89ABCDEFc0 = _mm256_max_ps(vout89ABCDEFc0, vmin);
+      vout01234567c1 = _mm256_max_ps(vout01234567c1, vmin);
+      vout89ABCDEFc1 = _mm256_max_ps(vout89ABCDEFc1, vmin);
+
+      _mm256_storeu_ps(c + 0 * m + 0, vout01234567c0);
+      _mm256_storeu_ps(c + 0 * m + 8, vout89ABCDEFc0);
+      _mm256_storeu_ps(c + 1 * m + 0, vout01234567c1);
+      _mm256_storeu_ps(c + 1 * m + 8, vout89ABCDEFc1);
+      c += 2 * m;
+      j -= 2;
+    }
+
+    // clean up loop, fall back to nr=1
+    if XNN_UNLIKELY(j != 0) {
+      do {
+        uint32_t nnz = *nnzmap++;
+        __m256 vacc01234567 = _mm256_broadcast_ss(w); w += 1;
+        __m256 vacc89ABCDEF = vacc01234567;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m256 va01234567 = _mm256_loadu_ps(a);
+            const __m256 va89ABCDEF = _mm256_loadu_ps(a + 8);
+            a = (const float*restrict) ((uintptr_t) a + (uintptr_t) diff);
+            const __m256 vb = _mm256_broadcast_ss(w); w += 1;
+            vacc01234567 = _mm256_fmadd_ps(va01234567, vb, vacc01234567);
+            vacc89ABCDEF = _mm256_fmadd_ps(va89ABCDEF, vb, vacc89ABCDEF);
+          } while (--nnz != 0);
+        }
+        __m256 vout01234567 = _mm256_min_ps(vacc01234567, vmax);
+        __m256 vout89ABCDEF = _mm256_min_ps(vacc89ABCDEF, vmax);
+
+        vout01234567 = _mm256_max_ps(vout01234567, vmin);
+        vout89ABCDEF = _mm256_max_ps(vout89ABCDEF, vmin);
+
+        _mm256_storeu_ps(c + 0, vout01234567);
+        _mm256_storeu_ps(c + 8, vout89ABCDEF);
+        c += m;
+        j -= 1;
+      } while (j != 0);
+    }
+    c -= m * n;
+    c += 16;
+    a += 16;
+    i -= 16;
+  }
+  if XNN_UNLIKELY(i != 0) {
+    if (i & 8) {
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t j = n;
+      while (j >= 2) {
+        uint32_t nnz = *nnzmap++;
+        __m256 vacc01234567c0 = _mm256_broadcast_ss(w); w += 1;
+        __m256 vacc01234567c1 = _mm256_broadcast_ss(w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m256 va01234567 = _mm256_loadu_ps(a);
+            a = (const float*restrict) ((uintptr_t) a + (uintptr_t) diff);
+            const __m256 vb0 = _mm256_broadcast_ss(w + 0);
+            const __m256 vb1 = _mm256_broadcast_ss(w + 1);
+            w += 2;
+
+            vacc01234567c0 = _mm256_fmadd_ps(va01234567, vb0, vacc01234567c0);
+            vacc01234567c1 = _mm256_fmadd_ps(va01234567, vb1, vacc01234567c1);
+          } while (--nnz != 0);
+        }
+        __m256 vout01234567c0 = _mm256_min_ps(vacc01234567c0, vmax);
+        __m256 vout01234567c1 = _mm256_min_ps(vacc01234567c1, vmax);
+
+        vout01234567c0 = _mm256_max_ps(vout01234567c0, vmin);
+        vout01234567c1 = _mm256_max_ps(vout01234567c1, vmin);
+
+        _mm256_storeu_ps(c + 0 * m, vout01234567c0);
+        _mm256_storeu_ps(c + 1 * m, vout01234567c1);
+        c += 2 * m;
+        j -= 2;
+      }
+
+      // clean up loop, fall back to nr=1
+      if XNN_UNLIKELY(j != 0) {
+        do {
+          uint32_t nnz = *nnzmap++;
+          __m256 vacc01234567 = _mm256_broadcast_ss(w); w += 1;
+          if XNN_LIKELY(nnz != 0) {
+            do {
+              const intptr_t diff = *dmap++;
+              const __m256 va01234567 = _mm256_loadu_ps(a);
+              a = (const float*restrict) ((uintptr_t) a + (uintptr_t) diff);
+              const __m256 vb = _mm256_broadcast_ss(w); w += 1;
+              vacc01234567 = _mm256_fmadd_ps(va01234567, vb, vacc01234567);
+            } while (--nnz != 0);
+          }
+          __m256 vout01234567 = _mm256_min_ps(vacc01234567, vmax);
+
+          vout01234567 = _mm256_max_ps(vout01234567, vmin);
+
+          _mm256_storeu_ps(c, vout01234567);
+          c += m;
+          j -= 1;
+        } while (j != 0);
+      }
+      c -= m * n;
+      c += 8;
+      a += 8;
+    }
+    if (i & 4) {
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t j = n;
+      while (j >= 2) {
+        uint32_t nnz = *nnzmap++;
+        __m128 vacc0123c0 = _mm_broadcast_ss(w); w += 1;
+        __m128 vacc0123c1 = _mm_broadcast_ss(w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m128 va0123 = _mm_loadu_ps(a);
+            a = (const float*restrict) ((uintptr_t) a + (uintptr_t) diff);
+            const __m128 vb0 = _mm_broadcast_ss(w + 0);
+            const __m128 vb1 = _mm_broadcast_ss(w + 1);
+            w += 2;
+
+            vacc0123c0 = _mm_fmadd_ps(va0123, vb0, vacc0123c0);
+            vacc0123c1 = _mm_fmadd_ps(va0123, vb1, vacc0123c1);
+          } while (--nnz != 0);
+        }
+        __m128 vout0123c0 = _mm_min_ps(vacc0123c0, _mm256_castps256_ps128(vmax));
+        __m128 vout0123c1 = _mm_min_ps(vacc0123c1, _mm256_castps256_ps128(vmax));
+
+        vout0123c0 = _mm_max_ps(vout0123c0, _mm256_castps256_ps128(vmin));
+        vout0123c1 = _mm_max_ps(vout0123c1, _mm256_castps256_ps128(vmin));
+
+        _mm_storeu_ps(c + 0 * m, vout0123c0);
+        _mm_storeu_ps(c + 1 * m, vout0123c1);
+        c += 2 * m;
+        j -= 2;
+      }
+
+      // clean up loop, fall back to nr=1
+      if XNN_UNLIKELY(j != 0) {
+        do {
+          uint32_t nnz = *nnzmap++;
+          __m128 vacc0123 = _mm_broadcast_ss(w); w += 1;
+          if XNN_LIKELY(nnz != 0) {
+            do {
+              const intptr_t diff = *dmap++;
+              const __m128 va0123 = _mm_loadu_ps(a);
+              a = (const float*restrict) ((uintptr_t) a + (uintptr_t) diff);
+              const __m128 vb = _mm_broadcast_ss(w); w += 1;
+              vacc0123 = _mm_fmadd_ps(va0123, vb, vacc0123);
+            } while (--nnz != 0);
+          }
+          __m128 vout0123 = _mm_min_ps(vacc0123, _mm256_castps256_ps128(vmax));
+
+          vout0123 = _mm_max_ps(vout0123, _mm256_castps256_ps128(vmin));
+
+          _mm_storeu_ps(c, vout0123);
+          c += m;
+          j -= 1;
+        } while (j != 0);
+      }
+      c -= m * n;
+      c += 4;
+      a += 4;
+    }
+    if (i & 2) {
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t j = n;
+      while (j >= 2) {
+        uint32_t nnz = *nnzmap++;
+        __m128 vacc01c0 = _mm_broadcast_ss(w); w += 1;
+        __m128 vacc01c1 = _mm_broadcast_ss(w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m128 va01 = _mm_loadl_pi(_mm_undefined_ps(), (const __m64*) a);
+            a = (const float*restrict) ((uintptr_t) a + (uintptr_t) diff);
+            const __m128 vb0 = _mm_broadcast_ss(w + 0);
+            const __m128 vb1 = _mm_broadcast_ss(w + 1);
+            w += 2;
+
+            vacc01c0 = _mm_fmadd_ps(va01, vb0, vacc01c0);
+            vacc01c1 = _mm_fmadd_ps(va01, vb1, vacc01c1);
+          } while (--nnz != 0);
+        }
+        __m128 vout01c0 = _mm_min_ps(vacc01c0, _mm256_castps256_ps128(vmax));
+        __m128 vout01c1 = _mm_min_ps(vacc01c1, _mm256_castps256_ps128(vmax));
+
+        vout01c0 = _mm_max_ps(vout01c0, _mm256_castps256_ps128(vmin));
+        vout01c1 = _mm_max_ps(vout01c1, _mm256_castps256_ps128(vmin));
+
+        _mm_storel_pi((__m64*) (c + 0 * m), vout01c0);
+        _mm_storel_pi((__m64*) (c + 1 * m), vout01c1);
+        c += 2 * m;
+        j -= 2;
+      }
+
+      // clean up loop, fall back to nr=1
+      if XNN_UNLIKELY(j != 0) {
+        do {
+          uint32_t nnz = *nnzmap++;
+          __m128 vacc01 = _mm_broadcast_ss(w); w += 1;
+          if XNN_LIKELY(nnz != 0) {
+            do {
+              const intptr_t diff = *dmap++;
+              const __m128 va01 = _mm_loadl_pi(_mm_undefined_ps(), (const __m64*) a);
+              a = (const float*restrict) ((uintptr_t) a + (uintptr_t) diff);
+              const __m128 vb = _mm_broadcast_ss(w); w += 1;
+              vacc01 = _mm_fmadd_ps(va01, vb, vacc01);
+            } while (--nnz != 0);
+          }
+          __m128 vout01 = _mm_min_ps(vacc01, _mm256_castps256_ps128(vmax));
+
+          vout01 = _mm_max_ps(vout01, _mm256_castps256_ps128(vmin));
+
+          _mm_storel_pi((__m64*) c, vout01);
+          c += m;
+          j -= 1;
+        } while (j != 0);
+      }
+      c -= m * n;
+      c += 2;
+      a += 2;
+    }
+    if (i & 1) {
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t j = n;
+      while (j >= 2) {
+        uint32_t nnz = *nnzmap++;
+        __m128 vacc0c0 = _mm_broadcast_ss(w); w += 1;
+        __m128 vacc0c1 = _mm_broadcast_ss(w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m128 va0 = _mm_load_ss(a);
+            a = (const float*restrict) ((uintptr_t) a + (uintptr_t) diff);
+            const __m128 vb0 = _mm_broadcast_ss(w + 0);
+            const __m128 vb1 = _mm_broadcast_ss(w + 1);
+            w += 2;
+
+            vacc0c0 = _mm_fmadd_ps(va0, vb0, vacc0c0);
+            vacc0c1 = _mm_fmadd_ps(va0, vb1, vacc0c1);
+          } while (--nnz != 0);
+        }
+        __m128 vout0c0 = _mm_min_ps(vacc0c0, _mm256_castps256_ps128(vmax));
+        __m128 vout0c1 = _mm_min_ps(vacc0c1, _mm256_castps256_ps128(vmax));
+
+        vout0c0 = _mm_max_ps(vout0c0, _mm256_castps256_ps128(vmin));
+        vout0c1 = _mm_max_ps(vout0c1, _mm256_castps256_ps128(vmin));
+
+        _mm_store_ss(c + 0 * m, vout0c0);
+        _mm_store_ss(c + 1 * m, vout0c1);
+        c += 2 * m;
+        j -= 2;
+      }
+
+      // clean up loop, fall back to nr=1
+      if XNN_UNLIKELY(j != 0) {
+        do {
+          uint32_t nnz = *nnzmap++;
+          __m128 vacc0 = _mm_broadcast_ss(w); w += 1;
+          if XNN_LIKELY(nnz != 0) {
+            do {
+              const intptr_t diff = *dmap++;
+              const __m128 va0 = _mm_load_ss(a);
+              a = (const float*restrict) ((uintptr_t) a + (uintptr_t) diff);
+              const __m128 vb = _mm_broadcast_ss(w); w += 1;
+              vacc0 = _mm_fmadd_ps(va0, vb, vacc0);
+            } while (--nnz != 0);
+          }
+          __m128 vout0 = _mm_min_ps(vacc0, _mm256_castps256_ps128(vmax));
+
+          vout0 = _mm_max_ps(vout0, _mm256_castps256_ps128(vmin));
+
+          _mm_store_ss(c, vout0);
+          c += m;
+          j -= 1;
+        } while (j != 0);
+      }
+      c -= m * n;
+      c += 1;
+      a += 1;
+    }
+  }
+}
@@ -0,0 +1,395 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-spmm/sse-blocked.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xmmintrin.h>
+
+#include <xnnpack/spmm.h>
+
+
+void xnn_f32_spmm_ukernel_16x2__sse(
+    uint32_t m,
+    uint32_t n,
+    const float*restrict a,
+    const float*restrict weights,
+    const int32_t*restrict widx_dmap,
+    const uint32_t*restrict nidx_nnzmap,
+    float*restrict c,
+    const union xnn_f32_output_params params[restrict static 1])
+{
+  assert(m != 0);
+
+  const __m128 vmin = _mm_load_ps(params->sse.min);
+  const __m128 vmax = _mm_load_ps(params->sse.max);
+  size_t i = m;
+  while XNN_LIKELY(i >= 16) {
+    const float*restrict w = weights;
+    const int32_t* dmap = widx_dmap;
+    const uint32_t* nnzmap = nidx_nnzmap;
+    size_t j = n;
+    while (j >= 2) {
+      uint32_t nnz = *nnzmap++;
+      __m128 vacc0123c0 = _mm_load1_ps(w); w += 1;
+      __m128 vacc4567c0 = vacc0123c0;
+      __m128 vacc89ABc0 = vacc0123c0;
+      __m128 vaccCDEFc0 = vacc0123c0;
+      __m128 vacc0123c1 = _mm_load1_ps(w); w += 1;
+      __m128 vacc4567c1 = vacc0123c1;
+      __m128 vacc89ABc1 = vacc0123c1;
+      __m128 vaccCDEFc1 = vacc0123c1;
+      if XNN_LIKELY(nnz != 0) {
+        do {
+          const intptr_t diff = *dmap++;
+          const __m128 va0123 = _mm_loadu_ps(a);
+          const __m128 va4567 = _mm_loadu_ps(a + 4);
+          const __m128 va89AB = _mm_loadu_ps(a + 8);
+          const __m128 vaCDEF = _mm_loadu_ps(a + 12);
+          a = (const float*restrict) ((uintptr_t) a + (uintptr_t) diff);
+          const __m128 vb0 = _mm_load1_ps(w + 0);
+          const __m128 vb1 = _mm_load1_ps(w + 1);
+          w += 2;
+
+          vacc0123c0 = _mm_add_ps(vacc0123c0, _mm_mul_ps(va0123, vb0));
+          vacc4567c0 = _mm_add_ps(vacc4567c0, _mm_mul_ps(va4567, vb0));
+          vacc89ABc0 = _mm_add_ps(vacc89ABc0, _mm_mul_ps(va89AB, vb0));
+          vaccCDEFc0 = _mm_add_ps(vaccCDEFc0, _mm_mul_ps(vaCDEF, vb0));
+          vacc0123c1 = _mm_add_ps(vacc0123c1, _mm_mul_ps(va0123, vb1));
+          vacc4567c1 = _mm_add_ps(vacc4567c1, _mm_mul_ps(va4567, vb1));
+          vacc89ABc1 = _mm_add_ps(vacc89ABc1, _mm_mul_ps(va89AB, vb1));
+          vaccCDEFc1 = _mm_add_ps(vaccCDEFc1, _mm_mul_ps(vaCDEF, vb1));
+        } while (--nnz != 0);
+      }
+      __m128 vout0123c0 = _mm_min_ps(vacc0123c0, vmax);
+      __m128 vout4567c0 = _mm_min_ps(vacc4567c0, vmax);
+      __m128 vout89ABc0 = _mm_min_ps(vacc89ABc0, vmax);
+      __m128 voutCDEFc0 = _mm_min_ps(vaccCDEFc0, vmax);
+      __m128 vout0123c1 = _mm_min_ps(vacc0123c1, vmax);
+      __m128 vout4567c1 = _mm_min_ps(vacc4567c1, vmax);
+      __m128 vout89ABc1 = _mm_min_ps(vacc89ABc1, vmax);
+      __m128 voutCDEFc1 = _mm_min_ps(vaccCDEFc1, vmax);
+
+      vout0123c0 = _mm_max_ps(vout0123c0, vmin);
+      vout4567c0 = _mm_max_ps(vout4567c0, vmin);
+      vout89ABc0 = _mm_max_ps(vout89ABc0, vmin);
+      voutCDEFc0 = _mm_max_ps(voutCDEFc0, vmin);
+      vout0123c1 = _mm_max_ps(vout0123c1, vmin);
+      vout4567c1 = _mm_max_ps(vout4567c1, vmin);
+      vout89ABc1 = _mm_max_ps(vout89ABc1, vmin);
+      voutCDEFc1 = _mm_max_ps(voutCDEFc1, vmin);
+
+      _mm_storeu_ps(c + 0 * m + 0, vout0123c0);
+      _mm_storeu_ps(c + 0 * m + 4, vout4567c0);
+      _mm_storeu_ps(c + 0 * m + 8, vout89ABc0);
+      _mm_storeu_ps(c + 0 * m + 12, voutCDEFc0);
+      _mm_storeu_ps(c + 1 * m + 0, vout0123c1);
+      _mm_storeu_ps(c + 1 * m + 4, vout4567c1);
+      _mm_storeu_ps(c + 1 * m + 8, vout89ABc1);
+      _mm_storeu_ps(c + 1 * m + 12, voutCDEFc1);
+      c += 2 * m;
+      j -= 2;
+    }
+
+    // clean up loop, fall back to nr=1
+    if XNN_UNLIKELY(j != 0) {
+      do {
+        uint32_t nnz = *nnzmap++;
+        __m128 vacc0123 = _mm_load1_ps(w); w += 1;
+        __m128 vacc4567 = vacc0123;
+        __m128 vacc89AB = vacc0123;
+        __m128 vaccCDEF = vacc0123;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m128 va0123 = _mm_loadu_ps(a);
+            const __m128 va4567 = _mm_loadu_ps(a + 4);
+            const __m128 va89AB = _mm_loadu_ps(a + 8);
+            const __m128 vaCDEF = _mm_loadu_ps(a + 12);
+            a = (const float*restrict) ((uintptr_t) a + (uintptr_t) diff);
+            const __m128 vb = _mm_load1_ps(w); w += 1;
+            vacc0123 = _mm_add_ps(vacc0123, _mm_mul_ps(va0123, vb));
+            vacc4567 = _mm_add_ps(vacc4567, _mm_mul_ps(va4567, vb));
+            vacc89AB = _mm_add_ps(vacc89AB, _mm_mul_ps(va89AB, vb));
+            vaccCDEF = _mm_add_ps(vaccCDEF, _mm_mul_ps(vaCDEF, vb));
+          } while (--nnz != 0);
+        }
+        __m128 vout0123 = _mm_min_ps(vacc0123, vmax);
+        __m128 vout4567 = _mm_min_ps(vacc4567, vmax);
+        __m128 vout89AB = _mm_min_ps(vacc89AB, vmax);
+        __m128 voutCDEF = _mm_min_ps(vaccCDEF, vmax);
+
+        vout0123 = _mm_max_ps(vout0123, vmin);
+        vout4567 = _mm_max_ps(vout4567, vmin);
+        vout89AB = _mm_max_ps(vout89AB, vmin);
+        voutCDEF = _mm_max_ps(voutCDEF, vmin);
+
+        _mm_storeu_ps(c + 0, vout0123);
+        _mm_storeu_ps(c + 4, vout4567);
+        _mm_storeu_ps(c + 8, vout89AB);
+        _mm_storeu_ps(c + 12, voutCDEF);
+        c += m;
+        j -= 1;
+      } while (j != 0);
+    }
+    c -= m * n;
+    c += 16;
+    a += 16;
+    i -= 16;
+  }
+  if XNN_UNLIKELY(i != 0) {
+    if (i & 8) {
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t j = n;
+      while (j >= 2) {
+        uint32_t nnz = *nnzmap++;
+        __m128 vacc0123c0 = _mm_load1_ps(w); w += 1;
+        __m128 vacc4567c0 = vacc0123c0;
+        __m128 vacc0123c1 = _mm_load1_ps(w); w += 1;
+        __m128 vacc4567c1 = vacc0123c1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m128 va0123 = _mm_loadu_ps(a);
+            const __m128 va4567 = _mm_loadu_ps(a + 4);
+            a = (const float*restrict) ((uintptr_t) a + (uintptr_t) diff);
+            const __m128 vb0 = _mm_load1_ps(w + 0);
+            const __m128 vb1 = _mm_load1_ps(w + 1);
+            w += 2;
+
+            vacc0123c0 = _mm_add_ps(vacc0123c0, _mm_mul_ps(va0123, vb0));
+            vacc4567c0 = _mm_add_ps(vacc4567c0, _mm_mul_ps(va4567, vb0));
+            vacc0123c1 = _mm_add_ps(vacc0123c1, _mm_mul_ps(va0123, vb1));
+            vacc4567c1 = _mm_add_ps(vacc4567c1, _mm_mul_ps(va4567, vb1));
+          } while (--nnz != 0);
+        }
+        __m128 vout0123c0 = _mm_min_ps(vacc0123c0, vmax);
+        __m128 vout4567c0 = _mm_min_ps(vacc4567c0, vmax);
+        vout0123c0 = _mm_max_ps(vout0123c0, vmin);
+        vout4567c0 = _mm_max_ps(vout4567c0, vmin);
+        _mm_storeu_ps(c + 0 * m + 0, vout0123c0);
+        _mm_storeu_ps(c + 0 * m + 4, vout4567c0);
+        __m128 vout0123c1 = _mm_min_ps(vacc0123c1, vmax);
+        __m128 vout4567c1 = _mm_min_ps(vacc4567c1, vmax);
+        vout0123c1 = _mm_max_ps(vout0123c1, vmin);
+        vout4567c1 = _mm_max_ps(vout4567c1, vmin);
+        _mm_storeu_ps(c + 1 * m + 0, vout0123c1);
+        _mm_storeu_ps(c + 1 * m + 4, vout4567c1);
+        c += 2 * m;
+        j -= 2;
+      }
+
+      // clean up loop, fall back to nr=1
+      if XNN_UNLIKELY(j != 0) {
+        do {
+          uint32_t nnz = *nnzmap++;
+          __m128 vacc0123 = _mm_load1_ps(w); w += 1;
+          __m128 vacc4567 = vacc0123;
+          if XNN_LIKELY(nnz != 0) {
+            do {
+              const intptr_t diff = *dmap++;
+              const __m128 va0123 = _mm_loadu_ps(a);
+              const __m128 va4567 = _mm_loadu_ps(a + 4);
+              a = (const float*restrict) ((uintptr_t) a + (uintptr_t) diff);
+              const __m128 vb = _mm_load1_ps(w); w += 1;
+              vacc0123 = _mm_add_ps(vacc0123, _mm_mul_ps(va0123, vb));
+              vacc4567 = _mm_add_ps(vacc4567, _mm_mul_ps(va4567, vb));
+            } while (--nnz != 0);
+          }
+          __m128 vout0123 = _mm_min_ps(vacc0123, vmax);
+          __m128 vout4567 = _mm_min_ps(vacc4567, vmax);
+          vout0123 = _mm_max_ps(vout0123, vmin);
+          vout4567 = _mm_max_ps(vout4567, vmin);
+          _mm_storeu_ps(c + 0, vout0123);
+          _mm_storeu_ps(c + 4, vout4567);
+          c += m;
+          j -= 1;
+        } while (j != 0);
+      }
+      c -= m * n;
+      c += 8;
+      a += 8;
+    }
+    if (i & 4) {
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t j = n;
+      while (j >= 2) {
+        uint32_t nnz = *nnzmap++;
+        __m128 vacc0123c0 = _mm_load1_ps(w); w += 1;
+        __m128 vacc0123c1 = _mm_load1_ps(w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m128 va0123 = _mm_loadu_ps(a);
+            a = (const float*restrict) ((uintptr_t) a + (uintptr_t) diff);
+            const __m128 vb0 = _mm_load1_ps(w + 0);
+            const __m128 vb1 = _mm_load1_ps(w + 1);
+            w += 2;
+
+            vacc0123c0 = _mm_add_ps(vacc0123c0, _mm_mul_ps(va0123, vb0));
+            vacc0123c1 = _mm_add_ps(vacc0123c1, _mm_mul_ps(va0123, vb1));
+          } while (--nnz != 0);
+        }
+        __m128 vout0123c0 = _mm_min_ps(vacc0123c0, vmax);
+        vout0123c0 = _mm_max_ps(vout0123c0, vmin);
+        _mm_storeu_ps(c + 0 * m + 0, vout0123c0);
+        __m128 vout0123c1 = _mm_min_ps(vacc0123c1, vmax);
+        vout0123c1 = _mm_max_ps(vout0123c1, vmin);
+        _mm_storeu_ps(c + 1 * m + 0, vout0123c1);
+        c += 2 * m;
+        j -= 2;
+      }
+
+      // clean up loop, fall back to nr=1
+      if XNN_UNLIKELY(j != 0) {
+        do {
+          uint32_t nnz = *nnzmap++;
+          __m128 vacc0123 = _mm_load1_ps(w); w += 1;
+          if XNN_LIKELY(nnz != 0) {
+            do {
+              const intptr_t diff = *dmap++;
+              const __m128 va0123 = _mm_loadu_ps(a);
+              a = (const float*restrict) ((uintptr_t) a + (uintptr_t) diff);
+              const __m128 vb = _mm_load1_ps(w); w += 1;
+              vacc0123 = _mm_add_ps(vacc0123, _mm_mul_ps(va0123, vb));
+            } while (--nnz != 0);
+          }
+          __m128 vout0123 = _mm_min_ps(vacc0123, vmax);
+          vout0123 = _mm_max_ps(vout0123, vmin);
+          _mm_storeu_ps(c + 0, vout0123);
+          c += m;
+          j -= 1;
+        } while (j != 0);
+      }
+      c -= m * n;
+      c += 4;
+      a += 4;
+    }
+    if (i & 2) {
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t j = n;
+      while (j >= 2) {
+        uint32_t nnz = *nnzmap++;
+        __m128 vacc01c0 = _mm_load_ss(w); w += 1;
+        vacc01c0 = _mm_unpacklo_ps(vacc01c0, vacc01c0);
+        __m128 vacc01c1 = _mm_load_ss(w); w += 1;
+        vacc01c1 = _mm_unpacklo_ps(vacc01c1, vacc01c1);
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m128 va01 = _mm_loadl_pi(_mm_undefined_ps(), (const __m64*) a);
+            a = (const float*restrict) ((uintptr_t) a + (uintptr_t) diff);
+            const __m128 vb0 = _mm_load1_ps(w + 0);
+            const __m128 vb1 = _mm_load1_ps(w + 1);
+            w += 2;
+
+            vacc01c0 = _mm_add_ps(vacc01c0, _mm_mul_ps(va01, vb0));
+            vacc01c1 = _mm_add_ps(vacc01c1, _mm_mul_ps(va01, vb1));
+          } while (--nnz != 0);
+        }
+        __m128 vout01c0 = _mm_min_ps(vacc01c0, vmax);
+        vout01c0 = _mm_max_ps(vout01c0, vmin);
+        _mm_storel_pi((__m64*) (c + 0 * m), vout01c0);
+        __m128 vout01c1 = _mm_min_ps(vacc01c1, vmax);
+        vout01c1 = _mm_max_ps(vout01c1, vmin);
+        _mm_storel_pi((__m64*) (c + 1 * m), vout01c1);
+        c += 2 * m;
+        j -= 2;
+      }
+
+      // clean up loop, fall back to nr=1
+      if XNN_UNLIKELY(j != 0) {
+        do {
+          uint32_t nnz = *nnzmap++;
+          __m128 vacc01 = _mm_load_ss(w); w += 1;
+          vacc01 = _mm_unpacklo_ps(vacc01, vacc01);
+          if XNN_LIKELY(nnz != 0) {
+            do {
+              const intptr_t diff = *dmap++;
+              const __m128 va01 = _mm_loadl_pi(_mm_undefined_ps(), (const __m64*) a);
+              a = (const float*restrict) ((uintptr_t) a + (uintptr_t) diff);
+              const __m128 vb = _mm_load1_ps(w); w += 1;
+              vacc01 = _mm_add_ps(vacc01, _mm_mul_ps(va01, vb));
+            } while (--nnz != 0);
+          }
+          __m128 vout01 = _mm_min_ps(vacc01, vmax);
+          vout01 = _mm_max_ps(vout01, vmin);
+          _mm_storel_pi((__m64*) c, vout01);
+          c += m;
+          j -= 1;
+        } while (j != 0);
+      }
+      c -= m * n;
+      c += 2;
+      a += 2;
+    }
+    if (i & 1) {
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t j = n;
+      while (j >= 2) {
+        uint32_t nnz = *nnzmap++;
+        __m128 vacc0c0 = _mm_load_ss(w); w += 1;
+        __m128 vacc0c1 = _mm_load_ss(w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m128 va0 = _mm_load_ss(a);
+            a = (const float*restrict) ((uintptr_t) a + (uintptr_t) diff);
+            const __m128 vb0 = _mm_load_ss(w + 0);
+            const __m128 vb1 = _mm_load_ss(w + 1);
+            w += 2;
+
+            vacc0c0 = _mm_add_ss(vacc0c0, _mm_mul_ss(va0, vb0));
+            vacc0c1 = _mm_add_ss(vacc0c1, _mm_mul_ss(va0, vb1));
+          } while (--nnz != 0);
+        }
+        __m128 vout0c0 = _mm_min_ss(vacc0c0, vmax);
+        vout0c0 = _mm_max_ss(vout0c0, vmin);
+        _mm_store_ss(c + 0 * m, vout0c0);
+        __m128 vout0c1 = _mm_min_ss(vacc0c1, vmax);
+        vout0c1 = _mm_max_ss(vout0c1, vmin);
+        _mm_store_ss(c + 1 * m, vout0c1);
+        c += 2 * m;
+        j -= 2;
+      }
+
+      // clean up loop, fall back to nr=1
+      if XNN_UNLIKELY(j != 0) {
+        do {
+          uint32_t nnz = *nnzmap++;
+          __m128 vacc0 = _mm_load_ss(w); w += 1;
+          if XNN_LIKELY(nnz != 0) {
+            do {
+              const intptr_t diff = *dmap++;
+              const __m128 va0 = _mm_load_ss(a);
+              a = (const float*restrict) ((uintptr_t) a + (uintptr_t) diff);
+              const __m128 vb = _mm_load_ss(w); w += 1;
+              vacc0 = _mm_add_ss(vacc0, _mm_mul_ss(va0, vb));
+            } while (--nnz != 0);
+          }
+          __m128 vout0 = _mm_min_ss(vacc0, vmax);
+          vout0 = _mm_max_ss(vout0, vmin);
+          _mm_store_ss(c, vout0);
+          c += m;
+          j -= 1;
+        } while (j != 0);
+      }
+      c -= m * n;
+      c += 1;
+      a += 1;
+    }
+  }
+}
@@ -0,0 +1,278 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-spmm/avx512f.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/spmm.h>
+
+
+void xnn_f32_spmm_ukernel_32x4__avx512f(
+    uint32_t m,
+    uint32_t n,
+    const float*restrict a,
+    const float*restrict weights,
+    const int32_t*restrict widx_dmap,
+    const uint32_t*restrict nidx_nnzmap,
+    float*restrict c,
+    const union xnn_f32_output_params params[restrict static 1])
+{
+  assert(m != 0);
+
+  const __m512 vmin = _mm512_broadcast_f32x4(_mm_load_ps(params->sse.min));
+  const __m512 vmax = _mm512_broadcast_f32x4(_mm_load_ps(params->sse.max));
+  size_t i = m;
+  while XNN_LIKELY(i >= 32) {
+    const float*restrict w = weights;
+    const int32_t* dmap = widx_dmap;
+    const uint32_t* nnzmap = nidx_nnzmap;
+    size_t j = n;
+    while (j >= 4) {
+      uint32_t nnz = *nnzmap++;
+      __m512 vacc0123456789ABCDEFc0 = _mm512_set1_ps(*w); w += 1;
+      __m512 vaccGHIJKLMNOPQRSTUVc0 = vacc0123456789ABCDEFc0;
+      __m512 vacc0123456789ABCDEFc1 = _mm512_set1_ps(*w); w += 1;
+      __m512 vaccGHIJKLMNOPQRSTUVc1 = vacc0123456789ABCDEFc1;
+      __m512 vacc0123456789ABCDEFc2 = _mm512_set1_ps(*w); w += 1;
+      __m512 vaccGHIJKLMNOPQRSTUVc2 = vacc0123456789ABCDEFc2;
+      __m512 vacc0123456789ABCDEFc3 = _mm512_set1_ps(*w); w += 1;
+      __m512 vaccGHIJKLMNOPQRSTUVc3 = vacc0123456789ABCDEFc3;
+      if XNN_LIKELY(nnz != 0) {
+        do {
+          const intptr_t diff = *dmap++;
+          const __m512 va0123456789ABCDEF = _mm512_loadu_ps(a);
+          const __m512 vaGHIJKLMNOPQRSTUV = _mm512_loadu_ps(a + 16);
+          a = (const float*restrict) ((uintptr_t) a + (uintptr_t) diff);
+          const __m512 vb0 = _mm512_set1_ps(w[0]);
+          const __m512 vb1 = _mm512_set1_ps(w[1]);
+          const __m512 vb2 = _mm512_set1_ps(w[2]);
+          const __m512 vb3 = _mm512_set1_ps(w[3]);
+          w += 4;
+
+          vacc0123456789ABCDEFc0 = _mm512_fmadd_ps(va0123456789ABCDEF, vb0, vacc0123456789ABCDEFc0);
+          vaccGHIJKLMNOPQRSTUVc0 = _mm512_fmadd_ps(vaGHIJKLMNOPQRSTUV, vb0, vaccGHIJKLMNOPQRSTUVc0);
+          vacc0123456789ABCDEFc1 = _mm512_fmadd_ps(va0123456789ABCDEF, vb1, vacc0123456789ABCDEFc1);
+          vaccGHIJKLMNOPQRSTUVc1 = _mm512_fmadd_ps(vaGHIJKLMNOPQRSTUV, vb1, vaccGHIJKLMNOPQRSTUVc1);
+          vacc0123456789ABCDEFc2 = _mm512_fmadd_ps(va0123456789ABCDEF, vb2, vacc0123456789ABCDEFc2);
+          vaccGHIJKLMNOPQRSTUVc2 = _mm512_fmadd_ps(vaGHIJKLMNOPQRSTUV, vb2, vaccGHIJKLMNOPQRSTUVc2);
+          vacc0123456789ABCDEFc3 = _mm512_fmadd_ps(va0123456789ABCDEF, vb3, vacc0123456789ABCDEFc3);
+          vaccGHIJKLMNOPQRSTUVc3 = _mm512_fmadd_ps(vaGHIJKLMNOPQRSTUV, vb3, vaccGHIJKLMNOPQRSTUVc3);
+        } while (--nnz != 0);
+      }
+      __m512 vout0123456789ABCDEFc0 = _mm512_min_ps(vacc0123456789ABCDEFc0, vmax);
+      __m512 voutGHIJKLMNOPQRSTUVc0 = _mm512_min_ps(vaccGHIJKLMNOPQRSTUVc0, vmax);
+      __m512 vout0123456789ABCDEFc1 = _mm512_min_ps(vacc0123456789ABCDEFc1, vmax);
+      __m512 voutGHIJKLMNOPQRSTUVc1 = _mm512_min_ps(vaccGHIJKLMNOPQRSTUVc1, vmax);
+      __m512 vout0123456789ABCDEFc2 = _mm512_min_ps(vacc0123456789ABCDEFc2, vmax);
+      __m512 voutGHIJKLMNOPQRSTUVc2 = _mm512_min_ps(vaccGHIJKLMNOPQRSTUVc2, vmax);
+      __m512 vout0123456789ABCDEFc3 = _mm512_min_ps(vacc0123456789ABCDEFc3, vmax);
+      __m512 voutGHIJKLMNOPQRSTUVc3 = _mm512_min_ps(vaccGHIJKLMNOPQRSTUVc3, vmax);
+
+      vout0123456789ABCDEFc0 = _mm512_max_ps(vout0123456789ABCDEFc0, vmin);
+      voutGHIJKLMNOPQRSTUVc0 = _mm512_max_ps(voutGHIJKLMNOPQRSTUVc0, vmin);
+      vout0123456789ABCDEFc1 = _mm512_max_ps(vout0123456789ABCDEFc1, vmin);
+      voutGHIJKLMNOPQRSTUVc1 = _mm512_max_ps(voutGHIJKLMNOPQRSTUVc1, vmin);
+      vout0123456789ABCDEFc2 = _mm512_max_ps(vout0123456789ABCDEFc2, vmin);
+      voutGHIJKLMNOPQRSTUVc2 = _mm512_max_ps(voutGHIJKLMNOPQRSTUVc2, vmin);
+      vout0123456789ABCDEFc3 = _mm512_max_ps(vout0123456789ABCDEFc3, vmin);
+      voutGHIJKLMNOPQRSTUVc3 = _mm512_max_ps(voutGHIJKLMNOPQRSTUVc3, vmin);
+
+      _mm512_storeu_ps(c + 0 * m + 0, vout0123456789ABCDEFc0);
+      _mm512_storeu_ps(c + 0 * m + 16, voutGHIJKLMNOPQRSTUVc0);
+      _mm512_storeu_ps(c + 1 * m + 0, vout0123456789ABCDEFc1);
+      _mm512_storeu_ps(c + 1 * m + 16, voutGHIJKLMNOPQRSTUVc1);
+      _mm512_storeu_ps(c + 2 * m + 0, vout0123456789ABCDEFc2);
+      _mm512_storeu_ps(c + 2 * m + 16, voutGHIJKLMNOPQRSTUVc2);
+      _mm512_storeu_ps(c + 3 * m + 0, vout0123456789ABCDEFc3);
+      _mm512_storeu_ps(c + 3 * m + 16, voutGHIJKLMNOPQRSTUVc3);
+      c += 4 * m;
+      j -= 4;
+    }
+
+    // clean up loop, fall back to nr=1
+    if XNN_UNLIKELY(j != 0) {
+      do {
+        uint32_t nnz = *nnzmap++;
+        __m512 vacc0123456789ABCDEF = _mm512_set1_ps(*w); w += 1;
+        __m512 vaccGHIJKLMNOPQRSTUV = vacc0123456789ABCDEF;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m512 va0123456789ABCDEF = _mm512_loadu_ps(a);
+            const __m512 vaGHIJKLMNOPQRSTUV = _mm512_loadu_ps(a + 16);
+            a = (const float*restrict) ((uintptr_t) a + (uintptr_t) diff);
+            const __m512 vb = _mm512_set1_ps(*w); w += 1;
+            vacc0123456789ABCDEF = _mm512_fmadd_ps(va0123456789ABCDEF, vb, vacc0123456789ABCDEF);
+            vaccGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vaGHIJKLMNOPQRSTUV, vb, vaccGHIJKLMNOPQRSTUV);
+          } while (--nnz != 0);
+        }
+        __m512 vout0123456789ABCDEF = _mm512_min_ps(vacc0123456789ABCDEF, vmax);
+        __m512 voutGHIJKLMNOPQRSTUV = _mm512_min_ps(vaccGHIJKLMNOPQRSTUV, vmax);
+
+        vout0123456789ABCDEF = _mm512_max_ps(vout0123456789ABCDEF, vmin);
+        voutGHIJKLMNOPQRSTUV = _mm512_max_ps(voutGHIJKLMNOPQRSTUV, vmin);
+
+        _mm512_storeu_ps(c, vout0123456789ABCDEF);
+        _mm512_storeu_ps(c + 16, voutGHIJKLMNOPQRSTUV);
+        c += m;
+        j -= 1;
+      } while (j != 0);
+    }
+    c -= m * n;
+    c += 32;
+    a += 32;
+    i -= 32;
+  }
+  if (i & 16) {
+    const float*restrict w = weights;
+    const int32_t* dmap = widx_dmap;
+    const uint32_t* nnzmap = nidx_nnzmap;
+    size_t j = n;
+    while (j >= 4) {
+      uint32_t nnz = *nnzmap++;
+      __m512 vacc0123456789ABCDEFc0 = _mm512_set1_ps(*w); w += 1;
+      __m512 vacc0123456789ABCDEFc1 = _mm512_set1_ps(*w); w += 1;
+      __m512 vacc0123456789ABCDEFc2 = _mm512_set1_ps(*w); w += 1;
+      __m512 vacc0123456789ABCDEFc3 = _mm512_set1_ps(*w); w += 1;
+      if XNN_LIKELY(nnz != 0) {
+        do {
+          const intptr_t diff = *dmap++;
+          const __m512 va0123456789ABCDEF = _mm512_loadu_ps(a);
+          a = (const float*restrict) ((uintptr_t) a + (uintptr_t) diff);
+          const __m512 vb0 = _mm512_set1_ps(w[0]);
+          const __m512 vb1 = _mm512_set1_ps(w[1]);
+          const __m512 vb2 = _mm512_set1_ps(w[2]);
+          const __m512 vb3 = _mm512_set1_ps(w[3]);
+          w += 4;
+
+          vacc0123456789ABCDEFc0 = _mm512_fmadd_ps(va0123456789ABCDEF, vb0, vacc0123456789ABCDEFc0);
+          vacc0123456789ABCDEFc1 = _mm512_fmadd_ps(va0123456789ABCDEF, vb1, vacc0123456789ABCDEFc1);
+          vacc0123456789ABCDEFc2 = _mm512_fmadd_ps(va0123456789ABCDEF, vb2, vacc0123456789ABCDEFc2);
+          vacc0123456789ABCDEFc3 = _mm512_fmadd_ps(va0123456789ABCDEF, vb3, vacc0123456789ABCDEFc3);
+        } while (--nnz != 0);
+      }
+      __m512 vout0123456789ABCDEFc0 = _mm512_min_ps(vacc0123456789ABCDEFc0, vmax);
+      __m512 vout0123456789ABCDEFc1 = _mm512_min_ps(vacc0123456789ABCDEFc1, vmax);
+      __m512 vout0123456789ABCDEFc2 = _mm512_min_ps(vacc0123456789ABCDEFc2, vmax);
+      __m512 vout0123456789ABCDEFc3 = _mm512_min_ps(vacc0123456789ABCDEFc3, vmax);
+
+      vout0123456789ABCDEFc0 = _mm512_max_ps(vout0123456789ABCDEFc0, vmin);
+      vout0123456789ABCDEFc1 = _mm512_max_ps(vout0123456789ABCDEFc1, vmin);
+      vout0123456789ABCDEFc2 = _mm512_max_ps(vout0123456789ABCDEFc2, vmin);
+      vout0123456789ABCDEFc3 = _mm512_max_ps(vout0123456789ABCDEFc3, vmin);
+
+      _mm512_storeu_ps(c + 0 * m + 0, vout0123456789ABCDEFc0);
+      _mm512_storeu_ps(c + 1 * m + 0, vout0123456789ABCDEFc1);
+      _mm512_storeu_ps(c + 2 * m + 0, vout0123456789ABCDEFc2);
+      _mm512_storeu_ps(c + 3 * m + 0, vout0123456789ABCDEFc3);
+      c += 4 * m;
+      j -= 4;
+    }
+
+    // clean up loop, fall back to nr=1
+    if XNN_UNLIKELY(j != 0) {
+      do {
+        uint32_t nnz = *nnzmap++;
+        __m512 vacc0123456789ABCDEF = _mm512_set1_ps(*w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m512 va0123456789ABCDEF = _mm512_loadu_ps(a);
+            a = (const float*restrict) ((uintptr_t) a + (uintptr_t) diff);
+            const __m512 vb = _mm512_set1_ps(*w); w += 1;
+            vacc0123456789ABCDEF = _mm512_fmadd_ps(va0123456789ABCDEF, vb, vacc0123456789ABCDEF);
+          } while (--nnz != 0);
+        }
+        __m512 vout0123456789ABCDEF = _mm512_min_ps(vacc0123456789ABCDEF, vmax);
+
+        vout0123456789ABCDEF = _mm512_max_ps(vout0123456789ABCDEF, vmin);
+
+        _mm512_storeu_ps(c, vout0123456789ABCDEF);
+        c += m;
+        j -= 1;
+      } while (j != 0);
+    }
+    c -= m * n;
+    c += 16;
+    a += 16;
+  }
+  if XNN_UNLIKELY((i & 15) != 0) {
+    // Process the last (m % 16) rows with masked loads and stores.
+    const __mmask16 vmask = _cvtu32_mask16((UINT32_C(1) << (i & 15)) - UINT32_C(1));
+    const float*restrict w = weights;
+    const int32_t* dmap = widx_dmap;
+    const uint32_t* nnzmap = nidx_nnzmap;
+    size_t j = n;
+    while (j >= 4) {
+      uint32_t nnz = *nnzmap++;
+      __m512 vacc0123456789ABCDEFc0 = _mm512_set1_ps(*w); w += 1;
+      __m512 vacc0123456789ABCDEFc1 = _mm512_set1_ps(*w); w += 1;
+      __m512 vacc0123456789ABCDEFc2 = _mm512_set1_ps(*w); w += 1;
+      __m512 vacc0123456789ABCDEFc3 = _mm512_set1_ps(*w); w += 1;
+      if XNN_LIKELY(nnz != 0) {
+        do {
+          const intptr_t diff = *dmap++;
+          const __m512 va0123456789ABCDEF = _mm512_maskz_loadu_ps(vmask, a);
+          a = (const float*restrict) ((uintptr_t) a + (uintptr_t) diff);
+          const __m512 vb0 = _mm512_set1_ps(w[0]);
+          const __m512 vb1 = _mm512_set1_ps(w[1]);
+          const __m512 vb2 = _mm512_set1_ps(w[2]);
+          const __m512 vb3 = _mm512_set1_ps(w[3]);
+          w += 4;
+
+          vacc0123456789ABCDEFc0 = _mm512_fmadd_ps(va0123456789ABCDEF, vb0, vacc0123456789ABCDEFc0);
+          vacc0123456789ABCDEFc1 = _mm512_fmadd_ps(va0123456789ABCDEF, vb1, vacc0123456789ABCDEFc1);
+          vacc0123456789ABCDEFc2 = _mm512_fmadd_ps(va0123456789ABCDEF, vb2, vacc0123456789ABCDEFc2);
+          vacc0123456789ABCDEFc3 = _mm512_fmadd_ps(va0123456789ABCDEF, vb3, vacc0123456789ABCDEFc3);
+        } while (--nnz != 0);
+      }
+      __m512 vout0123456789ABCDEFc0 = _mm512_min_ps(vacc0123456789ABCDEFc0, vmax);
+      __m512 vout0123456789ABCDEFc1 = _mm512_min_ps(vacc0123456789ABCDEFc1, vmax);
+      __m512 vout0123456789ABCDEFc2 = _mm512_min_ps(vacc0123456789ABCDEFc2, vmax);
+      __m512 vout0123456789ABCDEFc3 = _mm512_min_ps(vacc0123456789ABCDEFc3, vmax);
+
+      vout0123456789ABCDEFc0 = _mm512_max_ps(vout0123456789ABCDEFc0, vmin);
+      vout0123456789ABCDEFc1 = _mm512_max_ps(vout0123456789ABCDEFc1, vmin);
+      vout0123456789ABCDEFc2 = _mm512_max_ps(vout0123456789ABCDEFc2, vmin);
+      vout0123456789ABCDEFc3 = _mm512_max_ps(vout0123456789ABCDEFc3, vmin);
+
+      _mm512_mask_storeu_ps(c + 0 * m + 0, vmask, vout0123456789ABCDEFc0);
+      _mm512_mask_storeu_ps(c + 1 * m + 0, vmask, vout0123456789ABCDEFc1);
+      _mm512_mask_storeu_ps(c + 2 * m + 0, vmask, vout0123456789ABCDEFc2);
+      _mm512_mask_storeu_ps(c + 3 * m + 0, vmask, vout0123456789ABCDEFc3);
+      c += 4 * m;
+      j -= 4;
+    }
+
+    // clean up loop, fall back to nr=1
+    if XNN_UNLIKELY(j != 0) {
+      do {
+        uint32_t nnz = *nnzmap++;
+        __m512 vacc0123456789ABCDEF = _mm512_set1_ps(*w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m512 va0123456789ABCDEF = _mm512_maskz_loadu_ps(vmask, a);
+            a = (const float*restrict) ((uintptr_t) a + (uintptr_t) diff);
+            const __m512 vb = _mm512_set1_ps(*w); w += 1;
+            vacc0123456789ABCDEF = _mm512_fmadd_ps(va0123456789ABCDEF, vb, vacc0123456789ABCDEF);
+          } while (--nnz != 0);
+        }
+        __m512 vout0123456789ABCDEF = _mm512_min_ps(vacc0123456789ABCDEF, vmax);
+
+        vout0123456789ABCDEF = _mm512_max_ps(vout0123456789ABCDEF, vmin);
+
+        _mm512_mask_storeu_ps(c, vmask, vout0123456789ABCDEF);
+        c += m;
+        j -= 1;
+      } while (j != 0);
+    }
+  }
+}
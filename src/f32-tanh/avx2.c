@@ -0,0 +1,144 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vunary.h>
+
+
+static const int32_t mask_table[14] = {-1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0};
+
+void xnn_f32_tanh_ukernel__avx2_x16(
+    size_t n,
+    const float* x,
+    float* y,
+    const void* params)
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+
+  // Inputs outside of [-sat_cutoff, sat_cutoff] saturate tanh(x) to +-1.0 in single precision.
+  const __m256 vsat_cutoff = _mm256_set1_ps(0x1.F9F09Ep+2f);
+  const __m256 vminus_sat_cutoff = _mm256_set1_ps(-0x1.F9F09Ep+2f);
+
+  // Coefficients of the rational approximation tanh(z) ~ p(z) / q(z) on [-sat_cutoff, sat_cutoff].
+  const __m256 valpha1 = _mm256_set1_ps(4.89352455891786e-03f);
+  const __m256 valpha3 = _mm256_set1_ps(6.37261928875436e-04f);
+  const __m256 valpha5 = _mm256_set1_ps(1.48572235717979e-05f);
+  const __m256 valpha7 = _mm256_set1_ps(5.12229709037114e-08f);
+  const __m256 valpha9 = _mm256_set1_ps(-8.60467152213735e-11f);
+  const __m256 valpha11 = _mm256_set1_ps(2.00018790482477e-13f);
+  const __m256 valpha13 = _mm256_set1_ps(-2.76076847742355e-16f);
+  const __m256 vbeta0 = _mm256_set1_ps(4.89352518554385e-03f);
+  const __m256 vbeta2 = _mm256_set1_ps(2.26843463243900e-03f);
+  const __m256 vbeta4 = _mm256_set1_ps(1.18534705686654e-04f);
+  const __m256 vbeta6 = _mm256_set1_ps(1.19825839466702e-06f);
+
+  for (; n >= 16 * sizeof(float); n -= 16 * sizeof(float)) {
+    const __m256 vx0 = _mm256_loadu_ps(x);
+    const __m256 vx1 = _mm256_loadu_ps(x + 8);
+    x += 16;
+
+    // Clamp the input to [-sat_cutoff, sat_cutoff] range, where the rational approximation is valid.
+    __m256 vz0 = _mm256_max_ps(vx0, vminus_sat_cutoff);
+    __m256 vz1 = _mm256_max_ps(vx1, vminus_sat_cutoff);
+
+    vz0 = _mm256_min_ps(vz0, vsat_cutoff);
+    vz1 = _mm256_min_ps(vz1, vsat_cutoff);
+
+    // Compute z^2.
+    const __m256 vz20 = _mm256_mul_ps(vz0, vz0);
+    const __m256 vz21 = _mm256_mul_ps(vz1, vz1);
+
+    // Evaluate the numerator polynomial p(z) = z * (alpha1 + z^2 * (alpha3 + ... + z^2 * alpha13)).
+    __m256 vp0 = _mm256_fmadd_ps(vz20, valpha13, valpha11);
+    __m256 vp1 = _mm256_fmadd_ps(vz21, valpha13, valpha11);
+
+    vp0 = _mm256_fmadd_ps(vz20, vp0, valpha9);
+    vp1 = _mm256_fmadd_ps(vz21, vp1, valpha9);
+
+    vp0 = _mm256_fmadd_ps(vz20, vp0, valpha7);
+    vp1 = _mm256_fmadd_ps(vz21, vp1, valpha7);
+
+    vp0 = _mm256_fmadd_ps(vz20, vp0, valpha5);
+    vp1 = _mm256_fmadd_ps(vz21, vp1, valpha5);
+
+    vp0 = _mm256_fmadd_ps(vz20, vp0, valpha3);
+    vp1 = _mm256_fmadd_ps(vz21, vp1, valpha3);
+
+    vp0 = _mm256_fmadd_ps(vz20, vp0, valpha1);
+    vp1 = _mm256_fmadd_ps(vz21, vp1, valpha1);
+
+    vp0 = _mm256_mul_ps(vp0, vz0);
+    vp1 = _mm256_mul_ps(vp1, vz1);
+
+    // Evaluate the denominator polynomial q(z) = beta0 + z^2 * (beta2 + z^2 * (beta4 + z^2 * beta6)).
+    __m256 vq0 = _mm256_fmadd_ps(vz20, vbeta6, vbeta4);
+    __m256 vq1 = _mm256_fmadd_ps(vz21, vbeta6, vbeta4);
+
+    vq0 = _mm256_fmadd_ps(vz20, vq0, vbeta2);
+    vq1 = _mm256_fmadd_ps(vz21, vq1, vbeta2);
+
+    vq0 = _mm256_fmadd_ps(vz20, vq0, vbeta0);
+    vq1 = _mm256_fmadd_ps(vz21, vq1, vbeta0);
+
+    // Reconstruct tanh(x) = p(z) / q(z)
+    __m256 vy0 = _mm256_div_ps(vp0, vq0);
+    __m256 vy1 = _mm256_div_ps(vp1, vq1);
+
+    _mm256_storeu_ps(y, vy0);
+    _mm256_storeu_ps(y + 8, vy1);
+    y += 16;
+  }
+  for (; n >= 8 * sizeof(float); n -= 8 * sizeof(float)) {
+    const __m256 vx = _mm256_loadu_ps(x);
+    x += 8;
+
+    __m256 vz = _mm256_max_ps(vx, vminus_sat_cutoff);
+    vz = _mm256_min_ps(vz, vsat_cutoff);
+    const __m256 vz2 = _mm256_mul_ps(vz, vz);
+    __m256 vp = _mm256_fmadd_ps(vz2, valpha13, valpha11);
+    vp = _mm256_fmadd_ps(vz2, vp, valpha9);
+    vp = _mm256_fmadd_ps(vz2, vp, valpha7);
+    vp = _mm256_fmadd_ps(vz2, vp, valpha5);
+    vp = _mm256_fmadd_ps(vz2, vp, valpha3);
+    vp = _mm256_fmadd_ps(vz2, vp, valpha1);
+    vp = _mm256_mul_ps(vp, vz);
+    __m256 vq = _mm256_fmadd_ps(vz2, vbeta6, vbeta4);
+    vq = _mm256_fmadd_ps(vz2, vq, vbeta2);
+    vq = _mm256_fmadd_ps(vz2, vq, vbeta0);
+    __m256 vy = _mm256_div_ps(vp, vq);
+
+    _mm256_storeu_ps(y, vy);
+    y += 8;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    assert(n >= 1 * sizeof(float));
+    assert(n <= 7 * sizeof(float));
+    const __m256i vmask = _mm256_loadu_si256((const __m256i*) ((uintptr_t) &mask_table[7] - n));
+
+    const __m256 vx = _mm256_maskload_ps(x, vmask);
+
+    __m256 vz = _mm256_max_ps(vx, vminus_sat_cutoff);
+    vz = _mm256_min_ps(vz, vsat_cutoff);
+    const __m256 vz2 = _mm256_mul_ps(vz, vz);
+    __m256 vp = _mm256_fmadd_ps(vz2, valpha13, valpha11);
+    vp = _mm256_fmadd_ps(vz2, vp, valpha9);
+    vp = _mm256_fmadd_ps(vz2, vp, valpha7);
+    vp = _mm256_fmadd_ps(vz2, vp, valpha5);
+    vp = _mm256_fmadd_ps(vz2, vp, valpha3);
+    vp = _mm256_fmadd_ps(vz2, vp, valpha1);
+    vp = _mm256_mul_ps(vp, vz);
+    __m256 vq = _mm256_fmadd_ps(vz2, vbeta6, vbeta4);
+    vq = _mm256_fmadd_ps(vz2, vq, vbeta2);
+    vq = _mm256_fmadd_ps(vz2, vq, vbeta0);
+    __m256 vy = _mm256_div_ps(vp, vq);
+
+    _mm256_maskstore_ps(y, vmask, vy);
+  }
+}
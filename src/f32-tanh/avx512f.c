@@ -0,0 +1,144 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_f32_tanh_ukernel__avx512f_x32(
+    size_t n,
+    const float* x,
+    float* y,
+    const void* params)
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+
+  // Inputs outside of [-sat_cutoff, sat_cutoff] saturate tanh(x) to +-1.0 in single precision.
+  const __m512 vsat_cutoff = _mm512_set1_ps(0x1.F9F09Ep+2f);
+  const __m512 vminus_sat_cutoff = _mm512_set1_ps(-0x1.F9F09Ep+2f);
+
+  // Coefficients of the rational approximation tanh(z) ~ p(z) / q(z) on [-sat_cutoff, sat_cutoff].
+  const __m512 valpha1 = _mm512_set1_ps(4.89352455891786e-03f);
+  const __m512 valpha3 = _mm512_set1_ps(6.37261928875436e-04f);
+  const __m512 valpha5 = _mm512_set1_ps(1.48572235717979e-05f);
+  const __m512 valpha7 = _mm512_set1_ps(5.12229709037114e-08f);
+  const __m512 valpha9 = _mm512_set1_ps(-8.60467152213735e-11f);
+  const __m512 valpha11 = _mm512_set1_ps(2.00018790482477e-13f);
+  const __m512 valpha13 = _mm512_set1_ps(-2.76076847742355e-16f);
+  const __m512 vbeta0 = _mm512_set1_ps(4.89352518554385e-03f);
+  const __m512 vbeta2 = _mm512_set1_ps(2.26843463243900e-03f);
+  const __m512 vbeta4 = _mm512_set1_ps(1.18534705686654e-04f);
+  const __m512 vbeta6 = _mm512_set1_ps(1.19825839466702e-06f);
+
+  for (; n >= 32 * sizeof(float); n -= 32 * sizeof(float)) {
+    const __m512 vx0 = _mm512_loadu_ps(x);
+    const __m512 vx1 = _mm512_loadu_ps(x + 16);
+    x += 32;
+
+    // Clamp the input to [-sat_cutoff, sat_cutoff] range, where the rational approximation is valid.
+    __m512 vz0 = _mm512_max_ps(vx0, vminus_sat_cutoff);
+    __m512 vz1 = _mm512_max_ps(vx1, vminus_sat_cutoff);
+
+    vz0 = _mm512_min_ps(vz0, vsat_cutoff);
+    vz1 = _mm512_min_ps(vz1, vsat_cutoff);
+
+    // Compute z^2.
+    const __m512 vz20 = _mm512_mul_ps(vz0, vz0);
+    const __m512 vz21 = _mm512_mul_ps(vz1, vz1);
+
+    // Evaluate the numerator polynomial p(z) = z * (alpha1 + z^2 * (alpha3 + ... + z^2 * alpha13)).
+    __m512 vp0 = _mm512_fmadd_ps(vz20, valpha13, valpha11);
+    __m512 vp1 = _mm512_fmadd_ps(vz21, valpha13, valpha11);
+
+    vp0 = _mm512_fmadd_ps(vz20, vp0, valpha9);
+    vp1 = _mm512_fmadd_ps(vz21, vp1, valpha9);
+
+    vp0 = _mm512_fmadd_ps(vz20, vp0, valpha7);
+    vp1 = _mm512_fmadd_ps(vz21, vp1, valpha7);
+
+    vp0 = _mm512_fmadd_ps(vz20, vp0, valpha5);
+    vp1 = _mm512_fmadd_ps(vz21, vp1, valpha5);
+
+    vp0 = _mm512_fmadd_ps(vz20, vp0, valpha3);
+    vp1 = _mm512_fmadd_ps(vz21, vp1, valpha3);
+
+    vp0 = _mm512_fmadd_ps(vz20, vp0, valpha1);
+    vp1 = _mm512_fmadd_ps(vz21, vp1, valpha1);
+
+    vp0 = _mm512_mul_ps(vp0, vz0);
+    vp1 = _mm512_mul_ps(vp1, vz1);
+
+    // Evaluate the denominator polynomial q(z) = beta0 + z^2 * (beta2 + z^2 * (beta4 + z^2 * beta6)).
+    __m512 vq0 = _mm512_fmadd_ps(vz20, vbeta6, vbeta4);
+    __m512 vq1 = _mm512_fmadd_ps(vz21, vbeta6, vbeta4);
+
+    vq0 = _mm512_fmadd_ps(vz20, vq0, vbeta2);
+    vq1 = _mm512_fmadd_ps(vz21, vq1, vbeta2);
+
+    vq0 = _mm512_fmadd_ps(vz20, vq0, vbeta0);
+    vq1 = _mm512_fmadd_ps(vz21, vq1, vbeta0);
+
+    // Reconstruct tanh(x) = p(z) / q(z)
+    __m512 vy0 = _mm512_div_ps(vp0, vq0);
+    __m512 vy1 = _mm512_div_ps(vp1, vq1);
+
+    _mm512_storeu_ps(y, vy0);
+    _mm512_storeu_ps(y + 16, vy1);
+    y += 32;
+  }
+  for (; n >= 16 * sizeof(float); n -= 16 * sizeof(float)) {
+    const __m512 vx = _mm512_loadu_ps(x);
+    x += 16;
+
+    __m512 vz = _mm512_max_ps(vx, vminus_sat_cutoff);
+    vz = _mm512_min_ps(vz, vsat_cutoff);
+    const __m512 vz2 = _mm512_mul_ps(vz, vz);
+    __m512 vp = _mm512_fmadd_ps(vz2, valpha13, valpha11);
+    vp = _mm512_fmadd_ps(vz2, vp, valpha9);
+    vp = _mm512_fmadd_ps(vz2, vp, valpha7);
+    vp = _mm512_fmadd_ps(vz2, vp, valpha5);
+    vp = _mm512_fmadd_ps(vz2, vp, valpha3);
+    vp = _mm512_fmadd_ps(vz2, vp, valpha1);
+    vp = _mm512_mul_ps(vp, vz);
+    __m512 vq = _mm512_fmadd_ps(vz2, vbeta6, vbeta4);
+    vq = _mm512_fmadd_ps(vz2, vq, vbeta2);
+    vq = _mm512_fmadd_ps(vz2, vq, vbeta0);
+    __m512 vy = _mm512_div_ps(vp, vq);
+
+    _mm512_storeu_ps(y, vy);
+    y += 16;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    assert(n >= 1 * sizeof(float));
+    assert(n <= 15 * sizeof(float));
+    // Prepare mask for valid 32-bit elements (depends on n).
+    n >>= 2 /* log2(sizeof(float)) */;
+    const __mmask16 vmask = _cvtu32_mask16((uint16_t) ((uint32_t) (UINT32_C(1) << n) - UINT32_C(1)));
+
+    const __m512 vx = _mm512_maskz_loadu_ps(vmask, x);
+
+    __m512 vz = _mm512_max_ps(vx, vminus_sat_cutoff);
+    vz = _mm512_min_ps(vz, vsat_cutoff);
+    const __m512 vz2 = _mm512_mul_ps(vz, vz);
+    __m512 vp = _mm512_fmadd_ps(vz2, valpha13, valpha11);
+    vp = _mm512_fmadd_ps(vz2, vp, valpha9);
+    vp = _mm512_fmadd_ps(vz2, vp, valpha7);
+    vp = _mm512_fmadd_ps(vz2, vp, valpha5);
+    vp = _mm512_fmadd_ps(vz2, vp, valpha3);
+    vp = _mm512_fmadd_ps(vz2, vp, valpha1);
+    vp = _mm512_mul_ps(vp, vz);
+    __m512 vq = _mm512_fmadd_ps(vz2, vbeta6, vbeta4);
+    vq = _mm512_fmadd_ps(vz2, vq, vbeta2);
+    vq = _mm512_fmadd_ps(vz2, vq, vbeta0);
+    __m512 vy = _mm512_div_ps(vp, vq);
+
+    _mm512_mask_storeu_ps(y, vmask, vy);
+  }
+}
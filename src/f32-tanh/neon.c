@@ -0,0 +1,156 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_f32_tanh_ukernel__neon_x8(
+    size_t n,
+    const float* x,
+    float* y,
+    const void* params)
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+
+  // Inputs outside of [-sat_cutoff, sat_cutoff] saturate tanh(x) to +-1.0 in single precision.
+  const float32x4_t vsat_cutoff = vmovq_n_f32(0x1.F9F09Ep+2f);
+  const float32x4_t vminus_sat_cutoff = vmovq_n_f32(-0x1.F9F09Ep+2f);
+
+  // Coefficients of the rational approximation tanh(z) ~ p(z) / q(z) on [-sat_cutoff, sat_cutoff].
+  const float32x4_t valpha1 = vmovq_n_f32(4.89352455891786e-03f);
+  const float32x4_t valpha3 = vmovq_n_f32(6.37261928875436e-04f);
+  const float32x4_t valpha5 = vmovq_n_f32(1.48572235717979e-05f);
+  const float32x4_t valpha7 = vmovq_n_f32(5.12229709037114e-08f);
+  const float32x4_t valpha9 = vmovq_n_f32(-8.60467152213735e-11f);
+  const float32x4_t valpha11 = vmovq_n_f32(2.00018790482477e-13f);
+  const float32x4_t valpha13 = vmovq_n_f32(-2.76076847742355e-16f);
+  const float32x4_t vbeta0 = vmovq_n_f32(4.89352518554385e-03f);
+  const float32x4_t vbeta2 = vmovq_n_f32(2.26843463243900e-03f);
+  const float32x4_t vbeta4 = vmovq_n_f32(1.18534705686654e-04f);
+  const float32x4_t vbeta6 = vmovq_n_f32(1.19825839466702e-06f);
+
+  for (; n >= 8 * sizeof(float); n -= 8 * sizeof(float)) {
+    const float32x4_t vx0123 = vld1q_f32(x); x += 4;
+    const float32x4_t vx4567 = vld1q_f32(x); x += 4;
+
+    // Clamp the input to [-sat_cutoff, sat_cutoff] range, where the rational approximation is valid.
+    float32x4_t vz0123 = vmaxq_f32(vx0123, vminus_sat_cutoff);
+    float32x4_t vz4567 = vmaxq_f32(vx4567, vminus_sat_cutoff);
+
+    vz0123 = vminq_f32(vz0123, vsat_cutoff);
+    vz4567 = vminq_f32(vz4567, vsat_cutoff);
+
+    // Compute z^2.
+    const float32x4_t vz20123 = vmulq_f32(vz0123, vz0123);
+    const float32x4_t vz24567 = vmulq_f32(vz4567, vz4567);
+
+    // Evaluate the numerator polynomial p(z) = z * (alpha1 + z^2 * (alpha3 + ... + z^2 * alpha13)).
+    float32x4_t vp0123 = vmlaq_f32(valpha11, vz20123, valpha13);
+    float32x4_t vp4567 = vmlaq_f32(valpha11, vz24567, valpha13);
+
+    vp0123 = vmlaq_f32(valpha9, vz20123, vp0123);
+    vp4567 = vmlaq_f32(valpha9, vz24567, vp4567);
+
+    vp0123 = vmlaq_f32(valpha7, vz20123, vp0123);
+    vp4567 = vmlaq_f32(valpha7, vz24567, vp4567);
+
+    vp0123 = vmlaq_f32(valpha5, vz20123, vp0123);
+    vp4567 = vmlaq_f32(valpha5, vz24567, vp4567);
+
+    vp0123 = vmlaq_f32(valpha3, vz20123, vp0123);
+    vp4567 = vmlaq_f32(valpha3, vz24567, vp4567);
+
+    vp0123 = vmlaq_f32(valpha1, vz20123, vp0123);
+    vp4567 = vmlaq_f32(valpha1, vz24567, vp4567);
+
+    vp0123 = vmulq_f32(vp0123, vz0123);
+    vp4567 = vmulq_f32(vp4567, vz4567);
+
+    // Evaluate the denominator polynomial q(z) = beta0 + z^2 * (beta2 + z^2 * (beta4 + z^2 * beta6)).
+    float32x4_t vq0123 = vmlaq_f32(vbeta4, vz20123, vbeta6);
+    float32x4_t vq4567 = vmlaq_f32(vbeta4, vz24567, vbeta6);
+
+    vq0123 = vmlaq_f32(vbeta2, vz20123, vq0123);
+    vq4567 = vmlaq_f32(vbeta2, vz24567, vq4567);
+
+    vq0123 = vmlaq_f32(vbeta0, vz20123, vq0123);
+    vq4567 = vmlaq_f32(vbeta0, vz24567, vq4567);
+
+    // Use Newton-Raphson method (2 iterations) to compute reciprocal of the denominator.
+    // Note: beta0 <= q(z), so the reciprocal never overflows.
+    float32x4_t vr0123 = vrecpeq_f32(vq0123);
+    float32x4_t vr4567 = vrecpeq_f32(vq4567);
+    vr0123 = vmulq_f32(vr0123, vrecpsq_f32(vr0123, vq0123));
+    vr4567 = vmulq_f32(vr4567, vrecpsq_f32(vr4567, vq4567));
+    vr0123 = vmulq_f32(vr0123, vrecpsq_f32(vr0123, vq0123));
+    vr4567 = vmulq_f32(vr4567, vrecpsq_f32(vr4567, vq4567));
+
+    // Reconstruct tanh(x) = p(z) / q(z)
+    float32x4_t vy0123 = vmulq_f32(vp0123, vr0123);
+    float32x4_t vy4567 = vmulq_f32(vp4567, vr4567);
+
+    vst1q_f32(y, vy0123); y += 4;
+    vst1q_f32(y, vy4567); y += 4;
+  }
+  for (; n >= 4 * sizeof(float); n -= 4 * sizeof(float)) {
+    const float32x4_t vx = vld1q_f32(x); x += 4;
+
+    float32x4_t vz = vmaxq_f32(vx, vminus_sat_cutoff);
+    vz = vminq_f32(vz, vsat_cutoff);
+    const float32x4_t vz2 = vmulq_f32(vz, vz);
+    float32x4_t vp = vmlaq_f32(valpha11, vz2, valpha13);
+    vp = vmlaq_f32(valpha9, vz2, vp);
+    vp = vmlaq_f32(valpha7, vz2, vp);
+    vp = vmlaq_f32(valpha5, vz2, vp);
+    vp = vmlaq_f32(valpha3, vz2, vp);
+    vp = vmlaq_f32(valpha1, vz2, vp);
+    vp = vmulq_f32(vp, vz);
+    float32x4_t vq = vmlaq_f32(vbeta4, vz2, vbeta6);
+    vq = vmlaq_f32(vbeta2, vz2, vq);
+    vq = vmlaq_f32(vbeta0, vz2, vq);
+    float32x4_t vr = vrecpeq_f32(vq);
+    vr = vmulq_f32(vr, vrecpsq_f32(vr, vq));
+    vr = vmulq_f32(vr, vrecpsq_f32(vr, vq));
+    float32x4_t vy = vmulq_f32(vp, vr);
+
+    vst1q_f32(y, vy); y += 4;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    const float32x4_t vx = vld1q_f32(x);
+
+    float32x4_t vz = vmaxq_f32(vx, vminus_sat_cutoff);
+    vz = vminq_f32(vz, vsat_cutoff);
+    const float32x4_t vz2 = vmulq_f32(vz, vz);
+    float32x4_t vp = vmlaq_f32(valpha11, vz2, valpha13);
+    vp = vmlaq_f32(valpha9, vz2, vp);
+    vp = vmlaq_f32(valpha7, vz2, vp);
+    vp = vmlaq_f32(valpha5, vz2, vp);
+    vp = vmlaq_f32(valpha3, vz2, vp);
+    vp = vmlaq_f32(valpha1, vz2, vp);
+    vp = vmulq_f32(vp, vz);
+    float32x4_t vq = vmlaq_f32(vbeta4, vz2, vbeta6);
+    vq = vmlaq_f32(vbeta2, vz2, vq);
+    vq = vmlaq_f32(vbeta0, vz2, vq);
+    float32x4_t vr = vrecpeq_f32(vq);
+    vr = vmulq_f32(vr, vrecpsq_f32(vr, vq));
+    vr = vmulq_f32(vr, vrecpsq_f32(vr, vq));
+    float32x4_t vy = vmulq_f32(vp, vr);
+
+    float32x2_t vy_lo = vget_low_f32(vy);
+    if (n & (2 * sizeof(float))) {
+      vst1_f32(y, vy_lo); y += 2;
+      vy_lo = vget_high_f32(vy);
+    }
+    if (n & (1 * sizeof(float))) {
+      vst1_lane_f32(y, vy_lo, 0);
+    }
+  }
+}
@@ -0,0 +1,112 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/math.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_f32_tanh_ukernel__scalar_x2(
+    size_t n,
+    const float* x,
+    float* y,
+    const void* params)
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+
+  // Inputs outside of [-sat_cutoff, sat_cutoff] saturate tanh(x) to +-1.0 in single precision.
+  const float vsat_cutoff = 0x1.F9F09Ep+2f;
+  const float vminus_sat_cutoff = -0x1.F9F09Ep+2f;
+
+  // Coefficients of the rational approximation tanh(z) ~ p(z) / q(z) on [-sat_cutoff, sat_cutoff].
+  const float valpha1 = 4.89352455891786e-03f;
+  const float valpha3 = 6.37261928875436e-04f;
+  const float valpha5 = 1.48572235717979e-05f;
+  const float valpha7 = 5.12229709037114e-08f;
+  const float valpha9 = -8.60467152213735e-11f;
+  const float valpha11 = 2.00018790482477e-13f;
+  const float valpha13 = -2.76076847742355e-16f;
+  const float vbeta0 = 4.89352518554385e-03f;
+  const float vbeta2 = 2.26843463243900e-03f;
+  const float vbeta4 = 1.18534705686654e-04f;
+  const float vbeta6 = 1.19825839466702e-06f;
+
+  for (; n >= 2 * sizeof(float); n -= 2 * sizeof(float)) {
+    const float vx0 = x[0];
+    const float vx1 = x[1];
+    x += 2;
+
+    // Clamp the input to [-sat_cutoff, sat_cutoff] range, where the rational approximation is valid.
+    const float vz0 = math_min_f32(math_max_f32(vx0, vminus_sat_cutoff), vsat_cutoff);
+    const float vz1 = math_min_f32(math_max_f32(vx1, vminus_sat_cutoff), vsat_cutoff);
+
+    // Compute z^2.
+    const float vz20 = vz0 * vz0;
+    const float vz21 = vz1 * vz1;
+
+    // Evaluate the numerator polynomial p(z) = z * (alpha1 + z^2 * (alpha3 + ... + z^2 * alpha13)).
+    float vp0 = vz20 * valpha13 + valpha11;
+    float vp1 = vz21 * valpha13 + valpha11;
+
+    vp0 = vz20 * vp0 + valpha9;
+    vp1 = vz21 * vp1 + valpha9;
+
+    vp0 = vz20 * vp0 + valpha7;
+    vp1 = vz21 * vp1 + valpha7;
+
+    vp0 = vz20 * vp0 + valpha5;
+    vp1 = vz21 * vp1 + valpha5;
+
+    vp0 = vz20 * vp0 + valpha3;
+    vp1 = vz21 * vp1 + valpha3;
+
+    vp0 = vz20 * vp0 + valpha1;
+    vp1 = vz21 * vp1 + valpha1;
+
+    vp0 *= vz0;
+    vp1 *= vz1;
+
+    // Evaluate the denominator polynomial q(z) = beta0 + z^2 * (beta2 + z^2 * (beta4 + z^2 * beta6)).
+    float vq0 = vz20 * vbeta6 + vbeta4;
+    float vq1 = vz21 * vbeta6 + vbeta4;
+
+    vq0 = vz20 * vq0 + vbeta2;
+    vq1 = vz21 * vq1 + vbeta2;
+
+    vq0 = vz20 * vq0 + vbeta0;
+    vq1 = vz21 * vq1 + vbeta0;
+
+    // Reconstruct tanh(x) = p(z) / q(z)
+    const float vy0 = vp0 / vq0;
+    const float vy1 = vp1 / vq1;
+
+    y[0] = vy0;
+    y[1] = vy1;
+    y += 2;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    const float vx = *x;
+
+    const float vz = math_min_f32(math_max_f32(vx, vminus_sat_cutoff), vsat_cutoff);
+    const float vz2 = vz * vz;
+
+    float vp = vz2 * valpha13 + valpha11;
+    vp = vz2 * vp + valpha9;
+    vp = vz2 * vp + valpha7;
+    vp = vz2 * vp + valpha5;
+    vp = vz2 * vp + valpha3;
+    vp = vz2 * vp + valpha1;
+    vp *= vz;
+
+    float vq = vz2 * vbeta6 + vbeta4;
+    vq = vz2 * vq + vbeta2;
+    vq = vz2 * vq + vbeta0;
+
+    *y = vp / vq;
+  }
+}
@@ -0,0 +1,145 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <emmintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_f32_tanh_ukernel__sse2_x8(
+    size_t n,
+    const float* x,
+    float* y,
+    const void* params)
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+
+  // Inputs outside of [-sat_cutoff, sat_cutoff] saturate tanh(x) to +-1.0 in single precision.
+  const __m128 vsat_cutoff = _mm_set1_ps(0x1.F9F09Ep+2f);
+  const __m128 vminus_sat_cutoff = _mm_set1_ps(-0x1.F9F09Ep+2f);
+
+  // Coefficients of the rational approximation tanh(z) ~ p(z) / q(z) on [-sat_cutoff, sat_cutoff].
+  const __m128 valpha1 = _mm_set1_ps(4.89352455891786e-03f);
+  const __m128 valpha3 = _mm_set1_ps(6.37261928875436e-04f);
+  const __m128 valpha5 = _mm_set1_ps(1.48572235717979e-05f);
+  const __m128 valpha7 = _mm_set1_ps(5.12229709037114e-08f);
+  const __m128 valpha9 = _mm_set1_ps(-8.60467152213735e-11f);
+  const __m128 valpha11 = _mm_set1_ps(2.00018790482477e-13f);
+  const __m128 valpha13 = _mm_set1_ps(-2.76076847742355e-16f);
+  const __m128 vbeta0 = _mm_set1_ps(4.89352518554385e-03f);
+  const __m128 vbeta2 = _mm_set1_ps(2.26843463243900e-03f);
+  const __m128 vbeta4 = _mm_set1_ps(1.18534705686654e-04f);
+  const __m128 vbeta6 = _mm_set1_ps(1.19825839466702e-06f);
+
+  for (; n >= 8 * sizeof(float); n -= 8 * sizeof(float)) {
+    const __m128 vx0123 = _mm_loadu_ps(x);
+    const __m128 vx4567 = _mm_loadu_ps(x + 4);
+    x += 8;
+
+    // Clamp the input to [-sat_cutoff, sat_cutoff] range, where the rational approximation is valid.
+    __m128 vz0123 = _mm_max_ps(vx0123, vminus_sat_cutoff);
+    __m128 vz4567 = _mm_max_ps(vx4567, vminus_sat_cutoff);
+
+    vz0123 = _mm_min_ps(vz0123, vsat_cutoff);
+    vz4567 = _mm_min_ps(vz4567, vsat_cutoff);
+
+    // Compute z^2.
+    const __m128 vz20123 = _mm_mul_ps(vz0123, vz0123);
+    const __m128 vz24567 = _mm_mul_ps(vz4567, vz4567);
+
+    // Evaluate the numerator polynomial p(z) = z * (alpha1 + z^2 * (alpha3 + ... + z^2 * alpha13)).
+    __m128 vp0123 = _mm_add_ps(_mm_mul_ps(vz20123, valpha13), valpha11);
+    __m128 vp4567 = _mm_add_ps(_mm_mul_ps(vz24567, valpha13), valpha11);
+
+    vp0123 = _mm_add_ps(_mm_mul_ps(vz20123, vp0123), valpha9);
+    vp4567 = _mm_add_ps(_mm_mul_ps(vz24567, vp4567), valpha9);
+
+    vp0123 = _mm_add_ps(_mm_mul_ps(vz20123, vp0123), valpha7);
+    vp4567 = _mm_add_ps(_mm_mul_ps(vz24567, vp4567), valpha7);
+
+    vp0123 = _mm_add_ps(_mm_mul_ps(vz20123, vp0123), valpha5);
+    vp4567 = _mm_add_ps(_mm_mul_ps(vz24567, vp4567), valpha5);
+
+    vp0123 = _mm_add_ps(_mm_mul_ps(vz20123, vp0123), valpha3);
+    vp4567 = _mm_add_ps(_mm_mul_ps(vz24567, vp4567), valpha3);
+
+    vp0123 = _mm_add_ps(_mm_mul_ps(vz20123, vp0123), valpha1);
+    vp4567 = _mm_add_ps(_mm_mul_ps(vz24567, vp4567), valpha1);
+
+    vp0123 = _mm_mul_ps(vp0123, vz0123);
+    vp4567 = _mm_mul_ps(vp4567, vz4567);
+
+    // Evaluate the denominator polynomial q(z) = beta0 + z^2 * (beta2 + z^2 * (beta4 + z^2 * beta6)).
+    __m128 vq0123 = _mm_add_ps(_mm_mul_ps(vz20123, vbeta6), vbeta4);
+    __m128 vq4567 = _mm_add_ps(_mm_mul_ps(vz24567, vbeta6), vbeta4);
+
+    vq0123 = _mm_add_ps(_mm_mul_ps(vz20123, vq0123), vbeta2);
+    vq4567 = _mm_add_ps(_mm_mul_ps(vz24567, vq4567), vbeta2);
+
+    vq0123 = _mm_add_ps(_mm_mul_ps(vz20123, vq0123), vbeta0);
+    vq4567 = _mm_add_ps(_mm_mul_ps(vz24567, vq4567), vbeta0);
+
+    // Reconstruct tanh(x) = p(z) / q(z)
+    __m128 vy0123 = _mm_div_ps(vp0123, vq0123);
+    __m128 vy4567 = _mm_div_ps(vp4567, vq4567);
+
+    _mm_storeu_ps(y, vy0123);
+    _mm_storeu_ps(y + 4, vy4567);
+    y += 8;
+  }
+  for (; n >= 4 * sizeof(float); n -= 4 * sizeof(float)) {
+    const __m128 vx = _mm_loadu_ps(x);
+    x += 4;
+
+    __m128 vz = _mm_max_ps(vx, vminus_sat_cutoff);
+    vz = _mm_min_ps(vz, vsat_cutoff);
+    const __m128 vz2 = _mm_mul_ps(vz, vz);
+    __m128 vp = _mm_add_ps(_mm_mul_ps(vz2, valpha13), valpha11);
+    vp = _mm_add_ps(_mm_mul_ps(vz2, vp), valpha9);
+    vp = _mm_add_ps(_mm_mul_ps(vz2, vp), valpha7);
+    vp = _mm_add_ps(_mm_mul_ps(vz2, vp), valpha5);
+    vp = _mm_add_ps(_mm_mul_ps(vz2, vp), valpha3);
+    vp = _mm_add_ps(_mm_mul_ps(vz2, vp), valpha1);
+    vp = _mm_mul_ps(vp, vz);
+    __m128 vq = _mm_add_ps(_mm_mul_ps(vz2, vbeta6), vbeta4);
+    vq = _mm_add_ps(_mm_mul_ps(vz2, vq), vbeta2);
+    vq = _mm_add_ps(_mm_mul_ps(vz2, vq), vbeta0);
+    __m128 vy = _mm_div_ps(vp, vq);
+
+    _mm_storeu_ps(y, vy);
+    y += 4;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    const __m128 vx = _mm_loadu_ps(x);
+
+    __m128 vz = _mm_max_ps(vx, vminus_sat_cutoff);
+    vz = _mm_min_ps(vz, vsat_cutoff);
+    const __m128 vz2 = _mm_mul_ps(vz, vz);
+    __m128 vp = _mm_add_ps(_mm_mul_ps(vz2, valpha13), valpha11);
+    vp = _mm_add_ps(_mm_mul_ps(vz2, vp), valpha9);
+    vp = _mm_add_ps(_mm_mul_ps(vz2, vp), valpha7);
+    vp = _mm_add_ps(_mm_mul_ps(vz2, vp), valpha5);
+    vp = _mm_add_ps(_mm_mul_ps(vz2, vp), valpha3);
+    vp = _mm_add_ps(_mm_mul_ps(vz2, vp), valpha1);
+    vp = _mm_mul_ps(vp, vz);
+    __m128 vq = _mm_add_ps(_mm_mul_ps(vz2, vbeta6), vbeta4);
+    vq = _mm_add_ps(_mm_mul_ps(vz2, vq), vbeta2);
+    vq = _mm_add_ps(_mm_mul_ps(vz2, vq), vbeta0);
+    __m128 vy = _mm_div_ps(vp, vq);
+
+    if (n & (2 * sizeof(float))) {
+      _mm_storel_pi((__m64*) y, vy);
+      vy = _mm_movehl_ps(vy, vy);
+      y += 2;
+    }
+    if (n & (1 * sizeof(float))) {
+      _mm_store_ss(y, vy);
+    }
+  }
+}
@@ -0,0 +1,73 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/vquantize.h>
+
+
+void xnn_f32_vquantize_ukernel__neon(
+    size_t n,
+    const float* x,
+    uint8_t* y,
+    const union xnn_f32_q8_quantization_params params[restrict static 1])
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+
+  const float32x4_t vscale = vld1q_dup_f32(&params->neon.scale);
+  const float32x4_t voutput_min_less_zero_point = vld1q_dup_f32(&params->neon.output_min_less_zero_point);
+  const float32x4_t voutput_max_less_zero_point = vld1q_dup_f32(&params->neon.output_max_less_zero_point);
+  const float32x4_t vmagic_bias = vld1q_dup_f32(&params->neon.magic_bias);
+  const int32x4_t vmagic_bias_less_zero_point = vld1q_dup_s32(&params->neon.magic_bias_less_zero_point);
+  for (; n >= 16 * sizeof(float); n -= 16 * sizeof(float)) {
+    float32x4_t vx0123 = vmulq_f32(vld1q_f32(x), vscale); x += 4;
+    float32x4_t vx4567 = vmulq_f32(vld1q_f32(x), vscale); x += 4;
+    float32x4_t vx89AB = vmulq_f32(vld1q_f32(x), vscale); x += 4;
+    float32x4_t vxCDEF = vmulq_f32(vld1q_f32(x), vscale); x += 4;
+
+    vx0123 = vminq_f32(vmaxq_f32(vx0123, voutput_min_less_zero_point), voutput_max_less_zero_point);
+    vx4567 = vminq_f32(vmaxq_f32(vx4567, voutput_min_less_zero_point), voutput_max_less_zero_point);
+    vx89AB = vminq_f32(vmaxq_f32(vx89AB, voutput_min_less_zero_point), voutput_max_less_zero_point);
+    vxCDEF = vminq_f32(vmaxq_f32(vxCDEF, voutput_min_less_zero_point), voutput_max_less_zero_point);
+
+    // Round to nearest-even integer with the "magic bias" trick, and add zero point in the same subtraction.
+    const int32x4_t vy0123 = vsubq_s32(vreinterpretq_s32_f32(vaddq_f32(vx0123, vmagic_bias)), vmagic_bias_less_zero_point);
+    const int32x4_t vy4567 = vsubq_s32(vreinterpretq_s32_f32(vaddq_f32(vx4567, vmagic_bias)), vmagic_bias_less_zero_point);
+    const int32x4_t vy89AB = vsubq_s32(vreinterpretq_s32_f32(vaddq_f32(vx89AB, vmagic_bias)), vmagic_bias_less_zero_point);
+    const int32x4_t vyCDEF = vsubq_s32(vreinterpretq_s32_f32(vaddq_f32(vxCDEF, vmagic_bias)), vmagic_bias_less_zero_point);
+
+    const int16x8_t vy01234567 = vcombine_s16(vmovn_s32(vy0123), vmovn_s32(vy4567));
+    const int16x8_t vy89ABCDEF = vcombine_s16(vmovn_s32(vy89AB), vmovn_s32(vyCDEF));
+    const uint8x16_t vy = vcombine_u8(vqmovun_s16(vy01234567), vqmovun_s16(vy89ABCDEF));
+
+    vst1q_u8(y, vy); y += 16;
+  }
+  for (; n >= 4 * sizeof(float); n -= 4 * sizeof(float)) {
+    float32x4_t vx = vmulq_f32(vld1q_f32(x), vscale); x += 4;
+
+    vx = vminq_f32(vmaxq_f32(vx, voutput_min_less_zero_point), voutput_max_less_zero_point);
+    const int32x4_t vy32 = vsubq_s32(vreinterpretq_s32_f32(vaddq_f32(vx, vmagic_bias)), vmagic_bias_less_zero_point);
+    const int16x4_t vy16 = vmovn_s32(vy32);
+    const uint8x8_t vy = vqmovun_s16(vcombine_s16(vy16, vy16));
+
+    vst1_lane_u32(__builtin_assume_aligned(y, 1), vreinterpret_u32_u8(vy), 0); y += 4;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    do {
+      float32x4_t vx = vmulq_f32(vld1q_dup_f32(x), vscale); x += 1;
+
+      vx = vminq_f32(vmaxq_f32(vx, voutput_min_less_zero_point), voutput_max_less_zero_point);
+      const int32x4_t vy32 = vsubq_s32(vreinterpretq_s32_f32(vaddq_f32(vx, vmagic_bias)), vmagic_bias_less_zero_point);
+      const int16x4_t vy16 = vmovn_s32(vy32);
+      const uint8x8_t vy = vqmovun_s16(vcombine_s16(vy16, vy16));
+
+      vst1_lane_u8(y, vy, 0); y += 1;
+      n -= sizeof(float);
+    } while (n != 0);
+  }
+}
@@ -0,0 +1,67 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <fp16/bitcasts.h>
+
+#include <xnnpack/math.h>
+#include <xnnpack/vquantize.h>
+
+
+void xnn_f32_vquantize_ukernel__scalar(
+    size_t n,
+    const float* x,
+    uint8_t* y,
+    const union xnn_f32_q8_quantization_params params[restrict static 1])
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+
+  const float vscale = params->scalar.scale;
+  const float voutput_min_less_zero_point = params->scalar.output_min_less_zero_point;
+  const float voutput_max_less_zero_point = params->scalar.output_max_less_zero_point;
+  const float vmagic_bias = params->scalar.magic_bias;
+  const int32_t vmagic_bias_less_zero_point = params->scalar.magic_bias_less_zero_point;
+  for (; n >= 4 * sizeof(float); n -= 4 * sizeof(float)) {
+    float vx0 = x[0] * vscale;
+    float vx1 = x[1] * vscale;
+    float vx2 = x[2] * vscale;
+    float vx3 = x[3] * vscale;
+    x += 4;
+
+    vx0 = math_max_f32(vx0, voutput_min_less_zero_point);
+    vx1 = math_max_f32(vx1, voutput_min_less_zero_point);
+    vx2 = math_max_f32(vx2, voutput_min_less_zero_point);
+    vx3 = math_max_f32(vx3, voutput_min_less_zero_point);
+
+    vx0 = math_min_f32(vx0, voutput_max_less_zero_point);
+    vx1 = math_min_f32(vx1, voutput_max_less_zero_point);
+    vx2 = math_min_f32(vx2, voutput_max_less_zero_point);
+    vx3 = math_min_f32(vx3, voutput_max_less_zero_point);
+
+    // Round to nearest-even integer with the "magic bias" trick, and add zero point in the same subtraction.
+    vx0 += vmagic_bias;
+    vx1 += vmagic_bias;
+    vx2 += vmagic_bias;
+    vx3 += vmagic_bias;
+
+    y[0] = (uint8_t) ((int32_t) fp32_to_bits(vx0) - vmagic_bias_less_zero_point);
+    y[1] = (uint8_t) ((int32_t) fp32_to_bits(vx1) - vmagic_bias_less_zero_point);
+    y[2] = (uint8_t) ((int32_t) fp32_to_bits(vx2) - vmagic_bias_less_zero_point);
+    y[3] = (uint8_t) ((int32_t) fp32_to_bits(vx3) - vmagic_bias_less_zero_point);
+    y += 4;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    do {
+      float vx = *x++ * vscale;
+      vx = math_max_f32(vx, voutput_min_less_zero_point);
+      vx = math_min_f32(vx, voutput_max_less_zero_point);
+      vx += vmagic_bias;
+      *y++ = (uint8_t) ((int32_t) fp32_to_bits(vx) - vmagic_bias_less_zero_point);
+      n -= sizeof(float);
+    } while (n != 0);
+  }
+}
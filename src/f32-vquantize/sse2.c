@@ -0,0 +1,77 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <emmintrin.h>
+
+#include <xnnpack/vquantize.h>
+
+
+void xnn_f32_vquantize_ukernel__sse2(
+    size_t n,
+    const float* x,
+    uint8_t* y,
+    const union xnn_f32_q8_quantization_params params[restrict static 1])
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+
+  const __m128 vscale = _mm_load_ps(params->sse2.scale);
+  const __m128 voutput_min_less_zero_point = _mm_load_ps(params->sse2.output_min_less_zero_point);
+  const __m128 voutput_max_less_zero_point = _mm_load_ps(params->sse2.output_max_less_zero_point);
+  const __m128i vzero_point = _mm_load_si128((const __m128i*) params->sse2.zero_point);
+  for (; n >= 16 * sizeof(float); n -= 16 * sizeof(float)) {
+    __m128 vx0123 = _mm_mul_ps(_mm_loadu_ps(x), vscale);
+    __m128 vx4567 = _mm_mul_ps(_mm_loadu_ps(x + 4), vscale);
+    __m128 vx89AB = _mm_mul_ps(_mm_loadu_ps(x + 8), vscale);
+    __m128 vxCDEF = _mm_mul_ps(_mm_loadu_ps(x + 12), vscale);
+    x += 16;
+
+    // Clamp in FP32, so that the conversion to INT32 can't overflow.
+    vx0123 = _mm_min_ps(_mm_max_ps(vx0123, voutput_min_less_zero_point), voutput_max_less_zero_point);
+    vx4567 = _mm_min_ps(_mm_max_ps(vx4567, voutput_min_less_zero_point), voutput_max_less_zero_point);
+    vx89AB = _mm_min_ps(_mm_max_ps(vx89AB, voutput_min_less_zero_point), voutput_max_less_zero_point);
+    vxCDEF = _mm_min_ps(_mm_max_ps(vxCDEF, voutput_min_less_zero_point), voutput_max_less_zero_point);
+
+    const __m128i vy0123 = _mm_cvtps_epi32(vx0123);
+    const __m128i vy4567 = _mm_cvtps_epi32(vx4567);
+    const __m128i vy89AB = _mm_cvtps_epi32(vx89AB);
+    const __m128i vyCDEF = _mm_cvtps_epi32(vxCDEF);
+
+    const __m128i vy01234567 = _mm_adds_epi16(_mm_packs_epi32(vy0123, vy4567), vzero_point);
+    const __m128i vy89ABCDEF = _mm_adds_epi16(_mm_packs_epi32(vy89AB, vyCDEF), vzero_point);
+    const __m128i vy = _mm_packus_epi16(vy01234567, vy89ABCDEF);
+
+    _mm_storeu_si128((__m128i*) y, vy);
+    y += 16;
+  }
+  for (; n >= 4 * sizeof(float); n -= 4 * sizeof(float)) {
+    __m128 vx = _mm_mul_ps(_mm_loadu_ps(x), vscale);
+    x += 4;
+
+    vx = _mm_min_ps(_mm_max_ps(vx, voutput_min_less_zero_point), voutput_max_less_zero_point);
+    const __m128i vy32 = _mm_cvtps_epi32(vx);
+    const __m128i vy16 = _mm_adds_epi16(_mm_packs_epi32(vy32, vy32), vzero_point);
+    const __m128i vy = _mm_packus_epi16(vy16, vy16);
+
+    *((uint32_t*) y) = (uint32_t) _mm_cvtsi128_si32(vy);
+    y += 4;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    do {
+      __m128 vx = _mm_mul_ss(_mm_load_ss(x), vscale);
+      x += 1;
+
+      vx = _mm_min_ss(_mm_max_ss(vx, voutput_min_less_zero_point), voutput_max_less_zero_point);
+      const __m128i vy32 = _mm_cvtps_epi32(vx);
+      const __m128i vy16 = _mm_adds_epi16(_mm_packs_epi32(vy32, vy32), vzero_point);
+      const __m128i vy = _mm_packus_epi16(vy16, vy16);
+
+      *y++ = (uint8_t) _mm_cvtsi128_si32(vy);
+      n -= sizeof(float);
+    } while (n != 0);
+  }
+}
@@ -0,0 +1,78 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <psimd.h>
+
+#include <xnnpack/winograd.h>
+
+
+void xnn_f32_winograd_input_ukernel_6x6__psimd(
+    size_t channels,
+    const float** input,
+    float* output,
+    size_t output_stride)
+{
+  assert(channels != 0);
+
+  const psimd_f32 vtwo = psimd_splat_f32(2.0f);
+  const psimd_f32 vfour = psimd_splat_f32(4.0f);
+  const psimd_f32 vfive = psimd_splat_f32(5.0f);
+  for (size_t c = 0; c < channels; c += 4) {
+    // Transform columns: t := B^T d.
+    psimd_f32 vt[6][6];
+    for (size_t x = 0; x < 6; x++) {
+      const psimd_f32 vd0 = psimd_load_f32(input[0 * 6 + x] + c);
+      const psimd_f32 vd1 = psimd_load_f32(input[1 * 6 + x] + c);
+      const psimd_f32 vd2 = psimd_load_f32(input[2 * 6 + x] + c);
+      const psimd_f32 vd3 = psimd_load_f32(input[3 * 6 + x] + c);
+      const psimd_f32 vd4 = psimd_load_f32(input[4 * 6 + x] + c);
+      const psimd_f32 vd5 = psimd_load_f32(input[5 * 6 + x] + c);
+
+      vt[0][x] = vfour * vd0 - vfive * vd2 + vd4;
+      vt[1][x] = (vd3 + vd4) - vfour * (vd1 + vd2);
+      vt[2][x] = (vd4 - vd3) + vfour * (vd1 - vd2);
+      vt[3][x] = (vd4 - vd2) + vtwo * (vd3 - vd1);
+      vt[4][x] = (vd4 - vd2) - vtwo * (vd3 - vd1);
+      vt[5][x] = vfour * vd1 - vfive * vd3 + vd5;
+    }
+
+    // Transform rows: v := t B.
+    for (size_t y = 0; y < 6; y++) {
+      const psimd_f32 vt0 = vt[y][0];
+      const psimd_f32 vt1 = vt[y][1];
+      const psimd_f32 vt2 = vt[y][2];
+      const psimd_f32 vt3 = vt[y][3];
+      const psimd_f32 vt4 = vt[y][4];
+      const psimd_f32 vt5 = vt[y][5];
+
+      psimd_f32 vv[6];
+      vv[0] = vfour * vt0 - vfive * vt2 + vt4;
+      vv[1] = (vt3 + vt4) - vfour * (vt1 + vt2);
+      vv[2] = (vt4 - vt3) + vfour * (vt1 - vt2);
+      vv[3] = (vt4 - vt2) + vtwo * (vt3 - vt1);
+      vv[4] = (vt4 - vt2) - vtwo * (vt3 - vt1);
+      vv[5] = vfour * vt1 - vfive * vt3 + vt5;
+
+      for (size_t x = 0; x < 6; x++) {
+        float* o = (float*) ((uintptr_t) output + (y * 6 + x) * output_stride) + c;
+        if XNN_LIKELY(channels - c >= 4) {
+          psimd_store_f32(o, vv[x]);
+        } else {
+          psimd_f32 vo = vv[x];
+          if ((channels - c) & 2) {
+            psimd_store2_f32(o, vo);
+            vo = psimd_concat_hi_f32(vo, vo);
+            o += 2;
+          }
+          if ((channels - c) & 1) {
+            psimd_store1_f32(o, vo);
+          }
+        }
+      }
+    }
+  }
+}
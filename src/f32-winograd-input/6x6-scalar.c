@@ -0,0 +1,61 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xnnpack/winograd.h>
+
+
+void xnn_f32_winograd_input_ukernel_6x6__scalar(
+    size_t channels,
+    const float** input,
+    float* output,
+    size_t output_stride)
+{
+  assert(channels != 0);
+
+  for (size_t c = 0; c < channels; c++) {
+    // Transform columns: t := B^T d.
+    float t[6][6];
+    for (size_t x = 0; x < 6; x++) {
+      const float d0 = input[0 * 6 + x][c];
+      const float d1 = input[1 * 6 + x][c];
+      const float d2 = input[2 * 6 + x][c];
+      const float d3 = input[3 * 6 + x][c];
+      const float d4 = input[4 * 6 + x][c];
+      const float d5 = input[5 * 6 + x][c];
+
+      t[0][x] = 4.0f * d0 - 5.0f * d2 + d4;
+      t[1][x] = (d3 + d4) - 4.0f * (d1 + d2);
+      t[2][x] = (d4 - d3) + 4.0f * (d1 - d2);
+      t[3][x] = (d4 - d2) + 2.0f * (d3 - d1);
+      t[4][x] = (d4 - d2) - 2.0f * (d3 - d1);
+      t[5][x] = 4.0f * d1 - 5.0f * d3 + d5;
+    }
+
+    // Transform rows: v := t B.
+    for (size_t y = 0; y < 6; y++) {
+      const float t0 = t[y][0];
+      const float t1 = t[y][1];
+      const float t2 = t[y][2];
+      const float t3 = t[y][3];
+      const float t4 = t[y][4];
+      const float t5 = t[y][5];
+
+      float v[6];
+      v[0] = 4.0f * t0 - 5.0f * t2 + t4;
+      v[1] = (t3 + t4) - 4.0f * (t1 + t2);
+      v[2] = (t4 - t3) + 4.0f * (t1 - t2);
+      v[3] = (t4 - t2) + 2.0f * (t3 - t1);
+      v[4] = (t4 - t2) - 2.0f * (t3 - t1);
+      v[5] = 4.0f * t1 - 5.0f * t3 + t5;
+
+      for (size_t x = 0; x < 6; x++) {
+        float* o = (float*) ((uintptr_t) output + (y * 6 + x) * output_stride);
+        o[c] = v[x];
+      }
+    }
+  }
+}
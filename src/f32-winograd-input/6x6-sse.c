@@ -0,0 +1,82 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xmmintrin.h>
+
+#include <xnnpack/winograd.h>
+
+
+void xnn_f32_winograd_input_ukernel_6x6__sse(
+    size_t channels,
+    const float** input,
+    float* output,
+    size_t output_stride)
+{
+  assert(channels != 0);
+
+  const __m128 vtwo = _mm_set1_ps(2.0f);
+  const __m128 vfour = _mm_set1_ps(4.0f);
+  const __m128 vfive = _mm_set1_ps(5.0f);
+  for (size_t c = 0; c < channels; c += 4) {
+    // Transform columns: t := B^T d.
+    __m128 vt[6][6];
+    for (size_t x = 0; x < 6; x++) {
+      const __m128 vd0 = _mm_loadu_ps(input[0 * 6 + x] + c);
+      const __m128 vd1 = _mm_loadu_ps(input[1 * 6 + x] + c);
+      const __m128 vd2 = _mm_loadu_ps(input[2 * 6 + x] + c);
+      const __m128 vd3 = _mm_loadu_ps(input[3 * 6 + x] + c);
+      const __m128 vd4 = _mm_loadu_ps(input[4 * 6 + x] + c);
+      const __m128 vd5 = _mm_loadu_ps(input[5 * 6 + x] + c);
+
+      const __m128 vd42 = _mm_sub_ps(vd4, vd2);
+      const __m128 vd31 = _mm_mul_ps(vtwo, _mm_sub_ps(vd3, vd1));
+      vt[0][x] = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(vfour, vd0), _mm_mul_ps(vfive, vd2)), vd4);
+      vt[1][x] = _mm_sub_ps(_mm_add_ps(vd3, vd4), _mm_mul_ps(vfour, _mm_add_ps(vd1, vd2)));
+      vt[2][x] = _mm_add_ps(_mm_sub_ps(vd4, vd3), _mm_mul_ps(vfour, _mm_sub_ps(vd1, vd2)));
+      vt[3][x] = _mm_add_ps(vd42, vd31);
+      vt[4][x] = _mm_sub_ps(vd42, vd31);
+      vt[5][x] = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(vfour, vd1), _mm_mul_ps(vfive, vd3)), vd5);
+    }
+
+    // Transform rows: v := t B.
+    for (size_t y = 0; y < 6; y++) {
+      const __m128 vt0 = vt[y][0];
+      const __m128 vt1 = vt[y][1];
+      const __m128 vt2 = vt[y][2];
+      const __m128 vt3 = vt[y][3];
+      const __m128 vt4 = vt[y][4];
+      const __m128 vt5 = vt[y][5];
+
+      const __m128 vt42 = _mm_sub_ps(vt4, vt2);
+      const __m128 vt31 = _mm_mul_ps(vtwo, _mm_sub_ps(vt3, vt1));
+      __m128 vv[6];
+      vv[0] = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(vfour, vt0), _mm_mul_ps(vfive, vt2)), vt4);
+      vv[1] = _mm_sub_ps(_mm_add_ps(vt3, vt4), _mm_mul_ps(vfour, _mm_add_ps(vt1, vt2)));
+      vv[2] = _mm_add_ps(_mm_sub_ps(vt4, vt3), _mm_mul_ps(vfour, _mm_sub_ps(vt1, vt2)));
+      vv[3] = _mm_add_ps(vt42, vt31);
+      vv[4] = _mm_sub_ps(vt42, vt31);
+      vv[5] = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(vfour, vt1), _mm_mul_ps(vfive, vt3)), vt5);
+
+      for (size_t x = 0; x < 6; x++) {
+        float* o = (float*) ((uintptr_t) output + (y * 6 + x) * output_stride) + c;
+        if XNN_LIKELY(channels - c >= 4) {
+          _mm_storeu_ps(o, vv[x]);
+        } else {
+          __m128 vo = vv[x];
+          if ((channels - c) & 2) {
+            _mm_storel_pi((__m64*) o, vo);
+            vo = _mm_movehl_ps(vo, vo);
+            o += 2;
+          }
+          if ((channels - c) & 1) {
+            _mm_store_ss(o, vo);
+          }
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,87 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <psimd.h>
+
+#include <xnnpack/winograd.h>
+
+
+void xnn_f32_winograd_output_ukernel_4x4__psimd(
+    size_t rows,
+    size_t columns,
+    size_t channels,
+    const float* input,
+    size_t input_stride,
+    float* output,
+    size_t output_row_stride,
+    size_t output_column_stride,
+    const union xnn_f32_output_params params[restrict static 1])
+{
+  assert(rows != 0);
+  assert(rows <= 4);
+  assert(columns != 0);
+  assert(columns <= 4);
+  assert(channels != 0);
+
+  const psimd_f32 vtwo = psimd_splat_f32(2.0f);
+  const psimd_f32 vfour = psimd_splat_f32(4.0f);
+  const psimd_f32 veight = psimd_splat_f32(8.0f);
+  const psimd_f32 vmin = psimd_load_splat_f32(&params->scalar.min);
+  const psimd_f32 vmax = psimd_load_splat_f32(&params->scalar.max);
+  for (size_t c = 0; c < channels; c += 4) {
+    // Transform columns: t := A^T m.
+    psimd_f32 vt[4][6];
+    for (size_t x = 0; x < 6; x++) {
+      const psimd_f32 vm0 = psimd_load_f32((const float*) ((uintptr_t) input + (0 * 6 + x) * input_stride) + c);
+      const psimd_f32 vm1 = psimd_load_f32((const float*) ((uintptr_t) input + (1 * 6 + x) * input_stride) + c);
+      const psimd_f32 vm2 = psimd_load_f32((const float*) ((uintptr_t) input + (2 * 6 + x) * input_stride) + c);
+      const psimd_f32 vm3 = psimd_load_f32((const float*) ((uintptr_t) input + (3 * 6 + x) * input_stride) + c);
+      const psimd_f32 vm4 = psimd_load_f32((const float*) ((uintptr_t) input + (4 * 6 + x) * input_stride) + c);
+      const psimd_f32 vm5 = psimd_load_f32((const float*) ((uintptr_t) input + (5 * 6 + x) * input_stride) + c);
+
+      const psimd_f32 vs12 = vm1 + vm2;
+      const psimd_f32 vd12 = vm1 - vm2;
+      const psimd_f32 vs34 = vm3 + vm4;
+      const psimd_f32 vd34 = vm3 - vm4;
+      vt[0][x] = vm0 + vs12 + vs34;
+      vt[1][x] = vd12 + vtwo * vd34;
+      vt[2][x] = vs12 + vfour * vs34;
+      vt[3][x] = vd12 + veight * vd34 + vm5;
+    }
+
+    // Transform rows: y := t A, and store the rows and columns of the tile which are within the output.
+    for (size_t y = 0; y < rows; y++) {
+      const psimd_f32 vs12 = vt[y][1] + vt[y][2];
+      const psimd_f32 vd12 = vt[y][1] - vt[y][2];
+      const psimd_f32 vs34 = vt[y][3] + vt[y][4];
+      const psimd_f32 vd34 = vt[y][3] - vt[y][4];
+
+      psimd_f32 vv[4];
+      vv[0] = vt[y][0] + vs12 + vs34;
+      vv[1] = vd12 + vtwo * vd34;
+      vv[2] = vs12 + vfour * vs34;
+      vv[3] = vd12 + veight * vd34 + vt[y][5];
+
+      for (size_t x = 0; x < columns; x++) {
+        float* o = (float*) ((uintptr_t) output + y * output_row_stride + x * output_column_stride) + c;
+        psimd_f32 vo = psimd_min_f32(psimd_max_f32(vv[x], vmin), vmax);
+        if XNN_LIKELY(channels - c >= 4) {
+          psimd_store_f32(o, vo);
+        } else {
+          if ((channels - c) & 2) {
+            psimd_store2_f32(o, vo);
+            vo = psimd_concat_hi_f32(vo, vo);
+            o += 2;
+          }
+          if ((channels - c) & 1) {
+            psimd_store1_f32(o, vo);
+          }
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,71 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xnnpack/math.h>
+#include <xnnpack/winograd.h>
+
+
+void xnn_f32_winograd_output_ukernel_4x4__scalar(
+    size_t rows,
+    size_t columns,
+    size_t channels,
+    const float* input,
+    size_t input_stride,
+    float* output,
+    size_t output_row_stride,
+    size_t output_column_stride,
+    const union xnn_f32_output_params params[restrict static 1])
+{
+  assert(rows != 0);
+  assert(rows <= 4);
+  assert(columns != 0);
+  assert(columns <= 4);
+  assert(channels != 0);
+
+  const float vmin = params->scalar.min;
+  const float vmax = params->scalar.max;
+  for (size_t c = 0; c < channels; c++) {
+    // Transform columns: t := A^T m.
+    float t[4][6];
+    for (size_t x = 0; x < 6; x++) {
+      const float m0 = ((const float*) ((uintptr_t) input + (0 * 6 + x) * input_stride))[c];
+      const float m1 = ((const float*) ((uintptr_t) input + (1 * 6 + x) * input_stride))[c];
+      const float m2 = ((const float*) ((uintptr_t) input + (2 * 6 + x) * input_stride))[c];
+      const float m3 = ((const float*) ((uintptr_t) input + (3 * 6 + x) * input_stride))[c];
+      const float m4 = ((const float*) ((uintptr_t) input + (4 * 6 + x) * input_stride))[c];
+      const float m5 = ((const float*) ((uintptr_t) input + (5 * 6 + x) * input_stride))[c];
+
+      const float s12 = m1 + m2;
+      const float d12 = m1 - m2;
+      const float s34 = m3 + m4;
+      const float d34 = m3 - m4;
+      t[0][x] = m0 + s12 + s34;
+      t[1][x] = d12 + 2.0f * d34;
+      t[2][x] = s12 + 4.0f * s34;
+      t[3][x] = d12 + 8.0f * d34 + m5;
+    }
+
+    // Transform rows: y := t A, and store the rows and columns of the tile which are within the output.
+    for (size_t y = 0; y < rows; y++) {
+      const float s12 = t[y][1] + t[y][2];
+      const float d12 = t[y][1] - t[y][2];
+      const float s34 = t[y][3] + t[y][4];
+      const float d34 = t[y][3] - t[y][4];
+
+      float v[4];
+      v[0] = t[y][0] + s12 + s34;
+      v[1] = d12 + 2.0f * d34;
+      v[2] = s12 + 4.0f * s34;
+      v[3] = d12 + 8.0f * d34 + t[y][5];
+
+      for (size_t x = 0; x < columns; x++) {
+        float* o = (float*) ((uintptr_t) output + y * output_row_stride + x * output_column_stride);
+        o[c] = math_min_f32(math_max_f32(v[x], vmin), vmax);
+      }
+    }
+  }
+}
@@ -0,0 +1,87 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xmmintrin.h>
+
+#include <xnnpack/winograd.h>
+
+
+void xnn_f32_winograd_output_ukernel_4x4__sse(
+    size_t rows,
+    size_t columns,
+    size_t channels,
+    const float* input,
+    size_t input_stride,
+    float* output,
+    size_t output_row_stride,
+    size_t output_column_stride,
+    const union xnn_f32_output_params params[restrict static 1])
+{
+  assert(rows != 0);
+  assert(rows <= 4);
+  assert(columns != 0);
+  assert(columns <= 4);
+  assert(channels != 0);
+
+  const __m128 vtwo = _mm_set1_ps(2.0f);
+  const __m128 vfour = _mm_set1_ps(4.0f);
+  const __m128 veight = _mm_set1_ps(8.0f);
+  const __m128 vmin = _mm_load_ps(params->sse.min);
+  const __m128 vmax = _mm_load_ps(params->sse.max);
+  for (size_t c = 0; c < channels; c += 4) {
+    // Transform columns: t := A^T m.
+    __m128 vt[4][6];
+    for (size_t x = 0; x < 6; x++) {
+      const __m128 vm0 = _mm_loadu_ps((const float*) ((uintptr_t) input + (0 * 6 + x) * input_stride) + c);
+      const __m128 vm1 = _mm_loadu_ps((const float*) ((uintptr_t) input + (1 * 6 + x) * input_stride) + c);
+      const __m128 vm2 = _mm_loadu_ps((const float*) ((uintptr_t) input + (2 * 6 + x) * input_stride) + c);
+      const __m128 vm3 = _mm_loadu_ps((const float*) ((uintptr_t) input + (3 * 6 + x) * input_stride) + c);
+      const __m128 vm4 = _mm_loadu_ps((const float*) ((uintptr_t) input + (4 * 6 + x) * input_stride) + c);
+      const __m128 vm5 = _mm_loadu_ps((const float*) ((uintptr_t) input + (5 * 6 + x) * input_stride) + c);
+
+      const __m128 vs12 = _mm_add_ps(vm1, vm2);
+      const __m128 vd12 = _mm_sub_ps(vm1, vm2);
+      const __m128 vs34 = _mm_add_ps(vm3, vm4);
+      const __m128 vd34 = _mm_sub_ps(vm3, vm4);
+      vt[0][x] = _mm_add_ps(_mm_add_ps(vm0, vs12), vs34);
+      vt[1][x] = _mm_add_ps(vd12, _mm_mul_ps(vtwo, vd34));
+      vt[2][x] = _mm_add_ps(vs12, _mm_mul_ps(vfour, vs34));
+      vt[3][x] = _mm_add_ps(_mm_add_ps(vd12, _mm_mul_ps(veight, vd34)), vm5);
+    }
+
+    // Transform rows: y := t A, and store the rows and columns of the tile which are within the output.
+    for (size_t y = 0; y < rows; y++) {
+      const __m128 vs12 = _mm_add_ps(vt[y][1], vt[y][2]);
+      const __m128 vd12 = _mm_sub_ps(vt[y][1], vt[y][2]);
+      const __m128 vs34 = _mm_add_ps(vt[y][3], vt[y][4]);
+      const __m128 vd34 = _mm_sub_ps(vt[y][3], vt[y][4]);
+
+      __m128 vv[4];
+      vv[0] = _mm_add_ps(_mm_add_ps(vt[y][0], vs12), vs34);
+      vv[1] = _mm_add_ps(vd12, _mm_mul_ps(vtwo, vd34));
+      vv[2] = _mm_add_ps(vs12, _mm_mul_ps(vfour, vs34));
+      vv[3] = _mm_add_ps(_mm_add_ps(vd12, _mm_mul_ps(veight, vd34)), vt[y][5]);
+
+      for (size_t x = 0; x < columns; x++) {
+        float* o = (float*) ((uintptr_t) output + y * output_row_stride + x * output_column_stride) + c;
+        __m128 vo = _mm_min_ps(_mm_max_ps(vv[x], vmin), vmax);
+        if XNN_LIKELY(channels - c >= 4) {
+          _mm_storeu_ps(o, vo);
+        } else {
+          if ((channels - c) & 2) {
+            _mm_storel_pi((__m64*) o, vo);
+            vo = _mm_movehl_ps(vo, vo);
+            o += 2;
+          }
+          if ((channels - c) & 1) {
+            _mm_store_ss(o, vo);
+          }
+        }
+      }
+    }
+  }
+}
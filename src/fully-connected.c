@@ -13,6 +13,8 @@
 #include <string.h>
 #include <math.h>
 
+#include <fp16.h>
+
 #include <xnnpack.h>
 #include <xnnpack/allocator.h>
 #include <xnnpack/operator.h>
@@ -20,24 +22,518 @@
 #include <xnnpack/log.h>
 #include <xnnpack/math.h>
 #include <xnnpack/pack.h>
+#include <xnnpack/packed-weights.h>
 #include <xnnpack/params.h>
+#include <xnnpack/sparse-weights.h>
+
+
+enum xnn_status xnn_create_fully_connected_nc_q8(
+    size_t input_channels,
+    size_t output_channels,
+    size_t input_stride,
+    size_t output_stride,
+    uint8_t input_zero_point,
+    float input_scale,
+    uint8_t kernel_zero_point,
+    float kernel_scale,
+    const uint8_t* kernel,
+    const int32_t* bias,
+    uint8_t output_zero_point,
+    float output_scale,
+    uint8_t output_min,
+    uint8_t output_max,
+    uint32_t flags,
+    xnn_operator_t* fully_connected_op_out)
+{
+  xnn_operator_t fully_connected_op = NULL;
+  enum xnn_status status = xnn_status_uninitialized;
+
+  if (!xnn_params.initialized) {
+    xnn_log_error("failed to create Fully Connected operator: XNNPACK is not initialized");
+    goto error;
+  }
+
+  status = xnn_status_invalid_parameter;
+
+  if (input_channels == 0) {
+    xnn_log_error(
+      "failed to create Fully Connected operator with %zu input channels: number of channels must be non-zero",
+      input_channels);
+    goto error;
+  }
+
+  if (output_channels == 0) {
+    xnn_log_error(
+      "failed to create Fully Connected operator with %zu output channels: number of channels must be non-zero",
+      output_channels);
+    goto error;
+  }
+
+  if (input_stride < input_channels) {
+    xnn_log_error(
+      "failed to create Fully Connected operator with input element stride of %zu: "
+      "stride must be at least as large as the number of input channels (%zu)",
+      input_stride, input_channels);
+    goto error;
+  }
+
+  if (output_stride < output_channels) {
+    xnn_log_error(
+      "failed to create Fully Connected operator with output element stride of %zu: "
+      "stride must be at least as large as the number of output channels (%zu)",
+      output_stride, output_channels);
+    goto error;
+  }
+
+  if (input_scale <= 0.0f || !isnormal(input_scale)) {
+    xnn_log_error(
+      "failed to create Fully Connected operator with %.7g input scale: scale must be finite, normalized, and positive",
+      input_scale);
+    goto error;
+  }
+
+  if (kernel_scale <= 0.0f || !isnormal(kernel_scale)) {
+    xnn_log_error(
+      "failed to create Fully Connected operator with %.7g kernel scale: scale must be finite, normalized, and positive",
+      kernel_scale);
+    goto error;
+  }
+
+  if (output_scale <= 0.0f || !isnormal(output_scale)) {
+    xnn_log_error(
+      "failed to create Fully Connected operator with %.7g output scale: scale must be finite, normalized, and positive",
+      output_scale);
+    goto error;
+  }
+
+  if (output_min >= output_max) {
+    xnn_log_error(
+      "failed to create Fully Connected operator with [%" PRIu8 ", %" PRIu8 "] output range: "
+      "range min must be below range max",
+      output_min, output_max);
+    goto error;
+  }
+
+  status = xnn_status_unsupported_parameter;
+
+  const float requantization_scale = input_scale * kernel_scale / output_scale;
+  if (requantization_scale >= 1.0f) {
+    xnn_log_error(
+      "failed to create Fully Connected operator with %.7g input scale, %.7g kernel scale, and %.7g output scale: "
+      "requantization scale %.7g is greater or equal to 1.0",
+      input_scale, kernel_scale, output_scale, requantization_scale);
+    goto error;
+  }
+
+  status = xnn_status_out_of_memory;
+
+  fully_connected_op = xnn_allocate_zero_memory(sizeof(struct xnn_operator));
+  if (fully_connected_op == NULL) {
+    xnn_log_error("failed to allocate %zu bytes for Fully Connected operator descriptor", sizeof(struct xnn_operator));
+    goto error;
+  }
+
+  const uint32_t nr = xnn_params.q8.gemm.nr;
+  const uint32_t kr = UINT32_C(1) << xnn_params.q8.gemm.log2_kr;
+
+  const uint32_t n_stride = round_up(output_channels, nr);
+  const uint32_t k_stride = round_up_po2(input_channels, kr);
+
+  fully_connected_op->packed_weights = xnn_allocate_memory(n_stride * (k_stride * sizeof(uint8_t) + sizeof(int32_t)));
+  if (fully_connected_op->packed_weights == NULL) {
+    xnn_log_error("failed to allocate %zu bytes for packed weights",
+      n_stride * (k_stride * sizeof(uint8_t) + sizeof(int32_t)));
+    goto error;
+  }
+  memset(fully_connected_op->packed_weights, kernel_zero_point, n_stride * (k_stride * sizeof(uint8_t) + sizeof(int32_t)));
+
+  xnn_pack_q8_gemm_goi_w(
+    1, output_channels, input_channels,
+    nr, kr,
+    input_zero_point, kernel_zero_point,
+    kernel, bias,
+    fully_connected_op->packed_weights);
+
+  fully_connected_op->group_input_channels = input_channels;
+  fully_connected_op->group_output_channels = output_channels;
+  fully_connected_op->input_pixel_stride = input_stride;
+  fully_connected_op->output_pixel_stride = output_stride;
+
+  fully_connected_op->kernel_zero_point = kernel_zero_point;
+
+  fully_connected_op->q8_gemm_params =
+    xnn_compute_q8_gemm_params(
+      input_zero_point, kernel_zero_point,
+      requantization_scale, output_zero_point, output_min, output_max);
+
+  fully_connected_op->type = xnn_operator_type_fully_connected_q8;
+
+  fully_connected_op->ukernel.type = xnn_ukernel_type_gemm;
+  fully_connected_op->ukernel.gemm = (struct xnn_ukernel_gemm) {
+    .default_function = xnn_params.q8.gemm.gemm,
+    .mr = xnn_params.q8.gemm.mr,
+    .nr = nr,
+    .kr = kr,
+  };
+
+  fully_connected_op->state = xnn_run_state_invalid;
+
+  *fully_connected_op_out = fully_connected_op;
+  return xnn_status_success;
+
+error:
+  xnn_delete_operator(fully_connected_op);
+  return status;
+}
+
+enum xnn_status xnn_create_fully_connected_nc_q8c(
+    size_t input_channels,
+    size_t output_channels,
+    size_t input_stride,
+    size_t output_stride,
+    uint8_t input_zero_point,
+    float input_scale,
+    uint8_t kernel_zero_point,
+    const float* kernel_scale,
+    const uint8_t* kernel,
+    const int32_t* bias,
+    uint8_t output_zero_point,
+    float output_scale,
+    uint8_t output_min,
+    uint8_t output_max,
+    uint32_t flags,
+    xnn_operator_t* fully_connected_op_out)
+{
+  xnn_operator_t fully_connected_op = NULL;
+  float* requantization_scale = NULL;
+  enum xnn_status status = xnn_status_uninitialized;
+
+  if (!xnn_params.initialized) {
+    xnn_log_error("failed to create Fully Connected operator: XNNPACK is not initialized");
+    goto error;
+  }
+
+  status = xnn_status_invalid_parameter;
+
+  if (input_channels == 0) {
+    xnn_log_error(
+      "failed to create Fully Connected operator with %zu input channels: number of channels must be non-zero",
+      input_channels);
+    goto error;
+  }
+
+  if (output_channels == 0) {
+    xnn_log_error(
+      "failed to create Fully Connected operator with %zu output channels: number of channels must be non-zero",
+      output_channels);
+    goto error;
+  }
+
+  if (input_stride < input_channels) {
+    xnn_log_error(
+      "failed to create Fully Connected operator with input element stride of %zu: "
+      "stride must be at least as large as the number of input channels (%zu)",
+      input_stride, input_channels);
+    goto error;
+  }
+
+  if (output_stride < output_channels) {
+    xnn_log_error(
+      "failed to create Fully Connected operator with output element stride of %zu: "
+      "stride must be at least as large as the number of output channels (%zu)",
+      output_stride, output_channels);
+    goto error;
+  }
+
+  if (input_scale <= 0.0f || !isnormal(input_scale)) {
+    xnn_log_error(
+      "failed to create Fully Connected operator with %.7g input scale: scale must be finite, normalized, and positive",
+      input_scale);
+    goto error;
+  }
+
+  for (size_t oc = 0; oc < output_channels; oc++) {
+    if (kernel_scale[oc] <= 0.0f || !isnormal(kernel_scale[oc])) {
+      xnn_log_error(
+        "failed to create Fully Connected operator with %.7g kernel scale in output channel #%zu: "
+        "scale must be finite, normalized, and positive",
+        kernel_scale[oc], oc);
+      goto error;
+    }
+  }
+
+  if (output_scale <= 0.0f || !isnormal(output_scale)) {
+    xnn_log_error(
+      "failed to create Fully Connected operator with %.7g output scale: scale must be finite, normalized, and positive",
+      output_scale);
+    goto error;
+  }
+
+  if (output_min >= output_max) {
+    xnn_log_error(
+      "failed to create Fully Connected operator with [%" PRIu8 ", %" PRIu8 "] output range: "
+      "range min must be below range max",
+      output_min, output_max);
+    goto error;
+  }
+
+  status = xnn_status_unsupported_parameter;
+
+  for (size_t oc = 0; oc < output_channels; oc++) {
+    const float channel_requantization_scale = input_scale * kernel_scale[oc] / output_scale;
+    if (channel_requantization_scale >= 1.0f) {
+      xnn_log_error(
+        "failed to create Fully Connected operator with %.7g input scale, %.7g kernel scale in output channel #%zu, "
+        "and %.7g output scale: requantization scale %.7g is greater or equal to 1.0",
+        input_scale, kernel_scale[oc], oc, output_scale, channel_requantization_scale);
+      goto error;
+    }
+  }
+
+  status = xnn_status_out_of_memory;
+
+  fully_connected_op = xnn_allocate_zero_memory(sizeof(struct xnn_operator));
+  if (fully_connected_op == NULL) {
+    xnn_log_error("failed to allocate %zu bytes for Fully Connected operator descriptor", sizeof(struct xnn_operator));
+    goto error;
+  }
+
+  requantization_scale = xnn_allocate_memory(output_channels * sizeof(float));
+  if (requantization_scale == NULL) {
+    xnn_log_error("failed to allocate %zu bytes for requantization scales", output_channels * sizeof(float));
+    goto error;
+  }
+  for (size_t oc = 0; oc < output_channels; oc++) {
+    requantization_scale[oc] = input_scale * kernel_scale[oc] / output_scale;
+  }
+
+  const uint32_t nr = xnn_params.q8c.gemm.nr;
+  const uint32_t kr = UINT32_C(1) << xnn_params.q8c.gemm.log2_kr;
+
+  const uint32_t n_stride = round_up(output_channels, nr);
+  const uint32_t k_stride = round_up_po2(input_channels, kr);
+
+  const size_t packed_weights_size = n_stride * (k_stride * sizeof(uint8_t) + sizeof(int32_t) + sizeof(float));
+  fully_connected_op->packed_weights = xnn_allocate_memory(packed_weights_size);
+  if (fully_connected_op->packed_weights == NULL) {
+    xnn_log_error("failed to allocate %zu bytes for packed weights", packed_weights_size);
+    goto error;
+  }
+  memset(fully_connected_op->packed_weights, kernel_zero_point, packed_weights_size);
+
+  xnn_pack_q8c_gemm_goi_w(
+    1, output_channels, input_channels,
+    nr, kr,
+    input_zero_point, kernel_zero_point,
+    kernel, bias, requantization_scale,
+    fully_connected_op->packed_weights);
+
+  fully_connected_op->group_input_channels = input_channels;
+  fully_connected_op->group_output_channels = output_channels;
+  fully_connected_op->input_pixel_stride = input_stride;
+  fully_connected_op->output_pixel_stride = output_stride;
+
+  fully_connected_op->kernel_zero_point = kernel_zero_point;
+
+  fully_connected_op->q8c_gemm_params =
+    xnn_compute_q8c_gemm_params(kernel_zero_point, output_zero_point, output_min, output_max);
+
+  fully_connected_op->type = xnn_operator_type_fully_connected_q8c;
+
+  fully_connected_op->ukernel.type = xnn_ukernel_type_gemm;
+  fully_connected_op->ukernel.gemm = (struct xnn_ukernel_gemm) {
+    .default_function = xnn_params.q8c.gemm.gemm,
+    .mr = xnn_params.q8c.gemm.mr,
+    .nr = nr,
+    .kr = kr,
+  };
+
+  fully_connected_op->state = xnn_run_state_invalid;
+
+  xnn_release_memory(requantization_scale);
+  *fully_connected_op_out = fully_connected_op;
+  return xnn_status_success;
+
+error:
+  xnn_release_memory(requantization_scale);
+  xnn_delete_operator(fully_connected_op);
+  return status;
+}
+
+enum xnn_status xnn_create_fully_connected_nc_q8dq(
+    size_t input_channels,
+    size_t output_channels,
+    size_t input_stride,
+    size_t output_stride,
+    const float* kernel,
+    const float* bias,
+    float output_min,
+    float output_max,
+    uint32_t flags,
+    xnn_operator_t* fully_connected_op_out)
+{
+  xnn_operator_t fully_connected_op = NULL;
+  uint8_t* quantized_kernel = NULL;
+  enum xnn_status status = xnn_status_uninitialized;
+
+  if (!xnn_params.initialized) {
+    xnn_log_error("failed to create Fully Connected operator: XNNPACK is not initialized");
+    goto error;
+  }
+
+  status = xnn_status_invalid_parameter;
+
+  if (input_channels == 0) {
+    xnn_log_error(
+      "failed to create Fully Connected operator with %zu input channels: number of channels must be non-zero",
+      input_channels);
+    goto error;
+  }
+
+  if (output_channels == 0) {
+    xnn_log_error(
+      "failed to create Fully Connected operator with %zu output channels: number of channels must be non-zero",
+      output_channels);
+    goto error;
+  }
+
+  if (input_stride < input_channels) {
+    xnn_log_error(
+      "failed to create Fully Connected operator with input element stride of %zu: "
+      "stride must be at least as large as the number of input channels (%zu)",
+      input_stride, input_channels);
+    goto error;
+  }
+
+  if (output_stride < output_channels) {
+    xnn_log_error(
+      "failed to create Fully Connected operator with output element stride of %zu: "
+      "stride must be at least as large as the number of output channels (%zu)",
+      output_stride, output_channels);
+    goto error;
+  }
+
+  if (isnan(output_min)) {
+    xnn_log_error(
+      "failed to create Fully Connected operator with NaN output lower bound: lower bound must be non-NaN");
+    goto error;
+  }
+
+  if (isnan(output_max)) {
+    xnn_log_error(
+      "failed to create Fully Connected operator with NaN output upper bound: upper bound must be non-NaN");
+    goto error;
+  }
+
+  if (output_min >= output_max) {
+    xnn_log_error(
+      "failed to create Fully Connected operator with [%.7g, %.7g] output range: lower bound must be below upper bound",
+      output_min, output_max);
+    goto error;
+  }
+
+  // The quantized kernel range always includes zero, so that zero kernel elements are represented exactly.
+  const size_t kernel_size = output_channels * input_channels;
+  float kernel_min = 0.0f;
+  float kernel_max = 0.0f;
+  for (size_t i = 0; i < kernel_size; i++) {
+    if (!isfinite(kernel[i])) {
+      xnn_log_error(
+        "failed to create Fully Connected operator with %.7g kernel element #%zu: kernel elements must be finite",
+        kernel[i], i);
+      goto error;
+    }
+    kernel_min = math_min_f32(kernel_min, kernel[i]);
+    kernel_max = math_max_f32(kernel_max, kernel[i]);
+  }
+  float kernel_scale = (kernel_max - kernel_min) / 255.0f;
+  if (kernel_scale == 0.0f) {
+    kernel_scale = 1.0f;
+  }
+  const uint8_t kernel_zero_point = (uint8_t) lrintf(-kernel_min / kernel_scale);
+
+  status = xnn_status_out_of_memory;
+
+  fully_connected_op = xnn_allocate_zero_memory(sizeof(struct xnn_operator));
+  if (fully_connected_op == NULL) {
+    xnn_log_error("failed to allocate %zu bytes for Fully Connected operator descriptor", sizeof(struct xnn_operator));
+    goto error;
+  }
+
+  quantized_kernel = xnn_allocate_memory(kernel_size * sizeof(uint8_t));
+  if (quantized_kernel == NULL) {
+    xnn_log_error("failed to allocate %zu bytes for quantized kernel", kernel_size * sizeof(uint8_t));
+    goto error;
+  }
+  for (size_t i = 0; i < kernel_size; i++) {
+    const long quantized_value = lrintf(kernel[i] / kernel_scale) + (long) (uint32_t) kernel_zero_point;
+    quantized_kernel[i] = (uint8_t) (quantized_value < 0 ? 0 : quantized_value > 255 ? 255 : quantized_value);
+  }
+
+  const uint32_t nr = xnn_params.q8dq.gemm.nr;
+  const uint32_t kr = UINT32_C(1) << xnn_params.q8dq.gemm.log2_kr;
+
+  const uint32_t n_stride = round_up(output_channels, nr);
+  const uint32_t k_stride = round_up_po2(input_channels, kr);
+
+  const size_t packed_weights_size = n_stride * (k_stride * sizeof(uint8_t) + sizeof(int32_t) + sizeof(float));
+  fully_connected_op->packed_weights = xnn_allocate_memory(packed_weights_size);
+  if (fully_connected_op->packed_weights == NULL) {
+    xnn_log_error("failed to allocate %zu bytes for packed weights", packed_weights_size);
+    goto error;
+  }
+  memset(fully_connected_op->packed_weights, kernel_zero_point, packed_weights_size);
+
+  // Inputs are quantized symmetrically around the fixed zero point of 128, so the input zero point correction is
+  // folded into the packed weights like for static quantization.
+  xnn_pack_q8dq_gemm_goi_w(
+    1, output_channels, input_channels,
+    nr, kr,
+    128 /* input zero point */, kernel_zero_point,
+    quantized_kernel, bias,
+    fully_connected_op->packed_weights);
+
+  fully_connected_op->group_input_channels = input_channels;
+  fully_connected_op->group_output_channels = output_channels;
+  fully_connected_op->input_pixel_stride = input_stride;
+  fully_connected_op->output_pixel_stride = output_stride;
+
+  fully_connected_op->kernel_zero_point = kernel_zero_point;
+  fully_connected_op->kernel_scale = kernel_scale;
 
+  fully_connected_op->q8dq_gemm_params = xnn_compute_q8dq_gemm_params(kernel_zero_point, output_min, output_max);
 
-enum xnn_status xnn_create_fully_connected_nc_q8(
+  fully_connected_op->type = xnn_operator_type_fully_connected_q8dq;
+
+  fully_connected_op->ukernel.type = xnn_ukernel_type_gemm;
+  fully_connected_op->ukernel.q8dq_gemm = (struct xnn_ukernel_q8dq_gemm) {
+    .function = xnn_params.q8dq.gemm.gemm,
+    .mr = xnn_params.q8dq.gemm.mr,
+    .nr = nr,
+    .kr = kr,
+  };
+
+  fully_connected_op->state = xnn_run_state_invalid;
+
+  xnn_release_memory(quantized_kernel);
+  *fully_connected_op_out = fully_connected_op;
+  return xnn_status_success;
+
+error:
+  xnn_release_memory(quantized_kernel);
+  xnn_delete_operator(fully_connected_op);
+  return status;
+}
+
+enum xnn_status xnn_create_fully_connected_nc_f16(
     size_t input_channels,
     size_t output_channels,
     size_t input_stride,
     size_t output_stride,
-    uint8_t input_zero_point,
-    float input_scale,
-    uint8_t kernel_zero_point,
-    float kernel_scale,
-    const uint8_t* kernel,
-    const int32_t* bias,
-    uint8_t output_zero_point,
-    float output_scale,
-    uint8_t output_min,
-    uint8_t output_max,
+    const void* kernel,
+    const void* bias,
+    float output_min,
+    float output_max,
     uint32_t flags,
     xnn_operator_t* fully_connected_op_out)
 {
@@ -81,46 +577,27 @@ enum xnn_status xnn_create_fully_connected_nc_q8(
     goto error;
   }
 
-  if (input_scale <= 0.0f || !isnormal(input_scale)) {
-    xnn_log_error(
-      "failed to create Fully Connected operator with %.7g input scale: scale must be finite, normalized, and positive",
-      input_scale);
-    goto error;
-  }
-
-  if (kernel_scale <= 0.0f || !isnormal(kernel_scale)) {
+  if (isnan(output_min)) {
     xnn_log_error(
-      "failed to create Fully Connected operator with %.7g kernel scale: scale must be finite, normalized, and positive",
-      kernel_scale);
+      "failed to create Fully Connected operator with NaN output lower bound: lower bound must be non-NaN");
     goto error;
   }
 
-  if (output_scale <= 0.0f || !isnormal(output_scale)) {
+  if (isnan(output_max)) {
     xnn_log_error(
-      "failed to create Fully Connected operator with %.7g output scale: scale must be finite, normalized, and positive",
-      output_scale);
+      "failed to create Fully Connected operator with NaN output upper bound: upper bound must be non-NaN");
     goto error;
   }
 
-  if (output_min >= output_max) {
+  const struct xnn_f16_output_params output_params = xnn_compute_f16_output_params(1.0f, output_min, output_max);
+  if (fp16_ieee_to_fp32_value(output_params.min) >= fp16_ieee_to_fp32_value(output_params.max)) {
     xnn_log_error(
-      "failed to create Fully Connected operator with [%" PRIu8 ", %" PRIu8 "] output range: "
-      "range min must be below range max",
+      "failed to create Fully Connected operator with [%.7g, %.7g] output range: "
+      "lower bound must be below upper bound in half precision",
       output_min, output_max);
     goto error;
   }
 
-  status = xnn_status_unsupported_parameter;
-
-  const float requantization_scale = input_scale * kernel_scale / output_scale;
-  if (requantization_scale >= 1.0f) {
-    xnn_log_error(
-      "failed to create Fully Connected operator with %.7g input scale, %.7g kernel scale, and %.7g output scale: "
-      "requantization scale %.7g is greater or equal to 1.0",
-      input_scale, kernel_scale, output_scale, requantization_scale);
-    goto error;
-  }
-
   status = xnn_status_out_of_memory;
 
   fully_connected_op = xnn_allocate_zero_memory(sizeof(struct xnn_operator));
@@ -129,24 +606,23 @@ enum xnn_status xnn_create_fully_connected_nc_q8(
     goto error;
   }
 
-  const uint32_t nr = xnn_params.q8.gemm.nr;
-  const uint32_t kr = UINT32_C(1) << xnn_params.q8.gemm.log2_kr;
+  const uint32_t nr = xnn_params.f16.gemm.nr;
+  const uint32_t kr = UINT32_C(1) << xnn_params.f16.gemm.log2_kr;
 
   const uint32_t n_stride = round_up(output_channels, nr);
   const uint32_t k_stride = round_up_po2(input_channels, kr);
 
-  fully_connected_op->packed_weights = xnn_allocate_memory(n_stride * (k_stride * sizeof(uint8_t) + sizeof(int32_t)));
+  const size_t packed_weights_size = n_stride * (k_stride * sizeof(uint16_t) + sizeof(uint16_t));
+  fully_connected_op->packed_weights = xnn_allocate_memory(packed_weights_size);
   if (fully_connected_op->packed_weights == NULL) {
-    xnn_log_error("failed to allocate %zu bytes for packed weights",
-      n_stride * (k_stride * sizeof(uint8_t) + sizeof(int32_t)));
+    xnn_log_error("failed to allocate %zu bytes for packed weights", packed_weights_size);
     goto error;
   }
-  memset(fully_connected_op->packed_weights, kernel_zero_point, n_stride * (k_stride * sizeof(uint8_t) + sizeof(int32_t)));
+  memset(fully_connected_op->packed_weights, 0, packed_weights_size);
 
-  xnn_pack_q8_gemm_goi_w(
+  xnn_pack_f16_gemm_goi_w(
     1, output_channels, input_channels,
     nr, kr,
-    input_zero_point, kernel_zero_point,
     kernel, bias,
     fully_connected_op->packed_weights);
 
@@ -155,19 +631,15 @@ enum xnn_status xnn_create_fully_connected_nc_q8(
   fully_connected_op->input_pixel_stride = input_stride;
   fully_connected_op->output_pixel_stride = output_stride;
 
-  fully_connected_op->kernel_zero_point = kernel_zero_point;
-
-  fully_connected_op->q8_gemm_params =
-    xnn_compute_q8_gemm_params(
-      input_zero_point, kernel_zero_point,
-      requantization_scale, output_zero_point, output_min, output_max);
+  fully_connected_op->f16_output_params = output_params;
 
-  fully_connected_op->type = xnn_operator_type_fully_connected_q8;
+  fully_connected_op->type = xnn_operator_type_fully_connected_f16;
 
   fully_connected_op->ukernel.type = xnn_ukernel_type_gemm;
   fully_connected_op->ukernel.gemm = (struct xnn_ukernel_gemm) {
-    .default_function = xnn_params.q8.gemm.gemm,
-    .mr = xnn_params.q8.gemm.mr,
+    .default_function = xnn_params.f16.gemm.gemm,
+    .mr1_function = xnn_params.f16.gemm.gemm1,
+    .mr = xnn_params.f16.gemm.mr,
     .nr = nr,
     .kr = kr,
   };
@@ -182,13 +654,15 @@ error:
   return status;
 }
 
-enum xnn_status xnn_create_fully_connected_nc_f32(
+static enum xnn_status create_fully_connected_nc_f32(
     size_t input_channels,
     size_t output_channels,
     size_t input_stride,
     size_t output_stride,
     const float* kernel,
     const float* bias,
+    const void* packed_weights_blob,
+    size_t packed_weights_blob_size,
     float output_min,
     float output_max,
     uint32_t flags,
@@ -253,33 +727,29 @@ enum xnn_status xnn_create_fully_connected_nc_f32(
     goto error;
   }
 
-  status = xnn_status_out_of_memory;
-
-  fully_connected_op = xnn_allocate_zero_memory(sizeof(struct xnn_operator));
-  if (fully_connected_op == NULL) {
-    xnn_log_error("failed to allocate %zu bytes for Fully Connected operator descriptor", sizeof(struct xnn_operator));
+  if ((flags & XNN_FLAG_FP16_WEIGHTS) && (flags & XNN_FLAG_INT8_WEIGHTS)) {
+    xnn_log_error(
+      "failed to create Fully Connected operator with both FP16 and INT8 weights flags: flags are mutually exclusive");
     goto error;
   }
 
-  const uint32_t nr = xnn_params.f32.gemm.nr;
-  const uint32_t kr = UINT32_C(1) << xnn_params.f32.gemm.log2_kr;
+  if ((flags & XNN_FLAG_INT8_WEIGHTS) && kernel != NULL) {
+    for (size_t i = 0; i < output_channels * input_channels; i++) {
+      if (!isfinite(kernel[i])) {
+        xnn_log_error(
+          "failed to create Fully Connected operator with INT8 weights: kernel element #%zu is not finite", i);
+        goto error;
+      }
+    }
+  }
 
-  const uint32_t n_stride = round_up(output_channels, nr);
-  const uint32_t k_stride = round_up_po2(input_channels, kr);
+  status = xnn_status_out_of_memory;
 
-  fully_connected_op->packed_weights = xnn_allocate_memory(n_stride * (k_stride * sizeof(float) + sizeof(float)));
-  if (fully_connected_op->packed_weights == NULL) {
-    xnn_log_error("failed to allocate %zu bytes for packed weights",
-      n_stride * (k_stride * sizeof(float) + sizeof(float)));
+  fully_connected_op = xnn_allocate_zero_memory(sizeof(struct xnn_operator));
+  if (fully_connected_op == NULL) {
+    xnn_log_error("failed to allocate %zu bytes for Fully Connected operator descriptor", sizeof(struct xnn_operator));
     goto error;
   }
-  memset(fully_connected_op->packed_weights, 0, n_stride * (k_stride * sizeof(float) + sizeof(float)));
-
-  xnn_pack_f32_gemm_goi_w(
-    1, output_channels, input_channels,
-    nr, kr, 1 /* sr */,
-    kernel, bias,
-    fully_connected_op->packed_weights);
 
   fully_connected_op->group_input_channels = input_channels;
   fully_connected_op->group_output_channels = output_channels;
@@ -290,14 +760,109 @@ enum xnn_status xnn_create_fully_connected_nc_f32(
 
   fully_connected_op->type = xnn_operator_type_fully_connected_f32;
 
-  fully_connected_op->ukernel.type = xnn_ukernel_type_gemm;
-  fully_connected_op->ukernel.gemm = (struct xnn_ukernel_gemm) {
-    .default_function = xnn_params.f32.gemm.gemm,
-    .mr1_function = xnn_params.f32.gemm.gemm1,
-    .mr = xnn_params.f32.gemm.mr,
-    .nr = nr,
-    .kr = kr,
-  };
+  // Pruned kernels are packed into sparse representation and multiplied with SpMM micro-kernels, unless the weights
+  // come from a serialized blob or use a compressed type.
+  if (kernel != NULL && (flags & (XNN_FLAG_FP16_WEIGHTS | XNN_FLAG_INT8_WEIGHTS | XNN_FLAG_DISABLE_SPARSE_WEIGHTS)) == 0) {
+    status = xnn_init_operator_sparse_weights(
+      fully_connected_op, 1 /* groups */, output_channels, input_channels, kernel, bias);
+    if (status != xnn_status_success) {
+      goto error;
+    }
+  }
+
+  if (fully_connected_op->ukernel.type != xnn_ukernel_type_spmm) {
+    // Compressed weights are consumed only by GEMM micro-kernels, with per-channel bias (and scale for INT8 weights)
+    // stored next to the weights of each NR block.
+    enum xnn_weights_type weights_type = xnn_weights_type_f32;
+    const struct gemm_parameters* gemm_parameters = &xnn_params.f32.gemm;
+    size_t filter_element_size = sizeof(float);
+    size_t bias_element_size = sizeof(float);
+    if (flags & XNN_FLAG_FP16_WEIGHTS) {
+      weights_type = xnn_weights_type_f16;
+      gemm_parameters = &xnn_params.f32.gemm_f16w;
+      filter_element_size = sizeof(uint16_t);
+    } else if (flags & XNN_FLAG_INT8_WEIGHTS) {
+      weights_type = xnn_weights_type_qc8;
+      gemm_parameters = &xnn_params.f32.gemm_qc8w;
+      filter_element_size = sizeof(int8_t);
+      bias_element_size = sizeof(float) + sizeof(float);
+    }
+
+    const uint32_t nr = gemm_parameters->nr;
+    const uint32_t kr = UINT32_C(1) << gemm_parameters->log2_kr;
+
+    const uint32_t n_stride = round_up(output_channels, nr);
+    const uint32_t k_stride = round_up_po2(input_channels, kr);
+    const size_t packed_weights_size = n_stride * (k_stride * filter_element_size + bias_element_size);
+
+    const struct xnn_packed_weights_header packed_weights_header = {
+      .operator_type = xnn_operator_type_fully_connected_f32,
+      .ukernel_type = xnn_ukernel_type_gemm,
+      .nr = nr,
+      .kr = kr,
+      .sr = 1,
+      .groups = 1,
+      .kernel_height = 1,
+      .kernel_width = 1,
+      .group_input_channels = input_channels,
+      .group_output_channels = output_channels,
+      .weights_type = weights_type,
+      .weights_size = packed_weights_size,
+    };
+    status = xnn_init_operator_packed_weights(
+      fully_connected_op, &packed_weights_header, packed_weights_blob, packed_weights_blob_size);
+    if (status != xnn_status_success) {
+      goto error;
+    }
+
+    if (!fully_connected_op->packed_weights_external) {
+      memset(fully_connected_op->packed_weights, 0, packed_weights_size);
+      switch (weights_type) {
+        case xnn_weights_type_f16:
+          xnn_pack_f32_f16w_gemm_goi_w(
+            1, output_channels, input_channels, nr,
+            kernel, bias,
+            fully_connected_op->packed_weights);
+          break;
+        case xnn_weights_type_qc8:
+          xnn_pack_f32_qc8w_gemm_goi_w(
+            1, output_channels, input_channels, nr,
+            kernel, bias,
+            fully_connected_op->packed_weights);
+          break;
+        default:
+          xnn_pack_f32_gemm_goi_w(
+            1, output_channels, input_channels,
+            nr, kr, 1 /* sr */,
+            kernel, bias,
+            fully_connected_op->packed_weights);
+          break;
+      }
+    }
+    fully_connected_op->weights_type = weights_type;
+
+    // PPMM, split-K, and cache-blocked execution need micro-kernels for uncompressed weights; compressed weights are
+    // always processed with the plain GEMM micro-kernels.
+    fully_connected_op->ukernel.type = xnn_ukernel_type_gemm;
+    fully_connected_op->ukernel.gemm = (struct xnn_ukernel_gemm) {
+      .default_function = gemm_parameters->gemm,
+      .mr1_function = gemm_parameters->gemm1,
+      .inc_function = gemm_parameters->gemminc,
+      .mr1_inc_function = gemm_parameters->gemminc1,
+      .mr = gemm_parameters->mr,
+      .nr = nr,
+      .kr = kr,
+    };
+    if (weights_type == xnn_weights_type_f32 &&
+        xnn_params.f32.ppmm.ppmm != NULL && xnn_params.f32.ppmm.nr == nr && kr == 1)
+    {
+      fully_connected_op->ukernel.gemm.ppmm = (struct xnn_ukernel_ppmm) {
+        .function = xnn_params.f32.ppmm.ppmm,
+        .packx_function = xnn_params.f32.ppmm.packx,
+        .mr = xnn_params.f32.ppmm.mr,
+      };
+    }
+  }
 
   fully_connected_op->state = xnn_run_state_invalid;
 
@@ -309,6 +874,55 @@ error:
   return status;
 }
 
+enum xnn_status xnn_create_fully_connected_nc_f32(
+    size_t input_channels,
+    size_t output_channels,
+    size_t input_stride,
+    size_t output_stride,
+    const float* kernel,
+    const float* bias,
+    float output_min,
+    float output_max,
+    uint32_t flags,
+    xnn_operator_t* fully_connected_op_out)
+{
+  return create_fully_connected_nc_f32(
+    input_channels, output_channels,
+    input_stride, output_stride,
+    kernel, bias,
+    NULL /* packed weights */, 0 /* packed weights size */,
+    output_min, output_max,
+    flags,
+    fully_connected_op_out);
+}
+
+enum xnn_status xnn_create_fully_connected_nc_f32_from_packed_weights(
+    size_t input_channels,
+    size_t output_channels,
+    size_t input_stride,
+    size_t output_stride,
+    const void* packed_weights,
+    size_t packed_weights_size,
+    float output_min,
+    float output_max,
+    uint32_t flags,
+    xnn_operator_t* fully_connected_op_out)
+{
+  if (packed_weights == NULL) {
+    xnn_log_error("failed to create Fully Connected operator from packed weights: packed weights must be non-NULL");
+    return xnn_status_invalid_parameter;
+  }
+
+  return create_fully_connected_nc_f32(
+    input_channels, output_channels,
+    input_stride, output_stride,
+    NULL /* kernel */, NULL /* bias */,
+    packed_weights, packed_weights_size,
+    output_min, output_max,
+    flags,
+    fully_connected_op_out);
+}
+
 static enum xnn_status setup_fully_connected_nc(
   xnn_operator_t fully_connected_op,
   size_t batch_size,
@@ -345,44 +959,270 @@ static enum xnn_status setup_fully_connected_nc(
   const size_t input_channels = fully_connected_op->group_input_channels;
   const size_t output_channels = fully_connected_op->group_output_channels;
 
+  if (fully_connected_op->ukernel.type == xnn_ukernel_type_spmm) {
+    // Transpose MR-row blocks of the input into panels for the SpMM micro-kernel, and the results back into rows.
+    const size_t mr = fully_connected_op->ukernel.spmm.mr;
+    const size_t workspace_stride = mr * (input_channels + output_channels) << log2_output_element_size;
+    const size_t packed_input_size = divide_round_up(batch_size, mr) * workspace_stride + XNN_EXTRA_BYTES;
+    if (packed_input_size > fully_connected_op->packed_input_size) {
+      xnn_release_memory(fully_connected_op->packed_input);
+      fully_connected_op->packed_input_size = 0;
+      fully_connected_op->packed_input = xnn_allocate_memory(packed_input_size);
+      if (fully_connected_op->packed_input == NULL) {
+        xnn_log_error("failed to allocate %zu bytes for transposed input and output", packed_input_size);
+        return xnn_status_out_of_memory;
+      }
+      fully_connected_op->packed_input_size = packed_input_size;
+    }
+
+    const float* nonzero_values = fully_connected_op->packed_weights;
+    const int32_t* input_increments =
+      (const int32_t*) (nonzero_values + fully_connected_op->num_nonzero_values + output_channels);
+    const uint32_t* output_channel_nonzeros =
+      (const uint32_t*) (input_increments + fully_connected_op->num_nonzero_blocks);
+    fully_connected_op->context.nhwc_spmm = (struct nhwc_spmm_context) {
+      .k = input_channels,
+      .n = output_channels,
+      .a = input,
+      .a_stride = fully_connected_op->input_pixel_stride << log2_input_element_size,
+      .packed_weights = nonzero_values,
+      .input_increments = input_increments,
+      .output_channel_nonzeros = output_channel_nonzeros,
+      .first_input_channel = fully_connected_op->first_input_channel,
+      .c = output,
+      .c_stride = fully_connected_op->output_pixel_stride << log2_output_element_size,
+      .workspace = fully_connected_op->packed_input,
+      .workspace_stride = workspace_stride,
+      .mr = mr,
+      .ukernel = fully_connected_op->ukernel.spmm.function,
+    };
+    memcpy(&fully_connected_op->context.nhwc_spmm.params, params, sizeof(fully_connected_op->context.nhwc_spmm.params));
+
+    fully_connected_op->compute.type = xnn_parallelization_type_1d_tile_1d;
+    fully_connected_op->compute.task_1d_tile_1d = (pthreadpool_task_1d_tile_1d_t) xnn_compute_nhwc_spmm;
+    fully_connected_op->compute.range[0] = batch_size;
+    fully_connected_op->compute.tile[0] = mr;
+    fully_connected_op->compute2.type = xnn_parallelization_type_invalid;
+    fully_connected_op->state = xnn_run_state_ready;
+
+    return xnn_status_success;
+  }
+
   uint32_t mr = fully_connected_op->ukernel.gemm.mr;
   const uint32_t nr = fully_connected_op->ukernel.gemm.nr;
 
-  xnn_gemm_ukernel_function gemm_ukernel = fully_connected_op->ukernel.gemm.default_function;
-  if (batch_size == 1 && fully_connected_op->ukernel.gemm.mr1_function != NULL) {
-    gemm_ukernel = fully_connected_op->ukernel.gemm.mr1_function;
-    mr = 1;
-  }
+  const struct xnn_ukernel_ppmm* ppmm = &fully_connected_op->ukernel.gemm.ppmm;
+  const bool use_ppmm = ppmm->function != NULL && batch_size >= XNN_PPMM_MIN_BATCH_SIZE;
+  // Split K across threads when M is too small to give every thread work on separate rows.
+  const bool use_splitk = !use_ppmm && fully_connected_op->ukernel.gemm.inc_function != NULL &&
+    num_threads > 1 && batch_size <= mr && input_channels >= 2 * XNN_SPLITK_MIN_K_SLICE &&
+    xnn_params.f32.vadd.op_ukernel != NULL;
+  // Block K and N to keep panels of packed weights in cache when they don't fit into L2 cache.
+  const struct gemm_blocking_parameters* blocking = &xnn_params.f32.gemm_blocking;
+  const bool use_blocking = !use_ppmm && !use_splitk && fully_connected_op->ukernel.gemm.inc_function != NULL &&
+    blocking->kc != 0 && batch_size > mr && input_channels > blocking->kc &&
+    output_channels * (input_channels << log2_filter_element_size) > blocking->min_weights_size;
+  size_t num_slices = 1;
+  if (use_ppmm) {
+    // Pack A once into MR-row panels, then stream the panels through the PPMM micro-kernel for every NR block.
+    mr = ppmm->mr;
+    const size_t packed_input_size = round_up(batch_size, mr) * (input_channels << log2_input_element_size);
+    if (packed_input_size > fully_connected_op->packed_input_size) {
+      xnn_release_memory(fully_connected_op->packed_input);
+      fully_connected_op->packed_input_size = 0;
+      fully_connected_op->packed_input = xnn_allocate_memory(packed_input_size);
+      if (fully_connected_op->packed_input == NULL) {
+        xnn_log_error("failed to allocate %zu bytes for packed input", packed_input_size);
+        return xnn_status_out_of_memory;
+      }
+      fully_connected_op->packed_input_size = packed_input_size;
+    }
 
-  fully_connected_op->context.gemm = (struct gemm_context) {
-    .k_scaled = input_channels << log2_input_element_size,
-    .w_stride = (round_up_po2(input_channels, fully_connected_op->ukernel.gemm.kr) << log2_input_element_size) + bias_element_size,
-    .a = input,
-    .a_stride = fully_connected_op->input_pixel_stride << log2_input_element_size,
-    .packed_w = fully_connected_op->packed_weights,
-    .c = output,
-    .cm_stride = fully_connected_op->output_pixel_stride << log2_output_element_size,
-    .cn_stride = nr << log2_output_element_size,
-    .log2_csize = log2_output_element_size,
-    .ukernel = gemm_ukernel,
-  };
-  memcpy(&fully_connected_op->context.gemm.params, params, sizeof(fully_connected_op->context.gemm.params));
+    fully_connected_op->context.ppmm = (struct ppmm_context) {
+      .k = input_channels,
+      .k_scaled = input_channels << log2_input_element_size,
+      .a = input,
+      .a_stride = fully_connected_op->input_pixel_stride << log2_input_element_size,
+      .packed_a = fully_connected_op->packed_input,
+      .packed_w = fully_connected_op->packed_weights,
+      .w_stride = (input_channels << log2_filter_element_size) + bias_element_size,
+      .c = output,
+      .cm_stride = fully_connected_op->output_pixel_stride << log2_output_element_size,
+      .cn_stride = nr << log2_output_element_size,
+      .log2_csize = log2_output_element_size,
+      .packx_ukernel = ppmm->packx_function,
+      .ppmm_ukernel = ppmm->function,
+    };
+    memcpy(&fully_connected_op->context.ppmm.params, params, sizeof(fully_connected_op->context.ppmm.params));
+  } else if (use_splitk) {
+    xnn_gemm_ukernel_function gemm_ukernel = fully_connected_op->ukernel.gemm.default_function;
+    xnn_gemminc_ukernel_function gemminc_ukernel = fully_connected_op->ukernel.gemm.inc_function;
+    if (batch_size == 1 && fully_connected_op->ukernel.gemm.mr1_function != NULL &&
+        fully_connected_op->ukernel.gemm.mr1_inc_function != NULL)
+    {
+      gemm_ukernel = fully_connected_op->ukernel.gemm.mr1_function;
+      gemminc_ukernel = fully_connected_op->ukernel.gemm.mr1_inc_function;
+    }
+
+    const uint32_t kr = fully_connected_op->ukernel.gemm.kr;
+    num_slices = min(num_threads, input_channels / XNN_SPLITK_MIN_K_SLICE);
+    const size_t k_slice = round_up_po2(divide_round_up(input_channels, num_slices), kr);
+    num_slices = divide_round_up(input_channels, k_slice);
+
+    const size_t zero_acc_size = mr * nr << log2_output_element_size;
+    const size_t partial_output_size = zero_acc_size + (num_slices - 1) * batch_size * (output_channels << log2_output_element_size);
+    if (partial_output_size > fully_connected_op->partial_output_size) {
+      xnn_release_memory(fully_connected_op->partial_output);
+      fully_connected_op->partial_output_size = 0;
+      fully_connected_op->partial_output = xnn_allocate_memory(partial_output_size);
+      if (fully_connected_op->partial_output == NULL) {
+        xnn_log_error("failed to allocate %zu bytes for partial output", partial_output_size);
+        return xnn_status_out_of_memory;
+      }
+      fully_connected_op->partial_output_size = partial_output_size;
+    }
+    memset(fully_connected_op->partial_output, 0, zero_acc_size);
+
+    fully_connected_op->context.splitk_gemm = (struct splitk_gemm_context) {
+      .m = batch_size,
+      .k_scaled = input_channels << log2_input_element_size,
+      .a_slice_stride = k_slice << log2_input_element_size,
+      .w_slice_stride = (k_slice << log2_filter_element_size) * nr,
+      .w_bias_stride = bias_element_size * nr,
+      .a = input,
+      .a_stride = fully_connected_op->input_pixel_stride << log2_input_element_size,
+      .packed_w = fully_connected_op->packed_weights,
+      .w_stride = (round_up_po2(input_channels, kr) << log2_filter_element_size) + bias_element_size,
+      .c = output,
+      .cm_stride = fully_connected_op->output_pixel_stride << log2_output_element_size,
+      .partial_c = (void*) ((uintptr_t) fully_connected_op->partial_output + zero_acc_size),
+      .partial_cm_stride = output_channels << log2_output_element_size,
+      .partial_cs_stride = batch_size * (output_channels << log2_output_element_size),
+      .num_slices = num_slices,
+      .zero_acc = fully_connected_op->partial_output,
+      .nr = nr,
+      .cn_stride = nr << log2_output_element_size,
+      .log2_csize = log2_output_element_size,
+      .gemm_ukernel = gemm_ukernel,
+      .gemminc_ukernel = gemminc_ukernel,
+      .vadd_ukernel = xnn_params.f32.vadd.op_ukernel,
+      .params.f32 = xnn_compute_f32_output_params(-INFINITY, +INFINITY),
+    };
+    memcpy(&fully_connected_op->context.splitk_gemm.output_params, params, sizeof(fully_connected_op->context.splitk_gemm.output_params));
+  } else if (use_blocking) {
+    const size_t acc_tile_size = mr * nr << log2_output_element_size;
+    const size_t acc_size = divide_round_up(batch_size, mr) * divide_round_up(output_channels, nr) * acc_tile_size;
+    if (acc_size > fully_connected_op->partial_output_size) {
+      xnn_release_memory(fully_connected_op->partial_output);
+      fully_connected_op->partial_output_size = 0;
+      fully_connected_op->partial_output = xnn_allocate_memory(acc_size);
+      if (fully_connected_op->partial_output == NULL) {
+        xnn_log_error("failed to allocate %zu bytes for partial output", acc_size);
+        return xnn_status_out_of_memory;
+      }
+      fully_connected_op->partial_output_size = acc_size;
+    }
+
+    fully_connected_op->context.blocked_gemm = (struct blocked_gemm_context) {
+      .k_scaled = input_channels << log2_input_element_size,
+      .kc_scaled = blocking->kc << log2_input_element_size,
+      .a = input,
+      .a_stride = fully_connected_op->input_pixel_stride << log2_input_element_size,
+      .packed_w = fully_connected_op->packed_weights,
+      .w_stride = (round_up_po2(input_channels, fully_connected_op->ukernel.gemm.kr) << log2_filter_element_size) + bias_element_size,
+      .w_bias_stride = bias_element_size * nr,
+      .c = output,
+      .cm_stride = fully_connected_op->output_pixel_stride << log2_output_element_size,
+      .cn_stride = nr << log2_output_element_size,
+      .acc_c = fully_connected_op->partial_output,
+      .acc_m_stride = divide_round_up(output_channels, nr) * acc_tile_size,
+      .acc_n_stride = acc_tile_size,
+      .mr = mr,
+      .nr = nr,
+      .log2_csize = log2_output_element_size,
+      .gemm_ukernel = fully_connected_op->ukernel.gemm.default_function,
+      .gemminc_ukernel = fully_connected_op->ukernel.gemm.inc_function,
+      .params.f32 = xnn_compute_f32_output_params(-INFINITY, +INFINITY),
+    };
+    memcpy(&fully_connected_op->context.blocked_gemm.output_params, params, sizeof(fully_connected_op->context.blocked_gemm.output_params));
+  } else {
+    xnn_gemm_ukernel_function gemm_ukernel = fully_connected_op->ukernel.gemm.default_function;
+    if (batch_size == 1 && fully_connected_op->ukernel.gemm.mr1_function != NULL) {
+      gemm_ukernel = fully_connected_op->ukernel.gemm.mr1_function;
+      mr = 1;
+    }
+
+    fully_connected_op->context.gemm = (struct gemm_context) {
+      .k_scaled = input_channels << log2_input_element_size,
+      .w_stride = (round_up_po2(input_channels, fully_connected_op->ukernel.gemm.kr) << log2_filter_element_size) + bias_element_size,
+      .a = input,
+      .a_stride = fully_connected_op->input_pixel_stride << log2_input_element_size,
+      .packed_w = fully_connected_op->packed_weights,
+      .c = output,
+      .cm_stride = fully_connected_op->output_pixel_stride << log2_output_element_size,
+      .cn_stride = nr << log2_output_element_size,
+      .log2_csize = log2_output_element_size,
+      .ukernel = gemm_ukernel,
+    };
+    memcpy(&fully_connected_op->context.gemm.params, params, sizeof(fully_connected_op->context.gemm.params));
+  }
 
   size_t nc = output_channels;
-  if (num_threads > 1) {
-    const size_t num_other_tiles = divide_round_up(batch_size, mr);
+  if (use_blocking) {
+    nc = min(nc, blocking->nc);
+    if (num_threads > 1) {
+      // Split N into smaller blocks if there are not enough blocks to keep all threads busy.
+      const size_t num_mc_blocks = divide_round_up(batch_size, blocking->mc);
+      const size_t max_nc = round_up(divide_round_up(output_channels * num_mc_blocks, num_threads), nr);
+      nc = min(nc, max_nc);
+    }
+  } else if (num_threads > 1) {
+    const size_t num_other_tiles = num_slices * divide_round_up(batch_size, mr);
     const size_t target_tiles_per_thread = 5;
     const size_t max_nc = divide_round_up(output_channels * num_other_tiles, num_threads * target_tiles_per_thread);
     if (max_nc < nc) {
       nc = min(nc, divide_round_up(nc, max_nc * nr) * nr);
     }
   }
-  fully_connected_op->compute.type = xnn_parallelization_type_2d_tile_2d;
-  fully_connected_op->compute.task_2d_tile_2d = (pthreadpool_task_2d_tile_2d_t) xnn_compute_gemm;
-  fully_connected_op->compute.range[0] = batch_size;
-  fully_connected_op->compute.range[1] = output_channels;
-  fully_connected_op->compute.tile[0] = mr;
-  fully_connected_op->compute.tile[1] = nc;
+  if (use_ppmm) {
+    fully_connected_op->compute.type = xnn_parallelization_type_1d_tile_1d;
+    fully_connected_op->compute.task_1d_tile_1d = (pthreadpool_task_1d_tile_1d_t) xnn_compute_packx;
+    fully_connected_op->compute.range[0] = batch_size;
+    fully_connected_op->compute.tile[0] = mr;
+    fully_connected_op->compute2.type = xnn_parallelization_type_2d_tile_2d;
+    fully_connected_op->compute2.task_2d_tile_2d = (pthreadpool_task_2d_tile_2d_t) xnn_compute_ppmm;
+    fully_connected_op->compute2.range[0] = batch_size;
+    fully_connected_op->compute2.range[1] = output_channels;
+    fully_connected_op->compute2.tile[0] = mr;
+    fully_connected_op->compute2.tile[1] = nc;
+  } else if (use_splitk) {
+    fully_connected_op->compute.type = xnn_parallelization_type_2d_tile_1d;
+    fully_connected_op->compute.task_2d_tile_1d = (pthreadpool_task_2d_tile_1d_t) xnn_compute_splitk_gemm;
+    fully_connected_op->compute.range[0] = num_slices;
+    fully_connected_op->compute.range[1] = output_channels;
+    fully_connected_op->compute.tile[0] = nc;
+    fully_connected_op->compute2.type = xnn_parallelization_type_2d_tile_1d;
+    fully_connected_op->compute2.task_2d_tile_1d = (pthreadpool_task_2d_tile_1d_t) xnn_compute_splitk_reduce;
+    fully_connected_op->compute2.range[0] = batch_size;
+    fully_connected_op->compute2.range[1] = output_channels;
+    fully_connected_op->compute2.tile[0] = nc;
+  } else if (use_blocking) {
+    fully_connected_op->compute.type = xnn_parallelization_type_2d_tile_2d;
+    fully_connected_op->compute.task_2d_tile_2d = (pthreadpool_task_2d_tile_2d_t) xnn_compute_blocked_gemm;
+    fully_connected_op->compute.range[0] = batch_size;
+    fully_connected_op->compute.range[1] = output_channels;
+    fully_connected_op->compute.tile[0] = blocking->mc;
+    fully_connected_op->compute.tile[1] = nc;
+    fully_connected_op->compute2.type = xnn_parallelization_type_invalid;
+  } else {
+    fully_connected_op->compute.type = xnn_parallelization_type_2d_tile_2d;
+    fully_connected_op->compute.task_2d_tile_2d = (pthreadpool_task_2d_tile_2d_t) xnn_compute_gemm;
+    fully_connected_op->compute.range[0] = batch_size;
+    fully_connected_op->compute.range[1] = output_channels;
+    fully_connected_op->compute.tile[0] = mr;
+    fully_connected_op->compute.tile[1] = nc;
+    fully_connected_op->compute2.type = xnn_parallelization_type_invalid;
+  }
   fully_connected_op->state = xnn_run_state_ready;
 
   return xnn_status_success;
@@ -412,6 +1252,54 @@ enum xnn_status xnn_setup_fully_connected_nc_q8(
     pthreadpool_get_threads_count(threadpool));
 }
 
+enum xnn_status xnn_setup_fully_connected_nc_q8c(
+    xnn_operator_t fully_connected_op,
+    size_t batch_size,
+    const uint8_t* input,
+    uint8_t* output,
+    pthreadpool_t threadpool)
+{
+  if (fully_connected_op->type != xnn_operator_type_fully_connected_q8c) {
+    xnn_log_error("failed to setup Fully Connected (Q8, per-channel) operator: operator type mismatch");
+    return xnn_status_invalid_parameter;
+  }
+
+  return setup_fully_connected_nc(
+    fully_connected_op,
+    batch_size,
+    input, output,
+    0 /* log2(sizeof(input element)) = log2(sizeof(uint8_t)) */,
+    0 /* log2(sizeof(filter element)) = log2(sizeof(uint8_t)) */,
+    sizeof(int32_t) + sizeof(float) /* sizeof(bias element) + sizeof(requantization scale) */,
+    0 /* log2(sizeof(output element)) = log2(sizeof(uint8_t)) */,
+    &fully_connected_op->q8c_gemm_params,
+    pthreadpool_get_threads_count(threadpool));
+}
+
+enum xnn_status xnn_setup_fully_connected_nc_f16(
+    xnn_operator_t fully_connected_op,
+    size_t batch_size,
+    const void* input,
+    void* output,
+    pthreadpool_t threadpool)
+{
+  if (fully_connected_op->type != xnn_operator_type_fully_connected_f16) {
+    xnn_log_error("failed to setup Fully Connected (F16) operator: operator type mismatch");
+    return xnn_status_invalid_parameter;
+  }
+
+  return setup_fully_connected_nc(
+    fully_connected_op,
+    batch_size,
+    input, output,
+    1 /* log2(sizeof(input element)) = log2(sizeof(uint16_t)) */,
+    1 /* log2(sizeof(filter element)) = log2(sizeof(uint16_t)) */,
+    sizeof(uint16_t) /* sizeof(bias element) */,
+    1 /* log2(sizeof(output element)) = log2(sizeof(uint16_t)) */,
+    &fully_connected_op->f16_output_params,
+    pthreadpool_get_threads_count(threadpool));
+}
+
 enum xnn_status xnn_setup_fully_connected_nc_f32(
     xnn_operator_t fully_connected_op,
     size_t batch_size,
@@ -424,14 +1312,122 @@ enum xnn_status xnn_setup_fully_connected_nc_f32(
     return xnn_status_invalid_parameter;
   }
 
+  uint32_t log2_filter_element_size = 2 /* log2(sizeof(float)) */;
+  uint32_t bias_element_size = sizeof(float);
+  switch (fully_connected_op->weights_type) {
+    case xnn_weights_type_f16:
+      log2_filter_element_size = 1 /* log2(sizeof(uint16_t)) */;
+      break;
+    case xnn_weights_type_qc8:
+      log2_filter_element_size = 0 /* log2(sizeof(int8_t)) */;
+      bias_element_size = sizeof(float) + sizeof(float) /* sizeof(bias element) + sizeof(dequantization scale) */;
+      break;
+    default:
+      break;
+  }
+
   return setup_fully_connected_nc(
     fully_connected_op,
     batch_size,
     input, output,
     2 /* log2(sizeof(input element)) = log2(sizeof(float)) */,
-    2 /* log2(sizeof(filter element)) = log2(sizeof(float)) */,
-    sizeof(float) /* sizeof(bias element) */,
+    log2_filter_element_size,
+    bias_element_size,
     2 /* log2(sizeof(output element)) = log2(sizeof(float)) */,
     &fully_connected_op->f32_output_params,
     pthreadpool_get_threads_count(threadpool));
 }
+
+enum xnn_status xnn_setup_fully_connected_nc_q8dq(
+    xnn_operator_t fully_connected_op,
+    size_t batch_size,
+    const float* input,
+    float* output,
+    pthreadpool_t threadpool)
+{
+  if (fully_connected_op->type != xnn_operator_type_fully_connected_q8dq) {
+    xnn_log_error("failed to setup Fully Connected (Q8, dynamic) operator: operator type mismatch");
+    return xnn_status_invalid_parameter;
+  }
+  fully_connected_op->state = xnn_run_state_invalid;
+
+  if (!xnn_params.initialized) {
+    xnn_log_error("failed to setup Fully Connected operator: XNNPACK is not initialized");
+    return xnn_status_uninitialized;
+  }
+
+  if (batch_size == 0) {
+    fully_connected_op->state = xnn_run_state_skip;
+    return xnn_status_success;
+  }
+
+  fully_connected_op->batch_size = 1;
+  fully_connected_op->input_height = batch_size;
+  fully_connected_op->input_width = 1;
+  fully_connected_op->input = input;
+
+  fully_connected_op->output_height = batch_size;
+  fully_connected_op->output_width = 1;
+  fully_connected_op->output = output;
+
+  const size_t input_channels = fully_connected_op->group_input_channels;
+  const size_t output_channels = fully_connected_op->group_output_channels;
+  const uint32_t mr = fully_connected_op->ukernel.q8dq_gemm.mr;
+  const uint32_t nr = fully_connected_op->ukernel.q8dq_gemm.nr;
+
+  // Quantized input rows are followed by their dequantization scales.
+  const size_t quantized_input_size = round_up_po2(batch_size * input_channels + XNN_EXTRA_BYTES, sizeof(float));
+  const size_t packed_input_size = quantized_input_size + batch_size * sizeof(float);
+  if (packed_input_size > fully_connected_op->packed_input_size) {
+    xnn_release_memory(fully_connected_op->packed_input);
+    fully_connected_op->packed_input_size = 0;
+    fully_connected_op->packed_input = xnn_allocate_memory(packed_input_size);
+    if (fully_connected_op->packed_input == NULL) {
+      xnn_log_error("failed to allocate %zu bytes for packed input", packed_input_size);
+      return xnn_status_out_of_memory;
+    }
+    fully_connected_op->packed_input_size = packed_input_size;
+  }
+
+  fully_connected_op->context.dqgemm = (struct dqgemm_context) {
+    .k = input_channels,
+    .a = input,
+    .a_stride = fully_connected_op->input_pixel_stride * sizeof(float),
+    .quantized_a = fully_connected_op->packed_input,
+    .scale = (float*) ((uintptr_t) fully_connected_op->packed_input + quantized_input_size),
+    .kernel_scale = fully_connected_op->kernel_scale,
+    .packed_w = fully_connected_op->packed_weights,
+    .w_stride = round_up_po2(input_channels, fully_connected_op->ukernel.q8dq_gemm.kr) * sizeof(uint8_t) +
+      sizeof(int32_t) + sizeof(float),
+    .c = output,
+    .cm_stride = fully_connected_op->output_pixel_stride * sizeof(float),
+    .cn_stride = nr * sizeof(float),
+    .rabsmax_ukernel = xnn_params.q8dq.rabsmax,
+    .vquantize_ukernel = xnn_params.q8dq.vquantize,
+    .ukernel = fully_connected_op->ukernel.q8dq_gemm.function,
+    .params = fully_connected_op->q8dq_gemm_params,
+  };
+
+  size_t nc = output_channels;
+  const size_t num_threads = pthreadpool_get_threads_count(threadpool);
+  if (num_threads > 1) {
+    const size_t num_other_tiles = divide_round_up(batch_size, mr);
+    const size_t target_tiles_per_thread = 5;
+    const size_t max_nc = divide_round_up(output_channels * num_other_tiles, num_threads * target_tiles_per_thread);
+    if (max_nc < nc) {
+      nc = min(nc, divide_round_up(nc, max_nc * nr) * nr);
+    }
+  }
+  fully_connected_op->compute.type = xnn_parallelization_type_1d;
+  fully_connected_op->compute.task_1d = (pthreadpool_task_1d_t) xnn_compute_dqgemm_quantize;
+  fully_connected_op->compute.range[0] = batch_size;
+  fully_connected_op->compute2.type = xnn_parallelization_type_2d_tile_2d;
+  fully_connected_op->compute2.task_2d_tile_2d = (pthreadpool_task_2d_tile_2d_t) xnn_compute_dqgemm;
+  fully_connected_op->compute2.range[0] = batch_size;
+  fully_connected_op->compute2.range[1] = output_channels;
+  fully_connected_op->compute2.tile[0] = mr;
+  fully_connected_op->compute2.tile[1] = nc;
+  fully_connected_op->state = xnn_run_state_ready;
+
+  return xnn_status_success;
+}
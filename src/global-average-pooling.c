@@ -12,6 +12,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include <fp16.h>
+
 #include <xnnpack.h>
 #include <xnnpack/allocator.h>
 #include <xnnpack/operator.h>
@@ -140,6 +142,104 @@ error:
   return status;
 }
 
+enum xnn_status xnn_create_global_average_pooling_nwc_f16(
+    size_t channels,
+    size_t input_stride,
+    size_t output_stride,
+    float output_min,
+    float output_max,
+    uint32_t flags,
+    xnn_operator_t* global_average_pooling_op_out)
+{
+  xnn_operator_t global_average_pooling_op = NULL;
+  enum xnn_status status = xnn_status_uninitialized;
+
+  if (!xnn_params.initialized) {
+    xnn_log_error("failed to create Global Average Pooling operator: XNNPACK is not initialized");
+    goto error;
+  }
+
+  status = xnn_status_invalid_parameter;
+
+  if (channels == 0) {
+    xnn_log_error(
+      "failed to create Global Average Pooling operator with %zu channels: number of channels must be non-zero",
+      channels);
+    goto error;
+  }
+
+  if (input_stride < channels) {
+    xnn_log_error(
+      "failed to create Global Average Pooling operator with input element stride of %zu: "
+      "stride must be at least as large as the number of channels (%zu)",
+      input_stride, channels);
+    goto error;
+  }
+
+  if (output_stride < channels) {
+    xnn_log_error(
+      "failed to create Global Average Pooling operator with output element stride of %zu: "
+      "stride must be at least as large as the number of channels (%zu)",
+      output_stride, channels);
+    goto error;
+  }
+
+  if (isnan(output_min)) {
+    xnn_log_error(
+      "failed to create Global Average Pooling operator with NaN output lower bound: lower bound must be non-NaN");
+    goto error;
+  }
+
+  if (isnan(output_max)) {
+    xnn_log_error(
+      "failed to create Global Average Pooling operator with NaN output upper bound: upper bound must be non-NaN");
+    goto error;
+  }
+
+  // The scale is set at setup time, when the number of pooled elements is known.
+  const struct xnn_f16_output_params output_params = xnn_compute_f16_output_params(1.0f, output_min, output_max);
+  if (fp16_ieee_to_fp32_value(output_params.min) >= fp16_ieee_to_fp32_value(output_params.max)) {
+    xnn_log_error(
+      "failed to create Global Average Pooling operator with [%.7g, %.7g] output range: "
+      "lower bound must be below upper bound in half precision",
+      output_min, output_max);
+    goto error;
+  }
+
+  status = xnn_status_out_of_memory;
+
+  global_average_pooling_op = xnn_allocate_zero_memory(sizeof(struct xnn_operator));
+  if (global_average_pooling_op == NULL) {
+    xnn_log_error("failed to allocate %zu bytes for Global Average Pooling operator descriptor", sizeof(struct xnn_operator));
+    goto error;
+  }
+
+  void* zero_buffer = xnn_allocate_zero_memory(channels * sizeof(uint16_t) + XNN_EXTRA_BYTES);
+  if (zero_buffer == NULL) {
+    xnn_log_error("failed to allocate %zu bytes for Global Average Pooling zero padding",
+      channels * sizeof(uint16_t) + XNN_EXTRA_BYTES);
+    goto error;
+  }
+  global_average_pooling_op->zero_buffer = zero_buffer;
+
+  global_average_pooling_op->channels = channels;
+  global_average_pooling_op->input_pixel_stride = input_stride;
+  global_average_pooling_op->output_pixel_stride = output_stride;
+  global_average_pooling_op->f16_output_params = output_params;
+
+  global_average_pooling_op->type = xnn_operator_type_global_average_pooling_f16;
+  global_average_pooling_op->ukernel.type = xnn_ukernel_type_global_average_pooling;
+
+  global_average_pooling_op->state = xnn_run_state_invalid;
+
+  *global_average_pooling_op_out = global_average_pooling_op;
+  return xnn_status_success;
+
+error:
+  xnn_delete_operator(global_average_pooling_op);
+  return status;
+}
+
 enum xnn_status xnn_create_global_average_pooling_nwc_f32(
     size_t channels,
     size_t input_stride,
@@ -307,6 +407,70 @@ enum xnn_status xnn_setup_global_average_pooling_nwc_q8(
   return xnn_status_success;
 }
 
+enum xnn_status xnn_setup_global_average_pooling_nwc_f16(
+    xnn_operator_t global_average_pooling_op,
+    size_t batch_size,
+    size_t width,
+    const void* input,
+    void* output,
+    pthreadpool_t threadpool)
+{
+  if (global_average_pooling_op->type != xnn_operator_type_global_average_pooling_f16) {
+    xnn_log_error("failed to setup Global Average Pooling (F16) operator: operator type mismatch");
+    return xnn_status_invalid_parameter;
+  }
+  global_average_pooling_op->state = xnn_run_state_invalid;
+
+  if (!xnn_params.initialized) {
+    xnn_log_error("failed to setup Global Average Pooling operator: XNNPACK is not initialized");
+    return xnn_status_uninitialized;
+  }
+
+  if (width == 0) {
+    xnn_log_error("failed to setup Global Average Pooling operator with width %zu: width must be non-zero", width);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (batch_size == 0) {
+    global_average_pooling_op->state = xnn_run_state_skip;
+    return xnn_status_success;
+  }
+
+  global_average_pooling_op->batch_size = batch_size;
+  global_average_pooling_op->input_width = width;
+  global_average_pooling_op->input = input;
+  global_average_pooling_op->output = output;
+
+  global_average_pooling_op->f16_output_params.scale = fp16_ieee_from_fp32_value(1.0f / (float) width);
+
+  const size_t input_stride_in_bytes = global_average_pooling_op->input_pixel_stride * sizeof(uint16_t);
+  const size_t channels = global_average_pooling_op->channels;
+  global_average_pooling_op->context.global_average_pooling = (struct global_average_pooling_context) {
+      .input = input,
+      .zero = global_average_pooling_op->zero_buffer,
+      .input_pixel_stride = input_stride_in_bytes,
+      .input_batch_stride = input_stride_in_bytes * width,
+      .input_elements = width,
+      .channels = channels,
+      .output = output,
+      .output_batch_stride = global_average_pooling_op->output_pixel_stride * sizeof(uint16_t),
+      .params.f16 = global_average_pooling_op->f16_output_params,
+  };
+  global_average_pooling_op->compute.type = xnn_parallelization_type_1d;
+  global_average_pooling_op->compute.range[0] = batch_size;
+
+  if (width <= xnn_params.f16.gavgpool.mr) {
+    global_average_pooling_op->compute.task_1d = (pthreadpool_task_1d_t) xnn_compute_global_average_pooling_unipass;
+    global_average_pooling_op->context.global_average_pooling.unipass_ukernel = xnn_params.f16.gavgpool.up;
+  } else {
+    global_average_pooling_op->compute.task_1d = (pthreadpool_task_1d_t) xnn_compute_global_average_pooling_multipass;
+    global_average_pooling_op->context.global_average_pooling.multipass_ukernel = xnn_params.f16.gavgpool.mp;
+  }
+  global_average_pooling_op->state = xnn_run_state_ready;
+
+  return xnn_status_success;
+}
+
 enum xnn_status xnn_setup_global_average_pooling_nwc_f32(
     xnn_operator_t global_average_pooling_op,
     size_t batch_size,
@@ -102,6 +102,8 @@ enum xnn_status xnn_setup_hardswish_nc_f32(
     return xnn_status_success;
   }
 
+  hardswish_op->batch_size = batch_size;
+
   const size_t channels = hardswish_op->channels;
   const size_t input_stride = hardswish_op->input_pixel_stride;
   const size_t output_stride = hardswish_op->output_pixel_stride;
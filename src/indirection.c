@@ -7,10 +7,13 @@
 // LICENSE file in the root directory of this source tree.
 
 #include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
 
 #include <fxdiv.h>
 
 #include <xnnpack/indirection.h>
+#include <xnnpack/log.h>
 #include <xnnpack/operator.h>
 #include <xnnpack/math.h>
 
@@ -75,6 +78,54 @@ void xnn_indirection_init_conv2d(
   }
 }
 
+void xnn_indirection_init_conv2d_compact(
+  xnn_operator_t op,
+  size_t output_tile_size)
+{
+  uint32_t* indirection_buffer             = (uint32_t*) op->indirection_buffer;
+  const size_t input_pixel_stride          = op->input_pixel_stride;
+  const size_t input_height                = op->input_height;
+  const size_t input_width                 = op->input_width;
+  const size_t output_height               = op->output_height;
+  const size_t output_width                = op->output_width;
+  const size_t kernel_height               = op->kernel_height;
+  const size_t kernel_width                = op->kernel_width;
+  const size_t stride_height               = op->stride_height;
+  const size_t stride_width                = op->stride_width;
+  const size_t dilation_height             = op->dilation_height;
+  const size_t dilation_width              = op->dilation_width;
+  const size_t input_padding_top           = op->padding_top;
+  const size_t input_padding_left          = op->padding_left;
+
+  const size_t output_size = output_height * output_width;
+  const size_t tiled_output_size = round_up(output_size, output_tile_size);
+  const size_t kernel_size = kernel_height * kernel_width;
+
+  const struct fxdiv_divisor_size_t output_width_divisor = fxdiv_init_size_t(output_width);
+
+  for (size_t output_tile_start = 0; output_tile_start < tiled_output_size; output_tile_start += output_tile_size) {
+    for (size_t output_tile_offset = 0; output_tile_offset < output_tile_size; output_tile_offset++) {
+      const size_t output_index = min(output_tile_start + output_tile_offset, output_size - 1);
+      const struct fxdiv_result_size_t output_y_x = fxdiv_divide_size_t(output_index, output_width_divisor);
+      const size_t output_x = output_y_x.remainder;
+      const size_t output_y = output_y_x.quotient;
+      for (size_t kernel_y = 0; kernel_y < kernel_height; kernel_y++) {
+        const size_t input_y = output_y * stride_height + kernel_y * dilation_height - input_padding_top;
+        for (size_t kernel_x = 0; kernel_x < kernel_width; kernel_x++) {
+          const size_t input_x = output_x * stride_width + kernel_x * dilation_width - input_padding_left;
+          const size_t kernel_index = kernel_y * kernel_width + kernel_x;
+          const size_t index = output_tile_start * kernel_size + kernel_index * output_tile_size + output_tile_offset;
+          if (input_y < input_height && input_x < input_width) {
+            indirection_buffer[index] = (uint32_t) ((input_y * input_width + input_x) * input_pixel_stride);
+          } else {
+            indirection_buffer[index] = XNN_COMPACT_INDIRECTION_ZERO;
+          }
+        }
+      }
+    }
+  }
+}
+
 void xnn_indirection_init_dwconv2d(
   xnn_operator_t op,
   size_t batch_start,
@@ -130,6 +181,44 @@ void xnn_indirection_init_dwconv2d(
   }
 }
 
+void xnn_indirection_init_dwconv2d_compact(
+  xnn_operator_t op,
+  size_t step_height,
+  size_t step_width)
+{
+  uint32_t* indirection_buffer    = (uint32_t*) op->indirection_buffer;
+  const size_t input_pixel_stride = op->input_pixel_stride;
+  const size_t input_height       = op->input_height;
+  const size_t input_width        = op->input_width;
+  const size_t output_height      = op->output_height;
+  const size_t output_width       = op->output_width;
+  const size_t kernel_height      = op->kernel_height;
+  const size_t kernel_width       = op->kernel_width;
+  const size_t stride_height      = op->stride_height;
+  const size_t stride_width       = op->stride_width;
+  const size_t dilation_height    = op->dilation_height;
+  const size_t dilation_width     = op->dilation_width;
+  const size_t input_padding_top  = op->padding_top;
+  const size_t input_padding_left = op->padding_left;
+
+  for (size_t output_y = 0; output_y < output_height; output_y++) {
+    for (size_t kernel_y = 0; kernel_y < kernel_height; kernel_y++) {
+      const size_t input_y = output_y * stride_height + kernel_y * dilation_height - input_padding_top;
+      for (size_t output_x = 0; output_x < output_width; output_x++) {
+        for (size_t kernel_x = 0; kernel_x < kernel_width; kernel_x++) {
+          const size_t input_x = output_x * stride_width + kernel_x * dilation_width - input_padding_left;
+          const size_t index = output_y * step_height + output_x * step_width * kernel_height + kernel_x * kernel_height + kernel_y;
+          if (input_y < input_height && input_x < input_width) {
+            indirection_buffer[index] = (uint32_t) ((input_y * input_width + input_x) * input_pixel_stride);
+          } else {
+            indirection_buffer[index] = XNN_COMPACT_INDIRECTION_ZERO;
+          }
+        }
+      }
+    }
+  }
+}
+
 void xnn_indirection_init_deconv2d(
   xnn_operator_t op,
   size_t output_tile_size,
@@ -292,6 +381,42 @@ void xnn_indirection_init_maxpool2d(
   }
 }
 
+void xnn_indirection_init_maxpool2d_compact(
+  xnn_operator_t op,
+  size_t step_height,
+  size_t step_width)
+{
+  uint32_t* indirection_buffer    = (uint32_t*) op->indirection_buffer;
+  const size_t input_pixel_stride = op->input_pixel_stride;
+  const size_t input_height       = op->input_height;
+  const size_t input_width        = op->input_width;
+  const size_t output_height      = op->output_height;
+  const size_t output_width       = op->output_width;
+  const size_t pooling_height     = op->kernel_height;
+  const size_t pooling_width      = op->kernel_width;
+  const size_t stride_height      = op->stride_height;
+  const size_t stride_width       = op->stride_width;
+  const size_t dilation_height    = op->dilation_height;
+  const size_t dilation_width     = op->dilation_width;
+  const size_t input_padding_top  = op->padding_top;
+  const size_t input_padding_left = op->padding_left;
+
+  for (size_t output_y = 0; output_y < output_height; output_y++) {
+    for (size_t pooling_y = 0; pooling_y < pooling_height; pooling_y++) {
+      const size_t input_y = doz(output_y * stride_height + pooling_y * dilation_height, input_padding_top);
+      const size_t clamped_input_y = min(input_y, input_height - 1);
+      for (size_t output_x = 0; output_x < output_width; output_x++) {
+        for (size_t pooling_x = 0; pooling_x < pooling_width; pooling_x++) {
+          const size_t input_x = doz(output_x * stride_width + pooling_x * dilation_width, input_padding_left);
+          const size_t clamped_input_x = min(input_x, input_width - 1);
+          const size_t index = output_y * step_height + output_x * step_width * pooling_height + pooling_x * pooling_height + pooling_y;
+          indirection_buffer[index] = (uint32_t) ((clamped_input_y * input_width + clamped_input_x) * input_pixel_stride);
+        }
+      }
+    }
+  }
+}
+
 void xnn_indirection_init_unpool2d(
   xnn_operator_t op,
   size_t batch_start,
@@ -325,3 +450,53 @@ void xnn_indirection_init_unpool2d(
     }
   }
 }
+
+const void** xnn_indirection_rebase(
+  xnn_operator_t op,
+  const void* base,
+  const void* pointer,
+  size_t num_pointers,
+  const void* zero)
+{
+  if (pointer == base) {
+    return op->indirection_buffer;
+  }
+
+  struct xnn_rebased_indirection* rebased = op->rebased_indirection;
+  size_t index = XNN_MAX_REBASED_INDIRECTION_BUFFERS - 1;
+  for (size_t i = 0; i < XNN_MAX_REBASED_INDIRECTION_BUFFERS; i++) {
+    if (rebased[i].pointer == pointer) {
+      index = i;
+      break;
+    }
+  }
+  struct xnn_rebased_indirection entry = rebased[index];
+  memmove(&rebased[1], &rebased[0], index * sizeof(struct xnn_rebased_indirection));
+
+  if (entry.pointer != pointer || entry.input_height != op->last_input_height ||
+      entry.input_width != op->last_input_width || entry.num_pointers < num_pointers)
+  {
+    const void** buffer = (const void**) realloc(entry.buffer, num_pointers * sizeof(void*));
+    if (buffer == NULL) {
+      xnn_log_error("failed to allocate %zu bytes for rebased indirection buffer", num_pointers * sizeof(void*));
+      entry.pointer = NULL;
+      entry.num_pointers = 0;
+      rebased[0] = entry;
+      return NULL;
+    }
+
+    const void** indirection_buffer = op->indirection_buffer;
+    const uintptr_t offset = (uintptr_t) pointer - (uintptr_t) base;
+    for (size_t i = 0; i < num_pointers; i++) {
+      const void* p = indirection_buffer[i];
+      buffer[i] = p == zero ? p : (const void*) ((uintptr_t) p + offset);
+    }
+    entry.pointer = pointer;
+    entry.input_height = op->last_input_height;
+    entry.input_width = op->last_input_width;
+    entry.num_pointers = num_pointers;
+    entry.buffer = buffer;
+  }
+  rebased[0] = entry;
+  return entry.buffer;
+}
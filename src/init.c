@@ -29,16 +29,26 @@
 #include <xnnpack/igemm.h>
 #include <xnnpack/log.h>
 #include <xnnpack/lut.h>
+#include <xnnpack/math.h>
 #include <xnnpack/maxpool.h>
+#include <xnnpack/packx.h>
 #include <xnnpack/pad.h>
 #include <xnnpack/params.h>
 #include <xnnpack/pavgpool.h>
+#include <xnnpack/ppmm.h>
 #include <xnnpack/prelu.h>
+#include <xnnpack/raddstoreexpminusmax.h>
 #include <xnnpack/rmax.h>
 #include <xnnpack/spmm.h>
 #include <xnnpack/unpool.h>
 #include <xnnpack/vadd.h>
+#include <xnnpack/vbinary.h>
+#include <xnnpack/vmul.h>
 #include <xnnpack/vmulcaddc.h>
+#include <xnnpack/vquantize.h>
+#include <xnnpack/vsub.h>
+#include <xnnpack/vunary.h>
+#include <xnnpack/winograd.h>
 #include <xnnpack/zip.h>
 
 #ifndef XNN_ENABLE_ASSEMBLY
@@ -58,6 +68,38 @@ struct xnn_parameters xnn_params = {
   extern uint32_t xnn_stub_wasm_f32_min(uint32_t a, uint32_t b);
 #endif
 
+#ifndef __EMSCRIPTEN__
+static void init_f32_gemm_blocking(void) {
+  const struct gemm_parameters* gemm = &xnn_params.f32.gemm;
+  const struct cpuinfo_cache* l1d = cpuinfo_get_l1d_cache(0);
+  const struct cpuinfo_cache* l2 = cpuinfo_get_l2_cache(0);
+  if (gemm->gemminc == NULL || l1d == NULL || l2 == NULL) {
+    return;
+  }
+
+  // Caches shared by several processors are split evenly between them.
+  const size_t l1_size = l1d->size / max(l1d->processor_count, 1);
+  const size_t l2_size = l2->size / max(l2->processor_count, 1);
+  const size_t kr = UINT32_C(1) << (gemm->log2_kr + gemm->log2_sr);
+
+  // A KC x NR panel of packed weights takes half of L1 cache, leaving the other half to MR rows of A.
+  const size_t kc = round_down_po2(l1_size / 2 / (gemm->nr * sizeof(float)), kr);
+  if (kc == 0) {
+    return;
+  }
+  // A KC x NC block of packed weights takes half of L2 cache, and an MC x KC block of A takes a quarter of L2 cache.
+  const size_t nc = max(l2_size / 2 / (kc * sizeof(float)) / gemm->nr, 1) * gemm->nr;
+  const size_t mc = max(l2_size / 4 / (kc * sizeof(float)) / gemm->mr, 1) * gemm->mr;
+
+  xnn_params.f32.gemm_blocking = (struct gemm_blocking_parameters) {
+    .kc = kc,
+    .mc = mc,
+    .nc = nc,
+    .min_weights_size = l2_size,
+  };
+}
+#endif  // __EMSCRIPTEN__
+
 static void init(void) {
 #if XNN_ARCH_ARM
   if (!cpuinfo_has_arm_neon()) {
@@ -86,6 +128,11 @@ static void init(void) {
     .mr = 9,
   };
 #endif
+  xnn_params.q8.dwconv[1] = (struct dwconv_parameters) {
+    .mp = (xnn_dwconv_mp_ukernel_function) xnn_q8_dwconv_ukernel_mp8x4__neon,
+    .cr = 8,
+    .qr = 4,
+  };
   xnn_params.q8.avgpool = (struct avgpool_parameters) {
     .up = (xnn_avgpool_up_ukernel_function) xnn_q8_avgpool_ukernel_up9__neon,
     .mp = (xnn_avgpool_mp_ukernel_function) xnn_q8_avgpool_ukernel_mp9p8q__neon,
@@ -97,7 +144,40 @@ static void init(void) {
     .mp = (xnn_gavgpool_mp_ukernel_function) xnn_q8_gavgpool_ukernel_mp7p7q__neon,
     .mr = 7,
   };
-  xnn_params.q8.vadd = (xnn_vadd_ukernel_function) xnn_q8_vadd_ukernel__neon;
+  xnn_params.q8.vadd = (struct vbinary_parameters) {
+    .op_ukernel = (xnn_vbinary_ukernel_function) xnn_q8_vadd_ukernel__neon,
+    .opc_ukernel = (xnn_vbinary_ukernel_function) xnn_q8_vaddc_ukernel__neon,
+    .ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_q8_vaddc_ukernel__neon,
+    .element_tile = 16,
+  };
+  xnn_params.q8.vmul = (struct vbinary_parameters) {
+    .op_ukernel = (xnn_vbinary_ukernel_function) xnn_q8_vmul_ukernel__neon,
+    .opc_ukernel = (xnn_vbinary_ukernel_function) xnn_q8_vmulc_ukernel__neon,
+    .ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_q8_vmulc_ukernel__neon,
+    .element_tile = 16,
+  };
+
+  /**************************** Q8C micro-kernels ****************************/
+  xnn_params.q8c.gemm = (struct gemm_parameters) {
+    .gemm = (xnn_gemm_ukernel_function) xnn_q8c_gemm_ukernel_4x8__neon,
+    .igemm = (xnn_igemm_ukernel_function) xnn_q8c_igemm_ukernel_4x8__neon,
+    .mr = 4,
+    .nr = 8,
+  };
+  xnn_params.q8c.dwconv = (struct dwconv_parameters) {
+    .up = (xnn_dwconv_up_ukernel_function) xnn_q8c_dwconv_ukernel_up8x9__neon,
+    .cr = 8,
+    .mr = 9,
+  };
+
+  /**************************** Q8DQ micro-kernels ****************************/
+  xnn_params.q8dq.gemm = (struct q8dq_gemm_parameters) {
+    .gemm = xnn_q8dq_gemm_ukernel_4x8__neon,
+    .mr = 4,
+    .nr = 8,
+  };
+  xnn_params.q8dq.rabsmax = xnn_f32_rabsmax_ukernel__neon;
+  xnn_params.q8dq.vquantize = xnn_f32_vquantize_ukernel__neon;
 
   /**************************** U8 micro-kernels ****************************/
   xnn_params.u8.maxpool = (struct maxpool_parameters) {
@@ -107,10 +187,10 @@ static void init(void) {
   };
   xnn_params.u8.clamp = (xnn_univector_ukernel_function) xnn_u8_clamp_ukernel__neon;
   xnn_params.u8.rmax = xnn_u8_rmax_ukernel__neon;
-  xnn_params.u8.lut32norm = xnn_u8_lut32norm_ukernel__scalar;
+  xnn_params.u8.lut32norm = xnn_u8_lut32norm_ukernel__neon;
 
   /**************************** X8 micro-kernels ****************************/
-  xnn_params.x8.lut = xnn_x8_lut_ukernel__scalar;
+  xnn_params.x8.lut = xnn_x8_lut_ukernel__neon_x16;
   xnn_params.x8.zip = (struct zip_parameters) {
     .x2 = (xnn_zipc_ukernel_function) xnn_x8_zip_x2_ukernel__neon,
     .x3 = (xnn_zipc_ukernel_function) xnn_x8_zip_x3_ukernel__neon,
@@ -118,12 +198,36 @@ static void init(void) {
     .xm = (xnn_zipv_ukernel_function) xnn_x8_zip_xm_ukernel__neon,
   };
 
+  /**************************** F16 micro-kernels ****************************/
+  xnn_params.f16.gemm = (struct gemm_parameters) {
+    .gemm = (xnn_gemm_ukernel_function) xnn_f16_gemm_ukernel_4x4__scalar,
+    .igemm = (xnn_igemm_ukernel_function) xnn_f16_igemm_ukernel_4x4__scalar,
+    .gemm1 = (xnn_gemm_ukernel_function) xnn_f16_gemm_ukernel_1x4__scalar,
+    .igemm1 = (xnn_igemm_ukernel_function) xnn_f16_igemm_ukernel_1x4__scalar,
+    .mr = 4,
+    .nr = 4,
+  };
+  xnn_params.f16.dwconv = (struct dwconv_parameters) {
+    .up = (xnn_dwconv_up_ukernel_function) xnn_f16_dwconv_ukernel_up1x9__scalar,
+    .cr = 1,
+    .mr = 9,
+  };
+  xnn_params.f16.gavgpool = (struct gavgpool_parameters) {
+    .up = (xnn_gavgpool_up_ukernel_function) xnn_f16_gavgpool_ukernel_up7__scalar,
+    .mp = (xnn_gavgpool_mp_ukernel_function) xnn_f16_gavgpool_ukernel_mp7p7q__scalar,
+    .mr = 7,
+  };
+  xnn_params.f16.clamp = (xnn_univector_ukernel_function) xnn_f16_clamp_ukernel__scalar;
+  xnn_params.f16.vadd = (xnn_vadd_ukernel_function) xnn_f16_vadd_ukernel__scalar;
+
   /**************************** F32 micro-kernels ****************************/
   xnn_params.f32.gemm = (struct gemm_parameters) {
     .gemm = (xnn_gemm_ukernel_function) xnn_f32_gemm_ukernel_4x8__neon_ld128,
     .igemm = (xnn_igemm_ukernel_function) xnn_f32_igemm_ukernel_4x8__neon_ld128,
     .gemm1 = (xnn_gemm_ukernel_function) xnn_f32_gemm_ukernel_1x8__neon_ld64,
     .igemm1 = (xnn_igemm_ukernel_function) xnn_f32_igemm_ukernel_1x8__neon_ld64,
+    .gemminc = (xnn_gemminc_ukernel_function) xnn_f32_gemminc_ukernel_4x8__neon_ld128,
+    .gemminc1 = (xnn_gemminc_ukernel_function) xnn_f32_gemminc_ukernel_1x8__neon_ld64,
     .mr = 4,
     .nr = 8,
   };
@@ -133,6 +237,33 @@ static void init(void) {
     .mr = 4,
     .nr = 2,
   };
+  if (cpuinfo_has_arm_neon_fp16()) {
+    xnn_params.f32.gemm_f16w = (struct gemm_parameters) {
+      .gemm = (xnn_gemm_ukernel_function) xnn_f32_f16w_gemm_ukernel_4x8__neonfp16,
+      .gemm1 = (xnn_gemm_ukernel_function) xnn_f32_f16w_gemm_ukernel_1x8__neonfp16,
+      .mr = 4,
+      .nr = 8,
+    };
+  } else {
+    xnn_params.f32.gemm_f16w = (struct gemm_parameters) {
+      .gemm = (xnn_gemm_ukernel_function) xnn_f32_f16w_gemm_ukernel_4x4__scalar,
+      .gemm1 = (xnn_gemm_ukernel_function) xnn_f32_f16w_gemm_ukernel_1x4__scalar,
+      .mr = 4,
+      .nr = 4,
+    };
+  }
+  xnn_params.f32.gemm_qc8w = (struct gemm_parameters) {
+    .gemm = (xnn_gemm_ukernel_function) xnn_f32_qc8w_gemm_ukernel_4x8__neon,
+    .gemm1 = (xnn_gemm_ukernel_function) xnn_f32_qc8w_gemm_ukernel_1x8__neon,
+    .mr = 4,
+    .nr = 8,
+  };
+  xnn_params.f32.ppmm = (struct ppmm_parameters) {
+    .ppmm = (xnn_ppmm_ukernel_function) xnn_f32_ppmm_ukernel_4x8__neon,
+    .packx = (xnn_packx_ukernel_function) xnn_x32_packx_ukernel_4x__neon_st4,
+    .mr = 4,
+    .nr = 8,
+  };
   xnn_params.f32.dwconv[0] = (struct dwconv_parameters) {
     .up = (xnn_dwconv_up_ukernel_function) xnn_f32_dwconv_ukernel_up4x4__psimd,
     .cr = 4,
@@ -148,6 +279,11 @@ static void init(void) {
     .cr = 4,
     .mr = 25,
   };
+  xnn_params.f32.dwconv[3] = (struct dwconv_parameters) {
+    .mp = (xnn_dwconv_mp_ukernel_function) xnn_f32_dwconv_ukernel_mp4x4__neon,
+    .cr = 4,
+    .qr = 4,
+  };
   xnn_params.f32.avgpool = (struct avgpool_parameters) {
     .up = (xnn_avgpool_up_ukernel_function) xnn_f32_avgpool_ukernel_up9__neon,
     .mp = (xnn_avgpool_mp_ukernel_function) xnn_f32_avgpool_ukernel_mp9p8q__neon,
@@ -185,16 +321,60 @@ static void init(void) {
   };
   xnn_params.f32.clamp = (xnn_univector_ukernel_function) xnn_f32_clamp_ukernel__neon;
   xnn_params.f32.hswish = (xnn_univector_ukernel_function) xnn_f32_hswish_ukernel__neon;
+  xnn_params.f32.sigmoid = (xnn_univector_ukernel_function) xnn_f32_sigmoid_ukernel__neon_x8;
+  xnn_params.f32.tanh = (xnn_univector_ukernel_function) xnn_f32_tanh_ukernel__neon_x8;
+  xnn_params.f32.rmax = xnn_f32_rmax_ukernel__neon;
+  xnn_params.f32.raddstoreexpminusmax = xnn_f32_raddstoreexpminusmax_ukernel__neon_x8;
   xnn_params.f32.prelu = (struct prelu_parameters) {
     .ukernel = (xnn_prelu_ukernel_function) xnn_f32_prelu_ukernel_x4__psimd,
     .mr = 4,
   };
-  xnn_params.f32.vadd = (xnn_vadd_ukernel_function) xnn_f32_vadd_ukernel__psimd;
+  xnn_params.f32.vadd = (struct vbinary_parameters) {
+    .op_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vadd_ukernel__psimd,
+    .opc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vaddc_ukernel__psimd_x8,
+    .ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vaddc_ukernel__psimd_x8,
+    .element_tile = 8,
+  };
+  xnn_params.f32.vdiv = (struct vbinary_parameters) {
+    .op_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vdiv_ukernel__psimd_x8,
+    .opc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vdivc_ukernel__psimd_x8,
+    .ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vrdivc_ukernel__psimd_x8,
+    .element_tile = 8,
+  };
+  xnn_params.f32.vmax = (struct vbinary_parameters) {
+    .op_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vmax_ukernel__psimd_x8,
+    .opc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vmaxc_ukernel__psimd_x8,
+    .ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vmaxc_ukernel__psimd_x8,
+    .element_tile = 8,
+  };
+  xnn_params.f32.vmin = (struct vbinary_parameters) {
+    .op_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vmin_ukernel__psimd_x8,
+    .opc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vminc_ukernel__psimd_x8,
+    .ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vminc_ukernel__psimd_x8,
+    .element_tile = 8,
+  };
+  xnn_params.f32.vmul = (struct vbinary_parameters) {
+    .op_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vmul_ukernel__psimd,
+    .opc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vmulc_ukernel__psimd_x8,
+    .ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vmulc_ukernel__psimd_x8,
+    .element_tile = 8,
+  };
+  xnn_params.f32.vsub = (struct vbinary_parameters) {
+    .op_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vsub_ukernel__psimd,
+    .opc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vsubc_ukernel__psimd_x8,
+    .ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vrsubc_ukernel__psimd_x8,
+    .element_tile = 8,
+  };
   xnn_params.f32.vmulcaddc = (struct vmulcaddc_parameters) {
     .ukernel = (xnn_vmulcaddc_ukernel_function) xnn_f32_vmulcaddc_ukernel_c4__neon_x2,
     .cr = 4,
     .mr = 2,
   };
+  xnn_params.f32.winograd = (struct winograd_parameters) {
+    .input = (xnn_winograd_input_ukernel_function) xnn_f32_winograd_input_ukernel_6x6__psimd,
+    .output = (xnn_winograd_output_ukernel_function) xnn_f32_winograd_output_ukernel_4x4__psimd,
+    .min_channels = 32,
+  };
 
   /**************************** X32 micro-kernels ****************************/
   xnn_params.x32.pad = (struct pad_parameters) {
@@ -223,6 +403,11 @@ static void init(void) {
     .cr = 8,
     .mr = 9,
   };
+  xnn_params.q8.dwconv[1] = (struct dwconv_parameters) {
+    .mp = (xnn_dwconv_mp_ukernel_function) xnn_q8_dwconv_ukernel_mp8x4__neon,
+    .cr = 8,
+    .qr = 4,
+  };
   xnn_params.q8.avgpool = (struct avgpool_parameters) {
     .up = (xnn_avgpool_up_ukernel_function) xnn_q8_avgpool_ukernel_up9__neon,
     .mp = (xnn_avgpool_mp_ukernel_function) xnn_q8_avgpool_ukernel_mp9p8q__neon,
@@ -234,7 +419,40 @@ static void init(void) {
     .mp = (xnn_gavgpool_mp_ukernel_function) xnn_q8_gavgpool_ukernel_mp7p7q__neon,
     .mr = 7,
   };
-  xnn_params.q8.vadd = (xnn_vadd_ukernel_function) xnn_q8_vadd_ukernel__neon;
+  xnn_params.q8.vadd = (struct vbinary_parameters) {
+    .op_ukernel = (xnn_vbinary_ukernel_function) xnn_q8_vadd_ukernel__neon,
+    .opc_ukernel = (xnn_vbinary_ukernel_function) xnn_q8_vaddc_ukernel__neon,
+    .ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_q8_vaddc_ukernel__neon,
+    .element_tile = 16,
+  };
+  xnn_params.q8.vmul = (struct vbinary_parameters) {
+    .op_ukernel = (xnn_vbinary_ukernel_function) xnn_q8_vmul_ukernel__neon,
+    .opc_ukernel = (xnn_vbinary_ukernel_function) xnn_q8_vmulc_ukernel__neon,
+    .ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_q8_vmulc_ukernel__neon,
+    .element_tile = 16,
+  };
+
+  /**************************** Q8C micro-kernels ****************************/
+  xnn_params.q8c.gemm = (struct gemm_parameters) {
+    .gemm = (xnn_gemm_ukernel_function) xnn_q8c_gemm_ukernel_4x8__neon,
+    .igemm = (xnn_igemm_ukernel_function) xnn_q8c_igemm_ukernel_4x8__neon,
+    .mr = 4,
+    .nr = 8,
+  };
+  xnn_params.q8c.dwconv = (struct dwconv_parameters) {
+    .up = (xnn_dwconv_up_ukernel_function) xnn_q8c_dwconv_ukernel_up8x9__neon,
+    .cr = 8,
+    .mr = 9,
+  };
+
+  /**************************** Q8DQ micro-kernels ****************************/
+  xnn_params.q8dq.gemm = (struct q8dq_gemm_parameters) {
+    .gemm = xnn_q8dq_gemm_ukernel_4x8__neon,
+    .mr = 4,
+    .nr = 8,
+  };
+  xnn_params.q8dq.rabsmax = xnn_f32_rabsmax_ukernel__neon;
+  xnn_params.q8dq.vquantize = xnn_f32_vquantize_ukernel__neon;
 
   /**************************** U8 micro-kernels ****************************/
   xnn_params.u8.maxpool = (struct maxpool_parameters) {
@@ -243,11 +461,11 @@ static void init(void) {
     .qr = 8,
   };
   xnn_params.u8.clamp = (xnn_univector_ukernel_function) xnn_u8_clamp_ukernel__neon;
-  xnn_params.u8.lut32norm = xnn_u8_lut32norm_ukernel__scalar;
+  xnn_params.u8.lut32norm = xnn_u8_lut32norm_ukernel__neon;
   xnn_params.u8.rmax = xnn_u8_rmax_ukernel__neon;
 
   /**************************** X8 micro-kernels ****************************/
-  xnn_params.x8.lut = xnn_x8_lut_ukernel__scalar;
+  xnn_params.x8.lut = xnn_x8_lut_ukernel__neon_x16;
   xnn_params.x8.zip = (struct zip_parameters) {
     .x2 = (xnn_zipc_ukernel_function) xnn_x8_zip_x2_ukernel__neon,
     .x3 = (xnn_zipc_ukernel_function) xnn_x8_zip_x3_ukernel__neon,
@@ -255,6 +473,51 @@ static void init(void) {
     .xm = (xnn_zipv_ukernel_function) xnn_x8_zip_xm_ukernel__neon,
   };
 
+  /**************************** F16 micro-kernels ****************************/
+  if (cpuinfo_has_arm_neon_fp16_arith()) {
+    xnn_params.f16.gemm = (struct gemm_parameters) {
+      .gemm = (xnn_gemm_ukernel_function) xnn_f16_gemm_ukernel_6x8__neonfp16arith_ld64,
+      .igemm = (xnn_igemm_ukernel_function) xnn_f16_igemm_ukernel_6x8__neonfp16arith_ld64,
+      .gemm1 = (xnn_gemm_ukernel_function) xnn_f16_gemm_ukernel_1x8__neonfp16arith_ld64,
+      .igemm1 = (xnn_igemm_ukernel_function) xnn_f16_igemm_ukernel_1x8__neonfp16arith_ld64,
+      .mr = 6,
+      .nr = 8,
+    };
+    xnn_params.f16.dwconv = (struct dwconv_parameters) {
+      .up = (xnn_dwconv_up_ukernel_function) xnn_f16_dwconv_ukernel_up8x9__neonfp16arith,
+      .cr = 8,
+      .mr = 9,
+    };
+    xnn_params.f16.gavgpool = (struct gavgpool_parameters) {
+      .up = (xnn_gavgpool_up_ukernel_function) xnn_f16_gavgpool_ukernel_up7__neonfp16arith,
+      .mp = (xnn_gavgpool_mp_ukernel_function) xnn_f16_gavgpool_ukernel_mp7p7q__neonfp16arith,
+      .mr = 7,
+    };
+    xnn_params.f16.clamp = (xnn_univector_ukernel_function) xnn_f16_clamp_ukernel__neonfp16arith;
+    xnn_params.f16.vadd = (xnn_vadd_ukernel_function) xnn_f16_vadd_ukernel__neonfp16arith;
+  } else {
+    xnn_params.f16.gemm = (struct gemm_parameters) {
+      .gemm = (xnn_gemm_ukernel_function) xnn_f16_gemm_ukernel_4x4__scalar,
+      .igemm = (xnn_igemm_ukernel_function) xnn_f16_igemm_ukernel_4x4__scalar,
+      .gemm1 = (xnn_gemm_ukernel_function) xnn_f16_gemm_ukernel_1x4__scalar,
+      .igemm1 = (xnn_igemm_ukernel_function) xnn_f16_igemm_ukernel_1x4__scalar,
+      .mr = 4,
+      .nr = 4,
+    };
+    xnn_params.f16.dwconv = (struct dwconv_parameters) {
+      .up = (xnn_dwconv_up_ukernel_function) xnn_f16_dwconv_ukernel_up1x9__scalar,
+      .cr = 1,
+      .mr = 9,
+    };
+    xnn_params.f16.gavgpool = (struct gavgpool_parameters) {
+      .up = (xnn_gavgpool_up_ukernel_function) xnn_f16_gavgpool_ukernel_up7__scalar,
+      .mp = (xnn_gavgpool_mp_ukernel_function) xnn_f16_gavgpool_ukernel_mp7p7q__scalar,
+      .mr = 7,
+    };
+    xnn_params.f16.clamp = (xnn_univector_ukernel_function) xnn_f16_clamp_ukernel__scalar;
+    xnn_params.f16.vadd = (xnn_vadd_ukernel_function) xnn_f16_vadd_ukernel__scalar;
+  }
+
   /**************************** F32 micro-kernels ****************************/
 #if XNN_ENABLE_ASSEMBLY
   switch (cpuinfo_get_core(0)->uarch) {
@@ -264,6 +527,8 @@ static void init(void) {
         .igemm = (xnn_igemm_ukernel_function) xnn_f32_igemm_ukernel_4x8__aarch64_neonfma_cortex_a75,
         .gemm1 = (xnn_gemm_ukernel_function) xnn_f32_gemm_ukernel_1x8__aarch64_neonfma_cortex_a75,
         .igemm1 = (xnn_igemm_ukernel_function) xnn_f32_igemm_ukernel_1x8__aarch64_neonfma_cortex_a75,
+        .gemminc = (xnn_gemminc_ukernel_function) xnn_f32_gemminc_ukernel_4x8__aarch64_neonfma_cortex_a57,
+        .gemminc1 = (xnn_gemminc_ukernel_function) xnn_f32_gemminc_ukernel_1x8__aarch64_neonfma_cortex_a75,
         .mr = 4,
         .nr = 8,
       };
@@ -274,6 +539,8 @@ static void init(void) {
         .igemm = (xnn_igemm_ukernel_function) xnn_f32_igemm_ukernel_6x8__aarch64_neonfma_cortex_a57,
         .gemm1 = (xnn_gemm_ukernel_function) xnn_f32_gemm_ukernel_1x8__aarch64_neonfma_cortex_a57,
         .igemm1 = (xnn_igemm_ukernel_function) xnn_f32_igemm_ukernel_1x8__aarch64_neonfma_cortex_a57,
+        .gemminc = (xnn_gemminc_ukernel_function) xnn_f32_gemminc_ukernel_6x8__aarch64_neonfma_cortex_a57,
+        .gemminc1 = (xnn_gemminc_ukernel_function) xnn_f32_gemminc_ukernel_1x8__aarch64_neonfma_cortex_a57,
         .mr = 6,
         .nr = 8,
       };
@@ -285,6 +552,8 @@ static void init(void) {
         .igemm = (xnn_igemm_ukernel_function) xnn_f32_igemm_ukernel_4x8__aarch64_neonfma_cortex_a75,
         .gemm1 = (xnn_gemm_ukernel_function) xnn_f32_gemm_ukernel_1x8__aarch64_neonfma_cortex_a75,
         .igemm1 = (xnn_igemm_ukernel_function) xnn_f32_igemm_ukernel_1x8__aarch64_neonfma_cortex_a75,
+        .gemminc = (xnn_gemminc_ukernel_function) xnn_f32_gemminc_ukernel_4x8__aarch64_neonfma_cortex_a75,
+        .gemminc1 = (xnn_gemminc_ukernel_function) xnn_f32_gemminc_ukernel_1x8__aarch64_neonfma_cortex_a75,
         .mr = 4,
         .nr = 8,
       };
@@ -299,6 +568,8 @@ static void init(void) {
         .igemm = (xnn_igemm_ukernel_function) xnn_f32_igemm_ukernel_6x8__aarch64_neonfma_cortex_a75,
         .gemm1 = (xnn_gemm_ukernel_function) xnn_f32_gemm_ukernel_1x8__aarch64_neonfma_cortex_a75,
         .igemm1 = (xnn_igemm_ukernel_function) xnn_f32_igemm_ukernel_1x8__aarch64_neonfma_cortex_a75,
+        .gemminc = (xnn_gemminc_ukernel_function) xnn_f32_gemminc_ukernel_6x8__aarch64_neonfma_cortex_a75,
+        .gemminc1 = (xnn_gemminc_ukernel_function) xnn_f32_gemminc_ukernel_1x8__aarch64_neonfma_cortex_a75,
         .mr = 6,
         .nr = 8,
       };
@@ -310,6 +581,8 @@ static void init(void) {
         .igemm = (xnn_igemm_ukernel_function) xnn_f32_igemm_ukernel_4x12__aarch64_neonfma_cortex_a53,
         .gemm1 = (xnn_gemm_ukernel_function) xnn_f32_gemm_ukernel_1x12__aarch64_neonfma_cortex_a53,
         .igemm1 = (xnn_igemm_ukernel_function) xnn_f32_igemm_ukernel_1x12__aarch64_neonfma_cortex_a53,
+        .gemminc = (xnn_gemminc_ukernel_function) xnn_f32_gemminc_ukernel_4x12__aarch64_neonfma_cortex_a53,
+        .gemminc1 = (xnn_gemminc_ukernel_function) xnn_f32_gemminc_ukernel_1x12__aarch64_neonfma_cortex_a53,
         .mr = 4,
         .nr = 12,
       };
@@ -320,6 +593,8 @@ static void init(void) {
         .igemm = (xnn_igemm_ukernel_function) xnn_f32_igemm_ukernel_6x8__aarch64_neonfma_cortex_a73,
         .gemm1 = (xnn_gemm_ukernel_function) xnn_f32_gemm_ukernel_1x8__aarch64_neonfma_cortex_a75,
         .igemm1 = (xnn_igemm_ukernel_function) xnn_f32_igemm_ukernel_1x8__aarch64_neonfma_cortex_a75,
+        .gemminc = (xnn_gemminc_ukernel_function) xnn_f32_gemminc_ukernel_6x8__aarch64_neonfma_cortex_a73,
+        .gemminc1 = (xnn_gemminc_ukernel_function) xnn_f32_gemminc_ukernel_1x8__aarch64_neonfma_cortex_a75,
         .mr = 6,
         .nr = 8,
       };
@@ -330,6 +605,8 @@ static void init(void) {
         .igemm = (xnn_igemm_ukernel_function) xnn_f32_igemm_ukernel_4x8__neonfma_ld64,
         .gemm1 = (xnn_gemm_ukernel_function) xnn_f32_gemm_ukernel_1x8__aarch64_neonfma_cortex_a75,
         .igemm1 = (xnn_igemm_ukernel_function) xnn_f32_igemm_ukernel_1x8__aarch64_neonfma_cortex_a75,
+        .gemminc = (xnn_gemminc_ukernel_function) xnn_f32_gemminc_ukernel_4x8__neonfma_ld64,
+        .gemminc1 = (xnn_gemminc_ukernel_function) xnn_f32_gemminc_ukernel_1x8__aarch64_neonfma_cortex_a75,
         .mr = 4,
         .nr = 8,
       };
@@ -341,6 +618,8 @@ static void init(void) {
     .igemm = (xnn_igemm_ukernel_function) xnn_f32_igemm_ukernel_4x8__neonfma_ld64,
     .gemm1 = (xnn_gemm_ukernel_function) xnn_f32_gemm_ukernel_1x8__neonfma_ld64,
     .igemm1 = (xnn_igemm_ukernel_function) xnn_f32_igemm_ukernel_1x8__neonfma_ld64,
+    .gemminc = (xnn_gemminc_ukernel_function) xnn_f32_gemminc_ukernel_4x8__neonfma_ld64,
+    .gemminc1 = (xnn_gemminc_ukernel_function) xnn_f32_gemminc_ukernel_1x8__neonfma_ld64,
     .mr = 4,
     .nr = 8,
   };
@@ -352,6 +631,24 @@ static void init(void) {
     .mr = 4,
     .nr = 2,
   };
+  xnn_params.f32.gemm_f16w = (struct gemm_parameters) {
+    .gemm = (xnn_gemm_ukernel_function) xnn_f32_f16w_gemm_ukernel_4x8__neonfp16,
+    .gemm1 = (xnn_gemm_ukernel_function) xnn_f32_f16w_gemm_ukernel_1x8__neonfp16,
+    .mr = 4,
+    .nr = 8,
+  };
+  xnn_params.f32.gemm_qc8w = (struct gemm_parameters) {
+    .gemm = (xnn_gemm_ukernel_function) xnn_f32_qc8w_gemm_ukernel_4x8__neon,
+    .gemm1 = (xnn_gemm_ukernel_function) xnn_f32_qc8w_gemm_ukernel_1x8__neon,
+    .mr = 4,
+    .nr = 8,
+  };
+  xnn_params.f32.ppmm = (struct ppmm_parameters) {
+    .ppmm = (xnn_ppmm_ukernel_function) xnn_f32_ppmm_ukernel_4x8__neonfma,
+    .packx = (xnn_packx_ukernel_function) xnn_x32_packx_ukernel_4x__neon_st4,
+    .mr = 4,
+    .nr = 8,
+  };
   xnn_params.f32.dwconv[0] = (struct dwconv_parameters) {
     .up = (xnn_dwconv_up_ukernel_function) xnn_f32_dwconv_ukernel_up4x4__psimd,
     .cr = 4,
@@ -388,6 +685,11 @@ static void init(void) {
     .cr = 4,
     .mr = 25,
   };
+  xnn_params.f32.dwconv[3] = (struct dwconv_parameters) {
+    .mp = (xnn_dwconv_mp_ukernel_function) xnn_f32_dwconv_ukernel_mp4x4__neonfma,
+    .cr = 4,
+    .qr = 4,
+  };
   xnn_params.f32.avgpool = (struct avgpool_parameters) {
     .up = (xnn_avgpool_up_ukernel_function) xnn_f32_avgpool_ukernel_up9__neon,
     .mp = (xnn_avgpool_mp_ukernel_function) xnn_f32_avgpool_ukernel_mp9p8q__neon,
@@ -425,16 +727,60 @@ static void init(void) {
   };
   xnn_params.f32.clamp = (xnn_univector_ukernel_function) xnn_f32_clamp_ukernel__neon;
   xnn_params.f32.hswish = (xnn_univector_ukernel_function) xnn_f32_hswish_ukernel__neonfma;
+  xnn_params.f32.sigmoid = (xnn_univector_ukernel_function) xnn_f32_sigmoid_ukernel__neon_x8;
+  xnn_params.f32.tanh = (xnn_univector_ukernel_function) xnn_f32_tanh_ukernel__neon_x8;
+  xnn_params.f32.rmax = xnn_f32_rmax_ukernel__neon;
+  xnn_params.f32.raddstoreexpminusmax = xnn_f32_raddstoreexpminusmax_ukernel__neon_x8;
   xnn_params.f32.prelu = (struct prelu_parameters) {
     .ukernel = (xnn_prelu_ukernel_function) xnn_f32_prelu_ukernel_x4__psimd,
     .mr = 4,
   };
-  xnn_params.f32.vadd = (xnn_vadd_ukernel_function) xnn_f32_vadd_ukernel__psimd;
+  xnn_params.f32.vadd = (struct vbinary_parameters) {
+    .op_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vadd_ukernel__psimd,
+    .opc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vaddc_ukernel__psimd_x8,
+    .ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vaddc_ukernel__psimd_x8,
+    .element_tile = 8,
+  };
+  xnn_params.f32.vdiv = (struct vbinary_parameters) {
+    .op_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vdiv_ukernel__psimd_x8,
+    .opc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vdivc_ukernel__psimd_x8,
+    .ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vrdivc_ukernel__psimd_x8,
+    .element_tile = 8,
+  };
+  xnn_params.f32.vmax = (struct vbinary_parameters) {
+    .op_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vmax_ukernel__psimd_x8,
+    .opc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vmaxc_ukernel__psimd_x8,
+    .ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vmaxc_ukernel__psimd_x8,
+    .element_tile = 8,
+  };
+  xnn_params.f32.vmin = (struct vbinary_parameters) {
+    .op_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vmin_ukernel__psimd_x8,
+    .opc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vminc_ukernel__psimd_x8,
+    .ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vminc_ukernel__psimd_x8,
+    .element_tile = 8,
+  };
+  xnn_params.f32.vmul = (struct vbinary_parameters) {
+    .op_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vmul_ukernel__psimd,
+    .opc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vmulc_ukernel__psimd_x8,
+    .ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vmulc_ukernel__psimd_x8,
+    .element_tile = 8,
+  };
+  xnn_params.f32.vsub = (struct vbinary_parameters) {
+    .op_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vsub_ukernel__psimd,
+    .opc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vsubc_ukernel__psimd_x8,
+    .ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vrsubc_ukernel__psimd_x8,
+    .element_tile = 8,
+  };
   xnn_params.f32.vmulcaddc = (struct vmulcaddc_parameters) {
     .ukernel = (xnn_vmulcaddc_ukernel_function) xnn_f32_vmulcaddc_ukernel_c4__neonfma_x2,
     .cr = 4,
     .mr = 2,
   };
+  xnn_params.f32.winograd = (struct winograd_parameters) {
+    .input = (xnn_winograd_input_ukernel_function) xnn_f32_winograd_input_ukernel_6x6__psimd,
+    .output = (xnn_winograd_output_ukernel_function) xnn_f32_winograd_output_ukernel_4x4__psimd,
+    .min_channels = 32,
+  };
   xnn_params.f32.spmm = (struct spmm_parameters) {
     .ukernel = (xnn_spmm_ukernel_function) xnn_f32_spmm_ukernel_16x1__neonfma,
     .mr = 16,
@@ -469,6 +815,18 @@ static void init(void) {
     .output_width_tile = 4,
     .output_height_tile = 1,
   };
+  xnn_params.f32.spchw_dwconv5x5 = (struct spchw_dwconv_parameters) {
+    .ukernel = (xnn_dwconv_spchw_ukernel_function) xnn_f32_dwconv_spchw_ukernel_5x5p2__neonfma,
+    .input_width_tile = 4,
+    .output_width_tile = 4,
+    .output_height_tile = 1,
+  };
+  xnn_params.f32.spchw_dwconv5x5s2 = (struct spchw_dwconv_parameters) {
+    .ukernel = (xnn_dwconv_spchw_ukernel_function) xnn_f32_dwconv_spchw_ukernel_5x5s2p2__neonfma,
+    .input_width_tile = 4,
+    .output_width_tile = 4,
+    .output_height_tile = 1,
+  };
   xnn_params.f32.spchw_gavgpool = (struct spchw_gavgpool_parameters) {
     .ukernel = (xnn_gavgpool_spchw_ukernel_function) xnn_f32_gavgpool_spchw_ukernel__neon_x4,
     .channel_tile = 4,
@@ -494,18 +852,41 @@ static void init(void) {
   }
 
   /**************************** Q8 micro-kernels ****************************/
-  xnn_params.q8.gemm = (struct gemm_parameters) {
-    .gemm = (xnn_gemm_ukernel_function) xnn_q8_gemm_ukernel_4x4c2__sse2,
-    .igemm = (xnn_igemm_ukernel_function) xnn_q8_igemm_ukernel_4x4c2__sse2,
-    .mr = 4,
-    .nr = 4,
-    .log2_kr = 1,
-  };
+  if (cpuinfo_has_x86_avx2()) {
+    xnn_params.q8.gemm = (struct gemm_parameters) {
+      .gemm = (xnn_gemm_ukernel_function) xnn_q8_gemm_ukernel_4x16c2__avx2,
+      .igemm = (xnn_igemm_ukernel_function) xnn_q8_igemm_ukernel_4x16c2__avx2,
+      .mr = 4,
+      .nr = 16,
+      .log2_kr = 1,
+    };
+  } else if (cpuinfo_has_x86_sse4_1()) {
+    xnn_params.q8.gemm = (struct gemm_parameters) {
+      .gemm = (xnn_gemm_ukernel_function) xnn_q8_gemm_ukernel_4x8c2__sse41,
+      .igemm = (xnn_igemm_ukernel_function) xnn_q8_igemm_ukernel_4x8c2__sse41,
+      .mr = 4,
+      .nr = 8,
+      .log2_kr = 1,
+    };
+  } else {
+    xnn_params.q8.gemm = (struct gemm_parameters) {
+      .gemm = (xnn_gemm_ukernel_function) xnn_q8_gemm_ukernel_4x4c2__sse2,
+      .igemm = (xnn_igemm_ukernel_function) xnn_q8_igemm_ukernel_4x4c2__sse2,
+      .mr = 4,
+      .nr = 4,
+      .log2_kr = 1,
+    };
+  }
   xnn_params.q8.dwconv[0] = (struct dwconv_parameters) {
     .up = (xnn_dwconv_up_ukernel_function) xnn_q8_dwconv_ukernel_up8x9__sse2,
     .cr = 8,
     .mr = 9,
   };
+  xnn_params.q8.dwconv[1] = (struct dwconv_parameters) {
+    .mp = (xnn_dwconv_mp_ukernel_function) xnn_q8_dwconv_ukernel_mp8x4__sse2,
+    .cr = 8,
+    .qr = 4,
+  };
   xnn_params.q8.avgpool = (struct avgpool_parameters) {
     .up = (xnn_avgpool_up_ukernel_function) xnn_q8_avgpool_ukernel_up9__sse2,
     .mp = (xnn_avgpool_mp_ukernel_function) xnn_q8_avgpool_ukernel_mp9p8q__sse2,
@@ -517,7 +898,42 @@ static void init(void) {
     .mp = (xnn_gavgpool_mp_ukernel_function) xnn_q8_gavgpool_ukernel_mp7p7q__sse2,
     .mr = 7,
   };
-  xnn_params.q8.vadd = (xnn_vadd_ukernel_function) xnn_q8_vadd_ukernel__sse2;
+  xnn_params.q8.vadd = (struct vbinary_parameters) {
+    .op_ukernel = (xnn_vbinary_ukernel_function) xnn_q8_vadd_ukernel__sse2,
+    .opc_ukernel = (xnn_vbinary_ukernel_function) xnn_q8_vaddc_ukernel__sse2,
+    .ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_q8_vaddc_ukernel__sse2,
+    .element_tile = 8,
+  };
+  xnn_params.q8.vmul = (struct vbinary_parameters) {
+    .op_ukernel = (xnn_vbinary_ukernel_function) xnn_q8_vmul_ukernel__sse2,
+    .opc_ukernel = (xnn_vbinary_ukernel_function) xnn_q8_vmulc_ukernel__sse2,
+    .ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_q8_vmulc_ukernel__sse2,
+    .element_tile = 8,
+  };
+
+  /**************************** Q8C micro-kernels ****************************/
+  xnn_params.q8c.gemm = (struct gemm_parameters) {
+    .gemm = (xnn_gemm_ukernel_function) xnn_q8c_gemm_ukernel_4x4c2__sse2,
+    .igemm = (xnn_igemm_ukernel_function) xnn_q8c_igemm_ukernel_4x4c2__sse2,
+    .mr = 4,
+    .nr = 4,
+    .log2_kr = 1,
+  };
+  xnn_params.q8c.dwconv = (struct dwconv_parameters) {
+    .up = (xnn_dwconv_up_ukernel_function) xnn_q8c_dwconv_ukernel_up8x9__sse2,
+    .cr = 8,
+    .mr = 9,
+  };
+
+  /**************************** Q8DQ micro-kernels ****************************/
+  xnn_params.q8dq.gemm = (struct q8dq_gemm_parameters) {
+    .gemm = xnn_q8dq_gemm_ukernel_4x4c2__sse2,
+    .mr = 4,
+    .nr = 4,
+    .log2_kr = 1,
+  };
+  xnn_params.q8dq.rabsmax = xnn_f32_rabsmax_ukernel__sse;
+  xnn_params.q8dq.vquantize = xnn_f32_vquantize_ukernel__sse2;
 
   /**************************** U8 micro-kernels ****************************/
   xnn_params.u8.maxpool = (struct maxpool_parameters) {
@@ -526,11 +942,15 @@ static void init(void) {
     .qr = 8,
   };
   xnn_params.u8.clamp = (xnn_univector_ukernel_function) xnn_u8_clamp_ukernel__sse2;
-  xnn_params.u8.lut32norm = xnn_u8_lut32norm_ukernel__scalar;
+  xnn_params.u8.lut32norm = xnn_u8_lut32norm_ukernel__sse2;
   xnn_params.u8.rmax = xnn_u8_rmax_ukernel__sse2;
 
   /**************************** X8 micro-kernels ****************************/
-  xnn_params.x8.lut = xnn_x8_lut_ukernel__scalar;
+  if (cpuinfo_has_x86_avx2()) {
+    xnn_params.x8.lut = xnn_x8_lut_ukernel__avx2_x32;
+  } else {
+    xnn_params.x8.lut = xnn_x8_lut_ukernel__scalar;
+  }
   xnn_params.x8.zip = (struct zip_parameters) {
     .x2 = (xnn_zipc_ukernel_function) xnn_x8_zip_x2_ukernel__sse2,
     .x3 = (xnn_zipc_ukernel_function) xnn_x8_zip_x3_ukernel__sse2,
@@ -538,15 +958,98 @@ static void init(void) {
     .xm = (xnn_zipv_ukernel_function) xnn_x8_zip_xm_ukernel__sse2,
   };
 
+  /**************************** F16 micro-kernels ****************************/
+  if (cpuinfo_has_x86_f16c()) {
+    xnn_params.f16.gemm = (struct gemm_parameters) {
+      .gemm = (xnn_gemm_ukernel_function) xnn_f16_gemm_ukernel_4x8__f16c,
+      .igemm = (xnn_igemm_ukernel_function) xnn_f16_igemm_ukernel_4x8__f16c,
+      .gemm1 = (xnn_gemm_ukernel_function) xnn_f16_gemm_ukernel_1x8__f16c,
+      .igemm1 = (xnn_igemm_ukernel_function) xnn_f16_igemm_ukernel_1x8__f16c,
+      .mr = 4,
+      .nr = 8,
+    };
+    xnn_params.f16.dwconv = (struct dwconv_parameters) {
+      .up = (xnn_dwconv_up_ukernel_function) xnn_f16_dwconv_ukernel_up8x9__f16c,
+      .cr = 8,
+      .mr = 9,
+    };
+    xnn_params.f16.gavgpool = (struct gavgpool_parameters) {
+      .up = (xnn_gavgpool_up_ukernel_function) xnn_f16_gavgpool_ukernel_up7__f16c,
+      .mp = (xnn_gavgpool_mp_ukernel_function) xnn_f16_gavgpool_ukernel_mp7p7q__f16c,
+      .mr = 7,
+    };
+    xnn_params.f16.clamp = (xnn_univector_ukernel_function) xnn_f16_clamp_ukernel__f16c;
+    xnn_params.f16.vadd = (xnn_vadd_ukernel_function) xnn_f16_vadd_ukernel__f16c;
+  } else {
+    xnn_params.f16.gemm = (struct gemm_parameters) {
+      .gemm = (xnn_gemm_ukernel_function) xnn_f16_gemm_ukernel_4x4__scalar,
+      .igemm = (xnn_igemm_ukernel_function) xnn_f16_igemm_ukernel_4x4__scalar,
+      .gemm1 = (xnn_gemm_ukernel_function) xnn_f16_gemm_ukernel_1x4__scalar,
+      .igemm1 = (xnn_igemm_ukernel_function) xnn_f16_igemm_ukernel_1x4__scalar,
+      .mr = 4,
+      .nr = 4,
+    };
+    xnn_params.f16.dwconv = (struct dwconv_parameters) {
+      .up = (xnn_dwconv_up_ukernel_function) xnn_f16_dwconv_ukernel_up1x9__scalar,
+      .cr = 1,
+      .mr = 9,
+    };
+    xnn_params.f16.gavgpool = (struct gavgpool_parameters) {
+      .up = (xnn_gavgpool_up_ukernel_function) xnn_f16_gavgpool_ukernel_up7__scalar,
+      .mp = (xnn_gavgpool_mp_ukernel_function) xnn_f16_gavgpool_ukernel_mp7p7q__scalar,
+      .mr = 7,
+    };
+    xnn_params.f16.clamp = (xnn_univector_ukernel_function) xnn_f16_clamp_ukernel__scalar;
+    xnn_params.f16.vadd = (xnn_vadd_ukernel_function) xnn_f16_vadd_ukernel__scalar;
+  }
+
   /**************************** F32 micro-kernels ****************************/
-  xnn_params.f32.gemm = (struct gemm_parameters) {
-    .gemm = (xnn_gemm_ukernel_function) xnn_f32_gemm_ukernel_4x8__sse_load1,
-    .igemm = (xnn_igemm_ukernel_function) xnn_f32_igemm_ukernel_4x8__sse_load1,
-    .gemm1 = (xnn_gemm_ukernel_function) xnn_f32_gemm_ukernel_1x8__sse_load1,
-    .igemm1 = (xnn_igemm_ukernel_function) xnn_f32_igemm_ukernel_1x8__sse_load1,
-    .mr = 4,
-    .nr = 8,
-  };
+  if (cpuinfo_has_x86_avx512f()) {
+    xnn_params.f32.gemm = (struct gemm_parameters) {
+      .gemm = (xnn_gemm_ukernel_function) xnn_f32_gemm_ukernel_7x16__avx512f_broadcast,
+      .igemm = (xnn_igemm_ukernel_function) xnn_f32_igemm_ukernel_7x16__avx512f_broadcast,
+      .gemm1 = (xnn_gemm_ukernel_function) xnn_f32_gemm_ukernel_1x16__avx512f_broadcast,
+      .igemm1 = (xnn_igemm_ukernel_function) xnn_f32_igemm_ukernel_1x16__avx512f_broadcast,
+      .gemminc = (xnn_gemminc_ukernel_function) xnn_f32_gemminc_ukernel_7x16__avx512f_broadcast,
+      .gemminc1 = (xnn_gemminc_ukernel_function) xnn_f32_gemminc_ukernel_1x16__avx512f_broadcast,
+      .mr = 7,
+      .nr = 16,
+    };
+  } else if (cpuinfo_has_x86_avx2() && cpuinfo_has_x86_fma3()) {
+    xnn_params.f32.gemm = (struct gemm_parameters) {
+      .gemm = (xnn_gemm_ukernel_function) xnn_f32_gemm_ukernel_5x16__fma3_broadcast,
+      .igemm = (xnn_igemm_ukernel_function) xnn_f32_igemm_ukernel_5x16__fma3_broadcast,
+      .gemm1 = (xnn_gemm_ukernel_function) xnn_f32_gemm_ukernel_1x16__fma3_broadcast,
+      .igemm1 = (xnn_igemm_ukernel_function) xnn_f32_igemm_ukernel_1x16__fma3_broadcast,
+      .gemminc = (xnn_gemminc_ukernel_function) xnn_f32_gemminc_ukernel_5x16__fma3_broadcast,
+      .gemminc1 = (xnn_gemminc_ukernel_function) xnn_f32_gemminc_ukernel_1x16__fma3_broadcast,
+      .mr = 5,
+      .nr = 16,
+    };
+    xnn_params.f32.ppmm = (struct ppmm_parameters) {
+      .ppmm = (xnn_ppmm_ukernel_function) xnn_f32_ppmm_ukernel_4x16__fma3,
+      .packx = (xnn_packx_ukernel_function) xnn_x32_packx_ukernel_4x__sse,
+      .mr = 4,
+      .nr = 16,
+    };
+  } else {
+    xnn_params.f32.gemm = (struct gemm_parameters) {
+      .gemm = (xnn_gemm_ukernel_function) xnn_f32_gemm_ukernel_4x8__sse_load1,
+      .igemm = (xnn_igemm_ukernel_function) xnn_f32_igemm_ukernel_4x8__sse_load1,
+      .gemm1 = (xnn_gemm_ukernel_function) xnn_f32_gemm_ukernel_1x8__sse_load1,
+      .igemm1 = (xnn_igemm_ukernel_function) xnn_f32_igemm_ukernel_1x8__sse_load1,
+      .gemminc = (xnn_gemminc_ukernel_function) xnn_f32_gemminc_ukernel_4x8__sse_load1,
+      .gemminc1 = (xnn_gemminc_ukernel_function) xnn_f32_gemminc_ukernel_1x8__sse_load1,
+      .mr = 4,
+      .nr = 8,
+    };
+    xnn_params.f32.ppmm = (struct ppmm_parameters) {
+      .ppmm = (xnn_ppmm_ukernel_function) xnn_f32_ppmm_ukernel_4x8__sse,
+      .packx = (xnn_packx_ukernel_function) xnn_x32_packx_ukernel_4x__sse,
+      .mr = 4,
+      .nr = 8,
+    };
+  }
   xnn_params.f32.gemm2 = (struct gemm_parameters) {
     .gemm = NULL,
     .igemm = (xnn_igemm_ukernel_function) xnn_f32_igemm_ukernel_4x2c4__sse,
@@ -554,6 +1057,36 @@ static void init(void) {
     .nr = 2,
     .log2_kr = 2,
   };
+  if (cpuinfo_has_x86_f16c()) {
+    xnn_params.f32.gemm_f16w = (struct gemm_parameters) {
+      .gemm = (xnn_gemm_ukernel_function) xnn_f32_f16w_gemm_ukernel_4x16__f16c,
+      .gemm1 = (xnn_gemm_ukernel_function) xnn_f32_f16w_gemm_ukernel_1x16__f16c,
+      .mr = 4,
+      .nr = 16,
+    };
+  } else {
+    xnn_params.f32.gemm_f16w = (struct gemm_parameters) {
+      .gemm = (xnn_gemm_ukernel_function) xnn_f32_f16w_gemm_ukernel_4x8__sse2,
+      .gemm1 = (xnn_gemm_ukernel_function) xnn_f32_f16w_gemm_ukernel_1x8__sse2,
+      .mr = 4,
+      .nr = 8,
+    };
+  }
+  if (cpuinfo_has_x86_avx()) {
+    xnn_params.f32.gemm_qc8w = (struct gemm_parameters) {
+      .gemm = (xnn_gemm_ukernel_function) xnn_f32_qc8w_gemm_ukernel_4x16__avx,
+      .gemm1 = (xnn_gemm_ukernel_function) xnn_f32_qc8w_gemm_ukernel_1x16__avx,
+      .mr = 4,
+      .nr = 16,
+    };
+  } else {
+    xnn_params.f32.gemm_qc8w = (struct gemm_parameters) {
+      .gemm = (xnn_gemm_ukernel_function) xnn_f32_qc8w_gemm_ukernel_4x8__sse2,
+      .gemm1 = (xnn_gemm_ukernel_function) xnn_f32_qc8w_gemm_ukernel_1x8__sse2,
+      .mr = 4,
+      .nr = 8,
+    };
+  }
   xnn_params.f32.dwconv[0] = (struct dwconv_parameters) {
     .up = (xnn_dwconv_up_ukernel_function) xnn_f32_dwconv_ukernel_up4x4__sse,
     .cr = 4,
@@ -569,6 +1102,19 @@ static void init(void) {
     .cr = 4,
     .mr = 25,
   };
+  if (cpuinfo_has_x86_avx()) {
+    xnn_params.f32.dwconv[3] = (struct dwconv_parameters) {
+      .mp = (xnn_dwconv_mp_ukernel_function) xnn_f32_dwconv_ukernel_mp8x4__avx,
+      .cr = 8,
+      .qr = 4,
+    };
+  } else {
+    xnn_params.f32.dwconv[3] = (struct dwconv_parameters) {
+      .mp = (xnn_dwconv_mp_ukernel_function) xnn_f32_dwconv_ukernel_mp4x4__sse,
+      .cr = 4,
+      .qr = 4,
+    };
+  }
   xnn_params.f32.avgpool = (struct avgpool_parameters) {
     .up = (xnn_avgpool_up_ukernel_function) xnn_f32_avgpool_ukernel_up9__sse,
     .mp = (xnn_avgpool_mp_ukernel_function) xnn_f32_avgpool_ukernel_mp9p8q__sse,
@@ -606,20 +1152,127 @@ static void init(void) {
   };
   xnn_params.f32.clamp = (xnn_univector_ukernel_function) xnn_f32_clamp_ukernel__sse;
   xnn_params.f32.hswish = (xnn_univector_ukernel_function) xnn_f32_hswish_ukernel__sse;
+  if (cpuinfo_has_x86_avx512f()) {
+    xnn_params.f32.sigmoid = (xnn_univector_ukernel_function) xnn_f32_sigmoid_ukernel__avx512f_x32;
+    xnn_params.f32.tanh = (xnn_univector_ukernel_function) xnn_f32_tanh_ukernel__avx512f_x32;
+    xnn_params.f32.rmax = xnn_f32_rmax_ukernel__avx512f;
+    xnn_params.f32.raddstoreexpminusmax = xnn_f32_raddstoreexpminusmax_ukernel__avx512f_x64;
+  } else if (cpuinfo_has_x86_avx2() && cpuinfo_has_x86_fma3()) {
+    xnn_params.f32.sigmoid = (xnn_univector_ukernel_function) xnn_f32_sigmoid_ukernel__avx2_x16;
+    xnn_params.f32.tanh = (xnn_univector_ukernel_function) xnn_f32_tanh_ukernel__avx2_x16;
+    xnn_params.f32.rmax = xnn_f32_rmax_ukernel__avx;
+    xnn_params.f32.raddstoreexpminusmax = xnn_f32_raddstoreexpminusmax_ukernel__avx2_x32;
+  } else {
+    xnn_params.f32.sigmoid = (xnn_univector_ukernel_function) xnn_f32_sigmoid_ukernel__sse2_x8;
+    xnn_params.f32.tanh = (xnn_univector_ukernel_function) xnn_f32_tanh_ukernel__sse2_x8;
+    xnn_params.f32.rmax = cpuinfo_has_x86_avx() ? xnn_f32_rmax_ukernel__avx : xnn_f32_rmax_ukernel__sse;
+    xnn_params.f32.raddstoreexpminusmax = xnn_f32_raddstoreexpminusmax_ukernel__sse2_x8;
+  }
   xnn_params.f32.prelu = (struct prelu_parameters) {
     .ukernel = (xnn_prelu_ukernel_function) xnn_f32_prelu_ukernel_x4__sse,
     .mr = 4,
   };
-  xnn_params.f32.vadd = (xnn_vadd_ukernel_function) xnn_f32_vadd_ukernel__sse;
+  xnn_params.f32.vadd = (struct vbinary_parameters) {
+    .op_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vadd_ukernel__sse,
+    .opc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vaddc_ukernel__sse_x8,
+    .ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vaddc_ukernel__sse_x8,
+    .element_tile = 8,
+  };
+  xnn_params.f32.vdiv = (struct vbinary_parameters) {
+    .op_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vdiv_ukernel__sse_x8,
+    .opc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vdivc_ukernel__sse_x8,
+    .ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vrdivc_ukernel__sse_x8,
+    .element_tile = 8,
+  };
+  xnn_params.f32.vmax = (struct vbinary_parameters) {
+    .op_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vmax_ukernel__sse_x8,
+    .opc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vmaxc_ukernel__sse_x8,
+    .ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vmaxc_ukernel__sse_x8,
+    .element_tile = 8,
+  };
+  xnn_params.f32.vmin = (struct vbinary_parameters) {
+    .op_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vmin_ukernel__sse_x8,
+    .opc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vminc_ukernel__sse_x8,
+    .ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vminc_ukernel__sse_x8,
+    .element_tile = 8,
+  };
+  xnn_params.f32.vmul = (struct vbinary_parameters) {
+    .op_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vmul_ukernel__sse,
+    .opc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vmulc_ukernel__sse_x8,
+    .ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vmulc_ukernel__sse_x8,
+    .element_tile = 8,
+  };
+  xnn_params.f32.vsub = (struct vbinary_parameters) {
+    .op_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vsub_ukernel__sse,
+    .opc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vsubc_ukernel__sse_x8,
+    .ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vrsubc_ukernel__sse_x8,
+    .element_tile = 8,
+  };
   xnn_params.f32.vmulcaddc = (struct vmulcaddc_parameters) {
     .ukernel = (xnn_vmulcaddc_ukernel_function) xnn_f32_vmulcaddc_ukernel_c4__sse_x2,
     .cr = 4,
     .mr = 2,
   };
-  xnn_params.f32.spmm = (struct spmm_parameters) {
-    .ukernel = (xnn_spmm_ukernel_function) xnn_f32_spmm_ukernel_4x1__sse,
-    .mr = 4,
-    .nr = 1,
+  xnn_params.f32.winograd = (struct winograd_parameters) {
+    .input = (xnn_winograd_input_ukernel_function) xnn_f32_winograd_input_ukernel_6x6__sse,
+    .output = (xnn_winograd_output_ukernel_function) xnn_f32_winograd_output_ukernel_4x4__sse,
+    .min_channels = 32,
+  };
+  if (cpuinfo_has_x86_avx512f()) {
+    xnn_params.f32.spmm = (struct spmm_parameters) {
+      .ukernel = (xnn_spmm_ukernel_function) xnn_f32_spmm_ukernel_32x1__avx512f,
+      .mr = 32,
+      .nr = 1,
+    };
+    xnn_params.f32.spmm2 = (struct spmm_parameters) {
+      .ukernel = (xnn_spmm_ukernel_function) xnn_f32_spmm_ukernel_32x2__avx512f,
+      .mr = 32,
+      .nr = 2,
+    };
+    xnn_params.f32.spmm4 = (struct spmm_parameters) {
+      .ukernel = (xnn_spmm_ukernel_function) xnn_f32_spmm_ukernel_32x4__avx512f,
+      .mr = 32,
+      .nr = 4,
+    };
+  } else if (cpuinfo_has_x86_fma3()) {
+    xnn_params.f32.spmm = (struct spmm_parameters) {
+      .ukernel = (xnn_spmm_ukernel_function) xnn_f32_spmm_ukernel_32x1__fma3,
+      .mr = 32,
+      .nr = 1,
+    };
+    xnn_params.f32.spmm2 = (struct spmm_parameters) {
+      .ukernel = (xnn_spmm_ukernel_function) xnn_f32_spmm_ukernel_16x2__fma3,
+      .mr = 16,
+      .nr = 2,
+    };
+    xnn_params.f32.spmm4 = (struct spmm_parameters) {
+      .ukernel = (xnn_spmm_ukernel_function) xnn_f32_spmm_ukernel_16x4__fma3,
+      .mr = 16,
+      .nr = 4,
+    };
+  } else {
+    xnn_params.f32.spmm = (struct spmm_parameters) {
+      .ukernel = (xnn_spmm_ukernel_function) xnn_f32_spmm_ukernel_16x1__sse,
+      .mr = 16,
+      .nr = 1,
+    };
+    xnn_params.f32.spmm2 = (struct spmm_parameters) {
+      .ukernel = (xnn_spmm_ukernel_function) xnn_f32_spmm_ukernel_8x2__sse,
+      .mr = 8,
+      .nr = 2,
+    };
+    xnn_params.f32.spmm4 = (struct spmm_parameters) {
+      .ukernel = (xnn_spmm_ukernel_function) xnn_f32_spmm_ukernel_8x4__sse,
+      .mr = 8,
+      .nr = 4,
+    };
+  }
+  xnn_params.f32.hwc2spchw_dconv3x3c3s2 = (struct hwc2spchw_dconv_parameters) {
+    .ukernel_with_symm_padding =
+      (xnn_conv_hwc2spchw_ukernel_function) xnn_f32_conv_hwc2spchw_ukernel_3x3s2p1c3x4__sse_2x2,
+    .output_channel_tile = 4,
+    .output_height_tile = 2,
+    .output_width_tile = 2,
   };
   xnn_params.f32.spchw_dwconv3x3 = (struct spchw_dwconv_parameters) {
     .ukernel = (xnn_dwconv_spchw_ukernel_function) xnn_f32_dwconv_spchw_ukernel_3x3p1__sse,
@@ -633,6 +1286,18 @@ static void init(void) {
     .output_width_tile = 4,
     .output_height_tile = 1,
   };
+  xnn_params.f32.spchw_dwconv5x5 = (struct spchw_dwconv_parameters) {
+    .ukernel = (xnn_dwconv_spchw_ukernel_function) xnn_f32_dwconv_spchw_ukernel_5x5p2__sse,
+    .input_width_tile = 4,
+    .output_width_tile = 4,
+    .output_height_tile = 1,
+  };
+  xnn_params.f32.spchw_dwconv5x5s2 = (struct spchw_dwconv_parameters) {
+    .ukernel = (xnn_dwconv_spchw_ukernel_function) xnn_f32_dwconv_spchw_ukernel_5x5s2p2__sse,
+    .input_width_tile = 4,
+    .output_width_tile = 4,
+    .output_height_tile = 1,
+  };
   xnn_params.f32.spchw_gavgpool = (struct spchw_gavgpool_parameters) {
     .ukernel = (xnn_gavgpool_spchw_ukernel_function) xnn_f32_gavgpool_spchw_ukernel__sse_x4,
     .channel_tile = 4,
@@ -671,6 +1336,11 @@ static void init(void) {
     .cr = 1,
     .mr = 9,
   };
+  xnn_params.q8.dwconv[1] = (struct dwconv_parameters) {
+    .mp = (xnn_dwconv_mp_ukernel_function) xnn_q8_dwconv_ukernel_mp1x4__scalar,
+    .cr = 1,
+    .qr = 4,
+  };
   xnn_params.q8.avgpool = (struct avgpool_parameters) {
     .up = (xnn_avgpool_up_ukernel_function) xnn_q8_avgpool_ukernel_up9__scalar,
     .mp = (xnn_avgpool_mp_ukernel_function) xnn_q8_avgpool_ukernel_mp9p8q__scalar,
@@ -682,7 +1352,40 @@ static void init(void) {
     .mp = (xnn_gavgpool_mp_ukernel_function) xnn_q8_gavgpool_ukernel_mp7p7q__scalar,
     .mr = 7,
   };
-  xnn_params.q8.vadd = (xnn_vadd_ukernel_function) xnn_q8_vadd_ukernel__scalar;
+  xnn_params.q8.vadd = (struct vbinary_parameters) {
+    .op_ukernel = (xnn_vbinary_ukernel_function) xnn_q8_vadd_ukernel__scalar,
+    .opc_ukernel = (xnn_vbinary_ukernel_function) xnn_q8_vaddc_ukernel__scalar,
+    .ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_q8_vaddc_ukernel__scalar,
+    .element_tile = 1,
+  };
+  xnn_params.q8.vmul = (struct vbinary_parameters) {
+    .op_ukernel = (xnn_vbinary_ukernel_function) xnn_q8_vmul_ukernel__scalar,
+    .opc_ukernel = (xnn_vbinary_ukernel_function) xnn_q8_vmulc_ukernel__scalar,
+    .ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_q8_vmulc_ukernel__scalar,
+    .element_tile = 1,
+  };
+
+  /**************************** Q8C micro-kernels ****************************/
+  xnn_params.q8c.gemm = (struct gemm_parameters) {
+    .gemm = (xnn_gemm_ukernel_function) xnn_q8c_gemm_ukernel_2x2__scalar,
+    .igemm = (xnn_igemm_ukernel_function) xnn_q8c_igemm_ukernel_2x2__scalar,
+    .mr = 2,
+    .nr = 2,
+  };
+  xnn_params.q8c.dwconv = (struct dwconv_parameters) {
+    .up = (xnn_dwconv_up_ukernel_function) xnn_q8c_dwconv_ukernel_up1x9__scalar,
+    .cr = 1,
+    .mr = 9,
+  };
+
+  /**************************** Q8DQ micro-kernels ****************************/
+  xnn_params.q8dq.gemm = (struct q8dq_gemm_parameters) {
+    .gemm = xnn_q8dq_gemm_ukernel_2x2__scalar,
+    .mr = 2,
+    .nr = 2,
+  };
+  xnn_params.q8dq.rabsmax = xnn_f32_rabsmax_ukernel__scalar;
+  xnn_params.q8dq.vquantize = xnn_f32_vquantize_ukernel__scalar;
 
   /**************************** U8 micro-kernels ****************************/
   xnn_params.u8.maxpool = (struct maxpool_parameters) {
@@ -703,6 +1406,28 @@ static void init(void) {
     .xm = (xnn_zipv_ukernel_function) xnn_x8_zip_xm_ukernel__scalar,
   };
 
+  /**************************** F16 micro-kernels ****************************/
+  xnn_params.f16.gemm = (struct gemm_parameters) {
+    .gemm = (xnn_gemm_ukernel_function) xnn_f16_gemm_ukernel_4x4__scalar,
+    .igemm = (xnn_igemm_ukernel_function) xnn_f16_igemm_ukernel_4x4__scalar,
+    .gemm1 = (xnn_gemm_ukernel_function) xnn_f16_gemm_ukernel_1x4__scalar,
+    .igemm1 = (xnn_igemm_ukernel_function) xnn_f16_igemm_ukernel_1x4__scalar,
+    .mr = 4,
+    .nr = 4,
+  };
+  xnn_params.f16.dwconv = (struct dwconv_parameters) {
+    .up = (xnn_dwconv_up_ukernel_function) xnn_f16_dwconv_ukernel_up1x9__scalar,
+    .cr = 1,
+    .mr = 9,
+  };
+  xnn_params.f16.gavgpool = (struct gavgpool_parameters) {
+    .up = (xnn_gavgpool_up_ukernel_function) xnn_f16_gavgpool_ukernel_up7__scalar,
+    .mp = (xnn_gavgpool_mp_ukernel_function) xnn_f16_gavgpool_ukernel_mp7p7q__scalar,
+    .mr = 7,
+  };
+  xnn_params.f16.clamp = (xnn_univector_ukernel_function) xnn_f16_clamp_ukernel__scalar;
+  xnn_params.f16.vadd = (xnn_vadd_ukernel_function) xnn_f16_vadd_ukernel__scalar;
+
   /**************************** F32 micro-kernels ****************************/
   if (is_wasm_x86) {
     xnn_params.f32.gemm = (struct gemm_parameters) {
@@ -710,6 +1435,8 @@ static void init(void) {
       .igemm = (xnn_igemm_ukernel_function) xnn_f32_igemm_ukernel_4x8s4__psimd,
       .gemm1 = (xnn_gemm_ukernel_function) xnn_f32_gemm_ukernel_1x8s4__psimd,
       .igemm1 = (xnn_igemm_ukernel_function) xnn_f32_igemm_ukernel_1x8s4__psimd,
+      .gemminc = (xnn_gemminc_ukernel_function) xnn_f32_gemminc_ukernel_4x8s4__psimd,
+      .gemminc1 = (xnn_gemminc_ukernel_function) xnn_f32_gemminc_ukernel_1x8s4__psimd,
       .mr = 4,
       .nr = 8,
       .log2_sr = 2,
@@ -720,6 +1447,8 @@ static void init(void) {
       .igemm = (xnn_igemm_ukernel_function) xnn_f32_igemm_ukernel_6x8s4__psimd,
       .gemm1 = (xnn_gemm_ukernel_function) xnn_f32_igemm_ukernel_1x8s4__psimd,
       .igemm1 = (xnn_igemm_ukernel_function) xnn_f32_igemm_ukernel_1x8s4__psimd,
+      .gemminc = (xnn_gemminc_ukernel_function) xnn_f32_gemminc_ukernel_6x8s4__psimd,
+      .gemminc1 = (xnn_gemminc_ukernel_function) xnn_f32_gemminc_ukernel_1x8s4__psimd,
       .mr = 6,
       .nr = 8,
       .log2_sr = 2,
@@ -732,6 +1461,18 @@ static void init(void) {
     .nr = 2,
     .log2_kr = 2,
   };
+  xnn_params.f32.gemm_f16w = (struct gemm_parameters) {
+    .gemm = (xnn_gemm_ukernel_function) xnn_f32_f16w_gemm_ukernel_4x4__scalar,
+    .gemm1 = (xnn_gemm_ukernel_function) xnn_f32_f16w_gemm_ukernel_1x4__scalar,
+    .mr = 4,
+    .nr = 4,
+  };
+  xnn_params.f32.gemm_qc8w = (struct gemm_parameters) {
+    .gemm = (xnn_gemm_ukernel_function) xnn_f32_qc8w_gemm_ukernel_4x4__scalar,
+    .gemm1 = (xnn_gemm_ukernel_function) xnn_f32_qc8w_gemm_ukernel_1x4__scalar,
+    .mr = 4,
+    .nr = 4,
+  };
   xnn_params.f32.dwconv[0] = (struct dwconv_parameters) {
     .up = (xnn_dwconv_up_ukernel_function) xnn_f32_dwconv_ukernel_up4x4__psimd,
     .cr = 4,
@@ -747,6 +1488,11 @@ static void init(void) {
     .cr = 4,
     .mr = 25,
   };
+  xnn_params.f32.dwconv[3] = (struct dwconv_parameters) {
+    .mp = (xnn_dwconv_mp_ukernel_function) xnn_f32_dwconv_ukernel_mp4x4__psimd,
+    .cr = 4,
+    .qr = 4,
+  };
   xnn_params.f32.avgpool = (struct avgpool_parameters) {
     .up = (xnn_avgpool_up_ukernel_function) xnn_f32_avgpool_ukernel_up9__psimd,
     .mp = (xnn_avgpool_mp_ukernel_function) xnn_f32_avgpool_ukernel_mp9p8q__psimd,
@@ -784,16 +1530,60 @@ static void init(void) {
   };
   xnn_params.f32.clamp = (xnn_univector_ukernel_function) xnn_f32_clamp_ukernel__psimd;
   xnn_params.f32.hswish = (xnn_univector_ukernel_function) xnn_f32_hswish_ukernel__psimd;
+  xnn_params.f32.sigmoid = (xnn_univector_ukernel_function) xnn_f32_sigmoid_ukernel__scalar_x2;
+  xnn_params.f32.tanh = (xnn_univector_ukernel_function) xnn_f32_tanh_ukernel__scalar_x2;
+  xnn_params.f32.rmax = xnn_f32_rmax_ukernel__scalar;
+  xnn_params.f32.raddstoreexpminusmax = xnn_f32_raddstoreexpminusmax_ukernel__scalar_x4;
   xnn_params.f32.prelu = (struct prelu_parameters) {
     .ukernel = (xnn_prelu_ukernel_function) xnn_f32_prelu_ukernel_x4__psimd,
     .mr = 4,
   };
-  xnn_params.f32.vadd = (xnn_vadd_ukernel_function) xnn_f32_vadd_ukernel__psimd;
+  xnn_params.f32.vadd = (struct vbinary_parameters) {
+    .op_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vadd_ukernel__psimd,
+    .opc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vaddc_ukernel__psimd_x8,
+    .ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vaddc_ukernel__psimd_x8,
+    .element_tile = 8,
+  };
+  xnn_params.f32.vdiv = (struct vbinary_parameters) {
+    .op_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vdiv_ukernel__psimd_x8,
+    .opc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vdivc_ukernel__psimd_x8,
+    .ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vrdivc_ukernel__psimd_x8,
+    .element_tile = 8,
+  };
+  xnn_params.f32.vmax = (struct vbinary_parameters) {
+    .op_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vmax_ukernel__psimd_x8,
+    .opc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vmaxc_ukernel__psimd_x8,
+    .ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vmaxc_ukernel__psimd_x8,
+    .element_tile = 8,
+  };
+  xnn_params.f32.vmin = (struct vbinary_parameters) {
+    .op_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vmin_ukernel__psimd_x8,
+    .opc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vminc_ukernel__psimd_x8,
+    .ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vminc_ukernel__psimd_x8,
+    .element_tile = 8,
+  };
+  xnn_params.f32.vmul = (struct vbinary_parameters) {
+    .op_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vmul_ukernel__psimd,
+    .opc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vmulc_ukernel__psimd_x8,
+    .ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vmulc_ukernel__psimd_x8,
+    .element_tile = 8,
+  };
+  xnn_params.f32.vsub = (struct vbinary_parameters) {
+    .op_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vsub_ukernel__psimd,
+    .opc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vsubc_ukernel__psimd_x8,
+    .ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vrsubc_ukernel__psimd_x8,
+    .element_tile = 8,
+  };
   xnn_params.f32.vmulcaddc = (struct vmulcaddc_parameters) {
     .ukernel = (xnn_vmulcaddc_ukernel_function) xnn_f32_vmulcaddc_ukernel_c4__psimd_x2,
     .cr = 4,
     .mr = 2,
   };
+  xnn_params.f32.winograd = (struct winograd_parameters) {
+    .input = (xnn_winograd_input_ukernel_function) xnn_f32_winograd_input_ukernel_6x6__psimd,
+    .output = (xnn_winograd_output_ukernel_function) xnn_f32_winograd_output_ukernel_4x4__psimd,
+    .min_channels = 32,
+  };
 
   /**************************** X32 micro-kernels ****************************/
   xnn_params.x32.pad = (struct pad_parameters) {
@@ -828,6 +1618,11 @@ static void init(void) {
     .cr = 1,
     .mr = 9,
   };
+  xnn_params.q8.dwconv[1] = (struct dwconv_parameters) {
+    .mp = (xnn_dwconv_mp_ukernel_function) xnn_q8_dwconv_ukernel_mp1x4__scalar,
+    .cr = 1,
+    .qr = 4,
+  };
   xnn_params.q8.avgpool = (struct avgpool_parameters) {
     .up = (xnn_avgpool_up_ukernel_function) xnn_q8_avgpool_ukernel_up9__scalar,
     .mp = (xnn_avgpool_mp_ukernel_function) xnn_q8_avgpool_ukernel_mp9p8q__scalar,
@@ -839,7 +1634,40 @@ static void init(void) {
     .mp = (xnn_gavgpool_mp_ukernel_function) xnn_q8_gavgpool_ukernel_mp7p7q__scalar,
     .mr = 7,
   };
-  xnn_params.q8.vadd = (xnn_vadd_ukernel_function) xnn_q8_vadd_ukernel__scalar;
+  xnn_params.q8.vadd = (struct vbinary_parameters) {
+    .op_ukernel = (xnn_vbinary_ukernel_function) xnn_q8_vadd_ukernel__scalar,
+    .opc_ukernel = (xnn_vbinary_ukernel_function) xnn_q8_vaddc_ukernel__scalar,
+    .ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_q8_vaddc_ukernel__scalar,
+    .element_tile = 1,
+  };
+  xnn_params.q8.vmul = (struct vbinary_parameters) {
+    .op_ukernel = (xnn_vbinary_ukernel_function) xnn_q8_vmul_ukernel__scalar,
+    .opc_ukernel = (xnn_vbinary_ukernel_function) xnn_q8_vmulc_ukernel__scalar,
+    .ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_q8_vmulc_ukernel__scalar,
+    .element_tile = 1,
+  };
+
+  /**************************** Q8C micro-kernels ****************************/
+  xnn_params.q8c.gemm = (struct gemm_parameters) {
+    .gemm = (xnn_gemm_ukernel_function) xnn_q8c_gemm_ukernel_2x2__scalar,
+    .igemm = (xnn_igemm_ukernel_function) xnn_q8c_igemm_ukernel_2x2__scalar,
+    .mr = 2,
+    .nr = 2,
+  };
+  xnn_params.q8c.dwconv = (struct dwconv_parameters) {
+    .up = (xnn_dwconv_up_ukernel_function) xnn_q8c_dwconv_ukernel_up1x9__scalar,
+    .cr = 1,
+    .mr = 9,
+  };
+
+  /**************************** Q8DQ micro-kernels ****************************/
+  xnn_params.q8dq.gemm = (struct q8dq_gemm_parameters) {
+    .gemm = xnn_q8dq_gemm_ukernel_2x2__scalar,
+    .mr = 2,
+    .nr = 2,
+  };
+  xnn_params.q8dq.rabsmax = xnn_f32_rabsmax_ukernel__scalar;
+  xnn_params.q8dq.vquantize = xnn_f32_vquantize_ukernel__scalar;
 
   /**************************** U8 micro-kernels ****************************/
   xnn_params.u8.maxpool = (struct maxpool_parameters) {
@@ -860,6 +1688,28 @@ static void init(void) {
     .xm = (xnn_zipv_ukernel_function) xnn_x8_zip_xm_ukernel__scalar,
   };
 
+  /**************************** F16 micro-kernels ****************************/
+  xnn_params.f16.gemm = (struct gemm_parameters) {
+    .gemm = (xnn_gemm_ukernel_function) xnn_f16_gemm_ukernel_4x4__scalar,
+    .igemm = (xnn_igemm_ukernel_function) xnn_f16_igemm_ukernel_4x4__scalar,
+    .gemm1 = (xnn_gemm_ukernel_function) xnn_f16_gemm_ukernel_1x4__scalar,
+    .igemm1 = (xnn_igemm_ukernel_function) xnn_f16_igemm_ukernel_1x4__scalar,
+    .mr = 4,
+    .nr = 4,
+  };
+  xnn_params.f16.dwconv = (struct dwconv_parameters) {
+    .up = (xnn_dwconv_up_ukernel_function) xnn_f16_dwconv_ukernel_up1x9__scalar,
+    .cr = 1,
+    .mr = 9,
+  };
+  xnn_params.f16.gavgpool = (struct gavgpool_parameters) {
+    .up = (xnn_gavgpool_up_ukernel_function) xnn_f16_gavgpool_ukernel_up7__scalar,
+    .mp = (xnn_gavgpool_mp_ukernel_function) xnn_f16_gavgpool_ukernel_mp7p7q__scalar,
+    .mr = 7,
+  };
+  xnn_params.f16.clamp = (xnn_univector_ukernel_function) xnn_f16_clamp_ukernel__scalar;
+  xnn_params.f16.vadd = (xnn_vadd_ukernel_function) xnn_f16_vadd_ukernel__scalar;
+
   /**************************** F32 micro-kernels ****************************/
   if (is_wasm_x86) {
     xnn_params.f32.gemm = (struct gemm_parameters) {
@@ -867,6 +1717,8 @@ static void init(void) {
       .igemm = (xnn_igemm_ukernel_function) xnn_f32_igemm_ukernel_2x4__scalar,
       .gemm1 = (xnn_gemm_ukernel_function) xnn_f32_gemm_ukernel_1x4__scalar,
       .igemm1 = (xnn_igemm_ukernel_function) xnn_f32_igemm_ukernel_1x4__scalar,
+      .gemminc = (xnn_gemminc_ukernel_function) xnn_f32_gemminc_ukernel_2x4__scalar,
+      .gemminc1 = (xnn_gemminc_ukernel_function) xnn_f32_gemminc_ukernel_1x4__scalar,
       .mr = 2,
       .nr = 4,
     };
@@ -876,6 +1728,8 @@ static void init(void) {
       .igemm = (xnn_igemm_ukernel_function) xnn_f32_igemm_ukernel_4x4__scalar,
       .gemm1 = (xnn_gemm_ukernel_function) xnn_f32_gemm_ukernel_1x4__scalar,
       .igemm1 = (xnn_igemm_ukernel_function) xnn_f32_igemm_ukernel_1x4__scalar,
+      .gemminc = (xnn_gemminc_ukernel_function) xnn_f32_gemminc_ukernel_4x4__scalar,
+      .gemminc1 = (xnn_gemminc_ukernel_function) xnn_f32_gemminc_ukernel_1x4__scalar,
       .mr = 4,
       .nr = 4,
     };
@@ -886,6 +1740,18 @@ static void init(void) {
     .mr = 4,
     .nr = 2,
   };
+  xnn_params.f32.gemm_f16w = (struct gemm_parameters) {
+    .gemm = (xnn_gemm_ukernel_function) xnn_f32_f16w_gemm_ukernel_4x4__scalar,
+    .gemm1 = (xnn_gemm_ukernel_function) xnn_f32_f16w_gemm_ukernel_1x4__scalar,
+    .mr = 4,
+    .nr = 4,
+  };
+  xnn_params.f32.gemm_qc8w = (struct gemm_parameters) {
+    .gemm = (xnn_gemm_ukernel_function) xnn_f32_qc8w_gemm_ukernel_4x4__scalar,
+    .gemm1 = (xnn_gemm_ukernel_function) xnn_f32_qc8w_gemm_ukernel_1x4__scalar,
+    .mr = 4,
+    .nr = 4,
+  };
   xnn_params.f32.dwconv[0] = (struct dwconv_parameters) {
     .up = (xnn_dwconv_up_ukernel_function) xnn_f32_dwconv_ukernel_up1x4__scalar,
     .cr = 1,
@@ -901,6 +1767,11 @@ static void init(void) {
     .cr = 1,
     .mr = 25,
   };
+  xnn_params.f32.dwconv[3] = (struct dwconv_parameters) {
+    .mp = (xnn_dwconv_mp_ukernel_function) xnn_f32_dwconv_ukernel_mp1x4__scalar,
+    .cr = 1,
+    .qr = 4,
+  };
   xnn_params.f32.avgpool = (struct avgpool_parameters) {
     .up = (xnn_avgpool_up_ukernel_function) xnn_f32_avgpool_ukernel_up9__scalar,
     .mp = (xnn_avgpool_mp_ukernel_function) xnn_f32_avgpool_ukernel_mp9p8q__scalar,
@@ -938,16 +1809,60 @@ static void init(void) {
   };
   xnn_params.f32.clamp = (xnn_univector_ukernel_function) xnn_f32_clamp_ukernel__scalar;
   xnn_params.f32.hswish = (xnn_univector_ukernel_function) xnn_f32_hswish_ukernel__scalar;
+  xnn_params.f32.sigmoid = (xnn_univector_ukernel_function) xnn_f32_sigmoid_ukernel__scalar_x2;
+  xnn_params.f32.tanh = (xnn_univector_ukernel_function) xnn_f32_tanh_ukernel__scalar_x2;
+  xnn_params.f32.rmax = xnn_f32_rmax_ukernel__scalar;
+  xnn_params.f32.raddstoreexpminusmax = xnn_f32_raddstoreexpminusmax_ukernel__scalar_x4;
   xnn_params.f32.prelu = (struct prelu_parameters) {
     .ukernel = (xnn_prelu_ukernel_function) xnn_f32_prelu_ukernel_x4__scalar,
     .mr = 4,
   };
-  xnn_params.f32.vadd = (xnn_vadd_ukernel_function) xnn_f32_vadd_ukernel__scalar;
+  xnn_params.f32.vadd = (struct vbinary_parameters) {
+    .op_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vadd_ukernel__scalar,
+    .opc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vaddc_ukernel__scalar_x2,
+    .ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vaddc_ukernel__scalar_x2,
+    .element_tile = 2,
+  };
+  xnn_params.f32.vdiv = (struct vbinary_parameters) {
+    .op_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vdiv_ukernel__scalar_x2,
+    .opc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vdivc_ukernel__scalar_x2,
+    .ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vrdivc_ukernel__scalar_x2,
+    .element_tile = 2,
+  };
+  xnn_params.f32.vmax = (struct vbinary_parameters) {
+    .op_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vmax_ukernel__scalar_x2,
+    .opc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vmaxc_ukernel__scalar_x2,
+    .ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vmaxc_ukernel__scalar_x2,
+    .element_tile = 2,
+  };
+  xnn_params.f32.vmin = (struct vbinary_parameters) {
+    .op_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vmin_ukernel__scalar_x2,
+    .opc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vminc_ukernel__scalar_x2,
+    .ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vminc_ukernel__scalar_x2,
+    .element_tile = 2,
+  };
+  xnn_params.f32.vmul = (struct vbinary_parameters) {
+    .op_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vmul_ukernel__scalar,
+    .opc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vmulc_ukernel__scalar_x2,
+    .ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vmulc_ukernel__scalar_x2,
+    .element_tile = 2,
+  };
+  xnn_params.f32.vsub = (struct vbinary_parameters) {
+    .op_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vsub_ukernel__scalar,
+    .opc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vsubc_ukernel__scalar_x2,
+    .ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vrsubc_ukernel__scalar_x2,
+    .element_tile = 2,
+  };
   xnn_params.f32.vmulcaddc = (struct vmulcaddc_parameters) {
     .ukernel = (xnn_vmulcaddc_ukernel_function) xnn_f32_vmulcaddc_ukernel_c1__scalar_x2,
     .cr = 1,
     .mr = 2,
   };
+  xnn_params.f32.winograd = (struct winograd_parameters) {
+    .input = (xnn_winograd_input_ukernel_function) xnn_f32_winograd_input_ukernel_6x6__scalar,
+    .output = (xnn_winograd_output_ukernel_function) xnn_f32_winograd_output_ukernel_4x4__scalar,
+    .min_channels = 32,
+  };
   xnn_params.f32.spmm = (struct spmm_parameters) {
     .ukernel = (xnn_spmm_ukernel_function) xnn_f32_spmm_ukernel_4x1__scalar,
     .mr = 4,
@@ -970,6 +1885,9 @@ static void init(void) {
 #else
   #error "Unsupported architecture"
 #endif
+  #ifndef __EMSCRIPTEN__
+    init_f32_gemm_blocking();
+  #endif
   xnn_params.initialized = true;
 }
 
@@ -179,6 +179,8 @@ enum xnn_status xnn_setup_leaky_relu_nc_q8(
     return xnn_status_success;
   }
 
+  leaky_relu_op->batch_size = batch_size;
+
   const size_t channels = leaky_relu_op->channels;
   const size_t input_stride = leaky_relu_op->input_pixel_stride;
   const size_t output_stride = leaky_relu_op->output_pixel_stride;
@@ -147,6 +147,7 @@ enum xnn_status xnn_create_max_pooling2d_nhwc_u8(
   max_pooling_op->channels = channels;
   max_pooling_op->input_pixel_stride = input_pixel_stride;
   max_pooling_op->output_pixel_stride = output_pixel_stride;
+  max_pooling_op->compact_indirection = (flags & XNN_FLAG_COMPACT_INDIRECTION) != 0;
 
   max_pooling_op->u8_output_params = xnn_compute_u8_output_params(output_min, output_max);
 
@@ -288,6 +289,7 @@ enum xnn_status xnn_create_max_pooling2d_nhwc_f32(
   max_pooling_op->channels = channels;
   max_pooling_op->input_pixel_stride = input_pixel_stride;
   max_pooling_op->output_pixel_stride = output_pixel_stride;
+  max_pooling_op->compact_indirection = (flags & XNN_FLAG_COMPACT_INDIRECTION) != 0;
 
   max_pooling_op->f32_output_params = xnn_compute_f32_output_params(output_min, output_max);
 
@@ -353,19 +355,6 @@ enum xnn_status xnn_setup_max_pooling2d_nhwc_u8(
       max_pooling_op->stride_width);
   max_pooling_op->output = output;
 
-  size_t valid_batch_size = 0;
-  if (input == max_pooling_op->last_input &&
-      input_height == max_pooling_op->last_input_height &&
-      input_width == max_pooling_op->last_input_width)
-  {
-    valid_batch_size = max_pooling_op->valid_batch_size;
-    if (batch_size <= valid_batch_size) {
-      max_pooling_op->compute.range[0] = batch_size;
-      max_pooling_op->state = xnn_run_state_ready;
-      return xnn_status_success;
-    }
-  }
-
   const size_t pooling_height = max_pooling_op->kernel_height;
   const size_t pooling_width = max_pooling_op->kernel_width;
   const size_t pooling_size = pooling_height * pooling_width;
@@ -373,36 +362,95 @@ enum xnn_status xnn_setup_max_pooling2d_nhwc_u8(
   const size_t output_width = max_pooling_op->output_width;
   // Micro-kernel may read up to (mr - 1) elements after the end of indirection buffer.
   const uint32_t mr = xnn_params.u8.maxpool.mr;
+  const uint32_t qr = xnn_params.u8.maxpool.qr;
 
   const size_t step_width =
     max_pooling_op->dilation_width > 1 ? pooling_width : min(max_pooling_op->stride_width, pooling_width);
   const size_t step_height = pooling_size + (output_width * step_width - 1) * pooling_height;
-  const size_t indirection_buffer_size = sizeof(void*) * ((mr - 1) + batch_size * output_height * step_height);
+  const size_t multipass_adjustment = round_up(doz(pooling_size, mr), qr) + mr;
+
+  const bool compact_indirection = max_pooling_op->compact_indirection &&
+    multipass_adjustment <= XNN_MAX_REBASED_INDIRECTION_POINTERS &&
+    input_height * input_width * max_pooling_op->input_pixel_stride < (size_t) XNN_COMPACT_INDIRECTION_ZERO;
+  const size_t indirection_element_size = compact_indirection ? sizeof(uint32_t) : sizeof(void*);
+  if (compact_indirection) {
+    // Compact indirection buffer covers a single image, and does not depend on the input pointer or batch size.
+    if (input_height != max_pooling_op->last_input_height || input_width != max_pooling_op->last_input_width) {
+      const size_t indirection_buffer_size = sizeof(uint32_t) * ((mr - 1) + output_height * step_height);
+
+      const void** indirection_buffer = (const void**) realloc(max_pooling_op->indirection_buffer, indirection_buffer_size);
+      if (indirection_buffer == NULL) {
+        xnn_log_error("failed to allocate %zu bytes for indirection buffer", indirection_buffer_size);
+        return xnn_status_out_of_memory;
+      }
+      max_pooling_op->indirection_buffer = indirection_buffer;
+
+      xnn_indirection_init_maxpool2d_compact(max_pooling_op, step_height, step_width);
+
+      max_pooling_op->last_input = input;
+      max_pooling_op->last_input_height = input_height;
+      max_pooling_op->last_input_width = input_width;
+      max_pooling_op->valid_batch_size = 0;
+    }
+  } else {
+    // The indirection buffer stays valid when only the input pointer changes: setup rebases a cached copy of it to the
+    // new input pointer. It is extended incrementally for larger batches of the same input.
+    size_t valid_batch_size = 0;
+    if (input_height == max_pooling_op->last_input_height &&
+        input_width == max_pooling_op->last_input_width &&
+        (input == max_pooling_op->last_input || batch_size <= max_pooling_op->valid_batch_size))
+    {
+      valid_batch_size = max_pooling_op->valid_batch_size;
+    }
+
+    if (batch_size > valid_batch_size) {
+      const size_t indirection_buffer_size = sizeof(void*) * ((mr - 1) + batch_size * output_height * step_height);
 
-  const void** indirection_buffer = (const void**) realloc(max_pooling_op->indirection_buffer, indirection_buffer_size);
-  if (indirection_buffer == NULL) {
-    xnn_log_error("failed to allocate %zu bytes for indirection buffer", indirection_buffer_size);
-    return xnn_status_out_of_memory;
+      const void** indirection_buffer = (const void**) realloc(max_pooling_op->indirection_buffer, indirection_buffer_size);
+      if (indirection_buffer == NULL) {
+        xnn_log_error("failed to allocate %zu bytes for indirection buffer", indirection_buffer_size);
+        return xnn_status_out_of_memory;
+      }
+      max_pooling_op->indirection_buffer = indirection_buffer;
+
+      xnn_indirection_init_maxpool2d(max_pooling_op, valid_batch_size, step_height, step_width, 0 /* log2(sizeof(uint8_t)) */);
+
+      max_pooling_op->last_input = input;
+      max_pooling_op->last_input_height = input_height;
+      max_pooling_op->last_input_width = input_width;
+      max_pooling_op->valid_batch_size = batch_size;
+    }
   }
-  max_pooling_op->indirection_buffer = indirection_buffer;
 
-  xnn_indirection_init_maxpool2d(max_pooling_op, valid_batch_size, step_height, step_width, 0 /* log2(sizeof(uint8_t)) */);
+  const void** indirection_buffer = max_pooling_op->indirection_buffer;
+  if (!compact_indirection) {
+    indirection_buffer = xnn_indirection_rebase(
+      max_pooling_op, max_pooling_op->last_input, input, (mr - 1) + batch_size * output_height * step_height,
+      NULL /* zero */);
+    if (indirection_buffer == NULL) {
+      return xnn_status_out_of_memory;
+    }
+  }
 
-  const uint32_t qr = xnn_params.u8.maxpool.qr;
   const size_t channels = max_pooling_op->channels;
 
-  const size_t indirect_input_height_stride = step_height * sizeof(void*);
+  const size_t indirect_input_height_stride = step_height * indirection_element_size;
   const size_t output_width_stride = max_pooling_op->output_pixel_stride * sizeof(uint8_t);
   const size_t output_height_stride = output_width * output_width_stride;
-  const size_t multipass_adjustment = round_up(doz(pooling_size, mr), qr) + mr;
 
   max_pooling_op->context.max_pooling = (struct max_pooling_context) {
       .indirect_input = indirection_buffer,
-      .indirect_input_batch_stride = output_height * indirect_input_height_stride,
+      .indirect_input_batch_stride = compact_indirection ? 0 : output_height * indirect_input_height_stride,
       .indirect_input_height_stride = indirect_input_height_stride,
+      .indirect_input_width_stride = pooling_height * step_width * indirection_element_size,
+      .indirect_input_pixel_size = multipass_adjustment,
+      .input = input,
+      .input_batch_stride = input_height * input_width * max_pooling_op->input_pixel_stride * sizeof(uint8_t),
+      .log2_input_element_size = 0 /* log2(sizeof(uint8_t)) */,
       .output = output,
       .output_batch_stride = output_height * output_height_stride,
       .output_height_stride = output_height_stride,
+      .output_width_stride = output_width_stride,
       .output_width = output_width,
       .pooling_size = pooling_size,
       .channels = channels,
@@ -412,16 +460,12 @@ enum xnn_status xnn_setup_max_pooling2d_nhwc_u8(
       .ukernel = xnn_params.u8.maxpool.ukernel,
   };
   max_pooling_op->compute.type = xnn_parallelization_type_2d;
-  max_pooling_op->compute.task_2d = (pthreadpool_task_2d_t) xnn_compute_max_pooling;
+  max_pooling_op->compute.task_2d = compact_indirection ?
+    (pthreadpool_task_2d_t) xnn_compute_max_pooling_compact : (pthreadpool_task_2d_t) xnn_compute_max_pooling;
   max_pooling_op->compute.range[0] = batch_size;
   max_pooling_op->compute.range[1] = output_height;
   max_pooling_op->state = xnn_run_state_ready;
 
-  max_pooling_op->last_input = input;
-  max_pooling_op->last_input_height = input_height;
-  max_pooling_op->last_input_width = input_width;
-  max_pooling_op->valid_batch_size = max(valid_batch_size, batch_size);
-
   return xnn_status_success;
 }
 
@@ -475,19 +519,6 @@ enum xnn_status xnn_setup_max_pooling2d_nhwc_f32(
       max_pooling_op->stride_width);
   max_pooling_op->output = output;
 
-  size_t valid_batch_size = 0;
-  if (input == max_pooling_op->last_input &&
-      input_height == max_pooling_op->last_input_height &&
-      input_width == max_pooling_op->last_input_width)
-  {
-    valid_batch_size = max_pooling_op->valid_batch_size;
-    if (batch_size <= valid_batch_size) {
-      max_pooling_op->compute.range[0] = batch_size;
-      max_pooling_op->state = xnn_run_state_ready;
-      return xnn_status_success;
-    }
-  }
-
   const size_t pooling_height = max_pooling_op->kernel_height;
   const size_t pooling_width = max_pooling_op->kernel_width;
   const size_t pooling_size = pooling_height * pooling_width;
@@ -495,36 +526,95 @@ enum xnn_status xnn_setup_max_pooling2d_nhwc_f32(
   const size_t output_width = max_pooling_op->output_width;
   // Micro-kernel may read up to (mr - 1) elements after the end of indirection buffer.
   const uint32_t mr = xnn_params.f32.maxpool.mr;
+  const uint32_t qr = xnn_params.f32.maxpool.qr;
 
   const size_t step_width =
     max_pooling_op->dilation_width > 1 ? pooling_width : min(max_pooling_op->stride_width, pooling_width);
   const size_t step_height = pooling_size + (output_width * step_width - 1) * pooling_height;
-  const size_t indirection_buffer_size = sizeof(void*) * ((mr - 1) + batch_size * output_height * step_height);
+  const size_t multipass_adjustment = round_up(doz(pooling_size, mr), qr) + mr;
+
+  const bool compact_indirection = max_pooling_op->compact_indirection &&
+    multipass_adjustment <= XNN_MAX_REBASED_INDIRECTION_POINTERS &&
+    input_height * input_width * max_pooling_op->input_pixel_stride < (size_t) XNN_COMPACT_INDIRECTION_ZERO;
+  const size_t indirection_element_size = compact_indirection ? sizeof(uint32_t) : sizeof(void*);
+  if (compact_indirection) {
+    // Compact indirection buffer covers a single image, and does not depend on the input pointer or batch size.
+    if (input_height != max_pooling_op->last_input_height || input_width != max_pooling_op->last_input_width) {
+      const size_t indirection_buffer_size = sizeof(uint32_t) * ((mr - 1) + output_height * step_height);
+
+      const void** indirection_buffer = (const void**) realloc(max_pooling_op->indirection_buffer, indirection_buffer_size);
+      if (indirection_buffer == NULL) {
+        xnn_log_error("failed to allocate %zu bytes for indirection buffer", indirection_buffer_size);
+        return xnn_status_out_of_memory;
+      }
+      max_pooling_op->indirection_buffer = indirection_buffer;
+
+      xnn_indirection_init_maxpool2d_compact(max_pooling_op, step_height, step_width);
+
+      max_pooling_op->last_input = input;
+      max_pooling_op->last_input_height = input_height;
+      max_pooling_op->last_input_width = input_width;
+      max_pooling_op->valid_batch_size = 0;
+    }
+  } else {
+    // The indirection buffer stays valid when only the input pointer changes: setup rebases a cached copy of it to the
+    // new input pointer. It is extended incrementally for larger batches of the same input.
+    size_t valid_batch_size = 0;
+    if (input_height == max_pooling_op->last_input_height &&
+        input_width == max_pooling_op->last_input_width &&
+        (input == max_pooling_op->last_input || batch_size <= max_pooling_op->valid_batch_size))
+    {
+      valid_batch_size = max_pooling_op->valid_batch_size;
+    }
+
+    if (batch_size > valid_batch_size) {
+      const size_t indirection_buffer_size = sizeof(void*) * ((mr - 1) + batch_size * output_height * step_height);
 
-  const void** indirection_buffer = (const void**) realloc(max_pooling_op->indirection_buffer, indirection_buffer_size);
-  if (indirection_buffer == NULL) {
-    xnn_log_error("failed to allocate %zu bytes for indirection buffer", indirection_buffer_size);
-    return xnn_status_out_of_memory;
+      const void** indirection_buffer = (const void**) realloc(max_pooling_op->indirection_buffer, indirection_buffer_size);
+      if (indirection_buffer == NULL) {
+        xnn_log_error("failed to allocate %zu bytes for indirection buffer", indirection_buffer_size);
+        return xnn_status_out_of_memory;
+      }
+      max_pooling_op->indirection_buffer = indirection_buffer;
+
+      xnn_indirection_init_maxpool2d(max_pooling_op, valid_batch_size, step_height, step_width, 2 /* log2(sizeof(float)) */);
+
+      max_pooling_op->last_input = input;
+      max_pooling_op->last_input_height = input_height;
+      max_pooling_op->last_input_width = input_width;
+      max_pooling_op->valid_batch_size = batch_size;
+    }
   }
-  max_pooling_op->indirection_buffer = indirection_buffer;
 
-  xnn_indirection_init_maxpool2d(max_pooling_op, valid_batch_size, step_height, step_width, 2 /* log2(sizeof(float)) */);
+  const void** indirection_buffer = max_pooling_op->indirection_buffer;
+  if (!compact_indirection) {
+    indirection_buffer = xnn_indirection_rebase(
+      max_pooling_op, max_pooling_op->last_input, input, (mr - 1) + batch_size * output_height * step_height,
+      NULL /* zero */);
+    if (indirection_buffer == NULL) {
+      return xnn_status_out_of_memory;
+    }
+  }
 
-  const uint32_t qr = xnn_params.f32.maxpool.qr;
   const size_t channels = max_pooling_op->channels;
 
-  const size_t indirect_input_height_stride = step_height * sizeof(void*);
+  const size_t indirect_input_height_stride = step_height * indirection_element_size;
   const size_t output_width_stride = max_pooling_op->output_pixel_stride * sizeof(float);
   const size_t output_height_stride = output_width * output_width_stride;
-  const size_t multipass_adjustment = round_up(doz(pooling_size, mr), qr) + mr;
 
   max_pooling_op->context.max_pooling = (struct max_pooling_context) {
       .indirect_input = indirection_buffer,
-      .indirect_input_batch_stride = output_height * indirect_input_height_stride,
+      .indirect_input_batch_stride = compact_indirection ? 0 : output_height * indirect_input_height_stride,
       .indirect_input_height_stride = indirect_input_height_stride,
+      .indirect_input_width_stride = pooling_height * step_width * indirection_element_size,
+      .indirect_input_pixel_size = multipass_adjustment,
+      .input = input,
+      .input_batch_stride = input_height * input_width * max_pooling_op->input_pixel_stride * sizeof(float),
+      .log2_input_element_size = 2 /* log2(sizeof(float)) */,
       .output = output,
       .output_batch_stride = output_height * output_height_stride,
       .output_height_stride = output_height_stride,
+      .output_width_stride = output_width_stride,
       .output_width = output_width,
       .pooling_size = pooling_size,
       .channels = channels,
@@ -534,15 +624,11 @@ enum xnn_status xnn_setup_max_pooling2d_nhwc_f32(
       .ukernel = xnn_params.f32.maxpool.ukernel,
   };
   max_pooling_op->compute.type = xnn_parallelization_type_2d;
-  max_pooling_op->compute.task_2d = (pthreadpool_task_2d_t) xnn_compute_max_pooling;
+  max_pooling_op->compute.task_2d = compact_indirection ?
+    (pthreadpool_task_2d_t) xnn_compute_max_pooling_compact : (pthreadpool_task_2d_t) xnn_compute_max_pooling;
   max_pooling_op->compute.range[0] = batch_size;
   max_pooling_op->compute.range[1] = output_height;
   max_pooling_op->state = xnn_run_state_ready;
 
-  max_pooling_op->last_input = input;
-  max_pooling_op->last_input_height = input_height;
-  max_pooling_op->last_input_width = input_width;
-  max_pooling_op->valid_batch_size = max(valid_batch_size, batch_size);
-
   return xnn_status_success;
 }
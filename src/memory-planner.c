@@ -0,0 +1,157 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <xnnpack.h>
+#include <xnnpack/allocator.h>
+#include <xnnpack/log.h>
+#include <xnnpack/math.h>
+#include <xnnpack/memory-planner.h>
+#include <xnnpack/subgraph.h>
+
+
+enum xnn_status xnn_init_value_allocation_tracker(
+    struct xnn_value_allocation_tracker* tracker,
+    const struct xnn_subgraph* subgraph)
+{
+  tracker->subgraph = subgraph;
+  tracker->mem_arena_size = 0;
+  tracker->usage = NULL;
+  if (subgraph->num_values == 0) {
+    return xnn_status_success;
+  }
+
+  const size_t usage_size = sizeof(struct xnn_usage_record) * subgraph->num_values;
+  tracker->usage = xnn_allocate_zero_memory(usage_size);
+  if (tracker->usage == NULL) {
+    xnn_log_error("failed to allocate %zu bytes for value usage records", usage_size);
+    return xnn_status_out_of_memory;
+  }
+
+  for (uint32_t i = 0; i < subgraph->num_values; i++) {
+    tracker->usage[i].first_node = XNN_INVALID_NODE_ID;
+  }
+  for (uint32_t n = 0; n < subgraph->num_nodes; n++) {
+    const struct xnn_node* node = &subgraph->nodes[n];
+    for (uint32_t i = 0; i < node->num_inputs; i++) {
+      struct xnn_usage_record* usage = &tracker->usage[node->inputs[i]];
+      usage->first_node = min(usage->first_node, n);
+      usage->last_node = n;
+    }
+    for (uint32_t o = 0; o < node->num_outputs; o++) {
+      struct xnn_usage_record* usage = &tracker->usage[node->outputs[o]];
+      usage->first_node = min(usage->first_node, n);
+      usage->last_node = n;
+    }
+  }
+  return xnn_status_success;
+}
+
+void xnn_add_value_allocation_tracker(
+    struct xnn_value_allocation_tracker* tracker,
+    uint32_t value_id,
+    size_t tensor_size)
+{
+  assert(value_id < tracker->subgraph->num_values);
+  assert(tracker->usage[value_id].first_node != XNN_INVALID_NODE_ID);
+
+  tracker->usage[value_id].tensor_size = tensor_size;
+}
+
+// Orders usage records by decreasing size. Ties are broken by value ID to keep the plan deterministic.
+static int compare_usage_record_size(const void* a, const void* b) {
+  const struct xnn_usage_record* usage_a = *((const struct xnn_usage_record* const*) a);
+  const struct xnn_usage_record* usage_b = *((const struct xnn_usage_record* const*) b);
+  if (usage_a->tensor_size != usage_b->tensor_size) {
+    return usage_a->tensor_size > usage_b->tensor_size ? -1 : 1;
+  }
+  return usage_a < usage_b ? -1 : 1;
+}
+
+static int compare_usage_record_offset(const void* a, const void* b) {
+  const struct xnn_usage_record* usage_a = *((const struct xnn_usage_record* const*) a);
+  const struct xnn_usage_record* usage_b = *((const struct xnn_usage_record* const*) b);
+  if (usage_a->alloc_offset != usage_b->alloc_offset) {
+    return usage_a->alloc_offset < usage_b->alloc_offset ? -1 : 1;
+  }
+  return usage_a < usage_b ? -1 : 1;
+}
+
+enum xnn_status xnn_plan_value_allocation_tracker(
+    struct xnn_value_allocation_tracker* tracker)
+{
+  const uint32_t num_values = tracker->subgraph->num_values;
+  size_t num_records = 0;
+  for (uint32_t i = 0; i < num_values; i++) {
+    if (tracker->usage[i].tensor_size != 0) {
+      num_records++;
+    }
+  }
+  tracker->mem_arena_size = 0;
+  if (num_records == 0) {
+    return xnn_status_success;
+  }
+
+  // Both lists are allocated in a single block: records in placement order, followed by a scratch list of placed
+  // records which are live at the same time as the record being placed.
+  const size_t lists_size = 2 * sizeof(struct xnn_usage_record*) * num_records;
+  struct xnn_usage_record** sorted_records = xnn_allocate_memory(lists_size);
+  if (sorted_records == NULL) {
+    xnn_log_error("failed to allocate %zu bytes for memory planning", lists_size);
+    return xnn_status_out_of_memory;
+  }
+  struct xnn_usage_record** live_records = sorted_records + num_records;
+
+  size_t r = 0;
+  for (uint32_t i = 0; i < num_values; i++) {
+    if (tracker->usage[i].tensor_size != 0) {
+      sorted_records[r++] = &tracker->usage[i];
+    }
+  }
+  // Greedy by size: placing large values first leaves the small gaps to the small values.
+  qsort(sorted_records, num_records, sizeof(struct xnn_usage_record*), compare_usage_record_size);
+
+  size_t mem_arena_size = 0;
+  for (size_t i = 0; i < num_records; i++) {
+    struct xnn_usage_record* record = sorted_records[i];
+
+    size_t num_live_records = 0;
+    for (size_t j = 0; j < i; j++) {
+      struct xnn_usage_record* placed_record = sorted_records[j];
+      if (placed_record->last_node >= record->first_node && placed_record->first_node <= record->last_node) {
+        live_records[num_live_records++] = placed_record;
+      }
+    }
+    qsort(live_records, num_live_records, sizeof(struct xnn_usage_record*), compare_usage_record_offset);
+
+    // Take the lowest offset where the value fits without overlapping any live value.
+    size_t offset = 0;
+    for (size_t j = 0; j < num_live_records; j++) {
+      const struct xnn_usage_record* live_record = live_records[j];
+      if (offset + record->tensor_size <= live_record->alloc_offset) {
+        break;
+      }
+      offset = max(offset,
+        round_up_po2(live_record->alloc_offset + live_record->tensor_size, XNN_ALLOCATION_ALIGNMENT));
+    }
+    record->alloc_offset = offset;
+    mem_arena_size = max(mem_arena_size, offset + record->tensor_size);
+  }
+  tracker->mem_arena_size = mem_arena_size;
+
+  xnn_release_memory(sorted_records);
+  return xnn_status_success;
+}
+
+void xnn_release_value_allocation_tracker(
+    struct xnn_value_allocation_tracker* tracker)
+{
+  xnn_release_memory(tracker->usage);
+  tracker->usage = NULL;
+}
@@ -13,6 +13,7 @@
 #include <xnnpack/log.h>
 #include <xnnpack/operator.h>
 #include <xnnpack/params.h>
+#include <xnnpack/shape-cache.h>
 
 
 enum xnn_status xnn_delete_operator(xnn_operator_t op)
@@ -27,12 +28,24 @@ enum xnn_status xnn_delete_operator(xnn_operator_t op)
   }
 
   free(op->indirection_buffer);
-  xnn_release_memory(op->packed_weights);
+  for (size_t i = 0; i < XNN_MAX_REBASED_INDIRECTION_BUFFERS; i++) {
+    free(op->rebased_indirection[i].buffer);
+  }
+  if (op->parent == NULL) {
+    // Execution contexts borrow immutable state from the parent operator.
+    if (!op->packed_weights_external) {
+      xnn_release_memory(op->packed_weights);
+    }
+    xnn_release_memory(op->zero_buffer);
+    xnn_release_memory(op->lookup_table);
+  }
   free(op->a_sum);
-  xnn_release_memory(op->zero_buffer);
   free(op->pixelwise_buffer);
+  xnn_release_memory(op->packed_input);
+  xnn_release_memory(op->partial_output);
+  xnn_release_memory(op->transformed_input);
   free(op->subconvolution_buffer);
-  xnn_release_memory(op->lookup_table);
+  xnn_release_shape_cache(&op->shape_cache);
   xnn_release_memory(op);
   return xnn_status_success;
 }
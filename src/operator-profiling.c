@@ -0,0 +1,618 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+  // clock_gettime is not declared in strict C99 mode.
+  #define _POSIX_C_SOURCE 199309L
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifdef _WIN32
+  #include <windows.h>
+#else
+  #include <time.h>
+#endif
+
+#include <xnnpack.h>
+#include <xnnpack/compute.h>
+#include <xnnpack/log.h>
+#include <xnnpack/operator.h>
+#include <xnnpack/params.h>
+#include <xnnpack/profiling.h>
+
+
+uint64_t xnn_read_timer_ns(void) {
+#ifdef _WIN32
+  LARGE_INTEGER frequency, counter;
+  QueryPerformanceFrequency(&frequency);
+  QueryPerformanceCounter(&counter);
+  return (uint64_t) ((double) counter.QuadPart * (1.0e+9 / (double) frequency.QuadPart));
+#else
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t) ts.tv_sec * UINT64_C(1000000000) + (uint64_t) ts.tv_nsec;
+#endif
+}
+
+void xnn_record_operator_run(
+    xnn_operator_t op,
+    pthreadpool_t threadpool,
+    uint64_t time_ns)
+{
+  struct xnn_operator_profiling* profiling = &op->profiling;
+  profiling->num_threads = pthreadpool_get_threads_count(threadpool);
+  if (profiling->run_count == 0 || time_ns < profiling->min_time_ns) {
+    profiling->min_time_ns = time_ns;
+  }
+  profiling->run_count += 1;
+  profiling->total_time_ns += time_ns;
+  profiling->last_time_ns = time_ns;
+}
+
+static const char* operator_name(enum xnn_operator_type type) {
+  switch (type) {
+    case xnn_operator_type_none:
+      break;
+    case xnn_operator_type_add_f16:
+      return "Add (NC, F16)";
+    case xnn_operator_type_add_f32:
+      return "Add (NC, F32)";
+    case xnn_operator_type_add_nd_f32:
+      return "Add (ND, F32)";
+    case xnn_operator_type_add_nd_q8:
+      return "Add (ND, Q8)";
+    case xnn_operator_type_add_q8:
+      return "Add (NC, Q8)";
+    case xnn_operator_type_argmax_pooling_f32:
+      return "ArgMax Pooling (NHWC, F32)";
+    case xnn_operator_type_average_pooling_f32:
+      return "Average Pooling (NHWC, F32)";
+    case xnn_operator_type_average_pooling_q8:
+      return "Average Pooling (NHWC, Q8)";
+    case xnn_operator_type_channel_pad_x32:
+      return "Channel Pad (NC, X32)";
+    case xnn_operator_type_channel_shuffle_x8:
+      return "Channel Shuffle (NC, X8)";
+    case xnn_operator_type_channel_shuffle_x32:
+      return "Channel Shuffle (NC, X32)";
+    case xnn_operator_type_clamp_f16:
+      return "Clamp (NC, F16)";
+    case xnn_operator_type_clamp_f32:
+      return "Clamp (NC, F32)";
+    case xnn_operator_type_clamp_u8:
+      return "Clamp (NC, U8)";
+    case xnn_operator_type_convolution_f16:
+      return "Convolution (NHWC, F16)";
+    case xnn_operator_type_convolution_f32:
+      return "Convolution (NHWC, F32)";
+    case xnn_operator_type_convolution_spnchw_f32:
+      return "Convolution (SpNCHW, F32)";
+    case xnn_operator_type_convolution_q8:
+      return "Convolution (NHWC, Q8)";
+    case xnn_operator_type_convolution_q8c:
+      return "Convolution (NHWC, Q8, per-channel)";
+    case xnn_operator_type_deconvolution_f32:
+      return "Deconvolution (NHWC, F32)";
+    case xnn_operator_type_deconvolution_q8:
+      return "Deconvolution (NHWC, Q8)";
+    case xnn_operator_type_divide_nd_f32:
+      return "Divide (ND, F32)";
+    case xnn_operator_type_fully_connected_f16:
+      return "Fully Connected (NC, F16)";
+    case xnn_operator_type_fully_connected_f32:
+      return "Fully Connected (NC, F32)";
+    case xnn_operator_type_fully_connected_q8:
+      return "Fully Connected (NC, Q8)";
+    case xnn_operator_type_fully_connected_q8c:
+      return "Fully Connected (NC, Q8, per-channel)";
+    case xnn_operator_type_fully_connected_q8dq:
+      return "Fully Connected (NC, Q8, dynamic)";
+    case xnn_operator_type_global_average_pooling_f16:
+      return "Global Average Pooling (NWC, F16)";
+    case xnn_operator_type_global_average_pooling_f32:
+      return "Global Average Pooling (NWC, F32)";
+    case xnn_operator_type_global_average_pooling_q8:
+      return "Global Average Pooling (NWC, Q8)";
+    case xnn_operator_type_global_average_pooling_spnchw_f32:
+      return "Global Average Pooling (SpNCHW, F32)";
+    case xnn_operator_type_hswish_f32:
+      return "HardSwish (NC, F32)";
+    case xnn_operator_type_leaky_relu_q8:
+      return "Leaky ReLU (NC, Q8)";
+    case xnn_operator_type_max_pooling_f32:
+      return "Max Pooling (NHWC, F32)";
+    case xnn_operator_type_max_pooling_u8:
+      return "Max Pooling (NHWC, U8)";
+    case xnn_operator_type_maximum_nd_f32:
+      return "Maximum (ND, F32)";
+    case xnn_operator_type_minimum_nd_f32:
+      return "Minimum (ND, F32)";
+    case xnn_operator_type_multiply_nd_f32:
+      return "Multiply (ND, F32)";
+    case xnn_operator_type_multiply_nd_q8:
+      return "Multiply (ND, Q8)";
+    case xnn_operator_type_prelu_f32:
+      return "PReLU (NC, F32)";
+    case xnn_operator_type_sigmoid_f32:
+      return "Sigmoid (NC, F32)";
+    case xnn_operator_type_sigmoid_q8:
+      return "Sigmoid (NC, Q8)";
+    case xnn_operator_type_softargmax_q8:
+      return "SoftArgMax (NC, Q8)";
+    case xnn_operator_type_softmax_f32:
+      return "SoftMax (NC, F32)";
+    case xnn_operator_type_subtract_nd_f32:
+      return "Subtract (ND, F32)";
+    case xnn_operator_type_tanh_f32:
+      return "TanH (NC, F32)";
+    case xnn_operator_type_unpooling_x32:
+      return "Unpooling (NHWC, X32)";
+  }
+  return "Unknown";
+}
+
+static const char* ukernel_name(const struct xnn_operator* op) {
+  switch (op->ukernel.type) {
+    case xnn_ukernel_type_none:
+      break;
+    case xnn_ukernel_type_add:
+      return "VADD";
+    case xnn_ukernel_type_argmax_pooling:
+      return "ARGMAXPOOL";
+    case xnn_ukernel_type_average_pooling:
+      return "AVGPOOL";
+    case xnn_ukernel_type_channel_shuffle:
+      return "ZIP";
+    case xnn_ukernel_type_clamp:
+      return "CLAMP";
+    case xnn_ukernel_type_igemm:
+      return "IGEMM";
+    case xnn_ukernel_type_dconv2d_hwc2spchw:
+      return "CONV (HWC to SpCHW)";
+    case xnn_ukernel_type_dwconv:
+      return op->type == xnn_operator_type_convolution_spnchw_f32 ? "DWCONV (SpCHW)" : "DWCONV";
+    case xnn_ukernel_type_gemm:
+      // GEMM operators switch between several execution strategies at setup time, depending on the shape.
+      if (op->compute2.type == xnn_parallelization_type_2d_tile_2d &&
+          op->compute2.task_2d_tile_2d == (pthreadpool_task_2d_tile_2d_t) xnn_compute_ppmm)
+      {
+        return "PPMM";
+      }
+      if (op->compute.type == xnn_parallelization_type_2d_tile_1d &&
+          op->compute.task_2d_tile_1d == (pthreadpool_task_2d_tile_1d_t) xnn_compute_splitk_gemm)
+      {
+        return "GEMM (split-K)";
+      }
+      if (op->compute.type == xnn_parallelization_type_2d_tile_2d &&
+          op->compute.task_2d_tile_2d == (pthreadpool_task_2d_tile_2d_t) xnn_compute_blocked_gemm)
+      {
+        return "GEMM (cache-blocked)";
+      }
+      return "GEMM";
+    case xnn_ukernel_type_global_average_pooling:
+      return "GAVGPOOL";
+    case xnn_ukernel_type_hswish:
+      return "HSWISH";
+    case xnn_ukernel_type_lut:
+      return "LUT";
+    case xnn_ukernel_type_max_pooling:
+      return "MAXPOOL";
+    case xnn_ukernel_type_pad:
+      return "PAD";
+    case xnn_ukernel_type_pixelwise_average_pooling:
+      return "PAVGPOOL";
+    case xnn_ukernel_type_prelu:
+      return "PRELU";
+    case xnn_ukernel_type_sigmoid:
+      return "SIGMOID";
+    case xnn_ukernel_type_softargmax:
+      return "SOFTARGMAX";
+    case xnn_ukernel_type_spmm:
+      return "SpMM";
+    case xnn_ukernel_type_subconv2d:
+      return "IGEMM (subconvolution)";
+    case xnn_ukernel_type_tanh:
+      return "TANH";
+    case xnn_ukernel_type_unpooling:
+      return "UNPOOL";
+    case xnn_ukernel_type_vbinary:
+      return "VBINARY";
+    case xnn_ukernel_type_vmulcaddc:
+      return "VMULCADDC";
+    case xnn_ukernel_type_winograd:
+      return "WINOGRAD";
+  }
+  return "none";
+}
+
+static void get_ukernel_tile(const struct xnn_operator* op, struct xnn_operator_profile* profile) {
+  switch (op->ukernel.type) {
+    case xnn_ukernel_type_gemm:
+      if (op->type == xnn_operator_type_fully_connected_q8dq) {
+        profile->mr = op->ukernel.q8dq_gemm.mr;
+        profile->nr = op->ukernel.q8dq_gemm.nr;
+        profile->kr = op->ukernel.q8dq_gemm.kr;
+        break;
+      }
+      if (op->compute2.type == xnn_parallelization_type_2d_tile_2d &&
+          op->compute2.task_2d_tile_2d == (pthreadpool_task_2d_tile_2d_t) xnn_compute_ppmm)
+      {
+        profile->mr = op->ukernel.gemm.ppmm.mr;
+      } else {
+        profile->mr = op->ukernel.gemm.mr;
+      }
+      profile->nr = op->ukernel.gemm.nr;
+      profile->kr = op->ukernel.gemm.kr;
+      break;
+    case xnn_ukernel_type_igemm:
+    case xnn_ukernel_type_subconv2d:
+      profile->mr = op->ukernel.igemm.mr;
+      profile->nr = op->ukernel.igemm.nr;
+      profile->kr = op->ukernel.igemm.kr;
+      break;
+    case xnn_ukernel_type_dconv2d_hwc2spchw:
+      profile->mr = op->ukernel.dconv2d.output_height_tile;
+      profile->nr = op->ukernel.dconv2d.output_channel_tile;
+      break;
+    case xnn_ukernel_type_dwconv:
+      if (op->type == xnn_operator_type_convolution_spnchw_f32) {
+        profile->mr = op->ukernel.dwconv2d.output_width_tile;
+      } else {
+        profile->mr = op->ukernel.dwconv.mr != 0 ? op->ukernel.dwconv.mr : op->ukernel.dwconv.qr;
+      }
+      break;
+    case xnn_ukernel_type_spmm:
+      profile->mr = op->ukernel.spmm.mr;
+      break;
+    case xnn_ukernel_type_vmulcaddc:
+      profile->mr = op->ukernel.vmulcaddc.mr;
+      break;
+    case xnn_ukernel_type_winograd:
+      profile->mr = op->ukernel.winograd.mr;
+      profile->nr = op->ukernel.winograd.nr;
+      profile->kr = op->ukernel.winograd.kr;
+      break;
+    default:
+      break;
+  }
+}
+
+static uint32_t parallelization_dims(enum xnn_parallelization_type type) {
+  switch (type) {
+    case xnn_parallelization_type_invalid:
+      break;
+    case xnn_parallelization_type_1d:
+    case xnn_parallelization_type_1d_tile_1d:
+      return 1;
+    case xnn_parallelization_type_2d:
+    case xnn_parallelization_type_2d_tile_1d:
+    case xnn_parallelization_type_2d_tile_2d:
+      return 2;
+    case xnn_parallelization_type_3d_tile_2d:
+      return 3;
+    case xnn_parallelization_type_4d_tile_2d:
+      return 4;
+    case xnn_parallelization_type_5d_tile_2d:
+      return 5;
+    case xnn_parallelization_type_6d_tile_2d:
+      return 6;
+  }
+  return 0;
+}
+
+// Adjusts the sizes of weight and bias elements for F32 operators with FP16 or INT8 weights.
+static void count_compressed_weights(
+    const struct xnn_operator* op,
+    uint64_t* weights_element_size,
+    uint64_t* bias_element_size)
+{
+  switch (op->weights_type) {
+    case xnn_weights_type_f16:
+      *weights_element_size = sizeof(uint16_t);
+      break;
+    case xnn_weights_type_qc8:
+      // Every output channel stores a dequantization scale next to its bias.
+      *weights_element_size = sizeof(int8_t);
+      *bias_element_size = sizeof(float) + sizeof(float);
+      break;
+    default:
+      break;
+  }
+}
+
+// Counts arithmetic operations and compulsory memory traffic in one run of the operator from its setup parameters.
+static void count_operator_work(const struct xnn_operator* op, uint64_t* flops_out, uint64_t* bytes_out) {
+  const uint64_t batch_size = op->batch_size;
+  const uint64_t input_pixels = batch_size * op->input_height * op->input_width;
+  const uint64_t output_pixels = batch_size * op->output_height * op->output_width;
+  const uint64_t kernel_size = (uint64_t) op->kernel_height * (uint64_t) op->kernel_width;
+  const uint64_t groups = op->groups;
+  const uint64_t group_input_channels = op->group_input_channels;
+  const uint64_t group_output_channels = op->group_output_channels;
+  const uint64_t channels = op->channels;
+  uint64_t flops = 0;
+  uint64_t bytes = 0;
+  switch (op->type) {
+    case xnn_operator_type_none:
+      break;
+    case xnn_operator_type_convolution_f16:
+      flops = 2 * output_pixels * groups * group_input_channels * group_output_channels * kernel_size;
+      bytes = sizeof(uint16_t) * (input_pixels * groups * group_input_channels +
+          output_pixels * groups * group_output_channels +
+          groups * group_output_channels * (kernel_size * group_input_channels + 1));
+      break;
+    case xnn_operator_type_convolution_f32:
+    case xnn_operator_type_convolution_q8:
+    case xnn_operator_type_convolution_q8c:
+    {
+      const uint64_t element_size = op->type == xnn_operator_type_convolution_f32 ? sizeof(float) : sizeof(uint8_t);
+      // Per-channel quantized operators store a requantization scale next to each bias element.
+      uint64_t bias_element_size =
+        op->type == xnn_operator_type_convolution_q8c ? sizeof(int32_t) + sizeof(float) : sizeof(int32_t);
+      uint64_t weights_element_size = element_size;
+      count_compressed_weights(op, &weights_element_size, &bias_element_size);
+      if (op->ukernel.type == xnn_ukernel_type_spmm) {
+        // Sparse 1x1 Convolution: only non-zero weights contribute.
+        flops = 2 * output_pixels * op->num_nonzero_values;
+        bytes = sizeof(float) * (input_pixels * groups * group_input_channels +
+            output_pixels * groups * group_output_channels +
+            op->num_nonzero_values + groups * group_output_channels) +
+          sizeof(int32_t) * op->num_nonzero_blocks;
+        break;
+      }
+      flops = 2 * output_pixels * groups * group_input_channels * group_output_channels * kernel_size;
+      bytes = element_size * (input_pixels * groups * group_input_channels +
+          output_pixels * groups * group_output_channels) +
+        weights_element_size * groups * group_output_channels * kernel_size * group_input_channels +
+        bias_element_size * groups * group_output_channels;
+      break;
+    }
+    case xnn_operator_type_convolution_spnchw_f32:
+      if (op->ukernel.type == xnn_ukernel_type_spmm) {
+        // Sparse 1x1 Convolution: only non-zero weights contribute.
+        flops = 2 * output_pixels * op->num_nonzero_values;
+        bytes = sizeof(float) * (input_pixels * groups * group_input_channels +
+            output_pixels * groups * group_output_channels +
+            op->num_nonzero_values + groups * group_output_channels) +
+          sizeof(int32_t) * op->num_nonzero_values;
+      } else {
+        flops = 2 * output_pixels * groups * group_input_channels * group_output_channels * kernel_size;
+        bytes = sizeof(float) * (input_pixels * groups * group_input_channels +
+            output_pixels * groups * group_output_channels +
+            groups * group_output_channels * (kernel_size * group_input_channels + 1));
+      }
+      break;
+    case xnn_operator_type_deconvolution_f32:
+    case xnn_operator_type_deconvolution_q8:
+    {
+      const uint64_t element_size = op->type == xnn_operator_type_deconvolution_f32 ? sizeof(float) : sizeof(uint8_t);
+      flops = 2 * input_pixels * groups * group_input_channels * group_output_channels * kernel_size;
+      bytes = element_size * (input_pixels * groups * group_input_channels +
+          output_pixels * groups * group_output_channels +
+          groups * group_output_channels * kernel_size * group_input_channels) +
+        sizeof(int32_t) * groups * group_output_channels;
+      break;
+    }
+    case xnn_operator_type_fully_connected_f16:
+    {
+      const uint64_t rows = op->input_height;
+      flops = 2 * rows * group_input_channels * group_output_channels;
+      bytes = sizeof(uint16_t) * (rows * group_input_channels + rows * group_output_channels +
+          group_output_channels * (group_input_channels + 1));
+      break;
+    }
+    case xnn_operator_type_fully_connected_f32:
+    case xnn_operator_type_fully_connected_q8:
+    case xnn_operator_type_fully_connected_q8c:
+    {
+      // Fully Connected operator is setup as a 1x1 Convolution with input_height rows.
+      const uint64_t element_size = op->type == xnn_operator_type_fully_connected_f32 ? sizeof(float) : sizeof(uint8_t);
+      uint64_t bias_element_size =
+        op->type == xnn_operator_type_fully_connected_q8c ? sizeof(int32_t) + sizeof(float) : sizeof(int32_t);
+      uint64_t weights_element_size = element_size;
+      count_compressed_weights(op, &weights_element_size, &bias_element_size);
+      const uint64_t rows = op->input_height;
+      if (op->ukernel.type == xnn_ukernel_type_spmm) {
+        // Sparse weights: only non-zero weights contribute.
+        flops = 2 * rows * op->num_nonzero_values;
+        bytes = sizeof(float) * (rows * group_input_channels + rows * group_output_channels +
+            op->num_nonzero_values + group_output_channels) +
+          sizeof(int32_t) * op->num_nonzero_blocks;
+        break;
+      }
+      flops = 2 * rows * group_input_channels * group_output_channels;
+      bytes = element_size * (rows * group_input_channels + rows * group_output_channels) +
+        weights_element_size * group_output_channels * group_input_channels +
+        bias_element_size * group_output_channels;
+      break;
+    }
+    case xnn_operator_type_fully_connected_q8dq:
+    {
+      // F32 input and output rows, Q8 weights, and F32 bias with Q8 zero point correction.
+      const uint64_t rows = op->input_height;
+      flops = 2 * rows * group_input_channels * group_output_channels;
+      bytes = sizeof(float) * (rows * group_input_channels + rows * group_output_channels) +
+        sizeof(uint8_t) * group_output_channels * group_input_channels +
+        (sizeof(int32_t) + sizeof(float)) * group_output_channels;
+      break;
+    }
+    case xnn_operator_type_argmax_pooling_f32:
+      flops = output_pixels * channels * kernel_size;
+      bytes = sizeof(float) * input_pixels * channels + (sizeof(float) + sizeof(uint32_t)) * output_pixels * channels;
+      break;
+    case xnn_operator_type_average_pooling_f32:
+    case xnn_operator_type_max_pooling_f32:
+      flops = output_pixels * channels * kernel_size;
+      bytes = sizeof(float) * (input_pixels + output_pixels) * channels;
+      break;
+    case xnn_operator_type_average_pooling_q8:
+    case xnn_operator_type_max_pooling_u8:
+      flops = output_pixels * channels * kernel_size;
+      bytes = sizeof(uint8_t) * (input_pixels + output_pixels) * channels;
+      break;
+    case xnn_operator_type_global_average_pooling_f16:
+      flops = batch_size * op->input_width * channels;
+      bytes = sizeof(uint16_t) * (batch_size * op->input_width + batch_size) * channels;
+      break;
+    case xnn_operator_type_global_average_pooling_f32:
+      flops = batch_size * op->input_width * channels;
+      bytes = sizeof(float) * (batch_size * op->input_width + batch_size) * channels;
+      break;
+    case xnn_operator_type_global_average_pooling_q8:
+      flops = batch_size * op->input_width * channels;
+      bytes = sizeof(uint8_t) * (batch_size * op->input_width + batch_size) * channels;
+      break;
+    case xnn_operator_type_global_average_pooling_spnchw_f32:
+      flops = input_pixels * channels;
+      bytes = sizeof(float) * (input_pixels + batch_size) * channels;
+      break;
+    case xnn_operator_type_add_f16:
+      flops = batch_size * channels;
+      bytes = 3 * sizeof(uint16_t) * batch_size * channels;
+      break;
+    case xnn_operator_type_add_f32:
+      flops = batch_size * channels;
+      bytes = 3 * sizeof(float) * batch_size * channels;
+      break;
+    case xnn_operator_type_add_q8:
+      flops = batch_size * channels;
+      bytes = 3 * sizeof(uint8_t) * batch_size * channels;
+      break;
+    case xnn_operator_type_add_nd_f32:
+    case xnn_operator_type_divide_nd_f32:
+    case xnn_operator_type_maximum_nd_f32:
+    case xnn_operator_type_minimum_nd_f32:
+    case xnn_operator_type_multiply_nd_f32:
+    case xnn_operator_type_subtract_nd_f32:
+      // Batch size is the number of output elements, input height and width are the numbers of input elements.
+      flops = batch_size;
+      bytes = sizeof(float) * (op->input_height + op->input_width + batch_size);
+      break;
+    case xnn_operator_type_add_nd_q8:
+    case xnn_operator_type_multiply_nd_q8:
+      flops = batch_size;
+      bytes = sizeof(uint8_t) * (op->input_height + op->input_width + batch_size);
+      break;
+    case xnn_operator_type_clamp_f16:
+      flops = 2 * batch_size * channels;
+      bytes = 2 * sizeof(uint16_t) * batch_size * channels;
+      break;
+    case xnn_operator_type_clamp_f32:
+      // Min and max per element.
+      flops = 2 * batch_size * channels;
+      bytes = 2 * sizeof(float) * batch_size * channels;
+      break;
+    case xnn_operator_type_clamp_u8:
+      flops = 2 * batch_size * channels;
+      bytes = 2 * sizeof(uint8_t) * batch_size * channels;
+      break;
+    case xnn_operator_type_hswish_f32:
+      // x * min(max(x + 3, 0), 6) / 6 is five operations per element.
+      flops = 5 * batch_size * channels;
+      bytes = 2 * sizeof(float) * batch_size * channels;
+      break;
+    case xnn_operator_type_prelu_f32:
+      flops = batch_size * channels;
+      bytes = sizeof(float) * (2 * batch_size * channels + channels);
+      break;
+    case xnn_operator_type_leaky_relu_q8:
+    case xnn_operator_type_sigmoid_q8:
+      // Table lookups do not count as arithmetic operations.
+      bytes = 2 * sizeof(uint8_t) * batch_size * channels;
+      break;
+    case xnn_operator_type_softargmax_q8:
+      // Maximum, sum of exponentials (via table lookup), and scaling per element.
+      flops = 3 * batch_size * channels;
+      bytes = 2 * sizeof(uint8_t) * batch_size * channels;
+      break;
+    case xnn_operator_type_sigmoid_f32:
+      // Range reduction and degree-5 polynomial for exp(-|x|), division, and sign reconstruction.
+      flops = 20 * batch_size * channels;
+      bytes = 2 * sizeof(float) * batch_size * channels;
+      break;
+    case xnn_operator_type_softmax_f32:
+      // Maximum, exponential and its accumulation, and scaling per element. The input is read twice, and the
+      // output is written, re-read, and re-written.
+      flops = 20 * batch_size * channels;
+      bytes = 5 * sizeof(float) * batch_size * channels;
+      break;
+    case xnn_operator_type_tanh_f32:
+      // Clamping, degree-13 odd numerator and degree-6 even denominator polynomials, and division.
+      flops = 27 * batch_size * channels;
+      bytes = 2 * sizeof(float) * batch_size * channels;
+      break;
+    case xnn_operator_type_channel_pad_x32:
+      bytes = sizeof(uint32_t) * batch_size *
+        (2 * channels + op->pad_before_channels + op->pad_after_channels);
+      break;
+    case xnn_operator_type_channel_shuffle_x8:
+      bytes = 2 * sizeof(uint8_t) * batch_size * groups * op->group_channels;
+      break;
+    case xnn_operator_type_channel_shuffle_x32:
+      bytes = 2 * sizeof(uint32_t) * batch_size * groups * op->group_channels;
+      break;
+    case xnn_operator_type_unpooling_x32:
+      bytes = (sizeof(uint32_t) + sizeof(uint32_t)) * input_pixels * channels +
+        sizeof(uint32_t) * output_pixels * channels;
+      break;
+  }
+  *flops_out = flops;
+  *bytes_out = bytes;
+}
+
+enum xnn_status xnn_enable_operator_profiling(
+    xnn_operator_t op,
+    bool enable)
+{
+  if (!xnn_params.initialized) {
+    xnn_log_error("failed to enable operator profiling: XNNPACK is not initialized");
+    return xnn_status_uninitialized;
+  }
+
+  memset(&op->profiling, 0, sizeof(op->profiling));
+  op->profiling.enabled = enable;
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_get_operator_profile(
+    xnn_operator_t op,
+    struct xnn_operator_profile* profile_out)
+{
+  if (!xnn_params.initialized) {
+    xnn_log_error("failed to query operator profile: XNNPACK is not initialized");
+    return xnn_status_uninitialized;
+  }
+
+  if (op->state == xnn_run_state_invalid) {
+    xnn_log_error("failed to query operator profile: operator was not successfully setup");
+    return xnn_status_invalid_state;
+  }
+
+  struct xnn_operator_profile profile;
+  memset(&profile, 0, sizeof(profile));
+  profile.operator_name = operator_name(op->type);
+  profile.ukernel_name = ukernel_name(op);
+  get_ukernel_tile(op, &profile);
+  // Operators setup with an empty batch are skipped at run time, and do no work.
+  if (op->state == xnn_run_state_ready) {
+    profile.num_passes = op->compute2.type != xnn_parallelization_type_invalid ? 2 : 1;
+    profile.parallelization_dims = parallelization_dims(op->compute.type);
+    memcpy(profile.parallelization_range, op->compute.range, sizeof(profile.parallelization_range));
+    memcpy(profile.parallelization_tile, op->compute.tile, sizeof(profile.parallelization_tile));
+    count_operator_work(op, &profile.flops, &profile.bytes);
+  }
+  profile.num_threads = op->profiling.num_threads;
+  profile.run_count = op->profiling.run_count;
+  profile.total_time_ns = op->profiling.total_time_ns;
+  profile.min_time_ns = op->profiling.min_time_ns;
+  profile.last_time_ns = op->profiling.last_time_ns;
+
+  *profile_out = profile;
+  return xnn_status_success;
+}
@@ -7,6 +7,7 @@
 // LICENSE file in the root directory of this source tree.
 
 #include <assert.h>
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 #include <string.h>
@@ -17,7 +18,9 @@
 #include <xnnpack/common.h>
 #include <xnnpack/math.h>
 #include <xnnpack/params.h>
+#include <xnnpack/requantization.h>
 #include <xnnpack/compute.h>
+#include <xnnpack/profiling.h>
 
 
 void xnn_compute_ggemm(
@@ -68,6 +71,204 @@ void xnn_compute_gemm(
       &context->params);
 }
 
+void xnn_compute_splitk_gemm(
+    const struct splitk_gemm_context context[restrict static 1],
+    size_t slice_index,
+    size_t nr_block_start,
+    size_t nr_block_size)
+{
+  const size_t nr = context->nr;
+  const size_t a_slice_start = slice_index * context->a_slice_stride;
+  const size_t k_slice_scaled = min(context->k_scaled - a_slice_start, context->a_slice_stride);
+
+  for (size_t nr_block_offset = 0; nr_block_offset < nr_block_size; nr_block_offset += nr) {
+    const size_t n = nr_block_start + nr_block_offset;
+    const size_t nc = min(nr_block_size - nr_block_offset, nr);
+    const uintptr_t w = (uintptr_t) context->packed_w + n * context->w_stride;
+    if (slice_index == 0) {
+      context->gemm_ukernel(
+          context->m,
+          nc,
+          k_slice_scaled,
+          context->a,
+          context->a_stride,
+          (const void*) w,
+          (void*) ((uintptr_t) context->c + (n << context->log2_csize)),
+          context->cm_stride,
+          context->cn_stride,
+          &context->params);
+    } else {
+      context->gemminc_ukernel(
+          context->m,
+          nc,
+          k_slice_scaled,
+          (const void*) ((uintptr_t) context->a + a_slice_start),
+          context->a_stride,
+          (const void*) (w + context->w_bias_stride + slice_index * context->w_slice_stride),
+          (void*) ((uintptr_t) context->partial_c + (slice_index - 1) * context->partial_cs_stride + (n << context->log2_csize)),
+          context->partial_cm_stride,
+          context->cn_stride,
+          context->zero_acc,
+          &context->params);
+    }
+  }
+}
+
+void xnn_compute_splitk_reduce(
+    const struct splitk_gemm_context context[restrict static 1],
+    size_t m_index,
+    size_t n_block_start,
+    size_t n_block_size)
+{
+  void* c = (void*) ((uintptr_t) context->c + m_index * context->cm_stride + (n_block_start << context->log2_csize));
+  const void* partial_c = (const void*) ((uintptr_t) context->partial_c + m_index * context->partial_cm_stride + (n_block_start << context->log2_csize));
+  const size_t n_block_scaled = n_block_size << context->log2_csize;
+
+  for (size_t slice_index = 2; slice_index < context->num_slices; slice_index++) {
+    context->vadd_ukernel(n_block_scaled, c, partial_c, c, &context->params);
+    partial_c = (const void*) ((uintptr_t) partial_c + context->partial_cs_stride);
+  }
+  context->vadd_ukernel(n_block_scaled, c, partial_c, c, &context->output_params);
+}
+
+void xnn_compute_blocked_gemm(
+    const struct blocked_gemm_context context[restrict static 1],
+    size_t mc_block_start,
+    size_t nc_block_start,
+    size_t mc_block_size,
+    size_t nc_block_size)
+{
+  const size_t mr = context->mr;
+  const size_t nr = context->nr;
+  const size_t k_scaled = context->k_scaled;
+  const size_t kc_scaled = context->kc_scaled;
+  const size_t acc_cm_stride = nr << context->log2_csize;
+
+  for (size_t k_block_start = 0; k_block_start < k_scaled; k_block_start += kc_scaled) {
+    const size_t k_block_size = min(k_scaled - k_block_start, kc_scaled);
+    const bool first_k_block = k_block_start == 0;
+    const bool last_k_block = k_block_start + k_block_size == k_scaled;
+    for (size_t nr_block_offset = 0; nr_block_offset < nc_block_size; nr_block_offset += nr) {
+      const size_t n = nc_block_start + nr_block_offset;
+      const size_t nr_block_size = min(nc_block_size - nr_block_offset, nr);
+      const uintptr_t w = (uintptr_t) context->packed_w + n * context->w_stride;
+      for (size_t mr_block_offset = 0; mr_block_offset < mc_block_size; mr_block_offset += mr) {
+        const size_t m = mc_block_start + mr_block_offset;
+        const size_t mr_block_size = min(mc_block_size - mr_block_offset, mr);
+        const void* a = (const void*) ((uintptr_t) context->a + m * context->a_stride + k_block_start);
+        void* acc = (void*) ((uintptr_t) context->acc_c + (m / mr) * context->acc_m_stride + (n / nr) * context->acc_n_stride);
+        void* c = (void*) ((uintptr_t) context->c + m * context->cm_stride + (n << context->log2_csize));
+        if (first_k_block) {
+          if (last_k_block) {
+            context->gemm_ukernel(
+                mr_block_size, nr_block_size, k_block_size, a, context->a_stride, (const void*) w,
+                c, context->cm_stride, context->cn_stride, &context->output_params);
+          } else {
+            context->gemm_ukernel(
+                mr_block_size, nr_block_size, k_block_size, a, context->a_stride, (const void*) w,
+                acc, acc_cm_stride, context->cn_stride, &context->params);
+          }
+        } else {
+          const void* w_block = (const void*) (w + context->w_bias_stride + k_block_start * nr);
+          if (last_k_block) {
+            context->gemminc_ukernel(
+                mr_block_size, nr_block_size, k_block_size, a, context->a_stride, w_block,
+                c, context->cm_stride, context->cn_stride, acc, &context->output_params);
+          } else {
+            context->gemminc_ukernel(
+                mr_block_size, nr_block_size, k_block_size, a, context->a_stride, w_block,
+                acc, acc_cm_stride, context->cn_stride, acc, &context->params);
+          }
+        }
+      }
+    }
+  }
+}
+
+void xnn_compute_packx(
+    const struct ppmm_context context[restrict static 1],
+    size_t mr_block_start,
+    size_t mr_block_size)
+{
+  context->packx_ukernel(
+      mr_block_size,
+      context->k,
+      (const void*) ((uintptr_t) context->a + mr_block_start * context->a_stride),
+      context->a_stride,
+      (void*) ((uintptr_t) context->packed_a + mr_block_start * context->k_scaled));
+}
+
+void xnn_compute_ppmm(
+    const struct ppmm_context context[restrict static 1],
+    size_t mr_block_start,
+    size_t nr_block_start,
+    size_t mr_block_size,
+    size_t nr_block_size)
+{
+  const size_t k_scaled  = context->k_scaled;
+  const size_t cm_stride = context->cm_stride;
+
+  context->ppmm_ukernel(
+      mr_block_size,
+      nr_block_size,
+      k_scaled,
+      (const void*) ((uintptr_t) context->packed_a + mr_block_start * k_scaled),
+      (const void*) ((uintptr_t) context->packed_w + nr_block_start * context->w_stride),
+      (void*) ((uintptr_t) context->c + mr_block_start * cm_stride + (nr_block_start << context->log2_csize)),
+      cm_stride,
+      context->cn_stride,
+      &context->params);
+}
+
+void xnn_compute_dqgemm_quantize(
+    const struct dqgemm_context context[restrict static 1],
+    size_t m)
+{
+  const size_t k = context->k;
+  const float* a = (const float*) ((uintptr_t) context->a + m * context->a_stride);
+
+  float absmax;
+  context->rabsmax_ukernel(k * sizeof(float), a, &absmax);
+
+  // Symmetric quantization around the fixed zero point of 128, with the [1, 255] range so that quantized values
+  // (less zero point) are within [-127, 127].
+  float a_scale = absmax / 127.0f;
+  float multiplier = 127.0f / absmax;
+  if XNN_UNLIKELY(absmax == 0.0f) {
+    a_scale = 1.0f;
+    multiplier = 1.0f;
+  }
+  context->scale[m] = a_scale * context->kernel_scale;
+
+  const union xnn_f32_q8_quantization_params params =
+    xnn_compute_f32_q8_quantization_params(multiplier, 128, 1, 255);
+  context->vquantize_ukernel(k * sizeof(float), a, context->quantized_a + m * k, &params);
+}
+
+void xnn_compute_dqgemm(
+    const struct dqgemm_context context[restrict static 1],
+    size_t mr_block_start,
+    size_t nr_block_start,
+    size_t mr_block_size,
+    size_t nr_block_size)
+{
+  const size_t k = context->k;
+  const size_t cm_stride = context->cm_stride;
+
+  context->ukernel(
+      mr_block_size,
+      nr_block_size,
+      k,
+      context->quantized_a + mr_block_start * k,
+      k,
+      (const void*) ((uintptr_t) context->packed_w + nr_block_start * context->w_stride),
+      (float*) ((uintptr_t) context->c + mr_block_start * cm_stride + (nr_block_start << 2)),
+      cm_stride,
+      context->cn_stride,
+      context->scale + mr_block_start,
+      &context->params);
+}
+
 void xnn_compute_spmm(
     const struct spmm_context context[restrict static 1],
     size_t batch_index,
@@ -85,6 +286,83 @@ void xnn_compute_spmm(
       &context->params);
 }
 
+void xnn_compute_subsampled_spmm(
+    const struct spmm_context context[restrict static 1],
+    size_t batch_index,
+    size_t mr_block_start,
+    size_t mr_block_size)
+{
+  const size_t input_height = context->input_height;
+  const size_t input_width = context->input_width;
+  const size_t output_width = context->output_width;
+  const size_t subsampling_height = context->subsampling_height;
+  const size_t subsampling_width = context->subsampling_width;
+  const size_t padding_top = context->padding_top;
+  const size_t padding_left = context->padding_left;
+
+  // Gather the pixels of this block of output pixels from all input channels. Blocks don't overlap, so each task
+  // writes its own part of the gathered matrix A.
+  const uint32_t* input = (const uint32_t*) ((uintptr_t) context->input + batch_index * context->input_batch_stride);
+  uint32_t* packed_a = (uint32_t*) ((uintptr_t) context->packed_a + batch_index * context->batched_a_stride) + mr_block_start;
+  for (size_t c = context->input_channels; c != 0; c--) {
+    size_t output_y = mr_block_start / output_width;
+    size_t output_x = mr_block_start % output_width;
+    for (size_t m = 0; m < mr_block_size; m++) {
+      const size_t input_y = output_y * subsampling_height - padding_top;
+      const size_t input_x = output_x * subsampling_width - padding_left;
+      packed_a[m] = (input_y < input_height && input_x < input_width) ? input[input_y * input_width + input_x] : 0;
+      if (++output_x == output_width) {
+        output_x = 0;
+        output_y += 1;
+      }
+    }
+    input = (const uint32_t*) ((uintptr_t) input + context->input_channel_stride);
+    packed_a = (uint32_t*) ((uintptr_t) packed_a + context->packed_a_channel_stride);
+  }
+
+  xnn_compute_spmm(context, batch_index, mr_block_start, mr_block_size);
+}
+
+void xnn_compute_nhwc_spmm(
+    const struct nhwc_spmm_context context[restrict static 1],
+    size_t mr_block_start,
+    size_t mr_block_size)
+{
+  const size_t k = context->k;
+  const size_t n = context->n;
+  const size_t mr = context->mr;
+
+  // Blocks don't overlap, so each task transposes rows of A and C in its own part of the workspace.
+  float* packed_a = (float*) ((uintptr_t) context->workspace + mr_block_start / mr * context->workspace_stride);
+  float* packed_c = packed_a + k * mr;
+
+  const float* a = (const float*) ((uintptr_t) context->a + mr_block_start * context->a_stride);
+  for (size_t m = 0; m < mr_block_size; m++) {
+    for (size_t i = 0; i < k; i++) {
+      packed_a[i * mr + m] = a[i];
+    }
+    a = (const float*) ((uintptr_t) a + context->a_stride);
+  }
+
+  context->ukernel(
+      mr_block_size,
+      n,
+      packed_a + context->first_input_channel * mr,
+      context->packed_weights,
+      context->input_increments,
+      context->output_channel_nonzeros,
+      packed_c,
+      &context->params);
+
+  float* c = (float*) ((uintptr_t) context->c + mr_block_start * context->c_stride);
+  for (size_t m = 0; m < mr_block_size; m++) {
+    for (size_t j = 0; j < n; j++) {
+      c[j] = packed_c[j * mr_block_size + m];
+    }
+    c = (float*) ((uintptr_t) c + context->c_stride);
+  }
+}
+
 void xnn_compute_gigemm(
     const struct igemm_context context[restrict static 1],
     size_t batch_index,
@@ -138,6 +416,104 @@ void xnn_compute_igemm(
       &context->params);
 }
 
+// Converts compact indirection entries for up to output_pixels output pixels, spaced pixel_stride entries apart and each
+// pixel_size entries long, to pointers into the input, or to the zero buffer.
+// Returns the number of output pixels that fit into the indirection buffer.
+static size_t expand_compact_indirection(
+    const void** indirection,
+    const uint32_t* compact_indirection,
+    size_t output_pixels,
+    size_t pixel_stride,
+    size_t pixel_size,
+    const void* input,
+    uint32_t log2_element_size,
+    const void* zero)
+{
+  assert(output_pixels != 0);
+  assert(pixel_size <= XNN_MAX_REBASED_INDIRECTION_POINTERS);
+
+  if (pixel_stride != 0) {
+    output_pixels = min(output_pixels, (XNN_MAX_REBASED_INDIRECTION_POINTERS - pixel_size) / pixel_stride + 1);
+  }
+  const size_t num_pointers = pixel_size + (output_pixels - 1) * pixel_stride;
+  // Branchless selection lets the compiler vectorize the loop.
+  const uintptr_t input_address = (uintptr_t) input;
+  const uintptr_t zero_address = (uintptr_t) zero;
+  for (size_t i = 0; i < num_pointers; i++) {
+    const uint32_t element_offset = compact_indirection[i];
+    const uintptr_t address = input_address + ((uintptr_t) element_offset << log2_element_size);
+    indirection[i] = (const void*) (element_offset == XNN_COMPACT_INDIRECTION_ZERO ? zero_address : address);
+  }
+  return output_pixels;
+}
+
+void xnn_compute_gigemm_compact(
+    const struct igemm_context context[restrict static 1],
+    size_t batch_index,
+    size_t group_index,
+    size_t mr_block_start,
+    size_t nr_block_start,
+    size_t mr_block_size,
+    size_t nr_block_size)
+{
+  const size_t ks        = context->ks;
+  const size_t cm_stride = context->cm_stride;
+
+  const void* indirect_a[XNN_MAX_REBASED_INDIRECTION_POINTERS];
+  expand_compact_indirection(
+    indirect_a, context->compact_indirect_a + mr_block_start * ks, 1 /* output pixels */,
+    0 /* pixel stride */, context->ks_scaled / sizeof(void*),
+    (const void*) ((uintptr_t) context->a + group_index * context->ga_stride + batch_index * context->ba_stride),
+    context->log2_asize, context->zero);
+
+  context->ukernel(
+      mr_block_size,
+      nr_block_size,
+      context->kc,
+      context->ks_scaled,
+      indirect_a,
+      (const void*) ((uintptr_t) context->packed_w + nr_block_start * context->w_stride + group_index * context->gw_stride),
+      (void*) ((uintptr_t) context->c + group_index * context->gc_stride + batch_index * context->bc_stride + mr_block_start * cm_stride + (nr_block_start << context->log2_csize)),
+      cm_stride,
+      context->cn_stride,
+      0 /* a_offset */,
+      context->zero,
+      &context->params);
+}
+
+void xnn_compute_igemm_compact(
+    const struct igemm_context context[restrict static 1],
+    size_t batch_index,
+    size_t mr_block_start,
+    size_t nr_block_start,
+    size_t mr_block_size,
+    size_t nr_block_size)
+{
+  const size_t ks        = context->ks;
+  const size_t cm_stride = context->cm_stride;
+
+  const void* indirect_a[XNN_MAX_REBASED_INDIRECTION_POINTERS];
+  expand_compact_indirection(
+    indirect_a, context->compact_indirect_a + mr_block_start * ks, 1 /* output pixels */,
+    0 /* pixel stride */, context->ks_scaled / sizeof(void*),
+    (const void*) ((uintptr_t) context->a + batch_index * context->ba_stride),
+    context->log2_asize, context->zero);
+
+  context->ukernel(
+      mr_block_size,
+      nr_block_size,
+      context->kc,
+      context->ks_scaled,
+      indirect_a,
+      (const void*) ((uintptr_t) context->packed_w + nr_block_start * context->w_stride),
+      (void*) ((uintptr_t) context->c + batch_index * context->bc_stride + mr_block_start * cm_stride + (nr_block_start << context->log2_csize)),
+      cm_stride,
+      context->cn_stride,
+      0 /* a_offset */,
+      context->zero,
+      &context->params);
+}
+
 void xnn_compute_gsubconv2d(
       const struct subconv_context context[restrict static 1],
       size_t batch_index,
@@ -241,35 +617,177 @@ void xnn_compute_dwconv_unipass(
     const struct dwconv_context context[restrict static 1],
     size_t output_y)
 {
+  const void** indirect_input = context->indirection_buffer + output_y * context->indirection_buffer_row_stride;
+  void* output = (void*) ((uintptr_t) context->output + output_y * context->output_row_stride);
+
   context->unipass_ukernel(
     context->groups,
     context->output_width,
-    context->indirection_buffer + output_y * context->indirection_buffer_row_stride,
+    indirect_input,
     context->packed_weights,
-    context->output + output_y * context->output_row_stride,
+    output,
     context->indirection_buffer_col_stride,
     context->output_col_increment,
     &context->params);
 }
 
-void xnn_compute_dwconv2d_spchw(
-    const struct dwconv2d_context context[restrict static 1],
+void xnn_compute_dwconv_multipass(
+    const struct dwconv_context context[restrict static 1],
+    size_t output_y)
+{
+  const void** indirect_input = context->indirection_buffer + output_y * context->indirection_buffer_row_stride;
+  void* output = (void*) ((uintptr_t) context->output + output_y * context->output_row_stride);
+
+  context->multipass_ukernel(
+    context->groups,
+    context->output_width,
+    context->kernel_size,
+    indirect_input,
+    context->packed_weights,
+    output,
+    context->indirection_buffer_col_stride,
+    context->output_col_increment,
+    &context->params);
+}
+
+void xnn_compute_dwconv_unipass_compact(
+    const struct dwconv_context context[restrict static 1],
     size_t batch_index,
-    size_t channel)
+    size_t output_y)
+{
+  const uint32_t* compact_indirect_input =
+    context->compact_indirection_buffer + output_y * context->indirection_buffer_row_stride;
+  const void* input = (const void*) ((uintptr_t) context->input + batch_index * context->input_batch_stride);
+  void* output = (void*) ((uintptr_t) context->output +
+    batch_index * context->output_batch_stride + output_y * context->output_row_stride);
+
+  const size_t pixel_stride = context->indirection_buffer_col_stride / sizeof(void*);
+  const void* indirect_input[XNN_MAX_REBASED_INDIRECTION_POINTERS];
+  for (size_t output_x = 0; output_x < context->output_width; ) {
+    const size_t output_pixels = expand_compact_indirection(
+      indirect_input, compact_indirect_input, context->output_width - output_x,
+      pixel_stride, context->kernel_size, input, context->log2_input_element_size, context->zero);
+    context->unipass_ukernel(
+      context->groups,
+      output_pixels,
+      indirect_input,
+      context->packed_weights,
+      output,
+      context->indirection_buffer_col_stride,
+      context->output_col_increment,
+      &context->params);
+    compact_indirect_input += output_pixels * pixel_stride;
+    output = (void*) ((uintptr_t) output + output_pixels * context->output_col_stride);
+    output_x += output_pixels;
+  }
+}
+
+void xnn_compute_dwconv_multipass_compact(
+    const struct dwconv_context context[restrict static 1],
+    size_t batch_index,
+    size_t output_y)
 {
+  const uint32_t* compact_indirect_input =
+    context->compact_indirection_buffer + output_y * context->indirection_buffer_row_stride;
+  const void* input = (const void*) ((uintptr_t) context->input + batch_index * context->input_batch_stride);
+  void* output = (void*) ((uintptr_t) context->output +
+    batch_index * context->output_batch_stride + output_y * context->output_row_stride);
+
+  const size_t pixel_stride = context->indirection_buffer_col_stride / sizeof(void*);
+  const void* indirect_input[XNN_MAX_REBASED_INDIRECTION_POINTERS];
+  for (size_t output_x = 0; output_x < context->output_width; ) {
+    const size_t output_pixels = expand_compact_indirection(
+      indirect_input, compact_indirect_input, context->output_width - output_x,
+      pixel_stride, context->kernel_size, input, context->log2_input_element_size, context->zero);
+    context->multipass_ukernel(
+      context->groups,
+      output_pixels,
+      context->kernel_size,
+      indirect_input,
+      context->packed_weights,
+      output,
+      context->indirection_buffer_col_stride,
+      context->output_col_increment,
+      &context->params);
+    compact_indirect_input += output_pixels * pixel_stride;
+    output = (void*) ((uintptr_t) output + output_pixels * context->output_col_stride);
+    output_x += output_pixels;
+  }
+}
+
+static void compute_dwconv2d_spchw_padded_rows(
+    const struct dwconv2d_context context[restrict static 1],
+    const void* input,
+    const void* weights,
+    void* output,
+    void* padded_input,
+    size_t output_y_start,
+    size_t output_y_end)
+{
+  const size_t input_pixel_stride = context->input_pixel_stride;
+  const size_t input_y_start = output_y_start * context->subsampling_height;
+  const size_t padded_rows = (output_y_end - output_y_start - 1) * context->subsampling_height + context->kernel_height;
+  for (size_t i = 0; i < padded_rows; i++) {
+    const size_t input_y = input_y_start + i - context->input_padding_top;
+    void* padded_row = (void*) ((uintptr_t) padded_input + i * input_pixel_stride);
+    if (input_y < context->input_height) {
+      memcpy(padded_row, (const void*) ((uintptr_t) input + input_y * input_pixel_stride), input_pixel_stride);
+    } else {
+      memset(padded_row, 0, input_pixel_stride);
+    }
+  }
+
   context->spchw_ukernel(
-    context->output_height,
+    output_y_end - output_y_start,
     context->input_width,
-    (const void*) ((uintptr_t) context->input + channel * context->input_channel_stride + batch_index * context->input_batch_stride),
-    (const void*) ((uintptr_t) context->packed_weights + channel * context->weights_channel_stride),
-    (void*) ((uintptr_t) context->output + channel * context->output_channel_stride + batch_index * context->output_batch_stride),
+    padded_input,
+    weights,
+    (void*) ((uintptr_t) output + output_y_start * context->output_pixel_stride),
     context->input_tuple_stride,
     context->output_tuple_stride,
-    context->input_pixel_stride,
+    input_pixel_stride,
     context->output_pixel_stride,
     &context->params);
 }
 
+void xnn_compute_dwconv2d_spchw(
+    const struct dwconv2d_context context[restrict static 1],
+    size_t batch_index,
+    size_t channel)
+{
+  const void* input =
+    (const void*) ((uintptr_t) context->input + channel * context->input_channel_stride + batch_index * context->input_batch_stride);
+  const void* weights = (const void*) ((uintptr_t) context->packed_weights + channel * context->weights_channel_stride);
+  void* output =
+    (void*) ((uintptr_t) context->output + channel * context->output_channel_stride + batch_index * context->output_batch_stride);
+  const size_t output_height = context->output_height;
+  const size_t output_y_start = context->output_y_start;
+  const size_t output_y_end = context->output_y_end;
+  void* padded_input = (void*) ((uintptr_t) context->padded_input +
+    (batch_index * context->groups + channel) * context->padded_input_stride);
+
+  if XNN_UNLIKELY(output_y_start != 0) {
+    compute_dwconv2d_spchw_padded_rows(context, input, weights, output, padded_input, 0, output_y_start);
+  }
+  if XNN_LIKELY(output_y_end != output_y_start) {
+    const size_t input_y = output_y_start * context->subsampling_height - context->input_padding_top;
+    context->spchw_ukernel(
+      output_y_end - output_y_start,
+      context->input_width,
+      (const void*) ((uintptr_t) input + input_y * context->input_pixel_stride),
+      weights,
+      (void*) ((uintptr_t) output + output_y_start * context->output_pixel_stride),
+      context->input_tuple_stride,
+      context->output_tuple_stride,
+      context->input_pixel_stride,
+      context->output_pixel_stride,
+      &context->params);
+  }
+  if XNN_UNLIKELY(output_y_end != output_height) {
+    compute_dwconv2d_spchw_padded_rows(context, input, weights, output, padded_input, output_y_end, output_height);
+  }
+}
+
 void xnn_compute_argmax_pooling_unipass(
     const struct argmax_pooling_context context[restrict static 1],
     size_t batch_index,
@@ -331,6 +849,34 @@ void xnn_compute_max_pooling(
     &context->params);
 }
 
+void xnn_compute_max_pooling_compact(
+    const struct max_pooling_context context[restrict static 1],
+    size_t batch_index,
+    size_t output_y)
+{
+  const uint32_t* compact_indirect_input =
+    (const uint32_t*) ((uintptr_t) context->compact_indirect_input + output_y * context->indirect_input_height_stride);
+  const void* input = (const void*) ((uintptr_t) context->input + batch_index * context->input_batch_stride);
+  void* output =
+    (void*) ((uintptr_t) context->output + batch_index * context->output_batch_stride + output_y * context->output_height_stride);
+
+  const size_t pixel_stride = context->indirect_input_width_stride / sizeof(uint32_t);
+  const void* indirect_input[XNN_MAX_REBASED_INDIRECTION_POINTERS];
+  for (size_t output_x = 0; output_x < context->output_width; ) {
+    const size_t output_pixels = expand_compact_indirection(
+      indirect_input, compact_indirect_input, context->output_width - output_x,
+      pixel_stride, context->indirect_input_pixel_size, input, context->log2_input_element_size, NULL);
+    context->ukernel(
+      output_pixels, context->pooling_size, context->channels,
+      indirect_input, output,
+      context->input_increment, context->output_increment,
+      &context->params);
+    compact_indirect_input += output_pixels * pixel_stride;
+    output = (void*) ((uintptr_t) output + output_pixels * context->output_width_stride);
+    output_x += output_pixels;
+  }
+}
+
 void xnn_compute_unpooling(
     const struct unpooling_context context[restrict static 1],
     size_t input_y,
@@ -543,6 +1089,23 @@ void xnn_compute_add_contiguous(
   context->ukernel(size, a, b, y, &context->params);
 }
 
+void xnn_compute_elementwise_binary_5d(
+    const struct elementwise_binary_context context[restrict static 1],
+    size_t i, size_t j, size_t k, size_t l, size_t m,
+    size_t l_range, size_t m_range)
+{
+  assert(l_range == 1);
+  assert(m_range == 1);
+
+  const void* a = (const void*) ((uintptr_t) context->a +
+    i * context->a_stride[0] + j * context->a_stride[1] + k * context->a_stride[2] + l * context->a_stride[3] + m * context->a_stride[4]);
+  const void* b = (const void*) ((uintptr_t) context->b +
+    i * context->b_stride[0] + j * context->b_stride[1] + k * context->b_stride[2] + l * context->b_stride[3] + m * context->b_stride[4]);
+  void* y = (void*) ((uintptr_t) context->y +
+    i * context->y_stride[0] + j * context->y_stride[1] + k * context->y_stride[2] + l * context->y_stride[3] + m * context->y_stride[4]);
+  context->ukernel(context->elements, a, b, y, &context->params);
+}
+
 void xnn_compute_channel_shuffle_fixed(
     const struct channel_shuffle_context context[restrict static 1],
     size_t index)
@@ -621,6 +1184,27 @@ void xnn_compute_u8_softargmax(
   context->lut_norm_ukernel(n, x, t, y);
 }
 
+void xnn_compute_f32_softmax(
+    const struct f32_softmax_context context[restrict static 1],
+    size_t batch_index)
+{
+  const float* x = (const float*) ((uintptr_t) context->x + context->x_stride * batch_index);
+  float* y = (float*) ((uintptr_t) context->y + context->y_stride * batch_index);
+  const size_t n = context->n;
+
+  // First pass: reduce-max
+  float x_max;
+  context->rmax_ukernel(n, x, &x_max);
+
+  // Second pass: reduce-add & store exp(x-x_max)
+  float y_sum;
+  context->raddstoreexpminusmax_ukernel(n, x, y, &y_sum, x_max);
+
+  // Third pass: scale y
+  const float y_scale = 1.0f / y_sum;
+  context->vmulc_ukernel(n, y, &y_scale, y, &context->params);
+}
+
 void xnn_compute_vmulcaddc(
     const struct vmulcaddc_context context[restrict static 1],
     size_t batch_start,
@@ -641,144 +1225,256 @@ void xnn_compute_vmulcaddc(
     &context->params);
 }
 
-enum xnn_status xnn_run_operator(xnn_operator_t op, pthreadpool_t threadpool)
+void xnn_compute_winograd_input(
+    const struct winograd_context context[restrict static 1],
+    size_t batch_tile_row,
+    size_t tile_column)
 {
-  if (!xnn_params.initialized) {
-    xnn_log_error("failed to run operator: XNNPACK is not initialized");
-    return xnn_status_uninitialized;
+  const size_t input_height = context->input_height;
+  const size_t input_width = context->input_width;
+  const size_t batch_index = batch_tile_row / context->tile_rows;
+  const size_t tile_row = batch_tile_row % context->tile_rows;
+  const uintptr_t input = (uintptr_t) context->input + batch_index * context->input_batch_stride;
+
+  const void* window[36];
+  for (size_t y = 0; y < 6; y++) {
+    // Unsigned wrap-around maps rows above the input to out-of-range indices.
+    const size_t input_y = tile_row * 4 + y - context->padding_top;
+    for (size_t x = 0; x < 6; x++) {
+      const size_t input_x = tile_column * 4 + x - context->padding_left;
+      if (input_y < input_height && input_x < input_width) {
+        window[y * 6 + x] = (const void*) (input + (input_y * input_width + input_x) * context->input_pixel_stride);
+      } else {
+        window[y * 6 + x] = context->zero;
+      }
+    }
   }
-  switch (op->state) {
-    case xnn_run_state_invalid:
-      xnn_log_error("failed to run operator: operator was not successfully setup");
-      return xnn_status_invalid_state;
-    case xnn_run_state_ready:
-      break;
-    case xnn_run_state_skip:
-      return xnn_status_success;
+
+  const size_t tile_index = batch_tile_row * context->tile_columns + tile_column;
+  context->input_ukernel(
+    context->channels,
+    window,
+    (void*) ((uintptr_t) context->transformed_input + tile_index * context->tile_stride),
+    context->position_stride);
+}
+
+void xnn_compute_winograd_gemm(
+    const struct winograd_context context[restrict static 1],
+    size_t mr_block_start,
+    size_t nr_block_start,
+    size_t mr_block_size,
+    size_t nr_block_size)
+{
+  const size_t mr = context->mr;
+  const size_t nr = context->nr;
+  const size_t a_stride = context->tile_stride;
+  const size_t cm_stride = nr * sizeof(float);
+  const size_t cp_stride = mr * cm_stride;
+
+  float transformed_output[36 * XNN_MAX_WINOGRAD_GEMM_TILE];
+  for (size_t position = 0; position < 36; position++) {
+    context->gemm_ukernel(
+        mr_block_size,
+        nr_block_size,
+        context->k_scaled,
+        (const void*) ((uintptr_t) context->transformed_input + position * context->position_stride +
+          mr_block_start * a_stride),
+        a_stride,
+        (const void*) ((uintptr_t) context->packed_w + position * context->w_position_stride +
+          nr_block_start * context->w_stride),
+        (void*) ((uintptr_t) transformed_output + position * cp_stride),
+        cm_stride,
+        cm_stride,
+        &context->gemm_params);
+  }
+
+  const size_t tile_rows = context->tile_rows;
+  const size_t tile_columns = context->tile_columns;
+  const size_t output_height = context->output_height;
+  const size_t output_width = context->output_width;
+  const size_t output_pixel_stride = context->output_pixel_stride;
+  for (size_t m = 0; m < mr_block_size; m++) {
+    const size_t tile_index = mr_block_start + m;
+    const size_t tile_column = tile_index % tile_columns;
+    const size_t batch_tile_row = tile_index / tile_columns;
+    const size_t tile_row = batch_tile_row % tile_rows;
+    const size_t batch_index = batch_tile_row / tile_rows;
+    const size_t output_y = tile_row * 4;
+    const size_t output_x = tile_column * 4;
+
+    context->output_ukernel(
+        min(output_height - output_y, 4),
+        min(output_width - output_x, 4),
+        nr_block_size,
+        (const float*) ((uintptr_t) transformed_output + m * cm_stride),
+        cp_stride,
+        (float*) ((uintptr_t) context->output + batch_index * context->output_batch_stride +
+          (output_y * output_width + output_x) * output_pixel_stride + nr_block_start * sizeof(float)),
+        output_width * output_pixel_stride,
+        output_pixel_stride,
+        &context->params.f32);
   }
+}
 
-  switch (op->compute.type) {
+static void run_compute(
+  const struct compute_parameters compute[restrict static 1],
+  void* context,
+  pthreadpool_t threadpool)
+{
+  switch (compute->type) {
     case xnn_parallelization_type_invalid:
       break;
     case xnn_parallelization_type_1d:
-      assert(op->compute.range[0] != 0);
+      assert(compute->range[0] != 0);
       pthreadpool_parallelize_1d(
           threadpool,
-          op->compute.task_1d,
-          &op->context,
-          op->compute.range[0],
+          compute->task_1d,
+          context,
+          compute->range[0],
           PTHREADPOOL_FLAG_DISABLE_DENORMALS /* flags */);
       break;
     case xnn_parallelization_type_1d_tile_1d:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.tile[0] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->tile[0] != 0);
       pthreadpool_parallelize_1d_tile_1d(
           threadpool,
-          op->compute.task_1d_tile_1d,
-          &op->context,
-          op->compute.range[0],
-          op->compute.tile[0],
+          compute->task_1d_tile_1d,
+          context,
+          compute->range[0],
+          compute->tile[0],
           PTHREADPOOL_FLAG_DISABLE_DENORMALS /* flags */);
       break;
     case xnn_parallelization_type_2d:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.range[1] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->range[1] != 0);
       pthreadpool_parallelize_2d(
           threadpool,
-          op->compute.task_2d,
-          &op->context,
-          op->compute.range[0], op->compute.range[1],
+          compute->task_2d,
+          context,
+          compute->range[0], compute->range[1],
           PTHREADPOOL_FLAG_DISABLE_DENORMALS /* flags */);
       break;
     case xnn_parallelization_type_2d_tile_1d:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.range[1] != 0);
-      assert(op->compute.tile[0] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->range[1] != 0);
+      assert(compute->tile[0] != 0);
       pthreadpool_parallelize_2d_tile_1d(
           threadpool,
-          op->compute.task_2d_tile_1d,
-          &op->context,
-          op->compute.range[0], op->compute.range[1],
-          op->compute.tile[0],
+          compute->task_2d_tile_1d,
+          context,
+          compute->range[0], compute->range[1],
+          compute->tile[0],
           PTHREADPOOL_FLAG_DISABLE_DENORMALS /* flags */);
       break;
     case xnn_parallelization_type_2d_tile_2d:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.range[1] != 0);
-      assert(op->compute.tile[0] != 0);
-      assert(op->compute.tile[1] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->range[1] != 0);
+      assert(compute->tile[0] != 0);
+      assert(compute->tile[1] != 0);
       pthreadpool_parallelize_2d_tile_2d(
           threadpool,
-          op->compute.task_2d_tile_2d,
-          &op->context,
-          op->compute.range[0], op->compute.range[1],
-          op->compute.tile[0], op->compute.tile[1],
+          compute->task_2d_tile_2d,
+          context,
+          compute->range[0], compute->range[1],
+          compute->tile[0], compute->tile[1],
           PTHREADPOOL_FLAG_DISABLE_DENORMALS /* flags */);
       break;
     case xnn_parallelization_type_3d_tile_2d:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.range[1] != 0);
-      assert(op->compute.range[2] != 0);
-      assert(op->compute.tile[0] != 0);
-      assert(op->compute.tile[1] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->range[1] != 0);
+      assert(compute->range[2] != 0);
+      assert(compute->tile[0] != 0);
+      assert(compute->tile[1] != 0);
       pthreadpool_parallelize_3d_tile_2d(
           threadpool,
-          op->compute.task_3d_tile_2d,
-          &op->context,
-          op->compute.range[0], op->compute.range[1], op->compute.range[2],
-          op->compute.tile[0], op->compute.tile[1],
+          compute->task_3d_tile_2d,
+          context,
+          compute->range[0], compute->range[1], compute->range[2],
+          compute->tile[0], compute->tile[1],
           PTHREADPOOL_FLAG_DISABLE_DENORMALS /* flags */);
       break;
     case xnn_parallelization_type_4d_tile_2d:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.range[1] != 0);
-      assert(op->compute.range[2] != 0);
-      assert(op->compute.range[3] != 0);
-      assert(op->compute.tile[0] != 0);
-      assert(op->compute.tile[1] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->range[1] != 0);
+      assert(compute->range[2] != 0);
+      assert(compute->range[3] != 0);
+      assert(compute->tile[0] != 0);
+      assert(compute->tile[1] != 0);
       pthreadpool_parallelize_4d_tile_2d(
           threadpool,
-          op->compute.task_4d_tile_2d,
-          &op->context,
-          op->compute.range[0], op->compute.range[1], op->compute.range[2], op->compute.range[3],
-          op->compute.tile[0], op->compute.tile[1],
+          compute->task_4d_tile_2d,
+          context,
+          compute->range[0], compute->range[1], compute->range[2], compute->range[3],
+          compute->tile[0], compute->tile[1],
           PTHREADPOOL_FLAG_DISABLE_DENORMALS /* flags */);
       break;
     case xnn_parallelization_type_5d_tile_2d:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.range[1] != 0);
-      assert(op->compute.range[2] != 0);
-      assert(op->compute.range[3] != 0);
-      assert(op->compute.range[4] != 0);
-      assert(op->compute.tile[0] != 0);
-      assert(op->compute.tile[1] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->range[1] != 0);
+      assert(compute->range[2] != 0);
+      assert(compute->range[3] != 0);
+      assert(compute->range[4] != 0);
+      assert(compute->tile[0] != 0);
+      assert(compute->tile[1] != 0);
       pthreadpool_parallelize_5d_tile_2d(
           threadpool,
-          op->compute.task_5d_tile_2d,
-          &op->context,
-          op->compute.range[0], op->compute.range[1], op->compute.range[2], op->compute.range[3], op->compute.range[4],
-          op->compute.tile[0], op->compute.tile[1],
+          compute->task_5d_tile_2d,
+          context,
+          compute->range[0], compute->range[1], compute->range[2], compute->range[3], compute->range[4],
+          compute->tile[0], compute->tile[1],
           PTHREADPOOL_FLAG_DISABLE_DENORMALS /* flags */);
       break;
     case xnn_parallelization_type_6d_tile_2d:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.range[1] != 0);
-      assert(op->compute.range[2] != 0);
-      assert(op->compute.range[3] != 0);
-      assert(op->compute.range[4] != 0);
-      assert(op->compute.range[5] != 0);
-      assert(op->compute.tile[0] != 0);
-      assert(op->compute.tile[1] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->range[1] != 0);
+      assert(compute->range[2] != 0);
+      assert(compute->range[3] != 0);
+      assert(compute->range[4] != 0);
+      assert(compute->range[5] != 0);
+      assert(compute->tile[0] != 0);
+      assert(compute->tile[1] != 0);
       pthreadpool_parallelize_6d_tile_2d(
           threadpool,
-          op->compute.task_6d_tile_2d,
-          &op->context,
-          op->compute.range[0], op->compute.range[1], op->compute.range[2], op->compute.range[3], op->compute.range[4], op->compute.range[5],
-          op->compute.tile[0], op->compute.tile[1],
+          compute->task_6d_tile_2d,
+          context,
+          compute->range[0], compute->range[1], compute->range[2], compute->range[3], compute->range[4], compute->range[5],
+          compute->tile[0], compute->tile[1],
           PTHREADPOOL_FLAG_DISABLE_DENORMALS /* flags */);
       break;
     default:
       XNN_UNREACHABLE;
   }
+}
+
+enum xnn_status xnn_run_operator(xnn_operator_t op, pthreadpool_t threadpool)
+{
+  if (!xnn_params.initialized) {
+    xnn_log_error("failed to run operator: XNNPACK is not initialized");
+    return xnn_status_uninitialized;
+  }
+  switch (op->state) {
+    case xnn_run_state_invalid:
+      xnn_log_error("failed to run operator: operator was not successfully setup");
+      return xnn_status_invalid_state;
+    case xnn_run_state_ready:
+      break;
+    case xnn_run_state_skip:
+      return xnn_status_success;
+  }
+
+  const bool profiling = op->profiling.enabled;
+  uint64_t start_time_ns = 0;
+  if (profiling) {
+    start_time_ns = xnn_read_timer_ns();
+  }
+
+  run_compute(&op->compute, &op->context, threadpool);
+  if (op->compute2.type != xnn_parallelization_type_invalid) {
+    run_compute(&op->compute2, &op->context, threadpool);
+  }
+
+  if (profiling) {
+    xnn_record_operator_run(op, threadpool, xnn_read_timer_ns() - start_time_ns);
+  }
   return xnn_status_success;
 }
@@ -0,0 +1,149 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <xnnpack.h>
+#include <xnnpack/allocator.h>
+#include <xnnpack/log.h>
+#include <xnnpack/operator.h>
+#include <xnnpack/packed-weights.h>
+#include <xnnpack/params.h>
+
+
+enum xnn_status xnn_init_operator_packed_weights(
+    xnn_operator_t op,
+    const struct xnn_packed_weights_header* header,
+    const void* blob,
+    size_t blob_size)
+{
+  assert(sizeof(struct xnn_packed_weights_header) <= XNN_PACKED_WEIGHTS_HEADER_SIZE);
+  assert(XNN_PACKED_WEIGHTS_HEADER_SIZE % XNN_ALLOCATION_ALIGNMENT == 0);
+
+  op->packed_weights_header = *header;
+  op->packed_weights_header.magic = XNN_PACKED_WEIGHTS_MAGIC;
+  op->packed_weights_header.version = XNN_PACKED_WEIGHTS_VERSION;
+  op->packed_weights_header.arch = XNN_PACKED_WEIGHTS_ARCH;
+  const size_t weights_size = (size_t) header->weights_size;
+
+  if (blob == NULL) {
+    op->packed_weights = xnn_allocate_memory(weights_size);
+    if (op->packed_weights == NULL) {
+      xnn_log_error("failed to allocate %zu bytes for packed weights", weights_size);
+      return xnn_status_out_of_memory;
+    }
+    return xnn_status_success;
+  }
+
+  if ((uintptr_t) blob % XNN_ALLOCATION_ALIGNMENT != 0) {
+    xnn_log_error("failed to load packed weights at address %p: blob must be aligned on a %d-byte boundary",
+      blob, XNN_ALLOCATION_ALIGNMENT);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (blob_size < XNN_PACKED_WEIGHTS_HEADER_SIZE) {
+    xnn_log_error("failed to load packed weights from %zu-byte blob: blob is smaller than the header", blob_size);
+    return xnn_status_invalid_parameter;
+  }
+
+  struct xnn_packed_weights_header blob_header;
+  memcpy(&blob_header, blob, sizeof(blob_header));
+  if (blob_header.magic != XNN_PACKED_WEIGHTS_MAGIC) {
+    xnn_log_error("failed to load packed weights: blob does not contain XNNPACK packed weights");
+    return xnn_status_invalid_parameter;
+  }
+
+  if (blob_header.version != XNN_PACKED_WEIGHTS_VERSION) {
+    xnn_log_error(
+      "failed to load packed weights: blob version %" PRIu32 " does not match supported version %d",
+      blob_header.version, XNN_PACKED_WEIGHTS_VERSION);
+    return xnn_status_unsupported_parameter;
+  }
+
+  if (blob_header.arch != XNN_PACKED_WEIGHTS_ARCH ||
+      blob_header.ukernel_type != op->packed_weights_header.ukernel_type ||
+      blob_header.nr != op->packed_weights_header.nr ||
+      blob_header.kr != op->packed_weights_header.kr ||
+      blob_header.sr != op->packed_weights_header.sr)
+  {
+    xnn_log_error(
+      "failed to load packed weights: blob targets micro-kernel type %" PRIu32 " with %" PRIu32 "x%" PRIu32 "x%" PRIu32
+      " tile on architecture %" PRIu32 ", but the host uses micro-kernel type %" PRIu32 " with %" PRIu32 "x%" PRIu32
+      "x%" PRIu32 " tile on architecture %d",
+      blob_header.ukernel_type, blob_header.nr, blob_header.kr, blob_header.sr, blob_header.arch,
+      op->packed_weights_header.ukernel_type, op->packed_weights_header.nr, op->packed_weights_header.kr,
+      op->packed_weights_header.sr, XNN_PACKED_WEIGHTS_ARCH);
+    return xnn_status_unsupported_hardware;
+  }
+
+  if (blob_header.operator_type != op->packed_weights_header.operator_type ||
+      blob_header.groups != op->packed_weights_header.groups ||
+      blob_header.kernel_height != op->packed_weights_header.kernel_height ||
+      blob_header.kernel_width != op->packed_weights_header.kernel_width ||
+      blob_header.weights_type != op->packed_weights_header.weights_type ||
+      blob_header.group_input_channels != op->packed_weights_header.group_input_channels ||
+      blob_header.group_output_channels != op->packed_weights_header.group_output_channels ||
+      blob_header.weights_size != op->packed_weights_header.weights_size)
+  {
+    xnn_log_error("failed to load packed weights: blob was serialized for an operator with different parameters");
+    return xnn_status_invalid_parameter;
+  }
+
+  if (blob_size - XNN_PACKED_WEIGHTS_HEADER_SIZE < weights_size) {
+    xnn_log_error(
+      "failed to load packed weights from %zu-byte blob: blob is smaller than the header and %zu bytes of weights",
+      blob_size, weights_size);
+    return xnn_status_invalid_parameter;
+  }
+
+  op->packed_weights = (void*) ((uintptr_t) blob + XNN_PACKED_WEIGHTS_HEADER_SIZE);
+  op->packed_weights_external = true;
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_get_operator_packed_weights_size(
+    xnn_operator_t op,
+    size_t* size_out)
+{
+  if (!xnn_params.initialized) {
+    xnn_log_error("failed to query packed weights size: XNNPACK is not initialized");
+    return xnn_status_uninitialized;
+  }
+
+  if (op->packed_weights_header.magic != XNN_PACKED_WEIGHTS_MAGIC) {
+    xnn_log_error("failed to query packed weights size: operator does not support serialization of packed weights");
+    return xnn_status_unsupported_parameter;
+  }
+
+  *size_out = XNN_PACKED_WEIGHTS_HEADER_SIZE + (size_t) op->packed_weights_header.weights_size;
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_export_operator_packed_weights(
+    xnn_operator_t op,
+    size_t blob_size,
+    void* blob)
+{
+  size_t required_size = 0;
+  const enum xnn_status status = xnn_get_operator_packed_weights_size(op, &required_size);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  if (blob_size < required_size) {
+    xnn_log_error("failed to export packed weights into %zu-byte buffer: %zu bytes required",
+      blob_size, required_size);
+    return xnn_status_invalid_parameter;
+  }
+
+  memset(blob, 0, XNN_PACKED_WEIGHTS_HEADER_SIZE);
+  memcpy(blob, &op->packed_weights_header, sizeof(struct xnn_packed_weights_header));
+  memcpy((void*) ((uintptr_t) blob + XNN_PACKED_WEIGHTS_HEADER_SIZE), op->packed_weights,
+    (size_t) op->packed_weights_header.weights_size);
+  return xnn_status_success;
+}
@@ -122,6 +122,8 @@ enum xnn_status xnn_setup_prelu_nc_f32(
     return xnn_status_success;
   }
 
+  prelu_op->batch_size = batch_size;
+
   const size_t channels = prelu_op->channels;
   prelu_op->context.prelu = (struct prelu_context) {
     .n = channels * sizeof(float),
@@ -0,0 +1,89 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xnnpack/scalar-utils.h>
+#include <xnnpack/dwconv.h>
+
+
+void xnn_q8_dwconv_ukernel_mp1x4__scalar(
+    size_t channels,
+    size_t output_width,
+    size_t kernel_size,
+    const uint8_t** input,
+    const void* weights,
+    uint8_t* output,
+    size_t input_stride,
+    size_t output_increment,
+    const union xnn_q8_gemm_params params[restrict static 1])
+{
+  assert(channels != 0);
+  assert(output_width != 0);
+  assert(kernel_size != 0);
+
+  const int32_t vkernel_zero_point = params->scalar.kernel_zero_point;
+  const int32_t vmultiplier = params->scalar.multiplier;
+  const int32_t vq31rounding = INT32_C(0x40000000);
+  const int32_t vremainder_mask = params->scalar.remainder_mask;
+  const uint32_t vshift = params->scalar.shift;
+  const int32_t vremainder_threshold = params->scalar.remainder_threshold;
+  const int32_t vout_min = params->scalar.output_min_less_zero_point;
+  const int32_t vout_max = params->scalar.output_max_less_zero_point;
+  const int32_t voutput_zero_point = params->scalar.output_zero_point;
+  do {
+    size_t c = 0;
+    const void* w = weights;
+    do {
+      int32_t vacc0 = *((const int32_t*) w);
+      int32_t vacc1 = 0;
+      const uint8_t* k = (const uint8_t*) ((uintptr_t) w + sizeof(int32_t));
+
+      const uint8_t** i = input;
+      size_t n = kernel_size;
+      for (; n >= 4; n -= 4) {
+        const int32_t vi0 = (int32_t) (uint32_t) i[0][c];
+        const int32_t vxk0 = (int32_t) (uint32_t) k[0] - vkernel_zero_point;
+        vacc0 += vi0 * vxk0;
+
+        const int32_t vi1 = (int32_t) (uint32_t) i[1][c];
+        const int32_t vxk1 = (int32_t) (uint32_t) k[1] - vkernel_zero_point;
+        vacc1 += vi1 * vxk1;
+
+        const int32_t vi2 = (int32_t) (uint32_t) i[2][c];
+        const int32_t vxk2 = (int32_t) (uint32_t) k[2] - vkernel_zero_point;
+        vacc0 += vi2 * vxk2;
+
+        const int32_t vi3 = (int32_t) (uint32_t) i[3][c];
+        const int32_t vxk3 = (int32_t) (uint32_t) k[3] - vkernel_zero_point;
+        vacc1 += vi3 * vxk3;
+
+        i += 4;
+        k += 4;
+      }
+      for (; n != 0; n--) {
+        const int32_t vi = (int32_t) (uint32_t) (*i++)[c];
+        const int32_t vxk = (int32_t) (uint32_t) *k++ - vkernel_zero_point;
+        vacc0 += vi * vxk;
+      }
+      w = (const void*) k;
+
+      const int32_t vacc = vacc0 + vacc1;
+
+      const int64_t vproduct = (int64_t) vacc * (int64_t) vmultiplier;
+      const int32_t vq31product = (int32_t) (uint32_t) ((uint64_t) (vproduct + (int64_t) vq31rounding) >> 31);
+      const int32_t vremainder = (vq31product & vremainder_mask) - (int32_t) (vq31product < 0);
+      int32_t vout = asr_s32(vq31product, vshift) + (int32_t) (vremainder > vremainder_threshold);
+      vout = vout < vout_min ? vout_min : vout;
+      vout = vout > vout_max ? vout_max : vout;
+      vout += voutput_zero_point;
+
+      *output++ = vout;
+    } while (++c != channels);
+
+    input = (const uint8_t**) ((uintptr_t) input + input_stride);
+    output = (uint8_t*) ((uintptr_t) output + output_increment);
+  } while (--output_width != 0);
+}
@@ -0,0 +1,132 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/dwconv.h>
+
+
+void xnn_q8_dwconv_ukernel_mp8x4__neon(
+    size_t channels,
+    size_t output_width,
+    size_t kernel_size,
+    const uint8_t** input,
+    const void* weights,
+    uint8_t* output,
+    size_t input_stride,
+    size_t output_increment,
+    const union xnn_q8_gemm_params params[restrict static 1])
+{
+  assert(channels != 0);
+  assert(output_width != 0);
+  assert(kernel_size != 0);
+
+  const uint8x8_t vkernel_zero_point = vld1_dup_u8((const uint8_t*) &params->neon.kernel_zero_point);
+  const int32x4_t vmultiplier = vld1q_dup_s32(&params->neon.multiplier);
+  const int32x4_t vright_shift = vld1q_dup_s32(&params->neon.right_shift);
+  const int16x8_t voutput_zero_point = vld1q_dup_s16(&params->neon.output_zero_point);
+  const uint8x8_t voutput_min = vld1_dup_u8(&params->neon.output_min);
+  const uint8x8_t voutput_max = vld1_dup_u8(&params->neon.output_max);
+  const int32x4_t vzero_shift_mask = vreinterpretq_s32_u32(vceqq_s32(vright_shift, vmovq_n_s32(0)));
+
+  do {
+    size_t c = channels;
+    size_t input_offset = 0;
+    const void* w = weights;
+    do {
+      int32x4_t vaccX0_lo = vld1q_s32(w); w = (const void*) ((uintptr_t) w + sizeof(int32x4_t));
+      int32x4_t vaccX0_hi = vld1q_s32(w); w = (const void*) ((uintptr_t) w + sizeof(int32x4_t));
+      int32x4_t vaccX1_lo = vmovq_n_s32(0);
+      int32x4_t vaccX1_hi = vmovq_n_s32(0);
+
+      const uint8_t** i = input;
+      size_t k = kernel_size;
+      for (; k >= 4; k -= 4) {
+        const uint8x8_t vk0 = vld1_u8(w); w = (const void*) ((uintptr_t) w + sizeof(uint8x8_t));
+        const uint8x8_t vi0 = vld1_u8((const uint8_t*) ((uintptr_t) i[0] + input_offset));
+        const int16x8_t vxk0 = vreinterpretq_s16_u16(vsubl_u8(vk0, vkernel_zero_point));
+        const int16x8_t vxi0 = vreinterpretq_s16_u16(vmovl_u8(vi0));
+        vaccX0_lo = vmlal_s16(vaccX0_lo, vget_low_s16(vxk0), vget_low_s16(vxi0));
+        vaccX0_hi = vmlal_s16(vaccX0_hi, vget_high_s16(vxk0), vget_high_s16(vxi0));
+
+        const uint8x8_t vk1 = vld1_u8(w); w = (const void*) ((uintptr_t) w + sizeof(uint8x8_t));
+        const uint8x8_t vi1 = vld1_u8((const uint8_t*) ((uintptr_t) i[1] + input_offset));
+        const int16x8_t vxk1 = vreinterpretq_s16_u16(vsubl_u8(vk1, vkernel_zero_point));
+        const int16x8_t vxi1 = vreinterpretq_s16_u16(vmovl_u8(vi1));
+        vaccX1_lo = vmlal_s16(vaccX1_lo, vget_low_s16(vxk1), vget_low_s16(vxi1));
+        vaccX1_hi = vmlal_s16(vaccX1_hi, vget_high_s16(vxk1), vget_high_s16(vxi1));
+
+        const uint8x8_t vk2 = vld1_u8(w); w = (const void*) ((uintptr_t) w + sizeof(uint8x8_t));
+        const uint8x8_t vi2 = vld1_u8((const uint8_t*) ((uintptr_t) i[2] + input_offset));
+        const int16x8_t vxk2 = vreinterpretq_s16_u16(vsubl_u8(vk2, vkernel_zero_point));
+        const int16x8_t vxi2 = vreinterpretq_s16_u16(vmovl_u8(vi2));
+        vaccX0_lo = vmlal_s16(vaccX0_lo, vget_low_s16(vxk2), vget_low_s16(vxi2));
+        vaccX0_hi = vmlal_s16(vaccX0_hi, vget_high_s16(vxk2), vget_high_s16(vxi2));
+
+        const uint8x8_t vk3 = vld1_u8(w); w = (const void*) ((uintptr_t) w + sizeof(uint8x8_t));
+        const uint8x8_t vi3 = vld1_u8((const uint8_t*) ((uintptr_t) i[3] + input_offset));
+        const int16x8_t vxk3 = vreinterpretq_s16_u16(vsubl_u8(vk3, vkernel_zero_point));
+        const int16x8_t vxi3 = vreinterpretq_s16_u16(vmovl_u8(vi3));
+        vaccX1_lo = vmlal_s16(vaccX1_lo, vget_low_s16(vxk3), vget_low_s16(vxi3));
+        vaccX1_hi = vmlal_s16(vaccX1_hi, vget_high_s16(vxk3), vget_high_s16(vxi3));
+
+        i += 4;
+      }
+      for (; k != 0; k--) {
+        const uint8x8_t vk = vld1_u8(w); w = (const void*) ((uintptr_t) w + sizeof(uint8x8_t));
+        const uint8x8_t vi = vld1_u8((const uint8_t*) ((uintptr_t) *i++ + input_offset));
+        const int16x8_t vxk = vreinterpretq_s16_u16(vsubl_u8(vk, vkernel_zero_point));
+        const int16x8_t vxi = vreinterpretq_s16_u16(vmovl_u8(vi));
+        vaccX0_lo = vmlal_s16(vaccX0_lo, vget_low_s16(vxk), vget_low_s16(vxi));
+        vaccX0_hi = vmlal_s16(vaccX0_hi, vget_high_s16(vxk), vget_high_s16(vxi));
+      }
+
+      int32x4_t vacc_lo = vaddq_s32(vaccX0_lo, vaccX1_lo);
+      int32x4_t vacc_hi = vaddq_s32(vaccX0_hi, vaccX1_hi);
+
+      vacc_lo = vqrdmulhq_s32(vacc_lo, vmultiplier);
+      vacc_hi = vqrdmulhq_s32(vacc_hi, vmultiplier);
+
+      vacc_lo = vsraq_n_s32(vacc_lo, vbicq_s32(vacc_lo, vzero_shift_mask), 31);
+      vacc_hi = vsraq_n_s32(vacc_hi, vbicq_s32(vacc_hi, vzero_shift_mask), 31);
+
+      vacc_lo = vrshlq_s32(vacc_lo, vright_shift);
+      vacc_hi = vrshlq_s32(vacc_hi, vright_shift);
+
+#ifdef __aarch64__
+      const int16x8_t vacc = vqaddq_s16(vqmovn_high_s32(vqmovn_s32(vacc_lo), vacc_hi), voutput_zero_point);
+#else
+      const int16x8_t vacc = vqaddq_s16(vcombine_s16(vqmovn_s32(vacc_lo), vqmovn_s32(vacc_hi)), voutput_zero_point);
+#endif
+      uint8x8_t vout = vqmovun_s16(vacc);
+      vout = vmax_u8(vout, voutput_min);
+      vout = vmin_u8(vout, voutput_max);
+
+      if XNN_LIKELY(c >= 8) {
+        vst1_u8(output, vout); output += 8;
+        input_offset += 8;
+        c -= 8;
+      } else {
+        if (c & 4) {
+          vst1_lane_u32(__builtin_assume_aligned(output, 1), vreinterpret_u32_u8(vout), 0); output += 4;
+          vout = vext_u8(vout, vout, 4);
+        }
+        if (c & 2) {
+          vst1_lane_u16(__builtin_assume_aligned(output, 1), vreinterpret_u16_u8(vout), 0); output += 2;
+          vout = vext_u8(vout, vout, 2);
+        }
+        if (c & 1) {
+          vst1_lane_u8(__builtin_assume_aligned(output, 1), vout, 0); output++;
+        }
+        c = 0;
+      }
+    } while (c != 0);
+
+    input = (const uint8_t**) ((uintptr_t) input + input_stride);
+    output = (uint8_t*) ((uintptr_t) output + output_increment);
+  } while (--output_width != 0);
+}
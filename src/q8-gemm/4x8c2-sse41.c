@@ -0,0 +1,399 @@
+// Auto-generated file. Do not edit!
+//   Template: src/q8-gemm/MRx8c2-sse41.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <smmintrin.h>
+
+#include <xnnpack/gemm.h>
+
+
+void xnn_q8_gemm_ukernel_4x8c2__sse41(
+    size_t mr,
+    size_t nc,
+    size_t kc,
+    const uint8_t* restrict a,
+    size_t a_stride,
+    const void* restrict w,
+    uint8_t* restrict c,
+    size_t cm_stride,
+    size_t cn_stride,
+    const union xnn_q8_gemm_params params[restrict static 1])
+{
+  assert(mr != 0);
+  assert(mr <= 4);
+  assert(nc != 0);
+  assert(kc != 0);
+
+  const uint8_t* a0 = a;
+  uint8_t* c0 = c;
+  const uint8_t* a1 = (const uint8_t*) ((uintptr_t) a0 + a_stride);
+  uint8_t* c1 = (uint8_t*) ((uintptr_t) c0 + cm_stride);
+  if XNN_UNPREDICTABLE(mr < 2) {
+    a1 = a0;
+    c1 = c0;
+  }
+  const uint8_t* a2 = (const uint8_t*) ((uintptr_t) a1 + a_stride);
+  uint8_t* c2 = (uint8_t*) ((uintptr_t) c1 + cm_stride);
+  if XNN_UNPREDICTABLE(mr <= 2) {
+    a2 = a1;
+    c2 = c1;
+  }
+  const uint8_t* a3 = (const uint8_t*) ((uintptr_t) a2 + a_stride);
+  uint8_t* c3 = (uint8_t*) ((uintptr_t) c2 + cm_stride);
+  if XNN_UNPREDICTABLE(mr != 4) {
+    a3 = a2;
+    c3 = c2;
+  }
+
+  const __m128i vb_zero_point = _mm_load_si128((const __m128i*) params->sse2.kernel_zero_point);
+
+  do {
+    __m128i vacc0x0123 = _mm_loadu_si128((const __m128i*) w);
+    __m128i vacc0x4567 = _mm_loadu_si128((const __m128i*) ((uintptr_t) w + 16));
+    __m128i vacc1x0123 = vacc0x0123;
+    __m128i vacc1x4567 = vacc0x4567;
+    __m128i vacc2x0123 = vacc0x0123;
+    __m128i vacc2x4567 = vacc0x4567;
+    __m128i vacc3x0123 = vacc0x0123;
+    __m128i vacc3x4567 = vacc0x4567;
+    w = (const void*) ((uintptr_t) w + 32);
+
+    const __m128i vzero = _mm_setzero_si128();
+    size_t k = kc;
+    while (k >= 8 * sizeof(uint8_t)) {
+      const __m128i vxa0 = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i*) a0));
+      a0 += 8;
+      const __m128i vxa1 = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i*) a1));
+      a1 += 8;
+      const __m128i vxa2 = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i*) a2));
+      a2 += 8;
+      const __m128i vxa3 = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i*) a3));
+      a3 += 8;
+
+      const __m128i vb0 = _mm_loadu_si128((const __m128i*) w);
+      const __m128i vxb0x0123 = _mm_sub_epi16(_mm_cvtepu8_epi16(vb0), vb_zero_point);
+      const __m128i vxb0x4567 = _mm_sub_epi16(_mm_unpackhi_epi8(vb0, vzero), vb_zero_point);
+
+      const __m128i vxa0c0 = _mm_shuffle_epi32(vxa0, _MM_SHUFFLE(0, 0, 0, 0));
+      vacc0x0123 = _mm_add_epi32(vacc0x0123, _mm_madd_epi16(vxa0c0, vxb0x0123));
+      vacc0x4567 = _mm_add_epi32(vacc0x4567, _mm_madd_epi16(vxa0c0, vxb0x4567));
+      const __m128i vxa1c0 = _mm_shuffle_epi32(vxa1, _MM_SHUFFLE(0, 0, 0, 0));
+      vacc1x0123 = _mm_add_epi32(vacc1x0123, _mm_madd_epi16(vxa1c0, vxb0x0123));
+      vacc1x4567 = _mm_add_epi32(vacc1x4567, _mm_madd_epi16(vxa1c0, vxb0x4567));
+      const __m128i vxa2c0 = _mm_shuffle_epi32(vxa2, _MM_SHUFFLE(0, 0, 0, 0));
+      vacc2x0123 = _mm_add_epi32(vacc2x0123, _mm_madd_epi16(vxa2c0, vxb0x0123));
+      vacc2x4567 = _mm_add_epi32(vacc2x4567, _mm_madd_epi16(vxa2c0, vxb0x4567));
+      const __m128i vxa3c0 = _mm_shuffle_epi32(vxa3, _MM_SHUFFLE(0, 0, 0, 0));
+      vacc3x0123 = _mm_add_epi32(vacc3x0123, _mm_madd_epi16(vxa3c0, vxb0x0123));
+      vacc3x4567 = _mm_add_epi32(vacc3x4567, _mm_madd_epi16(vxa3c0, vxb0x4567));
+
+      const __m128i vb1 = _mm_loadu_si128((const __m128i*) ((uintptr_t) w + 16));
+      const __m128i vxb1x0123 = _mm_sub_epi16(_mm_cvtepu8_epi16(vb1), vb_zero_point);
+      const __m128i vxb1x4567 = _mm_sub_epi16(_mm_unpackhi_epi8(vb1, vzero), vb_zero_point);
+
+      const __m128i vxa0c1 = _mm_shuffle_epi32(vxa0, _MM_SHUFFLE(1, 1, 1, 1));
+      vacc0x0123 = _mm_add_epi32(vacc0x0123, _mm_madd_epi16(vxa0c1, vxb1x0123));
+      vacc0x4567 = _mm_add_epi32(vacc0x4567, _mm_madd_epi16(vxa0c1, vxb1x4567));
+      const __m128i vxa1c1 = _mm_shuffle_epi32(vxa1, _MM_SHUFFLE(1, 1, 1, 1));
+      vacc1x0123 = _mm_add_epi32(vacc1x0123, _mm_madd_epi16(vxa1c1, vxb1x0123));
+      vacc1x4567 = _mm_add_epi32(vacc1x4567, _mm_madd_epi16(vxa1c1, vxb1x4567));
+      const __m128i vxa2c1 = _mm_shuffle_epi32(vxa2, _MM_SHUFFLE(1, 1, 1, 1));
+      vacc2x0123 = _mm_add_epi32(vacc2x0123, _mm_madd_epi16(vxa2c1, vxb1x0123));
+      vacc2x4567 = _mm_add_epi32(vacc2x4567, _mm_madd_epi16(vxa2c1, vxb1x4567));
+      const __m128i vxa3c1 = _mm_shuffle_epi32(vxa3, _MM_SHUFFLE(1, 1, 1, 1));
+      vacc3x0123 = _mm_add_epi32(vacc3x0123, _mm_madd_epi16(vxa3c1, vxb1x0123));
+      vacc3x4567 = _mm_add_epi32(vacc3x4567, _mm_madd_epi16(vxa3c1, vxb1x4567));
+
+      const __m128i vb2 = _mm_loadu_si128((const __m128i*) ((uintptr_t) w + 32));
+      const __m128i vxb2x0123 = _mm_sub_epi16(_mm_cvtepu8_epi16(vb2), vb_zero_point);
+      const __m128i vxb2x4567 = _mm_sub_epi16(_mm_unpackhi_epi8(vb2, vzero), vb_zero_point);
+
+      const __m128i vxa0c2 = _mm_shuffle_epi32(vxa0, _MM_SHUFFLE(2, 2, 2, 2));
+      vacc0x0123 = _mm_add_epi32(vacc0x0123, _mm_madd_epi16(vxa0c2, vxb2x0123));
+      vacc0x4567 = _mm_add_epi32(vacc0x4567, _mm_madd_epi16(vxa0c2, vxb2x4567));
+      const __m128i vxa1c2 = _mm_shuffle_epi32(vxa1, _MM_SHUFFLE(2, 2, 2, 2));
+      vacc1x0123 = _mm_add_epi32(vacc1x0123, _mm_madd_epi16(vxa1c2, vxb2x0123));
+      vacc1x4567 = _mm_add_epi32(vacc1x4567, _mm_madd_epi16(vxa1c2, vxb2x4567));
+      const __m128i vxa2c2 = _mm_shuffle_epi32(vxa2, _MM_SHUFFLE(2, 2, 2, 2));
+      vacc2x0123 = _mm_add_epi32(vacc2x0123, _mm_madd_epi16(vxa2c2, vxb2x0123));
+      vacc2x4567 = _mm_add_epi32(vacc2x4567, _mm_madd_epi16(vxa2c2, vxb2x4567));
+      const __m128i vxa3c2 = _mm_shuffle_epi32(vxa3, _MM_SHUFFLE(2, 2, 2, 2));
+      vacc3x0123 = _mm_add_epi32(vacc3x0123, _mm_madd_epi16(vxa3c2, vxb2x0123));
+      vacc3x4567 = _mm_add_epi32(vacc3x4567, _mm_madd_epi16(vxa3c2, vxb2x4567));
+
+      const __m128i vb3 = _mm_loadu_si128((const __m128i*) ((uintptr_t) w + 48));
+      const __m128i vxb3x0123 = _mm_sub_epi16(_mm_cvtepu8_epi16(vb3), vb_zero_point);
+      const __m128i vxb3x4567 = _mm_sub_epi16(_mm_unpackhi_epi8(vb3, vzero), vb_zero_point);
+
+      const __m128i vxa0c3 = _mm_shuffle_epi32(vxa0, _MM_SHUFFLE(3, 3, 3, 3));
+      vacc0x0123 = _mm_add_epi32(vacc0x0123, _mm_madd_epi16(vxa0c3, vxb3x0123));
+      vacc0x4567 = _mm_add_epi32(vacc0x4567, _mm_madd_epi16(vxa0c3, vxb3x4567));
+      const __m128i vxa1c3 = _mm_shuffle_epi32(vxa1, _MM_SHUFFLE(3, 3, 3, 3));
+      vacc1x0123 = _mm_add_epi32(vacc1x0123, _mm_madd_epi16(vxa1c3, vxb3x0123));
+      vacc1x4567 = _mm_add_epi32(vacc1x4567, _mm_madd_epi16(vxa1c3, vxb3x4567));
+      const __m128i vxa2c3 = _mm_shuffle_epi32(vxa2, _MM_SHUFFLE(3, 3, 3, 3));
+      vacc2x0123 = _mm_add_epi32(vacc2x0123, _mm_madd_epi16(vxa2c3, vxb3x0123));
+      vacc2x4567 = _mm_add_epi32(vacc2x4567, _mm_madd_epi16(vxa2c3, vxb3x4567));
+      const __m128i vxa3c3 = _mm_shuffle_epi32(vxa3, _MM_SHUFFLE(3, 3, 3, 3));
+      vacc3x0123 = _mm_add_epi32(vacc3x0123, _mm_madd_epi16(vxa3c3, vxb3x0123));
+      vacc3x4567 = _mm_add_epi32(vacc3x4567, _mm_madd_epi16(vxa3c3, vxb3x4567));
+
+      w = (const void*) ((uintptr_t) w + 64);
+      k -= 8 * sizeof(uint8_t);
+    }
+    if (k != 0) {
+      const __m128i vxa0 = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i*) a0));
+      a0 = (const uint8_t*) ((uintptr_t) a0 + k);
+      const __m128i vxa1 = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i*) a1));
+      a1 = (const uint8_t*) ((uintptr_t) a1 + k);
+      const __m128i vxa2 = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i*) a2));
+      a2 = (const uint8_t*) ((uintptr_t) a2 + k);
+      const __m128i vxa3 = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i*) a3));
+      a3 = (const uint8_t*) ((uintptr_t) a3 + k);
+
+      const __m128i vb0 = _mm_loadu_si128((const __m128i*) w);
+      w = (const void*) ((uintptr_t) w + 16);
+      const __m128i vxb0x0123 = _mm_sub_epi16(_mm_cvtepu8_epi16(vb0), vb_zero_point);
+      const __m128i vxb0x4567 = _mm_sub_epi16(_mm_unpackhi_epi8(vb0, vzero), vb_zero_point);
+
+      const __m128i vxa0c0 = _mm_shuffle_epi32(vxa0, _MM_SHUFFLE(0, 0, 0, 0));
+      vacc0x0123 = _mm_add_epi32(vacc0x0123, _mm_madd_epi16(vxa0c0, vxb0x0123));
+      vacc0x4567 = _mm_add_epi32(vacc0x4567, _mm_madd_epi16(vxa0c0, vxb0x4567));
+      const __m128i vxa1c0 = _mm_shuffle_epi32(vxa1, _MM_SHUFFLE(0, 0, 0, 0));
+      vacc1x0123 = _mm_add_epi32(vacc1x0123, _mm_madd_epi16(vxa1c0, vxb0x0123));
+      vacc1x4567 = _mm_add_epi32(vacc1x4567, _mm_madd_epi16(vxa1c0, vxb0x4567));
+      const __m128i vxa2c0 = _mm_shuffle_epi32(vxa2, _MM_SHUFFLE(0, 0, 0, 0));
+      vacc2x0123 = _mm_add_epi32(vacc2x0123, _mm_madd_epi16(vxa2c0, vxb0x0123));
+      vacc2x4567 = _mm_add_epi32(vacc2x4567, _mm_madd_epi16(vxa2c0, vxb0x4567));
+      const __m128i vxa3c0 = _mm_shuffle_epi32(vxa3, _MM_SHUFFLE(0, 0, 0, 0));
+      vacc3x0123 = _mm_add_epi32(vacc3x0123, _mm_madd_epi16(vxa3c0, vxb0x0123));
+      vacc3x4567 = _mm_add_epi32(vacc3x4567, _mm_madd_epi16(vxa3c0, vxb0x4567));
+
+      if (k > 2 * sizeof(uint8_t)) {
+        const __m128i vb1 = _mm_loadu_si128((const __m128i*) w);
+        w = (const void*) ((uintptr_t) w + 16);
+        const __m128i vxb1x0123 = _mm_sub_epi16(_mm_cvtepu8_epi16(vb1), vb_zero_point);
+        const __m128i vxb1x4567 = _mm_sub_epi16(_mm_unpackhi_epi8(vb1, vzero), vb_zero_point);
+
+        const __m128i vxa0c1 = _mm_shuffle_epi32(vxa0, _MM_SHUFFLE(1, 1, 1, 1));
+        vacc0x0123 = _mm_add_epi32(vacc0x0123, _mm_madd_epi16(vxa0c1, vxb1x0123));
+        vacc0x4567 = _mm_add_epi32(vacc0x4567, _mm_madd_epi16(vxa0c1, vxb1x4567));
+        const __m128i vxa1c1 = _mm_shuffle_epi32(vxa1, _MM_SHUFFLE(1, 1, 1, 1));
+        vacc1x0123 = _mm_add_epi32(vacc1x0123, _mm_madd_epi16(vxa1c1, vxb1x0123));
+        vacc1x4567 = _mm_add_epi32(vacc1x4567, _mm_madd_epi16(vxa1c1, vxb1x4567));
+        const __m128i vxa2c1 = _mm_shuffle_epi32(vxa2, _MM_SHUFFLE(1, 1, 1, 1));
+        vacc2x0123 = _mm_add_epi32(vacc2x0123, _mm_madd_epi16(vxa2c1, vxb1x0123));
+        vacc2x4567 = _mm_add_epi32(vacc2x4567, _mm_madd_epi16(vxa2c1, vxb1x4567));
+        const __m128i vxa3c1 = _mm_shuffle_epi32(vxa3, _MM_SHUFFLE(1, 1, 1, 1));
+        vacc3x0123 = _mm_add_epi32(vacc3x0123, _mm_madd_epi16(vxa3c1, vxb1x0123));
+        vacc3x4567 = _mm_add_epi32(vacc3x4567, _mm_madd_epi16(vxa3c1, vxb1x4567));
+      }
+
+      if (k > 4 * sizeof(uint8_t)) {
+        const __m128i vb2 = _mm_loadu_si128((const __m128i*) w);
+        w = (const void*) ((uintptr_t) w + 16);
+        const __m128i vxb2x0123 = _mm_sub_epi16(_mm_cvtepu8_epi16(vb2), vb_zero_point);
+        const __m128i vxb2x4567 = _mm_sub_epi16(_mm_unpackhi_epi8(vb2, vzero), vb_zero_point);
+
+        const __m128i vxa0c2 = _mm_shuffle_epi32(vxa0, _MM_SHUFFLE(2, 2, 2, 2));
+        vacc0x0123 = _mm_add_epi32(vacc0x0123, _mm_madd_epi16(vxa0c2, vxb2x0123));
+        vacc0x4567 = _mm_add_epi32(vacc0x4567, _mm_madd_epi16(vxa0c2, vxb2x4567));
+        const __m128i vxa1c2 = _mm_shuffle_epi32(vxa1, _MM_SHUFFLE(2, 2, 2, 2));
+        vacc1x0123 = _mm_add_epi32(vacc1x0123, _mm_madd_epi16(vxa1c2, vxb2x0123));
+        vacc1x4567 = _mm_add_epi32(vacc1x4567, _mm_madd_epi16(vxa1c2, vxb2x4567));
+        const __m128i vxa2c2 = _mm_shuffle_epi32(vxa2, _MM_SHUFFLE(2, 2, 2, 2));
+        vacc2x0123 = _mm_add_epi32(vacc2x0123, _mm_madd_epi16(vxa2c2, vxb2x0123));
+        vacc2x4567 = _mm_add_epi32(vacc2x4567, _mm_madd_epi16(vxa2c2, vxb2x4567));
+        const __m128i vxa3c2 = _mm_shuffle_epi32(vxa3, _MM_SHUFFLE(2, 2, 2, 2));
+        vacc3x0123 = _mm_add_epi32(vacc3x0123, _mm_madd_epi16(vxa3c2, vxb2x0123));
+        vacc3x4567 = _mm_add_epi32(vacc3x4567, _mm_madd_epi16(vxa3c2, vxb2x4567));
+      }
+
+      if (k > 6 * sizeof(uint8_t)) {
+        const __m128i vb3 = _mm_loadu_si128((const __m128i*) w);
+        w = (const void*) ((uintptr_t) w + 16);
+        const __m128i vxb3x0123 = _mm_sub_epi16(_mm_cvtepu8_epi16(vb3), vb_zero_point);
+        const __m128i vxb3x4567 = _mm_sub_epi16(_mm_unpackhi_epi8(vb3, vzero), vb_zero_point);
+
+        const __m128i vxa0c3 = _mm_shuffle_epi32(vxa0, _MM_SHUFFLE(3, 3, 3, 3));
+        vacc0x0123 = _mm_add_epi32(vacc0x0123, _mm_madd_epi16(vxa0c3, vxb3x0123));
+        vacc0x4567 = _mm_add_epi32(vacc0x4567, _mm_madd_epi16(vxa0c3, vxb3x4567));
+        const __m128i vxa1c3 = _mm_shuffle_epi32(vxa1, _MM_SHUFFLE(3, 3, 3, 3));
+        vacc1x0123 = _mm_add_epi32(vacc1x0123, _mm_madd_epi16(vxa1c3, vxb3x0123));
+        vacc1x4567 = _mm_add_epi32(vacc1x4567, _mm_madd_epi16(vxa1c3, vxb3x4567));
+        const __m128i vxa2c3 = _mm_shuffle_epi32(vxa2, _MM_SHUFFLE(3, 3, 3, 3));
+        vacc2x0123 = _mm_add_epi32(vacc2x0123, _mm_madd_epi16(vxa2c3, vxb3x0123));
+        vacc2x4567 = _mm_add_epi32(vacc2x4567, _mm_madd_epi16(vxa2c3, vxb3x4567));
+        const __m128i vxa3c3 = _mm_shuffle_epi32(vxa3, _MM_SHUFFLE(3, 3, 3, 3));
+        vacc3x0123 = _mm_add_epi32(vacc3x0123, _mm_madd_epi16(vxa3c3, vxb3x0123));
+        vacc3x4567 = _mm_add_epi32(vacc3x4567, _mm_madd_epi16(vxa3c3, vxb3x4567));
+      }
+    }
+
+    // Q31 fixed-point multiplication: the signed 32x32->64-bit product of SSE4.1 removes the need
+    // for the absolute value / sign restoration steps of the SSE2 micro-kernels.
+    const __m128i vmultiplier = _mm_load_si128((const __m128i*) params->sse2.multiplier);
+    const __m128i vrounding = _mm_load_si128((const __m128i*) params->sse2.rounding);
+
+    const __m128i vacc0x1133 = _mm_shuffle_epi32(vacc0x0123, _MM_SHUFFLE(3, 3, 1, 1));
+    const __m128i vacc0x5577 = _mm_shuffle_epi32(vacc0x4567, _MM_SHUFFLE(3, 3, 1, 1));
+    const __m128i vacc1x1133 = _mm_shuffle_epi32(vacc1x0123, _MM_SHUFFLE(3, 3, 1, 1));
+    const __m128i vacc1x5577 = _mm_shuffle_epi32(vacc1x4567, _MM_SHUFFLE(3, 3, 1, 1));
+    const __m128i vacc2x1133 = _mm_shuffle_epi32(vacc2x0123, _MM_SHUFFLE(3, 3, 1, 1));
+    const __m128i vacc2x5577 = _mm_shuffle_epi32(vacc2x4567, _MM_SHUFFLE(3, 3, 1, 1));
+    const __m128i vacc3x1133 = _mm_shuffle_epi32(vacc3x0123, _MM_SHUFFLE(3, 3, 1, 1));
+    const __m128i vacc3x5577 = _mm_shuffle_epi32(vacc3x4567, _MM_SHUFFLE(3, 3, 1, 1));
+
+    const __m128i vprod0x02 = _mm_add_epi64(_mm_mul_epi32(vacc0x0123, vmultiplier), vrounding);
+    const __m128i vprod0x13 = _mm_add_epi64(_mm_mul_epi32(vacc0x1133, vmultiplier), vrounding);
+    const __m128i vprod0x46 = _mm_add_epi64(_mm_mul_epi32(vacc0x4567, vmultiplier), vrounding);
+    const __m128i vprod0x57 = _mm_add_epi64(_mm_mul_epi32(vacc0x5577, vmultiplier), vrounding);
+    const __m128i vprod1x02 = _mm_add_epi64(_mm_mul_epi32(vacc1x0123, vmultiplier), vrounding);
+    const __m128i vprod1x13 = _mm_add_epi64(_mm_mul_epi32(vacc1x1133, vmultiplier), vrounding);
+    const __m128i vprod1x46 = _mm_add_epi64(_mm_mul_epi32(vacc1x4567, vmultiplier), vrounding);
+    const __m128i vprod1x57 = _mm_add_epi64(_mm_mul_epi32(vacc1x5577, vmultiplier), vrounding);
+    const __m128i vprod2x02 = _mm_add_epi64(_mm_mul_epi32(vacc2x0123, vmultiplier), vrounding);
+    const __m128i vprod2x13 = _mm_add_epi64(_mm_mul_epi32(vacc2x1133, vmultiplier), vrounding);
+    const __m128i vprod2x46 = _mm_add_epi64(_mm_mul_epi32(vacc2x4567, vmultiplier), vrounding);
+    const __m128i vprod2x57 = _mm_add_epi64(_mm_mul_epi32(vacc2x5577, vmultiplier), vrounding);
+    const __m128i vprod3x02 = _mm_add_epi64(_mm_mul_epi32(vacc3x0123, vmultiplier), vrounding);
+    const __m128i vprod3x13 = _mm_add_epi64(_mm_mul_epi32(vacc3x1133, vmultiplier), vrounding);
+    const __m128i vprod3x46 = _mm_add_epi64(_mm_mul_epi32(vacc3x4567, vmultiplier), vrounding);
+    const __m128i vprod3x57 = _mm_add_epi64(_mm_mul_epi32(vacc3x5577, vmultiplier), vrounding);
+
+    const __m128i vq31prod0x02 = _mm_srli_epi64(vprod0x02, 31);
+    const __m128i vq31prod0x13 = _mm_add_epi64(vprod0x13, vprod0x13);
+    const __m128i vq31prod0x46 = _mm_srli_epi64(vprod0x46, 31);
+    const __m128i vq31prod0x57 = _mm_add_epi64(vprod0x57, vprod0x57);
+    const __m128i vq31prod1x02 = _mm_srli_epi64(vprod1x02, 31);
+    const __m128i vq31prod1x13 = _mm_add_epi64(vprod1x13, vprod1x13);
+    const __m128i vq31prod1x46 = _mm_srli_epi64(vprod1x46, 31);
+    const __m128i vq31prod1x57 = _mm_add_epi64(vprod1x57, vprod1x57);
+    const __m128i vq31prod2x02 = _mm_srli_epi64(vprod2x02, 31);
+    const __m128i vq31prod2x13 = _mm_add_epi64(vprod2x13, vprod2x13);
+    const __m128i vq31prod2x46 = _mm_srli_epi64(vprod2x46, 31);
+    const __m128i vq31prod2x57 = _mm_add_epi64(vprod2x57, vprod2x57);
+    const __m128i vq31prod3x02 = _mm_srli_epi64(vprod3x02, 31);
+    const __m128i vq31prod3x13 = _mm_add_epi64(vprod3x13, vprod3x13);
+    const __m128i vq31prod3x46 = _mm_srli_epi64(vprod3x46, 31);
+    const __m128i vq31prod3x57 = _mm_add_epi64(vprod3x57, vprod3x57);
+
+    const __m128i vq31prod0x0123 = _mm_blend_epi16(vq31prod0x02, vq31prod0x13, 0xCC);
+    const __m128i vq31prod0x4567 = _mm_blend_epi16(vq31prod0x46, vq31prod0x57, 0xCC);
+    const __m128i vq31prod1x0123 = _mm_blend_epi16(vq31prod1x02, vq31prod1x13, 0xCC);
+    const __m128i vq31prod1x4567 = _mm_blend_epi16(vq31prod1x46, vq31prod1x57, 0xCC);
+    const __m128i vq31prod2x0123 = _mm_blend_epi16(vq31prod2x02, vq31prod2x13, 0xCC);
+    const __m128i vq31prod2x4567 = _mm_blend_epi16(vq31prod2x46, vq31prod2x57, 0xCC);
+    const __m128i vq31prod3x0123 = _mm_blend_epi16(vq31prod3x02, vq31prod3x13, 0xCC);
+    const __m128i vq31prod3x4567 = _mm_blend_epi16(vq31prod3x46, vq31prod3x57, 0xCC);
+
+    const __m128i vremainder_mask = _mm_load_si128((const __m128i*) params->sse2.remainder_mask);
+    const __m128i vrem0x0123 =
+      _mm_add_epi32(_mm_and_si128(vq31prod0x0123, vremainder_mask), _mm_cmpgt_epi32(_mm_setzero_si128(), vq31prod0x0123));
+    const __m128i vrem0x4567 =
+      _mm_add_epi32(_mm_and_si128(vq31prod0x4567, vremainder_mask), _mm_cmpgt_epi32(_mm_setzero_si128(), vq31prod0x4567));
+    const __m128i vrem1x0123 =
+      _mm_add_epi32(_mm_and_si128(vq31prod1x0123, vremainder_mask), _mm_cmpgt_epi32(_mm_setzero_si128(), vq31prod1x0123));
+    const __m128i vrem1x4567 =
+      _mm_add_epi32(_mm_and_si128(vq31prod1x4567, vremainder_mask), _mm_cmpgt_epi32(_mm_setzero_si128(), vq31prod1x4567));
+    const __m128i vrem2x0123 =
+      _mm_add_epi32(_mm_and_si128(vq31prod2x0123, vremainder_mask), _mm_cmpgt_epi32(_mm_setzero_si128(), vq31prod2x0123));
+    const __m128i vrem2x4567 =
+      _mm_add_epi32(_mm_and_si128(vq31prod2x4567, vremainder_mask), _mm_cmpgt_epi32(_mm_setzero_si128(), vq31prod2x4567));
+    const __m128i vrem3x0123 =
+      _mm_add_epi32(_mm_and_si128(vq31prod3x0123, vremainder_mask), _mm_cmpgt_epi32(_mm_setzero_si128(), vq31prod3x0123));
+    const __m128i vrem3x4567 =
+      _mm_add_epi32(_mm_and_si128(vq31prod3x4567, vremainder_mask), _mm_cmpgt_epi32(_mm_setzero_si128(), vq31prod3x4567));
+
+    const __m128i vremainder_threshold = _mm_load_si128((const __m128i*) params->sse2.remainder_threshold);
+    const __m128i vshift = _mm_load_si128((const __m128i*) params->sse2.shift);
+    vacc0x0123 =
+      _mm_sub_epi32(_mm_sra_epi32(vq31prod0x0123, vshift), _mm_cmpgt_epi32(vrem0x0123, vremainder_threshold));
+    vacc0x4567 =
+      _mm_sub_epi32(_mm_sra_epi32(vq31prod0x4567, vshift), _mm_cmpgt_epi32(vrem0x4567, vremainder_threshold));
+    vacc1x0123 =
+      _mm_sub_epi32(_mm_sra_epi32(vq31prod1x0123, vshift), _mm_cmpgt_epi32(vrem1x0123, vremainder_threshold));
+    vacc1x4567 =
+      _mm_sub_epi32(_mm_sra_epi32(vq31prod1x4567, vshift), _mm_cmpgt_epi32(vrem1x4567, vremainder_threshold));
+    vacc2x0123 =
+      _mm_sub_epi32(_mm_sra_epi32(vq31prod2x0123, vshift), _mm_cmpgt_epi32(vrem2x0123, vremainder_threshold));
+    vacc2x4567 =
+      _mm_sub_epi32(_mm_sra_epi32(vq31prod2x4567, vshift), _mm_cmpgt_epi32(vrem2x4567, vremainder_threshold));
+    vacc3x0123 =
+      _mm_sub_epi32(_mm_sra_epi32(vq31prod3x0123, vshift), _mm_cmpgt_epi32(vrem3x0123, vremainder_threshold));
+    vacc3x4567 =
+      _mm_sub_epi32(_mm_sra_epi32(vq31prod3x4567, vshift), _mm_cmpgt_epi32(vrem3x4567, vremainder_threshold));
+
+    const __m128i voutput_zero_point = _mm_load_si128((const __m128i*) params->sse2.output_zero_point);
+    const __m128i vacc0x01234567 = _mm_adds_epi16(_mm_packs_epi32(vacc0x0123, vacc0x4567), voutput_zero_point);
+    const __m128i vacc1x01234567 = _mm_adds_epi16(_mm_packs_epi32(vacc1x0123, vacc1x4567), voutput_zero_point);
+    const __m128i vacc2x01234567 = _mm_adds_epi16(_mm_packs_epi32(vacc2x0123, vacc2x4567), voutput_zero_point);
+    const __m128i vacc3x01234567 = _mm_adds_epi16(_mm_packs_epi32(vacc3x0123, vacc3x4567), voutput_zero_point);
+
+    const __m128i voutput_max = _mm_load_si128((const __m128i*) params->sse2.output_max);
+    const __m128i voutput_min = _mm_load_si128((const __m128i*) params->sse2.output_min);
+    __m128i vout01 = _mm_packus_epi16(vacc0x01234567, vacc1x01234567);
+    __m128i vout23 = _mm_packus_epi16(vacc2x01234567, vacc3x01234567);
+    vout01 = _mm_max_epu8(_mm_min_epu8(vout01, voutput_max), voutput_min);
+    vout23 = _mm_max_epu8(_mm_min_epu8(vout23, voutput_max), voutput_min);
+
+    if (nc >= 8) {
+      _mm_storel_epi64((__m128i*) c0, vout01);
+      _mm_storel_epi64((__m128i*) c1, _mm_unpackhi_epi64(vout01, vout01));
+      _mm_storel_epi64((__m128i*) c2, vout23);
+      _mm_storel_epi64((__m128i*) c3, _mm_unpackhi_epi64(vout23, vout23));
+
+      a0 = (const uint8_t*) ((uintptr_t) a0 - kc);
+      a1 = (const uint8_t*) ((uintptr_t) a1 - kc);
+      a2 = (const uint8_t*) ((uintptr_t) a2 - kc);
+      a3 = (const uint8_t*) ((uintptr_t) a3 - kc);
+
+      c0 = (uint8_t*) ((uintptr_t) c0 + cn_stride);
+      c1 = (uint8_t*) ((uintptr_t) c1 + cn_stride);
+      c2 = (uint8_t*) ((uintptr_t) c2 + cn_stride);
+      c3 = (uint8_t*) ((uintptr_t) c3 + cn_stride);
+
+      nc -= 8;
+    } else {
+      if (nc & 4) {
+        *((uint32_t*) c0) = (uint32_t) _mm_cvtsi128_si32(vout01);
+        c0 += 4;
+        *((uint32_t*) c1) = (uint32_t) _mm_extract_epi32(vout01, 2);
+        c1 += 4;
+        *((uint32_t*) c2) = (uint32_t) _mm_cvtsi128_si32(vout23);
+        c2 += 4;
+        *((uint32_t*) c3) = (uint32_t) _mm_extract_epi32(vout23, 2);
+        c3 += 4;
+        vout01 = _mm_srli_epi64(vout01, 32);
+        vout23 = _mm_srli_epi64(vout23, 32);
+      }
+      if (nc & 2) {
+        *((uint16_t*) c0) = (uint16_t) _mm_extract_epi16(vout01, 0);
+        c0 += 2;
+        *((uint16_t*) c1) = (uint16_t) _mm_extract_epi16(vout01, 4);
+        c1 += 2;
+        *((uint16_t*) c2) = (uint16_t) _mm_extract_epi16(vout23, 0);
+        c2 += 2;
+        *((uint16_t*) c3) = (uint16_t) _mm_extract_epi16(vout23, 4);
+        c3 += 2;
+        vout01 = _mm_srli_epi64(vout01, 16);
+        vout23 = _mm_srli_epi64(vout23, 16);
+      }
+      if (nc & 1) {
+        *c0 = (uint8_t) _mm_extract_epi8(vout01, 0);
+        *c1 = (uint8_t) _mm_extract_epi8(vout01, 8);
+        *c2 = (uint8_t) _mm_extract_epi8(vout23, 0);
+        *c3 = (uint8_t) _mm_extract_epi8(vout23, 8);
+      }
+
+      nc = 0;
+    }
+  } while (nc != 0);
+}
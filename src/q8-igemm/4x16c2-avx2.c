@@ -0,0 +1,427 @@
+// Auto-generated file. Do not edit!
+//   Template: src/q8-igemm/MRx16c2-avx2.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/igemm.h>
+
+
+void xnn_q8_igemm_ukernel_4x16c2__avx2(
+    size_t mr,
+    size_t nc,
+    size_t kc,
+    size_t ks,
+    const uint8_t** restrict a,
+    const void* restrict w,
+    uint8_t* restrict c,
+    size_t cm_stride,
+    size_t cn_stride,
+    size_t a_offset,
+    const uint8_t* zero,
+    const union xnn_q8_gemm_params params[restrict static 1])
+{
+  assert(mr != 0);
+  assert(mr <= 4);
+  assert(nc != 0);
+  assert(kc != 0);
+  assert(ks != 0);
+  assert(ks % (4 * sizeof(void*)) == 0);
+
+  uint8_t* c0 = c;
+  uint8_t* c1 = (uint8_t*) ((uintptr_t) c0 + cm_stride);
+  if XNN_UNPREDICTABLE(mr < 2) {
+    c1 = c0;
+  }
+  uint8_t* c2 = (uint8_t*) ((uintptr_t) c1 + cm_stride);
+  if XNN_UNPREDICTABLE(mr <= 2) {
+    c2 = c1;
+  }
+  uint8_t* c3 = (uint8_t*) ((uintptr_t) c2 + cm_stride);
+  if XNN_UNPREDICTABLE(mr != 4) {
+    c3 = c2;
+  }
+
+  const __m256i vb_zero_point = _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*) params->sse2.kernel_zero_point));
+
+  do {
+    __m256i vacc0x01234567 = _mm256_loadu_si256((const __m256i*) w);
+    __m256i vacc0x89ABCDEF = _mm256_loadu_si256((const __m256i*) ((uintptr_t) w + 32));
+    __m256i vacc1x01234567 = vacc0x01234567;
+    __m256i vacc1x89ABCDEF = vacc0x89ABCDEF;
+    __m256i vacc2x01234567 = vacc0x01234567;
+    __m256i vacc2x89ABCDEF = vacc0x89ABCDEF;
+    __m256i vacc3x01234567 = vacc0x01234567;
+    __m256i vacc3x89ABCDEF = vacc0x89ABCDEF;
+    w = (const void*) ((uintptr_t) w + 64);
+
+    size_t p = ks;
+    do {
+      const uint8_t* restrict a0 = a[0];
+      if XNN_UNPREDICTABLE(a0 != zero) {
+        a0 = (const uint8_t*) ((uintptr_t) a0 + a_offset);
+      }
+      const uint8_t* restrict a1 = a[1];
+      if XNN_UNPREDICTABLE(a1 != zero) {
+        a1 = (const uint8_t*) ((uintptr_t) a1 + a_offset);
+      }
+      const uint8_t* restrict a2 = a[2];
+      if XNN_UNPREDICTABLE(a2 != zero) {
+        a2 = (const uint8_t*) ((uintptr_t) a2 + a_offset);
+      }
+      const uint8_t* restrict a3 = a[3];
+      if XNN_UNPREDICTABLE(a3 != zero) {
+        a3 = (const uint8_t*) ((uintptr_t) a3 + a_offset);
+      }
+      a += 4;
+
+      size_t k = kc;
+      while (k >= 8 * sizeof(uint8_t)) {
+        const __m256i vxa0 = _mm256_broadcastsi128_si256(_mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i*) a0)));
+        a0 += 8;
+        const __m256i vxa1 = _mm256_broadcastsi128_si256(_mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i*) a1)));
+        a1 += 8;
+        const __m256i vxa2 = _mm256_broadcastsi128_si256(_mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i*) a2)));
+        a2 += 8;
+        const __m256i vxa3 = _mm256_broadcastsi128_si256(_mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i*) a3)));
+        a3 += 8;
+
+        const __m256i vxb0x01234567 = _mm256_sub_epi16(_mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*) w)), vb_zero_point);
+        const __m256i vxb0x89ABCDEF = _mm256_sub_epi16(_mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*) ((uintptr_t) w + 16))), vb_zero_point);
+
+        const __m256i vxa0c0 = _mm256_shuffle_epi32(vxa0, _MM_SHUFFLE(0, 0, 0, 0));
+        vacc0x01234567 = _mm256_add_epi32(vacc0x01234567, _mm256_madd_epi16(vxa0c0, vxb0x01234567));
+        vacc0x89ABCDEF = _mm256_add_epi32(vacc0x89ABCDEF, _mm256_madd_epi16(vxa0c0, vxb0x89ABCDEF));
+        const __m256i vxa1c0 = _mm256_shuffle_epi32(vxa1, _MM_SHUFFLE(0, 0, 0, 0));
+        vacc1x01234567 = _mm256_add_epi32(vacc1x01234567, _mm256_madd_epi16(vxa1c0, vxb0x01234567));
+        vacc1x89ABCDEF = _mm256_add_epi32(vacc1x89ABCDEF, _mm256_madd_epi16(vxa1c0, vxb0x89ABCDEF));
+        const __m256i vxa2c0 = _mm256_shuffle_epi32(vxa2, _MM_SHUFFLE(0, 0, 0, 0));
+        vacc2x01234567 = _mm256_add_epi32(vacc2x01234567, _mm256_madd_epi16(vxa2c0, vxb0x01234567));
+        vacc2x89ABCDEF = _mm256_add_epi32(vacc2x89ABCDEF, _mm256_madd_epi16(vxa2c0, vxb0x89ABCDEF));
+        const __m256i vxa3c0 = _mm256_shuffle_epi32(vxa3, _MM_SHUFFLE(0, 0, 0, 0));
+        vacc3x01234567 = _mm256_add_epi32(vacc3x01234567, _mm256_madd_epi16(vxa3c0, vxb0x01234567));
+        vacc3x89ABCDEF = _mm256_add_epi32(vacc3x89ABCDEF, _mm256_madd_epi16(vxa3c0, vxb0x89ABCDEF));
+
+        const __m256i vxb1x01234567 = _mm256_sub_epi16(_mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*) ((uintptr_t) w + 32))), vb_zero_point);
+        const __m256i vxb1x89ABCDEF = _mm256_sub_epi16(_mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*) ((uintptr_t) w + 48))), vb_zero_point);
+
+        const __m256i vxa0c1 = _mm256_shuffle_epi32(vxa0, _MM_SHUFFLE(1, 1, 1, 1));
+        vacc0x01234567 = _mm256_add_epi32(vacc0x01234567, _mm256_madd_epi16(vxa0c1, vxb1x01234567));
+        vacc0x89ABCDEF = _mm256_add_epi32(vacc0x89ABCDEF, _mm256_madd_epi16(vxa0c1, vxb1x89ABCDEF));
+        const __m256i vxa1c1 = _mm256_shuffle_epi32(vxa1, _MM_SHUFFLE(1, 1, 1, 1));
+        vacc1x01234567 = _mm256_add_epi32(vacc1x01234567, _mm256_madd_epi16(vxa1c1, vxb1x01234567));
+        vacc1x89ABCDEF = _mm256_add_epi32(vacc1x89ABCDEF, _mm256_madd_epi16(vxa1c1, vxb1x89ABCDEF));
+        const __m256i vxa2c1 = _mm256_shuffle_epi32(vxa2, _MM_SHUFFLE(1, 1, 1, 1));
+        vacc2x01234567 = _mm256_add_epi32(vacc2x01234567, _mm256_madd_epi16(vxa2c1, vxb1x01234567));
+        vacc2x89ABCDEF = _mm256_add_epi32(vacc2x89ABCDEF, _mm256_madd_epi16(vxa2c1, vxb1x89ABCDEF));
+        const __m256i vxa3c1 = _mm256_shuffle_epi32(vxa3, _MM_SHUFFLE(1, 1, 1, 1));
+        vacc3x01234567 = _mm256_add_epi32(vacc3x01234567, _mm256_madd_epi16(vxa3c1, vxb1x01234567));
+        vacc3x89ABCDEF = _mm256_add_epi32(vacc3x89ABCDEF, _mm256_madd_epi16(vxa3c1, vxb1x89ABCDEF));
+
+        const __m256i vxb2x01234567 = _mm256_sub_epi16(_mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*) ((uintptr_t) w + 64))), vb_zero_point);
+        const __m256i vxb2x89ABCDEF = _mm256_sub_epi16(_mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*) ((uintptr_t) w + 80))), vb_zero_point);
+
+        const __m256i vxa0c2 = _mm256_shuffle_epi32(vxa0, _MM_SHUFFLE(2, 2, 2, 2));
+        vacc0x01234567 = _mm256_add_epi32(vacc0x01234567, _mm256_madd_epi16(vxa0c2, vxb2x01234567));
+        vacc0x89ABCDEF = _mm256_add_epi32(vacc0x89ABCDEF, _mm256_madd_epi16(vxa0c2, vxb2x89ABCDEF));
+        const __m256i vxa1c2 = _mm256_shuffle_epi32(vxa1, _MM_SHUFFLE(2, 2, 2, 2));
+        vacc1x01234567 = _mm256_add_epi32(vacc1x01234567, _mm256_madd_epi16(vxa1c2, vxb2x01234567));
+        vacc1x89ABCDEF = _mm256_add_epi32(vacc1x89ABCDEF, _mm256_madd_epi16(vxa1c2, vxb2x89ABCDEF));
+        const __m256i vxa2c2 = _mm256_shuffle_epi32(vxa2, _MM_SHUFFLE(2, 2, 2, 2));
+        vacc2x01234567 = _mm256_add_epi32(vacc2x01234567, _mm256_madd_epi16(vxa2c2, vxb2x01234567));
+        vacc2x89ABCDEF = _mm256_add_epi32(vacc2x89ABCDEF, _mm256_madd_epi16(vxa2c2, vxb2x89ABCDEF));
+        const __m256i vxa3c2 = _mm256_shuffle_epi32(vxa3, _MM_SHUFFLE(2, 2, 2, 2));
+        vacc3x01234567 = _mm256_add_epi32(vacc3x01234567, _mm256_madd_epi16(vxa3c2, vxb2x01234567));
+        vacc3x89ABCDEF = _mm256_add_epi32(vacc3x89ABCDEF, _mm256_madd_epi16(vxa3c2, vxb2x89ABCDEF));
+
+        const __m256i vxb3x01234567 = _mm256_sub_epi16(_mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*) ((uintptr_t) w + 96))), vb_zero_point);
+        const __m256i vxb3x89ABCDEF = _mm256_sub_epi16(_mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*) ((uintptr_t) w + 112))), vb_zero_point);
+
+        const __m256i vxa0c3 = _mm256_shuffle_epi32(vxa0, _MM_SHUFFLE(3, 3, 3, 3));
+        vacc0x01234567 = _mm256_add_epi32(vacc0x01234567, _mm256_madd_epi16(vxa0c3, vxb3x01234567));
+        vacc0x89ABCDEF = _mm256_add_epi32(vacc0x89ABCDEF, _mm256_madd_epi16(vxa0c3, vxb3x89ABCDEF));
+        const __m256i vxa1c3 = _mm256_shuffle_epi32(vxa1, _MM_SHUFFLE(3, 3, 3, 3));
+        vacc1x01234567 = _mm256_add_epi32(vacc1x01234567, _mm256_madd_epi16(vxa1c3, vxb3x01234567));
+        vacc1x89ABCDEF = _mm256_add_epi32(vacc1x89ABCDEF, _mm256_madd_epi16(vxa1c3, vxb3x89ABCDEF));
+        const __m256i vxa2c3 = _mm256_shuffle_epi32(vxa2, _MM_SHUFFLE(3, 3, 3, 3));
+        vacc2x01234567 = _mm256_add_epi32(vacc2x01234567, _mm256_madd_epi16(vxa2c3, vxb3x01234567));
+        vacc2x89ABCDEF = _mm256_add_epi32(vacc2x89ABCDEF, _mm256_madd_epi16(vxa2c3, vxb3x89ABCDEF));
+        const __m256i vxa3c3 = _mm256_shuffle_epi32(vxa3, _MM_SHUFFLE(3, 3, 3, 3));
+        vacc3x01234567 = _mm256_add_epi32(vacc3x01234567, _mm256_madd_epi16(vxa3c3, vxb3x01234567));
+        vacc3x89ABCDEF = _mm256_add_epi32(vacc3x89ABCDEF, _mm256_madd_epi16(vxa3c3, vxb3x89ABCDEF));
+
+        w = (const void*) ((uintptr_t) w + 128);
+        k -= 8 * sizeof(uint8_t);
+      }
+      if (k != 0) {
+        const __m256i vxa0 = _mm256_broadcastsi128_si256(_mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i*) a0)));
+        const __m256i vxa1 = _mm256_broadcastsi128_si256(_mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i*) a1)));
+        const __m256i vxa2 = _mm256_broadcastsi128_si256(_mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i*) a2)));
+        const __m256i vxa3 = _mm256_broadcastsi128_si256(_mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i*) a3)));
+  
+        const __m256i vxb0x01234567 = _mm256_sub_epi16(_mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*) w)), vb_zero_point);
+        const __m256i vxb0x89ABCDEF = _mm256_sub_epi16(_mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*) ((uintptr_t) w + 16))), vb_zero_point);
+        w = (const void*) ((uintptr_t) w + 32);
+
+        const __m256i vxa0c0 = _mm256_shuffle_epi32(vxa0, _MM_SHUFFLE(0, 0, 0, 0));
+        vacc0x01234567 = _mm256_add_epi32(vacc0x01234567, _mm256_madd_epi16(vxa0c0, vxb0x01234567));
+        vacc0x89ABCDEF = _mm256_add_epi32(vacc0x89ABCDEF, _mm256_madd_epi16(vxa0c0, vxb0x89ABCDEF));
+        const __m256i vxa1c0 = _mm256_shuffle_epi32(vxa1, _MM_SHUFFLE(0, 0, 0, 0));
+        vacc1x01234567 = _mm256_add_epi32(vacc1x01234567, _mm256_madd_epi16(vxa1c0, vxb0x01234567));
+        vacc1x89ABCDEF = _mm256_add_epi32(vacc1x89ABCDEF, _mm256_madd_epi16(vxa1c0, vxb0x89ABCDEF));
+        const __m256i vxa2c0 = _mm256_shuffle_epi32(vxa2, _MM_SHUFFLE(0, 0, 0, 0));
+        vacc2x01234567 = _mm256_add_epi32(vacc2x01234567, _mm256_madd_epi16(vxa2c0, vxb0x01234567));
+        vacc2x89ABCDEF = _mm256_add_epi32(vacc2x89ABCDEF, _mm256_madd_epi16(vxa2c0, vxb0x89ABCDEF));
+        const __m256i vxa3c0 = _mm256_shuffle_epi32(vxa3, _MM_SHUFFLE(0, 0, 0, 0));
+        vacc3x01234567 = _mm256_add_epi32(vacc3x01234567, _mm256_madd_epi16(vxa3c0, vxb0x01234567));
+        vacc3x89ABCDEF = _mm256_add_epi32(vacc3x89ABCDEF, _mm256_madd_epi16(vxa3c0, vxb0x89ABCDEF));
+
+        if (k > 2 * sizeof(uint8_t)) {
+          const __m256i vxb1x01234567 = _mm256_sub_epi16(_mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*) w)), vb_zero_point);
+          const __m256i vxb1x89ABCDEF = _mm256_sub_epi16(_mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*) ((uintptr_t) w + 16))), vb_zero_point);
+          w = (const void*) ((uintptr_t) w + 32);
+
+          const __m256i vxa0c1 = _mm256_shuffle_epi32(vxa0, _MM_SHUFFLE(1, 1, 1, 1));
+          vacc0x01234567 = _mm256_add_epi32(vacc0x01234567, _mm256_madd_epi16(vxa0c1, vxb1x01234567));
+          vacc0x89ABCDEF = _mm256_add_epi32(vacc0x89ABCDEF, _mm256_madd_epi16(vxa0c1, vxb1x89ABCDEF));
+          const __m256i vxa1c1 = _mm256_shuffle_epi32(vxa1, _MM_SHUFFLE(1, 1, 1, 1));
+          vacc1x01234567 = _mm256_add_epi32(vacc1x01234567, _mm256_madd_epi16(vxa1c1, vxb1x01234567));
+          vacc1x89ABCDEF = _mm256_add_epi32(vacc1x89ABCDEF, _mm256_madd_epi16(vxa1c1, vxb1x89ABCDEF));
+          const __m256i vxa2c1 = _mm256_shuffle_epi32(vxa2, _MM_SHUFFLE(1, 1, 1, 1));
+          vacc2x01234567 = _mm256_add_epi32(vacc2x01234567, _mm256_madd_epi16(vxa2c1, vxb1x01234567));
+          vacc2x89ABCDEF = _mm256_add_epi32(vacc2x89ABCDEF, _mm256_madd_epi16(vxa2c1, vxb1x89ABCDEF));
+          const __m256i vxa3c1 = _mm256_shuffle_epi32(vxa3, _MM_SHUFFLE(1, 1, 1, 1));
+          vacc3x01234567 = _mm256_add_epi32(vacc3x01234567, _mm256_madd_epi16(vxa3c1, vxb1x01234567));
+          vacc3x89ABCDEF = _mm256_add_epi32(vacc3x89ABCDEF, _mm256_madd_epi16(vxa3c1, vxb1x89ABCDEF));
+        }
+
+        if (k > 4 * sizeof(uint8_t)) {
+          const __m256i vxb2x01234567 = _mm256_sub_epi16(_mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*) w)), vb_zero_point);
+          const __m256i vxb2x89ABCDEF = _mm256_sub_epi16(_mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*) ((uintptr_t) w + 16))), vb_zero_point);
+          w = (const void*) ((uintptr_t) w + 32);
+
+          const __m256i vxa0c2 = _mm256_shuffle_epi32(vxa0, _MM_SHUFFLE(2, 2, 2, 2));
+          vacc0x01234567 = _mm256_add_epi32(vacc0x01234567, _mm256_madd_epi16(vxa0c2, vxb2x01234567));
+          vacc0x89ABCDEF = _mm256_add_epi32(vacc0x89ABCDEF, _mm256_madd_epi16(vxa0c2, vxb2x89ABCDEF));
+          const __m256i vxa1c2 = _mm256_shuffle_epi32(vxa1, _MM_SHUFFLE(2, 2, 2, 2));
+          vacc1x01234567 = _mm256_add_epi32(vacc1x01234567, _mm256_madd_epi16(vxa1c2, vxb2x01234567));
+          vacc1x89ABCDEF = _mm256_add_epi32(vacc1x89ABCDEF, _mm256_madd_epi16(vxa1c2, vxb2x89ABCDEF));
+          const __m256i vxa2c2 = _mm256_shuffle_epi32(vxa2, _MM_SHUFFLE(2, 2, 2, 2));
+          vacc2x01234567 = _mm256_add_epi32(vacc2x01234567, _mm256_madd_epi16(vxa2c2, vxb2x01234567));
+          vacc2x89ABCDEF = _mm256_add_epi32(vacc2x89ABCDEF, _mm256_madd_epi16(vxa2c2, vxb2x89ABCDEF));
+          const __m256i vxa3c2 = _mm256_shuffle_epi32(vxa3, _MM_SHUFFLE(2, 2, 2, 2));
+          vacc3x01234567 = _mm256_add_epi32(vacc3x01234567, _mm256_madd_epi16(vxa3c2, vxb2x01234567));
+          vacc3x89ABCDEF = _mm256_add_epi32(vacc3x89ABCDEF, _mm256_madd_epi16(vxa3c2, vxb2x89ABCDEF));
+        }
+
+        if (k > 6 * sizeof(uint8_t)) {
+          const __m256i vxb3x01234567 = _mm256_sub_epi16(_mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*) w)), vb_zero_point);
+          const __m256i vxb3x89ABCDEF = _mm256_sub_epi16(_mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*) ((uintptr_t) w + 16))), vb_zero_point);
+          w = (const void*) ((uintptr_t) w + 32);
+
+          const __m256i vxa0c3 = _mm256_shuffle_epi32(vxa0, _MM_SHUFFLE(3, 3, 3, 3));
+          vacc0x01234567 = _mm256_add_epi32(vacc0x01234567, _mm256_madd_epi16(vxa0c3, vxb3x01234567));
+          vacc0x89ABCDEF = _mm256_add_epi32(vacc0x89ABCDEF, _mm256_madd_epi16(vxa0c3, vxb3x89ABCDEF));
+          const __m256i vxa1c3 = _mm256_shuffle_epi32(vxa1, _MM_SHUFFLE(3, 3, 3, 3));
+          vacc1x01234567 = _mm256_add_epi32(vacc1x01234567, _mm256_madd_epi16(vxa1c3, vxb3x01234567));
+          vacc1x89ABCDEF = _mm256_add_epi32(vacc1x89ABCDEF, _mm256_madd_epi16(vxa1c3, vxb3x89ABCDEF));
+          const __m256i vxa2c3 = _mm256_shuffle_epi32(vxa2, _MM_SHUFFLE(3, 3, 3, 3));
+          vacc2x01234567 = _mm256_add_epi32(vacc2x01234567, _mm256_madd_epi16(vxa2c3, vxb3x01234567));
+          vacc2x89ABCDEF = _mm256_add_epi32(vacc2x89ABCDEF, _mm256_madd_epi16(vxa2c3, vxb3x89ABCDEF));
+          const __m256i vxa3c3 = _mm256_shuffle_epi32(vxa3, _MM_SHUFFLE(3, 3, 3, 3));
+          vacc3x01234567 = _mm256_add_epi32(vacc3x01234567, _mm256_madd_epi16(vxa3c3, vxb3x01234567));
+          vacc3x89ABCDEF = _mm256_add_epi32(vacc3x89ABCDEF, _mm256_madd_epi16(vxa3c3, vxb3x89ABCDEF));
+        }
+      }
+      p -= 4 * sizeof(void*);
+    } while (p != 0);
+
+    // Q31 fixed-point multiplication with signed 32x32->64-bit products of the even and odd lanes.
+    const __m256i vmultiplier = _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*) params->sse2.multiplier));
+    const __m256i vrounding = _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*) params->sse2.rounding));
+
+    const __m256i vacc0x11335577 = _mm256_shuffle_epi32(vacc0x01234567, _MM_SHUFFLE(3, 3, 1, 1));
+    const __m256i vacc0x99BBDDFF = _mm256_shuffle_epi32(vacc0x89ABCDEF, _MM_SHUFFLE(3, 3, 1, 1));
+    const __m256i vacc1x11335577 = _mm256_shuffle_epi32(vacc1x01234567, _MM_SHUFFLE(3, 3, 1, 1));
+    const __m256i vacc1x99BBDDFF = _mm256_shuffle_epi32(vacc1x89ABCDEF, _MM_SHUFFLE(3, 3, 1, 1));
+    const __m256i vacc2x11335577 = _mm256_shuffle_epi32(vacc2x01234567, _MM_SHUFFLE(3, 3, 1, 1));
+    const __m256i vacc2x99BBDDFF = _mm256_shuffle_epi32(vacc2x89ABCDEF, _MM_SHUFFLE(3, 3, 1, 1));
+    const __m256i vacc3x11335577 = _mm256_shuffle_epi32(vacc3x01234567, _MM_SHUFFLE(3, 3, 1, 1));
+    const __m256i vacc3x99BBDDFF = _mm256_shuffle_epi32(vacc3x89ABCDEF, _MM_SHUFFLE(3, 3, 1, 1));
+
+    const __m256i vprod0x0246 = _mm256_add_epi64(_mm256_mul_epi32(vacc0x01234567, vmultiplier), vrounding);
+    const __m256i vprod0x1357 = _mm256_add_epi64(_mm256_mul_epi32(vacc0x11335577, vmultiplier), vrounding);
+    const __m256i vprod0x8ACE = _mm256_add_epi64(_mm256_mul_epi32(vacc0x89ABCDEF, vmultiplier), vrounding);
+    const __m256i vprod0x9BDF = _mm256_add_epi64(_mm256_mul_epi32(vacc0x99BBDDFF, vmultiplier), vrounding);
+    const __m256i vprod1x0246 = _mm256_add_epi64(_mm256_mul_epi32(vacc1x01234567, vmultiplier), vrounding);
+    const __m256i vprod1x1357 = _mm256_add_epi64(_mm256_mul_epi32(vacc1x11335577, vmultiplier), vrounding);
+    const __m256i vprod1x8ACE = _mm256_add_epi64(_mm256_mul_epi32(vacc1x89ABCDEF, vmultiplier), vrounding);
+    const __m256i vprod1x9BDF = _mm256_add_epi64(_mm256_mul_epi32(vacc1x99BBDDFF, vmultiplier), vrounding);
+    const __m256i vprod2x0246 = _mm256_add_epi64(_mm256_mul_epi32(vacc2x01234567, vmultiplier), vrounding);
+    const __m256i vprod2x1357 = _mm256_add_epi64(_mm256_mul_epi32(vacc2x11335577, vmultiplier), vrounding);
+    const __m256i vprod2x8ACE = _mm256_add_epi64(_mm256_mul_epi32(vacc2x89ABCDEF, vmultiplier), vrounding);
+    const __m256i vprod2x9BDF = _mm256_add_epi64(_mm256_mul_epi32(vacc2x99BBDDFF, vmultiplier), vrounding);
+    const __m256i vprod3x0246 = _mm256_add_epi64(_mm256_mul_epi32(vacc3x01234567, vmultiplier), vrounding);
+    const __m256i vprod3x1357 = _mm256_add_epi64(_mm256_mul_epi32(vacc3x11335577, vmultiplier), vrounding);
+    const __m256i vprod3x8ACE = _mm256_add_epi64(_mm256_mul_epi32(vacc3x89ABCDEF, vmultiplier), vrounding);
+    const __m256i vprod3x9BDF = _mm256_add_epi64(_mm256_mul_epi32(vacc3x99BBDDFF, vmultiplier), vrounding);
+
+    const __m256i vq31prod0x0246 = _mm256_srli_epi64(vprod0x0246, 31);
+    const __m256i vq31prod0x1357 = _mm256_add_epi64(vprod0x1357, vprod0x1357);
+    const __m256i vq31prod0x8ACE = _mm256_srli_epi64(vprod0x8ACE, 31);
+    const __m256i vq31prod0x9BDF = _mm256_add_epi64(vprod0x9BDF, vprod0x9BDF);
+    const __m256i vq31prod1x0246 = _mm256_srli_epi64(vprod1x0246, 31);
+    const __m256i vq31prod1x1357 = _mm256_add_epi64(vprod1x1357, vprod1x1357);
+    const __m256i vq31prod1x8ACE = _mm256_srli_epi64(vprod1x8ACE, 31);
+    const __m256i vq31prod1x9BDF = _mm256_add_epi64(vprod1x9BDF, vprod1x9BDF);
+    const __m256i vq31prod2x0246 = _mm256_srli_epi64(vprod2x0246, 31);
+    const __m256i vq31prod2x1357 = _mm256_add_epi64(vprod2x1357, vprod2x1357);
+    const __m256i vq31prod2x8ACE = _mm256_srli_epi64(vprod2x8ACE, 31);
+    const __m256i vq31prod2x9BDF = _mm256_add_epi64(vprod2x9BDF, vprod2x9BDF);
+    const __m256i vq31prod3x0246 = _mm256_srli_epi64(vprod3x0246, 31);
+    const __m256i vq31prod3x1357 = _mm256_add_epi64(vprod3x1357, vprod3x1357);
+    const __m256i vq31prod3x8ACE = _mm256_srli_epi64(vprod3x8ACE, 31);
+    const __m256i vq31prod3x9BDF = _mm256_add_epi64(vprod3x9BDF, vprod3x9BDF);
+
+    const __m256i vq31prod0x01234567 = _mm256_blend_epi16(vq31prod0x0246, vq31prod0x1357, 0xCC);
+    const __m256i vq31prod0x89ABCDEF = _mm256_blend_epi16(vq31prod0x8ACE, vq31prod0x9BDF, 0xCC);
+    const __m256i vq31prod1x01234567 = _mm256_blend_epi16(vq31prod1x0246, vq31prod1x1357, 0xCC);
+    const __m256i vq31prod1x89ABCDEF = _mm256_blend_epi16(vq31prod1x8ACE, vq31prod1x9BDF, 0xCC);
+    const __m256i vq31prod2x01234567 = _mm256_blend_epi16(vq31prod2x0246, vq31prod2x1357, 0xCC);
+    const __m256i vq31prod2x89ABCDEF = _mm256_blend_epi16(vq31prod2x8ACE, vq31prod2x9BDF, 0xCC);
+    const __m256i vq31prod3x01234567 = _mm256_blend_epi16(vq31prod3x0246, vq31prod3x1357, 0xCC);
+    const __m256i vq31prod3x89ABCDEF = _mm256_blend_epi16(vq31prod3x8ACE, vq31prod3x9BDF, 0xCC);
+
+    const __m256i vremainder_mask = _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*) params->sse2.remainder_mask));
+    const __m256i vrem0x01234567 =
+      _mm256_add_epi32(_mm256_and_si256(vq31prod0x01234567, vremainder_mask), _mm256_cmpgt_epi32(_mm256_setzero_si256(), vq31prod0x01234567));
+    const __m256i vrem0x89ABCDEF =
+      _mm256_add_epi32(_mm256_and_si256(vq31prod0x89ABCDEF, vremainder_mask), _mm256_cmpgt_epi32(_mm256_setzero_si256(), vq31prod0x89ABCDEF));
+    const __m256i vrem1x01234567 =
+      _mm256_add_epi32(_mm256_and_si256(vq31prod1x01234567, vremainder_mask), _mm256_cmpgt_epi32(_mm256_setzero_si256(), vq31prod1x01234567));
+    const __m256i vrem1x89ABCDEF =
+      _mm256_add_epi32(_mm256_and_si256(vq31prod1x89ABCDEF, vremainder_mask), _mm256_cmpgt_epi32(_mm256_setzero_si256(), vq31prod1x89ABCDEF));
+    const __m256i vrem2x01234567 =
+      _mm256_add_epi32(_mm256_and_si256(vq31prod2x01234567, vremainder_mask), _mm256_cmpgt_epi32(_mm256_setzero_si256(), vq31prod2x01234567));
+    const __m256i vrem2x89ABCDEF =
+      _mm256_add_epi32(_mm256_and_si256(vq31prod2x89ABCDEF, vremainder_mask), _mm256_cmpgt_epi32(_mm256_setzero_si256(), vq31prod2x89ABCDEF));
+    const __m256i vrem3x01234567 =
+      _mm256_add_epi32(_mm256_and_si256(vq31prod3x01234567, vremainder_mask), _mm256_cmpgt_epi32(_mm256_setzero_si256(), vq31prod3x01234567));
+    const __m256i vrem3x89ABCDEF =
+      _mm256_add_epi32(_mm256_and_si256(vq31prod3x89ABCDEF, vremainder_mask), _mm256_cmpgt_epi32(_mm256_setzero_si256(), vq31prod3x89ABCDEF));
+
+    const __m256i vremainder_threshold = _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*) params->sse2.remainder_threshold));
+    const __m128i vshift = _mm_load_si128((const __m128i*) params->sse2.shift);
+    vacc0x01234567 =
+      _mm256_sub_epi32(_mm256_sra_epi32(vq31prod0x01234567, vshift), _mm256_cmpgt_epi32(vrem0x01234567, vremainder_threshold));
+    vacc0x89ABCDEF =
+      _mm256_sub_epi32(_mm256_sra_epi32(vq31prod0x89ABCDEF, vshift), _mm256_cmpgt_epi32(vrem0x89ABCDEF, vremainder_threshold));
+    vacc1x01234567 =
+      _mm256_sub_epi32(_mm256_sra_epi32(vq31prod1x01234567, vshift), _mm256_cmpgt_epi32(vrem1x01234567, vremainder_threshold));
+    vacc1x89ABCDEF =
+      _mm256_sub_epi32(_mm256_sra_epi32(vq31prod1x89ABCDEF, vshift), _mm256_cmpgt_epi32(vrem1x89ABCDEF, vremainder_threshold));
+    vacc2x01234567 =
+      _mm256_sub_epi32(_mm256_sra_epi32(vq31prod2x01234567, vshift), _mm256_cmpgt_epi32(vrem2x01234567, vremainder_threshold));
+    vacc2x89ABCDEF =
+      _mm256_sub_epi32(_mm256_sra_epi32(vq31prod2x89ABCDEF, vshift), _mm256_cmpgt_epi32(vrem2x89ABCDEF, vremainder_threshold));
+    vacc3x01234567 =
+      _mm256_sub_epi32(_mm256_sra_epi32(vq31prod3x01234567, vshift), _mm256_cmpgt_epi32(vrem3x01234567, vremainder_threshold));
+    vacc3x89ABCDEF =
+      _mm256_sub_epi32(_mm256_sra_epi32(vq31prod3x89ABCDEF, vshift), _mm256_cmpgt_epi32(vrem3x89ABCDEF, vremainder_threshold));
+
+    const __m256i voutput_zero_point = _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*) params->sse2.output_zero_point));
+    const __m256i vacc0x012389AB4567CDEF = _mm256_adds_epi16(_mm256_packs_epi32(vacc0x01234567, vacc0x89ABCDEF), voutput_zero_point);
+    const __m256i vacc1x012389AB4567CDEF = _mm256_adds_epi16(_mm256_packs_epi32(vacc1x01234567, vacc1x89ABCDEF), voutput_zero_point);
+    const __m256i vacc2x012389AB4567CDEF = _mm256_adds_epi16(_mm256_packs_epi32(vacc2x01234567, vacc2x89ABCDEF), voutput_zero_point);
+    const __m256i vacc3x012389AB4567CDEF = _mm256_adds_epi16(_mm256_packs_epi32(vacc3x01234567, vacc3x89ABCDEF), voutput_zero_point);
+
+    // Restore the column order broken up by the in-lane 256-bit packing instructions.
+    const __m256i vpermute_mask = _mm256_set_epi32(7, 3, 6, 2, 5, 1, 4, 0);
+    const __m256i voutput_max = _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*) params->sse2.output_max));
+    const __m256i voutput_min = _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*) params->sse2.output_min));
+    __m256i vout01 = _mm256_permutevar8x32_epi32(
+      _mm256_packus_epi16(vacc0x012389AB4567CDEF, vacc1x012389AB4567CDEF), vpermute_mask);
+    vout01 = _mm256_max_epu8(_mm256_min_epu8(vout01, voutput_max), voutput_min);
+    __m256i vout23 = _mm256_permutevar8x32_epi32(
+      _mm256_packus_epi16(vacc2x012389AB4567CDEF, vacc3x012389AB4567CDEF), vpermute_mask);
+    vout23 = _mm256_max_epu8(_mm256_min_epu8(vout23, voutput_max), voutput_min);
+
+    __m128i vout0 = _mm256_castsi256_si128(vout01);
+    __m128i vout1 = _mm256_extracti128_si256(vout01, 1);
+    __m128i vout2 = _mm256_castsi256_si128(vout23);
+    __m128i vout3 = _mm256_extracti128_si256(vout23, 1);
+
+    if XNN_LIKELY(nc >= 16) {
+      _mm_storeu_si128((__m128i*) c3, vout3);
+      c3 = (uint8_t*) ((uintptr_t) c3 + cn_stride);
+      _mm_storeu_si128((__m128i*) c2, vout2);
+      c2 = (uint8_t*) ((uintptr_t) c2 + cn_stride);
+      _mm_storeu_si128((__m128i*) c1, vout1);
+      c1 = (uint8_t*) ((uintptr_t) c1 + cn_stride);
+      _mm_storeu_si128((__m128i*) c0, vout0);
+      c0 = (uint8_t*) ((uintptr_t) c0 + cn_stride);
+
+      a = (const uint8_t**restrict) ((uintptr_t) a - ks);
+
+      nc -= 16;
+    } else {
+      if (nc & 8) {
+        _mm_storel_epi64((__m128i*) c3, vout3);
+        c3 += 8;
+        _mm_storel_epi64((__m128i*) c2, vout2);
+        c2 += 8;
+        _mm_storel_epi64((__m128i*) c1, vout1);
+        c1 += 8;
+        _mm_storel_epi64((__m128i*) c0, vout0);
+        c0 += 8;
+        vout3 = _mm_unpackhi_epi64(vout3, vout3);
+        vout2 = _mm_unpackhi_epi64(vout2, vout2);
+        vout1 = _mm_unpackhi_epi64(vout1, vout1);
+        vout0 = _mm_unpackhi_epi64(vout0, vout0);
+      }
+      if (nc & 4) {
+        *((uint32_t*) c3) = (uint32_t) _mm_cvtsi128_si32(vout3);
+        c3 += 4;
+        *((uint32_t*) c2) = (uint32_t) _mm_cvtsi128_si32(vout2);
+        c2 += 4;
+        *((uint32_t*) c1) = (uint32_t) _mm_cvtsi128_si32(vout1);
+        c1 += 4;
+        *((uint32_t*) c0) = (uint32_t) _mm_cvtsi128_si32(vout0);
+        c0 += 4;
+        vout3 = _mm_srli_epi64(vout3, 32);
+        vout2 = _mm_srli_epi64(vout2, 32);
+        vout1 = _mm_srli_epi64(vout1, 32);
+        vout0 = _mm_srli_epi64(vout0, 32);
+      }
+      if (nc & 2) {
+        *((uint16_t*) c3) = (uint16_t) _mm_extract_epi16(vout3, 0);
+        c3 += 2;
+        *((uint16_t*) c2) = (uint16_t) _mm_extract_epi16(vout2, 0);
+        c2 += 2;
+        *((uint16_t*) c1) = (uint16_t) _mm_extract_epi16(vout1, 0);
+        c1 += 2;
+        *((uint16_t*) c0) = (uint16_t) _mm_extract_epi16(vout0, 0);
+        c0 += 2;
+        vout3 = _mm_srli_epi32(vout3, 16);
+        vout2 = _mm_srli_epi32(vout2, 16);
+        vout1 = _mm_srli_epi32(vout1, 16);
+        vout0 = _mm_srli_epi32(vout0, 16);
+      }
+      if (nc & 1) {
+        *c3 = (uint8_t) _mm_extract_epi8(vout3, 0);
+        *c2 = (uint8_t) _mm_extract_epi8(vout2, 0);
+        *c1 = (uint8_t) _mm_extract_epi8(vout1, 0);
+        *c0 = (uint8_t) _mm_extract_epi8(vout0, 0);
+      }
+
+      nc = 0;
+    }
+  } while (nc != 0);
+}
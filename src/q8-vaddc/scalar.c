@@ -0,0 +1,52 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/scalar-utils.h>
+#include <xnnpack/vadd.h>
+
+
+void xnn_q8_vaddc_ukernel__scalar(
+    size_t n,
+    const uint8_t* a,
+    const uint8_t* b,
+    uint8_t* y,
+    const union xnn_q8_add_params params[restrict static 1])
+{
+  assert(n != 0);
+
+  const uint32_t va_multiplier = params->scalar.a_multiplier;
+  const uint32_t vshift = params->scalar.shift;
+  const int32_t vremainder_mask = params->scalar.remainder_mask;
+  const int32_t vremainder_threshold = params->scalar.remainder_threshold;
+  const int32_t vy_zero_point = params->scalar.y_zero_point;
+  const int32_t vy_max = params->scalar.y_max;
+  const int32_t vy_min = params->scalar.y_min;
+
+  // Fold the broadcasted element of b into the zero point product.
+  const int32_t vb_bias =
+    params->scalar.zero_point_product + (int32_t) ((uint32_t) *b * params->scalar.b_multiplier);
+  do {
+    const int32_t va = (int32_t) (uint32_t) *a++;
+
+    // Multiply by factor and accumulate with the bias.
+    const int32_t vacc = vb_bias + va * va_multiplier;
+
+    // Shift right and round.
+    const int32_t vremainder = (vacc & vremainder_mask) - (int32_t) (vacc < 0);
+    int32_t vy = asr_s32(vacc, vshift) + (int32_t) (vremainder > vremainder_threshold);
+
+    // Pack, saturate, and add output zero point.
+    vy += vy_zero_point;
+    vy = vy < vy_min ? vy_min : vy;
+    vy = vy > vy_max ? vy_max : vy;
+
+    *y++ = vy;
+
+    n -= sizeof(uint8_t);
+  } while (n != 0);
+}
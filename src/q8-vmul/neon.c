@@ -0,0 +1,169 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <arm_neon.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vmul.h>
+
+
+void xnn_q8_vmul_ukernel__neon(
+    size_t n,
+    const uint8_t* a,
+    const uint8_t* b,
+    uint8_t* y,
+    const union xnn_q8_gemm_params params[restrict static 1])
+{
+  const uint8x8_t va_zero_point = vld1_dup_u8((const uint8_t*) &params->neon.input_zero_point);
+  const uint8x8_t vb_zero_point = vld1_dup_u8((const uint8_t*) &params->neon.kernel_zero_point);
+  const int32x4_t vmultiplier = vld1q_dup_s32(&params->neon.multiplier);
+  const int32x4_t vright_shift = vld1q_dup_s32(&params->neon.right_shift);
+  const int32x4_t vzero_shift_mask = vreinterpretq_s32_u32(vceqq_s32(vright_shift, vmovq_n_s32(0)));
+  const int16x8_t vy_zero_point = vld1q_dup_s16(&params->neon.output_zero_point);
+  const uint8x16_t vy_max = vld1q_dup_u8(&params->neon.output_max);
+  const uint8x16_t vy_min = vld1q_dup_u8(&params->neon.output_min);
+  for (; n >= 16 * sizeof(uint8_t); n -= 16 * sizeof(uint8_t)) {
+    const uint8x16_t va01 = vld1q_u8(a); a += 16;
+    const uint8x16_t vb01 = vld1q_u8(b); b += 16;
+
+    // Subtract zero points.
+    const int16x8_t vxa0 = vreinterpretq_s16_u16(vsubl_u8(vget_low_u8(va01), va_zero_point));
+    const int16x8_t vxa1 = vreinterpretq_s16_u16(vsubl_u8(vget_high_u8(va01), va_zero_point));
+    const int16x8_t vxb0 = vreinterpretq_s16_u16(vsubl_u8(vget_low_u8(vb01), vb_zero_point));
+    const int16x8_t vxb1 = vreinterpretq_s16_u16(vsubl_u8(vget_high_u8(vb01), vb_zero_point));
+
+    // Multiply inputs into 32-bit products.
+    int32x4_t vacc0_lo = vmull_s16(vget_low_s16(vxa0), vget_low_s16(vxb0));
+    int32x4_t vacc1_lo = vmull_s16(vget_low_s16(vxa1), vget_low_s16(vxb1));
+#ifdef __aarch64__
+    int32x4_t vacc0_hi = vmull_high_s16(vxa0, vxb0);
+    int32x4_t vacc1_hi = vmull_high_s16(vxa1, vxb1);
+#else
+    int32x4_t vacc0_hi = vmull_s16(vget_high_s16(vxa0), vget_high_s16(vxb0));
+    int32x4_t vacc1_hi = vmull_s16(vget_high_s16(vxa1), vget_high_s16(vxb1));
+#endif
+
+    // Multiply by Q31 multiplier, shift right and round.
+    vacc0_lo = vqrdmulhq_s32(vacc0_lo, vmultiplier);
+    vacc1_lo = vqrdmulhq_s32(vacc1_lo, vmultiplier);
+    vacc0_hi = vqrdmulhq_s32(vacc0_hi, vmultiplier);
+    vacc1_hi = vqrdmulhq_s32(vacc1_hi, vmultiplier);
+
+    vacc0_lo = vsraq_n_s32(vacc0_lo, vbicq_s32(vacc0_lo, vzero_shift_mask), 31);
+    vacc1_lo = vsraq_n_s32(vacc1_lo, vbicq_s32(vacc1_lo, vzero_shift_mask), 31);
+    vacc0_hi = vsraq_n_s32(vacc0_hi, vbicq_s32(vacc0_hi, vzero_shift_mask), 31);
+    vacc1_hi = vsraq_n_s32(vacc1_hi, vbicq_s32(vacc1_hi, vzero_shift_mask), 31);
+
+    vacc0_lo = vrshlq_s32(vacc0_lo, vright_shift);
+    vacc1_lo = vrshlq_s32(vacc1_lo, vright_shift);
+    vacc0_hi = vrshlq_s32(vacc0_hi, vright_shift);
+    vacc1_hi = vrshlq_s32(vacc1_hi, vright_shift);
+
+    // Pack, saturate, and add output zero point.
+#ifdef __aarch64__
+    const int16x8_t vacc0 = vqaddq_s16(vqmovn_high_s32(vqmovn_s32(vacc0_lo), vacc0_hi), vy_zero_point);
+    const int16x8_t vacc1 = vqaddq_s16(vqmovn_high_s32(vqmovn_s32(vacc1_lo), vacc1_hi), vy_zero_point);
+
+    uint8x16_t vy01 = vqmovun_high_s16(vqmovun_s16(vacc0), vacc1);
+#else
+    const int16x8_t vacc0 = vqaddq_s16(vcombine_s16(vqmovn_s32(vacc0_lo), vqmovn_s32(vacc0_hi)), vy_zero_point);
+    const int16x8_t vacc1 = vqaddq_s16(vcombine_s16(vqmovn_s32(vacc1_lo), vqmovn_s32(vacc1_hi)), vy_zero_point);
+
+    uint8x16_t vy01 = vcombine_u8(vqmovun_s16(vacc0), vqmovun_s16(vacc1));
+#endif
+    vy01 = vmaxq_u8(vy01, vy_min);
+    vy01 = vminq_u8(vy01, vy_max);
+
+    vst1q_u8(y, vy01); y += 16;
+  }
+  for (; n >= 8 * sizeof(uint8_t); n -= 8 * sizeof(uint8_t)) {
+    const uint8x8_t va = vld1_u8(a); a += 8;
+    const uint8x8_t vb = vld1_u8(b); b += 8;
+
+    // Subtract zero points.
+    const int16x8_t vxa = vreinterpretq_s16_u16(vsubl_u8(va, va_zero_point));
+    const int16x8_t vxb = vreinterpretq_s16_u16(vsubl_u8(vb, vb_zero_point));
+
+    // Multiply inputs into 32-bit products.
+    int32x4_t vacc_lo = vmull_s16(vget_low_s16(vxa), vget_low_s16(vxb));
+#ifdef __aarch64__
+    int32x4_t vacc_hi = vmull_high_s16(vxa, vxb);
+#else
+    int32x4_t vacc_hi = vmull_s16(vget_high_s16(vxa), vget_high_s16(vxb));
+#endif
+
+    // Multiply by Q31 multiplier, shift right and round.
+    vacc_lo = vqrdmulhq_s32(vacc_lo, vmultiplier);
+    vacc_hi = vqrdmulhq_s32(vacc_hi, vmultiplier);
+
+    vacc_lo = vsraq_n_s32(vacc_lo, vbicq_s32(vacc_lo, vzero_shift_mask), 31);
+    vacc_hi = vsraq_n_s32(vacc_hi, vbicq_s32(vacc_hi, vzero_shift_mask), 31);
+
+    vacc_lo = vrshlq_s32(vacc_lo, vright_shift);
+    vacc_hi = vrshlq_s32(vacc_hi, vright_shift);
+
+    // Pack, saturate, and add output zero point.
+#ifdef __aarch64__
+    const int16x8_t vacc = vqaddq_s16(vqmovn_high_s32(vqmovn_s32(vacc_lo), vacc_hi), vy_zero_point);
+#else
+    const int16x8_t vacc = vqaddq_s16(vcombine_s16(vqmovn_s32(vacc_lo), vqmovn_s32(vacc_hi)), vy_zero_point);
+#endif
+
+    uint8x8_t vy = vqmovun_s16(vacc);
+    vy = vmax_u8(vy, vget_low_u8(vy_min));
+    vy = vmin_u8(vy, vget_low_u8(vy_max));
+
+    vst1_u8(y, vy); y += 8;
+  }
+  if (n != 0) {
+    const uint8x8_t va = vld1_u8(a);
+    const uint8x8_t vb = vld1_u8(b);
+
+    // Subtract zero points.
+    const int16x8_t vxa = vreinterpretq_s16_u16(vsubl_u8(va, va_zero_point));
+    const int16x8_t vxb = vreinterpretq_s16_u16(vsubl_u8(vb, vb_zero_point));
+
+    // Multiply inputs into 32-bit products.
+    int32x4_t vacc_lo = vmull_s16(vget_low_s16(vxa), vget_low_s16(vxb));
+#ifdef __aarch64__
+    int32x4_t vacc_hi = vmull_high_s16(vxa, vxb);
+#else
+    int32x4_t vacc_hi = vmull_s16(vget_high_s16(vxa), vget_high_s16(vxb));
+#endif
+
+    // Multiply by Q31 multiplier, shift right and round.
+    vacc_lo = vqrdmulhq_s32(vacc_lo, vmultiplier);
+    vacc_hi = vqrdmulhq_s32(vacc_hi, vmultiplier);
+
+    vacc_lo = vsraq_n_s32(vacc_lo, vbicq_s32(vacc_lo, vzero_shift_mask), 31);
+    vacc_hi = vsraq_n_s32(vacc_hi, vbicq_s32(vacc_hi, vzero_shift_mask), 31);
+
+    vacc_lo = vrshlq_s32(vacc_lo, vright_shift);
+    vacc_hi = vrshlq_s32(vacc_hi, vright_shift);
+
+    // Pack, saturate, and add output zero point.
+#ifdef __aarch64__
+    const int16x8_t vacc = vqaddq_s16(vqmovn_high_s32(vqmovn_s32(vacc_lo), vacc_hi), vy_zero_point);
+#else
+    const int16x8_t vacc = vqaddq_s16(vcombine_s16(vqmovn_s32(vacc_lo), vqmovn_s32(vacc_hi)), vy_zero_point);
+#endif
+
+    uint8x8_t vy = vqmovun_s16(vacc);
+    vy = vmax_u8(vy, vget_low_u8(vy_min));
+    vy = vmin_u8(vy, vget_low_u8(vy_max));
+
+    if (n & (4 * sizeof(uint8_t))) {
+      vst1_lane_u32(__builtin_assume_aligned(y, 1), vreinterpret_u32_u8(vy), 0); y += 4;
+      vy = vext_u8(vy, vy, 4);
+    }
+    if (n & (2 * sizeof(uint8_t))) {
+      vst1_lane_u16(__builtin_assume_aligned(y, 1), vreinterpret_u16_u8(vy), 0); y += 2;
+      vy = vext_u8(vy, vy, 2);
+    }
+    if (n & (1 * sizeof(uint8_t))) {
+      vst1_lane_u8(y, vy, 0);
+    }
+  }
+}
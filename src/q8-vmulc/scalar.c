@@ -0,0 +1,54 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/scalar-utils.h>
+#include <xnnpack/vmul.h>
+
+
+void xnn_q8_vmulc_ukernel__scalar(
+    size_t n,
+    const uint8_t* a,
+    const uint8_t* b,
+    uint8_t* y,
+    const union xnn_q8_gemm_params params[restrict static 1])
+{
+  assert(n != 0);
+
+  const int32_t va_zero_point = params->scalar.input_zero_point;
+  const int32_t vb_zero_point = params->scalar.kernel_zero_point;
+  const int32_t vmultiplier = params->scalar.multiplier;
+  const int32_t vremainder_mask = params->scalar.remainder_mask;
+  const int32_t vremainder_threshold = params->scalar.remainder_threshold;
+  const uint32_t vshift = params->scalar.shift;
+  const int32_t vy_min = params->scalar.output_min_less_zero_point;
+  const int32_t vy_max = params->scalar.output_max_less_zero_point;
+  const int32_t vy_zero_point = params->scalar.output_zero_point;
+
+  const int32_t vxb = (int32_t) (uint32_t) *b - vb_zero_point;
+  do {
+    const int32_t vxa = (int32_t) (uint32_t) *a++ - va_zero_point;
+
+    // Multiply inputs.
+    const int32_t vacc = vxa * vxb;
+
+    // Multiply by Q31 multiplier, shift right and round.
+    const int64_t vproduct = (int64_t) vacc * (int64_t) vmultiplier;
+    const int32_t vq31product = (int32_t) (uint32_t) ((uint64_t) (vproduct + INT64_C(0x40000000)) >> 31);
+    const int32_t vremainder = (vq31product & vremainder_mask) - (int32_t) (vq31product < 0);
+    int32_t vy = asr_s32(vq31product, vshift) + (int32_t) (vremainder > vremainder_threshold);
+
+    // Saturate and add output zero point.
+    vy = vy < vy_min ? vy_min : vy;
+    vy = vy > vy_max ? vy_max : vy;
+    vy += vy_zero_point;
+
+    *y++ = (uint8_t) vy;
+
+    n -= sizeof(uint8_t);
+  } while (n != 0);
+}
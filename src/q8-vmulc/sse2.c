@@ -0,0 +1,170 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <immintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vmul.h>
+
+
+void xnn_q8_vmulc_ukernel__sse2(
+    size_t n,
+    const uint8_t* a,
+    const uint8_t* b,
+    uint8_t* y,
+    const union xnn_q8_gemm_params params[restrict static 1])
+{
+  const __m128i va_zero_point = _mm_load_si128((const __m128i*) params->sse2.input_zero_point);
+  const __m128i vxb = _mm_sub_epi16(
+    _mm_set1_epi16((int16_t) (uint16_t) *b), _mm_load_si128((const __m128i*) params->sse2.kernel_zero_point));
+  const __m128i vmultiplier = _mm_load_si128((const __m128i*) params->sse2.multiplier);
+  const __m128i vrounding = _mm_load_si128((const __m128i*) params->sse2.rounding);
+  const __m128i vremainder_mask = _mm_load_si128((const __m128i*) params->sse2.remainder_mask);
+  const __m128i vremainder_threshold = _mm_load_si128((const __m128i*) params->sse2.remainder_threshold);
+  const __m128i vshift = _mm_load_si128((const __m128i*) params->sse2.shift);
+  const __m128i vy_zero_point = _mm_load_si128((const __m128i*) params->sse2.output_zero_point);
+  const __m128i vy_max = _mm_load_si128((const __m128i*) params->sse2.output_max);
+  const __m128i vy_min = _mm_load_si128((const __m128i*) params->sse2.output_min);
+
+  const __m128i vzero = _mm_setzero_si128();
+  for (; n >= 8 * sizeof(uint8_t); n -= 8 * sizeof(uint8_t)) {
+    const __m128i va = _mm_loadl_epi64((const __m128i*) a);
+    a += 8;
+
+    // Subtract zero point.
+    const __m128i vxa = _mm_sub_epi16(_mm_unpacklo_epi8(va, vzero), va_zero_point);
+
+    // Multiply inputs into 32-bit products.
+    const __m128i vprod_lo16 = _mm_mullo_epi16(vxa, vxb);
+    const __m128i vprod_hi16 = _mm_mulhi_epi16(vxa, vxb);
+    const __m128i vacc_lo = _mm_unpacklo_epi16(vprod_lo16, vprod_hi16);
+    const __m128i vacc_hi = _mm_unpackhi_epi16(vprod_lo16, vprod_hi16);
+
+    // Multiply by Q31 multiplier.
+    const __m128i vnmask_lo = _mm_cmpgt_epi32(vzero, vacc_lo);
+    const __m128i vnmask_hi = _mm_cmpgt_epi32(vzero, vacc_hi);
+    const __m128i vabsacc_lo = _mm_sub_epi32(_mm_xor_si128(vacc_lo, vnmask_lo), vnmask_lo);
+    const __m128i vabsacc_hi = _mm_sub_epi32(_mm_xor_si128(vacc_hi, vnmask_hi), vnmask_hi);
+
+    const __m128i vabsprod_lo02 = _mm_mul_epu32(vabsacc_lo, vmultiplier);
+    const __m128i vabsprod_hi02 = _mm_mul_epu32(vabsacc_hi, vmultiplier);
+    const __m128i vnmask_lo02 = _mm_shuffle_epi32(vnmask_lo, _MM_SHUFFLE(2, 2, 0, 0));
+    const __m128i vnmask_hi02 = _mm_shuffle_epi32(vnmask_hi, _MM_SHUFFLE(2, 2, 0, 0));
+    const __m128i vprod_lo02 = _mm_sub_epi64(_mm_xor_si128(vabsprod_lo02, vnmask_lo02), vnmask_lo02);
+    const __m128i vprod_hi02 = _mm_sub_epi64(_mm_xor_si128(vabsprod_hi02, vnmask_hi02), vnmask_hi02);
+    const __m128i vq31prod_lo02 = _mm_srli_epi64(_mm_add_epi64(vprod_lo02, vrounding), 31);
+    const __m128i vq31prod_hi02 = _mm_srli_epi64(_mm_add_epi64(vprod_hi02, vrounding), 31);
+
+    const __m128i vabsprod_lo13 = _mm_mul_epu32(_mm_shuffle_epi32(vabsacc_lo, _MM_SHUFFLE(2, 3, 0, 1)), vmultiplier);
+    const __m128i vabsprod_hi13 = _mm_mul_epu32(_mm_shuffle_epi32(vabsacc_hi, _MM_SHUFFLE(2, 3, 0, 1)), vmultiplier);
+    const __m128i vnmask_lo13 = _mm_shuffle_epi32(vnmask_lo, _MM_SHUFFLE(3, 3, 1, 1));
+    const __m128i vnmask_hi13 = _mm_shuffle_epi32(vnmask_hi, _MM_SHUFFLE(3, 3, 1, 1));
+    const __m128i vprod_lo13 = _mm_sub_epi64(_mm_xor_si128(vabsprod_lo13, vnmask_lo13), vnmask_lo13);
+    const __m128i vprod_hi13 = _mm_sub_epi64(_mm_xor_si128(vabsprod_hi13, vnmask_hi13), vnmask_hi13);
+    const __m128i vq31prod_lo13 = _mm_srli_epi64(_mm_add_epi64(vprod_lo13, vrounding), 31);
+    const __m128i vq31prod_hi13 = _mm_srli_epi64(_mm_add_epi64(vprod_hi13, vrounding), 31);
+
+    const __m128i vq31prod_lo0213 = _mm_castps_si128(_mm_shuffle_ps(
+        _mm_castsi128_ps(vq31prod_lo02), _mm_castsi128_ps(vq31prod_lo13), _MM_SHUFFLE(2, 0, 2, 0)));
+    const __m128i vq31prod_hi0213 = _mm_castps_si128(_mm_shuffle_ps(
+        _mm_castsi128_ps(vq31prod_hi02), _mm_castsi128_ps(vq31prod_hi13), _MM_SHUFFLE(2, 0, 2, 0)));
+    const __m128i vq31prod_lo = _mm_shuffle_epi32(vq31prod_lo0213, _MM_SHUFFLE(3, 1, 2, 0));
+    const __m128i vq31prod_hi = _mm_shuffle_epi32(vq31prod_hi0213, _MM_SHUFFLE(3, 1, 2, 0));
+
+    // Shift right and round.
+    const __m128i vrem_lo =
+      _mm_add_epi32(_mm_and_si128(vq31prod_lo, vremainder_mask), _mm_cmpgt_epi32(vzero, vq31prod_lo));
+    const __m128i vrem_hi =
+      _mm_add_epi32(_mm_and_si128(vq31prod_hi, vremainder_mask), _mm_cmpgt_epi32(vzero, vq31prod_hi));
+
+    const __m128i vy_lo =
+      _mm_sub_epi32(_mm_sra_epi32(vq31prod_lo, vshift), _mm_cmpgt_epi32(vrem_lo, vremainder_threshold));
+    const __m128i vy_hi =
+      _mm_sub_epi32(_mm_sra_epi32(vq31prod_hi, vshift), _mm_cmpgt_epi32(vrem_hi, vremainder_threshold));
+
+    // Pack, saturate, and add output zero point.
+    const __m128i vacc = _mm_adds_epi16(_mm_packs_epi32(vy_lo, vy_hi), vy_zero_point);
+    __m128i vy = _mm_packus_epi16(vacc, vacc);
+    vy = _mm_max_epu8(vy, vy_min);
+    vy = _mm_min_epu8(vy, vy_max);
+
+    _mm_storel_epi64((__m128i*) y, vy);
+    y += 8;
+  }
+  if (n != 0) {
+    const __m128i va = _mm_loadl_epi64((const __m128i*) a);
+
+    // Subtract zero point.
+    const __m128i vxa = _mm_sub_epi16(_mm_unpacklo_epi8(va, vzero), va_zero_point);
+
+    // Multiply inputs into 32-bit products.
+    const __m128i vprod_lo16 = _mm_mullo_epi16(vxa, vxb);
+    const __m128i vprod_hi16 = _mm_mulhi_epi16(vxa, vxb);
+    const __m128i vacc_lo = _mm_unpacklo_epi16(vprod_lo16, vprod_hi16);
+    const __m128i vacc_hi = _mm_unpackhi_epi16(vprod_lo16, vprod_hi16);
+
+    // Multiply by Q31 multiplier.
+    const __m128i vnmask_lo = _mm_cmpgt_epi32(vzero, vacc_lo);
+    const __m128i vnmask_hi = _mm_cmpgt_epi32(vzero, vacc_hi);
+    const __m128i vabsacc_lo = _mm_sub_epi32(_mm_xor_si128(vacc_lo, vnmask_lo), vnmask_lo);
+    const __m128i vabsacc_hi = _mm_sub_epi32(_mm_xor_si128(vacc_hi, vnmask_hi), vnmask_hi);
+
+    const __m128i vabsprod_lo02 = _mm_mul_epu32(vabsacc_lo, vmultiplier);
+    const __m128i vabsprod_hi02 = _mm_mul_epu32(vabsacc_hi, vmultiplier);
+    const __m128i vnmask_lo02 = _mm_shuffle_epi32(vnmask_lo, _MM_SHUFFLE(2, 2, 0, 0));
+    const __m128i vnmask_hi02 = _mm_shuffle_epi32(vnmask_hi, _MM_SHUFFLE(2, 2, 0, 0));
+    const __m128i vprod_lo02 = _mm_sub_epi64(_mm_xor_si128(vabsprod_lo02, vnmask_lo02), vnmask_lo02);
+    const __m128i vprod_hi02 = _mm_sub_epi64(_mm_xor_si128(vabsprod_hi02, vnmask_hi02), vnmask_hi02);
+    const __m128i vq31prod_lo02 = _mm_srli_epi64(_mm_add_epi64(vprod_lo02, vrounding), 31);
+    const __m128i vq31prod_hi02 = _mm_srli_epi64(_mm_add_epi64(vprod_hi02, vrounding), 31);
+
+    const __m128i vabsprod_lo13 = _mm_mul_epu32(_mm_shuffle_epi32(vabsacc_lo, _MM_SHUFFLE(2, 3, 0, 1)), vmultiplier);
+    const __m128i vabsprod_hi13 = _mm_mul_epu32(_mm_shuffle_epi32(vabsacc_hi, _MM_SHUFFLE(2, 3, 0, 1)), vmultiplier);
+    const __m128i vnmask_lo13 = _mm_shuffle_epi32(vnmask_lo, _MM_SHUFFLE(3, 3, 1, 1));
+    const __m128i vnmask_hi13 = _mm_shuffle_epi32(vnmask_hi, _MM_SHUFFLE(3, 3, 1, 1));
+    const __m128i vprod_lo13 = _mm_sub_epi64(_mm_xor_si128(vabsprod_lo13, vnmask_lo13), vnmask_lo13);
+    const __m128i vprod_hi13 = _mm_sub_epi64(_mm_xor_si128(vabsprod_hi13, vnmask_hi13), vnmask_hi13);
+    const __m128i vq31prod_lo13 = _mm_srli_epi64(_mm_add_epi64(vprod_lo13, vrounding), 31);
+    const __m128i vq31prod_hi13 = _mm_srli_epi64(_mm_add_epi64(vprod_hi13, vrounding), 31);
+
+    const __m128i vq31prod_lo0213 = _mm_castps_si128(_mm_shuffle_ps(
+        _mm_castsi128_ps(vq31prod_lo02), _mm_castsi128_ps(vq31prod_lo13), _MM_SHUFFLE(2, 0, 2, 0)));
+    const __m128i vq31prod_hi0213 = _mm_castps_si128(_mm_shuffle_ps(
+        _mm_castsi128_ps(vq31prod_hi02), _mm_castsi128_ps(vq31prod_hi13), _MM_SHUFFLE(2, 0, 2, 0)));
+    const __m128i vq31prod_lo = _mm_shuffle_epi32(vq31prod_lo0213, _MM_SHUFFLE(3, 1, 2, 0));
+    const __m128i vq31prod_hi = _mm_shuffle_epi32(vq31prod_hi0213, _MM_SHUFFLE(3, 1, 2, 0));
+
+    // Shift right and round.
+    const __m128i vrem_lo =
+      _mm_add_epi32(_mm_and_si128(vq31prod_lo, vremainder_mask), _mm_cmpgt_epi32(vzero, vq31prod_lo));
+    const __m128i vrem_hi =
+      _mm_add_epi32(_mm_and_si128(vq31prod_hi, vremainder_mask), _mm_cmpgt_epi32(vzero, vq31prod_hi));
+
+    const __m128i vy_lo =
+      _mm_sub_epi32(_mm_sra_epi32(vq31prod_lo, vshift), _mm_cmpgt_epi32(vrem_lo, vremainder_threshold));
+    const __m128i vy_hi =
+      _mm_sub_epi32(_mm_sra_epi32(vq31prod_hi, vshift), _mm_cmpgt_epi32(vrem_hi, vremainder_threshold));
+
+    // Pack, saturate, and add output zero point.
+    const __m128i vacc = _mm_adds_epi16(_mm_packs_epi32(vy_lo, vy_hi), vy_zero_point);
+    __m128i vy = _mm_packus_epi16(vacc, vacc);
+    vy = _mm_max_epu8(vy, vy_min);
+    vy = _mm_min_epu8(vy, vy_max);
+
+    if (n & (4 * sizeof(uint8_t))) {
+      *((uint32_t*) y) = (uint32_t) _mm_cvtsi128_si32(vy);
+      vy = _mm_srli_epi64(vy, 32);
+      y += 4;
+    }
+    if (n & (2 * sizeof(uint8_t))) {
+      *((uint16_t*) y) = (uint16_t) _mm_extract_epi16(vy, 0);
+      vy = _mm_srli_epi32(vy, 16);
+      y += 2;
+    }
+    if (n & (1 * sizeof(uint8_t))) {
+      *((uint8_t*) y) = (uint8_t) _mm_cvtsi128_si32(vy);
+    }
+  }
+}
@@ -0,0 +1,230 @@
+// Copyright (c) Facebook, Inc. and its affiliates.
+// All rights reserved.
+//
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <arm_neon.h>
+
+#include <xnnpack/dwconv.h>
+
+
+void xnn_q8c_dwconv_ukernel_up8x9__neon(
+    size_t channels,
+    size_t output_width,
+    const uint8_t** input,
+    const void* weights,
+    uint8_t* output,
+    size_t input_stride,
+    size_t output_increment,
+    const union xnn_q8c_gemm_params params[restrict static 1])
+{
+  const uint8x8_t vkernel_zero_point = vld1_dup_u8((const uint8_t*) &params->neon.kernel_zero_point);
+  const float32x4_t voutput_min_less_zero_point = vld1q_dup_f32(&params->neon.output_min_less_zero_point);
+  const float32x4_t voutput_max_less_zero_point = vld1q_dup_f32(&params->neon.output_max_less_zero_point);
+  const float32x4_t vmagic_bias = vld1q_dup_f32(&params->neon.magic_bias);
+  const int32x4_t vmagic_bias_less_output_zero_point = vld1q_dup_s32(&params->neon.magic_bias_less_output_zero_point);
+
+  do {
+    const uint8_t* i0 = input[0];
+    const uint8_t* i1 = input[1];
+    const uint8_t* i2 = input[2];
+    const uint8_t* i3 = input[3];
+    const uint8_t* i4 = input[4];
+    const uint8_t* i5 = input[5];
+    const uint8_t* i6 = input[6];
+    const uint8_t* i7 = input[7];
+    const uint8_t* i8 = input[8];
+
+    input = (const uint8_t**) ((uintptr_t) input + input_stride);
+
+    size_t c = channels;
+    const void* w = weights;
+    for (; c >= 8; c -= 8) {
+      int32x4_t vaccX1_lo = vld1q_s32(w); w = (void*) ((uintptr_t) w + sizeof(int32x4_t));
+      int32x4_t vaccX1_hi = vld1q_s32(w); w = (void*) ((uintptr_t) w + sizeof(int32x4_t));
+      const float32x4_t vscale_lo = vld1q_f32(w); w = (void*) ((uintptr_t) w + sizeof(float32x4_t));
+      const float32x4_t vscale_hi = vld1q_f32(w); w = (void*) ((uintptr_t) w + sizeof(float32x4_t));
+
+      const uint8x8_t vk0 = vld1_u8(w); w = (void*) ((uintptr_t) w + sizeof(uint8x8_t));
+      const uint8x8_t vi0 = vld1_u8(i0); i0 += 8;
+      const int16x8_t vxk0 = vreinterpretq_s16_u16(vsubl_u8(vk0, vkernel_zero_point));
+      const int16x8_t vxi0 = vreinterpretq_s16_u16(vmovl_u8(vi0));
+      int32x4_t vaccX0_lo = vmull_s16(vget_low_s16(vxk0), vget_low_s16(vxi0));
+      int32x4_t vaccX0_hi = vmull_s16(vget_high_s16(vxk0), vget_high_s16(vxi0));
+
+      const uint8x8_t vk1 = vld1_u8(w); w = (void*) ((uintptr_t) w + sizeof(uint8x8_t));
+      const uint8x8_t vi1 = vld1_u8(i1); i1 += 8;
+      const int16x8_t vxk1 = vreinterpretq_s16_u16(vsubl_u8(vk1, vkernel_zero_point));
+      const int16x8_t vxi1 = vreinterpretq_s16_u16(vmovl_u8(vi1));
+      vaccX1_lo = vmlal_s16(vaccX1_lo, vget_low_s16(vxk1), vget_low_s16(vxi1));
+      vaccX1_hi = vmlal_s16(vaccX1_hi, vget_high_s16(vxk1), vget_high_s16(vxi1));
+
+      const uint8x8_t vk2 = vld1_u8(w); w = (void*) ((uintptr_t) w + sizeof(uint8x8_t));
+      const uint8x8_t vi2 = vld1_u8(i2); i2 += 8;
+      const int16x8_t vxk2 = vreinterpretq_s16_u16(vsubl_u8(vk2, vkernel_zero_point));
+      const int16x8_t vxi2 = vreinterpretq_s16_u16(vmovl_u8(vi2));
+      vaccX0_lo = vmlal_s16(vaccX0_lo, vget_low_s16(vxk2), vget_low_s16(vxi2));
+      vaccX0_hi = vmlal_s16(vaccX0_hi, vget_high_s16(vxk2), vget_high_s16(vxi2));
+
+      const uint8x8_t vk3 = vld1_u8(w); w = (void*) ((uintptr_t) w + sizeof(uint8x8_t));
+      const uint8x8_t vi3 = vld1_u8(i3); i3 += 8;
+      const int16x8_t vxk3 = vreinterpretq_s16_u16(vsubl_u8(vk3, vkernel_zero_point));
+      const int16x8_t vxi3 = vreinterpretq_s16_u16(vmovl_u8(vi3));
+      vaccX1_lo = vmlal_s16(vaccX1_lo, vget_low_s16(vxk3), vget_low_s16(vxi3));
+      vaccX1_hi = vmlal_s16(vaccX1_hi, vget_high_s16(vxk3), vget_high_s16(vxi3));
+
+      const uint8x8_t vk4 = vld1_u8(w); w = (void*) ((uintptr_t) w + sizeof(uint8x8_t));
+      const uint8x8_t vi4 = vld1_u8(i4); i4 += 8;
+      const int16x8_t vxk4 = vreinterpretq_s16_u16(vsubl_u8(vk4, vkernel_zero_point));
+      const int16x8_t vxi4 = vreinterpretq_s16_u16(vmovl_u8(vi4));
+      vaccX0_lo = vmlal_s16(vaccX0_lo, vget_low_s16(vxk4), vget_low_s16(vxi4));
+      vaccX0_hi = vmlal_s16(vaccX0_hi, vget_high_s16(vxk4), vget_high_s16(vxi4));
+
+      const uint8x8_t vk5 = vld1_u8(w); w = (void*) ((uintptr_t) w + sizeof(uint8x8_t));
+      const uint8x8_t vi5 = vld1_u8(i5); i5 += 8;
+      const int16x8_t vxk5 = vreinterpretq_s16_u16(vsubl_u8(vk5, vkernel_zero_point));
+      const int16x8_t vxi5 = vreinterpretq_s16_u16(vmovl_u8(vi5));
+      vaccX1_lo = vmlal_s16(vaccX1_lo, vget_low_s16(vxk5), vget_low_s16(vxi5));
+      vaccX1_hi = vmlal_s16(vaccX1_hi, vget_high_s16(vxk5), vget_high_s16(vxi5));
+
+      const uint8x8_t vk6 = vld1_u8(w); w = (void*) ((uintptr_t) w + sizeof(uint8x8_t));
+      const uint8x8_t vi6 = vld1_u8(i6); i6 += 8;
+      const int16x8_t vxk6 = vreinterpretq_s16_u16(vsubl_u8(vk6, vkernel_zero_point));
+      const int16x8_t vxi6 = vreinterpretq_s16_u16(vmovl_u8(vi6));
+      vaccX0_lo = vmlal_s16(vaccX0_lo, vget_low_s16(vxk6), vget_low_s16(vxi6));
+      vaccX0_hi = vmlal_s16(vaccX0_hi, vget_high_s16(vxk6), vget_high_s16(vxi6));
+
+      const uint8x8_t vk7 = vld1_u8(w); w = (void*) ((uintptr_t) w + sizeof(uint8x8_t));
+      const uint8x8_t vi7 = vld1_u8(i7); i7 += 8;
+      const int16x8_t vxk7 = vreinterpretq_s16_u16(vsubl_u8(vk7, vkernel_zero_point));
+      const int16x8_t vxi7 = vreinterpretq_s16_u16(vmovl_u8(vi7));
+      vaccX1_lo = vmlal_s16(vaccX1_lo, vget_low_s16(vxk7), vget_low_s16(vxi7));
+      vaccX1_hi = vmlal_s16(vaccX1_hi, vget_high_s16(vxk7), vget_high_s16(vxi7));
+
+      const uint8x8_t vk8 = vld1_u8(w); w = (void*) ((uintptr_t) w + sizeof(uint8x8_t));
+      const uint8x8_t vi8 = vld1_u8(i8); i8 += 8;
+      const int16x8_t vxk8 = vreinterpretq_s16_u16(vsubl_u8(vk8, vkernel_zero_point));
+      const int16x8_t vxi8 = vreinterpretq_s16_u16(vmovl_u8(vi8));
+      vaccX0_lo = vmlal_s16(vaccX0_lo, vget_low_s16(vxk8), vget_low_s16(vxi8));
+      vaccX0_hi = vmlal_s16(vaccX0_hi, vget_high_s16(vxk8), vget_high_s16(vxi8));
+
+      int32x4_t vacc_lo = vaddq_s32(vaccX0_lo, vaccX1_lo);
+      int32x4_t vacc_hi = vaddq_s32(vaccX0_hi, vaccX1_hi);
+
+      float32x4_t vfpacc_lo = vmulq_f32(vcvtq_f32_s32(vacc_lo), vscale_lo);
+      float32x4_t vfpacc_hi = vmulq_f32(vcvtq_f32_s32(vacc_hi), vscale_hi);
+
+      vfpacc_lo = vminq_f32(vmaxq_f32(vfpacc_lo, voutput_min_less_zero_point), voutput_max_less_zero_point);
+      vfpacc_hi = vminq_f32(vmaxq_f32(vfpacc_hi, voutput_min_less_zero_point), voutput_max_less_zero_point);
+
+      vacc_lo = vsubq_s32(vreinterpretq_s32_f32(vaddq_f32(vfpacc_lo, vmagic_bias)), vmagic_bias_less_output_zero_point);
+      vacc_hi = vsubq_s32(vreinterpretq_s32_f32(vaddq_f32(vfpacc_hi, vmagic_bias)), vmagic_bias_less_output_zero_point);
+
+      const int16x8_t vacc = vcombine_s16(vmovn_s32(vacc_lo), vmovn_s32(vacc_hi));
+      uint8x8_t vout = vqmovun_s16(vacc);
+
+      vst1_u8(output, vout); output += 8;
+    }
+    if (c != 0) {
+      int32x4_t vaccX1_lo = vld1q_s32(w); w = (void*) ((uintptr_t) w + sizeof(int32x4_t));
+      int32x4_t vaccX1_hi = vld1q_s32(w); w = (void*) ((uintptr_t) w + sizeof(int32x4_t));
+      const float32x4_t vscale_lo = vld1q_f32(w); w = (void*) ((uintptr_t) w + sizeof(float32x4_t));
+      const float32x4_t vscale_hi = vld1q_f32(w); w = (void*) ((uintptr_t) w + sizeof(float32x4_t));
+
+      const uint8x8_t vk0 = vld1_u8(w); w = (void*) ((uintptr_t) w + sizeof(uint8x8_t));
+      const uint8x8_t vi0 = vld1_u8(i0);
+      const int16x8_t vxk0 = vreinterpretq_s16_u16(vsubl_u8(vk0, vkernel_zero_point));
+      const int16x8_t vxi0 = vreinterpretq_s16_u16(vmovl_u8(vi0));
+      int32x4_t vaccX0_lo = vmull_s16(vget_low_s16(vxk0), vget_low_s16(vxi0));
+      int32x4_t vaccX0_hi = vmull_s16(vget_high_s16(vxk0), vget_high_s16(vxi0));
+
+      const uint8x8_t vk1 = vld1_u8(w); w = (void*) ((uintptr_t) w + sizeof(uint8x8_t));
+      const uint8x8_t vi1 = vld1_u8(i1);
+      const int16x8_t vxk1 = vreinterpretq_s16_u16(vsubl_u8(vk1, vkernel_zero_point));
+      const int16x8_t vxi1 = vreinterpretq_s16_u16(vmovl_u8(vi1));
+      vaccX1_lo = vmlal_s16(vaccX1_lo, vget_low_s16(vxk1), vget_low_s16(vxi1));
+      vaccX1_hi = vmlal_s16(vaccX1_hi, vget_high_s16(vxk1), vget_high_s16(vxi1));
+
+      const uint8x8_t vk2 = vld1_u8(w); w = (void*) ((uintptr_t) w + sizeof(uint8x8_t));
+      const uint8x8_t vi2 = vld1_u8(i2);
+      const int16x8_t vxk2 = vreinterpretq_s16_u16(vsubl_u8(vk2, vkernel_zero_point));
+      const int16x8_t vxi2 = vreinterpretq_s16_u16(vmovl_u8(vi2));
+      vaccX0_lo = vmlal_s16(vaccX0_lo, vget_low_s16(vxk2), vget_low_s16(vxi2));
+      vaccX0_hi = vmlal_s16(vaccX0_hi, vget_high_s16(vxk2), vget_high_s16(vxi2));
+
+      const uint8x8_t vk3 = vld1_u8(w); w = (void*) ((uintptr_t) w + sizeof(uint8x8_t));
+      const uint8x8_t vi3 = vld1_u8(i3);
+      const int16x8_t vxk3 = vreinterpretq_s16_u16(vsubl_u8(vk3, vkernel_zero_point));
+      const int16x8_t vxi3 = vreinterpretq_s16_u16(vmovl_u8(vi3));
+      vaccX1_lo = vmlal_s16(vaccX1_lo, vget_low_s16(vxk3), vget_low_s16(vxi3));
+      vaccX1_hi = vmlal_s16(vaccX1_hi, vget_high_s16(vxk3), vget_high_s16(vxi3));
+
+      const uint8x8_t vk4 = vld1_u8(w); w = (void*) ((uintptr_t) w + sizeof(uint8x8_t));
+      const uint8x8_t vi4 = vld1_u8(i4);
+      const int16x8_t vxk4 = vreinterpretq_s16_u16(vsubl_u8(vk4, vkernel_zero_point));
+      const int16x8_t vxi4 = vreinterpretq_s16_u16(vmovl_u8(vi4));
+      vaccX0_lo = vmlal_s16(vaccX0_lo, vget_low_s16(vxk4), vget_low_s16(vxi4));
+      vaccX0_hi = vmlal_s16(vaccX0_hi, vget_high_s16(vxk4), vget_high_s16(vxi4));
+
+      const uint8x8_t vk5 = vld1_u8(w); w = (void*) ((uintptr_t) w + sizeof(uint8x8_t));
+      const uint8x8_t vi5 = vld1_u8(i5);
+      const int16x8_t vxk5 = vreinterpretq_s16_u16(vsubl_u8(vk5, vkernel_zero_point));
+      const int16x8_t vxi5 = vreinterpretq_s16_u16(vmovl_u8(vi5));
+      vaccX1_lo = vmlal_s16(vaccX1_lo, vget_low_s16(vxk5), vget_low_s16(vxi5));
+      vaccX1_hi = vmlal_s16(vaccX1_hi, vget_high_s16(vxk5), vget_high_s16(vxi5));
+
+      const uint8x8_t vk6 = vld1_u8(w); w = (void*) ((uintptr_t) w + sizeof(uint8x8_t));
+      const uint8x8_t vi6 = vld1_u8(i6);
+      const int16x8_t vxk6 = vreinterpretq_s16_u16(vsubl_u8(vk6, vkernel_zero_point));
+      const int16x8_t vxi6 = vreinterpretq_s16_u16(vmovl_u8(vi6));
+      vaccX0_lo = vmlal_s16(vaccX0_lo, vget_low_s16(vxk6), vget_low_s16(vxi6));
+      vaccX0_hi = vmlal_s16(vaccX0_hi, vget_high_s16(vxk6), vget_high_s16(vxi6));
+
+      const uint8x8_t vk7 = vld1_u8(w); w = (void*) ((uintptr_t) w + sizeof(uint8x8_t));
+      const uint8x8_t vi7 = vld1_u8(i7);
+      const int16x8_t vxk7 = vreinterpretq_s16_u16(vsubl_u8(vk7, vkernel_zero_point));
+      const int16x8_t vxi7 = vreinterpretq_s16_u16(vmovl_u8(vi7));
+      vaccX1_lo = vmlal_s16(vaccX1_lo, vget_low_s16(vxk7), vget_low_s16(vxi7));
+      vaccX1_hi = vmlal_s16(vaccX1_hi, vget_high_s16(vxk7), vget_high_s16(vxi7));
+
+      const uint8x8_t vk8 = vld1_u8(w);
+      const uint8x8_t vi8 = vld1_u8(i8);
+      const int16x8_t vxk8 = vreinterpretq_s16_u16(vsubl_u8(vk8, vkernel_zero_point));
+      const int16x8_t vxi8 = vreinterpretq_s16_u16(vmovl_u8(vi8));
+      vaccX0_lo = vmlal_s16(vaccX0_lo, vget_low_s16(vxk8), vget_low_s16(vxi8));
+      vaccX0_hi = vmlal_s16(vaccX0_hi, vget_high_s16(vxk8), vget_high_s16(vxi8));
+
+      int32x4_t vacc_lo = vaddq_s32(vaccX0_lo, vaccX1_lo);
+      int32x4_t vacc_hi = vaddq_s32(vaccX0_hi, vaccX1_hi);
+
+      float32x4_t vfpacc_lo = vmulq_f32(vcvtq_f32_s32(vacc_lo), vscale_lo);
+      float32x4_t vfpacc_hi = vmulq_f32(vcvtq_f32_s32(vacc_hi), vscale_hi);
+
+      vfpacc_lo = vminq_f32(vmaxq_f32(vfpacc_lo, voutput_min_less_zero_point), voutput_max_less_zero_point);
+      vfpacc_hi = vminq_f32(vmaxq_f32(vfpacc_hi, voutput_min_less_zero_point), voutput_max_less_zero_point);
+
+      vacc_lo = vsubq_s32(vreinterpretq_s32_f32(vaddq_f32(vfpacc_lo, vmagic_bias)), vmagic_bias_less_output_zero_point);
+      vacc_hi = vsubq_s32(vreinterpretq_s32_f32(vaddq_f32(vfpacc_hi, vmagic_bias)), vmagic_bias_less_output_zero_point);
+
+      const int16x8_t vacc = vcombine_s16(vmovn_s32(vacc_lo), vmovn_s32(vacc_hi));
+      uint8x8_t vout = vqmovun_s16(vacc);
+
+      if (c & 4) {
+        vst1_lane_u32(__builtin_assume_aligned(output, 1), vreinterpret_u32_u8(vout), 0); output += 4;
+        vout = vext_u8(vout, vout, 4);
+      }
+      if (c & 2) {
+        vst1_lane_u16(__builtin_assume_aligned(output, 1), vreinterpret_u16_u8(vout), 0); output += 2;
+        vout = vext_u8(vout, vout, 2);
+      }
+      if (c & 1) {
+        vst1_lane_u8(__builtin_assume_aligned(output, 1), vout, 0); output++;
+      }
+    }
+
+    output = (uint8_t*) ((uintptr_t) output + output_increment);
+  } while (--output_width != 0);
+}
@@ -0,0 +1,121 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <fp16/bitcasts.h>
+
+#include <xnnpack/gemm.h>
+#include <xnnpack/math.h>
+
+
+void xnn_q8c_gemm_ukernel_2x2__scalar(
+    size_t mr,
+    size_t nc,
+    size_t kc,
+    const uint8_t* restrict a,
+    size_t a_stride,
+    const void* restrict w,
+    uint8_t* restrict c,
+    size_t cm_stride,
+    size_t cn_stride,
+    const union xnn_q8c_gemm_params params[restrict static 1])
+{
+  assert(mr != 0);
+  assert(mr <= 2);
+  assert(nc != 0);
+  assert(kc != 0);
+
+  const uint8_t* a0 = a;
+  uint8_t* c0 = c;
+  const uint8_t* a1 = (const uint8_t*) ((uintptr_t) a0 + a_stride);
+  uint8_t* c1 = (uint8_t*) ((uintptr_t) c0 + cm_stride);
+  if (mr != 2) {
+    a1 = a0;
+    c1 = c0;
+  }
+
+  const int32_t vb_zero_point = params->scalar.kernel_zero_point;
+
+  do {
+    int32_t vacc0x0 = ((const int32_t*) w)[0];
+    int32_t vacc0x1 = ((const int32_t*) w)[1];
+    int32_t vacc1x0 = vacc0x0;
+    int32_t vacc1x1 = vacc0x1;
+    const float vscale0 = ((const float*) w)[2];
+    const float vscale1 = ((const float*) w)[3];
+    w = (const void*) ((uintptr_t) w + 2 * sizeof(int32_t) + 2 * sizeof(float));
+
+    size_t k = kc;
+    do {
+      const int32_t va0 = (int32_t) (uint32_t) *a0++;
+      const int32_t va1 = (int32_t) (uint32_t) *a1++;
+
+      const uint32_t vb0 = ((const uint8_t*) w)[0];
+      const uint32_t vb1 = ((const uint8_t*) w)[1];
+      w = (const void*) ((uintptr_t) w + 2 * sizeof(uint8_t));
+
+      const int32_t vxb0 = (int32_t) vb0 - vb_zero_point;
+      const int32_t vxb1 = (int32_t) vb1 - vb_zero_point;
+
+      vacc0x0 += va0 * vxb0;
+      vacc0x1 += va0 * vxb1;
+      vacc1x0 += va1 * vxb0;
+      vacc1x1 += va1 * vxb1;
+
+      k -= sizeof(uint8_t);
+    } while (k != 0);
+
+    float vfpacc0x0 = (float) vacc0x0 * vscale0;
+    float vfpacc0x1 = (float) vacc0x1 * vscale1;
+    float vfpacc1x0 = (float) vacc1x0 * vscale0;
+    float vfpacc1x1 = (float) vacc1x1 * vscale1;
+
+    const float voutput_min_less_zero_point = params->scalar.output_min_less_zero_point;
+    vfpacc0x0 = math_max_f32(vfpacc0x0, voutput_min_less_zero_point);
+    vfpacc0x1 = math_max_f32(vfpacc0x1, voutput_min_less_zero_point);
+    vfpacc1x0 = math_max_f32(vfpacc1x0, voutput_min_less_zero_point);
+    vfpacc1x1 = math_max_f32(vfpacc1x1, voutput_min_less_zero_point);
+
+    const float voutput_max_less_zero_point = params->scalar.output_max_less_zero_point;
+    vfpacc0x0 = math_min_f32(vfpacc0x0, voutput_max_less_zero_point);
+    vfpacc0x1 = math_min_f32(vfpacc0x1, voutput_max_less_zero_point);
+    vfpacc1x0 = math_min_f32(vfpacc1x0, voutput_max_less_zero_point);
+    vfpacc1x1 = math_min_f32(vfpacc1x1, voutput_max_less_zero_point);
+
+    // Round to nearest-even integer with the "magic bias" trick, and add output zero point in the same subtraction.
+    const float vmagic_bias = params->scalar.magic_bias;
+    vfpacc0x0 += vmagic_bias;
+    vfpacc0x1 += vmagic_bias;
+    vfpacc1x0 += vmagic_bias;
+    vfpacc1x1 += vmagic_bias;
+
+    const int32_t vmagic_bias_less_output_zero_point = params->scalar.magic_bias_less_output_zero_point;
+    const int32_t vout0x0 = (int32_t) fp32_to_bits(vfpacc0x0) - vmagic_bias_less_output_zero_point;
+    const int32_t vout0x1 = (int32_t) fp32_to_bits(vfpacc0x1) - vmagic_bias_less_output_zero_point;
+    const int32_t vout1x0 = (int32_t) fp32_to_bits(vfpacc1x0) - vmagic_bias_less_output_zero_point;
+    const int32_t vout1x1 = (int32_t) fp32_to_bits(vfpacc1x1) - vmagic_bias_less_output_zero_point;
+
+    if XNN_LIKELY(nc >= 2) {
+      c0[0] = (uint8_t) vout0x0;
+      c0[1] = (uint8_t) vout0x1;
+      c1[0] = (uint8_t) vout1x0;
+      c1[1] = (uint8_t) vout1x1;
+
+      a0 = (const uint8_t*) ((uintptr_t) a0 - kc);
+      a1 = (const uint8_t*) ((uintptr_t) a1 - kc);
+
+      c0 = (uint8_t*) ((uintptr_t) c0 + cn_stride);
+      c1 = (uint8_t*) ((uintptr_t) c1 + cn_stride);
+
+      nc -= 2;
+    } else {
+      c0[0] = (uint8_t) vout0x0;
+      c1[0] = (uint8_t) vout1x0;
+
+      nc = 0;
+    }
+  } while (nc != 0);
+}
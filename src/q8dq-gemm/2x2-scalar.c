@@ -0,0 +1,109 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xnnpack/gemm.h>
+#include <xnnpack/math.h>
+
+
+void xnn_q8dq_gemm_ukernel_2x2__scalar(
+    size_t mr,
+    size_t nc,
+    size_t kc,
+    const uint8_t* restrict a,
+    size_t a_stride,
+    const void* restrict w,
+    float* restrict c,
+    size_t cm_stride,
+    size_t cn_stride,
+    const float* restrict scale,
+    const union xnn_q8dq_gemm_params params[restrict static 1])
+{
+  assert(mr != 0);
+  assert(mr <= 2);
+  assert(nc != 0);
+  assert(kc != 0);
+
+  const uint8_t* a0 = a;
+  float* c0 = c;
+  const uint8_t* a1 = (const uint8_t*) ((uintptr_t) a0 + a_stride);
+  float* c1 = (float*) ((uintptr_t) c0 + cm_stride);
+  if (mr != 2) {
+    a1 = a0;
+    c1 = c0;
+  }
+
+  const int32_t vb_zero_point = params->scalar.kernel_zero_point;
+  const float vscale0 = scale[0];
+  const float vscale1 = scale[mr - 1];
+
+  do {
+    int32_t vacc0x0 = ((const int32_t*) w)[0];
+    int32_t vacc0x1 = ((const int32_t*) w)[1];
+    int32_t vacc1x0 = vacc0x0;
+    int32_t vacc1x1 = vacc0x1;
+    const float vbias0 = ((const float*) w)[2];
+    const float vbias1 = ((const float*) w)[3];
+    w = (const void*) ((uintptr_t) w + 2 * sizeof(int32_t) + 2 * sizeof(float));
+
+    size_t k = kc;
+    do {
+      const int32_t va0 = (int32_t) (uint32_t) *a0++;
+      const int32_t va1 = (int32_t) (uint32_t) *a1++;
+
+      const uint32_t vb0 = ((const uint8_t*) w)[0];
+      const uint32_t vb1 = ((const uint8_t*) w)[1];
+      w = (const void*) ((uintptr_t) w + 2 * sizeof(uint8_t));
+
+      const int32_t vxb0 = (int32_t) vb0 - vb_zero_point;
+      const int32_t vxb1 = (int32_t) vb1 - vb_zero_point;
+
+      vacc0x0 += va0 * vxb0;
+      vacc0x1 += va0 * vxb1;
+      vacc1x0 += va1 * vxb0;
+      vacc1x1 += va1 * vxb1;
+
+      k -= sizeof(uint8_t);
+    } while (k != 0);
+
+    float vout0x0 = (float) vacc0x0 * vscale0 + vbias0;
+    float vout0x1 = (float) vacc0x1 * vscale0 + vbias1;
+    float vout1x0 = (float) vacc1x0 * vscale1 + vbias0;
+    float vout1x1 = (float) vacc1x1 * vscale1 + vbias1;
+
+    const float voutput_min = params->scalar.output_min;
+    vout0x0 = math_max_f32(vout0x0, voutput_min);
+    vout0x1 = math_max_f32(vout0x1, voutput_min);
+    vout1x0 = math_max_f32(vout1x0, voutput_min);
+    vout1x1 = math_max_f32(vout1x1, voutput_min);
+
+    const float voutput_max = params->scalar.output_max;
+    vout0x0 = math_min_f32(vout0x0, voutput_max);
+    vout0x1 = math_min_f32(vout0x1, voutput_max);
+    vout1x0 = math_min_f32(vout1x0, voutput_max);
+    vout1x1 = math_min_f32(vout1x1, voutput_max);
+
+    if XNN_LIKELY(nc >= 2) {
+      c0[0] = vout0x0;
+      c0[1] = vout0x1;
+      c1[0] = vout1x0;
+      c1[1] = vout1x1;
+
+      a0 = (const uint8_t*) ((uintptr_t) a0 - kc);
+      a1 = (const uint8_t*) ((uintptr_t) a1 - kc);
+
+      c0 = (float*) ((uintptr_t) c0 + cn_stride);
+      c1 = (float*) ((uintptr_t) c1 + cn_stride);
+
+      nc -= 2;
+    } else {
+      c0[0] = vout0x0;
+      c1[0] = vout1x0;
+
+      nc = 0;
+    }
+  } while (nc != 0);
+}
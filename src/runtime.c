@@ -0,0 +1,465 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <xnnpack.h>
+#include <xnnpack/allocator.h>
+#include <xnnpack/log.h>
+#include <xnnpack/memory-planner.h>
+#include <xnnpack/params.h>
+#include <xnnpack/subgraph.h>
+
+
+static enum xnn_status create_operator(
+    const struct xnn_subgraph* subgraph,
+    const struct xnn_node* node,
+    struct xnn_operator_data* opdata)
+{
+  const struct xnn_value* values = subgraph->values;
+  const struct xnn_shape* input_shape = &values[node->inputs[0]].shape;
+  const float output_min = node->activation.output_min;
+  const float output_max = node->activation.output_max;
+  enum xnn_status status = xnn_status_invalid_parameter;
+  switch (node->type) {
+    case xnn_node_type_convolution_2d:
+    {
+      const size_t input_channels = node->params.convolution_2d.groups * node->params.convolution_2d.group_input_channels;
+      const size_t output_channels = node->params.convolution_2d.groups * node->params.convolution_2d.group_output_channels;
+      status = xnn_create_convolution2d_nhwc_f32(
+        node->params.convolution_2d.input_padding_top,
+        node->params.convolution_2d.input_padding_right,
+        node->params.convolution_2d.input_padding_bottom,
+        node->params.convolution_2d.input_padding_left,
+        node->params.convolution_2d.kernel_height,
+        node->params.convolution_2d.kernel_width,
+        node->params.convolution_2d.subsampling_height,
+        node->params.convolution_2d.subsampling_width,
+        node->params.convolution_2d.dilation_height,
+        node->params.convolution_2d.dilation_width,
+        node->params.convolution_2d.groups,
+        node->params.convolution_2d.group_input_channels,
+        node->params.convolution_2d.group_output_channels,
+        input_channels /* input pixel stride */,
+        output_channels /* output pixel stride */,
+        values[node->inputs[1]].data,
+        values[node->inputs[2]].data,
+        output_min, output_max,
+        0 /* flags */,
+        &opdata->op);
+      opdata->batch_size = input_shape->dim[0];
+      opdata->input_height = input_shape->dim[1];
+      opdata->input_width = input_shape->dim[2];
+      break;
+    }
+    case xnn_node_type_depthwise_convolution_2d:
+    {
+      const size_t channels =
+        node->params.depthwise_convolution_2d.input_channels * node->params.depthwise_convolution_2d.depth_multiplier;
+      status = xnn_create_convolution2d_nhwc_f32(
+        node->params.depthwise_convolution_2d.input_padding_top,
+        node->params.depthwise_convolution_2d.input_padding_right,
+        node->params.depthwise_convolution_2d.input_padding_bottom,
+        node->params.depthwise_convolution_2d.input_padding_left,
+        node->params.depthwise_convolution_2d.kernel_height,
+        node->params.depthwise_convolution_2d.kernel_width,
+        node->params.depthwise_convolution_2d.subsampling_height,
+        node->params.depthwise_convolution_2d.subsampling_width,
+        node->params.depthwise_convolution_2d.dilation_height,
+        node->params.depthwise_convolution_2d.dilation_width,
+        node->params.depthwise_convolution_2d.input_channels /* groups */,
+        1 /* group input channels */,
+        node->params.depthwise_convolution_2d.depth_multiplier /* group output channels */,
+        node->params.depthwise_convolution_2d.input_channels /* input pixel stride */,
+        channels /* output pixel stride */,
+        values[node->inputs[1]].data,
+        values[node->inputs[2]].data,
+        output_min, output_max,
+        XNN_FLAG_DEPTHWISE_CONVOLUTION,
+        &opdata->op);
+      opdata->batch_size = input_shape->dim[0];
+      opdata->input_height = input_shape->dim[1];
+      opdata->input_width = input_shape->dim[2];
+      break;
+    }
+    case xnn_node_type_fully_connected:
+    {
+      const size_t output_channels = values[node->inputs[1]].shape.dim[0];
+      const size_t input_channels = values[node->inputs[1]].shape.dim[1];
+      status = xnn_create_fully_connected_nc_f32(
+        input_channels, output_channels,
+        input_channels /* input stride */, output_channels /* output stride */,
+        values[node->inputs[1]].data,
+        values[node->inputs[2]].data,
+        output_min, output_max,
+        0 /* flags */,
+        &opdata->op);
+      opdata->batch_size = xnn_shape_multiply_batch_dims(input_shape, 1);
+      break;
+    }
+    case xnn_node_type_average_pooling_2d:
+    {
+      const size_t channels = input_shape->dim[3];
+      status = xnn_create_average_pooling2d_nhwc_f32(
+        node->params.pooling_2d.input_padding_top,
+        node->params.pooling_2d.input_padding_right,
+        node->params.pooling_2d.input_padding_bottom,
+        node->params.pooling_2d.input_padding_left,
+        node->params.pooling_2d.pooling_height,
+        node->params.pooling_2d.pooling_width,
+        node->params.pooling_2d.stride_height,
+        node->params.pooling_2d.stride_width,
+        channels, channels /* input pixel stride */, channels /* output pixel stride */,
+        output_min, output_max,
+        0 /* flags */,
+        &opdata->op);
+      opdata->batch_size = input_shape->dim[0];
+      opdata->input_height = input_shape->dim[1];
+      opdata->input_width = input_shape->dim[2];
+      break;
+    }
+    case xnn_node_type_max_pooling_2d:
+    {
+      const size_t channels = input_shape->dim[3];
+      status = xnn_create_max_pooling2d_nhwc_f32(
+        node->params.pooling_2d.input_padding_top,
+        node->params.pooling_2d.input_padding_right,
+        node->params.pooling_2d.input_padding_bottom,
+        node->params.pooling_2d.input_padding_left,
+        node->params.pooling_2d.pooling_height,
+        node->params.pooling_2d.pooling_width,
+        node->params.pooling_2d.stride_height,
+        node->params.pooling_2d.stride_width,
+        node->params.pooling_2d.dilation_height,
+        node->params.pooling_2d.dilation_width,
+        channels, channels /* input pixel stride */, channels /* output pixel stride */,
+        output_min, output_max,
+        0 /* flags */,
+        &opdata->op);
+      opdata->batch_size = input_shape->dim[0];
+      opdata->input_height = input_shape->dim[1];
+      opdata->input_width = input_shape->dim[2];
+      break;
+    }
+    case xnn_node_type_global_average_pooling_2d:
+    {
+      const size_t channels = input_shape->dim[3];
+      status = xnn_create_global_average_pooling_nwc_f32(
+        channels, channels /* input stride */, channels /* output stride */,
+        output_min, output_max,
+        0 /* flags */,
+        &opdata->op);
+      opdata->batch_size = input_shape->dim[0];
+      opdata->input_width = input_shape->dim[1] * input_shape->dim[2];
+      break;
+    }
+    case xnn_node_type_add2:
+    {
+      const size_t channels = input_shape->num_dims == 0 ? 1 : input_shape->dim[input_shape->num_dims - 1];
+      status = xnn_create_add_nc_f32(
+        channels, channels /* a stride */, channels /* b stride */, channels /* sum stride */,
+        output_min, output_max,
+        0 /* flags */,
+        &opdata->op);
+      opdata->batch_size = xnn_shape_multiply_batch_dims(input_shape, 1);
+      break;
+    }
+    case xnn_node_type_clamp:
+    {
+      const size_t channels = input_shape->num_dims == 0 ? 1 : input_shape->dim[input_shape->num_dims - 1];
+      status = xnn_create_clamp_nc_f32(
+        channels, channels /* input stride */, channels /* output stride */,
+        output_min, output_max,
+        0 /* flags */,
+        &opdata->op);
+      opdata->batch_size = xnn_shape_multiply_batch_dims(input_shape, 1);
+      break;
+    }
+    case xnn_node_type_hardswish:
+    {
+      const size_t channels = input_shape->num_dims == 0 ? 1 : input_shape->dim[input_shape->num_dims - 1];
+      status = xnn_create_hardswish_nc_f32(
+        channels, channels /* input stride */, channels /* output stride */,
+        0 /* flags */,
+        &opdata->op);
+      opdata->batch_size = xnn_shape_multiply_batch_dims(input_shape, 1);
+      break;
+    }
+    case xnn_node_type_invalid:
+      xnn_log_error("failed to create operator for node #%" PRIu32 ": invalid node type", node->id);
+      break;
+  }
+  opdata->type = node->type;
+  for (uint32_t i = 0; i < node->num_inputs; i++) {
+    opdata->inputs[i] = node->inputs[i];
+  }
+  for (uint32_t o = 0; o < node->num_outputs; o++) {
+    opdata->outputs[o] = node->outputs[o];
+  }
+  return status;
+}
+
+enum xnn_status xnn_create_runtime(
+    xnn_subgraph_t subgraph,
+    pthreadpool_t threadpool,
+    uint32_t flags,
+    xnn_runtime_t* runtime_out)
+{
+  struct xnn_runtime* runtime = NULL;
+  struct xnn_value_allocation_tracker mem_alloc_tracker = { 0 };
+  enum xnn_status status = xnn_status_uninitialized;
+
+  if (!xnn_params.initialized) {
+    xnn_log_error("failed to create runtime: XNNPACK is not initialized");
+    goto error;
+  }
+
+  status = xnn_status_invalid_parameter;
+
+  // Nodes are executed in the order they were defined, so every Node input must be static, an external input, or
+  // produced by an earlier Node.
+  for (uint32_t n = 0; n < subgraph->num_nodes; n++) {
+    const struct xnn_node* node = &subgraph->nodes[n];
+    for (uint32_t i = 0; i < node->num_inputs; i++) {
+      const struct xnn_value* value = &subgraph->values[node->inputs[i]];
+      if (value->data == NULL && (value->flags & XNN_VALUE_FLAG_EXTERNAL_INPUT) == 0 && value->producer >= n) {
+        xnn_log_error(
+          "failed to create runtime: input value ID %" PRIu32 " of node #%" PRIu32 " is not produced by an earlier node",
+          value->id, n);
+        goto error;
+      }
+    }
+  }
+
+  status = xnn_status_out_of_memory;
+
+  runtime = xnn_allocate_zero_memory(sizeof(struct xnn_runtime));
+  if (runtime == NULL) {
+    xnn_log_error("failed to allocate %zu bytes for runtime descriptor", sizeof(struct xnn_runtime));
+    goto error;
+  }
+
+  if (subgraph->num_nodes != 0) {
+    runtime->ops = xnn_allocate_zero_memory(sizeof(struct xnn_operator_data) * subgraph->num_nodes);
+    if (runtime->ops == NULL) {
+      xnn_log_error("failed to allocate %zu bytes for opdata descriptors",
+        sizeof(struct xnn_operator_data) * subgraph->num_nodes);
+      goto error;
+    }
+  }
+  runtime->num_ops = subgraph->num_nodes;
+
+  for (uint32_t n = 0; n < subgraph->num_nodes; n++) {
+    status = create_operator(subgraph, &subgraph->nodes[n], &runtime->ops[n]);
+    if (status != xnn_status_success) {
+      goto error;
+    }
+  }
+
+  status = xnn_status_out_of_memory;
+
+  if (subgraph->num_values != 0) {
+    runtime->blobs = xnn_allocate_zero_memory(sizeof(struct xnn_blob) * subgraph->num_values);
+    if (runtime->blobs == NULL) {
+      xnn_log_error("failed to allocate %zu bytes for blob descriptors",
+        sizeof(struct xnn_blob) * subgraph->num_values);
+      goto error;
+    }
+  }
+  runtime->num_blobs = subgraph->num_values;
+
+  status = xnn_init_value_allocation_tracker(&mem_alloc_tracker, subgraph);
+  if (status != xnn_status_success) {
+    goto error;
+  }
+
+  for (uint32_t i = 0; i < subgraph->num_values; i++) {
+    const struct xnn_value* value = &subgraph->values[i];
+    struct xnn_blob* blob = &runtime->blobs[i];
+    if (value->type != xnn_value_type_dense_tensor) {
+      continue;
+    }
+
+    if (value->data != NULL) {
+      blob->data = (void*) value->data;
+    } else if ((value->flags & (XNN_VALUE_FLAG_EXTERNAL_INPUT | XNN_VALUE_FLAG_EXTERNAL_OUTPUT)) != 0) {
+      blob->external = true;
+      runtime->num_external_values += 1;
+    } else if (mem_alloc_tracker.usage[i].first_node != XNN_INVALID_NODE_ID) {
+      blob->size = xnn_tensor_get_size(subgraph, i);
+      xnn_add_value_allocation_tracker(&mem_alloc_tracker, i, blob->size);
+    }
+  }
+
+  status = xnn_plan_value_allocation_tracker(&mem_alloc_tracker);
+  if (status != xnn_status_success) {
+    goto error;
+  }
+
+  if (mem_alloc_tracker.mem_arena_size != 0) {
+    // Operators may read (but never write) XNN_EXTRA_BYTES beyond the end of their inputs.
+    const size_t workspace_size = mem_alloc_tracker.mem_arena_size + XNN_EXTRA_BYTES;
+    runtime->workspace = xnn_allocate_memory(workspace_size);
+    if (runtime->workspace == NULL) {
+      xnn_log_error("failed to allocate %zu bytes for runtime workspace", workspace_size);
+      goto error;
+    }
+    runtime->workspace_size = workspace_size;
+    for (uint32_t i = 0; i < subgraph->num_values; i++) {
+      struct xnn_blob* blob = &runtime->blobs[i];
+      if (blob->size != 0) {
+        blob->data = (void*) ((uintptr_t) runtime->workspace + mem_alloc_tracker.usage[i].alloc_offset);
+      }
+    }
+  }
+  xnn_release_value_allocation_tracker(&mem_alloc_tracker);
+
+  runtime->threadpool = threadpool;
+
+  *runtime_out = runtime;
+  return xnn_status_success;
+
+error:
+  xnn_release_value_allocation_tracker(&mem_alloc_tracker);
+  xnn_delete_runtime(runtime);
+  return status;
+}
+
+static enum xnn_status setup_operator(
+    const struct xnn_runtime* runtime,
+    const struct xnn_operator_data* opdata)
+{
+  const struct xnn_blob* blobs = runtime->blobs;
+  const void* input = blobs[opdata->inputs[0]].data;
+  void* output = blobs[opdata->outputs[0]].data;
+  switch (opdata->type) {
+    case xnn_node_type_convolution_2d:
+    case xnn_node_type_depthwise_convolution_2d:
+      return xnn_setup_convolution2d_nhwc_f32(
+        opdata->op,
+        opdata->batch_size, opdata->input_height, opdata->input_width,
+        input, output,
+        runtime->threadpool);
+    case xnn_node_type_fully_connected:
+      return xnn_setup_fully_connected_nc_f32(
+        opdata->op,
+        opdata->batch_size,
+        input, output,
+        runtime->threadpool);
+    case xnn_node_type_average_pooling_2d:
+      return xnn_setup_average_pooling2d_nhwc_f32(
+        opdata->op,
+        opdata->batch_size, opdata->input_height, opdata->input_width,
+        input, output,
+        runtime->threadpool);
+    case xnn_node_type_max_pooling_2d:
+      return xnn_setup_max_pooling2d_nhwc_f32(
+        opdata->op,
+        opdata->batch_size, opdata->input_height, opdata->input_width,
+        input, output,
+        runtime->threadpool);
+    case xnn_node_type_global_average_pooling_2d:
+      return xnn_setup_global_average_pooling_nwc_f32(
+        opdata->op,
+        opdata->batch_size, opdata->input_width,
+        input, output,
+        runtime->threadpool);
+    case xnn_node_type_add2:
+      return xnn_setup_add_nc_f32(
+        opdata->op,
+        opdata->batch_size,
+        input, blobs[opdata->inputs[1]].data, output,
+        runtime->threadpool);
+    case xnn_node_type_clamp:
+      return xnn_setup_clamp_nc_f32(
+        opdata->op,
+        opdata->batch_size,
+        input, output,
+        runtime->threadpool);
+    case xnn_node_type_hardswish:
+      return xnn_setup_hardswish_nc_f32(
+        opdata->op,
+        opdata->batch_size,
+        input, output,
+        runtime->threadpool);
+    case xnn_node_type_invalid:
+      break;
+  }
+  return xnn_status_invalid_parameter;
+}
+
+enum xnn_status xnn_setup_runtime(
+    xnn_runtime_t runtime,
+    size_t num_external_values,
+    const struct xnn_external_value* external_values)
+{
+  if (num_external_values != runtime->num_external_values) {
+    xnn_log_error("failed to setup runtime: %zu external values specified, but the runtime has %" PRIu32,
+      num_external_values, runtime->num_external_values);
+    return xnn_status_invalid_parameter;
+  }
+
+  // Validate inputs without changing internal state.
+  // This ensures that runtime stays in consistent state in case validation fails midway.
+  for (size_t i = 0; i < num_external_values; i++) {
+    const struct xnn_external_value* external_value = &external_values[i];
+    const uint32_t value_id = external_value->id;
+    if (value_id >= runtime->num_blobs || !runtime->blobs[value_id].external) {
+      xnn_log_error("failed to setup runtime: value ID %" PRIu32 " is not an external value", value_id);
+      return xnn_status_invalid_parameter;
+    }
+    if (external_value->data == NULL) {
+      xnn_log_error("failed to setup runtime: no data pointer for external value ID %" PRIu32, value_id);
+      return xnn_status_invalid_parameter;
+    }
+  }
+
+  for (size_t i = 0; i < num_external_values; i++) {
+    const struct xnn_external_value* external_value = &external_values[i];
+    runtime->blobs[external_value->id].data = external_value->data;
+  }
+
+  for (size_t i = 0; i < runtime->num_ops; i++) {
+    const enum xnn_status status = setup_operator(runtime, &runtime->ops[i]);
+    if (status != xnn_status_success) {
+      xnn_log_error("failed to setup runtime: error in operator #%zu", i);
+      return status;
+    }
+  }
+
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_invoke_runtime(
+    xnn_runtime_t runtime)
+{
+  for (size_t i = 0; i < runtime->num_ops; i++) {
+    const enum xnn_status status = xnn_run_operator(runtime->ops[i].op, runtime->threadpool);
+    if (status != xnn_status_success) {
+      return status;
+    }
+  }
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_delete_runtime(
+    xnn_runtime_t runtime)
+{
+  if (runtime != NULL) {
+    if (runtime->ops != NULL) {
+      for (size_t i = 0; i < runtime->num_ops; i++) {
+        xnn_delete_operator(runtime->ops[i].op);
+      }
+      xnn_release_memory(runtime->ops);
+    }
+    xnn_release_memory(runtime->blobs);
+    xnn_release_memory(runtime->workspace);
+    xnn_release_memory(runtime);
+  }
+  return xnn_status_success;
+}
@@ -0,0 +1,143 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <xnnpack.h>
+#include <xnnpack/allocator.h>
+#include <xnnpack/log.h>
+#include <xnnpack/operator.h>
+#include <xnnpack/params.h>
+#include <xnnpack/shape-cache.h>
+
+
+static void stash_current_shape(xnn_operator_t op) {
+  struct xnn_shape_cache* shape_cache = &op->shape_cache;
+
+  struct xnn_shape_cache_entry* entry = NULL;
+  if (shape_cache->num_entries < shape_cache->max_entries) {
+    entry = &shape_cache->entries[shape_cache->num_entries++];
+  } else {
+    // Evict the least recently used shape.
+    entry = &shape_cache->entries[0];
+    for (size_t i = 1; i < shape_cache->num_entries; i++) {
+      if (shape_cache->entries[i].last_use < entry->last_use) {
+        entry = &shape_cache->entries[i];
+      }
+    }
+    free(entry->indirection_buffer);
+  }
+
+  *entry = (struct xnn_shape_cache_entry) {
+    .input_height = op->last_input_height,
+    .input_width = op->last_input_width,
+    .indirection_buffer = op->indirection_buffer,
+    .last_input = op->last_input,
+    .valid_batch_size = op->valid_batch_size,
+    .plan_batch_size = shape_cache->plan_batch_size,
+    .plan_num_threads = shape_cache->plan_num_threads,
+    .compute = op->compute,
+    .last_use = ++shape_cache->use_counter,
+  };
+  op->indirection_buffer = NULL;
+}
+
+bool xnn_switch_operator_shape(
+    xnn_operator_t op,
+    size_t input_height,
+    size_t input_width)
+{
+  struct xnn_shape_cache* shape_cache = &op->shape_cache;
+
+  // Look up the new shape before stashing the current one: taking the entry out of the cache frees a slot, so stashing
+  // never evicts the shape that is about to be restored.
+  struct xnn_shape_cache_entry cached_entry;
+  bool found = false;
+  for (size_t i = 0; i < shape_cache->num_entries; i++) {
+    struct xnn_shape_cache_entry* entry = &shape_cache->entries[i];
+    if (entry->input_height == input_height && entry->input_width == input_width) {
+      cached_entry = *entry;
+      *entry = shape_cache->entries[--shape_cache->num_entries];
+      found = true;
+      break;
+    }
+  }
+
+  if (shape_cache->max_entries != 0 && op->indirection_buffer != NULL && op->last_input_height != 0) {
+    stash_current_shape(op);
+  }
+
+  if (found) {
+    // Ownership of the indirection buffer moves back to the operator.
+    op->indirection_buffer = cached_entry.indirection_buffer;
+    op->last_input = cached_entry.last_input;
+    op->last_input_height = input_height;
+    op->last_input_width = input_width;
+    op->valid_batch_size = cached_entry.valid_batch_size;
+    op->compute = cached_entry.compute;
+    shape_cache->plan_batch_size = cached_entry.plan_batch_size;
+    shape_cache->plan_num_threads = cached_entry.plan_num_threads;
+    return true;
+  }
+
+  op->last_input = NULL;
+  op->last_input_height = 0;
+  op->last_input_width = 0;
+  op->valid_batch_size = 0;
+  shape_cache->plan_batch_size = 0;
+  shape_cache->plan_num_threads = 0;
+  return false;
+}
+
+void xnn_release_shape_cache(
+    struct xnn_shape_cache* shape_cache)
+{
+  for (size_t i = 0; i < shape_cache->num_entries; i++) {
+    free(shape_cache->entries[i].indirection_buffer);
+  }
+  xnn_release_memory(shape_cache->entries);
+  shape_cache->entries = NULL;
+  shape_cache->num_entries = 0;
+  shape_cache->max_entries = 0;
+}
+
+enum xnn_status xnn_enable_operator_shape_cache(
+    xnn_operator_t op,
+    size_t max_shapes)
+{
+  if (!xnn_params.initialized) {
+    xnn_log_error("failed to enable operator shape cache: XNNPACK is not initialized");
+    return xnn_status_uninitialized;
+  }
+
+  switch (op->type) {
+    case xnn_operator_type_convolution_f16:
+    case xnn_operator_type_convolution_f32:
+    case xnn_operator_type_convolution_q8:
+    case xnn_operator_type_convolution_q8c:
+      break;
+    default:
+      xnn_log_error("failed to enable shape cache for operator type %d: shape cache is supported only for Convolution",
+        op->type);
+      return xnn_status_unsupported_parameter;
+  }
+
+  xnn_release_shape_cache(&op->shape_cache);
+  if (max_shapes == 0) {
+    return xnn_status_success;
+  }
+
+  const size_t entries_size = sizeof(struct xnn_shape_cache_entry) * max_shapes;
+  op->shape_cache.entries = xnn_allocate_zero_memory(entries_size);
+  if (op->shape_cache.entries == NULL) {
+    xnn_log_error("failed to allocate %zu bytes for shape cache", entries_size);
+    return xnn_status_out_of_memory;
+  }
+  op->shape_cache.max_entries = max_shapes;
+  return xnn_status_success;
+}
@@ -16,6 +16,7 @@
 #include <xnnpack/allocator.h>
 #include <xnnpack/operator.h>
 #include <xnnpack/log.h>
+#include <xnnpack/requantization.h>
 
 
 enum xnn_status xnn_create_softargmax_nc_q8(
@@ -173,3 +174,113 @@ enum xnn_status xnn_setup_softargmax_nc_q8(
 
   return xnn_status_success;
 }
+
+enum xnn_status xnn_create_softmax_nc_f32(
+    size_t channels,
+    size_t input_stride,
+    size_t output_stride,
+    uint32_t flags,
+    xnn_operator_t* softmax_op_out)
+{
+  xnn_operator_t softmax_op = NULL;
+  enum xnn_status status = xnn_status_uninitialized;
+
+  if (!xnn_params.initialized) {
+    xnn_log_error("failed to create SoftMax operator: XNNPACK is not initialized");
+    goto error;
+  }
+
+  status = xnn_status_invalid_parameter;
+
+  if (channels == 0) {
+    xnn_log_error(
+      "failed to create SoftMax operator with %zu channels: number of channels must be non-zero", channels);
+    goto error;
+  }
+
+  if (input_stride < channels) {
+    xnn_log_error(
+      "failed to create SoftMax operator with input element stride of %zu: "
+      "stride must be at least as large as the number of channels (%zu)",
+      input_stride, channels);
+    goto error;
+  }
+
+  if (output_stride < channels) {
+    xnn_log_error(
+      "failed to create SoftMax operator with output element stride of %zu: "
+      "stride must be at least as large as the number of channels (%zu)",
+      output_stride, channels);
+    goto error;
+  }
+
+  status = xnn_status_out_of_memory;
+
+  softmax_op = xnn_allocate_zero_memory(sizeof(struct xnn_operator));
+  if (softmax_op == NULL) {
+    xnn_log_error("failed to allocate %zu bytes for SoftMax operator descriptor", sizeof(struct xnn_operator));
+    goto error;
+  }
+
+  softmax_op->channels = channels;
+  softmax_op->input_pixel_stride = input_stride;
+  softmax_op->output_pixel_stride = output_stride;
+
+  softmax_op->type = xnn_operator_type_softmax_f32;
+  softmax_op->ukernel.type = xnn_ukernel_type_softargmax;
+
+  softmax_op->state = xnn_run_state_invalid;
+
+  *softmax_op_out = softmax_op;
+  return xnn_status_success;
+
+error:
+  xnn_delete_operator(softmax_op);
+  return status;
+}
+
+enum xnn_status xnn_setup_softmax_nc_f32(
+    xnn_operator_t softmax_op,
+    size_t batch_size,
+    const float* input,
+    float* output,
+    pthreadpool_t threadpool)
+{
+  if (softmax_op->type != xnn_operator_type_softmax_f32) {
+    xnn_log_error("failed to setup SoftMax (F32) operator: operator type mismatch");
+    return xnn_status_invalid_parameter;
+  }
+  softmax_op->state = xnn_run_state_invalid;
+
+  if (!xnn_params.initialized) {
+    xnn_log_error("failed to setup SoftMax operator: XNNPACK is not initialized");
+    return xnn_status_uninitialized;
+  }
+
+  if (batch_size == 0) {
+    softmax_op->state = xnn_run_state_skip;
+    return xnn_status_success;
+  }
+
+  softmax_op->batch_size = batch_size;
+  softmax_op->input = input;
+  softmax_op->output = output;
+
+  softmax_op->context.f32_softmax = (struct f32_softmax_context) {
+    .n = softmax_op->channels * sizeof(float),
+    .x = input,
+    .x_stride = softmax_op->input_pixel_stride * sizeof(float),
+    .y = output,
+    .y_stride = softmax_op->output_pixel_stride * sizeof(float),
+    .rmax_ukernel = xnn_params.f32.rmax,
+    .raddstoreexpminusmax_ukernel = xnn_params.f32.raddstoreexpminusmax,
+    .vmulc_ukernel = xnn_params.f32.vmul.opc_ukernel,
+    .params = xnn_compute_f32_output_params(-INFINITY, INFINITY),
+  };
+  softmax_op->compute.type = xnn_parallelization_type_1d;
+  softmax_op->compute.task_1d = (pthreadpool_task_1d_t) xnn_compute_f32_softmax;
+  softmax_op->compute.range[0] = batch_size;
+  softmax_op->state = xnn_run_state_ready;
+
+  return xnn_status_success;
+}
@@ -0,0 +1,298 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <xnnpack.h>
+#include <xnnpack/allocator.h>
+#include <xnnpack/log.h>
+#include <xnnpack/math.h>
+#include <xnnpack/operator.h>
+#include <xnnpack/params.h>
+#include <xnnpack/sparse-weights.h>
+
+
+// Grouped 1x1 Convolution is processed as a single SpMM with a block-diagonal
+// [groups * group_output_channels]x[groups * group_input_channels] kernel matrix.
+// A row of this matrix is non-zero only in the input channels of its group.
+struct kernel_row {
+  const float* elements;
+  size_t first_input_channel;
+};
+
+static inline struct kernel_row get_kernel_row(
+    const float* kernel,
+    size_t output_channel,
+    size_t group_input_channels,
+    size_t group_output_channels)
+{
+  const size_t group = output_channel / group_output_channels;
+  return (struct kernel_row) {
+    .elements = kernel + output_channel * group_input_channels,
+    .first_input_channel = group * group_input_channels,
+  };
+}
+
+static inline float get_row_element(
+    struct kernel_row row,
+    size_t input_channel,
+    size_t group_input_channels)
+{
+  const size_t group_input_channel = input_channel - row.first_input_channel;
+  return group_input_channel < group_input_channels ? row.elements[group_input_channel] : 0.0f;
+}
+
+// Scales the difference between input channels of successive non-zero blocks, and checks that it fits into int32_t.
+static inline bool compute_input_channel_diff(
+    size_t input_channel,
+    size_t last_input_channel,
+    size_t input_channel_stride,
+    int32_t* diff_out)
+{
+  const int64_t diff = (int64_t) ((uint64_t) input_channel - (uint64_t) last_input_channel) * (int64_t) input_channel_stride;
+  if (diff != (int64_t) (int32_t) diff) {
+    xnn_log_error("failed to convert kernel to sparse representation: "
+      "scaled difference in input channels exceeds int32_t range");
+    return false;
+  }
+  *diff_out = (int32_t) diff;
+  return true;
+}
+
+void xnn_init_f32_sparse_weights_layout(
+  size_t groups,
+  size_t group_output_channels,
+  size_t group_input_channels,
+  const float* kernel,
+  struct xnn_sparse_weights_layout* layout)
+{
+  const size_t output_channels = groups * group_output_channels;
+  size_t num_nonzeroes = 0;
+  size_t num_nonzero_blocks2 = 0;
+  size_t num_nonzero_blocks4 = 0;
+  // Rows of a block belong to consecutive groups, so only the input channels of these groups can be non-zero.
+  for (size_t oc = 0; oc < round_down_po2(output_channels, 4); oc += 4) {
+    const struct kernel_row row0 = get_kernel_row(kernel, oc, group_input_channels, group_output_channels);
+    const struct kernel_row row1 = get_kernel_row(kernel, oc + 1, group_input_channels, group_output_channels);
+    const struct kernel_row row2 = get_kernel_row(kernel, oc + 2, group_input_channels, group_output_channels);
+    const struct kernel_row row3 = get_kernel_row(kernel, oc + 3, group_input_channels, group_output_channels);
+    for (size_t ic = row0.first_input_channel; ic < row3.first_input_channel + group_input_channels; ic++) {
+      const size_t row0_nonzero = (size_t) (get_row_element(row0, ic, group_input_channels) != 0.0f);
+      const size_t row1_nonzero = (size_t) (get_row_element(row1, ic, group_input_channels) != 0.0f);
+      const size_t row2_nonzero = (size_t) (get_row_element(row2, ic, group_input_channels) != 0.0f);
+      const size_t row3_nonzero = (size_t) (get_row_element(row3, ic, group_input_channels) != 0.0f);
+      num_nonzeroes += row0_nonzero + row1_nonzero + row2_nonzero + row3_nonzero;
+      num_nonzero_blocks2 += (row0_nonzero | row1_nonzero) + (row2_nonzero | row3_nonzero);
+      num_nonzero_blocks4 += (row0_nonzero | row1_nonzero | row2_nonzero | row3_nonzero);
+    }
+  }
+  const size_t num_block4_nonzeroes = num_nonzeroes;
+  for (size_t oc = round_down_po2(output_channels, 4); oc < round_down_po2(output_channels, 2); oc += 2) {
+    const struct kernel_row row0 = get_kernel_row(kernel, oc, group_input_channels, group_output_channels);
+    const struct kernel_row row1 = get_kernel_row(kernel, oc + 1, group_input_channels, group_output_channels);
+    for (size_t ic = row0.first_input_channel; ic < row1.first_input_channel + group_input_channels; ic++) {
+      const size_t row0_nonzero = (size_t) (get_row_element(row0, ic, group_input_channels) != 0.0f);
+      const size_t row1_nonzero = (size_t) (get_row_element(row1, ic, group_input_channels) != 0.0f);
+      num_nonzeroes += row0_nonzero + row1_nonzero;
+      num_nonzero_blocks2 += (row0_nonzero | row1_nonzero);
+    }
+  }
+  const size_t num_block2_nonzeroes = num_nonzeroes;
+  for (size_t oc = round_down_po2(output_channels, 2); oc < output_channels; oc++) {
+    const float* row = kernel + oc * group_input_channels;
+    for (size_t group_input_channel = 0; group_input_channel < group_input_channels; group_input_channel++) {
+      num_nonzeroes += (size_t) (row[group_input_channel] != 0.0f);
+    }
+  }
+
+  layout->spmm_parameters = &xnn_params.f32.spmm;
+  layout->output_channels_block_size = 1;
+  layout->num_output_channel_blocks = output_channels;
+  layout->num_nonzeroes = num_nonzeroes;
+  layout->num_nonzero_values = num_nonzeroes;
+  layout->num_nonzero_blocks = num_nonzeroes;
+  if (num_block4_nonzeroes * 5 >= num_nonzero_blocks4 * 18 && xnn_params.f32.spmm4.ukernel != NULL) {
+    // 4-channel blocks have 90%+ non-zeroes
+
+    layout->spmm_parameters = &xnn_params.f32.spmm4;
+    layout->output_channels_block_size = 4;
+    layout->num_output_channel_blocks = output_channels / 4 + output_channels % 4;
+    // Non-zeroes which don't fit into whole 4-channel blocks, processed one-by-one
+    const size_t num_remaining_nonzeroes = num_nonzeroes - num_block4_nonzeroes;
+    layout->num_nonzero_values = num_nonzero_blocks4 * 4 + num_remaining_nonzeroes;
+    layout->num_nonzero_blocks = num_nonzero_blocks4 + num_remaining_nonzeroes;
+  } else if (num_block2_nonzeroes * 5 >= num_nonzero_blocks2 * 9 && xnn_params.f32.spmm2.ukernel != NULL) {
+    // 2-channel blocks have 90%+ non-zeroes
+
+    layout->spmm_parameters = &xnn_params.f32.spmm2;
+    layout->output_channels_block_size = 2;
+    layout->num_output_channel_blocks = output_channels / 2 + output_channels % 2;
+    // Non-zeroes which don't fit into whole 2-channel blocks, processed one-by-one
+    const size_t num_remaining_nonzeroes = num_nonzeroes - num_block2_nonzeroes;
+    layout->num_nonzero_values = num_nonzero_blocks2 * 2 + num_remaining_nonzeroes;
+    layout->num_nonzero_blocks = num_nonzero_blocks2 + num_remaining_nonzeroes;
+  }
+}
+
+enum xnn_status xnn_pack_f32_sparse_weights(
+  size_t groups,
+  size_t group_output_channels,
+  size_t group_input_channels,
+  const float* kernel,
+  const float* bias,
+  const struct xnn_sparse_weights_layout* layout,
+  size_t input_channel_stride,
+  float* nonzero_values,
+  uint32_t* output_channel_nonzeros,
+  int32_t* input_channel_diffs,
+  size_t* first_input_channel_out)
+{
+  const size_t output_channels = groups * group_output_channels;
+  const size_t output_channels_block_size = layout->output_channels_block_size;
+  memset(output_channel_nonzeros, 0, layout->num_output_channel_blocks * sizeof(uint32_t));
+
+  size_t first_ic = 0, last_ic = 0;
+  bool first_nonzero = true;
+  assert(output_channels_block_size <= 4);
+  for (size_t ocb = 0; ocb < round_down_po2(output_channels, output_channels_block_size); ocb += output_channels_block_size) {
+    struct kernel_row rows[4];
+    for (size_t oco = 0; oco < output_channels_block_size; oco++) {
+      rows[oco] = get_kernel_row(kernel, ocb + oco, group_input_channels, group_output_channels);
+      *nonzero_values++ = bias[ocb + oco];
+    }
+    const size_t ic_end = rows[output_channels_block_size - 1].first_input_channel + group_input_channels;
+    for (size_t ic = rows[0].first_input_channel; ic < ic_end; ic++) {
+      bool is_nonzero_block = false;
+      for (size_t oco = 0; oco < output_channels_block_size; oco++) {
+        is_nonzero_block |= (get_row_element(rows[oco], ic, group_input_channels) != 0.0f);
+      }
+      if (is_nonzero_block) {
+        for (size_t oco = 0; oco < output_channels_block_size; oco++) {
+          *nonzero_values++ = get_row_element(rows[oco], ic, group_input_channels);
+        }
+        if (first_nonzero) {
+          first_ic = ic;
+        } else if (!compute_input_channel_diff(ic, last_ic, input_channel_stride, input_channel_diffs++)) {
+          return xnn_status_unsupported_parameter;
+        }
+        first_nonzero = false;
+        last_ic = ic;
+        *output_channel_nonzeros += 1;
+      }
+    }
+    output_channel_nonzeros += 1;
+  }
+  for (size_t oc = round_down_po2(output_channels, output_channels_block_size); oc < output_channels; oc++) {
+    const struct kernel_row row = get_kernel_row(kernel, oc, group_input_channels, group_output_channels);
+    *nonzero_values++ = bias[oc];
+    for (size_t group_input_channel = 0; group_input_channel < group_input_channels; group_input_channel++) {
+      const float weight = row.elements[group_input_channel];
+      if (weight != 0.0f) {
+        const size_t ic = row.first_input_channel + group_input_channel;
+        *nonzero_values++ = weight;
+        if (first_nonzero) {
+          first_ic = ic;
+        } else if (!compute_input_channel_diff(ic, last_ic, input_channel_stride, input_channel_diffs++)) {
+          return xnn_status_unsupported_parameter;
+        }
+        first_nonzero = false;
+        last_ic = ic;
+        *output_channel_nonzeros += 1;
+      }
+    }
+    output_channel_nonzeros += 1;
+  }
+  // If there are any non-zero elements, we have to return to the initial input channel.
+  if (!first_nonzero && !compute_input_channel_diff(first_ic, last_ic, input_channel_stride, input_channel_diffs)) {
+    return xnn_status_unsupported_parameter;
+  }
+  *first_input_channel_out = first_ic;
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_init_operator_sparse_weights(
+  xnn_operator_t op,
+  size_t groups,
+  size_t group_output_channels,
+  size_t group_input_channels,
+  const float* kernel,
+  const float* bias)
+{
+  if (xnn_params.f32.spmm.ukernel == NULL) {
+    return xnn_status_success;
+  }
+
+  // GEMM multiplies only the diagonal blocks of the kernel matrix in grouped Convolution, which are stored contiguously
+  // in the kernel. Dense kernels are rejected as soon as their non-zeroes alone exceed the density threshold, without
+  // computing the blocked layout.
+  const size_t output_channels = groups * group_output_channels;
+  const size_t input_channels = groups * group_input_channels;
+  const size_t num_kernel_elements = output_channels * group_input_channels;
+  const size_t max_nonzero_values = num_kernel_elements * XNN_SPMM_MAX_DENSITY_PERCENT / 100;
+  size_t num_nonzeroes = 0;
+  for (size_t oc = 0; oc < output_channels; oc++) {
+    const float* row = kernel + oc * group_input_channels;
+    for (size_t group_input_channel = 0; group_input_channel < group_input_channels; group_input_channel++) {
+      num_nonzeroes += (size_t) (row[group_input_channel] != 0.0f);
+    }
+    if (num_nonzeroes > max_nonzero_values) {
+      return xnn_status_success;
+    }
+  }
+
+  struct xnn_sparse_weights_layout layout;
+  xnn_init_f32_sparse_weights_layout(groups, group_output_channels, group_input_channels, kernel, &layout);
+  if (layout.num_nonzero_values > max_nonzero_values) {
+    return xnn_status_success;
+  }
+
+  // SpMM micro-kernels read input rows transposed into panels of MR rows, and advance the input pointer by the
+  // difference in input channels multiplied by the panel stride.
+  const size_t mr = layout.spmm_parameters->mr;
+  const size_t input_channel_stride = mr * sizeof(float);
+  if (input_channels * input_channel_stride > (size_t) INT32_MAX) {
+    return xnn_status_success;
+  }
+
+  // Sparse representation of weights consists of three components:
+  // 1. An array of float values storing non-zero kernel elements, and all (output_channels) bias elements.
+  // 2. An array of int32_t values storing increment for input pointer after each processed non-zero block.
+  // 3. An array of uint32_t values storing the number of non-zero blocks per each block of output channels.
+  const size_t packed_weights_size = (layout.num_nonzero_values + output_channels) * sizeof(float) +
+    layout.num_nonzero_blocks * sizeof(int32_t) + layout.num_output_channel_blocks * sizeof(uint32_t);
+  float* nonzero_values = xnn_allocate_memory(packed_weights_size);
+  if (nonzero_values == NULL) {
+    xnn_log_error("failed to allocate %zu bytes for packed weights", packed_weights_size);
+    return xnn_status_out_of_memory;
+  }
+  int32_t* input_increments = (int32_t*) (nonzero_values + layout.num_nonzero_values + output_channels);
+  uint32_t* output_channel_nonzeros = (uint32_t*) (input_increments + layout.num_nonzero_blocks);
+
+  size_t first_input_channel = 0;
+  const enum xnn_status status = xnn_pack_f32_sparse_weights(
+    groups, group_output_channels, group_input_channels,
+    kernel, bias, &layout, input_channel_stride,
+    nonzero_values, output_channel_nonzeros, input_increments, &first_input_channel);
+  if (status != xnn_status_success) {
+    xnn_release_memory(nonzero_values);
+    return status;
+  }
+
+  op->packed_weights = nonzero_values;
+  op->num_nonzero_values = layout.num_nonzero_values;
+  op->num_nonzero_blocks = layout.num_nonzero_blocks;
+  op->num_output_channel_blocks = layout.num_output_channel_blocks;
+  op->first_input_channel = first_input_channel;
+  op->ukernel.type = xnn_ukernel_type_spmm;
+  op->ukernel.spmm = (struct xnn_ukernel_spmm) {
+    .function = layout.spmm_parameters->ukernel,
+    .mr = layout.spmm_parameters->mr,
+  };
+  return xnn_status_success;
+}
@@ -0,0 +1,950 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <xnnpack.h>
+#include <xnnpack/allocator.h>
+#include <xnnpack/log.h>
+#include <xnnpack/math.h>
+#include <xnnpack/params.h>
+#include <xnnpack/subgraph.h>
+
+
+enum xnn_status xnn_create_subgraph(
+    uint32_t external_value_ids,
+    uint32_t flags,
+    xnn_subgraph_t* subgraph_out)
+{
+  struct xnn_subgraph* subgraph = NULL;
+  enum xnn_status status = xnn_status_uninitialized;
+
+  if (!xnn_params.initialized) {
+    xnn_log_error("failed to create subgraph: XNNPACK is not initialized");
+    goto error;
+  }
+
+  status = xnn_status_out_of_memory;
+
+  subgraph = xnn_allocate_zero_memory(sizeof(struct xnn_subgraph));
+  if (subgraph == NULL) {
+    xnn_log_error("failed to allocate %zu bytes for subgraph descriptor", sizeof(struct xnn_subgraph));
+    goto error;
+  }
+
+  subgraph->external_value_ids = external_value_ids;
+  if (external_value_ids != 0) {
+    subgraph->values = xnn_allocate_zero_memory(external_value_ids * sizeof(struct xnn_value));
+    if (subgraph->values == NULL) {
+      xnn_log_error("failed to allocate %zu bytes for subgraph values", external_value_ids * sizeof(struct xnn_value));
+      goto error;
+    }
+    for (uint32_t i = 0; i < external_value_ids; i++) {
+      subgraph->values[i].id = i;
+      subgraph->values[i].producer = XNN_INVALID_NODE_ID;
+    }
+  }
+  subgraph->num_reserved_values = external_value_ids;
+  subgraph->num_values = external_value_ids;
+
+  *subgraph_out = subgraph;
+  return xnn_status_success;
+
+error:
+  xnn_delete_subgraph(subgraph);
+  return status;
+}
+
+struct xnn_value* xnn_subgraph_new_internal_value(xnn_subgraph_t subgraph)
+{
+  struct xnn_value* values = subgraph->values;
+  const size_t size = subgraph->num_values;
+  const size_t capacity = subgraph->num_reserved_values;
+  if (capacity < size + 1) {
+    const size_t new_capacity = max(min(capacity * 2, capacity + 512), capacity + 64);
+    assert(new_capacity >= size + 1);
+    values = xnn_allocate_zero_memory(new_capacity * sizeof(struct xnn_value));
+    if (values == NULL) {
+      xnn_log_error("failed to allocate %zu bytes for subgraph values", new_capacity * sizeof(struct xnn_value));
+      return values;
+    }
+
+    if (size != 0) {
+      memcpy(values, subgraph->values, size * sizeof(struct xnn_value));
+    }
+    xnn_release_memory(subgraph->values);
+    subgraph->values = values;
+    subgraph->num_reserved_values = new_capacity;
+  }
+  subgraph->num_values = size + 1;
+  struct xnn_value* new_value = values + size;
+  new_value->id = size;
+  new_value->producer = XNN_INVALID_NODE_ID;
+  return new_value;
+}
+
+struct xnn_node* xnn_subgraph_new_node(xnn_subgraph_t subgraph)
+{
+  struct xnn_node* nodes = subgraph->nodes;
+  const size_t size = subgraph->num_nodes;
+  const size_t capacity = subgraph->num_reserved_nodes;
+  if (capacity < size + 1) {
+    const size_t new_capacity = max(min(capacity * 2, capacity + 512), capacity + 64);
+    assert(new_capacity >= size + 1);
+    nodes = xnn_allocate_zero_memory(new_capacity * sizeof(struct xnn_node));
+    if (nodes == NULL) {
+      xnn_log_error("failed to allocate %zu bytes for subgraph nodes", new_capacity * sizeof(struct xnn_node));
+      return nodes;
+    }
+
+    if (size != 0) {
+      memcpy(nodes, subgraph->nodes, size * sizeof(struct xnn_node));
+    }
+    xnn_release_memory(subgraph->nodes);
+    subgraph->nodes = nodes;
+    subgraph->num_reserved_nodes = new_capacity;
+  }
+  subgraph->num_nodes = size + 1;
+  struct xnn_node* new_node = nodes + size;
+  new_node->id = size;
+  return new_node;
+}
+
+enum xnn_status xnn_delete_subgraph(
+    xnn_subgraph_t subgraph)
+{
+  if (subgraph != NULL) {
+    xnn_release_memory(subgraph->nodes);
+    xnn_release_memory(subgraph->values);
+    xnn_release_memory(subgraph);
+  }
+  return xnn_status_success;
+}
+
+size_t xnn_shape_multiply_all_dims(
+    const struct xnn_shape shape[1])
+{
+  size_t batch_size = 1;
+  for (size_t i = 0; i < shape->num_dims; i++) {
+    batch_size *= shape->dim[i];
+  }
+  return batch_size;
+}
+
+size_t xnn_shape_multiply_batch_dims(
+    const struct xnn_shape shape[1],
+    size_t num_nonbatch_dims)
+{
+  size_t batch_size = 1;
+  for (size_t i = 0; i + num_nonbatch_dims < shape->num_dims; i++) {
+    batch_size *= shape->dim[i];
+  }
+  return batch_size;
+}
+
+size_t xnn_tensor_get_size(
+    xnn_subgraph_t subgraph,
+    uint32_t value_id)
+{
+  assert(value_id < subgraph->num_values);
+
+  const struct xnn_value* value = subgraph->values + value_id;
+  assert(value->type == xnn_value_type_dense_tensor);
+  assert(value->datatype == xnn_datatype_fp32);
+  return xnn_shape_multiply_all_dims(&value->shape) * sizeof(float);
+}
+
+enum xnn_status xnn_define_tensor_value(
+    xnn_subgraph_t subgraph,
+    enum xnn_datatype datatype,
+    size_t num_dims,
+    const size_t* dims,
+    const void* data,
+    uint32_t external_id,
+    uint32_t flags,
+    uint32_t* id_out)
+{
+  if (!xnn_params.initialized) {
+    xnn_log_error("failed to create Dense Tensor value: XNNPACK is not initialized");
+    return xnn_status_uninitialized;
+  }
+
+  if (external_id != XNN_INVALID_VALUE_ID && external_id >= subgraph->external_value_ids) {
+    xnn_log_error(
+      "failed to create Dense Tensor value: external ID %" PRIu32 " exceeds the number of reserved external IDs in subgraph (%" PRIu32 ")",
+      external_id, subgraph->external_value_ids);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (num_dims > XNN_MAX_TENSOR_DIMS) {
+    xnn_log_error("failed to create Dense Tensor value: num of dimensions exceeds XNNPACK limit (%d)",
+      XNN_MAX_TENSOR_DIMS);
+    return xnn_status_unsupported_parameter;
+  }
+
+  if (datatype != xnn_datatype_fp32) {
+    xnn_log_error("failed to create Dense Tensor value: unsupported datatype %d", datatype);
+    return xnn_status_unsupported_parameter;
+  }
+
+  const uint32_t external_flags = XNN_VALUE_FLAG_EXTERNAL_INPUT | XNN_VALUE_FLAG_EXTERNAL_OUTPUT;
+  if ((flags & ~external_flags) != 0) {
+    xnn_log_error("failed to create Dense Tensor value: unsupported flags 0x%08" PRIx32, flags);
+    return xnn_status_invalid_parameter;
+  }
+
+  if ((flags & external_flags) != 0 && external_id == XNN_INVALID_VALUE_ID) {
+    xnn_log_error("failed to create Dense Tensor value: external inputs and outputs must have an external ID");
+    return xnn_status_invalid_parameter;
+  }
+
+  if ((flags & external_flags) != 0 && data != NULL) {
+    xnn_log_error("failed to create Dense Tensor value: external inputs and outputs can not have static data");
+    return xnn_status_invalid_parameter;
+  }
+
+  struct xnn_value* value = NULL;
+  if (external_id == XNN_INVALID_VALUE_ID) {
+    value = xnn_subgraph_new_internal_value(subgraph);
+    if (value == NULL) {
+      return xnn_status_out_of_memory;
+    }
+  } else {
+    value = subgraph->values + external_id;
+    if (value->type != xnn_value_type_invalid) {
+      xnn_log_error("failed to create Dense Tensor value: value with external ID %" PRIu32 " is already defined",
+        external_id);
+      return xnn_status_invalid_parameter;
+    }
+  }
+  value->type = xnn_value_type_dense_tensor;
+  value->datatype = datatype;
+  value->shape.num_dims = num_dims;
+  for (size_t i = 0; i < num_dims; i++) {
+    value->shape.dim[i] = dims[i];
+  }
+  value->flags = flags;
+  value->data = data;
+
+  *id_out = value->id;
+  return xnn_status_success;
+}
+
+static inline size_t compute_output_dimension(
+    size_t padded_input_dimension,
+    size_t kernel_dimension,
+    size_t dilation_dimension,
+    size_t stride_dimension)
+{
+  const size_t effective_kernel_dimension = (kernel_dimension - 1) * dilation_dimension + 1;
+  return doz(padded_input_dimension, effective_kernel_dimension) / stride_dimension + 1;
+}
+
+static enum xnn_status check_input_value(
+    xnn_subgraph_t subgraph,
+    const char* node_name,
+    uint32_t value_id,
+    size_t num_dims)
+{
+  if (value_id >= subgraph->num_values || subgraph->values[value_id].type != xnn_value_type_dense_tensor) {
+    xnn_log_error("failed to define %s node: input value ID %" PRIu32 " is not a defined tensor", node_name, value_id);
+    return xnn_status_invalid_parameter;
+  }
+  if (num_dims != 0 && subgraph->values[value_id].shape.num_dims != num_dims) {
+    xnn_log_error("failed to define %s node: input value ID %" PRIu32 " must have %zu dimensions, got %zu",
+      node_name, value_id, num_dims, subgraph->values[value_id].shape.num_dims);
+    return xnn_status_invalid_parameter;
+  }
+  return xnn_status_success;
+}
+
+static enum xnn_status check_static_value(
+    xnn_subgraph_t subgraph,
+    const char* node_name,
+    uint32_t value_id,
+    size_t num_dims)
+{
+  const enum xnn_status status = check_input_value(subgraph, node_name, value_id, num_dims);
+  if (status != xnn_status_success) {
+    return status;
+  }
+  if (subgraph->values[value_id].data == NULL) {
+    xnn_log_error("failed to define %s node: value ID %" PRIu32 " must have static data", node_name, value_id);
+    return xnn_status_unsupported_parameter;
+  }
+  return xnn_status_success;
+}
+
+static enum xnn_status check_output_value(
+    xnn_subgraph_t subgraph,
+    const char* node_name,
+    uint32_t value_id,
+    size_t num_dims)
+{
+  if (value_id >= subgraph->num_values || subgraph->values[value_id].type != xnn_value_type_dense_tensor) {
+    xnn_log_error("failed to define %s node: output value ID %" PRIu32 " is not a defined tensor", node_name, value_id);
+    return xnn_status_invalid_parameter;
+  }
+  const struct xnn_value* value = &subgraph->values[value_id];
+  if (num_dims != 0 && value->shape.num_dims != num_dims) {
+    xnn_log_error("failed to define %s node: output value ID %" PRIu32 " must have %zu dimensions, got %zu",
+      node_name, value_id, num_dims, value->shape.num_dims);
+    return xnn_status_invalid_parameter;
+  }
+  if (value->data != NULL || (value->flags & XNN_VALUE_FLAG_EXTERNAL_INPUT) != 0) {
+    xnn_log_error("failed to define %s node: output value ID %" PRIu32 " is a static value or an external input",
+      node_name, value_id);
+    return xnn_status_invalid_parameter;
+  }
+  if (value->producer != XNN_INVALID_NODE_ID) {
+    xnn_log_error("failed to define %s node: output value ID %" PRIu32 " is already produced by node #%" PRIu32,
+      node_name, value_id, value->producer);
+    return xnn_status_invalid_parameter;
+  }
+  return xnn_status_success;
+}
+
+static enum xnn_status check_output_range(
+    const char* node_name,
+    float output_min,
+    float output_max)
+{
+  if (isnan(output_min) || isnan(output_max)) {
+    xnn_log_error("failed to define %s node with NaN output bound", node_name);
+    return xnn_status_invalid_parameter;
+  }
+  if (output_min >= output_max) {
+    xnn_log_error("failed to define %s node with [%.7g, %.7g] output range: range min must be below range max",
+      node_name, output_min, output_max);
+    return xnn_status_invalid_parameter;
+  }
+  return xnn_status_success;
+}
+
+static enum xnn_status check_shapes_match(
+    xnn_subgraph_t subgraph,
+    const char* node_name,
+    uint32_t input_id,
+    uint32_t output_id)
+{
+  const struct xnn_shape* input_shape = &subgraph->values[input_id].shape;
+  const struct xnn_shape* output_shape = &subgraph->values[output_id].shape;
+  bool shapes_match = input_shape->num_dims == output_shape->num_dims;
+  for (size_t i = 0; shapes_match && i < input_shape->num_dims; i++) {
+    shapes_match = input_shape->dim[i] == output_shape->dim[i];
+  }
+  if (!shapes_match) {
+    xnn_log_error("failed to define %s node: shapes of value IDs %" PRIu32 " and %" PRIu32 " do not match",
+      node_name, input_id, output_id);
+    return xnn_status_invalid_parameter;
+  }
+  return xnn_status_success;
+}
+
+static enum xnn_status check_nhwc_output_shape(
+    xnn_subgraph_t subgraph,
+    const char* node_name,
+    uint32_t input_id,
+    uint32_t output_id,
+    size_t output_height,
+    size_t output_width,
+    size_t output_channels)
+{
+  const struct xnn_shape* input_shape = &subgraph->values[input_id].shape;
+  const struct xnn_shape* output_shape = &subgraph->values[output_id].shape;
+  if (output_shape->dim[0] != input_shape->dim[0] ||
+      output_shape->dim[1] != output_height ||
+      output_shape->dim[2] != output_width ||
+      output_shape->dim[3] != output_channels)
+  {
+    xnn_log_error(
+      "failed to define %s node: output value ID %" PRIu32 " must have [%zu, %zu, %zu, %zu] shape, got [%zu, %zu, %zu, %zu]",
+      node_name, output_id, input_shape->dim[0], output_height, output_width, output_channels,
+      output_shape->dim[0], output_shape->dim[1], output_shape->dim[2], output_shape->dim[3]);
+    return xnn_status_invalid_parameter;
+  }
+  return xnn_status_success;
+}
+
+static enum xnn_status add_node(
+    xnn_subgraph_t subgraph,
+    enum xnn_node_type type,
+    float output_min,
+    float output_max,
+    uint32_t num_inputs,
+    const uint32_t* inputs,
+    uint32_t output_id,
+    uint32_t flags,
+    struct xnn_node** node_out)
+{
+  struct xnn_node* node = xnn_subgraph_new_node(subgraph);
+  if (node == NULL) {
+    return xnn_status_out_of_memory;
+  }
+
+  node->type = type;
+  node->activation.output_min = output_min;
+  node->activation.output_max = output_max;
+  node->num_inputs = num_inputs;
+  for (uint32_t i = 0; i < num_inputs; i++) {
+    node->inputs[i] = inputs[i];
+  }
+  node->num_outputs = 1;
+  node->outputs[0] = output_id;
+  node->flags = flags;
+  subgraph->values[output_id].producer = node->id;
+
+  *node_out = node;
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_define_convolution_2d(
+    xnn_subgraph_t subgraph,
+    uint32_t input_padding_top,
+    uint32_t input_padding_right,
+    uint32_t input_padding_bottom,
+    uint32_t input_padding_left,
+    uint32_t kernel_height,
+    uint32_t kernel_width,
+    uint32_t subsampling_height,
+    uint32_t subsampling_width,
+    uint32_t dilation_height,
+    uint32_t dilation_width,
+    uint32_t groups,
+    size_t group_input_channels,
+    size_t group_output_channels,
+    float output_min,
+    float output_max,
+    uint32_t input_id,
+    uint32_t filter_id,
+    uint32_t bias_id,
+    uint32_t output_id,
+    uint32_t flags)
+{
+  static const char* node_name = "Convolution 2D";
+  if (!xnn_params.initialized) {
+    xnn_log_error("failed to define %s node: XNNPACK is not initialized", node_name);
+    return xnn_status_uninitialized;
+  }
+
+  if (kernel_width == 0 || kernel_height == 0) {
+    xnn_log_error(
+      "failed to define %s node with %" PRIu32 "x%" PRIu32 " kernel: kernel dimensions must be non-zero",
+      node_name, kernel_width, kernel_height);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (subsampling_width == 0 || subsampling_height == 0) {
+    xnn_log_error(
+      "failed to define %s node with %" PRIu32 "x%" PRIu32 " subsampling: subsampling dimensions must be non-zero",
+      node_name, subsampling_width, subsampling_height);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (dilation_width == 0 || dilation_height == 0) {
+    xnn_log_error(
+      "failed to define %s node with %" PRIu32 "x%" PRIu32 " dilation: dilation dimensions must be non-zero",
+      node_name, dilation_width, dilation_height);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (groups == 0 || group_input_channels == 0 || group_output_channels == 0) {
+    xnn_log_error(
+      "failed to define %s node with %" PRIu32 " groups, %zu input channels, and %zu output channels per group: "
+      "number of groups and channels must be non-zero",
+      node_name, groups, group_input_channels, group_output_channels);
+    return xnn_status_invalid_parameter;
+  }
+
+  enum xnn_status status = check_output_range(node_name, output_min, output_max);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  if ((status = check_input_value(subgraph, node_name, input_id, 4)) != xnn_status_success ||
+      (status = check_static_value(subgraph, node_name, filter_id, 4)) != xnn_status_success ||
+      (status = check_static_value(subgraph, node_name, bias_id, 1)) != xnn_status_success ||
+      (status = check_output_value(subgraph, node_name, output_id, 4)) != xnn_status_success)
+  {
+    return status;
+  }
+
+  const struct xnn_shape* input_shape = &subgraph->values[input_id].shape;
+  const struct xnn_shape* filter_shape = &subgraph->values[filter_id].shape;
+  const struct xnn_shape* bias_shape = &subgraph->values[bias_id].shape;
+  const size_t input_channels = groups * group_input_channels;
+  const size_t output_channels = groups * group_output_channels;
+  if (input_shape->dim[3] != input_channels ||
+      filter_shape->dim[0] != output_channels || filter_shape->dim[1] != kernel_height ||
+      filter_shape->dim[2] != kernel_width || filter_shape->dim[3] != group_input_channels ||
+      bias_shape->dim[0] != output_channels)
+  {
+    xnn_log_error("failed to define %s node: input, filter, or bias shape does not match the convolution parameters",
+      node_name);
+    return xnn_status_invalid_parameter;
+  }
+
+  const size_t output_height = compute_output_dimension(
+    input_padding_top + input_shape->dim[1] + input_padding_bottom, kernel_height, dilation_height, subsampling_height);
+  const size_t output_width = compute_output_dimension(
+    input_padding_left + input_shape->dim[2] + input_padding_right, kernel_width, dilation_width, subsampling_width);
+  status = check_nhwc_output_shape(subgraph, node_name, input_id, output_id, output_height, output_width,
+    output_channels);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  struct xnn_node* node = NULL;
+  const uint32_t inputs[3] = { input_id, filter_id, bias_id };
+  status = add_node(subgraph, xnn_node_type_convolution_2d, output_min, output_max, 3, inputs, output_id, flags, &node);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  node->params.convolution_2d.input_padding_top = input_padding_top;
+  node->params.convolution_2d.input_padding_right = input_padding_right;
+  node->params.convolution_2d.input_padding_bottom = input_padding_bottom;
+  node->params.convolution_2d.input_padding_left = input_padding_left;
+  node->params.convolution_2d.kernel_height = kernel_height;
+  node->params.convolution_2d.kernel_width = kernel_width;
+  node->params.convolution_2d.subsampling_height = subsampling_height;
+  node->params.convolution_2d.subsampling_width = subsampling_width;
+  node->params.convolution_2d.dilation_height = dilation_height;
+  node->params.convolution_2d.dilation_width = dilation_width;
+  node->params.convolution_2d.groups = groups;
+  node->params.convolution_2d.group_input_channels = group_input_channels;
+  node->params.convolution_2d.group_output_channels = group_output_channels;
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_define_depthwise_convolution_2d(
+    xnn_subgraph_t subgraph,
+    uint32_t input_padding_top,
+    uint32_t input_padding_right,
+    uint32_t input_padding_bottom,
+    uint32_t input_padding_left,
+    uint32_t kernel_height,
+    uint32_t kernel_width,
+    uint32_t subsampling_height,
+    uint32_t subsampling_width,
+    uint32_t dilation_height,
+    uint32_t dilation_width,
+    uint32_t depth_multiplier,
+    size_t input_channels,
+    float output_min,
+    float output_max,
+    uint32_t input_id,
+    uint32_t filter_id,
+    uint32_t bias_id,
+    uint32_t output_id,
+    uint32_t flags)
+{
+  static const char* node_name = "Depthwise Convolution 2D";
+  if (!xnn_params.initialized) {
+    xnn_log_error("failed to define %s node: XNNPACK is not initialized", node_name);
+    return xnn_status_uninitialized;
+  }
+
+  if (kernel_width == 0 || kernel_height == 0) {
+    xnn_log_error(
+      "failed to define %s node with %" PRIu32 "x%" PRIu32 " kernel: kernel dimensions must be non-zero",
+      node_name, kernel_width, kernel_height);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (subsampling_width == 0 || subsampling_height == 0) {
+    xnn_log_error(
+      "failed to define %s node with %" PRIu32 "x%" PRIu32 " subsampling: subsampling dimensions must be non-zero",
+      node_name, subsampling_width, subsampling_height);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (dilation_width == 0 || dilation_height == 0) {
+    xnn_log_error(
+      "failed to define %s node with %" PRIu32 "x%" PRIu32 " dilation: dilation dimensions must be non-zero",
+      node_name, dilation_width, dilation_height);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (depth_multiplier == 0 || input_channels == 0) {
+    xnn_log_error(
+      "failed to define %s node with %zu input channels and %" PRIu32 " depth multiplier: "
+      "number of channels and depth multiplier must be non-zero",
+      node_name, input_channels, depth_multiplier);
+    return xnn_status_invalid_parameter;
+  }
+
+  enum xnn_status status = check_output_range(node_name, output_min, output_max);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  if ((status = check_input_value(subgraph, node_name, input_id, 4)) != xnn_status_success ||
+      (status = check_static_value(subgraph, node_name, filter_id, 4)) != xnn_status_success ||
+      (status = check_static_value(subgraph, node_name, bias_id, 1)) != xnn_status_success ||
+      (status = check_output_value(subgraph, node_name, output_id, 4)) != xnn_status_success)
+  {
+    return status;
+  }
+
+  const struct xnn_shape* input_shape = &subgraph->values[input_id].shape;
+  const struct xnn_shape* filter_shape = &subgraph->values[filter_id].shape;
+  const struct xnn_shape* bias_shape = &subgraph->values[bias_id].shape;
+  const size_t output_channels = input_channels * depth_multiplier;
+  if (input_shape->dim[3] != input_channels ||
+      filter_shape->dim[0] != 1 || filter_shape->dim[1] != kernel_height ||
+      filter_shape->dim[2] != kernel_width || filter_shape->dim[3] != output_channels ||
+      bias_shape->dim[0] != output_channels)
+  {
+    xnn_log_error("failed to define %s node: input, filter, or bias shape does not match the convolution parameters",
+      node_name);
+    return xnn_status_invalid_parameter;
+  }
+
+  const size_t output_height = compute_output_dimension(
+    input_padding_top + input_shape->dim[1] + input_padding_bottom, kernel_height, dilation_height, subsampling_height);
+  const size_t output_width = compute_output_dimension(
+    input_padding_left + input_shape->dim[2] + input_padding_right, kernel_width, dilation_width, subsampling_width);
+  status = check_nhwc_output_shape(subgraph, node_name, input_id, output_id, output_height, output_width,
+    output_channels);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  struct xnn_node* node = NULL;
+  const uint32_t inputs[3] = { input_id, filter_id, bias_id };
+  status = add_node(subgraph, xnn_node_type_depthwise_convolution_2d, output_min, output_max, 3, inputs, output_id,
+    flags, &node);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  node->params.depthwise_convolution_2d.input_padding_top = input_padding_top;
+  node->params.depthwise_convolution_2d.input_padding_right = input_padding_right;
+  node->params.depthwise_convolution_2d.input_padding_bottom = input_padding_bottom;
+  node->params.depthwise_convolution_2d.input_padding_left = input_padding_left;
+  node->params.depthwise_convolution_2d.kernel_height = kernel_height;
+  node->params.depthwise_convolution_2d.kernel_width = kernel_width;
+  node->params.depthwise_convolution_2d.subsampling_height = subsampling_height;
+  node->params.depthwise_convolution_2d.subsampling_width = subsampling_width;
+  node->params.depthwise_convolution_2d.dilation_height = dilation_height;
+  node->params.depthwise_convolution_2d.dilation_width = dilation_width;
+  node->params.depthwise_convolution_2d.depth_multiplier = depth_multiplier;
+  node->params.depthwise_convolution_2d.input_channels = input_channels;
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_define_fully_connected(
+    xnn_subgraph_t subgraph,
+    float output_min,
+    float output_max,
+    uint32_t input_id,
+    uint32_t filter_id,
+    uint32_t bias_id,
+    uint32_t output_id,
+    uint32_t flags)
+{
+  static const char* node_name = "Fully Connected";
+  if (!xnn_params.initialized) {
+    xnn_log_error("failed to define %s node: XNNPACK is not initialized", node_name);
+    return xnn_status_uninitialized;
+  }
+
+  enum xnn_status status = check_output_range(node_name, output_min, output_max);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  if ((status = check_input_value(subgraph, node_name, input_id, 0)) != xnn_status_success ||
+      (status = check_static_value(subgraph, node_name, filter_id, 2)) != xnn_status_success ||
+      (status = check_static_value(subgraph, node_name, bias_id, 1)) != xnn_status_success ||
+      (status = check_output_value(subgraph, node_name, output_id, 0)) != xnn_status_success)
+  {
+    return status;
+  }
+
+  const struct xnn_shape* input_shape = &subgraph->values[input_id].shape;
+  const struct xnn_shape* filter_shape = &subgraph->values[filter_id].shape;
+  const struct xnn_shape* bias_shape = &subgraph->values[bias_id].shape;
+  const struct xnn_shape* output_shape = &subgraph->values[output_id].shape;
+  const size_t output_channels = filter_shape->dim[0];
+  const size_t input_channels = filter_shape->dim[1];
+  if (input_shape->num_dims == 0 || output_shape->num_dims == 0 ||
+      input_shape->dim[input_shape->num_dims - 1] != input_channels ||
+      output_shape->dim[output_shape->num_dims - 1] != output_channels ||
+      bias_shape->dim[0] != output_channels ||
+      xnn_shape_multiply_batch_dims(input_shape, 1) != xnn_shape_multiply_batch_dims(output_shape, 1))
+  {
+    xnn_log_error("failed to define %s node: input, filter, bias, and output shapes do not match", node_name);
+    return xnn_status_invalid_parameter;
+  }
+
+  struct xnn_node* node = NULL;
+  const uint32_t inputs[3] = { input_id, filter_id, bias_id };
+  return add_node(subgraph, xnn_node_type_fully_connected, output_min, output_max, 3, inputs, output_id, flags, &node);
+}
+
+static enum xnn_status define_pooling_2d(
+    xnn_subgraph_t subgraph,
+    enum xnn_node_type node_type,
+    const char* node_name,
+    uint32_t input_padding_top,
+    uint32_t input_padding_right,
+    uint32_t input_padding_bottom,
+    uint32_t input_padding_left,
+    uint32_t pooling_height,
+    uint32_t pooling_width,
+    uint32_t stride_height,
+    uint32_t stride_width,
+    uint32_t dilation_height,
+    uint32_t dilation_width,
+    float output_min,
+    float output_max,
+    uint32_t input_id,
+    uint32_t output_id,
+    uint32_t flags)
+{
+  if (!xnn_params.initialized) {
+    xnn_log_error("failed to define %s node: XNNPACK is not initialized", node_name);
+    return xnn_status_uninitialized;
+  }
+
+  if (pooling_width * pooling_height <= 1) {
+    xnn_log_error(
+      "failed to define %s node with %" PRIu32 "x%" PRIu32 " pooling size: pooling size must be greater than 1",
+      node_name, pooling_width, pooling_height);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (stride_width == 0 || stride_height == 0 || dilation_width == 0 || dilation_height == 0) {
+    xnn_log_error(
+      "failed to define %s node with %" PRIu32 "x%" PRIu32 " stride and %" PRIu32 "x%" PRIu32 " dilation: "
+      "stride and dilation dimensions must be non-zero",
+      node_name, stride_width, stride_height, dilation_width, dilation_height);
+    return xnn_status_invalid_parameter;
+  }
+
+  enum xnn_status status = check_output_range(node_name, output_min, output_max);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  if ((status = check_input_value(subgraph, node_name, input_id, 4)) != xnn_status_success ||
+      (status = check_output_value(subgraph, node_name, output_id, 4)) != xnn_status_success)
+  {
+    return status;
+  }
+
+  const struct xnn_shape* input_shape = &subgraph->values[input_id].shape;
+  const size_t output_height = compute_output_dimension(
+    input_padding_top + input_shape->dim[1] + input_padding_bottom, pooling_height, dilation_height, stride_height);
+  const size_t output_width = compute_output_dimension(
+    input_padding_left + input_shape->dim[2] + input_padding_right, pooling_width, dilation_width, stride_width);
+  status = check_nhwc_output_shape(subgraph, node_name, input_id, output_id, output_height, output_width,
+    input_shape->dim[3]);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  struct xnn_node* node = NULL;
+  status = add_node(subgraph, node_type, output_min, output_max, 1, &input_id, output_id, flags, &node);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  node->params.pooling_2d.input_padding_top = input_padding_top;
+  node->params.pooling_2d.input_padding_right = input_padding_right;
+  node->params.pooling_2d.input_padding_bottom = input_padding_bottom;
+  node->params.pooling_2d.input_padding_left = input_padding_left;
+  node->params.pooling_2d.pooling_height = pooling_height;
+  node->params.pooling_2d.pooling_width = pooling_width;
+  node->params.pooling_2d.stride_height = stride_height;
+  node->params.pooling_2d.stride_width = stride_width;
+  node->params.pooling_2d.dilation_height = dilation_height;
+  node->params.pooling_2d.dilation_width = dilation_width;
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_define_average_pooling_2d(
+    xnn_subgraph_t subgraph,
+    uint32_t input_padding_top,
+    uint32_t input_padding_right,
+    uint32_t input_padding_bottom,
+    uint32_t input_padding_left,
+    uint32_t pooling_height,
+    uint32_t pooling_width,
+    uint32_t stride_height,
+    uint32_t stride_width,
+    float output_min,
+    float output_max,
+    uint32_t input_id,
+    uint32_t output_id,
+    uint32_t flags)
+{
+  return define_pooling_2d(subgraph, xnn_node_type_average_pooling_2d, "Average Pooling 2D",
+    input_padding_top, input_padding_right, input_padding_bottom, input_padding_left,
+    pooling_height, pooling_width, stride_height, stride_width, 1 /* dilation height */, 1 /* dilation width */,
+    output_min, output_max, input_id, output_id, flags);
+}
+
+enum xnn_status xnn_define_max_pooling_2d(
+    xnn_subgraph_t subgraph,
+    uint32_t input_padding_top,
+    uint32_t input_padding_right,
+    uint32_t input_padding_bottom,
+    uint32_t input_padding_left,
+    uint32_t pooling_height,
+    uint32_t pooling_width,
+    uint32_t stride_height,
+    uint32_t stride_width,
+    uint32_t dilation_height,
+    uint32_t dilation_width,
+    float output_min,
+    float output_max,
+    uint32_t input_id,
+    uint32_t output_id,
+    uint32_t flags)
+{
+  return define_pooling_2d(subgraph, xnn_node_type_max_pooling_2d, "Max Pooling 2D",
+    input_padding_top, input_padding_right, input_padding_bottom, input_padding_left,
+    pooling_height, pooling_width, stride_height, stride_width, dilation_height, dilation_width,
+    output_min, output_max, input_id, output_id, flags);
+}
+
+enum xnn_status xnn_define_global_average_pooling_2d(
+    xnn_subgraph_t subgraph,
+    float output_min,
+    float output_max,
+    uint32_t input_id,
+    uint32_t output_id,
+    uint32_t flags)
+{
+  static const char* node_name = "Global Average Pooling 2D";
+  if (!xnn_params.initialized) {
+    xnn_log_error("failed to define %s node: XNNPACK is not initialized", node_name);
+    return xnn_status_uninitialized;
+  }
+
+  enum xnn_status status = check_output_range(node_name, output_min, output_max);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  if ((status = check_input_value(subgraph, node_name, input_id, 4)) != xnn_status_success ||
+      (status = check_output_value(subgraph, node_name, output_id, 0)) != xnn_status_success)
+  {
+    return status;
+  }
+
+  const struct xnn_shape* input_shape = &subgraph->values[input_id].shape;
+  const struct xnn_shape* output_shape = &subgraph->values[output_id].shape;
+  const bool output_shape_matches =
+    (output_shape->num_dims == 4 && output_shape->dim[0] == input_shape->dim[0] &&
+      output_shape->dim[1] == 1 && output_shape->dim[2] == 1 && output_shape->dim[3] == input_shape->dim[3]) ||
+    (output_shape->num_dims == 2 && output_shape->dim[0] == input_shape->dim[0] &&
+      output_shape->dim[1] == input_shape->dim[3]);
+  if (!output_shape_matches) {
+    xnn_log_error(
+      "failed to define %s node: output value ID %" PRIu32 " must have [N, 1, 1, C] or [N, C] shape",
+      node_name, output_id);
+    return xnn_status_invalid_parameter;
+  }
+
+  struct xnn_node* node = NULL;
+  return add_node(subgraph, xnn_node_type_global_average_pooling_2d, output_min, output_max, 1, &input_id, output_id,
+    flags, &node);
+}
+
+enum xnn_status xnn_define_add2(
+    xnn_subgraph_t subgraph,
+    float output_min,
+    float output_max,
+    uint32_t input1_id,
+    uint32_t input2_id,
+    uint32_t output_id,
+    uint32_t flags)
+{
+  static const char* node_name = "Add";
+  if (!xnn_params.initialized) {
+    xnn_log_error("failed to define %s node: XNNPACK is not initialized", node_name);
+    return xnn_status_uninitialized;
+  }
+
+  enum xnn_status status = check_output_range(node_name, output_min, output_max);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  if ((status = check_input_value(subgraph, node_name, input1_id, 0)) != xnn_status_success ||
+      (status = check_input_value(subgraph, node_name, input2_id, 0)) != xnn_status_success ||
+      (status = check_output_value(subgraph, node_name, output_id, 0)) != xnn_status_success ||
+      (status = check_shapes_match(subgraph, node_name, input1_id, input2_id)) != xnn_status_success ||
+      (status = check_shapes_match(subgraph, node_name, input1_id, output_id)) != xnn_status_success)
+  {
+    return status;
+  }
+
+  struct xnn_node* node = NULL;
+  const uint32_t inputs[2] = { input1_id, input2_id };
+  return add_node(subgraph, xnn_node_type_add2, output_min, output_max, 2, inputs, output_id, flags, &node);
+}
+
+enum xnn_status xnn_define_clamp(
+    xnn_subgraph_t subgraph,
+    float output_min,
+    float output_max,
+    uint32_t input_id,
+    uint32_t output_id,
+    uint32_t flags)
+{
+  static const char* node_name = "Clamp";
+  if (!xnn_params.initialized) {
+    xnn_log_error("failed to define %s node: XNNPACK is not initialized", node_name);
+    return xnn_status_uninitialized;
+  }
+
+  enum xnn_status status = check_output_range(node_name, output_min, output_max);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  if ((status = check_input_value(subgraph, node_name, input_id, 0)) != xnn_status_success ||
+      (status = check_output_value(subgraph, node_name, output_id, 0)) != xnn_status_success ||
+      (status = check_shapes_match(subgraph, node_name, input_id, output_id)) != xnn_status_success)
+  {
+    return status;
+  }
+
+  struct xnn_node* node = NULL;
+  return add_node(subgraph, xnn_node_type_clamp, output_min, output_max, 1, &input_id, output_id, flags, &node);
+}
+
+enum xnn_status xnn_define_hardswish(
+    xnn_subgraph_t subgraph,
+    uint32_t input_id,
+    uint32_t output_id,
+    uint32_t flags)
+{
+  static const char* node_name = "HardSwish";
+  if (!xnn_params.initialized) {
+    xnn_log_error("failed to define %s node: XNNPACK is not initialized", node_name);
+    return xnn_status_uninitialized;
+  }
+
+  enum xnn_status status;
+  if ((status = check_input_value(subgraph, node_name, input_id, 0)) != xnn_status_success ||
+      (status = check_output_value(subgraph, node_name, output_id, 0)) != xnn_status_success ||
+      (status = check_shapes_match(subgraph, node_name, input_id, output_id)) != xnn_status_success)
+  {
+    return status;
+  }
+
+  struct xnn_node* node = NULL;
+  return add_node(subgraph, xnn_node_type_hardswish, -INFINITY, +INFINITY, 1, &input_id, output_id, flags, &node);
+}
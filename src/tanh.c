@@ -0,0 +1,140 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <xnnpack.h>
+#include <xnnpack/allocator.h>
+#include <xnnpack/operator.h>
+#include <xnnpack/log.h>
+
+
+enum xnn_status xnn_create_tanh_nc_f32(
+    size_t channels,
+    size_t input_stride,
+    size_t output_stride,
+    uint32_t flags,
+    xnn_operator_t* tanh_op_out)
+{
+  xnn_operator_t tanh_op = NULL;
+  enum xnn_status status = xnn_status_uninitialized;
+
+  if (!xnn_params.initialized) {
+    xnn_log_error("failed to create TanH operator: XNNPACK is not initialized");
+    goto error;
+  }
+
+  status = xnn_status_invalid_parameter;
+
+  if (channels == 0) {
+    xnn_log_error(
+      "failed to create TanH operator with %zu channels: number of channels must be non-zero", channels);
+    goto error;
+  }
+
+  if (input_stride < channels) {
+    xnn_log_error(
+      "failed to create TanH operator with input element stride of %zu: "
+      "stride must be at least as large as the number of channels (%zu)",
+      input_stride, channels);
+    goto error;
+  }
+
+  if (output_stride < channels) {
+    xnn_log_error(
+      "failed to create TanH operator with output element stride of %zu: "
+      "stride must be at least as large as the number of channels (%zu)",
+      output_stride, channels);
+    goto error;
+  }
+
+  status = xnn_status_out_of_memory;
+
+  tanh_op = xnn_allocate_zero_memory(sizeof(struct xnn_operator));
+  if (tanh_op == NULL) {
+    xnn_log_error("failed to allocate %zu bytes for TanH operator descriptor", sizeof(struct xnn_operator));
+    goto error;
+  }
+
+  tanh_op->channels = channels;
+  tanh_op->input_pixel_stride = input_stride;
+  tanh_op->output_pixel_stride = output_stride;
+
+  tanh_op->type = xnn_operator_type_tanh_f32;
+  tanh_op->ukernel.type = xnn_ukernel_type_tanh;
+
+  tanh_op->state = xnn_run_state_invalid;
+
+  *tanh_op_out = tanh_op;
+  return xnn_status_success;
+
+error:
+  xnn_delete_operator(tanh_op);
+  return status;
+}
+
+enum xnn_status xnn_setup_tanh_nc_f32(
+    xnn_operator_t tanh_op,
+    size_t batch_size,
+    const float* input,
+    float* output,
+    pthreadpool_t threadpool)
+{
+  if (tanh_op->type != xnn_operator_type_tanh_f32) {
+    xnn_log_error("failed to setup TanH (F32) operator: operator type mismatch");
+    return xnn_status_invalid_parameter;
+  }
+  tanh_op->state = xnn_run_state_invalid;
+
+  if (!xnn_params.initialized) {
+    xnn_log_error("failed to setup TanH operator: XNNPACK is not initialized");
+    return xnn_status_uninitialized;
+  }
+
+  if (batch_size == 0) {
+    tanh_op->state = xnn_run_state_skip;
+    return xnn_status_success;
+  }
+
+  tanh_op->batch_size = batch_size;
+  tanh_op->input = input;
+  tanh_op->output = output;
+
+  const size_t channels = tanh_op->channels;
+  const size_t input_stride = tanh_op->input_pixel_stride;
+  const size_t output_stride = tanh_op->output_pixel_stride;
+  if ((((input_stride ^ channels) | (output_stride ^ channels)) == 0) || batch_size == 1) {
+    const size_t block_size = 4096;
+    tanh_op->context.univector_contiguous = (struct univector_contiguous_context) {
+      .x = input,
+      .x_stride = input_stride * sizeof(float),
+      .y = output,
+      .y_stride = output_stride * sizeof(float),
+      .ukernel = xnn_params.f32.tanh,
+    };
+    tanh_op->compute.type = xnn_parallelization_type_1d_tile_1d;
+    tanh_op->compute.task_1d_tile_1d = (pthreadpool_task_1d_tile_1d_t) xnn_compute_univector_contiguous;
+    tanh_op->compute.range[0] = batch_size * channels * sizeof(float);
+    tanh_op->compute.tile[0] = block_size;
+  } else {
+    tanh_op->context.univector_strided = (struct univector_strided_context) {
+      .n = channels * sizeof(float),
+      .x = input,
+      .x_stride = input_stride * sizeof(float),
+      .y = output,
+      .y_stride = output_stride * sizeof(float),
+      .ukernel = xnn_params.f32.tanh,
+    };
+    tanh_op->compute.type = xnn_parallelization_type_1d_tile_1d;
+    tanh_op->compute.task_1d_tile_1d = (pthreadpool_task_1d_tile_1d_t) xnn_compute_univector_strided;
+    tanh_op->compute.range[0] = batch_size;
+    tanh_op->compute.tile[0] = 1;
+  }
+  tanh_op->state = xnn_run_state_ready;
+
+  return xnn_status_success;
+}
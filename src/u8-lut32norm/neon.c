@@ -0,0 +1,124 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <fxdiv.h>
+
+#include <xnnpack/lut.h>
+
+
+static inline uint32_t compute_sum(
+    size_t n,
+    const uint8_t* x,
+    const uint32_t* t)
+{
+  assert(n != 0);
+
+  uint32_t vsum0 = 0;
+  uint32_t vsum1 = 0;
+  uint32_t vsum2 = 0;
+  uint32_t vsum3 = 0;
+  for (; n >= 4; n -= 4) {
+    const size_t vx0 = x[0];
+    const size_t vx1 = x[1];
+    const size_t vx2 = x[2];
+    const size_t vx3 = x[3];
+    x += 4;
+
+    vsum0 += t[vx0];
+    vsum1 += t[vx1];
+    vsum2 += t[vx2];
+    vsum3 += t[vx3];
+  }
+  uint32_t vsum = (vsum0 + vsum1) + (vsum2 + vsum3);
+  for (; n != 0; n--) {
+    const size_t vx = *x++;
+    vsum += t[vx];
+  }
+  return vsum;
+}
+
+static inline uint32x4_t load_x4(
+    const uint8_t* x,
+    const uint32_t* t)
+{
+  uint32x4_t vt = vmovq_n_u32(0);
+  vt = vld1q_lane_u32(&t[x[0]], vt, 0);
+  vt = vld1q_lane_u32(&t[x[1]], vt, 1);
+  vt = vld1q_lane_u32(&t[x[2]], vt, 2);
+  vt = vld1q_lane_u32(&t[x[3]], vt, 3);
+  return vt;
+}
+
+static inline uint32x4_t divide(
+    uint32x4_t vn,
+    uint32x2_t vmultiplier,
+    int32x4_t vshift1,
+    int32x4_t vshift2)
+{
+  // Same computation as fxdiv_quotient_uint32_t, 4 lanes at a time:
+  //   t := (n * m) >> 32
+  //   q := (t + ((n - t) >> s1)) >> s2
+  // Shift amounts are negated, so VSHL shifts right.
+  const uint32x4_t vt = vcombine_u32(
+    vshrn_n_u64(vmull_u32(vget_low_u32(vn), vmultiplier), 32),
+    vshrn_n_u64(vmull_u32(vget_high_u32(vn), vmultiplier), 32));
+  return vshlq_u32(vaddq_u32(vt, vshlq_u32(vsubq_u32(vn, vt), vshift1)), vshift2);
+}
+
+void xnn_u8_lut32norm_ukernel__neon(
+    size_t n,
+    const uint8_t* x,
+    const uint32_t* t,
+    uint8_t* y)
+{
+  assert(n != 0);
+
+  const uint32_t vsum = compute_sum(n, x, t);
+  assert(vsum != 0);
+
+  struct fxdiv_divisor_uint32_t vsum_divisor = fxdiv_init_uint32_t(vsum);
+  const uint32_t vrounding = (vsum >> 1);
+
+  const uint32x2_t vmultiplier = vmov_n_u32(vsum_divisor.m);
+  const int32x4_t vshift1 = vmovq_n_s32(-(int32_t) vsum_divisor.s1);
+  const int32x4_t vshift2 = vmovq_n_s32(-(int32_t) vsum_divisor.s2);
+  const uint32x4_t vrounding_x4 = vmovq_n_u32(vrounding);
+  for (; n >= 16; n -= 16) {
+    const uint32x4_t vt0123 = load_x4(x, t);
+    const uint32x4_t vt4567 = load_x4(x + 4, t);
+    const uint32x4_t vt89AB = load_x4(x + 8, t);
+    const uint32x4_t vtCDEF = load_x4(x + 12, t);
+    x += 16;
+
+    const uint32x4_t vn0123 = vaddq_u32(vshlq_n_u32(vt0123, 8), vrounding_x4);
+    const uint32x4_t vn4567 = vaddq_u32(vshlq_n_u32(vt4567, 8), vrounding_x4);
+    const uint32x4_t vn89AB = vaddq_u32(vshlq_n_u32(vt89AB, 8), vrounding_x4);
+    const uint32x4_t vnCDEF = vaddq_u32(vshlq_n_u32(vtCDEF, 8), vrounding_x4);
+
+    const uint32x4_t vq0123 = divide(vn0123, vmultiplier, vshift1, vshift2);
+    const uint32x4_t vq4567 = divide(vn4567, vmultiplier, vshift1, vshift2);
+    const uint32x4_t vq89AB = divide(vn89AB, vmultiplier, vshift1, vshift2);
+    const uint32x4_t vqCDEF = divide(vnCDEF, vmultiplier, vshift1, vshift2);
+
+    // Quotients do not exceed 256, so narrowing to 16 bits is exact, and saturating narrowing to 8 bits clamps 256
+    // to 255.
+    const uint16x8_t vq01234567 = vcombine_u16(vmovn_u32(vq0123), vmovn_u32(vq4567));
+    const uint16x8_t vq89ABCDEF = vcombine_u16(vmovn_u32(vq89AB), vmovn_u32(vqCDEF));
+    const uint8x16_t vy = vcombine_u8(vqmovn_u16(vq01234567), vqmovn_u16(vq89ABCDEF));
+
+    vst1q_u8(y, vy); y += 16;
+  }
+  for (; n != 0; n--) {
+    const size_t vx = *x++;
+    const uint32_t vt = t[vx];
+    const uint32_t vq = fxdiv_quotient_uint32_t((vt << 8) + vrounding, vsum_divisor);
+    const uint8_t vy = vq > 255 ? UINT8_C(255) : (uint8_t) vq;
+    *y++ = vy;
+  }
+}
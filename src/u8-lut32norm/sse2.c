@@ -0,0 +1,114 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <emmintrin.h>
+
+#include <fxdiv.h>
+
+#include <xnnpack/lut.h>
+
+
+static inline uint32_t compute_sum(
+    size_t n,
+    const uint8_t* x,
+    const uint32_t* t)
+{
+  assert(n != 0);
+
+  uint32_t vsum0 = 0;
+  uint32_t vsum1 = 0;
+  uint32_t vsum2 = 0;
+  uint32_t vsum3 = 0;
+  for (; n >= 4; n -= 4) {
+    const size_t vx0 = x[0];
+    const size_t vx1 = x[1];
+    const size_t vx2 = x[2];
+    const size_t vx3 = x[3];
+    x += 4;
+
+    vsum0 += t[vx0];
+    vsum1 += t[vx1];
+    vsum2 += t[vx2];
+    vsum3 += t[vx3];
+  }
+  uint32_t vsum = (vsum0 + vsum1) + (vsum2 + vsum3);
+  for (; n != 0; n--) {
+    const size_t vx = *x++;
+    vsum += t[vx];
+  }
+  return vsum;
+}
+
+static inline __m128i divide(
+    __m128i vn,
+    __m128i vmultiplier,
+    __m128i vshift1,
+    __m128i vshift2,
+    __m128i vmask_odd)
+{
+  // Same computation as fxdiv_quotient_uint32_t, 4 lanes at a time:
+  //   t := (n * m) >> 32
+  //   q := (t + ((n - t) >> s1)) >> s2
+  const __m128i vproduct_even = _mm_mul_epu32(vn, vmultiplier);
+  const __m128i vproduct_odd = _mm_mul_epu32(_mm_srli_epi64(vn, 32), vmultiplier);
+  const __m128i vt = _mm_or_si128(_mm_srli_epi64(vproduct_even, 32), _mm_and_si128(vproduct_odd, vmask_odd));
+  return _mm_srl_epi32(_mm_add_epi32(vt, _mm_srl_epi32(_mm_sub_epi32(vn, vt), vshift1)), vshift2);
+}
+
+void xnn_u8_lut32norm_ukernel__sse2(
+    size_t n,
+    const uint8_t* x,
+    const uint32_t* t,
+    uint8_t* y)
+{
+  assert(n != 0);
+
+  const uint32_t vsum = compute_sum(n, x, t);
+  assert(vsum != 0);
+
+  struct fxdiv_divisor_uint32_t vsum_divisor = fxdiv_init_uint32_t(vsum);
+  const uint32_t vrounding = (vsum >> 1);
+
+  const __m128i vmultiplier = _mm_set1_epi32((int) vsum_divisor.m);
+  const __m128i vshift1 = _mm_cvtsi32_si128((int) vsum_divisor.s1);
+  const __m128i vshift2 = _mm_cvtsi32_si128((int) vsum_divisor.s2);
+  const __m128i vmask_odd = _mm_setr_epi32(0, -1, 0, -1);
+  const __m128i vrounding_x4 = _mm_set1_epi32((int) vrounding);
+  for (; n >= 16; n -= 16) {
+    const __m128i vt0123 = _mm_setr_epi32((int) t[x[0]], (int) t[x[1]], (int) t[x[2]], (int) t[x[3]]);
+    const __m128i vt4567 = _mm_setr_epi32((int) t[x[4]], (int) t[x[5]], (int) t[x[6]], (int) t[x[7]]);
+    const __m128i vt89AB = _mm_setr_epi32((int) t[x[8]], (int) t[x[9]], (int) t[x[10]], (int) t[x[11]]);
+    const __m128i vtCDEF = _mm_setr_epi32((int) t[x[12]], (int) t[x[13]], (int) t[x[14]], (int) t[x[15]]);
+    x += 16;
+
+    const __m128i vn0123 = _mm_add_epi32(_mm_slli_epi32(vt0123, 8), vrounding_x4);
+    const __m128i vn4567 = _mm_add_epi32(_mm_slli_epi32(vt4567, 8), vrounding_x4);
+    const __m128i vn89AB = _mm_add_epi32(_mm_slli_epi32(vt89AB, 8), vrounding_x4);
+    const __m128i vnCDEF = _mm_add_epi32(_mm_slli_epi32(vtCDEF, 8), vrounding_x4);
+
+    const __m128i vq0123 = divide(vn0123, vmultiplier, vshift1, vshift2, vmask_odd);
+    const __m128i vq4567 = divide(vn4567, vmultiplier, vshift1, vshift2, vmask_odd);
+    const __m128i vq89AB = divide(vn89AB, vmultiplier, vshift1, vshift2, vmask_odd);
+    const __m128i vqCDEF = divide(vnCDEF, vmultiplier, vshift1, vshift2, vmask_odd);
+
+    // Quotients do not exceed 256, so signed saturation to 16 bits is exact, and unsigned saturation to 8 bits
+    // clamps 256 to 255.
+    const __m128i vq01234567 = _mm_packs_epi32(vq0123, vq4567);
+    const __m128i vq89ABCDEF = _mm_packs_epi32(vq89AB, vqCDEF);
+    const __m128i vy = _mm_packus_epi16(vq01234567, vq89ABCDEF);
+
+    _mm_storeu_si128((__m128i*) y, vy);
+    y += 16;
+  }
+  for (; n != 0; n--) {
+    const size_t vx = *x++;
+    const uint32_t vt = t[vx];
+    const uint32_t vq = fxdiv_quotient_uint32_t((vt << 8) + vrounding, vsum_divisor);
+    const uint8_t vy = vq > 255 ? UINT8_C(255) : (uint8_t) vq;
+    *y++ = vy;
+  }
+}
@@ -168,33 +168,44 @@ enum xnn_status xnn_setup_unpooling2d_nhwc_x32(
     unpooling_op->kernel_width);
   unpooling_op->output = output;
 
+  const size_t pooling_height = unpooling_op->kernel_height;
+  const size_t pooling_width = unpooling_op->kernel_width;
+  const size_t pooling_size = pooling_height * pooling_width;
+
+  // The indirection buffer stays valid when only the output pointer changes: setup rebases a cached copy of it to the
+  // new output pointer. It is extended incrementally for larger batches of the same output.
   size_t valid_batch_size = 0;
-  if (output == unpooling_op->last_output &&
-      input_height == unpooling_op->last_input_height &&
-      input_width == unpooling_op->last_input_width)
+  if (input_height == unpooling_op->last_input_height &&
+      input_width == unpooling_op->last_input_width &&
+      (output == unpooling_op->last_output || batch_size <= unpooling_op->valid_batch_size))
   {
     valid_batch_size = unpooling_op->valid_batch_size;
-    if (batch_size <= valid_batch_size) {
-      unpooling_op->compute.range[0] = batch_size * input_height;
-      unpooling_op->state = xnn_run_state_ready;
-      return xnn_status_success;
-    }
   }
 
-  const size_t pooling_height = unpooling_op->kernel_height;
-  const size_t pooling_width = unpooling_op->kernel_width;
-  const size_t pooling_size = pooling_height * pooling_width;
+  if (batch_size > valid_batch_size) {
+    const size_t indirection_buffer_size = sizeof(void*) * (batch_size * input_height * input_width * pooling_size);
+
+    void** indirection_buffer = (void**) realloc(unpooling_op->indirection_buffer, indirection_buffer_size);
+    if (indirection_buffer == NULL) {
+      xnn_log_error("failed to allocate %zu bytes for indirection buffer", indirection_buffer_size);
+      return xnn_status_out_of_memory;
+    }
+    unpooling_op->indirection_buffer = (const void**) indirection_buffer;
 
-  const size_t indirection_buffer_size = sizeof(void*) * (batch_size * input_height * input_width * pooling_size);
+    xnn_indirection_init_unpool2d(unpooling_op, valid_batch_size, 2 /* log2(sizeof(type32)) */);
 
-  void** indirection_buffer = (void**) realloc(unpooling_op->indirection_buffer, indirection_buffer_size);
+    unpooling_op->last_output = output;
+    unpooling_op->last_input_height = input_height;
+    unpooling_op->last_input_width = input_width;
+    unpooling_op->valid_batch_size = batch_size;
+  }
+
+  const void** indirection_buffer = xnn_indirection_rebase(
+    unpooling_op, unpooling_op->last_output, output, batch_size * input_height * input_width * pooling_size,
+    NULL /* zero */);
   if (indirection_buffer == NULL) {
-    xnn_log_error("failed to allocate %zu bytes for indirection buffer", indirection_buffer_size);
     return xnn_status_out_of_memory;
   }
-  unpooling_op->indirection_buffer = (const void**) indirection_buffer;
-
-  xnn_indirection_init_unpool2d(unpooling_op, valid_batch_size, 2 /* log2(sizeof(type32)) */);
 
   const size_t channels = unpooling_op->channels;
   const size_t input_pixel_stride_in_bytes = unpooling_op->input_pixel_stride * sizeof(float);
@@ -205,7 +216,7 @@ enum xnn_status xnn_setup_unpooling2d_nhwc_x32(
     .index = index,
     .index_height_stride = input_width * channels * sizeof(uint32_t),
     .index_width_stride = channels * sizeof(uint32_t),
-    .indirect_output = indirection_buffer,
+    .indirect_output = (void**) indirection_buffer,
     .indirect_output_height_stride = input_width * pooling_size * sizeof(void*),
     .indirect_output_width_stride = pooling_size * sizeof(void*),
     .pooling_size = pooling_size,
@@ -219,10 +230,5 @@ enum xnn_status xnn_setup_unpooling2d_nhwc_x32(
   unpooling_op->compute.range[1] = input_width;
   unpooling_op->state = xnn_run_state_ready;
 
-  unpooling_op->last_output = output;
-  unpooling_op->last_input_height = input_height;
-  unpooling_op->last_input_width = input_width;
-  unpooling_op->valid_batch_size = max(valid_batch_size, batch_size);
-
   return xnn_status_success;
 }
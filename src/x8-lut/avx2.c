@@ -0,0 +1,220 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/lut.h>
+
+
+void xnn_x8_lut_ukernel__avx2_x32(
+    size_t n,
+    const uint8_t* x,
+    const uint8_t t[restrict static 256],
+    uint8_t* y)
+{
+  assert(n != 0);
+
+  // VPSHUFB looks up a 16-entry slice of the table in each 128-bit lane, and produces zero for indices with the high
+  // bit set. The 256-entry table is processed as 16 slices T0...T15, and the index is decremented by 16 before each
+  // slice lookup. For the first 9 slices the index wraps around, and for the last 7 slices it saturates at -128. With
+  // this sequence of indices, an element from slice j is looked up in the pre-XORed tables for slices
+  // max(0, j-7)...j, and XORing the lookup results recovers Tj when the tables are transformed as
+  //   D0 = T0, Dk = Tk ^ Tk-1 for k = 1...7, D8 = T8 ^ T7 ^ T0, Dk = Tk ^ Tk-1 ^ Tk-8 ^ Tk-9 for k = 9...15.
+  const __m128i vt0 = _mm_loadu_si128((const __m128i*) t);
+  const __m128i vt1 = _mm_loadu_si128((const __m128i*) (t + 16));
+  const __m128i vt2 = _mm_loadu_si128((const __m128i*) (t + 32));
+  const __m128i vt3 = _mm_loadu_si128((const __m128i*) (t + 48));
+  const __m128i vt4 = _mm_loadu_si128((const __m128i*) (t + 64));
+  const __m128i vt5 = _mm_loadu_si128((const __m128i*) (t + 80));
+  const __m128i vt6 = _mm_loadu_si128((const __m128i*) (t + 96));
+  const __m128i vt7 = _mm_loadu_si128((const __m128i*) (t + 112));
+  const __m128i vt8 = _mm_loadu_si128((const __m128i*) (t + 128));
+  const __m128i vt9 = _mm_loadu_si128((const __m128i*) (t + 144));
+  const __m128i vtA = _mm_loadu_si128((const __m128i*) (t + 160));
+  const __m128i vtB = _mm_loadu_si128((const __m128i*) (t + 176));
+  const __m128i vtC = _mm_loadu_si128((const __m128i*) (t + 192));
+  const __m128i vtD = _mm_loadu_si128((const __m128i*) (t + 208));
+  const __m128i vtE = _mm_loadu_si128((const __m128i*) (t + 224));
+  const __m128i vtF = _mm_loadu_si128((const __m128i*) (t + 240));
+
+  const __m128i vtable0_lo = vt0;
+  const __m128i vtable1_lo = _mm_xor_si128(vt1, vt0);
+  const __m128i vtable2_lo = _mm_xor_si128(vt2, vt1);
+  const __m128i vtable3_lo = _mm_xor_si128(vt3, vt2);
+  const __m128i vtable4_lo = _mm_xor_si128(vt4, vt3);
+  const __m128i vtable5_lo = _mm_xor_si128(vt5, vt4);
+  const __m128i vtable6_lo = _mm_xor_si128(vt6, vt5);
+  const __m128i vtable7_lo = _mm_xor_si128(vt7, vt6);
+  const __m128i vtable8_lo = _mm_xor_si128(_mm_xor_si128(vt8, vt7), vt0);
+  const __m128i vtable9_lo = _mm_xor_si128(_mm_xor_si128(vt9, vt8), vtable1_lo);
+  const __m128i vtableA_lo = _mm_xor_si128(_mm_xor_si128(vtA, vt9), vtable2_lo);
+  const __m128i vtableB_lo = _mm_xor_si128(_mm_xor_si128(vtB, vtA), vtable3_lo);
+  const __m128i vtableC_lo = _mm_xor_si128(_mm_xor_si128(vtC, vtB), vtable4_lo);
+  const __m128i vtableD_lo = _mm_xor_si128(_mm_xor_si128(vtD, vtC), vtable5_lo);
+  const __m128i vtableE_lo = _mm_xor_si128(_mm_xor_si128(vtE, vtD), vtable6_lo);
+  const __m128i vtableF_lo = _mm_xor_si128(_mm_xor_si128(vtF, vtE), vtable7_lo);
+
+  const __m256i vtable0 = _mm256_broadcastsi128_si256(vtable0_lo);
+  const __m256i vtable1 = _mm256_broadcastsi128_si256(vtable1_lo);
+  const __m256i vtable2 = _mm256_broadcastsi128_si256(vtable2_lo);
+  const __m256i vtable3 = _mm256_broadcastsi128_si256(vtable3_lo);
+  const __m256i vtable4 = _mm256_broadcastsi128_si256(vtable4_lo);
+  const __m256i vtable5 = _mm256_broadcastsi128_si256(vtable5_lo);
+  const __m256i vtable6 = _mm256_broadcastsi128_si256(vtable6_lo);
+  const __m256i vtable7 = _mm256_broadcastsi128_si256(vtable7_lo);
+  const __m256i vtable8 = _mm256_broadcastsi128_si256(vtable8_lo);
+  const __m256i vtable9 = _mm256_broadcastsi128_si256(vtable9_lo);
+  const __m256i vtableA = _mm256_broadcastsi128_si256(vtableA_lo);
+  const __m256i vtableB = _mm256_broadcastsi128_si256(vtableB_lo);
+  const __m256i vtableC = _mm256_broadcastsi128_si256(vtableC_lo);
+  const __m256i vtableD = _mm256_broadcastsi128_si256(vtableD_lo);
+  const __m256i vtableE = _mm256_broadcastsi128_si256(vtableE_lo);
+  const __m256i vtableF = _mm256_broadcastsi128_si256(vtableF_lo);
+
+  const __m256i voffset = _mm256_set1_epi8(16);
+  for (; n >= 32 * sizeof(uint8_t); n -= 32 * sizeof(uint8_t)) {
+    __m256i vx = _mm256_loadu_si256((const __m256i*) x);
+    x += 32;
+
+    __m256i vy = _mm256_shuffle_epi8(vtable0, vx);
+
+    vx = _mm256_sub_epi8(vx, voffset);
+    vy = _mm256_xor_si256(vy, _mm256_shuffle_epi8(vtable1, vx));
+    vx = _mm256_sub_epi8(vx, voffset);
+    vy = _mm256_xor_si256(vy, _mm256_shuffle_epi8(vtable2, vx));
+    vx = _mm256_sub_epi8(vx, voffset);
+    vy = _mm256_xor_si256(vy, _mm256_shuffle_epi8(vtable3, vx));
+    vx = _mm256_sub_epi8(vx, voffset);
+    vy = _mm256_xor_si256(vy, _mm256_shuffle_epi8(vtable4, vx));
+    vx = _mm256_sub_epi8(vx, voffset);
+    vy = _mm256_xor_si256(vy, _mm256_shuffle_epi8(vtable5, vx));
+    vx = _mm256_sub_epi8(vx, voffset);
+    vy = _mm256_xor_si256(vy, _mm256_shuffle_epi8(vtable6, vx));
+    vx = _mm256_sub_epi8(vx, voffset);
+    vy = _mm256_xor_si256(vy, _mm256_shuffle_epi8(vtable7, vx));
+    vx = _mm256_sub_epi8(vx, voffset);
+    vy = _mm256_xor_si256(vy, _mm256_shuffle_epi8(vtable8, vx));
+
+    vx = _mm256_subs_epi8(vx, voffset);
+    vy = _mm256_xor_si256(vy, _mm256_shuffle_epi8(vtable9, vx));
+    vx = _mm256_subs_epi8(vx, voffset);
+    vy = _mm256_xor_si256(vy, _mm256_shuffle_epi8(vtableA, vx));
+    vx = _mm256_subs_epi8(vx, voffset);
+    vy = _mm256_xor_si256(vy, _mm256_shuffle_epi8(vtableB, vx));
+    vx = _mm256_subs_epi8(vx, voffset);
+    vy = _mm256_xor_si256(vy, _mm256_shuffle_epi8(vtableC, vx));
+    vx = _mm256_subs_epi8(vx, voffset);
+    vy = _mm256_xor_si256(vy, _mm256_shuffle_epi8(vtableD, vx));
+    vx = _mm256_subs_epi8(vx, voffset);
+    vy = _mm256_xor_si256(vy, _mm256_shuffle_epi8(vtableE, vx));
+    vx = _mm256_subs_epi8(vx, voffset);
+    vy = _mm256_xor_si256(vy, _mm256_shuffle_epi8(vtableF, vx));
+
+    _mm256_storeu_si256((__m256i*) y, vy);
+    y += 32;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    const __m128i voffset_lo = _mm256_castsi256_si128(voffset);
+    if (n & (16 * sizeof(uint8_t))) {
+      __m128i vx = _mm_loadu_si128((const __m128i*) x);
+      x += 16;
+
+      __m128i vy = _mm_shuffle_epi8(vtable0_lo, vx);
+
+      vx = _mm_sub_epi8(vx, voffset_lo);
+      vy = _mm_xor_si128(vy, _mm_shuffle_epi8(vtable1_lo, vx));
+      vx = _mm_sub_epi8(vx, voffset_lo);
+      vy = _mm_xor_si128(vy, _mm_shuffle_epi8(vtable2_lo, vx));
+      vx = _mm_sub_epi8(vx, voffset_lo);
+      vy = _mm_xor_si128(vy, _mm_shuffle_epi8(vtable3_lo, vx));
+      vx = _mm_sub_epi8(vx, voffset_lo);
+      vy = _mm_xor_si128(vy, _mm_shuffle_epi8(vtable4_lo, vx));
+      vx = _mm_sub_epi8(vx, voffset_lo);
+      vy = _mm_xor_si128(vy, _mm_shuffle_epi8(vtable5_lo, vx));
+      vx = _mm_sub_epi8(vx, voffset_lo);
+      vy = _mm_xor_si128(vy, _mm_shuffle_epi8(vtable6_lo, vx));
+      vx = _mm_sub_epi8(vx, voffset_lo);
+      vy = _mm_xor_si128(vy, _mm_shuffle_epi8(vtable7_lo, vx));
+      vx = _mm_sub_epi8(vx, voffset_lo);
+      vy = _mm_xor_si128(vy, _mm_shuffle_epi8(vtable8_lo, vx));
+
+      vx = _mm_subs_epi8(vx, voffset_lo);
+      vy = _mm_xor_si128(vy, _mm_shuffle_epi8(vtable9_lo, vx));
+      vx = _mm_subs_epi8(vx, voffset_lo);
+      vy = _mm_xor_si128(vy, _mm_shuffle_epi8(vtableA_lo, vx));
+      vx = _mm_subs_epi8(vx, voffset_lo);
+      vy = _mm_xor_si128(vy, _mm_shuffle_epi8(vtableB_lo, vx));
+      vx = _mm_subs_epi8(vx, voffset_lo);
+      vy = _mm_xor_si128(vy, _mm_shuffle_epi8(vtableC_lo, vx));
+      vx = _mm_subs_epi8(vx, voffset_lo);
+      vy = _mm_xor_si128(vy, _mm_shuffle_epi8(vtableD_lo, vx));
+      vx = _mm_subs_epi8(vx, voffset_lo);
+      vy = _mm_xor_si128(vy, _mm_shuffle_epi8(vtableE_lo, vx));
+      vx = _mm_subs_epi8(vx, voffset_lo);
+      vy = _mm_xor_si128(vy, _mm_shuffle_epi8(vtableF_lo, vx));
+
+      _mm_storeu_si128((__m128i*) y, vy);
+      y += 16;
+    }
+    if (n & (15 * sizeof(uint8_t))) {
+      __m128i vx = _mm_loadu_si128((const __m128i*) x);
+
+      __m128i vy = _mm_shuffle_epi8(vtable0_lo, vx);
+
+      vx = _mm_sub_epi8(vx, voffset_lo);
+      vy = _mm_xor_si128(vy, _mm_shuffle_epi8(vtable1_lo, vx));
+      vx = _mm_sub_epi8(vx, voffset_lo);
+      vy = _mm_xor_si128(vy, _mm_shuffle_epi8(vtable2_lo, vx));
+      vx = _mm_sub_epi8(vx, voffset_lo);
+      vy = _mm_xor_si128(vy, _mm_shuffle_epi8(vtable3_lo, vx));
+      vx = _mm_sub_epi8(vx, voffset_lo);
+      vy = _mm_xor_si128(vy, _mm_shuffle_epi8(vtable4_lo, vx));
+      vx = _mm_sub_epi8(vx, voffset_lo);
+      vy = _mm_xor_si128(vy, _mm_shuffle_epi8(vtable5_lo, vx));
+      vx = _mm_sub_epi8(vx, voffset_lo);
+      vy = _mm_xor_si128(vy, _mm_shuffle_epi8(vtable6_lo, vx));
+      vx = _mm_sub_epi8(vx, voffset_lo);
+      vy = _mm_xor_si128(vy, _mm_shuffle_epi8(vtable7_lo, vx));
+      vx = _mm_sub_epi8(vx, voffset_lo);
+      vy = _mm_xor_si128(vy, _mm_shuffle_epi8(vtable8_lo, vx));
+
+      vx = _mm_subs_epi8(vx, voffset_lo);
+      vy = _mm_xor_si128(vy, _mm_shuffle_epi8(vtable9_lo, vx));
+      vx = _mm_subs_epi8(vx, voffset_lo);
+      vy = _mm_xor_si128(vy, _mm_shuffle_epi8(vtableA_lo, vx));
+      vx = _mm_subs_epi8(vx, voffset_lo);
+      vy = _mm_xor_si128(vy, _mm_shuffle_epi8(vtableB_lo, vx));
+      vx = _mm_subs_epi8(vx, voffset_lo);
+      vy = _mm_xor_si128(vy, _mm_shuffle_epi8(vtableC_lo, vx));
+      vx = _mm_subs_epi8(vx, voffset_lo);
+      vy = _mm_xor_si128(vy, _mm_shuffle_epi8(vtableD_lo, vx));
+      vx = _mm_subs_epi8(vx, voffset_lo);
+      vy = _mm_xor_si128(vy, _mm_shuffle_epi8(vtableE_lo, vx));
+      vx = _mm_subs_epi8(vx, voffset_lo);
+      vy = _mm_xor_si128(vy, _mm_shuffle_epi8(vtableF_lo, vx));
+
+      if (n & (8 * sizeof(uint8_t))) {
+        _mm_storel_epi64((__m128i*) y, vy);
+        vy = _mm_unpackhi_epi64(vy, vy);
+        y += 8;
+      }
+      if (n & (4 * sizeof(uint8_t))) {
+        *((uint32_t*) y) = (uint32_t) _mm_cvtsi128_si32(vy);
+        vy = _mm_srli_epi64(vy, 32);
+        y += 4;
+      }
+      if (n & (2 * sizeof(uint8_t))) {
+        *((uint16_t*) y) = (uint16_t) _mm_extract_epi16(vy, 0);
+        vy = _mm_srli_epi32(vy, 16);
+        y += 2;
+      }
+      if (n & (1 * sizeof(uint8_t))) {
+        *y = (uint8_t) _mm_cvtsi128_si32(vy);
+      }
+    }
+  }
+}
@@ -0,0 +1,226 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/lut.h>
+
+
+void xnn_x8_lut_ukernel__neon_x16(
+    size_t n,
+    const uint8_t* x,
+    const uint8_t t[restrict static 256],
+    uint8_t* y)
+{
+  assert(n != 0);
+
+#if XNN_ARCH_ARM64
+  // TBL looks up a 64-entry slice of the table and produces zero for out-of-range indices, and TBX keeps the
+  // destination element for out-of-range indices. The index is decremented by 64 (with wrap-around) before each of
+  // the following slice lookups, so exactly one of the four lookups is in range for every index.
+  uint8x16x4_t vtable0;
+  vtable0.val[0] = vld1q_u8(t);
+  vtable0.val[1] = vld1q_u8(t + 16);
+  vtable0.val[2] = vld1q_u8(t + 32);
+  vtable0.val[3] = vld1q_u8(t + 48);
+  uint8x16x4_t vtable1;
+  vtable1.val[0] = vld1q_u8(t + 64);
+  vtable1.val[1] = vld1q_u8(t + 80);
+  vtable1.val[2] = vld1q_u8(t + 96);
+  vtable1.val[3] = vld1q_u8(t + 112);
+  uint8x16x4_t vtable2;
+  vtable2.val[0] = vld1q_u8(t + 128);
+  vtable2.val[1] = vld1q_u8(t + 144);
+  vtable2.val[2] = vld1q_u8(t + 160);
+  vtable2.val[3] = vld1q_u8(t + 176);
+  uint8x16x4_t vtable3;
+  vtable3.val[0] = vld1q_u8(t + 192);
+  vtable3.val[1] = vld1q_u8(t + 208);
+  vtable3.val[2] = vld1q_u8(t + 224);
+  vtable3.val[3] = vld1q_u8(t + 240);
+
+  const uint8x16_t voffset = vmovq_n_u8(64);
+  for (; n >= 16 * sizeof(uint8_t); n -= 16 * sizeof(uint8_t)) {
+    uint8x16_t vx = vld1q_u8(x); x += 16;
+
+    uint8x16_t vy = vqtbl4q_u8(vtable0, vx);
+    vx = vsubq_u8(vx, voffset);
+    vy = vqtbx4q_u8(vy, vtable1, vx);
+    vx = vsubq_u8(vx, voffset);
+    vy = vqtbx4q_u8(vy, vtable2, vx);
+    vx = vsubq_u8(vx, voffset);
+    vy = vqtbx4q_u8(vy, vtable3, vx);
+
+    vst1q_u8(y, vy); y += 16;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    uint8x16_t vx = vld1q_u8(x);
+
+    uint8x16_t vy = vqtbl4q_u8(vtable0, vx);
+    vx = vsubq_u8(vx, voffset);
+    vy = vqtbx4q_u8(vy, vtable1, vx);
+    vx = vsubq_u8(vx, voffset);
+    vy = vqtbx4q_u8(vy, vtable2, vx);
+    vx = vsubq_u8(vx, voffset);
+    vy = vqtbx4q_u8(vy, vtable3, vx);
+
+    uint8x8_t vy_lo = vget_low_u8(vy);
+    if (n & (8 * sizeof(uint8_t))) {
+      vst1_u8(y, vy_lo); y += 8;
+      vy_lo = vget_high_u8(vy);
+    }
+    if (n & (4 * sizeof(uint8_t))) {
+      vst1_lane_u32(__builtin_assume_aligned(y, 1), vreinterpret_u32_u8(vy_lo), 0); y += 4;
+      vy_lo = vext_u8(vy_lo, vy_lo, 4);
+    }
+    if (n & (2 * sizeof(uint8_t))) {
+      vst1_lane_u16(__builtin_assume_aligned(y, 1), vreinterpret_u16_u8(vy_lo), 0); y += 2;
+      vy_lo = vext_u8(vy_lo, vy_lo, 2);
+    }
+    if (n & (1 * sizeof(uint8_t))) {
+      vst1_lane_u8(y, vy_lo, 0);
+    }
+  }
+#else
+  // VTBL looks up a 32-entry slice of the table and produces zero for out-of-range indices, and VTBX keeps the
+  // destination element for out-of-range indices. The index is decremented by 32 (with wrap-around) before each of
+  // the following slice lookups, so exactly one of the eight lookups is in range for every index.
+  uint8x8x4_t vtable0;
+  vtable0.val[0] = vld1_u8(t);
+  vtable0.val[1] = vld1_u8(t + 8);
+  vtable0.val[2] = vld1_u8(t + 16);
+  vtable0.val[3] = vld1_u8(t + 24);
+  uint8x8x4_t vtable1;
+  vtable1.val[0] = vld1_u8(t + 32);
+  vtable1.val[1] = vld1_u8(t + 40);
+  vtable1.val[2] = vld1_u8(t + 48);
+  vtable1.val[3] = vld1_u8(t + 56);
+  uint8x8x4_t vtable2;
+  vtable2.val[0] = vld1_u8(t + 64);
+  vtable2.val[1] = vld1_u8(t + 72);
+  vtable2.val[2] = vld1_u8(t + 80);
+  vtable2.val[3] = vld1_u8(t + 88);
+  uint8x8x4_t vtable3;
+  vtable3.val[0] = vld1_u8(t + 96);
+  vtable3.val[1] = vld1_u8(t + 104);
+  vtable3.val[2] = vld1_u8(t + 112);
+  vtable3.val[3] = vld1_u8(t + 120);
+  uint8x8x4_t vtable4;
+  vtable4.val[0] = vld1_u8(t + 128);
+  vtable4.val[1] = vld1_u8(t + 136);
+  vtable4.val[2] = vld1_u8(t + 144);
+  vtable4.val[3] = vld1_u8(t + 152);
+  uint8x8x4_t vtable5;
+  vtable5.val[0] = vld1_u8(t + 160);
+  vtable5.val[1] = vld1_u8(t + 168);
+  vtable5.val[2] = vld1_u8(t + 176);
+  vtable5.val[3] = vld1_u8(t + 184);
+  uint8x8x4_t vtable6;
+  vtable6.val[0] = vld1_u8(t + 192);
+  vtable6.val[1] = vld1_u8(t + 200);
+  vtable6.val[2] = vld1_u8(t + 208);
+  vtable6.val[3] = vld1_u8(t + 216);
+  uint8x8x4_t vtable7;
+  vtable7.val[0] = vld1_u8(t + 224);
+  vtable7.val[1] = vld1_u8(t + 232);
+  vtable7.val[2] = vld1_u8(t + 240);
+  vtable7.val[3] = vld1_u8(t + 248);
+
+  const uint8x8_t voffset = vmov_n_u8(32);
+  for (; n >= 16 * sizeof(uint8_t); n -= 16 * sizeof(uint8_t)) {
+    uint8x8_t vx_lo = vld1_u8(x); x += 8;
+    uint8x8_t vx_hi = vld1_u8(x); x += 8;
+
+    uint8x8_t vy_lo = vtbl4_u8(vtable0, vx_lo);
+    uint8x8_t vy_hi = vtbl4_u8(vtable0, vx_hi);
+    vx_lo = vsub_u8(vx_lo, voffset);
+    vx_hi = vsub_u8(vx_hi, voffset);
+    vy_lo = vtbx4_u8(vy_lo, vtable1, vx_lo);
+    vy_hi = vtbx4_u8(vy_hi, vtable1, vx_hi);
+    vx_lo = vsub_u8(vx_lo, voffset);
+    vx_hi = vsub_u8(vx_hi, voffset);
+    vy_lo = vtbx4_u8(vy_lo, vtable2, vx_lo);
+    vy_hi = vtbx4_u8(vy_hi, vtable2, vx_hi);
+    vx_lo = vsub_u8(vx_lo, voffset);
+    vx_hi = vsub_u8(vx_hi, voffset);
+    vy_lo = vtbx4_u8(vy_lo, vtable3, vx_lo);
+    vy_hi = vtbx4_u8(vy_hi, vtable3, vx_hi);
+    vx_lo = vsub_u8(vx_lo, voffset);
+    vx_hi = vsub_u8(vx_hi, voffset);
+    vy_lo = vtbx4_u8(vy_lo, vtable4, vx_lo);
+    vy_hi = vtbx4_u8(vy_hi, vtable4, vx_hi);
+    vx_lo = vsub_u8(vx_lo, voffset);
+    vx_hi = vsub_u8(vx_hi, voffset);
+    vy_lo = vtbx4_u8(vy_lo, vtable5, vx_lo);
+    vy_hi = vtbx4_u8(vy_hi, vtable5, vx_hi);
+    vx_lo = vsub_u8(vx_lo, voffset);
+    vx_hi = vsub_u8(vx_hi, voffset);
+    vy_lo = vtbx4_u8(vy_lo, vtable6, vx_lo);
+    vy_hi = vtbx4_u8(vy_hi, vtable6, vx_hi);
+    vx_lo = vsub_u8(vx_lo, voffset);
+    vx_hi = vsub_u8(vx_hi, voffset);
+    vy_lo = vtbx4_u8(vy_lo, vtable7, vx_lo);
+    vy_hi = vtbx4_u8(vy_hi, vtable7, vx_hi);
+
+    vst1_u8(y, vy_lo); y += 8;
+    vst1_u8(y, vy_hi); y += 8;
+  }
+  if (n & (8 * sizeof(uint8_t))) {
+    uint8x8_t vx = vld1_u8(x); x += 8;
+
+    uint8x8_t vy = vtbl4_u8(vtable0, vx);
+    vx = vsub_u8(vx, voffset);
+    vy = vtbx4_u8(vy, vtable1, vx);
+    vx = vsub_u8(vx, voffset);
+    vy = vtbx4_u8(vy, vtable2, vx);
+    vx = vsub_u8(vx, voffset);
+    vy = vtbx4_u8(vy, vtable3, vx);
+    vx = vsub_u8(vx, voffset);
+    vy = vtbx4_u8(vy, vtable4, vx);
+    vx = vsub_u8(vx, voffset);
+    vy = vtbx4_u8(vy, vtable5, vx);
+    vx = vsub_u8(vx, voffset);
+    vy = vtbx4_u8(vy, vtable6, vx);
+    vx = vsub_u8(vx, voffset);
+    vy = vtbx4_u8(vy, vtable7, vx);
+
+    vst1_u8(y, vy); y += 8;
+  }
+  if XNN_UNLIKELY((n & (7 * sizeof(uint8_t))) != 0) {
+    uint8x8_t vx = vld1_u8(x);
+
+    uint8x8_t vy_lo = vtbl4_u8(vtable0, vx);
+    vx = vsub_u8(vx, voffset);
+    vy_lo = vtbx4_u8(vy_lo, vtable1, vx);
+    vx = vsub_u8(vx, voffset);
+    vy_lo = vtbx4_u8(vy_lo, vtable2, vx);
+    vx = vsub_u8(vx, voffset);
+    vy_lo = vtbx4_u8(vy_lo, vtable3, vx);
+    vx = vsub_u8(vx, voffset);
+    vy_lo = vtbx4_u8(vy_lo, vtable4, vx);
+    vx = vsub_u8(vx, voffset);
+    vy_lo = vtbx4_u8(vy_lo, vtable5, vx);
+    vx = vsub_u8(vx, voffset);
+    vy_lo = vtbx4_u8(vy_lo, vtable6, vx);
+    vx = vsub_u8(vx, voffset);
+    vy_lo = vtbx4_u8(vy_lo, vtable7, vx);
+
+    if (n & (4 * sizeof(uint8_t))) {
+      vst1_lane_u32(__builtin_assume_aligned(y, 1), vreinterpret_u32_u8(vy_lo), 0); y += 4;
+      vy_lo = vext_u8(vy_lo, vy_lo, 4);
+    }
+    if (n & (2 * sizeof(uint8_t))) {
+      vst1_lane_u16(__builtin_assume_aligned(y, 1), vreinterpret_u16_u8(vy_lo), 0); y += 2;
+      vy_lo = vext_u8(vy_lo, vy_lo, 2);
+    }
+    if (n & (1 * sizeof(uint8_t))) {
+      vst1_lane_u8(y, vy_lo, 0);
+    }
+  }
+#endif  // XNN_ARCH_ARM64
+}
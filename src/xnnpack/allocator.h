@@ -17,7 +17,12 @@
 extern int posix_memalign(void **memptr, size_t alignment, size_t size);
 
 
-#define XNN_ALLOCATION_ALIGNMENT 16
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  // AVX and AVX512 micro-kernels use aligned 256-bit and 512-bit loads of packed weights.
+  #define XNN_ALLOCATION_ALIGNMENT 64
+#else
+  #define XNN_ALLOCATION_ALIGNMENT 16
+#endif
 
 
 inline static void* xnn_allocate_memory(size_t memory_size) {
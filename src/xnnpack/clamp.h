@@ -19,6 +19,18 @@ extern "C" {
 #endif
 
 
+#define DECLARE_F16_CLAMP_UKERNEL_FUNCTION(fn_name)   \
+  XNN_INTERNAL void fn_name(                          \
+      size_t n,                                       \
+      const void* x,                                  \
+      void* y,                                        \
+      const struct xnn_f16_output_params* params);
+
+DECLARE_F16_CLAMP_UKERNEL_FUNCTION(xnn_f16_clamp_ukernel__f16c)
+DECLARE_F16_CLAMP_UKERNEL_FUNCTION(xnn_f16_clamp_ukernel__neonfp16arith)
+DECLARE_F16_CLAMP_UKERNEL_FUNCTION(xnn_f16_clamp_ukernel__scalar)
+
+
 #define DECLARE_F32_CLAMP_UKERNEL_FUNCTION(fn_name)   \
   XNN_INTERNAL void fn_name(                          \
       size_t n,                                       \
@@ -28,6 +28,13 @@ enum xnn_parallelization_type {
   xnn_parallelization_type_6d_tile_2d,
 };
 
+// Maximum number of indirection pointers a compute function expands from a compact indirection buffer at once. Setup
+// uses a regular indirection buffer instead if a single output pixel reads more pointers than that.
+#define XNN_MAX_REBASED_INDIRECTION_POINTERS 1024
+
+// Entry of a compact indirection buffer which refers to the zero buffer rather than an input element.
+#define XNN_COMPACT_INDIRECTION_ZERO UINT32_MAX
+
 struct compute_parameters {
   enum xnn_parallelization_type type;
   union {
@@ -59,7 +66,9 @@ struct gemm_context {
   uint32_t log2_csize;
   xnn_gemm_ukernel_function ukernel;
   union {
+    struct xnn_f16_output_params f16;
     union xnn_q8_gemm_params q8;
+    union xnn_q8c_gemm_params q8c;
     union xnn_f32_output_params f32;
   } params;
 };
@@ -81,6 +90,184 @@ struct gemm_context {
       size_t nr_block_size);
 #endif
 
+// Context for split-K GEMM: C [MxN] := A [MxK] * B [KxN] + bias [N], with K split into slices.
+// The first pass computes the GEMM for every K slice: the first slice (with bias) directly into C, and other slices
+// into partial_c. The second pass accumulates the partial results into C and applies the output activation.
+struct splitk_gemm_context {
+  // Number of rows in A and C, at most MR of the micro-kernels.
+  size_t m;
+  // K dimension of the A matrix, in bytes.
+  size_t k_scaled;
+  // Number of bytes of A in one K slice.
+  size_t a_slice_stride;
+  // Number of bytes of packed weights in one K slice of an NR block.
+  size_t w_slice_stride;
+  // Number of bytes of bias at the start of an NR block of packed weights.
+  size_t w_bias_stride;
+  const void* a;
+  size_t a_stride;
+  const void* packed_w;
+  size_t w_stride;
+  void* c;
+  size_t cm_stride;
+  void* partial_c;
+  size_t partial_cm_stride;
+  // Stride, in bytes, between partial results of consecutive K slices.
+  size_t partial_cs_stride;
+  size_t num_slices;
+  // Zero-initialized MR x NR accumulator tile for the GEMMINC micro-kernel.
+  const void* zero_acc;
+  size_t nr;
+  size_t cn_stride;
+  uint32_t log2_csize;
+  xnn_gemm_ukernel_function gemm_ukernel;
+  xnn_gemminc_ukernel_function gemminc_ukernel;
+  xnn_vadd_ukernel_function vadd_ukernel;
+  // Parameters without output activation for the partial results.
+  union {
+    union xnn_f32_output_params f32;
+  } params;
+  // Parameters with output activation for the final accumulation pass.
+  union {
+    union xnn_f32_output_params f32;
+  } output_params;
+};
+
+#ifndef __cplusplus
+  XNN_PRIVATE void xnn_compute_splitk_gemm(
+      const struct splitk_gemm_context context[restrict static 1],
+      size_t slice_index,
+      size_t nr_block_start,
+      size_t nr_block_size);
+
+  XNN_PRIVATE void xnn_compute_splitk_reduce(
+      const struct splitk_gemm_context context[restrict static 1],
+      size_t m_index,
+      size_t n_block_start,
+      size_t n_block_size);
+#endif
+
+// Context for cache-blocked GEMM: C [MxN] := A [MxK] * B [KxN] + bias [N], with K split into KC blocks.
+// Every task computes an MC x NC block of C: for each KC block, every KC x NR panel of packed weights is multiplied by
+// all MR-row tiles of A in the MC block while it is resident in L1 cache. MR x NR tiles of intermediate results are
+// accumulated in acc_c, and the last KC block writes the results into C with output activation.
+struct blocked_gemm_context {
+  // K dimension of the A matrix, in bytes.
+  size_t k_scaled;
+  // Number of bytes of A in one KC block.
+  size_t kc_scaled;
+  const void* a;
+  size_t a_stride;
+  const void* packed_w;
+  size_t w_stride;
+  // Number of bytes of bias at the start of an NR block of packed weights.
+  size_t w_bias_stride;
+  void* c;
+  size_t cm_stride;
+  size_t cn_stride;
+  // MR x NR tiles of intermediate results. The tile for rows [m, m + MR) and columns [n, n + NR) starts at offset
+  // (m / MR) * acc_m_stride + (n / NR) * acc_n_stride.
+  void* acc_c;
+  size_t acc_m_stride;
+  size_t acc_n_stride;
+  size_t mr;
+  size_t nr;
+  uint32_t log2_csize;
+  xnn_gemm_ukernel_function gemm_ukernel;
+  xnn_gemminc_ukernel_function gemminc_ukernel;
+  // Parameters without output activation for the intermediate results.
+  union {
+    union xnn_f32_output_params f32;
+  } params;
+  // Parameters with output activation for the last KC block.
+  union {
+    union xnn_f32_output_params f32;
+  } output_params;
+};
+
+#ifndef __cplusplus
+  XNN_PRIVATE void xnn_compute_blocked_gemm(
+      const struct blocked_gemm_context context[restrict static 1],
+      size_t mc_block_start,
+      size_t nc_block_start,
+      size_t mc_block_size,
+      size_t nc_block_size);
+#endif
+
+// Context for Pre-packed Matrix-Matrix Multiplication.
+// The first pass packs MR-row panels of A into packed_a, and the second pass multiplies the packed panels by packed_w.
+struct ppmm_context {
+  // K dimension of the A matrix, in elements.
+  size_t k;
+  // K dimension of the A matrix, in bytes.
+  size_t k_scaled;
+  const void* a;
+  size_t a_stride;
+  // Packed A panels. The panel for rows [m, m + MR) starts at offset m * k_scaled.
+  void* packed_a;
+  const void* packed_w;
+  size_t w_stride;
+  void* c;
+  size_t cm_stride;
+  size_t cn_stride;
+  uint32_t log2_csize;
+  xnn_packx_ukernel_function packx_ukernel;
+  xnn_ppmm_ukernel_function ppmm_ukernel;
+  union {
+    union xnn_f32_output_params f32;
+  } params;
+};
+
+#ifndef __cplusplus
+  XNN_PRIVATE void xnn_compute_packx(
+      const struct ppmm_context context[restrict static 1],
+      size_t mr_block_start,
+      size_t mr_block_size);
+
+  XNN_PRIVATE void xnn_compute_ppmm(
+      const struct ppmm_context context[restrict static 1],
+      size_t mr_block_start,
+      size_t nr_block_start,
+      size_t mr_block_size,
+      size_t nr_block_size);
+#endif
+
+// Context for GEMM with dynamically quantized A: rows of the F32 A matrix are quantized to Q8 with per-row scales,
+// multiplied by Q8 B in integer arithmetic, and the results are dequantized to F32.
+struct dqgemm_context {
+  // K dimension of the A matrix, in elements.
+  size_t k;
+  const float* a;
+  size_t a_stride;
+  // Quantized A rows, k bytes each.
+  uint8_t* quantized_a;
+  // Dequantization scales of the quantized A rows, pre-multiplied by the scale of B.
+  float* scale;
+  float kernel_scale;
+  const void* packed_w;
+  size_t w_stride;
+  float* c;
+  size_t cm_stride;
+  size_t cn_stride;
+  xnn_f32_rmax_ukernel_function rabsmax_ukernel;
+  xnn_f32_vquantize_ukernel_function vquantize_ukernel;
+  xnn_q8dq_gemm_ukernel_function ukernel;
+  union xnn_q8dq_gemm_params params;
+};
+
+#ifndef __cplusplus
+  XNN_PRIVATE void xnn_compute_dqgemm_quantize(
+      const struct dqgemm_context context[restrict static 1],
+      size_t m);
+
+  XNN_PRIVATE void xnn_compute_dqgemm(
+      const struct dqgemm_context context[restrict static 1],
+      size_t mr_block_start,
+      size_t nr_block_start,
+      size_t mr_block_size,
+      size_t nr_block_size);
+#endif
+
 // Context for Sparse Matrix-Dense Matrix Multiplication.
 // C [MxN] := A [MxK] * B [KxN] + bias [N]
 // A and C are dense matrices with row-major storage, B is a sparse matrix.
@@ -102,6 +289,25 @@ struct spmm_context {
   size_t batched_a_stride;
   // Stride, in bytes, between matrices C corresponding to different images in batched 1x1 Convolution
   size_t batched_c_stride;
+  // Input tensor of 1x1 Convolution with subsampling or padding. Pixels read by the Convolution are gathered into
+  // matrix A, with [output_height x output_width] elements per input channel, before the multiplication.
+  const void* input;
+  size_t input_height;
+  size_t input_width;
+  size_t input_channels;
+  // Stride, in bytes, between input channels.
+  size_t input_channel_stride;
+  // Stride, in bytes, between images in the input tensor.
+  size_t input_batch_stride;
+  size_t output_width;
+  size_t subsampling_height;
+  size_t subsampling_width;
+  size_t padding_top;
+  size_t padding_left;
+  // Start of the gathered matrix A, including input channels before the first non-zero kernel element.
+  void* packed_a;
+  // Stride, in bytes, between input channels in the gathered matrix A.
+  size_t packed_a_channel_stride;
   // Micro-kernel function pointer.
   xnn_spmm_ukernel_function ukernel;
   // Output activation parameters.
@@ -116,6 +322,52 @@ struct spmm_context {
     size_t batch_index,
     size_t mr_block_start,
     size_t mr_block_size);
+
+  XNN_PRIVATE void xnn_compute_subsampled_spmm(
+    const struct spmm_context context[restrict static 1],
+    size_t batch_index,
+    size_t mr_block_start,
+    size_t mr_block_size);
+#endif
+
+// Context for Sparse Matrix-Dense Matrix Multiplication with NHWC layout of A and C.
+// C [MxN] := A [MxK] * B [KxN] + bias [N]
+// A and C are dense matrices with strided rows (pixels), B is a sparse matrix. Every MR-row block of A is transposed
+// into a [KxMR] panel for the SpMM micro-kernel, and the [NxMR] result is transposed back into rows of C.
+struct nhwc_spmm_context {
+  // K dimension of the A and B matrices.
+  size_t k;
+  // N dimension of the B and C matrices.
+  size_t n;
+  const void* a;
+  size_t a_stride;
+  // Packed bias elements and non-zero filter elements.
+  const void* packed_weights;
+  // Input pointer increments, in bytes, after each processed non-zero block, pre-multiplied by the panel stride.
+  const int32_t* input_increments;
+  // Number of non-zero blocks per each block of output channels.
+  const uint32_t* output_channel_nonzeros;
+  // Input channel corresponding to the first non-zero block.
+  size_t first_input_channel;
+  void* c;
+  size_t c_stride;
+  // Work buffer with [KxMR] transposed A panel followed by [NxMR] transposed C block for every MR-row block.
+  void* workspace;
+  size_t workspace_stride;
+  size_t mr;
+  // Micro-kernel function pointer.
+  xnn_spmm_ukernel_function ukernel;
+  // Output activation parameters.
+  union {
+    union xnn_f32_output_params f32;
+  } params;
+};
+
+#ifndef __cplusplus
+  XNN_PRIVATE void xnn_compute_nhwc_spmm(
+    const struct nhwc_spmm_context context[restrict static 1],
+    size_t mr_block_start,
+    size_t mr_block_size);
 #endif
 
 struct igemm_context {
@@ -123,8 +375,15 @@ struct igemm_context {
   size_t ks_scaled;
   size_t kc;
   size_t w_stride;
-  const void** indirect_a;
+  union {
+    const void** indirect_a;
+    // Offsets of input elements relative to the input image, in compact indirection mode.
+    const uint32_t* compact_indirect_a;
+  };
   size_t a_offset;
+  // Input and log2(input element size), only used in compact indirection mode.
+  const void* a;
+  uint32_t log2_asize;
   void* zero;
   const void* packed_w;
   void* c;
@@ -138,7 +397,9 @@ struct igemm_context {
   uint32_t log2_csize;
   xnn_igemm_ukernel_function ukernel;
   union {
+    struct xnn_f16_output_params f16;
     union xnn_q8_gemm_params q8;
+    union xnn_q8c_gemm_params q8c;
     union xnn_f32_output_params f32;
   } params;
 };
@@ -160,6 +421,23 @@ struct igemm_context {
       size_t nr_block_start,
       size_t mr_block_size,
       size_t nr_block_size);
+
+  XNN_PRIVATE void xnn_compute_gigemm_compact(
+      const struct igemm_context context[restrict static 1],
+      size_t batch_index,
+      size_t group_index,
+      size_t mr_block_start,
+      size_t nr_block_start,
+      size_t mr_block_size,
+      size_t nr_block_size);
+
+  XNN_PRIVATE void xnn_compute_igemm_compact(
+      const struct igemm_context context[restrict static 1],
+      size_t batch_index,
+      size_t mr_block_start,
+      size_t nr_block_start,
+      size_t mr_block_size,
+      size_t nr_block_size);
 #endif
 
 struct subconv_context {
@@ -179,6 +457,7 @@ struct subconv_context {
   xnn_igemm_ukernel_function ukernel;
   union {
     union xnn_q8_gemm_params q8;
+    union xnn_q8c_gemm_params q8c;
     union xnn_f32_output_params f32;
   } params;
 };
@@ -237,20 +516,36 @@ struct dconv2d_context {
 
 struct dwconv_context {
   size_t groups;
-  const void** indirection_buffer;
+  union {
+    const void** indirection_buffer;
+    // Offsets of input elements relative to the input image, in compact indirection mode.
+    const uint32_t* compact_indirection_buffer;
+  };
   size_t indirection_buffer_row_stride;
   size_t indirection_buffer_col_stride;
+  // Input, its batch stride, and log2(input element size), only used in compact indirection mode.
+  const void* input;
+  size_t input_batch_stride;
+  uint32_t log2_input_element_size;
+  const void* zero;
   const void* packed_weights;
   void* output;
+  size_t output_batch_stride;
   size_t output_width;
   size_t output_row_stride;
+  size_t output_col_stride;
   size_t output_col_increment;
+  // Number of kernel taps.
+  size_t kernel_size;
   union {
+    struct xnn_f16_output_params f16;
     union xnn_q8_gemm_params q8;
+    union xnn_q8c_gemm_params q8c;
     union xnn_f32_output_params f32;
   } params;
   union {
     xnn_dwconv_up_ukernel_function unipass_ukernel;
+    xnn_dwconv_mp_ukernel_function multipass_ukernel;
   };
 };
 
@@ -258,11 +553,38 @@ struct dwconv_context {
   XNN_PRIVATE void xnn_compute_dwconv_unipass(
       const struct dwconv_context context[restrict static 1],
       size_t output_y);
+
+  XNN_PRIVATE void xnn_compute_dwconv_multipass(
+      const struct dwconv_context context[restrict static 1],
+      size_t output_y);
+
+  XNN_PRIVATE void xnn_compute_dwconv_unipass_compact(
+      const struct dwconv_context context[restrict static 1],
+      size_t batch_index,
+      size_t output_y);
+
+  XNN_PRIVATE void xnn_compute_dwconv_multipass_compact(
+      const struct dwconv_context context[restrict static 1],
+      size_t batch_index,
+      size_t output_y);
 #endif
 
 struct dwconv2d_context {
   size_t output_height;
+  size_t input_height;
   size_t input_width;
+  size_t groups;
+  size_t kernel_height;
+  size_t subsampling_height;
+  size_t input_padding_top;
+  // Output rows [output_y_start, output_y_end) read only rows within the input image. Remaining output rows are
+  // computed on a copy of the input rows with explicit zero padding.
+  size_t output_y_start;
+  size_t output_y_end;
+  // Scratch buffer for zero-padded input rows, one slice per image and channel.
+  void* padded_input;
+  // Stride, in bytes, between slices of the padded_input buffer.
+  size_t padded_input_stride;
   const void* input;
   size_t input_channel_stride;
   size_t input_batch_stride;
@@ -291,12 +613,24 @@ struct dwconv2d_context {
 #endif
 
 struct max_pooling_context {
-  const void** indirect_input;
+  union {
+    const void** indirect_input;
+    // Offsets of input elements relative to the input image, in compact indirection mode.
+    const uint32_t* compact_indirect_input;
+  };
   size_t indirect_input_batch_stride;
   size_t indirect_input_height_stride;
+  size_t indirect_input_width_stride;
+  // Number of indirection pointers read by the micro-kernel for each output pixel.
+  size_t indirect_input_pixel_size;
+  // Input, its batch stride, and log2(input element size), only used in compact indirection mode.
+  const void* input;
+  size_t input_batch_stride;
+  uint32_t log2_input_element_size;
   void* output;
   size_t output_batch_stride;
   size_t output_height_stride;
+  size_t output_width_stride;
   size_t output_width;
   size_t pooling_size;
   size_t channels;
@@ -314,6 +648,11 @@ struct max_pooling_context {
       const struct max_pooling_context context[restrict static 1],
       size_t batch_index,
       size_t output_y);
+
+  XNN_PRIVATE void xnn_compute_max_pooling_compact(
+      const struct max_pooling_context context[restrict static 1],
+      size_t batch_index,
+      size_t output_y);
 #endif
 
 struct unpooling_context {
@@ -457,6 +796,7 @@ struct global_average_pooling_context {
   void* output;
   size_t output_batch_stride;
   union {
+    struct xnn_f16_output_params f16;
     union xnn_q8_avgpool_params q8;
     union xnn_f32_avgpool_params f32;
   } params;
@@ -507,6 +847,7 @@ struct add_strided_context {
   const void* y;
   size_t y_stride;
   union {
+    struct xnn_f16_output_params f16;
     union xnn_q8_add_params q8;
     union xnn_f32_output_params f32;
   } params;
@@ -525,6 +866,7 @@ struct add_contiguous_context {
   const void* b;
   void* y;
   union {
+    struct xnn_f16_output_params f16;
     union xnn_q8_add_params q8;
     union xnn_f32_output_params f32;
   } params;
@@ -538,6 +880,30 @@ struct add_contiguous_context {
       size_t size);
 #endif
 
+struct elementwise_binary_context {
+  const void* a;
+  size_t a_stride[XNN_MAX_TENSOR_DIMS - 1];
+  const void* b;
+  size_t b_stride[XNN_MAX_TENSOR_DIMS - 1];
+  void* y;
+  size_t y_stride[XNN_MAX_TENSOR_DIMS - 1];
+  // Size of the innermost dimension, in bytes.
+  size_t elements;
+  union {
+    union xnn_q8_add_params q8_add;
+    union xnn_q8_gemm_params q8_mul;
+    union xnn_f32_output_params f32;
+  } params;
+  xnn_vbinary_ukernel_function ukernel;
+};
+
+#ifndef __cplusplus
+  XNN_PRIVATE void xnn_compute_elementwise_binary_5d(
+      const struct elementwise_binary_context context[restrict static 1],
+      size_t i, size_t j, size_t k, size_t l, size_t m,
+      size_t l_range, size_t m_range);
+#endif
+
 struct channel_shuffle_context {
   const void* x;
   size_t x_stride;
@@ -601,6 +967,7 @@ struct univector_strided_context {
   size_t y_stride;
   xnn_univector_ukernel_function ukernel;
   union {
+    struct xnn_f16_output_params f16_output;
     union xnn_u8_output_params u8_output;
     union xnn_f32_output_params f32_output;
     union xnn_f32_hswish_params f32_hswish;
@@ -621,6 +988,7 @@ struct univector_contiguous_context {
   size_t y_stride;
   xnn_univector_ukernel_function ukernel;
   union {
+    struct xnn_f16_output_params f16_output;
     union xnn_u8_output_params u8_output;
     union xnn_f32_output_params f32_output;
     union xnn_f32_hswish_params f32_hswish;
@@ -672,6 +1040,69 @@ struct vmulcaddc_context {
       size_t batch_size);
 #endif
 
+// Maximum MR x NR tile of the GEMM micro-kernels used for Winograd Convolution. The GEMM results for all 36 transformed
+// positions of a tile are kept on stack until the output transform.
+#define XNN_MAX_WINOGRAD_GEMM_TILE 128
+
+// Context for Winograd F(4x4, 3x3) Convolution.
+// The first pass transforms every 6x6 input window with a stride of 4 pixels into the [36][tiles][input channels]
+// matrix V. The second pass computes, for every transformed position p,
+// M[p] [tiles x output channels] := V[p] [tiles x input channels] * U[p] [input channels x output channels], and
+// transforms each block of MR tiles back into 4x4 output pixels while it is still in cache.
+struct winograd_context {
+  size_t input_height;
+  size_t input_width;
+  const void* input;
+  size_t input_pixel_stride;
+  size_t input_batch_stride;
+  const void* zero;
+  uint32_t padding_top;
+  uint32_t padding_left;
+  size_t tile_rows;
+  size_t tile_columns;
+  size_t channels;
+  void* transformed_input;
+  // Stride, in bytes, between consecutive tiles of the transformed input.
+  size_t tile_stride;
+  // Stride, in bytes, between consecutive transformed positions of the transformed input.
+  size_t position_stride;
+  size_t k_scaled;
+  const void* packed_w;
+  size_t w_stride;
+  size_t w_position_stride;
+  size_t mr;
+  size_t nr;
+  size_t output_height;
+  size_t output_width;
+  void* output;
+  size_t output_pixel_stride;
+  size_t output_batch_stride;
+  xnn_winograd_input_ukernel_function input_ukernel;
+  xnn_gemm_ukernel_function gemm_ukernel;
+  xnn_winograd_output_ukernel_function output_ukernel;
+  // Parameters without output clamping for the GEMMs.
+  union {
+    union xnn_f32_output_params f32;
+  } gemm_params;
+  union {
+    union xnn_f32_output_params f32;
+  } params;
+};
+
+#ifndef __cplusplus
+  XNN_PRIVATE void xnn_compute_winograd_input(
+      const struct winograd_context context[restrict static 1],
+      size_t batch_tile_row,
+      size_t tile_column);
+
+  XNN_PRIVATE void xnn_compute_winograd_gemm(
+      const struct winograd_context context[restrict static 1],
+      size_t mr_block_start,
+      size_t nr_block_start,
+      size_t mr_block_size,
+      size_t nr_block_size);
+#endif
+
 struct channel_pad_context {
   size_t n;
   size_t l;
@@ -707,3 +1138,21 @@ struct u8_softargmax_context {
       const struct u8_softargmax_context context[restrict static 1],
       size_t batch_index);
 #endif
+
+struct f32_softmax_context {
+  size_t n;
+  const void* x;
+  size_t x_stride;
+  void* y;
+  size_t y_stride;
+  xnn_f32_rmax_ukernel_function rmax_ukernel;
+  xnn_f32_raddstoreexpminusmax_ukernel_function raddstoreexpminusmax_ukernel;
+  xnn_vbinary_ukernel_function vmulc_ukernel;
+  union xnn_f32_output_params params;
+};
+
+#ifndef __cplusplus
+  XNN_PRIVATE void xnn_compute_f32_softmax(
+      const struct f32_softmax_context context[restrict static 1],
+      size_t batch_index);
+#endif
@@ -45,6 +45,42 @@ DECLARE_F32_DWCONV_UNIPASS_UKERNEL_FUNCTION(xnn_f32_dwconv_ukernel_up4x9__sse)
 DECLARE_F32_DWCONV_UNIPASS_UKERNEL_FUNCTION(xnn_f32_dwconv_ukernel_up8x9__neonfma)
 
 
+#define DECLARE_F32_DWCONV_MULTIPASS_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                                   \
+    size_t channels,                                           \
+    size_t output_width,                                       \
+    size_t kernel_size,                                        \
+    const float** input,                                       \
+    const float* weights,                                      \
+    float* output,                                             \
+    size_t input_stride,                                       \
+    size_t output_increment,                                   \
+    const union xnn_f32_output_params* params);
+
+DECLARE_F32_DWCONV_MULTIPASS_UKERNEL_FUNCTION(xnn_f32_dwconv_ukernel_mp1x4__scalar)
+DECLARE_F32_DWCONV_MULTIPASS_UKERNEL_FUNCTION(xnn_f32_dwconv_ukernel_mp4x4__neon)
+DECLARE_F32_DWCONV_MULTIPASS_UKERNEL_FUNCTION(xnn_f32_dwconv_ukernel_mp4x4__neonfma)
+DECLARE_F32_DWCONV_MULTIPASS_UKERNEL_FUNCTION(xnn_f32_dwconv_ukernel_mp4x4__psimd)
+DECLARE_F32_DWCONV_MULTIPASS_UKERNEL_FUNCTION(xnn_f32_dwconv_ukernel_mp4x4__sse)
+DECLARE_F32_DWCONV_MULTIPASS_UKERNEL_FUNCTION(xnn_f32_dwconv_ukernel_mp8x4__avx)
+
+
+#define DECLARE_F16_DWCONV_UNIPASS_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                                 \
+    size_t channels,                                         \
+    size_t output_width,                                     \
+    const void** input,                                      \
+    const void* weights,                                     \
+    void* output,                                            \
+    size_t input_stride,                                     \
+    size_t output_increment,                                 \
+    const struct xnn_f16_output_params* params);
+
+DECLARE_F16_DWCONV_UNIPASS_UKERNEL_FUNCTION(xnn_f16_dwconv_ukernel_up1x9__scalar)
+DECLARE_F16_DWCONV_UNIPASS_UKERNEL_FUNCTION(xnn_f16_dwconv_ukernel_up8x9__f16c)
+DECLARE_F16_DWCONV_UNIPASS_UKERNEL_FUNCTION(xnn_f16_dwconv_ukernel_up8x9__neonfp16arith)
+
+
 #define DECLARE_Q8_DWCONV_UNIPASS_UKERNEL_FUNCTION(fn_name) \
   XNN_INTERNAL void fn_name(                                \
     size_t channels,                                        \
@@ -62,6 +98,39 @@ DECLARE_Q8_DWCONV_UNIPASS_UKERNEL_FUNCTION(xnn_q8_dwconv_ukernel_up8x9__neon)
 DECLARE_Q8_DWCONV_UNIPASS_UKERNEL_FUNCTION(xnn_q8_dwconv_ukernel_up8x9__sse2)
 
 
+#define DECLARE_Q8C_DWCONV_UNIPASS_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                                 \
+    size_t channels,                                         \
+    size_t output_width,                                     \
+    const uint8_t** input,                                   \
+    const void* weights,                                     \
+    uint8_t* output,                                         \
+    size_t input_stride,                                     \
+    size_t output_increment,                                 \
+    const union xnn_q8c_gemm_params* params);
+
+DECLARE_Q8C_DWCONV_UNIPASS_UKERNEL_FUNCTION(xnn_q8c_dwconv_ukernel_up1x9__scalar)
+DECLARE_Q8C_DWCONV_UNIPASS_UKERNEL_FUNCTION(xnn_q8c_dwconv_ukernel_up8x9__neon)
+DECLARE_Q8C_DWCONV_UNIPASS_UKERNEL_FUNCTION(xnn_q8c_dwconv_ukernel_up8x9__sse2)
+
+
+#define DECLARE_Q8_DWCONV_MULTIPASS_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                                  \
+    size_t channels,                                          \
+    size_t output_width,                                      \
+    size_t kernel_size,                                       \
+    const uint8_t** input,                                    \
+    const void* weights,                                      \
+    uint8_t* output,                                          \
+    size_t input_stride,                                      \
+    size_t output_increment,                                  \
+    const union xnn_q8_gemm_params* params);
+
+DECLARE_Q8_DWCONV_MULTIPASS_UKERNEL_FUNCTION(xnn_q8_dwconv_ukernel_mp1x4__scalar)
+DECLARE_Q8_DWCONV_MULTIPASS_UKERNEL_FUNCTION(xnn_q8_dwconv_ukernel_mp8x4__neon)
+DECLARE_Q8_DWCONV_MULTIPASS_UKERNEL_FUNCTION(xnn_q8_dwconv_ukernel_mp8x4__sse2)
+
+
 #define DECLARE_F32_DWCONV_SPCHW_UKERNEL_FUNCTION(fn_name) \
   XNN_INTERNAL void fn_name(                               \
     size_t m,                                              \
@@ -81,6 +150,8 @@ DECLARE_F32_DWCONV_SPCHW_UKERNEL_FUNCTION(xnn_f32_dwconv_spchw_ukernel_3x3p1__ss
 DECLARE_F32_DWCONV_SPCHW_UKERNEL_FUNCTION(xnn_f32_dwconv_spchw_ukernel_3x3s2p1__neonfma)
 DECLARE_F32_DWCONV_SPCHW_UKERNEL_FUNCTION(xnn_f32_dwconv_spchw_ukernel_5x5s2p2__neonfma)
 DECLARE_F32_DWCONV_SPCHW_UKERNEL_FUNCTION(xnn_f32_dwconv_spchw_ukernel_3x3s2p1__sse)
+DECLARE_F32_DWCONV_SPCHW_UKERNEL_FUNCTION(xnn_f32_dwconv_spchw_ukernel_5x5p2__sse)
+DECLARE_F32_DWCONV_SPCHW_UKERNEL_FUNCTION(xnn_f32_dwconv_spchw_ukernel_5x5s2p2__sse)
 
 
 #ifdef __cplusplus
@@ -19,6 +19,37 @@ extern "C" {
 #endif
 
 
+#define DECLARE_F16_GAVGPOOL_MULTIPASS_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                                     \
+      size_t m,                                                  \
+      size_t n,                                                  \
+      const void* x,                                             \
+      size_t x_stride,                                           \
+      const void* zero,                                          \
+      float* buffer,                                             \
+      void* y,                                                   \
+      const struct xnn_f16_output_params* params);
+
+DECLARE_F16_GAVGPOOL_MULTIPASS_UKERNEL_FUNCTION(xnn_f16_gavgpool_ukernel_mp7p7q__f16c)
+DECLARE_F16_GAVGPOOL_MULTIPASS_UKERNEL_FUNCTION(xnn_f16_gavgpool_ukernel_mp7p7q__neonfp16arith)
+DECLARE_F16_GAVGPOOL_MULTIPASS_UKERNEL_FUNCTION(xnn_f16_gavgpool_ukernel_mp7p7q__scalar)
+
+
+#define DECLARE_F16_GAVGPOOL_UNIPASS_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                                   \
+      size_t m,                                                \
+      size_t n,                                                \
+      const void* x,                                           \
+      size_t x_stride,                                         \
+      const void* zero,                                        \
+      void* y,                                                 \
+      const struct xnn_f16_output_params* params);
+
+DECLARE_F16_GAVGPOOL_UNIPASS_UKERNEL_FUNCTION(xnn_f16_gavgpool_ukernel_up7__f16c)
+DECLARE_F16_GAVGPOOL_UNIPASS_UKERNEL_FUNCTION(xnn_f16_gavgpool_ukernel_up7__neonfp16arith)
+DECLARE_F16_GAVGPOOL_UNIPASS_UKERNEL_FUNCTION(xnn_f16_gavgpool_ukernel_up7__scalar)
+
+
 #define DECLARE_F32_GAVGPOOL_MULTIPASS_UKERNEL_FUNCTION(fn_name) \
   XNN_INTERNAL void fn_name(                                     \
       size_t m,                                                  \
@@ -23,6 +23,12 @@ XNN_INTERNAL void xnn_indirection_init_conv2d(
   size_t output_tile_size,
   uint32_t log2_element_size);
 
+// Initializes a compact indirection buffer of 32-bit input element offsets, relative to the input image, for a single
+// image.
+XNN_INTERNAL void xnn_indirection_init_conv2d_compact(
+  xnn_operator_t op,
+  size_t output_tile_size);
+
 XNN_INTERNAL void xnn_indirection_init_dwconv2d(
   xnn_operator_t op,
   size_t batch_start,
@@ -30,6 +36,11 @@ XNN_INTERNAL void xnn_indirection_init_dwconv2d(
   size_t step_width,
   uint32_t log2_element_size);
 
+XNN_INTERNAL void xnn_indirection_init_dwconv2d_compact(
+  xnn_operator_t op,
+  size_t step_height,
+  size_t step_width);
+
 XNN_INTERNAL void xnn_indirection_init_deconv2d(
   xnn_operator_t op,
   size_t output_tile_size,
@@ -47,11 +58,26 @@ XNN_INTERNAL void xnn_indirection_init_maxpool2d(
   size_t step_width,
   uint32_t log2_element_size);
 
+XNN_INTERNAL void xnn_indirection_init_maxpool2d_compact(
+  xnn_operator_t op,
+  size_t step_height,
+  size_t step_width);
+
 XNN_INTERNAL void xnn_indirection_init_unpool2d(
   xnn_operator_t op,
   size_t batch_start,
   uint32_t log2_element_size);
 
+// Returns the indirection buffer of the operator, initialized for the base pointer, with its first num_pointers pointers
+// moved to another pointer into a tensor of the same shape. Pointers to the zero buffer are kept as is. Rebased copies
+// are cached for the last few pointers of the current input shape. Returns NULL if a copy can not be allocated.
+XNN_INTERNAL const void** xnn_indirection_rebase(
+  xnn_operator_t op,
+  const void* base,
+  const void* pointer,
+  size_t num_pointers,
+  const void* zero);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
@@ -38,6 +38,20 @@
     } \
   } while (0)
 
+#define TEST_REQUIRES_X86_SSSE3 \
+  do { \
+    if (!cpuinfo_initialize() || !cpuinfo_has_x86_ssse3()) { \
+      GTEST_SKIP(); \
+    } \
+  } while (0)
+
+#define TEST_REQUIRES_X86_SSE41 \
+  do { \
+    if (!cpuinfo_initialize() || !cpuinfo_has_x86_sse4_1()) { \
+      GTEST_SKIP(); \
+    } \
+  } while (0)
+
 #define TEST_REQUIRES_X86_AVX \
   do { \
     if (!cpuinfo_initialize() || !cpuinfo_has_x86_avx()) { \
@@ -45,6 +59,13 @@
     } \
   } while (0)
 
+#define TEST_REQUIRES_X86_F16C \
+  do { \
+    if (!cpuinfo_initialize() || !cpuinfo_has_x86_f16c()) { \
+      GTEST_SKIP(); \
+    } \
+  } while (0)
+
 #define TEST_REQUIRES_X86_AVX2 \
   do { \
     if (!cpuinfo_initialize() || !cpuinfo_has_x86_avx2()) { \
@@ -52,6 +73,13 @@
     } \
   } while (0)
 
+#define TEST_REQUIRES_X86_FMA3 \
+  do { \
+    if (!cpuinfo_initialize() || !cpuinfo_has_x86_fma3()) { \
+      GTEST_SKIP(); \
+    } \
+  } while (0)
+
 #define TEST_REQUIRES_X86_AVX512F \
   do { \
     if (!cpuinfo_initialize() || !cpuinfo_has_x86_avx512f()) { \
@@ -73,6 +101,13 @@
     } \
   } while (0)
 
+#define TEST_REQUIRES_ARM_NEON_FP16 \
+  do { \
+    if (!cpuinfo_initialize() || !cpuinfo_has_arm_neon_fp16()) { \
+      GTEST_SKIP(); \
+    } \
+  } while (0)
+
 #define TEST_REQUIRES_ARM_NEON_FP16_ARITH \
   do { \
     if (!cpuinfo_initialize() || !cpuinfo_has_arm_neon_fp16_arith()) { \
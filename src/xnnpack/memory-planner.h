@@ -0,0 +1,58 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <xnnpack.h>
+#include <xnnpack/subgraph.h>
+
+
+struct xnn_usage_record {
+  /// Index of the first Node that uses the value (normally the producer).
+  uint32_t first_node;
+  /// Index of the last Node that uses the value. The value is live in the [first_node, last_node] range.
+  uint32_t last_node;
+  /// Size in bytes of the value, or 0 if the value is not allocated in the arena.
+  size_t tensor_size;
+  /// Offset of the value in the arena.
+  size_t alloc_offset;
+};
+
+struct xnn_value_allocation_tracker {
+  const struct xnn_subgraph* subgraph;
+  /// Size of the arena required to fit all tracked values with their planned offsets.
+  size_t mem_arena_size;
+  /// Usage records, indexed by Value ID.
+  struct xnn_usage_record* usage;
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Computes live ranges of all Values in the subgraph from the order of Nodes.
+enum xnn_status xnn_init_value_allocation_tracker(
+    struct xnn_value_allocation_tracker* tracker,
+    const struct xnn_subgraph* subgraph);
+
+// Requests a location in the arena for the Value. Values which are not added are not allocated in the arena.
+void xnn_add_value_allocation_tracker(
+    struct xnn_value_allocation_tracker* tracker,
+    uint32_t value_id,
+    size_t tensor_size);
+
+// Assigns arena offsets to all added Values such that Values with overlapping live ranges never overlap in memory.
+enum xnn_status xnn_plan_value_allocation_tracker(
+    struct xnn_value_allocation_tracker* tracker);
+
+void xnn_release_value_allocation_tracker(
+    struct xnn_value_allocation_tracker* tracker);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
@@ -15,6 +16,7 @@
 
 #include <xnnpack/requantization.h>
 #include <xnnpack/compute.h>
+#include <xnnpack/packed-weights.h>
 
 
 enum xnn_ukernel_type {
@@ -35,16 +37,32 @@ enum xnn_ukernel_type {
   xnn_ukernel_type_pad,
   xnn_ukernel_type_pixelwise_average_pooling,
   xnn_ukernel_type_prelu,
+  xnn_ukernel_type_sigmoid,
   xnn_ukernel_type_softargmax,
   xnn_ukernel_type_spmm,
   xnn_ukernel_type_subconv2d,
+  xnn_ukernel_type_tanh,
   xnn_ukernel_type_unpooling,
+  xnn_ukernel_type_vbinary,
   xnn_ukernel_type_vmulcaddc,
+  xnn_ukernel_type_winograd,
+};
+
+// Element type of packed GEMM weights in F32 operators, see XNN_FLAG_FP16_WEIGHTS and XNN_FLAG_INT8_WEIGHTS.
+enum xnn_weights_type {
+  xnn_weights_type_f32 = 0,
+  // IEEE half-precision weights, with single-precision bias.
+  xnn_weights_type_f16,
+  // Signed 8-bit weights, with single-precision bias and per-output-channel scale.
+  xnn_weights_type_qc8,
 };
 
 enum xnn_operator_type {
   xnn_operator_type_none = 0,
+  xnn_operator_type_add_f16,
   xnn_operator_type_add_f32,
+  xnn_operator_type_add_nd_f32,
+  xnn_operator_type_add_nd_q8,
   xnn_operator_type_add_q8,
   xnn_operator_type_argmax_pooling_f32,
   xnn_operator_type_average_pooling_f32,
@@ -52,15 +70,23 @@ enum xnn_operator_type {
   xnn_operator_type_channel_pad_x32,
   xnn_operator_type_channel_shuffle_x8,
   xnn_operator_type_channel_shuffle_x32,
+  xnn_operator_type_clamp_f16,
   xnn_operator_type_clamp_f32,
   xnn_operator_type_clamp_u8,
+  xnn_operator_type_convolution_f16,
   xnn_operator_type_convolution_f32,
   xnn_operator_type_convolution_spnchw_f32,
   xnn_operator_type_convolution_q8,
+  xnn_operator_type_convolution_q8c,
   xnn_operator_type_deconvolution_f32,
   xnn_operator_type_deconvolution_q8,
+  xnn_operator_type_divide_nd_f32,
+  xnn_operator_type_fully_connected_f16,
   xnn_operator_type_fully_connected_f32,
   xnn_operator_type_fully_connected_q8,
+  xnn_operator_type_fully_connected_q8c,
+  xnn_operator_type_fully_connected_q8dq,
+  xnn_operator_type_global_average_pooling_f16,
   xnn_operator_type_global_average_pooling_f32,
   xnn_operator_type_global_average_pooling_q8,
   xnn_operator_type_global_average_pooling_spnchw_f32,
@@ -68,9 +94,17 @@ enum xnn_operator_type {
   xnn_operator_type_leaky_relu_q8,
   xnn_operator_type_max_pooling_f32,
   xnn_operator_type_max_pooling_u8,
+  xnn_operator_type_maximum_nd_f32,
+  xnn_operator_type_minimum_nd_f32,
+  xnn_operator_type_multiply_nd_f32,
+  xnn_operator_type_multiply_nd_q8,
   xnn_operator_type_prelu_f32,
+  xnn_operator_type_sigmoid_f32,
   xnn_operator_type_sigmoid_q8,
   xnn_operator_type_softargmax_q8,
+  xnn_operator_type_softmax_f32,
+  xnn_operator_type_subtract_nd_f32,
+  xnn_operator_type_tanh_f32,
   xnn_operator_type_unpooling_x32,
 };
 
@@ -88,7 +122,9 @@ struct xnn_ukernel_dwconv {
     xnn_dwconv_up_ukernel_function unipass_function;
     xnn_dwconv_mp_ukernel_function multipass_function;
   };
+  // Number of taps in the unipass micro-kernel, zero for the multipass micro-kernel.
   uint8_t mr;
+  // Number of taps in each pass of the multipass micro-kernel, zero for the unipass micro-kernel.
   uint8_t qr;
 };
 
@@ -101,9 +137,27 @@ struct xnn_ukernel_dwconv2d {
   uint8_t output_width_tile;
 };
 
+// Minimum number of rows in the A matrix (batch size in Fully Connected, number of output pixels in 1x1 Convolution)
+// to pack A into panels and use the PPMM micro-kernel instead of GEMM.
+#define XNN_PPMM_MIN_BATCH_SIZE 16
+
+struct xnn_ukernel_ppmm {
+  xnn_ppmm_ukernel_function function;
+  xnn_packx_ukernel_function packx_function;
+  uint8_t mr;
+};
+
+// Minimum number of K elements per slice in split-K execution of GEMM.
+#define XNN_SPLITK_MIN_K_SLICE 256
+
 struct xnn_ukernel_gemm {
   xnn_gemm_ukernel_function default_function;
   xnn_gemm_ukernel_function mr1_function;
+  // Optional GEMMINC micro-kernels for split-K execution with small M and for cache-blocked execution with large K.
+  xnn_gemminc_ukernel_function inc_function;
+  xnn_gemminc_ukernel_function mr1_inc_function;
+  // Optional PPMM micro-kernel for large M, operating on the same packed weights.
+  struct xnn_ukernel_ppmm ppmm;
   uint8_t mr;
   uint8_t nr;
   uint8_t kr;
@@ -117,16 +171,47 @@ struct xnn_ukernel_igemm {
   uint8_t kr;
 };
 
+// Q8 GEMM with dequantized F32 output, used by dynamically quantized Fully Connected operators.
+struct xnn_ukernel_q8dq_gemm {
+  xnn_q8dq_gemm_ukernel_function function;
+  uint8_t mr;
+  uint8_t nr;
+  uint8_t kr;
+};
+
+// Maximum percentage of stored kernel elements (non-zeroes and zeroes inside non-zero blocks) in F32 NHWC 1x1
+// Convolution and Fully Connected operators to use the sparse representation and SpMM micro-kernels instead of GEMM.
+#define XNN_SPMM_MAX_DENSITY_PERCENT 30
+
 struct xnn_ukernel_spmm {
   xnn_spmm_ukernel_function function;
   uint8_t mr;
 };
 
+// Elementwise binary operation with broadcasting. The opc and ropc micro-kernels take a single element of the second
+// input, and compute x <op> b and b <op> x respectively.
+struct xnn_ukernel_vbinary {
+  xnn_vbinary_ukernel_function op_function;
+  xnn_vbinary_ukernel_function opc_function;
+  xnn_vbinary_ukernel_function ropc_function;
+};
+
 struct xnn_ukernel_vmulcaddc {
   xnn_vmulcaddc_ukernel_function function;
   uint8_t mr;
 };
 
+// Winograd F(4x4, 3x3) Convolution: input transform, GEMM for each of the 6x6 transformed positions, and output
+// transform.
+struct xnn_ukernel_winograd {
+  xnn_winograd_input_ukernel_function input_function;
+  xnn_gemm_ukernel_function gemm_function;
+  xnn_winograd_output_ukernel_function output_function;
+  uint8_t mr;
+  uint8_t nr;
+  uint8_t kr;
+};
+
 struct xnn_ukernel {
   enum xnn_ukernel_type type;
   union {
@@ -135,11 +220,67 @@ struct xnn_ukernel {
     struct xnn_ukernel_dwconv2d dwconv2d;
     struct xnn_ukernel_gemm gemm;
     struct xnn_ukernel_igemm igemm;
+    struct xnn_ukernel_q8dq_gemm q8dq_gemm;
     struct xnn_ukernel_spmm spmm;
+    struct xnn_ukernel_vbinary vbinary;
     struct xnn_ukernel_vmulcaddc vmulcaddc;
+    struct xnn_ukernel_winograd winograd;
   };
 };
 
+// Statistics of xnn_run_operator calls, collected only when profiling is enabled.
+struct xnn_operator_profiling {
+  bool enabled;
+  size_t num_threads;
+  uint64_t run_count;
+  uint64_t total_time_ns;
+  uint64_t min_time_ns;
+  uint64_t last_time_ns;
+};
+
+// Indirection buffer and compute parameters for one input shape, kept by the shape cache while the operator is setup
+// for other shapes.
+struct xnn_shape_cache_entry {
+  size_t input_height;
+  size_t input_width;
+  const void** indirection_buffer;
+  // Input pointer which the indirection buffer was initialized for.
+  const void* last_input;
+  size_t valid_batch_size;
+  // Batch size and number of threads which the compute parameters were computed for, zero if they are not valid.
+  size_t plan_batch_size;
+  size_t plan_num_threads;
+  struct compute_parameters compute;
+  uint64_t last_use;
+};
+
+// Bounded cache of state for recently used input shapes, enabled by xnn_enable_operator_shape_cache. Least recently
+// used shapes are evicted first.
+struct xnn_shape_cache {
+  struct xnn_shape_cache_entry* entries;
+  size_t num_entries;
+  size_t max_entries;
+  uint64_t use_counter;
+  // Batch size and number of threads which the current compute parameters of the operator were computed for, zero if
+  // they are not valid. Maintained even when the cache is disabled.
+  size_t plan_batch_size;
+  size_t plan_num_threads;
+};
+
+// Number of input pointers other than the one the indirection buffer was initialized for which setup keeps rebased
+// copies of the indirection buffer for, enough for triple-buffered inputs.
+#define XNN_MAX_REBASED_INDIRECTION_BUFFERS 2
+
+// Copy of the indirection buffer with all pointers, except for the ones to the zero buffer, moved from the input
+// pointer the indirection buffer was initialized for to another input pointer of the same shape.
+struct xnn_rebased_indirection {
+  const void* pointer;
+  size_t input_height;
+  size_t input_width;
+  size_t num_pointers;
+  const void** buffer;
+};
+
 enum xnn_run_state {
   xnn_run_state_invalid = 0,
   xnn_run_state_ready,
@@ -187,7 +328,11 @@ struct xnn_operator {
   size_t input_width;
   size_t input_pixel_stride;
   const void* input;
+  // Pointers to input elements, or 32-bit offsets of input elements relative to the input image if the operator uses
+  // compact indirection for the current input shape.
   const void** indirection_buffer;
+  // Indirection buffers store 32-bit offsets where the micro-kernels support it, see XNN_FLAG_COMPACT_INDIRECTION.
+  bool compact_indirection;
   void* a_sum;
 
   size_t input2_pixel_stride;
@@ -199,6 +344,12 @@ struct xnn_operator {
   void* output;
 
   void* packed_weights;
+  enum xnn_weights_type weights_type;
+  // Layout of the packed weights, as serialized by xnn_export_operator_packed_weights.
+  // Zero-initialized if the operator does not support serialization of packed weights.
+  struct xnn_packed_weights_header packed_weights_header;
+  // Packed weights point inside a caller-provided blob, and are not released with the operator.
+  bool packed_weights_external;
   // Total number of non-zero kernel elements when weights use sparse representation.
   size_t num_nonzero_values;
   // Total number of non-zero kernel blocks when weights use sparse representation.
@@ -209,6 +360,7 @@ struct xnn_operator {
   size_t first_input_channel;
 
   float input_scale;
+  float kernel_scale;
   float output_scale;
   uint8_t input_zero_point;
   uint8_t kernel_zero_point;
@@ -221,13 +373,27 @@ struct xnn_operator {
   size_t last_input_width;
   const void* last_input;
   void* last_output;
+  // Rebased copies of the indirection buffer, most recently used first.
+  struct xnn_rebased_indirection rebased_indirection[XNN_MAX_REBASED_INDIRECTION_BUFFERS];
 
   void* zero_buffer;
   void* lookup_table;
   void* pixelwise_buffer;
+  // Input rows packed into MR-row panels for the PPMM micro-kernel, input rows and output blocks transposed for the
+  // SpMM micro-kernel in NHWC layout, or input copies read by SpNCHW micro-kernels: pixels gathered for subsampled
+  // 1x1 Convolution and zero-padded rows for depthwise Convolution.
+  void* packed_input;
+  size_t packed_input_size;
+  // Partial GEMM results for all but the first K slice in split-K execution.
+  void* partial_output;
+  size_t partial_output_size;
+  // Input tiles transformed into the Winograd domain.
+  void* transformed_input;
+  size_t transformed_input_size;
   struct subconvolution_params* subconvolution_buffer;
 
   union {
+    struct xnn_f16_output_params f16_output_params;
     union xnn_f32_avgpool_params f32_avgpool_params;
     union xnn_f32_gavgpool_params f32_gavgpool_params;
     union xnn_f32_hswish_params f32_hswish_params;
@@ -236,8 +402,16 @@ struct xnn_operator {
     union xnn_q8_add_params q8_add_params;
     union xnn_q8_avgpool_params q8_avgpool_params;
     union xnn_q8_gemm_params q8_gemm_params;
+    union xnn_q8c_gemm_params q8c_gemm_params;
+    union xnn_q8dq_gemm_params q8dq_gemm_params;
     union xnn_u8_output_params u8_output_params;
   };
+  // Parameters with the roles of the two inputs swapped, used by elementwise binary operators when the first input is
+  // broadcasted and passed to the ropc micro-kernel as the second argument.
+  union {
+    union xnn_q8_add_params q8_add_params;
+    union xnn_q8_gemm_params q8_gemm_params;
+  } swapped_params;
   enum xnn_operator_type type;
   struct xnn_ukernel ukernel;
 
@@ -248,11 +422,15 @@ struct xnn_operator {
     struct add_strided_context add_strided;
     struct argmax_pooling_context argmax_pooling;
     struct average_pooling_context average_pooling;
+    struct blocked_gemm_context blocked_gemm;
     struct channel_pad_context channel_pad;
     struct channel_shuffle_context channel_shuffle;
     struct dconv2d_context dconv2d;
+    struct dqgemm_context dqgemm;
     struct dwconv2d_context dwconv2d;
     struct dwconv_context dwconv;
+    struct elementwise_binary_context elementwise_binary;
+    struct f32_softmax_context f32_softmax;
     struct gemm_context gemm;
     struct global_average_pooling_context global_average_pooling;
     struct global_average_pooling_spnchw_context global_average_pooling_spnchw;
@@ -260,16 +438,26 @@ struct xnn_operator {
     struct lut_contiguous_context lut_contiguous;
     struct lut_strided_context lut_strided;
     struct max_pooling_context max_pooling;
+    struct nhwc_spmm_context nhwc_spmm;
     struct pixelwise_average_pooling_context pixelwise_average_pooling;
+    struct ppmm_context ppmm;
     struct prelu_context prelu;
     struct spmm_context spmm;
+    struct splitk_gemm_context splitk_gemm;
     struct subconv_context subconv;
     struct u8_softargmax_context u8_softargmax;
     struct univector_contiguous_context univector_contiguous;
     struct univector_strided_context univector_strided;
     struct unpooling_context unpooling;
     struct vmulcaddc_context vmulcaddc;
+    struct winograd_context winograd;
   } context;
 
   enum xnn_run_state state;
+  struct xnn_operator_profiling profiling;
+  struct xnn_shape_cache shape_cache;
+
+  // Operator which owns the packed weights, lookup table, and zero buffer of this operator, if this operator is an
+  // execution context created by xnn_create_execution_context. NULL for operators which own their immutable state.
+  const struct xnn_operator* parent;
 };
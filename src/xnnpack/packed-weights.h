@@ -0,0 +1,79 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <xnnpack.h>
+#include <xnnpack/common.h>
+
+// "XNNW" in little-endian byte order.
+#define XNN_PACKED_WEIGHTS_MAGIC UINT32_C(0x574E4E58)
+
+// Serialized packed weights start at this offset in the blob. The offset is a multiple of XNN_ALLOCATION_ALIGNMENT,
+// so an aligned blob gives aligned weights, as expected by micro-kernels which use aligned loads.
+#define XNN_PACKED_WEIGHTS_HEADER_SIZE 128
+
+#if XNN_ARCH_X86
+  #define XNN_PACKED_WEIGHTS_ARCH 1
+#elif XNN_ARCH_X86_64
+  #define XNN_PACKED_WEIGHTS_ARCH 2
+#elif XNN_ARCH_ARM
+  #define XNN_PACKED_WEIGHTS_ARCH 3
+#elif XNN_ARCH_ARM64
+  #define XNN_PACKED_WEIGHTS_ARCH 4
+#elif XNN_ARCH_WASMSIMD
+  #define XNN_PACKED_WEIGHTS_ARCH 5
+#else
+  #define XNN_PACKED_WEIGHTS_ARCH 0
+#endif
+
+// Description of packed weights layout. Serialized packed weights can be reused only by an operator which would pack
+// the same weights into exactly the same layout: on the same architecture, with the same micro-kernel tile, and with
+// the same operator parameters.
+struct xnn_packed_weights_header {
+  uint32_t magic;
+  uint32_t version;
+  // Target architecture, one of the XNN_PACKED_WEIGHTS_ARCH values.
+  uint32_t arch;
+  // Type of the operator which packed the weights (enum xnn_operator_type).
+  uint32_t operator_type;
+  // Type of the micro-kernel which consumes the weights (enum xnn_ukernel_type).
+  uint32_t ukernel_type;
+  // Tile of the micro-kernel: NR, KR, and SR for GEMM/IGEMM micro-kernels, CR for DWCONV and VMULCADDC micro-kernels.
+  uint32_t nr;
+  uint32_t kr;
+  uint32_t sr;
+  uint32_t groups;
+  uint32_t kernel_height;
+  uint32_t kernel_width;
+  // Element type of the packed weights (enum xnn_weights_type).
+  uint32_t weights_type;
+  uint64_t group_input_channels;
+  uint64_t group_output_channels;
+  // Size of the packed weights in bytes, excluding the header.
+  uint64_t weights_size;
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Initializes packed weights of the operator with the layout described by the header.
+//
+// If blob is NULL, allocates memory for the packed weights and leaves op->packed_weights_external unset: the caller
+// must pack the weights. Otherwise, checks that the blob was serialized with the same layout and points the packed
+// weights of the operator inside the blob, without copying.
+enum xnn_status xnn_init_operator_packed_weights(
+    xnn_operator_t op,
+    const struct xnn_packed_weights_header* header,
+    const void* blob,
+    size_t blob_size);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
@@ -177,6 +177,87 @@ union xnn_q8_gemm_params {
 #endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
 };
 
+// Parameters for Q8 GEMM, IGEMM, and DWCONV micro-kernels with per-channel requantization scales. The scales are
+// stored in the packed weights next to the bias, and the accumulators are requantized in FP32.
+union xnn_q8c_gemm_params {
+  struct {
+    int32_t kernel_zero_point;
+    float output_min_less_zero_point;
+    float output_max_less_zero_point;
+    float magic_bias;
+    int32_t magic_bias_less_output_zero_point;
+  } scalar;
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  struct {
+    int16_t kernel_zero_point;
+    float output_min_less_zero_point;
+    float output_max_less_zero_point;
+    float magic_bias;
+    int32_t magic_bias_less_output_zero_point;
+  } neon;
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  struct {
+    XNN_ALIGN(16) int16_t kernel_zero_point[8];
+    XNN_ALIGN(16) int16_t output_zero_point[8];
+    XNN_ALIGN(16) uint8_t output_max[16];
+    XNN_ALIGN(16) uint8_t output_min[16];
+  } sse2;
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+};
+
+// Parameters for Q8 GEMM micro-kernels with dequantized F32 output. The per-row dequantization scales are passed to
+// the micro-kernels separately, and the F32 bias is stored in the packed weights next to the zero point correction.
+union xnn_q8dq_gemm_params {
+  struct {
+    int32_t kernel_zero_point;
+    float output_min;
+    float output_max;
+  } scalar;
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  struct {
+    int16_t kernel_zero_point;
+    float output_min;
+    float output_max;
+  } neon;
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  struct {
+    XNN_ALIGN(16) int16_t kernel_zero_point[8];
+    XNN_ALIGN(16) float output_min[4];
+    XNN_ALIGN(16) float output_max[4];
+  } sse2;
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+};
+
+// Parameters for quantization of F32 elements into Q8: y := clamp(round(x * scale) + zero_point, min, max).
+union xnn_f32_q8_quantization_params {
+  struct {
+    float scale;
+    float output_min_less_zero_point;
+    float output_max_less_zero_point;
+    float magic_bias;
+    int32_t magic_bias_less_zero_point;
+  } scalar;
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  struct {
+    float scale;
+    float output_min_less_zero_point;
+    float output_max_less_zero_point;
+    float magic_bias;
+    int32_t magic_bias_less_zero_point;
+  } neon;
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  struct {
+    XNN_ALIGN(16) float scale[4];
+    XNN_ALIGN(16) float output_min_less_zero_point[4];
+    XNN_ALIGN(16) float output_max_less_zero_point[4];
+    XNN_ALIGN(16) int16_t zero_point[8];
+  } sse2;
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+};
+
 union xnn_q8_add_params {
   struct {
     int32_t zero_point_product;
@@ -400,6 +481,19 @@ typedef void (*xnn_gemm_ukernel_function)(
     size_t cn_stride,
     const void* params);
 
+typedef void (*xnn_gemminc_ukernel_function)(
+    size_t mr,
+    size_t nr,
+    size_t k,
+    const void* a,
+    size_t a_stride,
+    const void* w,
+    void* c,
+    size_t cm_stride,
+    size_t cn_stride,
+    const void* acc,
+    const void* params);
+
 typedef void (*xnn_f32_gemm_ukernel_function)(
     size_t mr,
     size_t nr,
@@ -412,6 +506,32 @@ typedef void (*xnn_f32_gemm_ukernel_function)(
     size_t cn_stride,
     const union xnn_f32_output_params* params);
 
+// Packed weights of each NR block are NR F32 biases followed by KC rows of NR IEEE half-precision weights.
+typedef void (*xnn_f32_f16w_gemm_ukernel_function)(
+    size_t mr,
+    size_t nr,
+    size_t k,
+    const float* a,
+    size_t a_stride,
+    const uint16_t* w,
+    float* c,
+    size_t cm_stride,
+    size_t cn_stride,
+    const union xnn_f32_output_params* params);
+
+// Packed weights of each NR block are KC rows of NR signed 8-bit weights followed by NR F32 biases and NR F32 scales.
+typedef void (*xnn_f32_qc8w_gemm_ukernel_function)(
+    size_t mr,
+    size_t nr,
+    size_t k,
+    const float* a,
+    size_t a_stride,
+    const int8_t* w,
+    float* c,
+    size_t cm_stride,
+    size_t cn_stride,
+    const union xnn_f32_output_params* params);
+
 typedef void (*xnn_f32_gemminc_ukernel_function)(
     size_t mr,
     size_t nr,
@@ -449,6 +569,32 @@ typedef void (*xnn_q8_gemm_ukernel_function)(
     size_t cn_stride,
     const union xnn_q8_gemm_params* params);
 
+typedef void (*xnn_q8c_gemm_ukernel_function)(
+    size_t mr,
+    size_t nr,
+    size_t k,
+    const uint8_t* a,
+    size_t a_stride,
+    const void* w,
+    uint8_t* c,
+    size_t cm_stride,
+    size_t cn_stride,
+    const union xnn_q8c_gemm_params* params);
+
+// Q8 GEMM with dequantized F32 output: row i of C is scaled by scale[i] and offset by the F32 bias.
+typedef void (*xnn_q8dq_gemm_ukernel_function)(
+    size_t mr,
+    size_t nr,
+    size_t k,
+    const uint8_t* a,
+    size_t a_stride,
+    const void* w,
+    float* c,
+    size_t cm_stride,
+    size_t cn_stride,
+    const float* scale,
+    const union xnn_q8dq_gemm_params* params);
+
 typedef void (*xnn_igemm_ukernel_function)(
     size_t mr,
     size_t nr,
@@ -477,6 +623,20 @@ typedef void (*xnn_f32_igemm_ukernel_function)(
     const float* zero,
     const union xnn_f32_output_params* params);
 
+typedef void (*xnn_f16_igemm_ukernel_function)(
+    size_t mr,
+    size_t nr,
+    size_t kc,
+    size_t ks,
+    const void** a,
+    const void* w,
+    void* c,
+    size_t cm_stride,
+    size_t cn_stride,
+    size_t a_offset,
+    const void* zero,
+    const struct xnn_f16_output_params* params);
+
 typedef void (*xnn_q8_igemm_ukernel_function)(
     size_t mr,
     size_t nr,
@@ -491,6 +651,20 @@ typedef void (*xnn_q8_igemm_ukernel_function)(
     const uint8_t* zero,
     const union xnn_q8_gemm_params* params);
 
+typedef void (*xnn_q8c_igemm_ukernel_function)(
+    size_t mr,
+    size_t nr,
+    size_t kc,
+    size_t ks,
+    const uint8_t** a,
+    const void* w,
+    uint8_t* c,
+    size_t cm_stride,
+    size_t cn_stride,
+    size_t a_offset,
+    const uint8_t* zero,
+    const union xnn_q8c_gemm_params* params);
+
 typedef void (*xnn_conv_hwc_ukernel_function)(
     size_t input_height,
     size_t input_width,
@@ -695,6 +869,16 @@ typedef void (*xnn_f32_dwconv_up_ukernel_function)(
     size_t output_increment,
     const union xnn_f32_output_params* params);
 
+typedef void (*xnn_f16_dwconv_up_ukernel_function)(
+    size_t channels,
+    size_t output_width,
+    const void** input,
+    const void* weights,
+    void* output,
+    size_t input_stride,
+    size_t output_increment,
+    const struct xnn_f16_output_params* params);
+
 typedef void (*xnn_q8_dwconv_up_ukernel_function)(
     size_t channels,
     size_t output_width,
@@ -705,17 +889,49 @@ typedef void (*xnn_q8_dwconv_up_ukernel_function)(
     size_t output_increment,
     const union xnn_q8_gemm_params* params);
 
+typedef void (*xnn_q8c_dwconv_up_ukernel_function)(
+    size_t channels,
+    size_t output_width,
+    const uint8_t** input,
+    const void* weights,
+    uint8_t* output,
+    size_t input_stride,
+    size_t output_increment,
+    const union xnn_q8c_gemm_params* params);
+
 typedef void (*xnn_dwconv_mp_ukernel_function)(
     size_t channels,
     size_t output_width,
+    size_t kernel_size,
     const void** input,
     const void* weights,
-    void* buffer,
     void* output,
     size_t input_stride,
     size_t output_increment,
     const void* params);
 
+typedef void (*xnn_f32_dwconv_mp_ukernel_function)(
+    size_t channels,
+    size_t output_width,
+    size_t kernel_size,
+    const float** input,
+    const float* weights,
+    float* output,
+    size_t input_stride,
+    size_t output_increment,
+    const union xnn_f32_output_params* params);
+
+typedef void (*xnn_q8_dwconv_mp_ukernel_function)(
+    size_t channels,
+    size_t output_width,
+    size_t kernel_size,
+    const uint8_t** input,
+    const void* weights,
+    uint8_t* output,
+    size_t input_stride,
+    size_t output_increment,
+    const union xnn_q8_gemm_params* params);
+
 typedef void (*xnn_gavgpool_up_ukernel_function)(
     size_t m,
     size_t n,
@@ -734,6 +950,15 @@ typedef void (*xnn_f32_gavgpool_up_ukernel_function)(
     float* y,
     const union xnn_f32_avgpool_params* params);
 
+typedef void (*xnn_f16_gavgpool_up_ukernel_function)(
+    size_t m,
+    size_t n,
+    const void* x,
+    size_t x_stride,
+    const void* zero,
+    void* y,
+    const struct xnn_f16_output_params* params);
+
 typedef void (*xnn_gavgpool_spchw_ukernel_function)(
     size_t elements,
     size_t channels,
@@ -777,6 +1002,16 @@ typedef void (*xnn_f32_gavgpool_mp_ukernel_function)(
     float* y,
     const union xnn_f32_avgpool_params* params);
 
+typedef void (*xnn_f16_gavgpool_mp_ukernel_function)(
+    size_t m,
+    size_t n,
+    const void* x,
+    size_t x_stride,
+    const void* zero,
+    float* buffer,
+    void* y,
+    const struct xnn_f16_output_params* params);
+
 typedef void (*xnn_q8_gavgpool_mp_ukernel_function)(
     size_t m,
     size_t n,
@@ -996,6 +1231,12 @@ typedef void (*xnn_f32_clamp_ukernel_function)(
     float* y,
     const union xnn_f32_output_params* params);
 
+typedef void (*xnn_f16_clamp_ukernel_function)(
+    size_t n,
+    const void* x,
+    void* y,
+    const struct xnn_f16_output_params* params);
+
 typedef void (*xnn_u8_clamp_ukernel_function)(
     size_t n,
     const uint8_t* x,
@@ -1008,6 +1249,12 @@ typedef void (*xnn_f32_hswish_ukernel_function)(
     float* y,
     const union xnn_f32_hswish_params* params);
 
+typedef void (*xnn_f32_vunary_ukernel_function)(
+    size_t n,
+    const float* x,
+    float* y,
+    const void* params);
+
 typedef void (*xnn_rmax_ukernel_function)(
     size_t n,
     const void* x,
@@ -1023,6 +1270,19 @@ typedef void (*xnn_f32_rmax_ukernel_function)(
     const float* x,
     float* y);
 
+typedef void (*xnn_f32_raddstoreexpminusmax_ukernel_function)(
+    size_t n,
+    const float* x,
+    float* y,
+    float* sum,
+    float max);
+
+typedef void (*xnn_f32_vquantize_ukernel_function)(
+    size_t n,
+    const float* x,
+    uint8_t* y,
+    const union xnn_f32_q8_quantization_params* params);
+
 typedef void (*xnn_u8_lut32norm_ukernel_function)(
     size_t n,
     const uint8_t* x,
@@ -1043,6 +1303,13 @@ typedef void (*xnn_f32_vadd_ukernel_function)(
     float* y,
     const union xnn_f32_output_params* params);
 
+typedef void (*xnn_f16_vadd_ukernel_function)(
+    size_t n,
+    const void* a,
+    const void* b,
+    void* y,
+    const struct xnn_f16_output_params* params);
+
 typedef void (*xnn_q8_vadd_ukernel_function)(
     size_t n,
     const uint8_t* a,
@@ -1078,6 +1345,27 @@ typedef void (*xnn_f32_vsub_ukernel_function)(
     float* y,
     const union xnn_f32_output_params* params);
 
+typedef void (*xnn_q8_vmul_ukernel_function)(
+    size_t n,
+    const uint8_t* a,
+    const uint8_t* b,
+    uint8_t* y,
+    const union xnn_q8_gemm_params* params);
+
+typedef void (*xnn_vbinary_ukernel_function)(
+    size_t n,
+    const void* a,
+    const void* b,
+    void* y,
+    const void* params);
+
+typedef void (*xnn_f32_vbinary_ukernel_function)(
+    size_t n,
+    const float* a,
+    const float* b,
+    float* y,
+    const union xnn_f32_output_params* params);
+
 typedef void (*xnn_vmulcaddc_ukernel_function)(
     size_t m,
     size_t c,
@@ -1118,6 +1406,40 @@ typedef void (*xnn_f32_prelu_ukernel_function)(
     size_t y_stride,
     const union xnn_f32_output_params* params);
 
+typedef void (*xnn_winograd_input_ukernel_function)(
+    size_t channels,
+    const void** input,
+    void* output,
+    size_t output_stride);
+
+typedef void (*xnn_f32_winograd_input_ukernel_function)(
+    size_t channels,
+    const float** input,
+    float* output,
+    size_t output_stride);
+
+typedef void (*xnn_winograd_output_ukernel_function)(
+    size_t rows,
+    size_t columns,
+    size_t channels,
+    const void* input,
+    size_t input_stride,
+    void* output,
+    size_t output_row_stride,
+    size_t output_column_stride,
+    const void* params);
+
+typedef void (*xnn_f32_winograd_output_ukernel_function)(
+    size_t rows,
+    size_t columns,
+    size_t channels,
+    const float* input,
+    size_t input_stride,
+    float* output,
+    size_t output_row_stride,
+    size_t output_column_stride,
+    const union xnn_f32_output_params* params);
+
 
 struct gemm_parameters {
   xnn_gemm_ukernel_function gemm;
@@ -1125,12 +1447,43 @@ struct gemm_parameters {
   // Optional GEMM and IGEMM micro-kernels with MR=1 and the same NR and KR parameters.
   xnn_gemm_ukernel_function gemm1;
   xnn_igemm_ukernel_function igemm1;
+  // Optional GEMMINC micro-kernels with the same MR, NR, and KR parameters as GEMM and with MR=1.
+  xnn_gemminc_ukernel_function gemminc;
+  xnn_gemminc_ukernel_function gemminc1;
   uint8_t mr;
   uint8_t nr;
   uint8_t log2_kr;
   uint8_t log2_sr;
 };
 
+struct q8dq_gemm_parameters {
+  xnn_q8dq_gemm_ukernel_function gemm;
+  uint8_t mr;
+  uint8_t nr;
+  uint8_t log2_kr;
+};
+
+// Block sizes for cache-blocked execution of GEMM with GEMM and GEMMINC micro-kernels.
+struct gemm_blocking_parameters {
+  // Number of K elements per block, so that a KC x NR panel of packed weights stays in L1 cache.
+  // Zero if cache-blocked execution is not supported.
+  size_t kc;
+  // Number of rows of A per block (multiple of MR), so that an MC x KC block of A stays in L2 cache.
+  size_t mc;
+  // Number of columns of B per block (multiple of NR), so that a KC x NC block of packed weights stays in L2 cache.
+  size_t nc;
+  // Size of packed weights, in bytes, above which GEMM is executed with cache blocking.
+  size_t min_weights_size;
+};
+
+struct ppmm_parameters {
+  xnn_ppmm_ukernel_function ppmm;
+  // PACKX micro-kernel to pack MR rows of the A matrix into the panel layout consumed by the PPMM micro-kernel.
+  xnn_packx_ukernel_function packx;
+  uint8_t mr;
+  uint8_t nr;
+};
+
 struct spmm_parameters {
   xnn_spmm_ukernel_function ukernel;
   // Number of M-dimension elements in a tile.
@@ -1177,7 +1530,9 @@ struct dwconv_parameters {
     xnn_dwconv_mp_ukernel_function mp;
   };
   uint8_t cr;
+  // Number of taps for unipass micro-kernels. Zero for multipass micro-kernels, which handle any kernel size.
   uint8_t mr;
+  // Number of taps processed in each pass of multipass micro-kernels. Zero for unipass micro-kernels.
   uint8_t qr;
 };
 
@@ -1239,19 +1594,67 @@ struct vmulcaddc_parameters {
   uint8_t mr;
 };
 
-#define XNN_MAX_Q8_DWCONV_UKERNELS 1
-#define XNN_MAX_F32_DWCONV_UKERNELS 3
+struct vbinary_parameters {
+  // Elementwise operation on two vectors: y[i] = a[i] <op> b[i].
+  xnn_vbinary_ukernel_function op_ukernel;
+  // Elementwise operation on a vector and a broadcasted scalar: y[i] = a[i] <op> b[0].
+  xnn_vbinary_ukernel_function opc_ukernel;
+  // Elementwise operation on a broadcasted scalar and a vector: y[i] = b[0] <op> a[i].
+  // Equals opc_ukernel for commutative operations.
+  xnn_vbinary_ukernel_function ropc_ukernel;
+  // Number of elements processed in one iteration of the main loop of the micro-kernels.
+  uint8_t element_tile;
+};
+
+struct winograd_parameters {
+  // Transforms a 6x6 input tile into the Winograd domain.
+  xnn_winograd_input_ukernel_function input;
+  // Transforms a 6x6 tile of products back into a 4x4 output tile, and clamps the outputs.
+  xnn_winograd_output_ukernel_function output;
+  // Minimum number of input and output channels for which Winograd convolution is faster than IGEMM.
+  uint32_t min_channels;
+};
+
+#define XNN_MAX_Q8_DWCONV_UKERNELS 2
+#define XNN_MAX_F32_DWCONV_UKERNELS 4
 #define XNN_MAX_F32_ARGMAXPOOL_UKERNELS 3
 
 struct xnn_parameters {
   bool initialized;
+  // Half-precision micro-kernels. Portable implementations convert inputs to single precision and accumulate in single
+  // precision; ARM NEON FP16 arithmetic implementations compute directly in half precision.
+  struct {
+    struct gemm_parameters gemm;
+    // Unipass DWCONV micro-kernel for 3x3 kernels. Other depthwise kernel sizes use IGEMM.
+    struct dwconv_parameters dwconv;
+    struct gavgpool_parameters gavgpool;
+    xnn_univector_ukernel_function clamp;
+    xnn_vadd_ukernel_function vadd;
+  } f16;
   struct {
     struct gemm_parameters gemm;
     struct dwconv_parameters dwconv[XNN_MAX_Q8_DWCONV_UKERNELS];
     struct avgpool_parameters avgpool;
     struct gavgpool_parameters gavgpool;
-    xnn_vadd_ukernel_function vadd;
+    struct vbinary_parameters vadd;
+    // Uses Q8 GEMM parameters: input and kernel zero points for the two inputs, and Q31 requantization.
+    struct vbinary_parameters vmul;
   } q8;
+  // Q8 micro-kernels with per-channel requantization scales.
+  struct {
+    struct gemm_parameters gemm;
+    // Unipass DWCONV micro-kernel for 3x3 kernels. Other depthwise kernel sizes use IGEMM.
+    struct dwconv_parameters dwconv;
+  } q8c;
+  // Micro-kernels for dynamically quantized operators with F32 inputs and outputs.
+  struct {
+    // Q8 GEMM micro-kernel with dequantized F32 output.
+    struct q8dq_gemm_parameters gemm;
+    // Maximum absolute value of F32 elements, used to choose the quantization scale of a row.
+    xnn_f32_rmax_ukernel_function rabsmax;
+    // Quantization of F32 elements into Q8.
+    xnn_f32_vquantize_ukernel_function vquantize;
+  } q8dq;
   struct {
     struct maxpool_parameters maxpool;
     xnn_univector_ukernel_function clamp;
@@ -1265,6 +1668,14 @@ struct xnn_parameters {
   struct {
     struct gemm_parameters gemm;
     struct gemm_parameters gemm2;
+    // GEMM micro-kernels with half-precision weights (XNN_FLAG_FP16_WEIGHTS). The igemm fields are unused.
+    struct gemm_parameters gemm_f16w;
+    // GEMM micro-kernels with 8-bit weights and per-channel scales (XNN_FLAG_INT8_WEIGHTS). The igemm fields are unused.
+    struct gemm_parameters gemm_qc8w;
+    // Block sizes for cache-blocked execution of the GEMM micro-kernels in the gemm field.
+    struct gemm_blocking_parameters gemm_blocking;
+    // Pre-packed Matrix-Matrix Multiplication with the same weights layout as GEMM (KR=1, SR=1).
+    struct ppmm_parameters ppmm;
     struct dwconv_parameters dwconv[XNN_MAX_F32_DWCONV_UKERNELS];
     struct avgpool_parameters avgpool;
     struct pavgpool_parameters pavgpool;
@@ -1273,8 +1684,19 @@ struct xnn_parameters {
     struct argmaxpool_parameters argmaxpool[XNN_MAX_F32_ARGMAXPOOL_UKERNELS];
     xnn_univector_ukernel_function clamp;
     xnn_univector_ukernel_function hswish;
+    xnn_univector_ukernel_function sigmoid;
+    xnn_univector_ukernel_function tanh;
+    // Maximum of F32 elements, subtracted before exponentiation in SoftMax.
+    xnn_f32_rmax_ukernel_function rmax;
+    // Exponentiation of F32 elements minus their maximum, stored along with the sum of the results.
+    xnn_f32_raddstoreexpminusmax_ukernel_function raddstoreexpminusmax;
     struct prelu_parameters prelu;
-    xnn_vadd_ukernel_function vadd;
+    struct vbinary_parameters vadd;
+    struct vbinary_parameters vdiv;
+    struct vbinary_parameters vmax;
+    struct vbinary_parameters vmin;
+    struct vbinary_parameters vmul;
+    struct vbinary_parameters vsub;
     struct vmulcaddc_parameters vmulcaddc;
     // Sparse Matrix-Dense Matrix Multiplication (NR=1 block).
     struct spmm_parameters spmm;
@@ -1288,8 +1710,14 @@ struct xnn_parameters {
     struct spchw_dwconv_parameters spchw_dwconv3x3;
     // Direct 3x3 stride-2 Convolution with padding 1 on left and right in SpCHW layout.
     struct spchw_dwconv_parameters spchw_dwconv3x3s2;
+    // Direct 5x5 stride-1 Convolution with padding 2 on left and right in SpCHW layout.
+    struct spchw_dwconv_parameters spchw_dwconv5x5;
+    // Direct 5x5 stride-2 Convolution with padding 2 on left and right in SpCHW layout.
+    struct spchw_dwconv_parameters spchw_dwconv5x5s2;
     // Global Average Pooling in SpCHW layout.
     struct spchw_gavgpool_parameters spchw_gavgpool;
+    // Winograd F(4x4, 3x3) transforms for 3x3 stride-1 Convolution.
+    struct winograd_parameters winograd;
   } f32;
   struct {
     struct pad_parameters pad;
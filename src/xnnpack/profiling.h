@@ -0,0 +1,30 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <stdint.h>
+
+#include <pthreadpool.h>
+
+#include <xnnpack.h>
+#include <xnnpack/common.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Reads a monotonic timer with nanosecond resolution.
+XNN_PRIVATE uint64_t xnn_read_timer_ns(void);
+
+// Accumulates statistics of one xnn_run_operator call which took time_ns nanoseconds.
+XNN_PRIVATE void xnn_record_operator_run(
+    xnn_operator_t op,
+    pthreadpool_t threadpool,
+    uint64_t time_ns);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
@@ -144,6 +144,134 @@ static inline union xnn_q8_gemm_params xnn_compute_q8_gemm_params(
   return params;
 }
 
+static inline union xnn_q8c_gemm_params xnn_compute_scalar_q8c_gemm_params(
+  uint8_t kernel_zero_point,
+  uint8_t output_zero_point,
+  uint8_t output_min,
+  uint8_t output_max)
+{
+  union xnn_q8c_gemm_params params;
+  params.scalar.kernel_zero_point = (int32_t) (uint32_t) kernel_zero_point;
+  params.scalar.output_min_less_zero_point =
+    (float) ((int32_t) (uint32_t) output_min - (int32_t) (uint32_t) output_zero_point);
+  params.scalar.output_max_less_zero_point =
+    (float) ((int32_t) (uint32_t) output_max - (int32_t) (uint32_t) output_zero_point);
+  params.scalar.magic_bias = 12582912.0f;
+  params.scalar.magic_bias_less_output_zero_point = INT32_C(0x4B400000) - (int32_t) (uint32_t) output_zero_point;
+  return params;
+}
+
+static inline union xnn_q8c_gemm_params xnn_compute_q8c_gemm_params(
+  uint8_t kernel_zero_point,
+  uint8_t output_zero_point,
+  uint8_t output_min,
+  uint8_t output_max)
+{
+  union xnn_q8c_gemm_params params;
+  #if XNN_ARCH_X86 || XNN_ARCH_X86_64
+    for (uint32_t i = 0; i < 8; i++) {
+      params.sse2.kernel_zero_point[i] = (int16_t) (uint16_t) kernel_zero_point;
+      params.sse2.output_zero_point[i] = (int16_t) (uint16_t) output_zero_point;
+    }
+    for (uint32_t i = 0; i < 16; i++) {
+      params.sse2.output_max[i] = output_max;
+      params.sse2.output_min[i] = output_min;
+    }
+  #elif XNN_ARCH_ARM || XNN_ARCH_ARM64
+    params.neon.kernel_zero_point = (int16_t) (uint16_t) kernel_zero_point;
+    params.neon.output_min_less_zero_point =
+      (float) ((int32_t) (uint32_t) output_min - (int32_t) (uint32_t) output_zero_point);
+    params.neon.output_max_less_zero_point =
+      (float) ((int32_t) (uint32_t) output_max - (int32_t) (uint32_t) output_zero_point);
+    params.neon.magic_bias = 12582912.0f;
+    params.neon.magic_bias_less_output_zero_point = INT32_C(0x4B400000) - (int32_t) (uint32_t) output_zero_point;
+  #else
+    params = xnn_compute_scalar_q8c_gemm_params(kernel_zero_point, output_zero_point, output_min, output_max);
+  #endif
+  return params;
+}
+
+static inline union xnn_q8dq_gemm_params xnn_compute_scalar_q8dq_gemm_params(
+  uint8_t kernel_zero_point,
+  float output_min,
+  float output_max)
+{
+  union xnn_q8dq_gemm_params params;
+  params.scalar.kernel_zero_point = (int32_t) (uint32_t) kernel_zero_point;
+  params.scalar.output_min = output_min;
+  params.scalar.output_max = output_max;
+  return params;
+}
+
+static inline union xnn_q8dq_gemm_params xnn_compute_q8dq_gemm_params(
+  uint8_t kernel_zero_point,
+  float output_min,
+  float output_max)
+{
+  union xnn_q8dq_gemm_params params;
+  #if XNN_ARCH_X86 || XNN_ARCH_X86_64
+    for (uint32_t i = 0; i < 8; i++) {
+      params.sse2.kernel_zero_point[i] = (int16_t) (uint16_t) kernel_zero_point;
+    }
+    for (uint32_t i = 0; i < 4; i++) {
+      params.sse2.output_min[i] = output_min;
+      params.sse2.output_max[i] = output_max;
+    }
+  #elif XNN_ARCH_ARM || XNN_ARCH_ARM64
+    params.neon.kernel_zero_point = (int16_t) (uint16_t) kernel_zero_point;
+    params.neon.output_min = output_min;
+    params.neon.output_max = output_max;
+  #else
+    params = xnn_compute_scalar_q8dq_gemm_params(kernel_zero_point, output_min, output_max);
+  #endif
+  return params;
+}
+
+static inline union xnn_f32_q8_quantization_params xnn_compute_scalar_f32_q8_quantization_params(
+  float scale,
+  uint8_t zero_point,
+  uint8_t output_min,
+  uint8_t output_max)
+{
+  union xnn_f32_q8_quantization_params params;
+  params.scalar.scale = scale;
+  params.scalar.output_min_less_zero_point = (float) ((int32_t) (uint32_t) output_min - (int32_t) (uint32_t) zero_point);
+  params.scalar.output_max_less_zero_point = (float) ((int32_t) (uint32_t) output_max - (int32_t) (uint32_t) zero_point);
+  params.scalar.magic_bias = 12582912.0f;
+  params.scalar.magic_bias_less_zero_point = INT32_C(0x4B400000) - (int32_t) (uint32_t) zero_point;
+  return params;
+}
+
+static inline union xnn_f32_q8_quantization_params xnn_compute_f32_q8_quantization_params(
+  float scale,
+  uint8_t zero_point,
+  uint8_t output_min,
+  uint8_t output_max)
+{
+  union xnn_f32_q8_quantization_params params;
+  #if XNN_ARCH_X86 || XNN_ARCH_X86_64
+    for (uint32_t i = 0; i < 4; i++) {
+      params.sse2.scale[i] = scale;
+      params.sse2.output_min_less_zero_point[i] =
+        (float) ((int32_t) (uint32_t) output_min - (int32_t) (uint32_t) zero_point);
+      params.sse2.output_max_less_zero_point[i] =
+        (float) ((int32_t) (uint32_t) output_max - (int32_t) (uint32_t) zero_point);
+    }
+    for (uint32_t i = 0; i < 8; i++) {
+      params.sse2.zero_point[i] = (int16_t) (uint16_t) zero_point;
+    }
+  #elif XNN_ARCH_ARM || XNN_ARCH_ARM64
+    params.neon.scale = scale;
+    params.neon.output_min_less_zero_point = (float) ((int32_t) (uint32_t) output_min - (int32_t) (uint32_t) zero_point);
+    params.neon.output_max_less_zero_point = (float) ((int32_t) (uint32_t) output_max - (int32_t) (uint32_t) zero_point);
+    params.neon.magic_bias = 12582912.0f;
+    params.neon.magic_bias_less_zero_point = INT32_C(0x4B400000) - (int32_t) (uint32_t) zero_point;
+  #else
+    params = xnn_compute_scalar_f32_q8_quantization_params(scale, zero_point, output_min, output_max);
+  #endif
+  return params;
+}
+
 static inline union xnn_q8_avgpool_params xnn_compute_q8_avgpool_params(
   int32_t bias,
   float scale,
@@ -477,6 +605,18 @@ static inline union xnn_f32_output_params xnn_compute_scalar_f32_output_params(
   return params;
 }
 
+static inline struct xnn_f16_output_params xnn_compute_f16_output_params(
+  float scale,
+  float output_min,
+  float output_max)
+{
+  struct xnn_f16_output_params params;
+  params.scale = fp16_ieee_from_fp32_value(scale);
+  params.min = fp16_ieee_from_fp32_value(output_min);
+  params.max = fp16_ieee_from_fp32_value(output_max);
+  return params;
+}
+
 static inline union xnn_f32_hswish_params xnn_compute_f32_hswish_params(void)
 {
   union xnn_f32_hswish_params params;
@@ -1265,6 +1405,22 @@ static inline uint8_t xnn_q31_requantize(
   return (uint8_t) (n + params.scalar.zero_point);
 }
 
+static inline uint8_t xnn_q8c_requantize(
+  int32_t n,
+  float scale,
+  union xnn_q8c_gemm_params params)
+{
+  float scaled = (float) n * scale;
+  if (scaled < params.scalar.output_min_less_zero_point) {
+    scaled = params.scalar.output_min_less_zero_point;
+  }
+  if (scaled > params.scalar.output_max_less_zero_point) {
+    scaled = params.scalar.output_max_less_zero_point;
+  }
+
+  return (uint8_t) ((int32_t) fp32_to_bits(scaled + params.scalar.magic_bias) - params.scalar.magic_bias_less_output_zero_point);
+}
+
 static inline uint8_t xnn_avgpool_quantize(
   int32_t n,
   union xnn_q8_avgpool_params params)
@@ -1306,3 +1462,27 @@ static inline uint8_t xnn_add_quantize(
   }
   return (uint8_t) y;
 }
+
+static inline uint8_t xnn_mul_quantize(
+  uint8_t a, uint8_t b,
+  union xnn_q8_gemm_params params)
+{
+  // Multiply inputs with subtracted zero points.
+  const int32_t acc = ((int32_t) (uint32_t) a - params.scalar.input_zero_point) *
+    ((int32_t) (uint32_t) b - params.scalar.kernel_zero_point);
+
+  // Multiply by Q31 multiplier, shift right and round.
+  const int64_t product = (int64_t) acc * (int64_t) params.scalar.multiplier;
+  const int32_t q31product = (int32_t) (uint32_t) ((uint64_t) (product + INT64_C(0x40000000)) >> 31);
+  const int32_t rem = (q31product & params.scalar.remainder_mask) - (int32_t) (q31product < 0);
+  int32_t y = asr_s32(q31product, params.scalar.shift) + (int32_t) (rem > params.scalar.remainder_threshold);
+
+  // Clamp and add output zero point.
+  if (y < params.scalar.output_min_less_zero_point) {
+    y = params.scalar.output_min_less_zero_point;
+  }
+  if (y > params.scalar.output_max_less_zero_point) {
+    y = params.scalar.output_max_less_zero_point;
+  }
+  return (uint8_t) (y + params.scalar.output_zero_point);
+}
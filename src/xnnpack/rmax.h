@@ -30,6 +30,10 @@ DECLARE_F32_RMAX_UKERNEL_FUNCTION(xnn_f32_rmax_ukernel__neon)
 DECLARE_F32_RMAX_UKERNEL_FUNCTION(xnn_f32_rmax_ukernel__scalar)
 DECLARE_F32_RMAX_UKERNEL_FUNCTION(xnn_f32_rmax_ukernel__sse)
 
+DECLARE_F32_RMAX_UKERNEL_FUNCTION(xnn_f32_rabsmax_ukernel__neon)
+DECLARE_F32_RMAX_UKERNEL_FUNCTION(xnn_f32_rabsmax_ukernel__scalar)
+DECLARE_F32_RMAX_UKERNEL_FUNCTION(xnn_f32_rabsmax_ukernel__sse)
+
 
 #define DECLARE_U8_RMAX_UKERNEL_FUNCTION(fn_name) \
   XNN_INTERNAL void fn_name(                      \
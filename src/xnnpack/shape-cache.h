@@ -0,0 +1,36 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include <xnnpack.h>
+#include <xnnpack/common.h>
+#include <xnnpack/operator.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Switches the operator to a new input shape before setup rebuilds the indirection buffer.
+//
+// If the shape cache is enabled, moves the indirection buffer and compute parameters for the current shape into the
+// cache, and restores the ones cached for the new shape. Returns true if the new shape was found in the cache: the
+// indirection buffer, last_input_height/width, last_input, and valid_batch_size of the operator are then valid for the
+// new shape. Otherwise returns false, and invalidates the state for the current shape.
+XNN_PRIVATE bool xnn_switch_operator_shape(
+    xnn_operator_t op,
+    size_t input_height,
+    size_t input_width);
+
+// Releases all indirection buffers kept by the shape cache, and the cache itself.
+XNN_PRIVATE void xnn_release_shape_cache(
+    struct xnn_shape_cache* shape_cache);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
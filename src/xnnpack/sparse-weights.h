@@ -0,0 +1,83 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <xnnpack.h>
+#include <xnnpack/common.h>
+#include <xnnpack/params.h>
+
+// Sparse representation of the [groups * group_output_channels]x[groups * group_input_channels] block-diagonal kernel
+// of a 1x1 Convolution or Fully Connected operator, as consumed by SpMM micro-kernels. Output channels are split into
+// blocks of 1, 2, or 4 channels, and each block stores the weights of all input channels where any of its kernel
+// elements is non-zero.
+struct xnn_sparse_weights_layout {
+  // Parameters of the SpMM micro-kernel for the chosen output channel block size.
+  const struct spmm_parameters* spmm_parameters;
+  // Number of output channels in a block: 1, 2, or 4. Output channels which don't fill a whole block are processed
+  // one-by-one.
+  size_t output_channels_block_size;
+  size_t num_output_channel_blocks;
+  // Number of non-zero kernel elements.
+  size_t num_nonzeroes;
+  // Number of stored kernel elements, including zero elements inside non-zero blocks.
+  size_t num_nonzero_values;
+  // Number of stored blocks of kernel elements.
+  size_t num_nonzero_blocks;
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Counts non-zero kernel elements and chooses the output channel block size: 4-channel and 2-channel blocks are used
+// when they would be 90%+ non-zero.
+XNN_INTERNAL void xnn_init_f32_sparse_weights_layout(
+  size_t groups,
+  size_t group_output_channels,
+  size_t group_input_channels,
+  const float* kernel,
+  struct xnn_sparse_weights_layout* layout);
+
+// Packs the kernel and bias into sparse representation:
+// - nonzero_values, with layout->num_nonzero_values + groups * group_output_channels elements, gets the bias of each
+//   block followed by kernel elements of its non-zero blocks;
+// - output_channel_nonzeros, with layout->num_output_channel_blocks elements, gets the number of non-zero blocks in
+//   each block of output channels;
+// - input_channel_diffs, with layout->num_nonzero_blocks elements, gets differences between input channels of
+//   successive non-zero blocks, multiplied by input_channel_stride. The last difference returns to the input channel
+//   of the first non-zero block, which is stored in first_input_channel_out.
+//
+// Fails with xnn_status_unsupported_parameter if a difference doesn't fit into int32_t.
+XNN_INTERNAL enum xnn_status xnn_pack_f32_sparse_weights(
+  size_t groups,
+  size_t group_output_channels,
+  size_t group_input_channels,
+  const float* kernel,
+  const float* bias,
+  const struct xnn_sparse_weights_layout* layout,
+  size_t input_channel_stride,
+  float* nonzero_values,
+  uint32_t* output_channel_nonzeros,
+  int32_t* input_channel_diffs,
+  size_t* first_input_channel_out);
+
+// Packs the kernel of an NHWC 1x1 Convolution or Fully Connected operator for the SpMM micro-kernels if at most
+// XNN_SPMM_MAX_DENSITY_PERCENT percent of its elements are non-zero, and sets op->ukernel.type to
+// xnn_ukernel_type_spmm. Leaves the operator unchanged if the kernel is too dense for SpMM to be faster than GEMM.
+XNN_INTERNAL enum xnn_status xnn_init_operator_sparse_weights(
+  xnn_operator_t op,
+  size_t groups,
+  size_t group_output_channels,
+  size_t group_input_channels,
+  const float* kernel,
+  const float* bias);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
@@ -19,6 +19,19 @@ extern "C" {
 #endif
 
 
+#define DECLARE_F16_VADD_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                       \
+      size_t n,                                    \
+      const void* a,                               \
+      const void* b,                               \
+      void* y,                                     \
+      const struct xnn_f16_output_params* params);
+
+DECLARE_F16_VADD_UKERNEL_FUNCTION(xnn_f16_vadd_ukernel__f16c)
+DECLARE_F16_VADD_UKERNEL_FUNCTION(xnn_f16_vadd_ukernel__neonfp16arith)
+DECLARE_F16_VADD_UKERNEL_FUNCTION(xnn_f16_vadd_ukernel__scalar)
+
+
 #define DECLARE_F32_VADD_UKERNEL_FUNCTION(fn_name) \
   XNN_INTERNAL void fn_name(                       \
       size_t n,                                    \
@@ -45,6 +58,10 @@ DECLARE_Q8_VADD_UKERNEL_FUNCTION(xnn_q8_vadd_ukernel__neon)
 DECLARE_Q8_VADD_UKERNEL_FUNCTION(xnn_q8_vadd_ukernel__scalar)
 DECLARE_Q8_VADD_UKERNEL_FUNCTION(xnn_q8_vadd_ukernel__sse2)
 
+DECLARE_Q8_VADD_UKERNEL_FUNCTION(xnn_q8_vaddc_ukernel__neon)
+DECLARE_Q8_VADD_UKERNEL_FUNCTION(xnn_q8_vaddc_ukernel__scalar)
+DECLARE_Q8_VADD_UKERNEL_FUNCTION(xnn_q8_vaddc_ukernel__sse2)
+
 
 #ifdef __cplusplus
 }  // extern "C"
@@ -30,6 +30,23 @@ DECLARE_F32_VMUL_UKERNEL_FUNCTION(xnn_f32_vmul_ukernel__scalar)
 DECLARE_F32_VMUL_UKERNEL_FUNCTION(xnn_f32_vmul_ukernel__sse)
 
 
+#define DECLARE_Q8_VMUL_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                      \
+      size_t n,                                   \
+      const uint8_t* a,                           \
+      const uint8_t* b,                           \
+      uint8_t* y,                                 \
+      const union xnn_q8_gemm_params* params);
+
+DECLARE_Q8_VMUL_UKERNEL_FUNCTION(xnn_q8_vmul_ukernel__neon)
+DECLARE_Q8_VMUL_UKERNEL_FUNCTION(xnn_q8_vmul_ukernel__scalar)
+DECLARE_Q8_VMUL_UKERNEL_FUNCTION(xnn_q8_vmul_ukernel__sse2)
+
+DECLARE_Q8_VMUL_UKERNEL_FUNCTION(xnn_q8_vmulc_ukernel__neon)
+DECLARE_Q8_VMUL_UKERNEL_FUNCTION(xnn_q8_vmulc_ukernel__scalar)
+DECLARE_Q8_VMUL_UKERNEL_FUNCTION(xnn_q8_vmulc_ukernel__sse2)
+
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
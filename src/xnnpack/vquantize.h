@@ -0,0 +1,33 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <xnnpack/params.h>
+#include <xnnpack/common.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#define DECLARE_F32_VQUANTIZE_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                            \
+      size_t n,                                         \
+      const float* x,                                   \
+      uint8_t* y,                                       \
+      const union xnn_f32_q8_quantization_params* params);
+
+DECLARE_F32_VQUANTIZE_UKERNEL_FUNCTION(xnn_f32_vquantize_ukernel__neon)
+DECLARE_F32_VQUANTIZE_UKERNEL_FUNCTION(xnn_f32_vquantize_ukernel__scalar)
+DECLARE_F32_VQUANTIZE_UKERNEL_FUNCTION(xnn_f32_vquantize_ukernel__sse2)
+
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
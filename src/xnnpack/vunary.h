@@ -0,0 +1,42 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <xnnpack/common.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+// Elementwise unary operations without parameters. The params argument is unused and exists only for compatibility
+// with the univector micro-kernel interface.
+#define DECLARE_F32_VUNARY_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                         \
+      size_t n,                                      \
+      const float* x,                                \
+      float* y,                                      \
+      const void* params);
+
+DECLARE_F32_VUNARY_UKERNEL_FUNCTION(xnn_f32_sigmoid_ukernel__avx2_x16)
+DECLARE_F32_VUNARY_UKERNEL_FUNCTION(xnn_f32_sigmoid_ukernel__avx512f_x32)
+DECLARE_F32_VUNARY_UKERNEL_FUNCTION(xnn_f32_sigmoid_ukernel__neon_x8)
+DECLARE_F32_VUNARY_UKERNEL_FUNCTION(xnn_f32_sigmoid_ukernel__scalar_x2)
+DECLARE_F32_VUNARY_UKERNEL_FUNCTION(xnn_f32_sigmoid_ukernel__sse2_x8)
+
+DECLARE_F32_VUNARY_UKERNEL_FUNCTION(xnn_f32_tanh_ukernel__avx2_x16)
+DECLARE_F32_VUNARY_UKERNEL_FUNCTION(xnn_f32_tanh_ukernel__avx512f_x32)
+DECLARE_F32_VUNARY_UKERNEL_FUNCTION(xnn_f32_tanh_ukernel__neon_x8)
+DECLARE_F32_VUNARY_UKERNEL_FUNCTION(xnn_f32_tanh_ukernel__scalar_x2)
+DECLARE_F32_VUNARY_UKERNEL_FUNCTION(xnn_f32_tanh_ukernel__sse2_x8)
+
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
@@ -0,0 +1,50 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <xnnpack/params.h>
+#include <xnnpack/common.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#define DECLARE_F32_WINOGRAD_INPUT_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                                 \
+      size_t channels,                                       \
+      const float** input,                                   \
+      float* output,                                         \
+      size_t output_stride);
+
+DECLARE_F32_WINOGRAD_INPUT_UKERNEL_FUNCTION(xnn_f32_winograd_input_ukernel_6x6__psimd)
+DECLARE_F32_WINOGRAD_INPUT_UKERNEL_FUNCTION(xnn_f32_winograd_input_ukernel_6x6__scalar)
+DECLARE_F32_WINOGRAD_INPUT_UKERNEL_FUNCTION(xnn_f32_winograd_input_ukernel_6x6__sse)
+
+
+#define DECLARE_F32_WINOGRAD_OUTPUT_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                                  \
+      size_t rows,                                            \
+      size_t columns,                                         \
+      size_t channels,                                        \
+      const float* input,                                     \
+      size_t input_stride,                                    \
+      float* output,                                          \
+      size_t output_row_stride,                               \
+      size_t output_column_stride,                            \
+      const union xnn_f32_output_params* params);
+
+DECLARE_F32_WINOGRAD_OUTPUT_UKERNEL_FUNCTION(xnn_f32_winograd_output_ukernel_4x4__psimd)
+DECLARE_F32_WINOGRAD_OUTPUT_UKERNEL_FUNCTION(xnn_f32_winograd_output_ukernel_4x4__scalar)
+DECLARE_F32_WINOGRAD_OUTPUT_UKERNEL_FUNCTION(xnn_f32_winograd_output_ukernel_4x4__sse)
+
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
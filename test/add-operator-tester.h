@@ -18,6 +18,8 @@
 #include <random>
 #include <vector>
 
+#include <fp16.h>
+
 #include <xnnpack.h>
 
 
@@ -243,6 +245,77 @@ class AddOperatorTester {
     }
   }
 
+  void TestF16() const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto f32rng = std::bind(std::uniform_real_distribution<float>(0.0f, 1.0f), rng);
+    auto f16rng = std::bind(fp16_ieee_from_fp32_value, f32rng);
+
+    std::vector<uint16_t> a(XNN_EXTRA_BYTES / sizeof(uint16_t) + (batch_size() - 1) * a_stride() + channels());
+    std::vector<uint16_t> b(XNN_EXTRA_BYTES / sizeof(uint16_t) + (batch_size() - 1) * b_stride() + channels());
+    std::vector<uint16_t> y((batch_size() - 1) * y_stride() + channels());
+    std::vector<float> y_ref(batch_size() * channels());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(a.begin(), a.end(), std::ref(f16rng));
+      std::generate(b.begin(), b.end(), std::ref(f16rng));
+      std::fill(y.begin(), y.end(), UINT16_C(0x7E00) /* NaN */);
+
+      // Compute reference results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        for (size_t c = 0; c < channels(); c++) {
+          y_ref[i * channels() + c] =
+            fp16_ieee_to_fp32_value(a[i * a_stride() + c]) + fp16_ieee_to_fp32_value(b[i * b_stride() + c]);
+        }
+      }
+      const float accumulated_min = *std::min_element(y_ref.cbegin(), y_ref.cend());
+      const float accumulated_max = *std::max_element(y_ref.cbegin(), y_ref.cend());
+      const float accumulated_range = accumulated_max - accumulated_min;
+      const float y_min = batch_size() * channels() == 1 ?
+        -std::numeric_limits<float>::infinity() :
+        fp16_ieee_to_fp32_value(fp16_ieee_from_fp32_value(accumulated_min + accumulated_range / 255.0f * float(qmin())));
+      const float y_max = batch_size() * channels() == 1 ?
+        +std::numeric_limits<float>::infinity() :
+        fp16_ieee_to_fp32_value(fp16_ieee_from_fp32_value(accumulated_max - accumulated_range / 255.0f * float(255 - qmax())));
+      for (size_t i = 0; i < batch_size(); i++) {
+        for (size_t c = 0; c < channels(); c++) {
+          y_ref[i * channels() + c] = std::min(std::max(y_ref[i * channels() + c], y_min), y_max);
+        }
+      }
+
+      // Create, setup, run, and destroy Add operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize());
+      xnn_operator_t add_op = nullptr;
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_create_add_nc_f16(
+          channels(), a_stride(), b_stride(), y_stride(),
+          y_min, y_max,
+          0, &add_op));
+      ASSERT_NE(nullptr, add_op);
+
+      // Smart pointer to automatically delete add_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_add_op(add_op, xnn_delete_operator);
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_add_nc_f16(
+          add_op,
+          batch_size(),
+          a.data(), b.data(), y.data(),
+          nullptr /* thread pool */));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(add_op, nullptr /* thread pool */));
+
+      // Verify results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        for (size_t c = 0; c < channels(); c++) {
+          ASSERT_NEAR(fp16_ieee_to_fp32_value(y[i * y_stride() + c]), y_ref[i * channels() + c], 1.0e-2f * y_ref[i * channels() + c])
+            << "i = " << i << ", c = " << c;
+        }
+      }
+    }
+  }
+
   void TestF32() const {
     std::random_device random_device;
     auto rng = std::mt19937(random_device());
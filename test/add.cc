@@ -401,6 +401,94 @@ TEST(ADD_OP_Q8, strided_batch_with_y_zero_point) {
   }
 }
 
+TEST(ADD_OP_F16, unit_batch) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    AddOperatorTester()
+      .batch_size(1)
+      .channels(channels)
+      .iterations(3)
+      .TestF16();
+  }
+}
+
+TEST(ADD_OP_F16, unit_batch_with_qmin) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    AddOperatorTester()
+      .batch_size(1)
+      .channels(channels)
+      .qmin(128)
+      .iterations(3)
+      .TestF16();
+  }
+}
+
+TEST(ADD_OP_F16, unit_batch_with_qmax) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    AddOperatorTester()
+      .batch_size(1)
+      .channels(channels)
+      .qmax(128)
+      .iterations(3)
+      .TestF16();
+  }
+}
+
+TEST(ADD_OP_F16, small_batch) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    AddOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .iterations(3)
+      .TestF16();
+  }
+}
+
+TEST(ADD_OP_F16, small_batch_with_a_stride) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    AddOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .a_stride(129)
+      .iterations(3)
+      .TestF16();
+  }
+}
+
+TEST(ADD_OP_F16, small_batch_with_b_stride) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    AddOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .b_stride(123)
+      .iterations(3)
+      .TestF16();
+  }
+}
+
+TEST(ADD_OP_F16, small_batch_with_y_stride) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    AddOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .y_stride(117)
+      .iterations(3)
+      .TestF16();
+  }
+}
+
+TEST(ADD_OP_F16, strided_batch) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    AddOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .a_stride(129)
+      .b_stride(123)
+      .y_stride(117)
+      .iterations(3)
+      .TestF16();
+  }
+}
+
 TEST(ADD_OP_F32, unit_batch) {
   for (size_t channels = 1; channels < 100; channels += 15) {
     AddOperatorTester()
@@ -278,6 +278,15 @@ class ArgmaxPoolingOperatorTester {
     return this->qmax_;
   }
 
+  inline ArgmaxPoolingOperatorTester& double_buffering(bool double_buffering) {
+    this->double_buffering_ = double_buffering;
+    return *this;
+  }
+
+  inline bool double_buffering() const {
+    return this->double_buffering_;
+  }
+
   inline ArgmaxPoolingOperatorTester& iterations(size_t iterations) {
     this->iterations_ = iterations;
     return *this;
@@ -508,6 +517,13 @@ class ArgmaxPoolingOperatorTester {
         }
       }
 
+      if (double_buffering()) {
+        // Run the second time on different buffers, as if the caller alternated between two sets of buffers.
+        std::vector<float>(input.size()).swap(input);
+        std::vector<float>(output.size()).swap(output);
+        std::vector<uint32_t>(index.size()).swap(index);
+      }
+
       // Re-generate data for the second run.
       std::generate(input.begin(), input.end(), std::ref(f32rng));
       std::fill(output.begin(), output.end(), 0xA5);
@@ -601,5 +617,6 @@ class ArgmaxPoolingOperatorTester {
   size_t next_batch_size_{0};
   uint8_t qmin_{0};
   uint8_t qmax_{255};
+  bool double_buffering_{false};
   size_t iterations_{1};
 };
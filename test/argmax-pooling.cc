@@ -632,3 +632,57 @@ TEST(ARGMAX_POOLING_OP_F32, setup_swap_height_and_width) {
     .channels(24)
     .TestSetupF32();
 }
+
+TEST(ARGMAX_POOLING_OP_F32, setup_double_buffering) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  ArgmaxPoolingOperatorTester()
+    .batch_size(3)
+    .input_height(8)
+    .input_width(8)
+    .pooling_height(5)
+    .pooling_width(3)
+    .channels(24)
+    .double_buffering(true)
+    .TestSetupF32();
+}
+
+TEST(ARGMAX_POOLING_OP_F32, setup_double_buffering_decreasing_batch) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  ArgmaxPoolingOperatorTester()
+    .batch_size(5)
+    .next_batch_size(3)
+    .input_height(8)
+    .input_width(8)
+    .pooling_height(5)
+    .pooling_width(3)
+    .channels(24)
+    .double_buffering(true)
+    .TestSetupF32();
+}
+
+TEST(ARGMAX_POOLING_OP_F32, setup_double_buffering_increasing_batch) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  ArgmaxPoolingOperatorTester()
+    .batch_size(3)
+    .next_batch_size(5)
+    .input_height(8)
+    .input_width(8)
+    .pooling_height(5)
+    .pooling_width(3)
+    .channels(24)
+    .double_buffering(true)
+    .TestSetupF32();
+}
+
+TEST(ARGMAX_POOLING_OP_F32, setup_double_buffering_small_pool) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  ArgmaxPoolingOperatorTester()
+    .batch_size(3)
+    .input_height(8)
+    .input_width(8)
+    .pooling_height(2)
+    .pooling_width(2)
+    .channels(24)
+    .double_buffering(true)
+    .TestSetupF32();
+}
@@ -380,6 +380,15 @@ class AveragePoolingOperatorTester {
     return this->qmax_;
   }
 
+  inline AveragePoolingOperatorTester& double_buffering(bool double_buffering) {
+    this->double_buffering_ = double_buffering;
+    return *this;
+  }
+
+  inline bool double_buffering() const {
+    return this->double_buffering_;
+  }
+
   inline AveragePoolingOperatorTester& iterations(size_t iterations) {
     this->iterations_ = iterations;
     return *this;
@@ -653,6 +662,12 @@ class AveragePoolingOperatorTester {
         }
       }
 
+      if (double_buffering()) {
+        // Run the second time on different buffers, as if the caller alternated between two sets of buffers.
+        std::vector<uint8_t>(input.size()).swap(input);
+        std::vector<uint8_t>(output.size()).swap(output);
+      }
+
       // Re-generate data for the second run.
       std::generate(input.begin(), input.end(), std::ref(u8rng));
       std::fill(output.begin(), output.end(), 0xA5);
@@ -810,6 +825,12 @@ class AveragePoolingOperatorTester {
         }
       }
 
+      if (double_buffering()) {
+        // Run the second time on different buffers, as if the caller alternated between two sets of buffers.
+        std::vector<float>(input.size()).swap(input);
+        std::vector<float>(output.size()).swap(output);
+      }
+
       // Re-generate data for the second run.
       std::generate(input.begin(), input.end(), std::ref(f32rng));
       std::fill(output.begin(), output.end(), std::nanf(""));
@@ -895,5 +916,6 @@ class AveragePoolingOperatorTester {
   uint8_t output_zero_point_{133};
   uint8_t qmin_{0};
   uint8_t qmax_{255};
+  bool double_buffering_{false};
   size_t iterations_{1};
 };
@@ -906,6 +906,60 @@ TEST(AVERAGE_POOLING_OP_Q8, setup_swap_height_and_width) {
     .TestSetupQ8();
 }
 
+TEST(AVERAGE_POOLING_OP_Q8, setup_double_buffering) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  AveragePoolingOperatorTester()
+    .batch_size(3)
+    .input_height(8)
+    .input_width(8)
+    .pooling_height(5)
+    .pooling_width(3)
+    .channels(24)
+    .double_buffering(true)
+    .TestSetupQ8();
+}
+
+TEST(AVERAGE_POOLING_OP_Q8, setup_double_buffering_decreasing_batch) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  AveragePoolingOperatorTester()
+    .batch_size(5)
+    .next_batch_size(3)
+    .input_height(8)
+    .input_width(8)
+    .pooling_height(5)
+    .pooling_width(3)
+    .channels(24)
+    .double_buffering(true)
+    .TestSetupQ8();
+}
+
+TEST(AVERAGE_POOLING_OP_Q8, setup_double_buffering_increasing_batch) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  AveragePoolingOperatorTester()
+    .batch_size(3)
+    .next_batch_size(5)
+    .input_height(8)
+    .input_width(8)
+    .pooling_height(5)
+    .pooling_width(3)
+    .channels(24)
+    .double_buffering(true)
+    .TestSetupQ8();
+}
+
+TEST(AVERAGE_POOLING_OP_Q8, setup_double_buffering_small_pool) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  AveragePoolingOperatorTester()
+    .batch_size(3)
+    .input_height(8)
+    .input_width(8)
+    .pooling_height(2)
+    .pooling_width(2)
+    .channels(24)
+    .double_buffering(true)
+    .TestSetupQ8();
+}
+
 TEST(AVERAGE_POOLING_OP_F32, unit_batch_small_1xM_pool) {
   ASSERT_EQ(xnn_status_success, xnn_initialize());
   for (size_t channels = 1; channels <= 100; channels += 15) {
@@ -1574,3 +1628,72 @@ TEST(AVERAGE_POOLING_OP_F32, setup_swap_height_and_width) {
     .channels(24)
     .TestSetupF32();
 }
+
+TEST(AVERAGE_POOLING_OP_F32, setup_double_buffering) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  AveragePoolingOperatorTester()
+    .batch_size(3)
+    .input_height(8)
+    .input_width(8)
+    .pooling_height(5)
+    .pooling_width(3)
+    .channels(24)
+    .double_buffering(true)
+    .TestSetupF32();
+}
+
+TEST(AVERAGE_POOLING_OP_F32, setup_double_buffering_decreasing_batch) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  AveragePoolingOperatorTester()
+    .batch_size(5)
+    .next_batch_size(3)
+    .input_height(8)
+    .input_width(8)
+    .pooling_height(5)
+    .pooling_width(3)
+    .channels(24)
+    .double_buffering(true)
+    .TestSetupF32();
+}
+
+TEST(AVERAGE_POOLING_OP_F32, setup_double_buffering_increasing_batch) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  AveragePoolingOperatorTester()
+    .batch_size(3)
+    .next_batch_size(5)
+    .input_height(8)
+    .input_width(8)
+    .pooling_height(5)
+    .pooling_width(3)
+    .channels(24)
+    .double_buffering(true)
+    .TestSetupF32();
+}
+
+TEST(AVERAGE_POOLING_OP_F32, setup_double_buffering_small_pool) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  AveragePoolingOperatorTester()
+    .batch_size(3)
+    .input_height(8)
+    .input_width(8)
+    .pooling_height(2)
+    .pooling_width(2)
+    .channels(24)
+    .double_buffering(true)
+    .TestSetupF32();
+}
+
+TEST(AVERAGE_POOLING_OP_F32, setup_double_buffering_wide) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  AveragePoolingOperatorTester()
+    .batch_size(2)
+    .input_height(4)
+    .input_width(700)
+    .padding(1)
+    .pooling_height(3)
+    .pooling_width(3)
+    .stride(1)
+    .channels(5)
+    .double_buffering(true)
+    .TestSetupF32();
+}
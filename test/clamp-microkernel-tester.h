@@ -18,6 +18,8 @@
 #include <random>
 #include <vector>
 
+#include <fp16.h>
+
 #include <xnnpack.h>
 #include <xnnpack/params.h>
 #include <xnnpack/requantization.h>
@@ -175,6 +177,48 @@ class ClampMicrokernelTester {
     }
   }
 
+  void Test(xnn_f16_clamp_ukernel_function clamp, Variant variant = Variant::Native) const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto f32rng = std::bind(std::uniform_real_distribution<float>(0.0f, 255.0f), rng);
+    auto f16rng = std::bind(fp16_ieee_from_fp32_value, f32rng);
+
+    std::vector<uint16_t> x(n() + XNN_EXTRA_BYTES / sizeof(uint16_t));
+    std::vector<uint16_t> y(n() + (inplace() ? XNN_EXTRA_BYTES / sizeof(uint16_t) : 0));
+    std::vector<float> y_ref(n());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(x.begin(), x.end(), std::ref(f16rng));
+      if (inplace()) {
+        std::generate(y.begin(), y.end(), std::ref(f16rng));
+      } else {
+        std::fill(y.begin(), y.end(), UINT16_C(0x7E00) /* NaN */);
+      }
+      const uint16_t* x_data = inplace() ? y.data() : x.data();
+
+      // Prepare output parameters.
+      const xnn_f16_output_params output_params = xnn_compute_f16_output_params(1.0f, float(qmin()), float(qmax()));
+
+      // Compute reference results.
+      for (size_t i = 0; i < n(); i++) {
+        y_ref[i] = std::max(std::min(fp16_ieee_to_fp32_value(x_data[i]), float(qmax())), float(qmin()));
+      }
+
+      // Call optimized micro-kernel.
+      clamp(n() * sizeof(uint16_t), x_data, y.data(), &output_params);
+
+      // Verify results.
+      for (size_t i = 0; i < n(); i++) {
+        ASSERT_LE(fp16_ieee_to_fp32_value(y[i]), float(qmax()))
+          << "at position " << i << ", n = " << n();
+        ASSERT_GE(fp16_ieee_to_fp32_value(y[i]), float(qmin()))
+          << "at position " << i << ", n = " << n();
+        ASSERT_EQ(y_ref[i], fp16_ieee_to_fp32_value(y[i]))
+          << "at position " << i << ", n = " << n()
+          << ", qmin = " << uint32_t(qmin()) << ", qmax = " << uint32_t(qmax());
+      }
+    }
+  }
+
  private:
   size_t n_{1};
   bool inplace_{false};
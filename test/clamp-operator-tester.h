@@ -18,6 +18,8 @@
 #include <random>
 #include <vector>
 
+#include <fp16.h>
+
 #include <xnnpack.h>
 
 
@@ -161,6 +163,68 @@ class ClampOperatorTester {
     }
   }
 
+  void TestF16() const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto f32rng = std::bind(std::uniform_real_distribution<float>(0.0f, 255.0f), rng);
+    auto f16rng = std::bind(fp16_ieee_from_fp32_value, f32rng);
+
+    std::vector<uint16_t> input(XNN_EXTRA_BYTES / sizeof(uint16_t) +
+      (batch_size() - 1) * input_stride() + channels());
+    std::vector<uint16_t> output((batch_size() - 1) * output_stride() + channels());
+    std::vector<float> output_ref(batch_size() * channels());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(f16rng));
+      std::fill(output.begin(), output.end(), UINT16_C(0x7E00) /* NaN */);
+
+      // Compute reference results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        for (size_t c = 0; c < channels(); c++) {
+          const float x = fp16_ieee_to_fp32_value(input[i * input_stride() + c]);
+          const float y = std::min(std::max(x, float(qmin())), float(qmax()));
+          output_ref[i * channels() + c] = y;
+        }
+      }
+
+      // Create, setup, run, and destroy Clamp operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize());
+      xnn_operator_t clamp_op = nullptr;
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_create_clamp_nc_f16(
+          channels(), input_stride(), output_stride(),
+          float(qmin()), float(qmax()),
+          0, &clamp_op));
+      ASSERT_NE(nullptr, clamp_op);
+
+      // Smart pointer to automatically delete clamp_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_clamp_op(clamp_op, xnn_delete_operator);
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_clamp_nc_f16(
+          clamp_op,
+          batch_size(),
+          input.data(), output.data(),
+          nullptr /* thread pool */));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(clamp_op, nullptr /* thread pool */));
+
+      // Verify results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        for (size_t c = 0; c < channels(); c++) {
+          ASSERT_LE(fp16_ieee_to_fp32_value(output[i * output_stride() + c]), float(qmax()))
+            << "at position " << i << ", batch size = " << batch_size() << ", channels = " << channels();
+          ASSERT_GE(fp16_ieee_to_fp32_value(output[i * output_stride() + c]), float(qmin()))
+            << "at position " << i << ", batch size = " << batch_size() << ", channels = " << channels();
+          ASSERT_EQ(output_ref[i * channels() + c], fp16_ieee_to_fp32_value(output[i * output_stride() + c]))
+            << "at position " << i << ", batch size = " << batch_size() << ", channels = " << channels()
+            << ", qmin = " << uint32_t(qmin()) << ", qmax = " << uint32_t(qmax());
+        }
+      }
+    }
+  }
+
   void TestF32() const {
     std::random_device random_device;
     auto rng = std::mt19937(random_device());
@@ -93,6 +93,88 @@ TEST(CLAMP_OP_U8, small_batch_with_input_and_output_stride) {
   }
 }
 
+TEST(CLAMP_OP_F16, unit_batch) {
+  for (size_t channels = 1; channels < 100; channels++) {
+    ClampOperatorTester()
+      .batch_size(1)
+      .channels(channels)
+      .iterations(3)
+      .TestF16();
+  }
+}
+
+TEST(CLAMP_OP_F16, unit_batch_with_qmin) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    for (uint8_t qmin = 1; qmin < 255; qmin++) {
+      ClampOperatorTester()
+        .batch_size(1)
+        .channels(channels)
+        .qmin(qmin)
+        .qmax(255)
+        .iterations(3)
+        .TestF16();
+    }
+  }
+}
+
+TEST(CLAMP_OP_F16, unit_batch_with_qmax) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    for (uint8_t qmax = 1; qmax < 255; qmax++) {
+      ClampOperatorTester()
+        .batch_size(1)
+        .channels(channels)
+        .qmin(0)
+        .qmax(qmax)
+        .iterations(3)
+        .TestF16();
+    }
+  }
+}
+
+TEST(CLAMP_OP_F16, small_batch) {
+  for (size_t channels = 1; channels < 100; channels++) {
+    ClampOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .iterations(3)
+      .TestF16();
+  }
+}
+
+TEST(CLAMP_OP_F16, small_batch_with_input_stride) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    ClampOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .input_stride(129)
+      .iterations(3)
+      .TestF16();
+  }
+}
+
+TEST(CLAMP_OP_F16, small_batch_with_output_stride) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    ClampOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .output_stride(117)
+      .iterations(3)
+      .TestF16();
+  }
+}
+
+TEST(CLAMP_OP_F16, small_batch_with_input_and_output_stride) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    ClampOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .input_stride(129)
+      .output_stride(117)
+      .iterations(3)
+      .TestF16();
+  }
+}
+
 TEST(CLAMP_OP_F32, unit_batch) {
   for (size_t channels = 1; channels < 100; channels++) {
     ClampOperatorTester()
@@ -14,11 +14,14 @@
 #include <cassert>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <functional>
+#include <memory>
 #include <random>
 #include <vector>
 
+#include <fp16.h>
 #include <xnnpack.h>
 
 
@@ -412,6 +415,78 @@ class ConvolutionOperatorTester {
     return this->depthwise_layout_;
   }
 
+  inline ConvolutionOperatorTester& load_packed_weights(bool load_packed_weights) {
+    this->load_packed_weights_ = load_packed_weights;
+    return *this;
+  }
+
+  inline bool load_packed_weights() const {
+    return this->load_packed_weights_;
+  }
+
+  inline ConvolutionOperatorTester& shape_cache_size(size_t shape_cache_size) {
+    this->shape_cache_size_ = shape_cache_size;
+    return *this;
+  }
+
+  inline size_t shape_cache_size() const {
+    return this->shape_cache_size_;
+  }
+
+  inline ConvolutionOperatorTester& compact_indirection(bool compact_indirection) {
+    this->compact_indirection_ = compact_indirection;
+    return *this;
+  }
+
+  inline bool compact_indirection() const {
+    return this->compact_indirection_;
+  }
+
+  inline ConvolutionOperatorTester& fp16_weights(bool fp16_weights) {
+    this->fp16_weights_ = fp16_weights;
+    return *this;
+  }
+
+  inline bool fp16_weights() const {
+    return this->fp16_weights_;
+  }
+
+  inline ConvolutionOperatorTester& int8_weights(bool int8_weights) {
+    this->int8_weights_ = int8_weights;
+    return *this;
+  }
+
+  inline bool int8_weights() const {
+    return this->int8_weights_;
+  }
+
+  inline ConvolutionOperatorTester& sparsity(float sparsity) {
+    this->sparsity_ = sparsity;
+    return *this;
+  }
+
+  inline float sparsity() const {
+    return this->sparsity_;
+  }
+
+  inline ConvolutionOperatorTester& winograd(bool winograd) {
+    this->winograd_ = winograd;
+    return *this;
+  }
+
+  inline bool winograd() const {
+    return this->winograd_;
+  }
+
+  inline ConvolutionOperatorTester& double_buffering(bool double_buffering) {
+    this->double_buffering_ = double_buffering;
+    return *this;
+  }
+
+  inline bool double_buffering() const {
+    return this->double_buffering_;
+  }
+
   inline ConvolutionOperatorTester& iterations(size_t iterations) {
     this->iterations_ = iterations;
     return *this;
@@ -542,7 +617,8 @@ class ConvolutionOperatorTester {
           kernel_zero_point, 1.0f /* kernel scale */,
           kernel.data(), bias.data(),
           output_zero_point, output_scale, qmin(), qmax(),
-          depthwise_layout() ? XNN_FLAG_DEPTHWISE_CONVOLUTION : 0,
+          (depthwise_layout() ? XNN_FLAG_DEPTHWISE_CONVOLUTION : 0) |
+            (compact_indirection() ? XNN_FLAG_COMPACT_INDIRECTION : 0),
           &convolution_op));
 
       // Smart pointer to automatically delete convolution_op.
@@ -581,10 +657,336 @@ class ConvolutionOperatorTester {
     }
   }
 
+  void TestQ8C() const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto s32rng = std::bind(std::uniform_int_distribution<int32_t>(-10000, 10000), rng);
+    auto u8rng = std::bind(std::uniform_int_distribution<uint8_t>(), rng);
+    auto scalerng = std::bind(std::uniform_real_distribution<float>(0.5f, 1.0f), rng);
+
+    std::vector<uint8_t> input(XNN_EXTRA_BYTES / sizeof(uint8_t) +
+      batch_size() * ((input_height() * input_width() - 1) * input_pixel_stride() + groups() * group_input_channels()) + 8);
+    std::vector<uint8_t> kernel(groups() * group_output_channels() * kernel_height() * kernel_width() * group_input_channels());
+    std::vector<int32_t> bias(groups() * group_output_channels());
+    std::vector<float> kernel_scale(groups() * group_output_channels());
+    std::vector<uint8_t> output(batch_size() * ((output_height() * output_width() - 1) * output_pixel_stride() + groups() * group_output_channels()));
+    std::vector<int32_t> accumulators(batch_size() * output_height() * output_width() * groups() * group_output_channels());
+    std::vector<double> output_ref(batch_size() * output_height() * output_width() * groups() * group_output_channels());
+
+    const uint8_t input_zero_point = 127;
+    const uint8_t kernel_zero_point = 127;
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(u8rng));
+      std::generate(kernel.begin(), kernel.end(), std::ref(u8rng));
+      std::generate(bias.begin(), bias.end(), std::ref(s32rng));
+      std::generate(kernel_scale.begin(), kernel_scale.end(), std::ref(scalerng));
+      std::fill(output.begin(), output.end(), 0xA5);
+
+      // Compute reference results, without renormalization.
+      for (size_t i = 0; i < batch_size(); i++) {
+        for (size_t oy = 0; oy < output_height(); oy++) {
+          for (size_t ox = 0; ox < output_width(); ox++) {
+            for (size_t g = 0; g < groups(); g++) {
+              for (size_t oc = 0; oc < group_output_channels(); oc++) {
+                accumulators[(((i * output_height() + oy) * output_width() + ox) * groups() + g) * group_output_channels() + oc] =
+                  bias[g * group_output_channels() + oc];
+              }
+            }
+          }
+        }
+      }
+      if (depthwise_layout()) {
+        ASSERT_EQ(group_input_channels(), 1);
+
+        for (size_t i = 0; i < batch_size(); i++) {
+          for (size_t oy = 0; oy < output_height(); oy++) {
+            for (size_t ox = 0; ox < output_width(); ox++) {
+              for (size_t ky = 0; ky < kernel_height(); ky++) {
+                const size_t iy = oy * subsampling_height() + ky * dilation_height() - padding_top();
+                if (iy < input_height()) {
+                  for (size_t kx = 0; kx < kernel_width(); kx++) {
+                    const size_t ix = ox * subsampling_width() + kx * dilation_width() - padding_left();
+                    if (ix < input_width()) {
+                      for (size_t g = 0; g < groups(); g++) {
+                        for (size_t oc = 0; oc < group_output_channels(); oc++) {
+                          accumulators[(((i * output_height() + oy) * output_width() + ox) * groups() + g) * group_output_channels() + oc] +=
+                            (int32_t(input[((i * input_height() + iy) * input_width() + ix) * input_pixel_stride() + g]) - int32_t(input_zero_point)) *
+                            (int32_t(kernel[((ky * kernel_width() + kx) * groups() + g) * group_output_channels() + oc]) - int32_t(kernel_zero_point));
+                        }
+                      }
+                    }
+                  }
+                }
+              }
+            }
+          }
+        }
+      } else {
+        for (size_t i = 0; i < batch_size(); i++) {
+          for (size_t oy = 0; oy < output_height(); oy++) {
+            for (size_t ox = 0; ox < output_width(); ox++) {
+              for (size_t ky = 0; ky < kernel_height(); ky++) {
+                const size_t iy = oy * subsampling_height() + ky * dilation_height() - padding_top();
+                if (iy < input_height()) {
+                  for (size_t kx = 0; kx < kernel_width(); kx++) {
+                    const size_t ix = ox * subsampling_width() + kx * dilation_width() - padding_left();
+                    if (ix < input_width()) {
+                      for (size_t g = 0; g < groups(); g++) {
+                        for (size_t oc = 0; oc < group_output_channels(); oc++) {
+                          for (size_t ic = 0; ic < group_input_channels(); ic++) {
+                            accumulators[(((i * output_height() + oy) * output_width() + ox) * groups() + g) * group_output_channels() + oc] +=
+                              (int32_t(input[((i * input_height() + iy) * input_width() + ix) * input_pixel_stride() + g * group_input_channels() + ic]) - int32_t(input_zero_point)) *
+                              (int32_t(kernel[(((g * group_output_channels() + oc) * kernel_height() + ky) * kernel_width() + kx) * group_input_channels() + ic]) - int32_t(kernel_zero_point));
+                          }
+                        }
+                      }
+                    }
+                  }
+                }
+              }
+            }
+          }
+        }
+      }
+
+      // Compute renormalization parameters.
+      const int32_t accumulated_min = *std::min_element(accumulators.cbegin(), accumulators.cend());
+      const int32_t accumulated_max = *std::max_element(accumulators.cbegin(), accumulators.cend());
+
+      const double output_scale = double(uint32_t(accumulated_max - accumulated_min)) / 255.0;
+      const uint8_t output_zero_point = uint8_t(std::max(std::min(
+        lrint(127.5 - 0.5 * double(accumulated_min + accumulated_max) / output_scale),
+        long(std::numeric_limits<uint8_t>::max())), long(std::numeric_limits<uint8_t>::min())));
+
+      // Renormalize reference results.
+      for (size_t i = 0; i < accumulators.size(); i++) {
+        const size_t c = i % (groups() * group_output_channels());
+        output_ref[i] = std::max<double>(std::min<double>(
+          double(accumulators[i]) * double(kernel_scale[c]) / output_scale,
+          double(qmax()) - output_zero_point), double(qmin()) - output_zero_point);
+      }
+
+      // Create, setup, run, and destroy Convolution operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize());
+      xnn_operator_t convolution_op = nullptr;
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_create_convolution2d_nhwc_q8c(
+          padding_top(), padding_right(), padding_bottom(), padding_left(),
+          kernel_height(), kernel_width(),
+          subsampling_height(), subsampling_width(),
+          dilation_height(), dilation_width(),
+          groups(), group_input_channels(), group_output_channels(),
+          input_pixel_stride(), output_pixel_stride(),
+          input_zero_point, 1.0f /* input scale */,
+          kernel_zero_point, kernel_scale.data(),
+          kernel.data(), bias.data(),
+          output_zero_point, output_scale, qmin(), qmax(),
+          (depthwise_layout() ? XNN_FLAG_DEPTHWISE_CONVOLUTION : 0) |
+            (compact_indirection() ? XNN_FLAG_COMPACT_INDIRECTION : 0),
+          &convolution_op));
+
+      // Smart pointer to automatically delete convolution_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_convolution_op(convolution_op, xnn_delete_operator);
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_convolution2d_nhwc_q8c(
+          convolution_op,
+          batch_size(), input_height(), input_width(),
+          input.data(), output.data(),
+          nullptr /* thread pool */));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(convolution_op, nullptr /* thread pool */));
+
+      // Verify results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        for (size_t y = 0; y < output_height(); y++) {
+          for (size_t x = 0; x < output_width(); x++) {
+            for (size_t g = 0; g < groups(); g++) {
+              for (size_t c = 0; c < group_output_channels(); c++) {
+                ASSERT_LE(int32_t(output[((i * output_height() + y) * output_width() + x) * output_pixel_stride() + g * group_output_channels() + c]), int32_t(qmax()))
+                  << "(x, y) = (" << x << ", " << y << "), group = " << g << ", channel = " << c;
+                ASSERT_GE(int32_t(output[((i * output_height() + y) * output_width() + x) * output_pixel_stride() + g * group_output_channels() + c]), int32_t(qmin()))
+                  << "(x, y) = (" << x << ", " << y << "), group = " << g << ", channel = " << c;
+                ASSERT_NEAR(
+                    output_ref[(((i * output_height() + y) * output_width() + x) * groups() + g) * group_output_channels() + c],
+                    double(output[((i * output_height() + y) * output_width() + x) * output_pixel_stride() + g * group_output_channels() + c]) - double(output_zero_point),
+                    0.9)
+                  << "(x, y) = (" << x << ", " << y << "), group = " << g << ", channel = " << c;
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+  void TestF16() const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto f32rng = std::bind(std::uniform_real_distribution<float>(0.1f, 1.0f), rng);
+    auto f16rng = std::bind(fp16_ieee_from_fp32_value, f32rng);
+
+    std::vector<uint16_t> input(XNN_EXTRA_BYTES / sizeof(uint16_t) +
+      batch_size() * ((input_height() * input_width() - 1) * input_pixel_stride() + groups() * group_input_channels()));
+    std::vector<uint16_t> kernel(groups() * group_output_channels() * kernel_height() * kernel_width() * group_input_channels());
+    std::vector<uint16_t> bias(groups() * group_output_channels());
+    std::vector<uint16_t> output(batch_size() * ((output_height() * output_width() - 1) * output_pixel_stride() + groups() * group_output_channels()));
+    std::vector<float> output_ref(batch_size() * output_height() * output_width() * groups() * group_output_channels());
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(f16rng));
+      std::generate(kernel.begin(), kernel.end(), std::ref(f16rng));
+      std::generate(bias.begin(), bias.end(), std::ref(f16rng));
+      std::fill(output.begin(), output.end(), UINT16_C(0x7E00) /* NaN */);
+
+      // Reference results are computed in single precision from the half-precision inputs and weights.
+      std::vector<float> input_ref(input.size());
+      std::transform(input.cbegin(), input.cend(), input_ref.begin(), fp16_ieee_to_fp32_value);
+      std::vector<float> kernel_ref(kernel.size());
+      std::transform(kernel.cbegin(), kernel.cend(), kernel_ref.begin(), fp16_ieee_to_fp32_value);
+
+      // Compute reference results, without clamping.
+      for (size_t i = 0; i < batch_size(); i++) {
+        for (size_t oy = 0; oy < output_height(); oy++) {
+          for (size_t ox = 0; ox < output_width(); ox++) {
+            for (size_t g = 0; g < groups(); g++) {
+              for (size_t oc = 0; oc < group_output_channels(); oc++) {
+                output_ref[(((i * output_height() + oy) * output_width() + ox) * groups() + g) * group_output_channels() + oc] =
+                  fp16_ieee_to_fp32_value(bias[g * group_output_channels() + oc]);
+              }
+            }
+          }
+        }
+      }
+      if (depthwise_layout()) {
+        ASSERT_EQ(group_input_channels(), 1);
+
+        for (size_t i = 0; i < batch_size(); i++) {
+          for (size_t oy = 0; oy < output_height(); oy++) {
+            for (size_t ox = 0; ox < output_width(); ox++) {
+              for (size_t ky = 0; ky < kernel_height(); ky++) {
+                const size_t iy = oy * subsampling_height() + ky * dilation_height() - padding_top();
+                if (iy < input_height()) {
+                  for (size_t kx = 0; kx < kernel_width(); kx++) {
+                    const size_t ix = ox * subsampling_width() + kx * dilation_width() - padding_left();
+                    if (ix < input_width()) {
+                      for (size_t g = 0; g < groups(); g++) {
+                        for (size_t oc = 0; oc < group_output_channels(); oc++) {
+                          output_ref[(((i * output_height() + oy) * output_width() + ox) * groups() + g) * group_output_channels() + oc] +=
+                            input_ref[((i * input_height() + iy) * input_width() + ix) * input_pixel_stride() + g] *
+                            kernel_ref[((ky * kernel_width() + kx) * groups() + g) * group_output_channels() + oc];
+                        }
+                      }
+                    }
+                  }
+                }
+              }
+            }
+          }
+        }
+      } else {
+        for (size_t i = 0; i < batch_size(); i++) {
+          for (size_t oy = 0; oy < output_height(); oy++) {
+            for (size_t ox = 0; ox < output_width(); ox++) {
+              for (size_t ky = 0; ky < kernel_height(); ky++) {
+                const size_t iy = oy * subsampling_height() + ky * dilation_height() - padding_top();
+                if (iy < input_height()) {
+                  for (size_t kx = 0; kx < kernel_width(); kx++) {
+                    const size_t ix = ox * subsampling_width() + kx * dilation_width() - padding_left();
+                    if (ix < input_width()) {
+                      for (size_t g = 0; g < groups(); g++) {
+                        for (size_t oc = 0; oc < group_output_channels(); oc++) {
+                          for (size_t ic = 0; ic < group_input_channels(); ic++) {
+                            output_ref[(((i * output_height() + oy) * output_width() + ox) * groups() + g) * group_output_channels() + oc] +=
+                              input_ref[((i * input_height() + iy) * input_width() + ix) * input_pixel_stride() + g * group_input_channels() + ic] *
+                              kernel_ref[(((g * group_output_channels() + oc) * kernel_height() + ky) * kernel_width() + kx) * group_input_channels() + ic];
+                          }
+                        }
+                      }
+                    }
+                  }
+                }
+              }
+            }
+          }
+        }
+      }
+
+      // Compute clamping parameters, rounded to half precision.
+      const float accumulated_min = *std::min_element(output_ref.cbegin(), output_ref.cend());
+      const float accumulated_max = *std::max_element(output_ref.cbegin(), output_ref.cend());
+
+      const float output_min = fp16_ieee_to_fp32_value(fp16_ieee_from_fp32_value(
+        accumulated_min + (accumulated_max - accumulated_min) / 255.0f * float(qmin())));
+      const float output_max = fp16_ieee_to_fp32_value(fp16_ieee_from_fp32_value(
+        accumulated_max - (accumulated_max - accumulated_min) / 255.0f * float(255 - qmax())));
+
+      // Clamp reference results.
+      for (float& value : output_ref) {
+        value = std::max(std::min(value, output_max), output_min);
+      }
+
+      // Create, setup, run, and destroy Convolution operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize());
+      xnn_operator_t convolution_op = nullptr;
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_create_convolution2d_nhwc_f16(
+          padding_top(), padding_right(), padding_bottom(), padding_left(),
+          kernel_height(), kernel_width(),
+          subsampling_height(), subsampling_width(),
+          dilation_height(), dilation_width(),
+          groups(), group_input_channels(), group_output_channels(),
+          input_pixel_stride(), output_pixel_stride(),
+          kernel.data(), bias.data(),
+          output_min, output_max,
+          depthwise_layout() ? XNN_FLAG_DEPTHWISE_CONVOLUTION : 0,
+          &convolution_op));
+
+      // Smart pointer to automatically delete convolution_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_convolution_op(convolution_op, xnn_delete_operator);
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_convolution2d_nhwc_f16(
+          convolution_op,
+          batch_size(), input_height(), input_width(),
+          input.data(), output.data(),
+          nullptr /* thread pool */));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(convolution_op, nullptr /* thread pool */));
+
+      // Verify results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        for (size_t y = 0; y < output_height(); y++) {
+          for (size_t x = 0; x < output_width(); x++) {
+            for (size_t g = 0; g < groups(); g++) {
+              for (size_t c = 0; c < group_output_channels(); c++) {
+                ASSERT_GE(fp16_ieee_to_fp32_value(output[((i * output_height() + y) * output_width() + x) * output_pixel_stride() + g * group_output_channels() + c]), output_min)
+                  << "(x, y) = (" << x << ", " << y << "), group = " << g << ", channel = " << c;
+                ASSERT_LE(fp16_ieee_to_fp32_value(output[((i * output_height() + y) * output_width() + x) * output_pixel_stride() + g * group_output_channels() + c]), output_max)
+                  << "(x, y) = (" << x << ", " << y << "), group = " << g << ", channel = " << c;
+                ASSERT_NEAR(
+                    output_ref[(((i * output_height() + y) * output_width() + x) * groups() + g) * group_output_channels() + c],
+                    fp16_ieee_to_fp32_value(output[((i * output_height() + y) * output_width() + x) * output_pixel_stride() + g * group_output_channels() + c]),
+                    1.0e-2 * std::abs(output_ref[(((i * output_height() + y) * output_width() + x) * groups() + g) * group_output_channels() + c]))
+                  << "(x, y) = (" << x << ", " << y << "), group = " << g << ", channel = " << c;
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
   void TestF32() const {
     std::random_device random_device;
     auto rng = std::mt19937(random_device());
     auto f32rng = std::bind(std::uniform_real_distribution<float>(0.1f, 1.0f), rng);
+    auto prng = std::bind(std::uniform_real_distribution<float>(), rng);
 
     std::vector<float> input(XNN_EXTRA_BYTES / sizeof(float) +
       batch_size() * ((input_height() * input_width() - 1) * input_pixel_stride() + groups() * group_input_channels()));
@@ -596,9 +998,35 @@ class ConvolutionOperatorTester {
     for (size_t iteration = 0; iteration < iterations(); iteration++) {
       std::generate(input.begin(), input.end(), std::ref(f32rng));
       std::generate(kernel.begin(), kernel.end(), std::ref(f32rng));
+      for (float& k : kernel) {
+        if (prng() < sparsity()) {
+          k = 0.0f;
+        }
+      }
       std::generate(bias.begin(), bias.end(), std::ref(f32rng));
       std::fill(output.begin(), output.end(), nanf(""));
 
+      // Reference results use the weights as the operator stores them, i.e. rounded to half-precision or quantized
+      // symmetrically to 8 bits with per-output-channel scales.
+      std::vector<float> kernel_ref(kernel);
+      if (fp16_weights()) {
+        for (float& k : kernel_ref) {
+          k = fp16_ieee_to_fp32_value(fp16_ieee_from_fp32_value(k));
+        }
+      } else if (int8_weights()) {
+        const size_t k_row_size = kernel_height() * kernel_width() * group_input_channels();
+        for (size_t oc = 0; oc < groups() * group_output_channels(); oc++) {
+          float* k_row = kernel_ref.data() + oc * k_row_size;
+          float k_absmax = 0.0f;
+          for (size_t k = 0; k < k_row_size; k++) {
+            k_absmax = std::max(k_absmax, std::abs(k_row[k]));
+          }
+          for (size_t k = 0; k < k_row_size; k++) {
+            k_row[k] = float(lrintf(k_row[k] * (127.0f / k_absmax))) * (k_absmax / 127.0f);
+          }
+        }
+      }
+
       // Compute reference results, without clamping.
       for (size_t i = 0; i < batch_size(); i++) {
         for (size_t oy = 0; oy < output_height(); oy++) {
@@ -628,7 +1056,7 @@ class ConvolutionOperatorTester {
                         for (size_t oc = 0; oc < group_output_channels(); oc++) {
                           output_ref[(((i * output_height() + oy) * output_width() + ox) * groups() + g) * group_output_channels() + oc] +=
                             input[((i * input_height() + iy) * input_width() + ix) * input_pixel_stride() + g] *
-                            kernel[((ky * kernel_width() + kx) * groups() + g) * group_output_channels() + oc];
+                            kernel_ref[((ky * kernel_width() + kx) * groups() + g) * group_output_channels() + oc];
                         }
                       }
                     }
@@ -653,7 +1081,7 @@ class ConvolutionOperatorTester {
                           for (size_t ic = 0; ic < group_input_channels(); ic++) {
                             output_ref[(((i * output_height() + oy) * output_width() + ox) * groups() + g) * group_output_channels() + oc] +=
                               input[((i * input_height() + iy) * input_width() + ix) * input_pixel_stride() + g * group_input_channels() + ic] *
-                              kernel[(((g * group_output_channels() + oc) * kernel_height() + ky) * kernel_width() + kx) * group_input_channels() + ic];
+                              kernel_ref[(((g * group_output_channels() + oc) * kernel_height() + ky) * kernel_width() + kx) * group_input_channels() + ic];
                           }
                         }
                       }
@@ -692,12 +1120,50 @@ class ConvolutionOperatorTester {
           input_pixel_stride(), output_pixel_stride(),
           kernel.data(), bias.data(),
           output_min, output_max,
-          depthwise_layout() ? XNN_FLAG_DEPTHWISE_CONVOLUTION : 0,
+          (depthwise_layout() ? XNN_FLAG_DEPTHWISE_CONVOLUTION : 0) |
+            (compact_indirection() ? XNN_FLAG_COMPACT_INDIRECTION : 0) |
+            (fp16_weights() ? XNN_FLAG_FP16_WEIGHTS : 0) |
+            (int8_weights() ? XNN_FLAG_INT8_WEIGHTS : 0) |
+            (winograd() ? 0 : XNN_FLAG_DISABLE_WINOGRAD),
           &convolution_op));
 
       // Smart pointer to automatically delete convolution_op.
       std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_convolution_op(convolution_op, xnn_delete_operator);
 
+      // Blob with serialized packed weights, aligned as required by xnn_create_convolution2d_nhwc_f32_from_packed_weights.
+      std::vector<uint8_t> packed_weights_storage;
+      if (load_packed_weights()) {
+        size_t packed_weights_size = 0;
+        ASSERT_EQ(xnn_status_success,
+          xnn_get_operator_packed_weights_size(convolution_op, &packed_weights_size));
+        packed_weights_storage.resize(packed_weights_size + 64);
+        void* packed_weights = reinterpret_cast<void*>(
+          (reinterpret_cast<uintptr_t>(packed_weights_storage.data()) + 63) & ~uintptr_t(63));
+        ASSERT_EQ(xnn_status_success,
+          xnn_export_operator_packed_weights(convolution_op, packed_weights_size, packed_weights));
+
+        // Replace the operator with the one which uses serialized packed weights in-place.
+        auto_convolution_op.reset();
+        convolution_op = nullptr;
+        ASSERT_EQ(xnn_status_success,
+          xnn_create_convolution2d_nhwc_f32_from_packed_weights(
+            padding_top(), padding_right(), padding_bottom(), padding_left(),
+            kernel_height(), kernel_width(),
+            subsampling_height(), subsampling_width(),
+            dilation_height(), dilation_width(),
+            groups(), group_input_channels(), group_output_channels(),
+            input_pixel_stride(), output_pixel_stride(),
+            packed_weights, packed_weights_size,
+            output_min, output_max,
+            (depthwise_layout() ? XNN_FLAG_DEPTHWISE_CONVOLUTION : 0) |
+            (compact_indirection() ? XNN_FLAG_COMPACT_INDIRECTION : 0) |
+            (fp16_weights() ? XNN_FLAG_FP16_WEIGHTS : 0) |
+            (int8_weights() ? XNN_FLAG_INT8_WEIGHTS : 0) |
+            (winograd() ? 0 : XNN_FLAG_DISABLE_WINOGRAD),
+            &convolution_op));
+        auto_convolution_op.reset(convolution_op);
+      }
+
       ASSERT_EQ(xnn_status_success,
         xnn_setup_convolution2d_nhwc_f32(
           convolution_op,
@@ -831,7 +1297,7 @@ class ConvolutionOperatorTester {
           kernel_zero_point, 1.0f /* kernel scale */,
           kernel.data(), bias.data(),
           output_zero_point, output_scale, qmin(), qmax(),
-          0, &convolution_op));
+          compact_indirection() ? XNN_FLAG_COMPACT_INDIRECTION : 0, &convolution_op));
 
       // Smart pointer to automatically delete convolution_op.
       std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_convolution_op(convolution_op, xnn_delete_operator);
@@ -867,6 +1333,12 @@ class ConvolutionOperatorTester {
         }
       }
 
+      if (double_buffering()) {
+        // Run the second time on different buffers, as if the caller alternated between two sets of buffers.
+        std::vector<uint8_t>(input.size()).swap(input);
+        std::vector<uint8_t>(output.size()).swap(output);
+      }
+
       // Re-generate data for the second run.
       std::generate(input.begin(), input.end(), std::ref(u8rng));
       std::fill(output.begin(), output.end(), 0xA5);
@@ -1037,11 +1509,16 @@ class ConvolutionOperatorTester {
           input_pixel_stride(), output_pixel_stride(),
           kernel.data(), bias.data(),
           output_min, output_max,
-          0, &convolution_op));
+          (compact_indirection() ? XNN_FLAG_COMPACT_INDIRECTION : 0) | (winograd() ? 0 : XNN_FLAG_DISABLE_WINOGRAD),
+          &convolution_op));
 
       // Smart pointer to automatically delete convolution_op.
       std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_convolution_op(convolution_op, xnn_delete_operator);
 
+      if (shape_cache_size() != 0) {
+        ASSERT_EQ(xnn_status_success, xnn_enable_operator_shape_cache(convolution_op, shape_cache_size()));
+      }
+
       ASSERT_EQ(xnn_status_success,
         xnn_setup_convolution2d_nhwc_f32(
           convolution_op,
@@ -1073,7 +1550,14 @@ class ConvolutionOperatorTester {
         }
       }
 
+      if (double_buffering()) {
+        // Run the second time on different buffers, as if the caller alternated between two sets of buffers.
+        std::vector<float>(input.size()).swap(input);
+        std::vector<float>(output.size()).swap(output);
+      }
+
       // Re-generate data for the second run.
+      const std::vector<float> first_input(input);
       std::generate(input.begin(), input.end(), std::ref(f32rng));
       std::fill(output.begin(), output.end(), nanf(""));
 
@@ -1150,6 +1634,39 @@ class ConvolutionOperatorTester {
           }
         }
       }
+
+      if (shape_cache_size() != 0) {
+        // Setup and run Convolution operator with the original shape again, reusing the cached setup state.
+        std::copy(first_input.cbegin(), first_input.cend(), input.begin());
+        std::fill(output.begin(), output.end(), nanf(""));
+
+        ASSERT_EQ(xnn_status_success,
+          xnn_setup_convolution2d_nhwc_f32(
+            convolution_op,
+            batch_size(), input_height(), input_width(),
+            input.data(), output.data(),
+            nullptr /* thread pool */));
+
+        ASSERT_EQ(xnn_status_success,
+          xnn_run_operator(convolution_op, nullptr /* thread pool */));
+
+        // Verify results of the third run.
+        for (size_t i = 0; i < batch_size(); i++) {
+          for (size_t y = 0; y < output_height(); y++) {
+            for (size_t x = 0; x < output_width(); x++) {
+              for (size_t g = 0; g < groups(); g++) {
+                for (size_t c = 0; c < group_output_channels(); c++) {
+                  ASSERT_NEAR(
+                      output_ref[(((i * output_height() + y) * output_width() + x) * groups() + g) * group_output_channels() + c],
+                      output[((i * output_height() + y) * output_width() + x) * output_pixel_stride() + g * group_output_channels() + c],
+                      1.0e-4 * std::abs(output_ref[(((i * output_height() + y) * output_width() + x) * groups() + g) * group_output_channels() + c]))
+                    << "(x, y) = (" << x << ", " << y << "), group = " << g << ", channel = " << c;
+                }
+              }
+            }
+          }
+        }
+      }
     }
   }
 
@@ -1178,5 +1695,13 @@ class ConvolutionOperatorTester {
   uint8_t qmin_{0};
   uint8_t qmax_{255};
   bool depthwise_layout_{false};
+  bool load_packed_weights_{false};
+  size_t shape_cache_size_{0};
+  bool compact_indirection_{false};
+  bool fp16_weights_{false};
+  bool int8_weights_{false};
+  float sparsity_{0.0f};
+  bool winograd_{true};
+  bool double_buffering_{false};
   size_t iterations_{1};
 };
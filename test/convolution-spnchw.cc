@@ -238,6 +238,134 @@ TEST(CONVOLUTION_SpNHWC_OP_F32, batched_1x1_with_qmax) {
     .TestF32();
 }
 
+/**************************** SPMM path, grouped and subsampled ****************************/
+
+TEST(CONVOLUTION_SpNHWC_OP_F32, grouped_1x1) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  ConvolutionSpNCHWOperatorTester()
+    .input_size(27, 29)
+    .kernel_size(1, 1)
+    .groups(3)
+    .group_input_channels(23)
+    .group_output_channels(19)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_SpNHWC_OP_F32, grouped_1x1_varying_output_channels) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  for (size_t output_channels = 1; output_channels <= 19; output_channels += 3) {
+    ConvolutionSpNCHWOperatorTester()
+      .input_size(27, 29)
+      .kernel_size(1, 1)
+      .groups(3)
+      .group_input_channels(23)
+      .group_output_channels(output_channels)
+      .iterations(1)
+      .TestF32();
+  }
+}
+
+TEST(CONVOLUTION_SpNHWC_OP_F32, grouped_1x1_zero_weights) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  ConvolutionSpNCHWOperatorTester()
+    .input_size(27, 29)
+    .kernel_size(1, 1)
+    .groups(3)
+    .group_input_channels(23)
+    .group_output_channels(19)
+    .sparsity(1.0f)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_SpNHWC_OP_F32, 1x1s2) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  ConvolutionSpNCHWOperatorTester()
+    .input_size(27, 29)
+    .kernel_size(1, 1)
+    .subsampling(2)
+    .group_input_channels(23)
+    .group_output_channels(19)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_SpNHWC_OP_F32, 1x1s2_varying_input_size) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  for (size_t input_height = 1; input_height <= 6; input_height++) {
+    for (size_t input_width = 1; input_width <= 6; input_width++) {
+      ConvolutionSpNCHWOperatorTester()
+        .input_size(input_height, input_width)
+        .kernel_size(1, 1)
+        .subsampling(2)
+        .group_input_channels(23)
+        .group_output_channels(19)
+        .iterations(1)
+        .TestF32();
+    }
+  }
+}
+
+TEST(CONVOLUTION_SpNHWC_OP_F32, 1x1_with_padding) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  ConvolutionSpNCHWOperatorTester()
+    .input_size(27, 29)
+    .kernel_size(1, 1)
+    .padding_top(1)
+    .padding_right(2)
+    .padding_bottom(3)
+    .padding_left(4)
+    .group_input_channels(23)
+    .group_output_channels(19)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_SpNHWC_OP_F32, batched_grouped_1x1s2) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  ConvolutionSpNCHWOperatorTester()
+    .batch_size(2)
+    .input_size(27, 29)
+    .kernel_size(1, 1)
+    .subsampling(2)
+    .groups(2)
+    .group_input_channels(23)
+    .group_output_channels(19)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_SpNHWC_OP_F32, batched_grouped_1x1s2_with_input_stride) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  ConvolutionSpNCHWOperatorTester()
+    .batch_size(2)
+    .input_size(27, 29)
+    .kernel_size(1, 1)
+    .subsampling(2)
+    .input_batch_stride(36031)
+    .groups(2)
+    .group_input_channels(23)
+    .group_output_channels(19)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_SpNHWC_OP_F32, batched_grouped_1x1s2_with_output_stride) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  ConvolutionSpNCHWOperatorTester()
+    .batch_size(2)
+    .input_size(27, 29)
+    .kernel_size(1, 1)
+    .subsampling(2)
+    .output_batch_stride(7993)
+    .groups(2)
+    .group_input_channels(23)
+    .group_output_channels(19)
+    .iterations(3)
+    .TestF32();
+}
+
 /**************************** DConv 3x3c3s2 HWC->SpCHW path ****************************/
 
 TEST(CONVOLUTION_HWC2SpNHWC_OP_F32, 3x3c3s2) {
@@ -864,3 +992,293 @@ TEST(CONVOLUTION_SpNHWC_OP_F32, batched_depthwise_3x3s2_with_qmax) {
     .iterations(3)
     .TestF32();
 }
+
+/**************************** DWCONV 3x3 path with vertical padding ****************************/
+
+TEST(CONVOLUTION_SpNHWC_OP_F32, depthwise_3x3_with_padding) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  ConvolutionSpNCHWOperatorTester()
+    .input_size(27, 29)
+    .kernel_size(3, 3)
+    .padding_height(1)
+    .padding_width(1)
+    .groups(19)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_SpNHWC_OP_F32, depthwise_3x3_with_padding_varying_input_height) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  for (size_t input_height = 1; input_height <= 9; input_height++) {
+    ConvolutionSpNCHWOperatorTester()
+      .input_size(input_height, 29)
+      .kernel_size(3, 3)
+      .padding_height(1)
+      .padding_width(1)
+      .groups(19)
+      .iterations(1)
+      .TestF32();
+  }
+}
+
+TEST(CONVOLUTION_SpNHWC_OP_F32, batched_depthwise_3x3_with_padding) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  ConvolutionSpNCHWOperatorTester()
+    .batch_size(2)
+    .input_size(27, 29)
+    .kernel_size(3, 3)
+    .padding_height(1)
+    .padding_width(1)
+    .groups(19)
+    .iterations(3)
+    .TestF32();
+}
+
+/**************************** DWCONV 3x3 stride-2 path with vertical padding ****************************/
+
+TEST(CONVOLUTION_SpNHWC_OP_F32, depthwise_3x3s2_with_padding) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  ConvolutionSpNCHWOperatorTester()
+    .input_size(27, 29)
+    .kernel_size(3, 3)
+    .padding_height(1)
+    .padding_width(1)
+    .subsampling(2)
+    .groups(19)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_SpNHWC_OP_F32, depthwise_3x3s2_with_padding_varying_input_height) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  for (size_t input_height = 1; input_height <= 9; input_height++) {
+    ConvolutionSpNCHWOperatorTester()
+      .input_size(input_height, 29)
+      .kernel_size(3, 3)
+      .padding_height(1)
+      .padding_width(1)
+      .subsampling(2)
+      .groups(19)
+      .iterations(1)
+      .TestF32();
+  }
+}
+
+TEST(CONVOLUTION_SpNHWC_OP_F32, batched_depthwise_3x3s2_with_padding) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  ConvolutionSpNCHWOperatorTester()
+    .batch_size(2)
+    .input_size(27, 29)
+    .kernel_size(3, 3)
+    .padding_height(1)
+    .padding_width(1)
+    .subsampling(2)
+    .groups(19)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_SpNHWC_OP_F32, depthwise_3x3s2_with_bottom_padding) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  ConvolutionSpNCHWOperatorTester()
+    .input_size(27, 29)
+    .kernel_size(3, 3)
+    .padding_top(0)
+    .padding_bottom(1)
+    .padding_width(1)
+    .subsampling(2)
+    .groups(19)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_SpNHWC_OP_F32, depthwise_3x3s2_with_bottom_padding_varying_input_height) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  for (size_t input_height = 2; input_height <= 10; input_height++) {
+    ConvolutionSpNCHWOperatorTester()
+      .input_size(input_height, 29)
+      .kernel_size(3, 3)
+      .padding_top(0)
+      .padding_bottom(1)
+      .padding_width(1)
+      .subsampling(2)
+      .groups(19)
+      .iterations(1)
+      .TestF32();
+  }
+}
+
+TEST(CONVOLUTION_SpNHWC_OP_F32, batched_depthwise_3x3s2_with_bottom_padding) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  ConvolutionSpNCHWOperatorTester()
+    .batch_size(2)
+    .input_size(27, 29)
+    .kernel_size(3, 3)
+    .padding_top(0)
+    .padding_bottom(1)
+    .padding_width(1)
+    .subsampling(2)
+    .groups(19)
+    .iterations(3)
+    .TestF32();
+}
+
+/**************************** DWCONV 5x5 path ****************************/
+
+TEST(CONVOLUTION_SpNHWC_OP_F32, depthwise_5x5) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  ConvolutionSpNCHWOperatorTester()
+    .input_size(27, 29)
+    .kernel_size(5, 5)
+    .padding_width(2)
+    .groups(19)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_SpNHWC_OP_F32, depthwise_5x5_varying_input_height) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  for (size_t input_height = 5; input_height <= 13; input_height++) {
+    ConvolutionSpNCHWOperatorTester()
+      .input_size(input_height, 29)
+      .kernel_size(5, 5)
+      .padding_width(2)
+      .groups(19)
+      .iterations(1)
+      .TestF32();
+  }
+}
+
+TEST(CONVOLUTION_SpNHWC_OP_F32, batched_depthwise_5x5) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  ConvolutionSpNCHWOperatorTester()
+    .batch_size(2)
+    .input_size(27, 29)
+    .kernel_size(5, 5)
+    .padding_width(2)
+    .groups(19)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_SpNHWC_OP_F32, depthwise_5x5_with_padding) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  ConvolutionSpNCHWOperatorTester()
+    .input_size(27, 29)
+    .kernel_size(5, 5)
+    .padding_height(2)
+    .padding_width(2)
+    .groups(19)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_SpNHWC_OP_F32, depthwise_5x5_with_padding_varying_input_height) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  for (size_t input_height = 1; input_height <= 9; input_height++) {
+    ConvolutionSpNCHWOperatorTester()
+      .input_size(input_height, 29)
+      .kernel_size(5, 5)
+      .padding_height(2)
+      .padding_width(2)
+      .groups(19)
+      .iterations(1)
+      .TestF32();
+  }
+}
+
+TEST(CONVOLUTION_SpNHWC_OP_F32, batched_depthwise_5x5_with_padding) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  ConvolutionSpNCHWOperatorTester()
+    .batch_size(2)
+    .input_size(27, 29)
+    .kernel_size(5, 5)
+    .padding_height(2)
+    .padding_width(2)
+    .groups(19)
+    .iterations(3)
+    .TestF32();
+}
+
+/**************************** DWCONV 5x5 stride-2 path ****************************/
+
+TEST(CONVOLUTION_SpNHWC_OP_F32, depthwise_5x5s2) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  ConvolutionSpNCHWOperatorTester()
+    .input_size(27, 29)
+    .kernel_size(5, 5)
+    .padding_width(2)
+    .subsampling(2)
+    .groups(19)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_SpNHWC_OP_F32, depthwise_5x5s2_varying_input_height) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  for (size_t input_height = 5; input_height <= 13; input_height++) {
+    ConvolutionSpNCHWOperatorTester()
+      .input_size(input_height, 29)
+      .kernel_size(5, 5)
+      .padding_width(2)
+      .subsampling(2)
+      .groups(19)
+      .iterations(1)
+      .TestF32();
+  }
+}
+
+TEST(CONVOLUTION_SpNHWC_OP_F32, batched_depthwise_5x5s2) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  ConvolutionSpNCHWOperatorTester()
+    .batch_size(2)
+    .input_size(27, 29)
+    .kernel_size(5, 5)
+    .padding_width(2)
+    .subsampling(2)
+    .groups(19)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_SpNHWC_OP_F32, depthwise_5x5s2_with_padding) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  ConvolutionSpNCHWOperatorTester()
+    .input_size(27, 29)
+    .kernel_size(5, 5)
+    .padding_height(2)
+    .padding_width(2)
+    .subsampling(2)
+    .groups(19)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_SpNHWC_OP_F32, depthwise_5x5s2_with_padding_varying_input_height) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  for (size_t input_height = 1; input_height <= 9; input_height++) {
+    ConvolutionSpNCHWOperatorTester()
+      .input_size(input_height, 29)
+      .kernel_size(5, 5)
+      .padding_height(2)
+      .padding_width(2)
+      .subsampling(2)
+      .groups(19)
+      .iterations(1)
+      .TestF32();
+  }
+}
+
+TEST(CONVOLUTION_SpNHWC_OP_F32, batched_depthwise_5x5s2_with_padding) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  ConvolutionSpNCHWOperatorTester()
+    .batch_size(2)
+    .input_size(27, 29)
+    .kernel_size(5, 5)
+    .padding_height(2)
+    .padding_width(2)
+    .subsampling(2)
+    .groups(19)
+    .iterations(3)
+    .TestF32();
+}
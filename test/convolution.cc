@@ -8,6 +8,9 @@
 
 #include <gtest/gtest.h>
 
+#include <limits>
+#include <vector>
+
 #include "convolution-operator-tester.h"
 
 
@@ -551,6 +554,68 @@ TEST(CONVOLUTION_OP_Q8, depthwise_3x3d2x1) {
     .TestQ8();
 }
 
+TEST(CONVOLUTION_OP_Q8, depthwise_1x7) {
+  ConvolutionOperatorTester()
+    .input_size(15, 14)
+    .padding(0, 3)
+    .kernel_size(1, 7)
+    .groups(27)
+    .iterations(3)
+    .TestQ8();
+}
+
+TEST(CONVOLUTION_OP_Q8, depthwise_3x5) {
+  ConvolutionOperatorTester()
+    .input_size(15, 14)
+    .padding(1, 2)
+    .kernel_size(3, 5)
+    .groups(27)
+    .iterations(3)
+    .TestQ8();
+}
+
+TEST(CONVOLUTION_OP_Q8, depthwise_5x3) {
+  ConvolutionOperatorTester()
+    .input_size(15, 14)
+    .padding(2, 1)
+    .kernel_size(5, 3)
+    .groups(27)
+    .iterations(3)
+    .TestQ8();
+}
+
+TEST(CONVOLUTION_OP_Q8, depthwise_7x7) {
+  ConvolutionOperatorTester()
+    .input_size(15, 14)
+    .padding(3, 3)
+    .kernel_size(7, 7)
+    .groups(27)
+    .iterations(3)
+    .TestQ8();
+}
+
+TEST(CONVOLUTION_OP_Q8, depthwise_7x7s2) {
+  ConvolutionOperatorTester()
+    .input_size(15, 14)
+    .padding(3, 3)
+    .kernel_size(7, 7)
+    .subsampling(2)
+    .groups(27)
+    .iterations(3)
+    .TestQ8();
+}
+
+TEST(CONVOLUTION_OP_Q8, depthwise_7x7d2) {
+  ConvolutionOperatorTester()
+    .input_size(15, 14)
+    .padding(3, 3)
+    .kernel_size(7, 7)
+    .dilation(2)
+    .groups(27)
+    .iterations(3)
+    .TestQ8();
+}
+
 TEST(DEPTHWISE_CONVOLUTION_OP_Q8, 1x1) {
   ConvolutionOperatorTester()
     .depthwise_layout(true)
@@ -606,6 +671,17 @@ TEST(DEPTHWISE_CONVOLUTION_OP_Q8, 5x5) {
     .TestQ8();
 }
 
+TEST(DEPTHWISE_CONVOLUTION_OP_Q8, 7x7) {
+  ConvolutionOperatorTester()
+    .depthwise_layout(true)
+    .input_size(15, 14)
+    .padding(3, 3)
+    .kernel_size(7, 7)
+    .groups(24)
+    .iterations(3)
+    .TestQ8();
+}
+
 TEST(CONVOLUTION_OP_Q8, setup_increasing_batch) {
   ASSERT_EQ(xnn_status_success, xnn_initialize());
   ConvolutionOperatorTester()
@@ -893,61 +969,245 @@ TEST(CONVOLUTION_OP_Q8, setup_swap_height_and_width_depthwise) {
     .TestSetupQ8();
 }
 
-TEST(CONVOLUTION_OP_F32, 1x1) {
+TEST(CONVOLUTION_OP_Q8, setup_double_buffering) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
   ConvolutionOperatorTester()
-    .input_size(27, 29)
-    .kernel_size(1, 1)
-    .group_input_channels(23)
-    .group_output_channels(19)
+    .batch_size(3)
+    .input_height(8)
+    .input_width(8)
+    .kernel_height(3)
+    .kernel_width(3)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .double_buffering(true)
+    .TestSetupQ8();
+}
+
+TEST(CONVOLUTION_OP_Q8, setup_double_buffering_depthwise) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  ConvolutionOperatorTester()
+    .batch_size(3)
+    .input_height(8)
+    .input_width(8)
+    .kernel_height(3)
+    .kernel_width(3)
+    .groups(19)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .double_buffering(true)
+    .TestSetupQ8();
+}
+
+TEST(CONVOLUTION_OP_Q8, setup_double_buffering_decreasing_batch_depthwise) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  ConvolutionOperatorTester()
+    .batch_size(5)
+    .next_batch_size(3)
+    .input_height(8)
+    .input_width(8)
+    .kernel_height(3)
+    .kernel_width(3)
+    .groups(19)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .double_buffering(true)
+    .TestSetupQ8();
+}
+
+TEST(CONVOLUTION_OP_Q8, setup_double_buffering_increasing_batch_depthwise) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  ConvolutionOperatorTester()
+    .batch_size(3)
+    .next_batch_size(5)
+    .input_height(8)
+    .input_width(8)
+    .kernel_height(3)
+    .kernel_width(3)
+    .groups(19)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .double_buffering(true)
+    .TestSetupQ8();
+}
+
+TEST(CONVOLUTION_OP_Q8, setup_double_buffering_wide_depthwise) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  ConvolutionOperatorTester()
+    .batch_size(2)
+    .input_height(4)
+    .input_width(700)
+    .padding(1)
+    .kernel_height(3)
+    .kernel_width(3)
+    .groups(5)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .double_buffering(true)
+    .TestSetupQ8();
+}
+
+TEST(CONVOLUTION_OP_Q8, compact_indirection_3x3) {
+  ConvolutionOperatorTester()
+    .input_size(13, 12)
+    .padding(1)
+    .kernel_size(3, 3)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .compact_indirection(true)
     .iterations(3)
-    .TestF32();
+    .TestQ8();
 }
 
-TEST(CONVOLUTION_OP_F32, 1x1_with_qmin) {
+TEST(CONVOLUTION_OP_Q8, compact_indirection_grouped_3x3) {
   ConvolutionOperatorTester()
-    .input_size(27, 29)
-    .kernel_size(1, 1)
-    .group_input_channels(23)
-    .group_output_channels(19)
-    .qmin(128)
+    .input_size(10, 11)
+    .padding(1)
+    .kernel_size(3, 3)
+    .groups(2)
+    .group_input_channels(14)
+    .group_output_channels(13)
+    .compact_indirection(true)
     .iterations(3)
-    .TestF32();
+    .TestQ8();
 }
 
-TEST(CONVOLUTION_OP_F32, 1x1_with_qmax) {
+TEST(CONVOLUTION_OP_Q8, compact_indirection_3x3s2_with_dilation) {
+  ConvolutionOperatorTester()
+    .input_size(14, 15)
+    .padding(2)
+    .kernel_size(3, 3)
+    .subsampling(2)
+    .dilation(2)
+    .input_pixel_stride(19)
+    .output_pixel_stride(21)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .compact_indirection(true)
+    .iterations(3)
+    .TestQ8();
+}
+
+TEST(CONVOLUTION_OP_Q8, compact_indirection_depthwise_3x3) {
+  ConvolutionOperatorTester()
+    .input_size(15, 14)
+    .padding(1, 1)
+    .kernel_size(3, 3)
+    .groups(27)
+    .compact_indirection(true)
+    .iterations(3)
+    .TestQ8();
+}
+
+TEST(CONVOLUTION_OP_Q8, compact_indirection_depthwise_5x5s2) {
+  ConvolutionOperatorTester()
+    .input_size(15, 14)
+    .padding(2, 2)
+    .kernel_size(5, 5)
+    .subsampling(2)
+    .groups(27)
+    .compact_indirection(true)
+    .iterations(3)
+    .TestQ8();
+}
+
+TEST(CONVOLUTION_OP_Q8, setup_compact_indirection) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  ConvolutionOperatorTester()
+    .batch_size(3)
+    .next_batch_size(5)
+    .input_height(8)
+    .input_width(8)
+    .kernel_height(3)
+    .kernel_width(3)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .compact_indirection(true)
+    .double_buffering(true)
+    .TestSetupQ8();
+}
+
+TEST(CONVOLUTION_OP_Q8, setup_compact_indirection_changing_height_depthwise) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  ConvolutionOperatorTester()
+    .batch_size(3)
+    .input_height(8)
+    .input_width(8)
+    .next_input_height(9)
+    .kernel_height(3)
+    .kernel_width(3)
+    .groups(19)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .compact_indirection(true)
+    .TestSetupQ8();
+}
+
+TEST(CONVOLUTION_OP_Q8, setup_compact_indirection_depthwise) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  ConvolutionOperatorTester()
+    .batch_size(3)
+    .next_batch_size(5)
+    .input_height(8)
+    .input_width(8)
+    .kernel_height(3)
+    .kernel_width(3)
+    .groups(19)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .compact_indirection(true)
+    .double_buffering(true)
+    .TestSetupQ8();
+}
+
+TEST(CONVOLUTION_OP_Q8, setup_compact_indirection_wide_depthwise) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  ConvolutionOperatorTester()
+    .batch_size(2)
+    .input_height(4)
+    .input_width(700)
+    .padding(1)
+    .kernel_height(3)
+    .kernel_width(3)
+    .groups(5)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .compact_indirection(true)
+    .TestSetupQ8();
+}
+
+TEST(CONVOLUTION_OP_Q8C, 1x1) {
   ConvolutionOperatorTester()
     .input_size(27, 29)
     .kernel_size(1, 1)
     .group_input_channels(23)
     .group_output_channels(19)
-    .qmax(128)
     .iterations(3)
-    .TestF32();
+    .TestQ8C();
 }
 
-TEST(CONVOLUTION_OP_F32, 1x1_with_input_stride) {
+TEST(CONVOLUTION_OP_Q8C, 1x1_with_qmin) {
   ConvolutionOperatorTester()
     .input_size(27, 29)
     .kernel_size(1, 1)
-    .input_pixel_stride(28)
     .group_input_channels(23)
     .group_output_channels(19)
+    .qmin(128)
     .iterations(3)
-    .TestF32();
+    .TestQ8C();
 }
 
-TEST(CONVOLUTION_OP_F32, 1x1_with_output_stride) {
+TEST(CONVOLUTION_OP_Q8C, 1x1_with_qmax) {
   ConvolutionOperatorTester()
     .input_size(27, 29)
     .kernel_size(1, 1)
-    .output_pixel_stride(29)
     .group_input_channels(23)
     .group_output_channels(19)
+    .qmax(128)
     .iterations(3)
-    .TestF32();
+    .TestQ8C();
 }
 
-TEST(CONVOLUTION_OP_F32, 1x1_with_batch) {
+TEST(CONVOLUTION_OP_Q8C, 1x1_with_batch) {
   ConvolutionOperatorTester()
     .batch_size(3)
     .input_size(13, 14)
@@ -955,10 +1215,10 @@ TEST(CONVOLUTION_OP_F32, 1x1_with_batch) {
     .group_input_channels(23)
     .group_output_channels(19)
     .iterations(3)
-    .TestF32();
+    .TestQ8C();
 }
 
-TEST(CONVOLUTION_OP_F32, grouped_1x1) {
+TEST(CONVOLUTION_OP_Q8C, grouped_1x1) {
   ConvolutionOperatorTester()
     .input_size(24, 25)
     .kernel_size(1, 1)
@@ -966,229 +1226,220 @@ TEST(CONVOLUTION_OP_F32, grouped_1x1) {
     .group_input_channels(17)
     .group_output_channels(19)
     .iterations(3)
-    .TestF32();
+    .TestQ8C();
 }
 
-TEST(CONVOLUTION_OP_F32, grouped_1x1_with_qmin) {
+TEST(CONVOLUTION_OP_Q8C, 3x3) {
   ConvolutionOperatorTester()
-    .input_size(24, 25)
-    .kernel_size(1, 1)
-    .groups(2)
-    .group_input_channels(17)
-    .group_output_channels(19)
-    .qmin(128)
+    .input_size(13, 12)
+    .padding(1)
+    .kernel_size(3, 3)
+    .group_input_channels(15)
+    .group_output_channels(17)
     .iterations(3)
-    .TestF32();
+    .TestQ8C();
 }
 
-TEST(CONVOLUTION_OP_F32, grouped_1x1_with_qmax) {
+TEST(CONVOLUTION_OP_Q8C, 3x3_with_output_stride) {
   ConvolutionOperatorTester()
-    .input_size(24, 25)
-    .kernel_size(1, 1)
-    .groups(2)
-    .group_input_channels(17)
-    .group_output_channels(19)
-    .qmax(128)
+    .input_size(10, 9)
+    .padding(1)
+    .kernel_size(3, 3)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .output_pixel_stride(29)
     .iterations(3)
-    .TestF32();
+    .TestQ8C();
 }
 
-TEST(CONVOLUTION_OP_F32, grouped_1x1_with_input_stride) {
+TEST(CONVOLUTION_OP_Q8C, grouped_3x3) {
   ConvolutionOperatorTester()
-    .input_size(24, 25)
-    .kernel_size(1, 1)
+    .input_size(10, 11)
+    .padding(1)
+    .kernel_size(3, 3)
     .groups(2)
-    .input_pixel_stride(37)
-    .group_input_channels(17)
-    .group_output_channels(19)
+    .group_input_channels(14)
+    .group_output_channels(13)
     .iterations(3)
-    .TestF32();
+    .TestQ8C();
 }
 
-TEST(CONVOLUTION_OP_F32, grouped_1x1_with_output_stride) {
+TEST(CONVOLUTION_OP_Q8C, 3x3s2) {
   ConvolutionOperatorTester()
-    .input_size(24, 25)
-    .kernel_size(1, 1)
-    .groups(2)
-    .output_pixel_stride(41)
-    .group_input_channels(17)
-    .group_output_channels(19)
+    .input_size(14, 13)
+    .padding(1)
+    .kernel_size(3, 3)
+    .subsampling(2)
+    .group_input_channels(15)
+    .group_output_channels(17)
     .iterations(3)
-    .TestF32();
+    .TestQ8C();
 }
 
-TEST(CONVOLUTION_OP_F32, grouped_1x1_with_batch) {
+TEST(CONVOLUTION_OP_Q8C, depthwise_3x3) {
   ConvolutionOperatorTester()
-    .batch_size(3)
-    .input_size(24, 25)
-    .kernel_size(1, 1)
-    .groups(2)
-    .group_input_channels(17)
-    .group_output_channels(19)
+    .input_size(15, 14)
+    .padding(1, 1)
+    .kernel_size(3, 3)
+    .groups(27)
     .iterations(3)
-    .TestF32();
+    .TestQ8C();
 }
 
-TEST(CONVOLUTION_OP_F32, unioutput_1x1) {
+TEST(CONVOLUTION_OP_Q8C, depthwise_3x3s2) {
   ConvolutionOperatorTester()
-    .input_size(1, 1)
-    .kernel_size(1, 1)
-    .group_input_channels(23)
-    .group_output_channels(19)
+    .input_size(15, 14)
+    .padding(1, 1)
+    .kernel_size(3, 3)
+    .subsampling(2)
+    .groups(27)
     .iterations(3)
-    .TestF32();
+    .TestQ8C();
 }
 
-TEST(CONVOLUTION_OP_F32, unioutput_1x1_with_qmin) {
+TEST(CONVOLUTION_OP_Q8C, depthwise_3x3_with_qmin) {
   ConvolutionOperatorTester()
-    .input_size(1, 1)
-    .kernel_size(1, 1)
-    .group_input_channels(23)
-    .group_output_channels(19)
+    .input_size(15, 14)
+    .padding(1, 1)
+    .kernel_size(3, 3)
+    .groups(27)
     .qmin(128)
     .iterations(3)
-    .TestF32();
+    .TestQ8C();
 }
 
-TEST(CONVOLUTION_OP_F32, unioutput_1x1_with_qmax) {
+TEST(CONVOLUTION_OP_Q8C, depthwise_3x3_with_qmax) {
   ConvolutionOperatorTester()
-    .input_size(1, 1)
-    .kernel_size(1, 1)
-    .group_input_channels(23)
-    .group_output_channels(19)
+    .input_size(15, 14)
+    .padding(1, 1)
+    .kernel_size(3, 3)
+    .groups(27)
     .qmax(128)
     .iterations(3)
-    .TestF32();
+    .TestQ8C();
 }
 
-TEST(CONVOLUTION_OP_F32, unioutput_1x1_with_input_stride) {
+TEST(CONVOLUTION_OP_Q8C, depthwise_5x5) {
   ConvolutionOperatorTester()
-    .input_size(1, 1)
-    .kernel_size(1, 1)
-    .input_pixel_stride(28)
-    .group_input_channels(23)
-    .group_output_channels(19)
+    .input_size(15, 14)
+    .padding(2, 2)
+    .kernel_size(5, 5)
+    .groups(27)
     .iterations(3)
-    .TestF32();
+    .TestQ8C();
 }
 
-TEST(CONVOLUTION_OP_F32, unioutput_1x1_with_output_stride) {
+TEST(DEPTHWISE_CONVOLUTION_OP_Q8C, 3x3) {
   ConvolutionOperatorTester()
-    .input_size(1, 1)
-    .kernel_size(1, 1)
-    .output_pixel_stride(29)
-    .group_input_channels(23)
-    .group_output_channels(19)
+    .depthwise_layout(true)
+    .input_size(15, 14)
+    .padding(1, 1)
+    .kernel_size(3, 3)
+    .groups(24)
     .iterations(3)
-    .TestF32();
+    .TestQ8C();
 }
 
-TEST(CONVOLUTION_OP_F32, unioutput_grouped_1x1) {
+TEST(DEPTHWISE_CONVOLUTION_OP_Q8C, 3x3_with_depth_multiplier) {
   ConvolutionOperatorTester()
-    .input_size(1, 1)
-    .kernel_size(1, 1)
-    .groups(2)
-    .group_input_channels(17)
-    .group_output_channels(13)
+    .depthwise_layout(true)
+    .input_size(15, 14)
+    .padding(1, 1)
+    .kernel_size(3, 3)
+    .groups(24)
+    .group_output_channels(3)
     .iterations(3)
-    .TestF32();
+    .TestQ8C();
 }
 
-TEST(CONVOLUTION_OP_F32, unioutput_grouped_1x1_with_qmin) {
+TEST(DEPTHWISE_CONVOLUTION_OP_Q8C, 5x5) {
   ConvolutionOperatorTester()
-    .input_size(1, 1)
-    .kernel_size(1, 1)
-    .groups(2)
-    .group_input_channels(17)
-    .group_output_channels(13)
-    .qmin(128)
+    .depthwise_layout(true)
+    .input_size(15, 14)
+    .padding(2, 2)
+    .kernel_size(5, 5)
+    .groups(24)
     .iterations(3)
-    .TestF32();
+    .TestQ8C();
 }
 
-TEST(CONVOLUTION_OP_F32, unioutput_grouped_1x1_with_qmax) {
+TEST(CONVOLUTION_OP_F16, 1x1) {
   ConvolutionOperatorTester()
-    .input_size(1, 1)
+    .input_size(27, 29)
     .kernel_size(1, 1)
-    .groups(2)
-    .group_input_channels(17)
-    .group_output_channels(13)
-    .qmax(128)
+    .group_input_channels(23)
+    .group_output_channels(19)
     .iterations(3)
-    .TestF32();
+    .TestF16();
 }
 
-TEST(CONVOLUTION_OP_F32, unioutput_grouped_1x1_with_input_stride) {
+TEST(CONVOLUTION_OP_F16, 1x1_with_qmin) {
   ConvolutionOperatorTester()
-    .input_size(1, 1)
+    .input_size(27, 29)
     .kernel_size(1, 1)
-    .groups(2)
-    .input_pixel_stride(37)
-    .group_input_channels(17)
-    .group_output_channels(13)
+    .group_input_channels(23)
+    .group_output_channels(19)
+    .qmin(128)
     .iterations(3)
-    .TestF32();
+    .TestF16();
 }
 
-TEST(CONVOLUTION_OP_F32, unioutput_grouped_1x1_with_output_stride) {
+TEST(CONVOLUTION_OP_F16, 1x1_with_qmax) {
   ConvolutionOperatorTester()
-    .input_size(1, 1)
+    .input_size(27, 29)
     .kernel_size(1, 1)
-    .groups(2)
-    .output_pixel_stride(41)
-    .group_input_channels(17)
-    .group_output_channels(13)
+    .group_input_channels(23)
+    .group_output_channels(19)
+    .qmax(128)
     .iterations(3)
-    .TestF32();
+    .TestF16();
 }
 
-TEST(CONVOLUTION_OP_F32, 1x3) {
+TEST(CONVOLUTION_OP_F16, 1x1_with_input_stride) {
   ConvolutionOperatorTester()
-    .input_size(20, 19)
-    .padding_width(1)
-    .kernel_size(1, 3)
-    .group_input_channels(17)
-    .group_output_channels(15)
+    .input_size(27, 29)
+    .kernel_size(1, 1)
+    .input_pixel_stride(28)
+    .group_input_channels(23)
+    .group_output_channels(19)
     .iterations(3)
-    .TestF32();
+    .TestF16();
 }
 
-TEST(CONVOLUTION_OP_F32, grouped_1x3) {
+TEST(CONVOLUTION_OP_F16, 1x1_with_output_stride) {
   ConvolutionOperatorTester()
-    .input_size(20, 19)
-    .padding_width(1)
-    .kernel_size(1, 3)
-    .groups(2)
-    .group_input_channels(17)
-    .group_output_channels(15)
+    .input_size(27, 29)
+    .kernel_size(1, 1)
+    .output_pixel_stride(29)
+    .group_input_channels(23)
+    .group_output_channels(19)
     .iterations(3)
-    .TestF32();
+    .TestF16();
 }
 
-TEST(CONVOLUTION_OP_F32, 3x1) {
+TEST(CONVOLUTION_OP_F16, 1x1_with_batch) {
   ConvolutionOperatorTester()
-    .input_size(19, 20)
-    .padding_height(1)
-    .kernel_size(3, 1)
-    .group_input_channels(17)
-    .group_output_channels(15)
+    .batch_size(3)
+    .input_size(13, 14)
+    .kernel_size(1, 1)
+    .group_input_channels(23)
+    .group_output_channels(19)
     .iterations(3)
-    .TestF32();
+    .TestF16();
 }
 
-TEST(CONVOLUTION_OP_F32, grouped_3x1) {
+TEST(CONVOLUTION_OP_F16, grouped_1x1) {
   ConvolutionOperatorTester()
-    .input_size(19, 20)
-    .padding_height(1)
-    .kernel_size(3, 1)
+    .input_size(24, 25)
+    .kernel_size(1, 1)
     .groups(2)
     .group_input_channels(17)
-    .group_output_channels(15)
+    .group_output_channels(19)
     .iterations(3)
-    .TestF32();
+    .TestF16();
 }
 
-TEST(CONVOLUTION_OP_F32, 3x3) {
+TEST(CONVOLUTION_OP_F16, 3x3) {
   ConvolutionOperatorTester()
     .input_size(13, 12)
     .padding(1)
@@ -1196,618 +1447,1324 @@ TEST(CONVOLUTION_OP_F32, 3x3) {
     .group_input_channels(15)
     .group_output_channels(17)
     .iterations(3)
-    .TestF32();
+    .TestF16();
 }
 
-TEST(CONVOLUTION_OP_F32, 3x3_without_padding) {
+TEST(CONVOLUTION_OP_F16, 3x3_without_padding) {
   ConvolutionOperatorTester()
     .input_size(13, 12)
     .kernel_size(3, 3)
     .group_input_channels(15)
     .group_output_channels(17)
     .iterations(3)
-    .TestF32();
+    .TestF16();
 }
 
-TEST(CONVOLUTION_OP_F32, 3x3_with_left_padding) {
+TEST(CONVOLUTION_OP_F16, 3x3_with_input_stride) {
   ConvolutionOperatorTester()
     .input_size(13, 12)
-    .padding_left(1)
+    .padding(1)
     .kernel_size(3, 3)
+    .input_pixel_stride(22)
     .group_input_channels(15)
     .group_output_channels(17)
     .iterations(3)
-    .TestF32();
+    .TestF16();
 }
 
-TEST(CONVOLUTION_OP_F32, 3x3_with_right_padding) {
+TEST(CONVOLUTION_OP_F16, 3x3_with_output_stride) {
   ConvolutionOperatorTester()
     .input_size(13, 12)
-    .padding_right(1)
+    .padding(1)
     .kernel_size(3, 3)
+    .output_pixel_stride(23)
     .group_input_channels(15)
     .group_output_channels(17)
     .iterations(3)
-    .TestF32();
+    .TestF16();
 }
 
-TEST(CONVOLUTION_OP_F32, 3x3_with_top_padding) {
+TEST(CONVOLUTION_OP_F16, 3x3_with_batch) {
   ConvolutionOperatorTester()
-    .input_size(13, 12)
-    .padding_top(1)
+    .batch_size(3)
+    .input_size(10, 9)
+    .padding(1)
     .kernel_size(3, 3)
     .group_input_channels(15)
     .group_output_channels(17)
     .iterations(3)
-    .TestF32();
+    .TestF16();
 }
 
-TEST(CONVOLUTION_OP_F32, 3x3_with_bottom_padding) {
+TEST(CONVOLUTION_OP_F16, grouped_3x3) {
   ConvolutionOperatorTester()
-    .input_size(13, 12)
-    .padding_bottom(1)
+    .input_size(10, 11)
+    .padding(1)
     .kernel_size(3, 3)
-    .group_input_channels(15)
-    .group_output_channels(17)
+    .groups(2)
+    .group_input_channels(14)
+    .group_output_channels(13)
     .iterations(3)
-    .TestF32();
+    .TestF16();
 }
 
-TEST(CONVOLUTION_OP_F32, 3x3_with_input_stride) {
+TEST(CONVOLUTION_OP_F16, 3x3s2) {
   ConvolutionOperatorTester()
-    .input_size(13, 12)
+    .input_size(19, 21)
     .padding(1)
     .kernel_size(3, 3)
-    .input_pixel_stride(22)
-    .group_input_channels(15)
-    .group_output_channels(17)
+    .subsampling(2)
+    .group_input_channels(27)
+    .group_output_channels(19)
     .iterations(3)
-    .TestF32();
+    .TestF16();
 }
 
-TEST(CONVOLUTION_OP_F32, 3x3_with_output_stride) {
+TEST(CONVOLUTION_OP_F16, 3x3d2) {
   ConvolutionOperatorTester()
-    .input_size(13, 12)
-    .padding(1)
+    .input_size(13, 14)
+    .padding(2)
     .kernel_size(3, 3)
-    .output_pixel_stride(23)
-    .group_input_channels(15)
-    .group_output_channels(17)
+    .dilation(2)
+    .group_input_channels(27)
+    .group_output_channels(19)
     .iterations(3)
-    .TestF32();
+    .TestF16();
 }
 
-TEST(CONVOLUTION_OP_F32, 3x3_with_batch) {
+TEST(CONVOLUTION_OP_F16, depthwise_3x3) {
   ConvolutionOperatorTester()
-    .batch_size(3)
-    .input_size(10, 9)
-    .padding(1)
+    .input_size(15, 14)
+    .padding(1, 1)
     .kernel_size(3, 3)
-    .group_input_channels(15)
-    .group_output_channels(17)
+    .groups(24)
     .iterations(3)
-    .TestF32();
+    .TestF16();
 }
 
-TEST(CONVOLUTION_OP_F32, grouped_3x3) {
+TEST(CONVOLUTION_OP_F16, depthwise_3x3s2) {
   ConvolutionOperatorTester()
-    .input_size(10, 11)
-    .padding(1)
+    .input_size(15, 14)
+    .padding(1, 1)
     .kernel_size(3, 3)
-    .groups(2)
-    .group_input_channels(14)
-    .group_output_channels(13)
+    .subsampling(2)
+    .groups(27)
     .iterations(3)
-    .TestF32();
+    .TestF16();
 }
 
-TEST(CONVOLUTION_OP_F32, grouped_3x3_without_padding) {
+TEST(CONVOLUTION_OP_F16, depthwise_5x5) {
   ConvolutionOperatorTester()
-    .input_size(13, 12)
-    .kernel_size(3, 3)
-    .group_input_channels(15)
-    .group_output_channels(17)
+    .input_size(15, 14)
+    .padding(2, 2)
+    .kernel_size(5, 5)
+    .groups(27)
     .iterations(3)
-    .TestF32();
+    .TestF16();
 }
 
-TEST(CONVOLUTION_OP_F32, grouped_3x3_with_left_padding) {
+TEST(DEPTHWISE_CONVOLUTION_OP_F16, 1x1) {
   ConvolutionOperatorTester()
-    .input_size(10, 11)
-    .padding_left(1)
-    .kernel_size(3, 3)
-    .groups(2)
-    .group_input_channels(14)
-    .group_output_channels(13)
+    .depthwise_layout(true)
+    .input_size(15, 14)
+    .kernel_size(1, 1)
+    .groups(24)
     .iterations(3)
-    .TestF32();
+    .TestF16();
 }
 
-TEST(CONVOLUTION_OP_F32, grouped_3x3_with_right_padding) {
+TEST(DEPTHWISE_CONVOLUTION_OP_F16, 2x2) {
   ConvolutionOperatorTester()
-    .input_size(10, 11)
-    .padding_right(1)
-    .kernel_size(3, 3)
-    .groups(2)
-    .group_input_channels(14)
-    .group_output_channels(13)
+    .depthwise_layout(true)
+    .input_size(15, 14)
+    .padding(1, 1)
+    .kernel_size(2, 2)
+    .groups(24)
     .iterations(3)
-    .TestF32();
+    .TestF16();
 }
 
-TEST(CONVOLUTION_OP_F32, grouped_3x3_with_top_padding) {
+TEST(DEPTHWISE_CONVOLUTION_OP_F16, 3x3) {
   ConvolutionOperatorTester()
-    .input_size(10, 11)
-    .padding_top(1)
+    .depthwise_layout(true)
+    .input_size(15, 14)
+    .padding(1, 1)
     .kernel_size(3, 3)
-    .groups(2)
-    .group_input_channels(14)
-    .group_output_channels(13)
+    .groups(24)
     .iterations(3)
-    .TestF32();
+    .TestF16();
 }
 
-TEST(CONVOLUTION_OP_F32, grouped_3x3_with_bottom_padding) {
+TEST(DEPTHWISE_CONVOLUTION_OP_F16, 3x3_with_depth_multiplier) {
   ConvolutionOperatorTester()
-    .input_size(10, 11)
-    .padding_bottom(1)
+    .depthwise_layout(true)
+    .input_size(15, 14)
+    .padding(1, 1)
     .kernel_size(3, 3)
-    .groups(2)
-    .group_input_channels(14)
-    .group_output_channels(13)
+    .groups(24)
+    .group_output_channels(3)
     .iterations(3)
-    .TestF32();
+    .TestF16();
 }
 
-TEST(CONVOLUTION_OP_F32, grouped_3x3_with_input_stride) {
+TEST(DEPTHWISE_CONVOLUTION_OP_F16, 5x5) {
   ConvolutionOperatorTester()
-    .input_size(10, 11)
-    .padding(1)
-    .kernel_size(3, 3)
-    .groups(2)
-    .input_pixel_stride(29)
-    .group_input_channels(14)
-    .group_output_channels(13)
+    .depthwise_layout(true)
+    .input_size(15, 14)
+    .padding(2, 2)
+    .kernel_size(5, 5)
+    .groups(24)
     .iterations(3)
-    .TestF32();
+    .TestF16();
 }
 
-TEST(CONVOLUTION_OP_F32, grouped_3x3_with_output_stride) {
+TEST(CONVOLUTION_OP_F32, 1x1) {
   ConvolutionOperatorTester()
-    .input_size(10, 11)
-    .padding(1)
-    .kernel_size(3, 3)
-    .groups(2)
-    .output_pixel_stride(31)
-    .group_input_channels(14)
-    .group_output_channels(13)
+    .input_size(27, 29)
+    .kernel_size(1, 1)
+    .group_input_channels(23)
+    .group_output_channels(19)
     .iterations(3)
     .TestF32();
 }
 
-TEST(CONVOLUTION_OP_F32, grouped_3x3_with_batch) {
+TEST(CONVOLUTION_OP_F32, 1x1_with_qmin) {
   ConvolutionOperatorTester()
-    .batch_size(3)
-    .input_size(10, 11)
-    .padding(1)
-    .kernel_size(3, 3)
-    .groups(2)
-    .group_input_channels(14)
-    .group_output_channels(13)
+    .input_size(27, 29)
+    .kernel_size(1, 1)
+    .group_input_channels(23)
+    .group_output_channels(19)
+    .qmin(128)
     .iterations(3)
     .TestF32();
 }
 
-TEST(CONVOLUTION_OP_F32, 3x3s2) {
+TEST(CONVOLUTION_OP_F32, 1x1_with_qmax) {
   ConvolutionOperatorTester()
-    .input_size(19, 21)
-    .padding(1)
-    .kernel_size(3, 3)
-    .subsampling(2)
-    .group_input_channels(27)
+    .input_size(27, 29)
+    .kernel_size(1, 1)
+    .group_input_channels(23)
     .group_output_channels(19)
+    .qmax(128)
     .iterations(3)
     .TestF32();
 }
 
-TEST(CONVOLUTION_OP_F32, 3x3s1x2) {
+TEST(CONVOLUTION_OP_F32, 1x1_with_input_stride) {
   ConvolutionOperatorTester()
-    .input_size(13, 13)
-    .padding(1)
-    .kernel_size(3, 3)
-    .subsampling(1, 2)
-    .group_input_channels(27)
+    .input_size(27, 29)
+    .kernel_size(1, 1)
+    .input_pixel_stride(28)
+    .group_input_channels(23)
     .group_output_channels(19)
     .iterations(3)
     .TestF32();
 }
 
-TEST(CONVOLUTION_OP_F32, 3x3s2x1) {
+TEST(CONVOLUTION_OP_F32, 1x1_with_output_stride) {
   ConvolutionOperatorTester()
-    .input_size(13, 13)
-    .padding(1)
-    .kernel_size(3, 3)
-    .subsampling(2, 1)
-    .group_input_channels(27)
+    .input_size(27, 29)
+    .kernel_size(1, 1)
+    .output_pixel_stride(29)
+    .group_input_channels(23)
     .group_output_channels(19)
     .iterations(3)
     .TestF32();
 }
 
-TEST(CONVOLUTION_OP_F32, 3x3d2) {
+TEST(CONVOLUTION_OP_F32, 1x1_with_batch) {
   ConvolutionOperatorTester()
+    .batch_size(3)
     .input_size(13, 14)
-    .padding(2)
-    .kernel_size(3, 3)
-    .dilation(2)
-    .group_input_channels(27)
+    .kernel_size(1, 1)
+    .group_input_channels(23)
     .group_output_channels(19)
     .iterations(3)
     .TestF32();
 }
 
-TEST(CONVOLUTION_OP_F32, 3x3d1x2) {
+TEST(CONVOLUTION_OP_F32, 1x1_with_large_weights) {
   ConvolutionOperatorTester()
-    .input_size(14, 15)
-    .padding(1, 2)
-    .kernel_size(3, 3)
-    .dilation(1, 2)
-    .group_input_channels(27)
-    .group_output_channels(19)
-    .iterations(3)
+    .input_size(5, 7)
+    .kernel_size(1, 1)
+    .group_input_channels(1031)
+    .group_output_channels(613)
     .TestF32();
 }
 
-TEST(CONVOLUTION_OP_F32, 3x3d2x1) {
+TEST(CONVOLUTION_OP_F32, 1x1_with_large_weights_and_qmin) {
   ConvolutionOperatorTester()
-    .input_size(15, 14)
-    .padding(2, 1)
-    .kernel_size(3, 3)
-    .dilation(2, 1)
-    .group_input_channels(27)
-    .group_output_channels(19)
-    .iterations(3)
+    .input_size(5, 7)
+    .kernel_size(1, 1)
+    .group_input_channels(1031)
+    .group_output_channels(613)
+    .qmin(128)
     .TestF32();
 }
 
-TEST(CONVOLUTION_OP_F32, unioutput_3x3) {
+TEST(CONVOLUTION_OP_F32, 1x1_with_fp16_weights) {
   ConvolutionOperatorTester()
-    .input_size(3, 3)
-    .padding(1)
-    .kernel_size(3, 3)
+    .batch_size(3)
+    .input_size(13, 14)
+    .kernel_size(1, 1)
     .group_input_channels(23)
     .group_output_channels(19)
+    .fp16_weights(true)
     .iterations(3)
     .TestF32();
 }
 
-TEST(CONVOLUTION_OP_F32, unioutput_3x3_with_qmin) {
+TEST(CONVOLUTION_OP_F32, 1x1_with_int8_weights) {
   ConvolutionOperatorTester()
-    .input_size(3, 3)
-    .padding(1)
-    .kernel_size(3, 3)
+    .batch_size(3)
+    .input_size(13, 14)
+    .kernel_size(1, 1)
     .group_input_channels(23)
     .group_output_channels(19)
-    .qmin(128)
+    .int8_weights(true)
     .iterations(3)
     .TestF32();
 }
 
-TEST(CONVOLUTION_OP_F32, unioutput_3x3_with_qmax) {
+TEST(CONVOLUTION_OP_F32, 1x1_with_large_weights_and_int8_weights) {
   ConvolutionOperatorTester()
-    .input_size(3, 3)
-    .padding(1)
-    .kernel_size(3, 3)
-    .group_input_channels(23)
-    .group_output_channels(19)
-    .qmax(128)
-    .iterations(3)
+    .input_size(5, 7)
+    .kernel_size(1, 1)
+    .group_input_channels(1031)
+    .group_output_channels(613)
+    .int8_weights(true)
     .TestF32();
 }
 
-TEST(CONVOLUTION_OP_F32, unioutput_3x3_with_input_stride) {
+TEST(CONVOLUTION_OP_F32, 1x1_with_fp16_weights_and_packed_weights) {
   ConvolutionOperatorTester()
-    .input_size(3, 3)
-    .padding(1)
-    .kernel_size(3, 3)
-    .input_pixel_stride(28)
+    .input_size(13, 14)
+    .kernel_size(1, 1)
     .group_input_channels(23)
     .group_output_channels(19)
+    .fp16_weights(true)
+    .load_packed_weights(true)
     .iterations(3)
     .TestF32();
 }
 
-TEST(CONVOLUTION_OP_F32, unioutput_3x3_with_output_stride) {
+TEST(CONVOLUTION_OP_F32, 1x1_with_int8_weights_and_packed_weights) {
   ConvolutionOperatorTester()
-    .input_size(3, 3)
-    .padding(1)
-    .kernel_size(3, 3)
-    .output_pixel_stride(29)
+    .input_size(13, 14)
+    .kernel_size(1, 1)
     .group_input_channels(23)
     .group_output_channels(19)
+    .int8_weights(true)
+    .load_packed_weights(true)
     .iterations(3)
     .TestF32();
 }
 
-TEST(CONVOLUTION_OP_F32, unioutput_grouped_3x3) {
+TEST(CONVOLUTION_OP_F32, 3x3_with_compressed_weights_unsupported) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  const std::vector<float> kernel(19 * 3 * 3 * 23);
+  const std::vector<float> bias(19);
+  const float inf = std::numeric_limits<float>::infinity();
+
+  xnn_operator_t convolution_op = nullptr;
+  EXPECT_EQ(xnn_status_unsupported_parameter,
+    xnn_create_convolution2d_nhwc_f32(
+      1, 1, 1, 1, 3, 3, 1, 1, 1, 1, 1, 23, 19, 23, 19,
+      kernel.data(), bias.data(), -inf, +inf, XNN_FLAG_FP16_WEIGHTS, &convolution_op));
+  EXPECT_EQ(xnn_status_unsupported_parameter,
+    xnn_create_convolution2d_nhwc_f32(
+      1, 1, 1, 1, 3, 3, 1, 1, 1, 1, 1, 23, 19, 23, 19,
+      kernel.data(), bias.data(), -inf, +inf, XNN_FLAG_INT8_WEIGHTS, &convolution_op));
+  EXPECT_EQ(xnn_status_invalid_parameter,
+    xnn_create_convolution2d_nhwc_f32(
+      0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 23, 19, 23, 19,
+      kernel.data(), bias.data(), -inf, +inf, XNN_FLAG_FP16_WEIGHTS | XNN_FLAG_INT8_WEIGHTS, &convolution_op));
+}
+
+TEST(CONVOLUTION_OP_F32, grouped_1x1_with_fp16_weights) {
   ConvolutionOperatorTester()
-    .input_size(3, 3)
-    .padding(1)
-    .kernel_size(3, 3)
+    .input_size(24, 25)
+    .kernel_size(1, 1)
     .groups(2)
     .group_input_channels(17)
-    .group_output_channels(13)
+    .group_output_channels(19)
+    .fp16_weights(true)
     .iterations(3)
     .TestF32();
 }
 
-TEST(CONVOLUTION_OP_F32, unioutput_grouped_3x3_with_qmin) {
+TEST(CONVOLUTION_OP_F32, grouped_1x1_with_int8_weights) {
   ConvolutionOperatorTester()
-    .input_size(3, 3)
-    .padding(1)
-    .kernel_size(3, 3)
+    .input_size(24, 25)
+    .kernel_size(1, 1)
     .groups(2)
     .group_input_channels(17)
-    .group_output_channels(13)
-    .qmin(128)
+    .group_output_channels(19)
+    .int8_weights(true)
     .iterations(3)
     .TestF32();
 }
 
-TEST(CONVOLUTION_OP_F32, unioutput_grouped_3x3_with_qmax) {
+TEST(CONVOLUTION_OP_F32, grouped_1x1) {
   ConvolutionOperatorTester()
-    .input_size(3, 3)
-    .padding(1)
-    .kernel_size(3, 3)
-    .groups(2)
+    .input_size(24, 25)
+    .kernel_size(1, 1)
+    .groups(2)
     .group_input_channels(17)
-    .group_output_channels(13)
-    .qmax(128)
+    .group_output_channels(19)
     .iterations(3)
     .TestF32();
 }
 
-TEST(CONVOLUTION_OP_F32, unioutput_grouped_3x3_with_input_stride) {
+TEST(CONVOLUTION_OP_F32, grouped_1x1_with_qmin) {
   ConvolutionOperatorTester()
-    .input_size(3, 3)
-    .padding(1)
-    .kernel_size(3, 3)
+    .input_size(24, 25)
+    .kernel_size(1, 1)
     .groups(2)
-    .input_pixel_stride(37)
     .group_input_channels(17)
-    .group_output_channels(13)
+    .group_output_channels(19)
+    .qmin(128)
     .iterations(3)
     .TestF32();
 }
 
-TEST(CONVOLUTION_OP_F32, unioutput_grouped_3x3_with_output_stride) {
+TEST(CONVOLUTION_OP_F32, grouped_1x1_with_qmax) {
   ConvolutionOperatorTester()
-    .input_size(3, 3)
-    .padding(1)
-    .kernel_size(3, 3)
+    .input_size(24, 25)
+    .kernel_size(1, 1)
     .groups(2)
-    .output_pixel_stride(41)
     .group_input_channels(17)
-    .group_output_channels(13)
+    .group_output_channels(19)
+    .qmax(128)
     .iterations(3)
     .TestF32();
 }
 
-TEST(CONVOLUTION_OP_F32, depthwise_1x1) {
+TEST(CONVOLUTION_OP_F32, grouped_1x1_with_input_stride) {
   ConvolutionOperatorTester()
-    .input_size(15, 14)
+    .input_size(24, 25)
     .kernel_size(1, 1)
-    .groups(24)
+    .groups(2)
+    .input_pixel_stride(37)
+    .group_input_channels(17)
+    .group_output_channels(19)
     .iterations(3)
     .TestF32();
 }
 
-TEST(CONVOLUTION_OP_F32, depthwise_2x2) {
+TEST(CONVOLUTION_OP_F32, grouped_1x1_with_output_stride) {
   ConvolutionOperatorTester()
-    .input_size(15, 14)
-    .padding(1, 1)
-    .kernel_size(2, 2)
-    .groups(24)
+    .input_size(24, 25)
+    .kernel_size(1, 1)
+    .groups(2)
+    .output_pixel_stride(41)
+    .group_input_channels(17)
+    .group_output_channels(19)
     .iterations(3)
     .TestF32();
 }
 
-TEST(CONVOLUTION_OP_F32, depthwise_2x2s2) {
+TEST(CONVOLUTION_OP_F32, grouped_1x1_with_batch) {
   ConvolutionOperatorTester()
-    .input_size(15, 14)
-    .padding(1, 1)
-    .kernel_size(2, 2)
-    .subsampling(2)
-    .groups(27)
+    .batch_size(3)
+    .input_size(24, 25)
+    .kernel_size(1, 1)
+    .groups(2)
+    .group_input_channels(17)
+    .group_output_channels(19)
     .iterations(3)
     .TestF32();
 }
 
-TEST(CONVOLUTION_OP_F32, depthwise_2x2s1x2) {
+TEST(CONVOLUTION_OP_F32, 1x1_with_sparse_weights) {
   ConvolutionOperatorTester()
-    .input_size(15, 14)
-    .padding(1, 1)
-    .kernel_size(2, 2)
-    .subsampling(1, 2)
-    .groups(27)
+    .input_size(27, 29)
+    .kernel_size(1, 1)
+    .group_input_channels(23)
+    .group_output_channels(19)
+    .sparsity(0.8f)
     .iterations(3)
     .TestF32();
 }
 
-TEST(CONVOLUTION_OP_F32, depthwise_2x2s2x1) {
+TEST(CONVOLUTION_OP_F32, 1x1_with_sparse_weights_and_qmin) {
   ConvolutionOperatorTester()
-    .input_size(15, 14)
-    .padding(1, 1)
-    .kernel_size(2, 2)
-    .subsampling(2, 1)
-    .groups(27)
+    .input_size(27, 29)
+    .kernel_size(1, 1)
+    .group_input_channels(23)
+    .group_output_channels(19)
+    .sparsity(0.8f)
+    .qmin(128)
     .iterations(3)
     .TestF32();
 }
 
-TEST(CONVOLUTION_OP_F32, depthwise_2x2d2) {
+TEST(CONVOLUTION_OP_F32, 1x1_with_sparse_weights_and_qmax) {
   ConvolutionOperatorTester()
-    .input_size(15, 14)
-    .padding(1, 1)
-    .kernel_size(2, 2)
-    .dilation(2)
-    .groups(27)
+    .input_size(27, 29)
+    .kernel_size(1, 1)
+    .group_input_channels(23)
+    .group_output_channels(19)
+    .sparsity(0.8f)
+    .qmax(128)
     .iterations(3)
     .TestF32();
 }
 
-TEST(CONVOLUTION_OP_F32, depthwise_2x2d1x2) {
+TEST(CONVOLUTION_OP_F32, 1x1_with_sparse_weights_and_input_stride) {
   ConvolutionOperatorTester()
-    .input_size(15, 14)
-    .padding(1, 1)
-    .kernel_size(2, 2)
-    .dilation(1, 2)
-    .groups(27)
+    .input_size(27, 29)
+    .kernel_size(1, 1)
+    .input_pixel_stride(28)
+    .group_input_channels(23)
+    .group_output_channels(19)
+    .sparsity(0.8f)
     .iterations(3)
     .TestF32();
 }
 
-TEST(CONVOLUTION_OP_F32, depthwise_2x2d2x1) {
+TEST(CONVOLUTION_OP_F32, 1x1_with_sparse_weights_and_output_stride) {
   ConvolutionOperatorTester()
-    .input_size(15, 14)
-    .padding(1, 1)
-    .kernel_size(2, 2)
-    .dilation(2, 1)
-    .groups(27)
+    .input_size(27, 29)
+    .kernel_size(1, 1)
+    .output_pixel_stride(29)
+    .group_input_channels(23)
+    .group_output_channels(19)
+    .sparsity(0.8f)
     .iterations(3)
     .TestF32();
 }
 
-TEST(CONVOLUTION_OP_F32, depthwise_3x3) {
+TEST(CONVOLUTION_OP_F32, 1x1_with_sparse_weights_and_batch) {
   ConvolutionOperatorTester()
-    .input_size(15, 14)
-    .padding(1, 1)
-    .kernel_size(3, 3)
-    .groups(24)
+    .batch_size(3)
+    .input_size(27, 29)
+    .kernel_size(1, 1)
+    .group_input_channels(23)
+    .group_output_channels(19)
+    .sparsity(0.8f)
     .iterations(3)
     .TestF32();
 }
 
-TEST(CONVOLUTION_OP_F32, depthwise_3x3s2) {
+TEST(CONVOLUTION_OP_F32, grouped_1x1_with_sparse_weights) {
   ConvolutionOperatorTester()
-    .input_size(15, 14)
-    .padding(1, 1)
-    .kernel_size(3, 3)
-    .subsampling(2)
-    .groups(27)
+    .input_size(24, 25)
+    .kernel_size(1, 1)
+    .groups(2)
+    .group_input_channels(17)
+    .group_output_channels(19)
+    .sparsity(0.8f)
     .iterations(3)
     .TestF32();
 }
 
-TEST(CONVOLUTION_OP_F32, depthwise_3x3s1x2) {
+TEST(CONVOLUTION_OP_F32, grouped_1x1_with_sparse_weights_and_strides) {
   ConvolutionOperatorTester()
-    .input_size(15, 14)
-    .padding(1, 1)
-    .kernel_size(3, 3)
-    .subsampling(1, 2)
-    .groups(27)
+    .input_size(24, 25)
+    .kernel_size(1, 1)
+    .groups(2)
+    .input_pixel_stride(37)
+    .output_pixel_stride(41)
+    .group_input_channels(17)
+    .group_output_channels(19)
+    .sparsity(0.8f)
     .iterations(3)
     .TestF32();
 }
 
-TEST(CONVOLUTION_OP_F32, depthwise_3x3s2x1) {
+TEST(CONVOLUTION_OP_F32, grouped_1x1_with_sparse_weights_and_batch) {
   ConvolutionOperatorTester()
-    .input_size(15, 14)
-    .padding(1, 1)
-    .kernel_size(3, 3)
-    .subsampling(2, 1)
-    .groups(27)
+    .batch_size(3)
+    .input_size(24, 25)
+    .kernel_size(1, 1)
+    .groups(2)
+    .group_input_channels(17)
+    .group_output_channels(19)
+    .sparsity(0.8f)
     .iterations(3)
     .TestF32();
 }
 
-TEST(CONVOLUTION_OP_F32, depthwise_3x3d2) {
+TEST(CONVOLUTION_OP_F32, unioutput_1x1) {
   ConvolutionOperatorTester()
-    .input_size(15, 14)
-    .padding(1, 1)
-    .kernel_size(3, 3)
-    .dilation(2)
-    .groups(27)
+    .input_size(1, 1)
+    .kernel_size(1, 1)
+    .group_input_channels(23)
+    .group_output_channels(19)
     .iterations(3)
     .TestF32();
 }
 
-TEST(CONVOLUTION_OP_F32, depthwise_3x3d1x2) {
+TEST(CONVOLUTION_OP_F32, unioutput_1x1_with_qmin) {
   ConvolutionOperatorTester()
-    .input_size(15, 14)
-    .padding(1, 1)
-    .kernel_size(3, 3)
-    .dilation(1, 2)
-    .groups(27)
+    .input_size(1, 1)
+    .kernel_size(1, 1)
+    .group_input_channels(23)
+    .group_output_channels(19)
+    .qmin(128)
     .iterations(3)
     .TestF32();
 }
 
-TEST(CONVOLUTION_OP_F32, depthwise_3x3d2x1) {
+TEST(CONVOLUTION_OP_F32, unioutput_1x1_with_qmax) {
   ConvolutionOperatorTester()
-    .input_size(15, 14)
-    .padding(1, 1)
-    .kernel_size(3, 3)
-    .dilation(2, 1)
-    .groups(27)
+    .input_size(1, 1)
+    .kernel_size(1, 1)
+    .group_input_channels(23)
+    .group_output_channels(19)
+    .qmax(128)
     .iterations(3)
     .TestF32();
 }
 
-TEST(CONVOLUTION_OP_F32, depthwise_5x5) {
+TEST(CONVOLUTION_OP_F32, unioutput_1x1_with_input_stride) {
   ConvolutionOperatorTester()
-    .input_size(15, 14)
-    .padding(2, 2)
-    .kernel_size(5, 5)
-    .groups(27)
+    .input_size(1, 1)
+    .kernel_size(1, 1)
+    .input_pixel_stride(28)
+    .group_input_channels(23)
+    .group_output_channels(19)
     .iterations(3)
     .TestF32();
 }
 
-TEST(CONVOLUTION_OP_F32, depthwise_5x5s2) {
+TEST(CONVOLUTION_OP_F32, unioutput_1x1_with_output_stride) {
   ConvolutionOperatorTester()
-    .input_size(15, 14)
-    .padding(2, 2)
-    .kernel_size(5, 5)
-    .subsampling(2)
-    .groups(27)
+    .input_size(1, 1)
+    .kernel_size(1, 1)
+    .output_pixel_stride(29)
+    .group_input_channels(23)
+    .group_output_channels(19)
     .iterations(3)
     .TestF32();
 }
 
-TEST(CONVOLUTION_OP_F32, depthwise_5x5s1x2) {
+TEST(CONVOLUTION_OP_F32, unioutput_grouped_1x1) {
   ConvolutionOperatorTester()
-    .input_size(15, 14)
-    .padding(2, 2)
-    .kernel_size(5, 5)
-    .subsampling(1, 2)
-    .groups(27)
+    .input_size(1, 1)
+    .kernel_size(1, 1)
+    .groups(2)
+    .group_input_channels(17)
+    .group_output_channels(13)
     .iterations(3)
     .TestF32();
 }
 
-TEST(CONVOLUTION_OP_F32, depthwise_5x5s2x1) {
+TEST(CONVOLUTION_OP_F32, unioutput_grouped_1x1_with_qmin) {
   ConvolutionOperatorTester()
-    .input_size(15, 14)
-    .padding(2, 2)
-    .kernel_size(5, 5)
-    .subsampling(2, 1)
-    .groups(27)
+    .input_size(1, 1)
+    .kernel_size(1, 1)
+    .groups(2)
+    .group_input_channels(17)
+    .group_output_channels(13)
+    .qmin(128)
     .iterations(3)
     .TestF32();
 }
 
-TEST(CONVOLUTION_OP_F32, depthwise_5x5d2) {
+TEST(CONVOLUTION_OP_F32, unioutput_grouped_1x1_with_qmax) {
   ConvolutionOperatorTester()
-    .input_size(15, 14)
-    .padding(2, 2)
-    .kernel_size(5, 5)
-    .dilation(2)
-    .groups(27)
-    .iterations(3)
-    .TestF32();
-}
-
+    .input_size(1, 1)
+    .kernel_size(1, 1)
+    .groups(2)
+    .group_input_channels(17)
+    .group_output_channels(13)
+    .qmax(128)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, unioutput_grouped_1x1_with_input_stride) {
+  ConvolutionOperatorTester()
+    .input_size(1, 1)
+    .kernel_size(1, 1)
+    .groups(2)
+    .input_pixel_stride(37)
+    .group_input_channels(17)
+    .group_output_channels(13)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, unioutput_grouped_1x1_with_output_stride) {
+  ConvolutionOperatorTester()
+    .input_size(1, 1)
+    .kernel_size(1, 1)
+    .groups(2)
+    .output_pixel_stride(41)
+    .group_input_channels(17)
+    .group_output_channels(13)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, 1x3) {
+  ConvolutionOperatorTester()
+    .input_size(20, 19)
+    .padding_width(1)
+    .kernel_size(1, 3)
+    .group_input_channels(17)
+    .group_output_channels(15)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, grouped_1x3) {
+  ConvolutionOperatorTester()
+    .input_size(20, 19)
+    .padding_width(1)
+    .kernel_size(1, 3)
+    .groups(2)
+    .group_input_channels(17)
+    .group_output_channels(15)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, 3x1) {
+  ConvolutionOperatorTester()
+    .input_size(19, 20)
+    .padding_height(1)
+    .kernel_size(3, 1)
+    .group_input_channels(17)
+    .group_output_channels(15)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, grouped_3x1) {
+  ConvolutionOperatorTester()
+    .input_size(19, 20)
+    .padding_height(1)
+    .kernel_size(3, 1)
+    .groups(2)
+    .group_input_channels(17)
+    .group_output_channels(15)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, 3x3) {
+  ConvolutionOperatorTester()
+    .input_size(13, 12)
+    .padding(1)
+    .kernel_size(3, 3)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, 3x3_without_padding) {
+  ConvolutionOperatorTester()
+    .input_size(13, 12)
+    .kernel_size(3, 3)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, 3x3_with_left_padding) {
+  ConvolutionOperatorTester()
+    .input_size(13, 12)
+    .padding_left(1)
+    .kernel_size(3, 3)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, 3x3_with_right_padding) {
+  ConvolutionOperatorTester()
+    .input_size(13, 12)
+    .padding_right(1)
+    .kernel_size(3, 3)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, 3x3_with_top_padding) {
+  ConvolutionOperatorTester()
+    .input_size(13, 12)
+    .padding_top(1)
+    .kernel_size(3, 3)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, 3x3_with_bottom_padding) {
+  ConvolutionOperatorTester()
+    .input_size(13, 12)
+    .padding_bottom(1)
+    .kernel_size(3, 3)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, 3x3_with_input_stride) {
+  ConvolutionOperatorTester()
+    .input_size(13, 12)
+    .padding(1)
+    .kernel_size(3, 3)
+    .input_pixel_stride(22)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, 3x3_with_output_stride) {
+  ConvolutionOperatorTester()
+    .input_size(13, 12)
+    .padding(1)
+    .kernel_size(3, 3)
+    .output_pixel_stride(23)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, 3x3_with_batch) {
+  ConvolutionOperatorTester()
+    .batch_size(3)
+    .input_size(10, 9)
+    .padding(1)
+    .kernel_size(3, 3)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, grouped_3x3) {
+  ConvolutionOperatorTester()
+    .input_size(10, 11)
+    .padding(1)
+    .kernel_size(3, 3)
+    .groups(2)
+    .group_input_channels(14)
+    .group_output_channels(13)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, grouped_3x3_without_padding) {
+  ConvolutionOperatorTester()
+    .input_size(13, 12)
+    .kernel_size(3, 3)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, grouped_3x3_with_left_padding) {
+  ConvolutionOperatorTester()
+    .input_size(10, 11)
+    .padding_left(1)
+    .kernel_size(3, 3)
+    .groups(2)
+    .group_input_channels(14)
+    .group_output_channels(13)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, grouped_3x3_with_right_padding) {
+  ConvolutionOperatorTester()
+    .input_size(10, 11)
+    .padding_right(1)
+    .kernel_size(3, 3)
+    .groups(2)
+    .group_input_channels(14)
+    .group_output_channels(13)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, grouped_3x3_with_top_padding) {
+  ConvolutionOperatorTester()
+    .input_size(10, 11)
+    .padding_top(1)
+    .kernel_size(3, 3)
+    .groups(2)
+    .group_input_channels(14)
+    .group_output_channels(13)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, grouped_3x3_with_bottom_padding) {
+  ConvolutionOperatorTester()
+    .input_size(10, 11)
+    .padding_bottom(1)
+    .kernel_size(3, 3)
+    .groups(2)
+    .group_input_channels(14)
+    .group_output_channels(13)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, grouped_3x3_with_input_stride) {
+  ConvolutionOperatorTester()
+    .input_size(10, 11)
+    .padding(1)
+    .kernel_size(3, 3)
+    .groups(2)
+    .input_pixel_stride(29)
+    .group_input_channels(14)
+    .group_output_channels(13)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, grouped_3x3_with_output_stride) {
+  ConvolutionOperatorTester()
+    .input_size(10, 11)
+    .padding(1)
+    .kernel_size(3, 3)
+    .groups(2)
+    .output_pixel_stride(31)
+    .group_input_channels(14)
+    .group_output_channels(13)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, grouped_3x3_with_batch) {
+  ConvolutionOperatorTester()
+    .batch_size(3)
+    .input_size(10, 11)
+    .padding(1)
+    .kernel_size(3, 3)
+    .groups(2)
+    .group_input_channels(14)
+    .group_output_channels(13)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, 3x3s2) {
+  ConvolutionOperatorTester()
+    .input_size(19, 21)
+    .padding(1)
+    .kernel_size(3, 3)
+    .subsampling(2)
+    .group_input_channels(27)
+    .group_output_channels(19)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, 3x3s1x2) {
+  ConvolutionOperatorTester()
+    .input_size(13, 13)
+    .padding(1)
+    .kernel_size(3, 3)
+    .subsampling(1, 2)
+    .group_input_channels(27)
+    .group_output_channels(19)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, 3x3s2x1) {
+  ConvolutionOperatorTester()
+    .input_size(13, 13)
+    .padding(1)
+    .kernel_size(3, 3)
+    .subsampling(2, 1)
+    .group_input_channels(27)
+    .group_output_channels(19)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, 3x3d2) {
+  ConvolutionOperatorTester()
+    .input_size(13, 14)
+    .padding(2)
+    .kernel_size(3, 3)
+    .dilation(2)
+    .group_input_channels(27)
+    .group_output_channels(19)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, 3x3d1x2) {
+  ConvolutionOperatorTester()
+    .input_size(14, 15)
+    .padding(1, 2)
+    .kernel_size(3, 3)
+    .dilation(1, 2)
+    .group_input_channels(27)
+    .group_output_channels(19)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, 3x3d2x1) {
+  ConvolutionOperatorTester()
+    .input_size(15, 14)
+    .padding(2, 1)
+    .kernel_size(3, 3)
+    .dilation(2, 1)
+    .group_input_channels(27)
+    .group_output_channels(19)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, unioutput_3x3) {
+  ConvolutionOperatorTester()
+    .input_size(3, 3)
+    .padding(1)
+    .kernel_size(3, 3)
+    .group_input_channels(23)
+    .group_output_channels(19)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, unioutput_3x3_with_qmin) {
+  ConvolutionOperatorTester()
+    .input_size(3, 3)
+    .padding(1)
+    .kernel_size(3, 3)
+    .group_input_channels(23)
+    .group_output_channels(19)
+    .qmin(128)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, unioutput_3x3_with_qmax) {
+  ConvolutionOperatorTester()
+    .input_size(3, 3)
+    .padding(1)
+    .kernel_size(3, 3)
+    .group_input_channels(23)
+    .group_output_channels(19)
+    .qmax(128)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, unioutput_3x3_with_input_stride) {
+  ConvolutionOperatorTester()
+    .input_size(3, 3)
+    .padding(1)
+    .kernel_size(3, 3)
+    .input_pixel_stride(28)
+    .group_input_channels(23)
+    .group_output_channels(19)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, unioutput_3x3_with_output_stride) {
+  ConvolutionOperatorTester()
+    .input_size(3, 3)
+    .padding(1)
+    .kernel_size(3, 3)
+    .output_pixel_stride(29)
+    .group_input_channels(23)
+    .group_output_channels(19)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, unioutput_grouped_3x3) {
+  ConvolutionOperatorTester()
+    .input_size(3, 3)
+    .padding(1)
+    .kernel_size(3, 3)
+    .groups(2)
+    .group_input_channels(17)
+    .group_output_channels(13)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, unioutput_grouped_3x3_with_qmin) {
+  ConvolutionOperatorTester()
+    .input_size(3, 3)
+    .padding(1)
+    .kernel_size(3, 3)
+    .groups(2)
+    .group_input_channels(17)
+    .group_output_channels(13)
+    .qmin(128)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, unioutput_grouped_3x3_with_qmax) {
+  ConvolutionOperatorTester()
+    .input_size(3, 3)
+    .padding(1)
+    .kernel_size(3, 3)
+    .groups(2)
+    .group_input_channels(17)
+    .group_output_channels(13)
+    .qmax(128)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, unioutput_grouped_3x3_with_input_stride) {
+  ConvolutionOperatorTester()
+    .input_size(3, 3)
+    .padding(1)
+    .kernel_size(3, 3)
+    .groups(2)
+    .input_pixel_stride(37)
+    .group_input_channels(17)
+    .group_output_channels(13)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, unioutput_grouped_3x3_with_output_stride) {
+  ConvolutionOperatorTester()
+    .input_size(3, 3)
+    .padding(1)
+    .kernel_size(3, 3)
+    .groups(2)
+    .output_pixel_stride(41)
+    .group_input_channels(17)
+    .group_output_channels(13)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, depthwise_1x1) {
+  ConvolutionOperatorTester()
+    .input_size(15, 14)
+    .kernel_size(1, 1)
+    .groups(24)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, depthwise_2x2) {
+  ConvolutionOperatorTester()
+    .input_size(15, 14)
+    .padding(1, 1)
+    .kernel_size(2, 2)
+    .groups(24)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, depthwise_2x2s2) {
+  ConvolutionOperatorTester()
+    .input_size(15, 14)
+    .padding(1, 1)
+    .kernel_size(2, 2)
+    .subsampling(2)
+    .groups(27)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, depthwise_2x2s1x2) {
+  ConvolutionOperatorTester()
+    .input_size(15, 14)
+    .padding(1, 1)
+    .kernel_size(2, 2)
+    .subsampling(1, 2)
+    .groups(27)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, depthwise_2x2s2x1) {
+  ConvolutionOperatorTester()
+    .input_size(15, 14)
+    .padding(1, 1)
+    .kernel_size(2, 2)
+    .subsampling(2, 1)
+    .groups(27)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, depthwise_2x2d2) {
+  ConvolutionOperatorTester()
+    .input_size(15, 14)
+    .padding(1, 1)
+    .kernel_size(2, 2)
+    .dilation(2)
+    .groups(27)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, depthwise_2x2d1x2) {
+  ConvolutionOperatorTester()
+    .input_size(15, 14)
+    .padding(1, 1)
+    .kernel_size(2, 2)
+    .dilation(1, 2)
+    .groups(27)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, depthwise_2x2d2x1) {
+  ConvolutionOperatorTester()
+    .input_size(15, 14)
+    .padding(1, 1)
+    .kernel_size(2, 2)
+    .dilation(2, 1)
+    .groups(27)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, depthwise_3x3) {
+  ConvolutionOperatorTester()
+    .input_size(15, 14)
+    .padding(1, 1)
+    .kernel_size(3, 3)
+    .groups(24)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, depthwise_3x3s2) {
+  ConvolutionOperatorTester()
+    .input_size(15, 14)
+    .padding(1, 1)
+    .kernel_size(3, 3)
+    .subsampling(2)
+    .groups(27)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, depthwise_3x3s1x2) {
+  ConvolutionOperatorTester()
+    .input_size(15, 14)
+    .padding(1, 1)
+    .kernel_size(3, 3)
+    .subsampling(1, 2)
+    .groups(27)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, depthwise_3x3s2x1) {
+  ConvolutionOperatorTester()
+    .input_size(15, 14)
+    .padding(1, 1)
+    .kernel_size(3, 3)
+    .subsampling(2, 1)
+    .groups(27)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, depthwise_3x3d2) {
+  ConvolutionOperatorTester()
+    .input_size(15, 14)
+    .padding(1, 1)
+    .kernel_size(3, 3)
+    .dilation(2)
+    .groups(27)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, depthwise_3x3d1x2) {
+  ConvolutionOperatorTester()
+    .input_size(15, 14)
+    .padding(1, 1)
+    .kernel_size(3, 3)
+    .dilation(1, 2)
+    .groups(27)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, depthwise_3x3d2x1) {
+  ConvolutionOperatorTester()
+    .input_size(15, 14)
+    .padding(1, 1)
+    .kernel_size(3, 3)
+    .dilation(2, 1)
+    .groups(27)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, depthwise_5x5) {
+  ConvolutionOperatorTester()
+    .input_size(15, 14)
+    .padding(2, 2)
+    .kernel_size(5, 5)
+    .groups(27)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, depthwise_5x5s2) {
+  ConvolutionOperatorTester()
+    .input_size(15, 14)
+    .padding(2, 2)
+    .kernel_size(5, 5)
+    .subsampling(2)
+    .groups(27)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, depthwise_5x5s1x2) {
+  ConvolutionOperatorTester()
+    .input_size(15, 14)
+    .padding(2, 2)
+    .kernel_size(5, 5)
+    .subsampling(1, 2)
+    .groups(27)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, depthwise_5x5s2x1) {
+  ConvolutionOperatorTester()
+    .input_size(15, 14)
+    .padding(2, 2)
+    .kernel_size(5, 5)
+    .subsampling(2, 1)
+    .groups(27)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, depthwise_5x5d2) {
+  ConvolutionOperatorTester()
+    .input_size(15, 14)
+    .padding(2, 2)
+    .kernel_size(5, 5)
+    .dilation(2)
+    .groups(27)
+    .iterations(3)
+    .TestF32();
+}
+
 TEST(CONVOLUTION_OP_F32, depthwise_5x5d1x2) {
   ConvolutionOperatorTester()
     .input_size(15, 14)
@@ -1830,6 +2787,68 @@ TEST(CONVOLUTION_OP_F32, depthwise_5x5d2x1) {
     .TestF32();
 }
 
+TEST(CONVOLUTION_OP_F32, depthwise_1x7) {
+  ConvolutionOperatorTester()
+    .input_size(15, 14)
+    .padding(0, 3)
+    .kernel_size(1, 7)
+    .groups(27)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, depthwise_3x5) {
+  ConvolutionOperatorTester()
+    .input_size(15, 14)
+    .padding(1, 2)
+    .kernel_size(3, 5)
+    .groups(27)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, depthwise_5x3) {
+  ConvolutionOperatorTester()
+    .input_size(15, 14)
+    .padding(2, 1)
+    .kernel_size(5, 3)
+    .groups(27)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, depthwise_7x7) {
+  ConvolutionOperatorTester()
+    .input_size(15, 14)
+    .padding(3, 3)
+    .kernel_size(7, 7)
+    .groups(27)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, depthwise_7x7s2) {
+  ConvolutionOperatorTester()
+    .input_size(15, 14)
+    .padding(3, 3)
+    .kernel_size(7, 7)
+    .subsampling(2)
+    .groups(27)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, depthwise_7x7d2) {
+  ConvolutionOperatorTester()
+    .input_size(15, 14)
+    .padding(3, 3)
+    .kernel_size(7, 7)
+    .dilation(2)
+    .groups(27)
+    .iterations(3)
+    .TestF32();
+}
+
 TEST(DEPTHWISE_CONVOLUTION_OP_F32, 1x1) {
   ConvolutionOperatorTester()
     .depthwise_layout(true)
@@ -1915,18 +2934,76 @@ TEST(DEPTHWISE_CONVOLUTION_OP_F32, 5x5_with_depth_multiplier) {
     .padding(2, 2)
     .kernel_size(5, 5)
     .groups(24)
-    .group_output_channels(3)
+    .group_output_channels(3)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(DEPTHWISE_CONVOLUTION_OP_F32, 7x7) {
+  ConvolutionOperatorTester()
+    .depthwise_layout(true)
+    .input_size(15, 14)
+    .padding(3, 3)
+    .kernel_size(7, 7)
+    .groups(24)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, 1x1_with_packed_weights) {
+  ConvolutionOperatorTester()
+    .input_size(27, 29)
+    .kernel_size(1, 1)
+    .group_input_channels(23)
+    .group_output_channels(19)
+    .load_packed_weights(true)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, grouped_3x3_with_packed_weights) {
+  ConvolutionOperatorTester()
+    .input_size(13, 12)
+    .padding(1)
+    .kernel_size(3, 3)
+    .groups(2)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .load_packed_weights(true)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, depthwise_1x1_with_packed_weights) {
+  ConvolutionOperatorTester()
+    .input_size(15, 14)
+    .kernel_size(1, 1)
+    .groups(24)
+    .load_packed_weights(true)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, depthwise_3x3_with_packed_weights) {
+  ConvolutionOperatorTester()
+    .input_size(15, 14)
+    .padding(1, 1)
+    .kernel_size(3, 3)
+    .groups(24)
+    .load_packed_weights(true)
     .iterations(3)
     .TestF32();
 }
 
-TEST(DEPTHWISE_CONVOLUTION_OP_F32, 7x7) {
+TEST(DEPTHWISE_CONVOLUTION_OP_F32, 3x3_with_depth_multiplier_and_packed_weights) {
   ConvolutionOperatorTester()
     .depthwise_layout(true)
     .input_size(15, 14)
-    .padding(3, 3)
-    .kernel_size(7, 7)
+    .padding(1, 1)
+    .kernel_size(3, 3)
     .groups(24)
+    .group_output_channels(3)
+    .load_packed_weights(true)
     .iterations(3)
     .TestF32();
 }
@@ -2019,57 +3096,363 @@ TEST(CONVOLUTION_OP_F32, setup_decreasing_batch_depthwise) {
     .TestSetupF32();
 }
 
-TEST(CONVOLUTION_OP_F32, setup_changing_height) {
+TEST(CONVOLUTION_OP_F32, setup_changing_height) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  ConvolutionOperatorTester()
+    .batch_size(3)
+    .input_height(8)
+    .input_width(8)
+    .next_input_height(9)
+    .kernel_height(5)
+    .kernel_width(3)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .TestSetupF32();
+  ConvolutionOperatorTester()
+    .batch_size(3)
+    .input_height(8)
+    .input_width(8)
+    .next_input_height(7)
+    .kernel_height(5)
+    .kernel_width(3)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .TestSetupF32();
+}
+
+TEST(CONVOLUTION_OP_F32, setup_changing_height_grouped) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  ConvolutionOperatorTester()
+    .batch_size(3)
+    .input_height(8)
+    .input_width(8)
+    .next_input_height(9)
+    .kernel_height(5)
+    .kernel_width(3)
+    .groups(2)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .TestSetupF32();
+  ConvolutionOperatorTester()
+    .batch_size(3)
+    .input_height(8)
+    .input_width(8)
+    .next_input_height(7)
+    .kernel_height(5)
+    .kernel_width(3)
+    .groups(2)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .TestSetupF32();
+}
+
+TEST(CONVOLUTION_OP_F32, setup_changing_height_depthwise) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  ConvolutionOperatorTester()
+    .batch_size(3)
+    .input_height(8)
+    .input_width(8)
+    .next_input_height(9)
+    .kernel_height(3)
+    .kernel_width(3)
+    .groups(19)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .TestSetupF32();
+  ConvolutionOperatorTester()
+    .batch_size(3)
+    .input_height(8)
+    .input_width(8)
+    .next_input_height(7)
+    .kernel_height(3)
+    .kernel_width(3)
+    .groups(19)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .TestSetupF32();
+}
+
+TEST(CONVOLUTION_OP_F32, setup_changing_width) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  ConvolutionOperatorTester()
+    .batch_size(3)
+    .input_height(8)
+    .input_width(8)
+    .next_input_width(9)
+    .kernel_height(5)
+    .kernel_width(3)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .TestSetupF32();
+  ConvolutionOperatorTester()
+    .batch_size(3)
+    .input_height(8)
+    .input_width(8)
+    .next_input_width(7)
+    .kernel_height(5)
+    .kernel_width(3)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .TestSetupF32();
+}
+
+TEST(CONVOLUTION_OP_F32, setup_changing_width_grouped) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  ConvolutionOperatorTester()
+    .batch_size(3)
+    .input_height(8)
+    .input_width(8)
+    .next_input_width(9)
+    .kernel_height(5)
+    .kernel_width(3)
+    .groups(2)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .TestSetupF32();
+  ConvolutionOperatorTester()
+    .batch_size(3)
+    .input_height(8)
+    .input_width(8)
+    .next_input_width(7)
+    .kernel_height(5)
+    .kernel_width(3)
+    .groups(2)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .TestSetupF32();
+}
+
+TEST(CONVOLUTION_OP_F32, setup_changing_width_depthwise) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  ConvolutionOperatorTester()
+    .batch_size(3)
+    .input_height(8)
+    .input_width(8)
+    .next_input_width(9)
+    .kernel_height(3)
+    .kernel_width(3)
+    .groups(19)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .TestSetupF32();
+  ConvolutionOperatorTester()
+    .batch_size(3)
+    .input_height(8)
+    .input_width(8)
+    .next_input_width(7)
+    .kernel_height(3)
+    .kernel_width(3)
+    .groups(19)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .TestSetupF32();
+}
+
+TEST(CONVOLUTION_OP_F32, setup_swap_height_and_width) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  ConvolutionOperatorTester()
+    .batch_size(3)
+    .input_height(9)
+    .input_width(8)
+    .next_input_height(8)
+    .next_input_width(9)
+    .kernel_height(5)
+    .kernel_width(3)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .TestSetupF32();
+}
+
+TEST(CONVOLUTION_OP_F32, setup_swap_height_and_width_grouped) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  ConvolutionOperatorTester()
+    .batch_size(3)
+    .input_height(9)
+    .input_width(8)
+    .next_input_height(8)
+    .next_input_width(9)
+    .kernel_height(5)
+    .kernel_width(3)
+    .groups(2)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .TestSetupF32();
+}
+
+TEST(CONVOLUTION_OP_F32, setup_swap_height_and_width_depthwise) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  ConvolutionOperatorTester()
+    .batch_size(3)
+    .input_height(9)
+    .input_width(8)
+    .next_input_height(8)
+    .next_input_width(9)
+    .kernel_height(3)
+    .kernel_width(3)
+    .groups(19)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .TestSetupF32();
+}
+
+TEST(CONVOLUTION_OP_F32, setup_double_buffering) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  ConvolutionOperatorTester()
+    .batch_size(3)
+    .input_height(8)
+    .input_width(8)
+    .kernel_height(3)
+    .kernel_width(3)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .double_buffering(true)
+    .TestSetupF32();
+}
+
+TEST(CONVOLUTION_OP_F32, setup_double_buffering_depthwise) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  ConvolutionOperatorTester()
+    .batch_size(3)
+    .input_height(8)
+    .input_width(8)
+    .kernel_height(3)
+    .kernel_width(3)
+    .groups(19)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .double_buffering(true)
+    .TestSetupF32();
+}
+
+TEST(CONVOLUTION_OP_F32, setup_double_buffering_decreasing_batch_depthwise) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  ConvolutionOperatorTester()
+    .batch_size(5)
+    .next_batch_size(3)
+    .input_height(8)
+    .input_width(8)
+    .kernel_height(3)
+    .kernel_width(3)
+    .groups(19)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .double_buffering(true)
+    .TestSetupF32();
+}
+
+TEST(CONVOLUTION_OP_F32, setup_double_buffering_increasing_batch_depthwise) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  ConvolutionOperatorTester()
+    .batch_size(3)
+    .next_batch_size(5)
+    .input_height(8)
+    .input_width(8)
+    .kernel_height(3)
+    .kernel_width(3)
+    .groups(19)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .double_buffering(true)
+    .TestSetupF32();
+}
+
+TEST(CONVOLUTION_OP_F32, setup_double_buffering_wide_depthwise) {
   ASSERT_EQ(xnn_status_success, xnn_initialize());
   ConvolutionOperatorTester()
-    .batch_size(3)
-    .input_height(8)
-    .input_width(8)
-    .next_input_height(9)
-    .kernel_height(5)
+    .batch_size(2)
+    .input_height(4)
+    .input_width(700)
+    .padding(1)
+    .kernel_height(3)
     .kernel_width(3)
-    .group_input_channels(15)
-    .group_output_channels(17)
+    .groups(5)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .double_buffering(true)
     .TestSetupF32();
+}
+
+TEST(CONVOLUTION_OP_F32, compact_indirection_3x3) {
   ConvolutionOperatorTester()
-    .batch_size(3)
-    .input_height(8)
-    .input_width(8)
-    .next_input_height(7)
-    .kernel_height(5)
-    .kernel_width(3)
+    .input_size(13, 12)
+    .padding(1)
+    .kernel_size(3, 3)
     .group_input_channels(15)
     .group_output_channels(17)
-    .TestSetupF32();
+    .compact_indirection(true)
+    .iterations(3)
+    .TestF32();
 }
 
-TEST(CONVOLUTION_OP_F32, setup_changing_height_grouped) {
-  ASSERT_EQ(xnn_status_success, xnn_initialize());
+TEST(CONVOLUTION_OP_F32, compact_indirection_grouped_3x3) {
   ConvolutionOperatorTester()
-    .batch_size(3)
-    .input_height(8)
-    .input_width(8)
-    .next_input_height(9)
-    .kernel_height(5)
-    .kernel_width(3)
+    .input_size(10, 11)
+    .padding(1)
+    .kernel_size(3, 3)
     .groups(2)
+    .group_input_channels(14)
+    .group_output_channels(13)
+    .compact_indirection(true)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, compact_indirection_3x3s2_with_dilation) {
+  ConvolutionOperatorTester()
+    .input_size(14, 15)
+    .padding(2)
+    .kernel_size(3, 3)
+    .subsampling(2)
+    .dilation(2)
+    .input_pixel_stride(19)
+    .output_pixel_stride(21)
     .group_input_channels(15)
     .group_output_channels(17)
-    .TestSetupF32();
+    .compact_indirection(true)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, compact_indirection_depthwise_3x3) {
+  ConvolutionOperatorTester()
+    .input_size(15, 14)
+    .padding(1, 1)
+    .kernel_size(3, 3)
+    .groups(27)
+    .compact_indirection(true)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, compact_indirection_depthwise_5x5s2) {
+  ConvolutionOperatorTester()
+    .input_size(15, 14)
+    .padding(2, 2)
+    .kernel_size(5, 5)
+    .subsampling(2)
+    .groups(27)
+    .compact_indirection(true)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, setup_compact_indirection) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
   ConvolutionOperatorTester()
     .batch_size(3)
+    .next_batch_size(5)
     .input_height(8)
     .input_width(8)
-    .next_input_height(7)
-    .kernel_height(5)
+    .kernel_height(3)
     .kernel_width(3)
-    .groups(2)
     .group_input_channels(15)
     .group_output_channels(17)
+    .compact_indirection(true)
+    .double_buffering(true)
     .TestSetupF32();
 }
 
-TEST(CONVOLUTION_OP_F32, setup_changing_height_depthwise) {
+TEST(CONVOLUTION_OP_F32, setup_compact_indirection_changing_height_depthwise) {
   ASSERT_EQ(xnn_status_success, xnn_initialize());
   ConvolutionOperatorTester()
     .batch_size(3)
@@ -2081,139 +3464,272 @@ TEST(CONVOLUTION_OP_F32, setup_changing_height_depthwise) {
     .groups(19)
     .group_input_channels(1)
     .group_output_channels(1)
+    .compact_indirection(true)
     .TestSetupF32();
+}
+
+TEST(CONVOLUTION_OP_F32, setup_compact_indirection_depthwise) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
   ConvolutionOperatorTester()
     .batch_size(3)
+    .next_batch_size(5)
     .input_height(8)
     .input_width(8)
-    .next_input_height(7)
     .kernel_height(3)
     .kernel_width(3)
     .groups(19)
     .group_input_channels(1)
     .group_output_channels(1)
+    .compact_indirection(true)
+    .double_buffering(true)
     .TestSetupF32();
 }
 
-TEST(CONVOLUTION_OP_F32, setup_changing_width) {
+TEST(CONVOLUTION_OP_F32, setup_compact_indirection_wide_depthwise) {
   ASSERT_EQ(xnn_status_success, xnn_initialize());
   ConvolutionOperatorTester()
-    .batch_size(3)
-    .input_height(8)
-    .input_width(8)
-    .next_input_width(9)
-    .kernel_height(5)
+    .batch_size(2)
+    .input_height(4)
+    .input_width(700)
+    .padding(1)
+    .kernel_height(3)
     .kernel_width(3)
-    .group_input_channels(15)
-    .group_output_channels(17)
+    .groups(5)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .compact_indirection(true)
     .TestSetupF32();
+}
+
+TEST(CONVOLUTION_OP_F32, setup_changing_size_with_shape_cache) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
   ConvolutionOperatorTester()
     .batch_size(3)
-    .input_height(8)
+    .input_height(9)
     .input_width(8)
-    .next_input_width(7)
-    .kernel_height(5)
+    .next_input_height(7)
+    .next_input_width(10)
+    .kernel_height(3)
     .kernel_width(3)
+    .padding(1)
     .group_input_channels(15)
     .group_output_channels(17)
+    .shape_cache_size(4)
     .TestSetupF32();
 }
 
-TEST(CONVOLUTION_OP_F32, setup_changing_width_grouped) {
+TEST(CONVOLUTION_OP_F32, setup_changing_size_and_batch_with_shape_cache) {
   ASSERT_EQ(xnn_status_success, xnn_initialize());
   ConvolutionOperatorTester()
-    .batch_size(3)
-    .input_height(8)
+    .batch_size(2)
+    .input_height(9)
     .input_width(8)
-    .next_input_width(9)
-    .kernel_height(5)
+    .next_batch_size(5)
+    .next_input_height(12)
+    .next_input_width(6)
+    .kernel_height(3)
     .kernel_width(3)
-    .groups(2)
+    .padding(1)
     .group_input_channels(15)
     .group_output_channels(17)
+    .shape_cache_size(1)
     .TestSetupF32();
+}
+
+TEST(CONVOLUTION_OP_F32, setup_changing_size_with_shape_cache_grouped) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
   ConvolutionOperatorTester()
     .batch_size(3)
-    .input_height(8)
+    .input_height(9)
     .input_width(8)
-    .next_input_width(7)
-    .kernel_height(5)
+    .next_input_height(7)
+    .next_input_width(10)
+    .kernel_height(3)
     .kernel_width(3)
+    .padding(1)
     .groups(2)
     .group_input_channels(15)
     .group_output_channels(17)
+    .shape_cache_size(4)
     .TestSetupF32();
 }
 
-TEST(CONVOLUTION_OP_F32, setup_changing_width_depthwise) {
+TEST(CONVOLUTION_OP_F32, setup_changing_size_with_shape_cache_depthwise) {
   ASSERT_EQ(xnn_status_success, xnn_initialize());
   ConvolutionOperatorTester()
     .batch_size(3)
-    .input_height(8)
+    .input_height(9)
     .input_width(8)
-    .next_input_width(9)
+    .next_input_height(7)
+    .next_input_width(10)
     .kernel_height(3)
     .kernel_width(3)
+    .padding(1)
     .groups(19)
     .group_input_channels(1)
     .group_output_channels(1)
+    .shape_cache_size(4)
     .TestSetupF32();
+}
+
+TEST(CONVOLUTION_OP_F32, setup_changing_size_and_batch_with_shape_cache_depthwise) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
   ConvolutionOperatorTester()
-    .batch_size(3)
-    .input_height(8)
+    .batch_size(4)
+    .input_height(9)
     .input_width(8)
-    .next_input_width(7)
+    .next_batch_size(2)
+    .next_input_height(12)
+    .next_input_width(6)
     .kernel_height(3)
     .kernel_width(3)
+    .padding(1)
     .groups(19)
     .group_input_channels(1)
     .group_output_channels(1)
+    .shape_cache_size(1)
     .TestSetupF32();
 }
 
-TEST(CONVOLUTION_OP_F32, setup_swap_height_and_width) {
-  ASSERT_EQ(xnn_status_success, xnn_initialize());
+TEST(CONVOLUTION_OP_F32, winograd_3x3) {
   ConvolutionOperatorTester()
-    .batch_size(3)
-    .input_height(9)
-    .input_width(8)
-    .next_input_height(8)
-    .next_input_width(9)
-    .kernel_height(5)
-    .kernel_width(3)
-    .group_input_channels(15)
-    .group_output_channels(17)
-    .TestSetupF32();
+    .input_size(13, 12)
+    .padding(1)
+    .kernel_size(3, 3)
+    .group_input_channels(37)
+    .group_output_channels(41)
+    .iterations(3)
+    .TestF32();
 }
 
-TEST(CONVOLUTION_OP_F32, setup_swap_height_and_width_grouped) {
-  ASSERT_EQ(xnn_status_success, xnn_initialize());
+TEST(CONVOLUTION_OP_F32, winograd_3x3_without_padding) {
+  ConvolutionOperatorTester()
+    .input_size(13, 12)
+    .kernel_size(3, 3)
+    .group_input_channels(37)
+    .group_output_channels(41)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, winograd_3x3_with_asymmetric_padding) {
+  ConvolutionOperatorTester()
+    .input_size(11, 10)
+    .padding_top(2)
+    .padding_left(1)
+    .kernel_size(3, 3)
+    .group_input_channels(37)
+    .group_output_channels(41)
+    .iterations(3)
+    .TestF32();
+  ConvolutionOperatorTester()
+    .input_size(11, 10)
+    .padding_bottom(2)
+    .padding_right(1)
+    .kernel_size(3, 3)
+    .group_input_channels(37)
+    .group_output_channels(41)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, winograd_3x3_with_qmin) {
+  ConvolutionOperatorTester()
+    .input_size(13, 12)
+    .padding(1)
+    .kernel_size(3, 3)
+    .group_input_channels(37)
+    .group_output_channels(41)
+    .qmin(128)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, winograd_3x3_with_qmax) {
+  ConvolutionOperatorTester()
+    .input_size(13, 12)
+    .padding(1)
+    .kernel_size(3, 3)
+    .group_input_channels(37)
+    .group_output_channels(41)
+    .qmax(128)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, winograd_3x3_with_input_stride) {
+  ConvolutionOperatorTester()
+    .input_size(13, 12)
+    .padding(1)
+    .kernel_size(3, 3)
+    .input_pixel_stride(43)
+    .group_input_channels(37)
+    .group_output_channels(41)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, winograd_3x3_with_output_stride) {
+  ConvolutionOperatorTester()
+    .input_size(13, 12)
+    .padding(1)
+    .kernel_size(3, 3)
+    .output_pixel_stride(47)
+    .group_input_channels(37)
+    .group_output_channels(41)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, winograd_3x3_with_batch) {
   ConvolutionOperatorTester()
     .batch_size(3)
-    .input_height(9)
-    .input_width(8)
-    .next_input_height(8)
-    .next_input_width(9)
-    .kernel_height(5)
-    .kernel_width(3)
-    .groups(2)
-    .group_input_channels(15)
-    .group_output_channels(17)
-    .TestSetupF32();
+    .input_size(10, 9)
+    .padding(1)
+    .kernel_size(3, 3)
+    .group_input_channels(37)
+    .group_output_channels(41)
+    .iterations(3)
+    .TestF32();
 }
 
-TEST(CONVOLUTION_OP_F32, setup_swap_height_and_width_depthwise) {
+TEST(CONVOLUTION_OP_F32, winograd_3x3_with_packed_weights) {
+  ConvolutionOperatorTester()
+    .input_size(13, 12)
+    .padding(1)
+    .kernel_size(3, 3)
+    .group_input_channels(37)
+    .group_output_channels(41)
+    .load_packed_weights(true)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, winograd_disabled_3x3) {
+  ConvolutionOperatorTester()
+    .input_size(13, 12)
+    .padding(1)
+    .kernel_size(3, 3)
+    .group_input_channels(37)
+    .group_output_channels(41)
+    .winograd(false)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(CONVOLUTION_OP_F32, setup_changing_size_and_batch_winograd) {
   ASSERT_EQ(xnn_status_success, xnn_initialize());
   ConvolutionOperatorTester()
-    .batch_size(3)
+    .batch_size(2)
     .input_height(9)
     .input_width(8)
-    .next_input_height(8)
-    .next_input_width(9)
+    .next_batch_size(3)
+    .next_input_height(12)
+    .next_input_width(13)
     .kernel_height(3)
     .kernel_width(3)
-    .groups(19)
-    .group_input_channels(1)
-    .group_output_channels(1)
+    .padding(1)
+    .group_input_channels(37)
+    .group_output_channels(41)
     .TestSetupF32();
 }
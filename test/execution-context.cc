@@ -0,0 +1,262 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <xnnpack.h>
+
+
+namespace {
+
+template<typename T>
+using SetupFunction = std::function<xnn_status(xnn_operator_t op, size_t batch_size, const T* input, T* output)>;
+
+// Runs one execution context per thread, each on its own input with its own batch size, and checks that all of them
+// produce the same outputs as sequential runs of the parent operator.
+template<typename T>
+void TestConcurrentExecutionContexts(
+    xnn_operator_t op,
+    size_t input_batch_elements,
+    size_t output_batch_elements,
+    SetupFunction<T> setup,
+    std::function<T()> rng)
+{
+  const size_t num_contexts = 4;
+  const size_t num_iterations = 3;
+
+  std::vector<std::vector<T>> inputs(num_contexts);
+  std::vector<std::vector<T>> outputs(num_contexts);
+  std::vector<std::vector<T>> outputs_ref(num_contexts);
+  for (size_t i = 0; i < num_contexts; i++) {
+    const size_t batch_size = i + 1;
+    inputs[i].resize(batch_size * input_batch_elements + XNN_EXTRA_BYTES / sizeof(T));
+    std::generate(inputs[i].begin(), inputs[i].end(), std::ref(rng));
+    outputs[i].resize(batch_size * output_batch_elements);
+    outputs_ref[i].resize(batch_size * output_batch_elements);
+
+    ASSERT_EQ(xnn_status_success, setup(op, batch_size, inputs[i].data(), outputs_ref[i].data()));
+    ASSERT_EQ(xnn_status_success, xnn_run_operator(op, nullptr /* thread pool */));
+  }
+
+  std::vector<xnn_operator_t> contexts(num_contexts, nullptr);
+  for (size_t i = 0; i < num_contexts; i++) {
+    // Create every other context from a context to check that contexts of contexts share the original operator state.
+    xnn_operator_t source = (i % 2 == 0) ? op : contexts[i - 1];
+    ASSERT_EQ(xnn_status_success, xnn_create_execution_context(source, &contexts[i]));
+    ASSERT_NE(nullptr, contexts[i]);
+  }
+
+  std::vector<xnn_status> status(num_contexts, xnn_status_success);
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < num_contexts; i++) {
+    threads.emplace_back([&, i]() {
+      for (size_t iteration = 0; iteration < num_iterations; iteration++) {
+        std::fill(outputs[i].begin(), outputs[i].end(), T(0));
+        status[i] = setup(contexts[i], i + 1, inputs[i].data(), outputs[i].data());
+        if (status[i] != xnn_status_success) {
+          return;
+        }
+        status[i] = xnn_run_operator(contexts[i], nullptr /* thread pool */);
+        if (status[i] != xnn_status_success) {
+          return;
+        }
+      }
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  for (size_t i = 0; i < num_contexts; i++) {
+    ASSERT_EQ(xnn_status_success, status[i]) << "context " << i;
+    for (size_t k = 0; k < outputs[i].size(); k++) {
+      ASSERT_EQ(outputs_ref[i][k], outputs[i][k]) << "context " << i << ", element " << k;
+    }
+  }
+
+  // Deleting contexts must not release the state of the parent operator.
+  for (xnn_operator_t context : contexts) {
+    ASSERT_EQ(xnn_status_success, xnn_delete_operator(context));
+  }
+  std::vector<T> output(output_batch_elements);
+  ASSERT_EQ(xnn_status_success, setup(op, 1, inputs[0].data(), output.data()));
+  ASSERT_EQ(xnn_status_success, xnn_run_operator(op, nullptr /* thread pool */));
+  for (size_t k = 0; k < output.size(); k++) {
+    ASSERT_EQ(outputs_ref[0][k], output[k]) << "element " << k;
+  }
+}
+
+std::function<float()> F32Rng() {
+  auto rng = std::mt19937(std::random_device()());
+  return std::bind(std::uniform_real_distribution<float>(-1.0f, 1.0f), rng);
+}
+
+std::vector<float> RandomVector(size_t size) {
+  auto f32rng = F32Rng();
+  std::vector<float> data(size);
+  std::generate(data.begin(), data.end(), std::ref(f32rng));
+  return data;
+}
+
+}  // namespace
+
+
+TEST(EXECUTION_CONTEXT, fully_connected_f32) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+
+  const size_t input_channels = 37;
+  const size_t output_channels = 19;
+  const std::vector<float> kernel = RandomVector(output_channels * input_channels);
+  const std::vector<float> bias = RandomVector(output_channels);
+
+  xnn_operator_t op = nullptr;
+  ASSERT_EQ(xnn_status_success,
+    xnn_create_fully_connected_nc_f32(
+      input_channels, output_channels, input_channels, output_channels,
+      kernel.data(), bias.data(), -std::numeric_limits<float>::infinity(), +std::numeric_limits<float>::infinity(),
+      0 /* flags */, &op));
+
+  TestConcurrentExecutionContexts<float>(op, input_channels, output_channels,
+    [](xnn_operator_t op, size_t batch_size, const float* input, float* output) {
+      return xnn_setup_fully_connected_nc_f32(op, batch_size, input, output, nullptr /* thread pool */);
+    },
+    F32Rng());
+
+  ASSERT_EQ(xnn_status_success, xnn_delete_operator(op));
+}
+
+TEST(EXECUTION_CONTEXT, convolution_nhwc_f32) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+
+  const size_t input_height = 11;
+  const size_t input_width = 9;
+  const size_t input_channels = 5;
+  const size_t output_channels = 13;
+  const std::vector<float> kernel = RandomVector(output_channels * 3 * 3 * input_channels);
+  const std::vector<float> bias = RandomVector(output_channels);
+
+  xnn_operator_t op = nullptr;
+  ASSERT_EQ(xnn_status_success,
+    xnn_create_convolution2d_nhwc_f32(
+      1, 1, 1, 1, 3, 3, 1, 1, 1, 1, 1 /* groups */, input_channels, output_channels,
+      input_channels, output_channels, kernel.data(), bias.data(),
+      -std::numeric_limits<float>::infinity(), +std::numeric_limits<float>::infinity(),
+      0 /* flags */, &op));
+
+  TestConcurrentExecutionContexts<float>(op,
+    input_height * input_width * input_channels, input_height * input_width * output_channels,
+    [=](xnn_operator_t op, size_t batch_size, const float* input, float* output) {
+      return xnn_setup_convolution2d_nhwc_f32(
+        op, batch_size, input_height, input_width, input, output, nullptr /* thread pool */);
+    },
+    F32Rng());
+
+  ASSERT_EQ(xnn_status_success, xnn_delete_operator(op));
+}
+
+TEST(EXECUTION_CONTEXT, depthwise_convolution_nhwc_f32) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+
+  const size_t input_height = 10;
+  const size_t input_width = 7;
+  const size_t channels = 24;
+  const std::vector<float> kernel = RandomVector(3 * 3 * channels);
+  const std::vector<float> bias = RandomVector(channels);
+
+  xnn_operator_t op = nullptr;
+  ASSERT_EQ(xnn_status_success,
+    xnn_create_convolution2d_nhwc_f32(
+      1, 1, 1, 1, 3, 3, 2, 2, 1, 1, channels /* groups */, 1, 1,
+      channels, channels, kernel.data(), bias.data(),
+      -std::numeric_limits<float>::infinity(), +std::numeric_limits<float>::infinity(),
+      XNN_FLAG_DEPTHWISE_CONVOLUTION, &op));
+
+  const size_t output_height = (input_height - 1) / 2 + 1;
+  const size_t output_width = (input_width - 1) / 2 + 1;
+  TestConcurrentExecutionContexts<float>(op,
+    input_height * input_width * channels, output_height * output_width * channels,
+    [=](xnn_operator_t op, size_t batch_size, const float* input, float* output) {
+      return xnn_setup_convolution2d_nhwc_f32(
+        op, batch_size, input_height, input_width, input, output, nullptr /* thread pool */);
+    },
+    F32Rng());
+
+  ASSERT_EQ(xnn_status_success, xnn_delete_operator(op));
+}
+
+TEST(EXECUTION_CONTEXT, deconvolution_nhwc_f32_with_subconvolutions) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+
+  const size_t input_height = 5;
+  const size_t input_width = 6;
+  const size_t input_channels = 7;
+  const size_t output_channels = 11;
+  const std::vector<float> kernel = RandomVector(output_channels * 4 * 4 * input_channels);
+  const std::vector<float> bias = RandomVector(output_channels);
+
+  xnn_operator_t op = nullptr;
+  ASSERT_EQ(xnn_status_success,
+    xnn_create_deconvolution2d_nhwc_f32(
+      1, 1, 1, 1, 0, 0, 4, 4, 2, 2, 1, 1, 1 /* groups */, input_channels, output_channels,
+      input_channels, output_channels, kernel.data(), bias.data(),
+      -std::numeric_limits<float>::infinity(), +std::numeric_limits<float>::infinity(),
+      0 /* flags */, &op));
+
+  const size_t output_height = (input_height - 1) * 2 + 4 - 2;
+  const size_t output_width = (input_width - 1) * 2 + 4 - 2;
+  TestConcurrentExecutionContexts<float>(op,
+    input_height * input_width * input_channels, output_height * output_width * output_channels,
+    [=](xnn_operator_t op, size_t batch_size, const float* input, float* output) {
+      return xnn_setup_deconvolution2d_nhwc_f32(
+        op, batch_size, input_height, input_width, input, output, nullptr /* thread pool */);
+    },
+    F32Rng());
+
+  ASSERT_EQ(xnn_status_success, xnn_delete_operator(op));
+}
+
+TEST(EXECUTION_CONTEXT, sigmoid_q8) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+
+  const size_t channels = 29;
+
+  xnn_operator_t op = nullptr;
+  ASSERT_EQ(xnn_status_success,
+    xnn_create_sigmoid_nc_q8(
+      channels, channels, channels, 128, 0.05f, 0, 1.0f / 256.0f, 0, 255, 0 /* flags */, &op));
+
+  auto u8rng = std::bind(std::uniform_int_distribution<uint8_t>(), std::mt19937(std::random_device()()));
+  TestConcurrentExecutionContexts<uint8_t>(op, channels, channels,
+    [](xnn_operator_t op, size_t batch_size, const uint8_t* input, uint8_t* output) {
+      return xnn_setup_sigmoid_nc_q8(op, batch_size, input, output, nullptr /* thread pool */);
+    },
+    u8rng);
+
+  ASSERT_EQ(xnn_status_success, xnn_delete_operator(op));
+}
+
+TEST(EXECUTION_CONTEXT, spnchw_unsupported) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+
+  xnn_operator_t op = nullptr;
+  ASSERT_EQ(xnn_status_success,
+    xnn_create_global_average_pooling_spnchw_f32(
+      8, -std::numeric_limits<float>::infinity(), +std::numeric_limits<float>::infinity(), 0 /* flags */, &op));
+
+  xnn_operator_t context = nullptr;
+  ASSERT_EQ(xnn_status_unsupported_parameter, xnn_create_execution_context(op, &context));
+  ASSERT_EQ(nullptr, context);
+
+  ASSERT_EQ(xnn_status_success, xnn_delete_operator(op));
+}
@@ -0,0 +1,231 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <gtest/gtest.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/isa-checks.h>
+
+#include <xnnpack/clamp.h>
+#include "clamp-microkernel-tester.h"
+
+
+#if XNN_ARCH_ARM64
+  TEST(F16_CLAMP__NEONFP16ARITH, n_eq_8) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    ClampMicrokernelTester()
+      .n(8)
+      .Test(xnn_f16_clamp_ukernel__neonfp16arith);
+  }
+
+  TEST(F16_CLAMP__NEONFP16ARITH, n_div_8) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t n = 16; n < 256; n += 8) {
+      ClampMicrokernelTester()
+        .n(n)
+        .Test(xnn_f16_clamp_ukernel__neonfp16arith);
+    }
+  }
+
+  TEST(F16_CLAMP__NEONFP16ARITH, n_gt_8) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t n = 9; n < 16; n++) {
+      ClampMicrokernelTester()
+        .n(n)
+        .Test(xnn_f16_clamp_ukernel__neonfp16arith);
+    }
+  }
+
+  TEST(F16_CLAMP__NEONFP16ARITH, n_lt_8) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t n = 1; n < 8; n++) {
+      ClampMicrokernelTester()
+        .n(n)
+        .Test(xnn_f16_clamp_ukernel__neonfp16arith);
+    }
+  }
+
+  TEST(F16_CLAMP__NEONFP16ARITH, inplace) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t n = 1; n < 64; n += 3) {
+      ClampMicrokernelTester()
+        .iterations(1)
+        .n(n)
+        .inplace(true)
+        .Test(xnn_f16_clamp_ukernel__neonfp16arith);
+    }
+  }
+
+  TEST(F16_CLAMP__NEONFP16ARITH, qmin) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t n = 1; n < 64; n += 5) {
+      for (uint8_t qmin = 1; qmin < 255; qmin++) {
+        ClampMicrokernelTester()
+          .iterations(1)
+          .n(n)
+          .qmin(qmin)
+          .qmax(255)
+          .Test(xnn_f16_clamp_ukernel__neonfp16arith);
+      }
+    }
+  }
+
+  TEST(F16_CLAMP__NEONFP16ARITH, qmax) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t n = 1; n < 64; n += 5) {
+      for (uint8_t qmax = 1; qmax < 255; qmax++) {
+        ClampMicrokernelTester()
+          .iterations(1)
+          .n(n)
+          .qmin(0)
+          .qmax(qmax)
+          .Test(xnn_f16_clamp_ukernel__neonfp16arith);
+      }
+    }
+  }
+#endif  // XNN_ARCH_ARM64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F16_CLAMP__F16C, n_eq_8) {
+    TEST_REQUIRES_X86_F16C;
+    ClampMicrokernelTester()
+      .n(8)
+      .Test(xnn_f16_clamp_ukernel__f16c);
+  }
+
+  TEST(F16_CLAMP__F16C, n_div_8) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t n = 16; n < 256; n += 8) {
+      ClampMicrokernelTester()
+        .n(n)
+        .Test(xnn_f16_clamp_ukernel__f16c);
+    }
+  }
+
+  TEST(F16_CLAMP__F16C, n_gt_8) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t n = 9; n < 16; n++) {
+      ClampMicrokernelTester()
+        .n(n)
+        .Test(xnn_f16_clamp_ukernel__f16c);
+    }
+  }
+
+  TEST(F16_CLAMP__F16C, n_lt_8) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t n = 1; n < 8; n++) {
+      ClampMicrokernelTester()
+        .n(n)
+        .Test(xnn_f16_clamp_ukernel__f16c);
+    }
+  }
+
+  TEST(F16_CLAMP__F16C, inplace) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t n = 1; n < 64; n += 3) {
+      ClampMicrokernelTester()
+        .iterations(1)
+        .n(n)
+        .inplace(true)
+        .Test(xnn_f16_clamp_ukernel__f16c);
+    }
+  }
+
+  TEST(F16_CLAMP__F16C, qmin) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t n = 1; n < 64; n += 5) {
+      for (uint8_t qmin = 1; qmin < 255; qmin++) {
+        ClampMicrokernelTester()
+          .iterations(1)
+          .n(n)
+          .qmin(qmin)
+          .qmax(255)
+          .Test(xnn_f16_clamp_ukernel__f16c);
+      }
+    }
+  }
+
+  TEST(F16_CLAMP__F16C, qmax) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t n = 1; n < 64; n += 5) {
+      for (uint8_t qmax = 1; qmax < 255; qmax++) {
+        ClampMicrokernelTester()
+          .iterations(1)
+          .n(n)
+          .qmin(0)
+          .qmax(qmax)
+          .Test(xnn_f16_clamp_ukernel__f16c);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+TEST(F16_CLAMP__SCALAR, n_eq_2) {
+  ClampMicrokernelTester()
+    .n(2)
+    .Test(xnn_f16_clamp_ukernel__scalar, ClampMicrokernelTester::Variant::Scalar);
+}
+
+TEST(F16_CLAMP__SCALAR, n_div_2) {
+  for (size_t n = 4; n < 128; n += 2) {
+    ClampMicrokernelTester()
+      .n(n)
+      .Test(xnn_f16_clamp_ukernel__scalar, ClampMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F16_CLAMP__SCALAR, n_gt_2) {
+  for (size_t n = 3; n < 4; n++) {
+    ClampMicrokernelTester()
+      .n(n)
+      .Test(xnn_f16_clamp_ukernel__scalar, ClampMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F16_CLAMP__SCALAR, n_lt_2) {
+  for (size_t n = 1; n < 2; n++) {
+    ClampMicrokernelTester()
+      .n(n)
+      .Test(xnn_f16_clamp_ukernel__scalar, ClampMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F16_CLAMP__SCALAR, inplace) {
+  for (size_t n = 1; n < 32; n += 3) {
+    ClampMicrokernelTester()
+      .iterations(1)
+      .n(n)
+      .inplace(true)
+      .Test(xnn_f16_clamp_ukernel__scalar, ClampMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F16_CLAMP__SCALAR, qmin) {
+  for (size_t n = 1; n < 32; n += 3) {
+    for (uint8_t qmin = 1; qmin < 255; qmin++) {
+      ClampMicrokernelTester()
+        .iterations(1)
+        .n(n)
+        .qmin(qmin)
+        .qmax(255)
+        .Test(xnn_f16_clamp_ukernel__scalar, ClampMicrokernelTester::Variant::Scalar);
+    }
+  }
+}
+
+TEST(F16_CLAMP__SCALAR, qmax) {
+  for (size_t n = 1; n < 32; n += 3) {
+    for (uint8_t qmax = 1; qmax < 255; qmax++) {
+      ClampMicrokernelTester()
+        .iterations(1)
+        .n(n)
+        .qmin(0)
+        .qmax(qmax)
+        .Test(xnn_f16_clamp_ukernel__scalar, ClampMicrokernelTester::Variant::Scalar);
+    }
+  }
+}
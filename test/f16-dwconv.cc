@@ -0,0 +1,440 @@
+// Copyright (c) Facebook, Inc. and its affiliates.
+// All rights reserved.
+//
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+//
+// Auto-generated file. Do not edit!
+//   Specification: test/f16-dwconv.yaml
+//   Generator: tools/generate-dwconv-test.py
+
+
+#include <gtest/gtest.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/isa-checks.h>
+
+#include <xnnpack/dwconv.h>
+#include "dwconv-microkernel-tester.h"
+
+
+#if XNN_ARCH_ARM64
+  TEST(F16_DWCONV_UP8X9__NEONFP16ARITH, c_eq_8) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    DWConvMicrokernelTester()
+      .cr(8)
+      .kr(9)
+      .channels(8)
+      .Test(xnn_f16_dwconv_ukernel_up8x9__neonfp16arith);
+  }
+
+  TEST(F16_DWCONV_UP8X9__NEONFP16ARITH, c_div_8) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (uint32_t channels = 16; channels < 128; channels += 24) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(channels)
+        .Test(xnn_f16_dwconv_ukernel_up8x9__neonfp16arith);
+    }
+  }
+
+  TEST(F16_DWCONV_UP8X9__NEONFP16ARITH, c_div_8_with_qmin) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (uint32_t channels = 16; channels < 128; channels += 24) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(channels)
+        .qmin(128)
+        .Test(xnn_f16_dwconv_ukernel_up8x9__neonfp16arith);
+    }
+  }
+
+  TEST(F16_DWCONV_UP8X9__NEONFP16ARITH, c_div_8_with_qmax) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (uint32_t channels = 16; channels < 128; channels += 24) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(channels)
+        .qmax(128)
+        .Test(xnn_f16_dwconv_ukernel_up8x9__neonfp16arith);
+    }
+  }
+
+  TEST(F16_DWCONV_UP8X9__NEONFP16ARITH, c_lt_8) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (uint32_t channels = 1; channels < 8; channels++) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(channels)
+        .Test(xnn_f16_dwconv_ukernel_up8x9__neonfp16arith);
+    }
+  }
+
+  TEST(F16_DWCONV_UP8X9__NEONFP16ARITH, c_gt_8) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (uint32_t channels = 9; channels < 16; channels++) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(channels)
+        .Test(xnn_f16_dwconv_ukernel_up8x9__neonfp16arith);
+    }
+  }
+
+  TEST(F16_DWCONV_UP8X9__NEONFP16ARITH, c_gt_8_with_qmin) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (uint32_t channels = 9; channels < 16; channels++) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(channels)
+        .qmin(128)
+        .Test(xnn_f16_dwconv_ukernel_up8x9__neonfp16arith);
+    }
+  }
+
+  TEST(F16_DWCONV_UP8X9__NEONFP16ARITH, c_gt_8_with_qmax) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (uint32_t channels = 9; channels < 16; channels++) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(channels)
+        .qmax(128)
+        .Test(xnn_f16_dwconv_ukernel_up8x9__neonfp16arith);
+    }
+  }
+
+  TEST(F16_DWCONV_UP8X9__NEONFP16ARITH, multipixel) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(channels)
+        .width(3)
+        .Test(xnn_f16_dwconv_ukernel_up8x9__neonfp16arith);
+    }
+  }
+
+  TEST(F16_DWCONV_UP8X9__NEONFP16ARITH, multipixel_with_step) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      for (size_t step = 2; step <= 9; step++) {
+        DWConvMicrokernelTester()
+          .cr(8)
+          .kr(9)
+          .channels(channels)
+          .width(3)
+          .step(step)
+          .Test(xnn_f16_dwconv_ukernel_up8x9__neonfp16arith);
+      }
+    }
+  }
+
+  TEST(F16_DWCONV_UP8X9__NEONFP16ARITH, multipixel_with_output_stride) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(8)
+        .width(5)
+        .output_stride(43)
+        .Test(xnn_f16_dwconv_ukernel_up8x9__neonfp16arith);
+    }
+  }
+
+  TEST(F16_DWCONV_UP8X9__NEONFP16ARITH, multipixel_with_qmin) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(channels)
+        .width(3)
+        .qmin(128)
+        .Test(xnn_f16_dwconv_ukernel_up8x9__neonfp16arith);
+    }
+  }
+
+  TEST(F16_DWCONV_UP8X9__NEONFP16ARITH, multipixel_with_qmax) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(channels)
+        .width(3)
+        .qmax(128)
+        .Test(xnn_f16_dwconv_ukernel_up8x9__neonfp16arith);
+    }
+  }
+#endif  // XNN_ARCH_ARM64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F16_DWCONV_UP8X9__F16C, c_eq_8) {
+    TEST_REQUIRES_X86_F16C;
+    DWConvMicrokernelTester()
+      .cr(8)
+      .kr(9)
+      .channels(8)
+      .Test(xnn_f16_dwconv_ukernel_up8x9__f16c);
+  }
+
+  TEST(F16_DWCONV_UP8X9__F16C, c_div_8) {
+    TEST_REQUIRES_X86_F16C;
+    for (uint32_t channels = 16; channels < 128; channels += 24) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(channels)
+        .Test(xnn_f16_dwconv_ukernel_up8x9__f16c);
+    }
+  }
+
+  TEST(F16_DWCONV_UP8X9__F16C, c_div_8_with_qmin) {
+    TEST_REQUIRES_X86_F16C;
+    for (uint32_t channels = 16; channels < 128; channels += 24) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(channels)
+        .qmin(128)
+        .Test(xnn_f16_dwconv_ukernel_up8x9__f16c);
+    }
+  }
+
+  TEST(F16_DWCONV_UP8X9__F16C, c_div_8_with_qmax) {
+    TEST_REQUIRES_X86_F16C;
+    for (uint32_t channels = 16; channels < 128; channels += 24) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(channels)
+        .qmax(128)
+        .Test(xnn_f16_dwconv_ukernel_up8x9__f16c);
+    }
+  }
+
+  TEST(F16_DWCONV_UP8X9__F16C, c_lt_8) {
+    TEST_REQUIRES_X86_F16C;
+    for (uint32_t channels = 1; channels < 8; channels++) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(channels)
+        .Test(xnn_f16_dwconv_ukernel_up8x9__f16c);
+    }
+  }
+
+  TEST(F16_DWCONV_UP8X9__F16C, c_gt_8) {
+    TEST_REQUIRES_X86_F16C;
+    for (uint32_t channels = 9; channels < 16; channels++) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(channels)
+        .Test(xnn_f16_dwconv_ukernel_up8x9__f16c);
+    }
+  }
+
+  TEST(F16_DWCONV_UP8X9__F16C, c_gt_8_with_qmin) {
+    TEST_REQUIRES_X86_F16C;
+    for (uint32_t channels = 9; channels < 16; channels++) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(channels)
+        .qmin(128)
+        .Test(xnn_f16_dwconv_ukernel_up8x9__f16c);
+    }
+  }
+
+  TEST(F16_DWCONV_UP8X9__F16C, c_gt_8_with_qmax) {
+    TEST_REQUIRES_X86_F16C;
+    for (uint32_t channels = 9; channels < 16; channels++) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(channels)
+        .qmax(128)
+        .Test(xnn_f16_dwconv_ukernel_up8x9__f16c);
+    }
+  }
+
+  TEST(F16_DWCONV_UP8X9__F16C, multipixel) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(channels)
+        .width(3)
+        .Test(xnn_f16_dwconv_ukernel_up8x9__f16c);
+    }
+  }
+
+  TEST(F16_DWCONV_UP8X9__F16C, multipixel_with_step) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      for (size_t step = 2; step <= 9; step++) {
+        DWConvMicrokernelTester()
+          .cr(8)
+          .kr(9)
+          .channels(channels)
+          .width(3)
+          .step(step)
+          .Test(xnn_f16_dwconv_ukernel_up8x9__f16c);
+      }
+    }
+  }
+
+  TEST(F16_DWCONV_UP8X9__F16C, multipixel_with_output_stride) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(8)
+        .width(5)
+        .output_stride(43)
+        .Test(xnn_f16_dwconv_ukernel_up8x9__f16c);
+    }
+  }
+
+  TEST(F16_DWCONV_UP8X9__F16C, multipixel_with_qmin) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(channels)
+        .width(3)
+        .qmin(128)
+        .Test(xnn_f16_dwconv_ukernel_up8x9__f16c);
+    }
+  }
+
+  TEST(F16_DWCONV_UP8X9__F16C, multipixel_with_qmax) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(channels)
+        .width(3)
+        .qmax(128)
+        .Test(xnn_f16_dwconv_ukernel_up8x9__f16c);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+TEST(F16_DWCONV_UP1X9__SCALAR, c_eq_1) {
+  DWConvMicrokernelTester()
+    .cr(1)
+    .kr(9)
+    .channels(1)
+    .Test(xnn_f16_dwconv_ukernel_up1x9__scalar, DWConvMicrokernelTester::Variant::Scalar);
+}
+
+TEST(F16_DWCONV_UP1X9__SCALAR, c_gt_1) {
+  for (uint32_t channels = 2; channels < 10; channels++) {
+    DWConvMicrokernelTester()
+      .cr(1)
+      .kr(9)
+      .channels(channels)
+      .Test(xnn_f16_dwconv_ukernel_up1x9__scalar, DWConvMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F16_DWCONV_UP1X9__SCALAR, c_gt_1_with_qmin) {
+  for (uint32_t channels = 2; channels < 10; channels++) {
+    DWConvMicrokernelTester()
+      .cr(1)
+      .kr(9)
+      .channels(channels)
+      .qmin(128)
+      .Test(xnn_f16_dwconv_ukernel_up1x9__scalar, DWConvMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F16_DWCONV_UP1X9__SCALAR, c_gt_1_with_qmax) {
+  for (uint32_t channels = 2; channels < 10; channels++) {
+    DWConvMicrokernelTester()
+      .cr(1)
+      .kr(9)
+      .channels(channels)
+      .qmax(128)
+      .Test(xnn_f16_dwconv_ukernel_up1x9__scalar, DWConvMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F16_DWCONV_UP1X9__SCALAR, multipixel) {
+  for (size_t channels = 1; channels <= 5; channels += 1) {
+    DWConvMicrokernelTester()
+      .cr(1)
+      .kr(9)
+      .channels(channels)
+      .width(3)
+      .Test(xnn_f16_dwconv_ukernel_up1x9__scalar, DWConvMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F16_DWCONV_UP1X9__SCALAR, multipixel_with_step) {
+  for (size_t channels = 1; channels <= 5; channels += 1) {
+    for (size_t step = 2; step <= 9; step++) {
+      DWConvMicrokernelTester()
+        .cr(1)
+        .kr(9)
+        .channels(channels)
+        .width(3)
+        .step(step)
+        .Test(xnn_f16_dwconv_ukernel_up1x9__scalar, DWConvMicrokernelTester::Variant::Scalar);
+    }
+  }
+}
+
+TEST(F16_DWCONV_UP1X9__SCALAR, multipixel_with_output_stride) {
+  for (size_t channels = 1; channels <= 5; channels += 1) {
+    DWConvMicrokernelTester()
+      .cr(1)
+      .kr(9)
+      .channels(1)
+      .width(5)
+      .output_stride(7)
+      .Test(xnn_f16_dwconv_ukernel_up1x9__scalar, DWConvMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F16_DWCONV_UP1X9__SCALAR, multipixel_with_qmin) {
+  for (size_t channels = 1; channels <= 5; channels += 1) {
+    DWConvMicrokernelTester()
+      .cr(1)
+      .kr(9)
+      .channels(channels)
+      .width(3)
+      .qmin(128)
+      .Test(xnn_f16_dwconv_ukernel_up1x9__scalar, DWConvMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F16_DWCONV_UP1X9__SCALAR, multipixel_with_qmax) {
+  for (size_t channels = 1; channels <= 5; channels += 1) {
+    DWConvMicrokernelTester()
+      .cr(1)
+      .kr(9)
+      .channels(channels)
+      .width(3)
+      .qmax(128)
+      .Test(xnn_f16_dwconv_ukernel_up1x9__scalar, DWConvMicrokernelTester::Variant::Scalar);
+  }
+}
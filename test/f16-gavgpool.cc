@@ -0,0 +1,1062 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <gtest/gtest.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/isa-checks.h>
+
+#include <xnnpack/gavgpool.h>
+#include "gavgpool-microkernel-tester.h"
+
+
+#if XNN_ARCH_ARM64
+  TEST(F16_GAVGPOOL_UP7__NEONFP16ARITH, n_eq_8_fulltile) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    GAvgPoolMicrokernelTester()
+      .m(7)
+      .n(8)
+      .Test(xnn_f16_gavgpool_ukernel_up7__neonfp16arith);
+  }
+
+  TEST(F16_GAVGPOOL_UP7__NEONFP16ARITH, n_eq_8_subtile) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t m = 1; m < 7; m++) {
+      GAvgPoolMicrokernelTester()
+        .m(m)
+        .n(8)
+        .Test(xnn_f16_gavgpool_ukernel_up7__neonfp16arith);
+    }
+  }
+
+  TEST(F16_GAVGPOOL_UP7__NEONFP16ARITH, n_eq_8_fulltile_with_x_stride) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    GAvgPoolMicrokernelTester()
+      .m(7)
+      .n(8)
+      .x_stride(11)
+      .Test(xnn_f16_gavgpool_ukernel_up7__neonfp16arith);
+  }
+
+  TEST(F16_GAVGPOOL_UP7__NEONFP16ARITH, n_eq_8_fulltile_with_qmax) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    GAvgPoolMicrokernelTester()
+      .m(7)
+      .n(8)
+      .qmax(128)
+      .Test(xnn_f16_gavgpool_ukernel_up7__neonfp16arith);
+  }
+
+  TEST(F16_GAVGPOOL_UP7__NEONFP16ARITH, n_eq_8_fulltile_with_qmin) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    GAvgPoolMicrokernelTester()
+      .m(7)
+      .n(8)
+      .qmin(128)
+      .Test(xnn_f16_gavgpool_ukernel_up7__neonfp16arith);
+  }
+
+  TEST(F16_GAVGPOOL_UP7__NEONFP16ARITH, n_div_8_fulltile) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t n = 16; n < 128; n += 24) {
+      GAvgPoolMicrokernelTester()
+        .m(7)
+        .n(n)
+        .Test(xnn_f16_gavgpool_ukernel_up7__neonfp16arith);
+    }
+  }
+
+  TEST(F16_GAVGPOOL_UP7__NEONFP16ARITH, n_div_8_subtile) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t n = 16; n < 128; n += 24) {
+      for (size_t m = 1; m < 7; m++) {
+        GAvgPoolMicrokernelTester()
+          .m(m)
+          .n(n)
+          .Test(xnn_f16_gavgpool_ukernel_up7__neonfp16arith);
+      }
+    }
+  }
+
+  TEST(F16_GAVGPOOL_UP7__NEONFP16ARITH, n_lt_8_fulltile) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t n = 1; n < 8; n++) {
+      GAvgPoolMicrokernelTester()
+        .m(7)
+        .n(n)
+        .Test(xnn_f16_gavgpool_ukernel_up7__neonfp16arith);
+    }
+  }
+
+  TEST(F16_GAVGPOOL_UP7__NEONFP16ARITH, n_lt_8_subtile) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t n = 1; n < 8; n++) {
+      for (size_t m = 1; m < 7; m++) {
+        GAvgPoolMicrokernelTester()
+          .m(m)
+          .n(n)
+          .Test(xnn_f16_gavgpool_ukernel_up7__neonfp16arith);
+      }
+    }
+  }
+
+  TEST(F16_GAVGPOOL_UP7__NEONFP16ARITH, n_lt_8_fulltile_with_qmax) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t n = 1; n < 8; n++) {
+      GAvgPoolMicrokernelTester()
+        .m(7)
+        .n(n)
+        .qmax(128)
+        .Test(xnn_f16_gavgpool_ukernel_up7__neonfp16arith);
+    }
+  }
+
+  TEST(F16_GAVGPOOL_UP7__NEONFP16ARITH, n_lt_8_fulltile_with_qmin) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t n = 1; n < 8; n++) {
+      GAvgPoolMicrokernelTester()
+        .m(7)
+        .n(n)
+        .qmin(128)
+        .Test(xnn_f16_gavgpool_ukernel_up7__neonfp16arith);
+    }
+  }
+
+  TEST(F16_GAVGPOOL_UP7__NEONFP16ARITH, n_gt_8_fulltile) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t n = 9; n < 16; n++) {
+      GAvgPoolMicrokernelTester()
+        .m(7)
+        .n(n)
+        .Test(xnn_f16_gavgpool_ukernel_up7__neonfp16arith);
+    }
+  }
+
+  TEST(F16_GAVGPOOL_UP7__NEONFP16ARITH, n_gt_8_subtile) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t n = 9; n < 16; n++) {
+      for (size_t m = 1; m < 7; m++) {
+        GAvgPoolMicrokernelTester()
+          .m(m)
+          .n(n)
+          .Test(xnn_f16_gavgpool_ukernel_up7__neonfp16arith);
+      }
+    }
+  }
+
+  TEST(F16_GAVGPOOL_UP7__NEONFP16ARITH, n_gt_8_fulltile_with_qmax) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t n = 9; n < 16; n++) {
+      GAvgPoolMicrokernelTester()
+        .m(7)
+        .n(n)
+        .qmax(128)
+        .Test(xnn_f16_gavgpool_ukernel_up7__neonfp16arith);
+    }
+  }
+
+  TEST(F16_GAVGPOOL_UP7__NEONFP16ARITH, n_gt_8_fulltile_with_qmin) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t n = 9; n < 16; n++) {
+      GAvgPoolMicrokernelTester()
+        .m(7)
+        .n(n)
+        .qmin(128)
+        .Test(xnn_f16_gavgpool_ukernel_up7__neonfp16arith);
+    }
+  }
+
+  TEST(F16_GAVGPOOL_MP7p7q__NEONFP16ARITH, n_eq_8_2pass_fulltile) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    GAvgPoolMicrokernelTester()
+      .m(14)
+      .n(8)
+      .Test(xnn_f16_gavgpool_ukernel_mp7p7q__neonfp16arith);
+  }
+
+  TEST(F16_GAVGPOOL_MP7p7q__NEONFP16ARITH, n_eq_8_2pass_fulltile_with_x_stride) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    GAvgPoolMicrokernelTester()
+      .m(14)
+      .n(8)
+      .x_stride(11)
+      .Test(xnn_f16_gavgpool_ukernel_mp7p7q__neonfp16arith);
+  }
+
+  TEST(F16_GAVGPOOL_MP7p7q__NEONFP16ARITH, n_eq_8_2pass_fulltile_with_qmax) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    GAvgPoolMicrokernelTester()
+      .m(14)
+      .n(8)
+      .qmax(128)
+      .Test(xnn_f16_gavgpool_ukernel_mp7p7q__neonfp16arith);
+  }
+
+  TEST(F16_GAVGPOOL_MP7p7q__NEONFP16ARITH, n_eq_8_2pass_fulltile_with_qmin) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    GAvgPoolMicrokernelTester()
+      .m(14)
+      .n(8)
+      .qmin(128)
+      .Test(xnn_f16_gavgpool_ukernel_mp7p7q__neonfp16arith);
+  }
+
+  TEST(F16_GAVGPOOL_MP7p7q__NEONFP16ARITH, n_eq_8_2pass_subtile) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t m = 1; m < 7; m++) {
+      GAvgPoolMicrokernelTester()
+        .m(7 + m)
+        .n(8)
+        .Test(xnn_f16_gavgpool_ukernel_mp7p7q__neonfp16arith);
+    }
+  }
+
+  TEST(F16_GAVGPOOL_MP7p7q__NEONFP16ARITH, n_eq_8_2pass_subtile_with_x_stride) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t m = 1; m < 7; m++) {
+      GAvgPoolMicrokernelTester()
+        .m(7 + m)
+        .n(8)
+        .x_stride(11)
+        .Test(xnn_f16_gavgpool_ukernel_mp7p7q__neonfp16arith);
+    }
+  }
+
+  TEST(F16_GAVGPOOL_MP7p7q__NEONFP16ARITH, n_eq_8_multipass_fulltile) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t m = 14; m <= 35; m += 7) {
+      GAvgPoolMicrokernelTester()
+        .m(m)
+        .n(8)
+        .Test(xnn_f16_gavgpool_ukernel_mp7p7q__neonfp16arith);
+    }
+  }
+
+  TEST(F16_GAVGPOOL_MP7p7q__NEONFP16ARITH, n_eq_8_multipass_fulltile_with_x_stride) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t m = 14; m <= 35; m += 7) {
+      GAvgPoolMicrokernelTester()
+        .m(m)
+        .n(8)
+        .Test(xnn_f16_gavgpool_ukernel_mp7p7q__neonfp16arith);
+    }
+  }
+
+  TEST(F16_GAVGPOOL_MP7p7q__NEONFP16ARITH, n_div_8_2pass_fulltile) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t n = 16; n < 128; n += 24) {
+      GAvgPoolMicrokernelTester()
+        .m(14)
+        .n(n)
+        .Test(xnn_f16_gavgpool_ukernel_mp7p7q__neonfp16arith);
+    }
+  }
+
+  TEST(F16_GAVGPOOL_MP7p7q__NEONFP16ARITH, n_div_8_2pass_subtile) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t n = 16; n < 128; n += 24) {
+      for (size_t m = 1; m < 7; m++) {
+        GAvgPoolMicrokernelTester()
+          .m(7 + m)
+          .n(n)
+          .Test(xnn_f16_gavgpool_ukernel_mp7p7q__neonfp16arith);
+      }
+    }
+  }
+
+  TEST(F16_GAVGPOOL_MP7p7q__NEONFP16ARITH, n_div_8_multipass_fulltile) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t n = 16; n < 128; n += 24) {
+      for (size_t m = 14; m <= 35; m += 7) {
+        GAvgPoolMicrokernelTester()
+          .m(m)
+          .n(n)
+          .Test(xnn_f16_gavgpool_ukernel_mp7p7q__neonfp16arith);
+      }
+    }
+  }
+
+  TEST(F16_GAVGPOOL_MP7p7q__NEONFP16ARITH, n_div_8_multipass_fulltile_with_x_stride) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t n = 16; n < 128; n += 24) {
+      for (size_t m = 14; m <= 35; m += 7) {
+        GAvgPoolMicrokernelTester()
+          .m(m)
+          .n(n)
+          .x_stride(131)
+          .Test(xnn_f16_gavgpool_ukernel_mp7p7q__neonfp16arith);
+      }
+    }
+  }
+
+  TEST(F16_GAVGPOOL_MP7p7q__NEONFP16ARITH, n_lt_8_2pass_fulltile) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t n = 1; n < 8; n++) {
+      GAvgPoolMicrokernelTester()
+        .m(14)
+        .n(n)
+        .Test(xnn_f16_gavgpool_ukernel_mp7p7q__neonfp16arith);
+    }
+  }
+
+  TEST(F16_GAVGPOOL_MP7p7q__NEONFP16ARITH, n_lt_8_2pass_fulltile_with_qmax) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t n = 1; n < 8; n++) {
+      GAvgPoolMicrokernelTester()
+        .m(14)
+        .n(n)
+        .qmax(128)
+        .Test(xnn_f16_gavgpool_ukernel_mp7p7q__neonfp16arith);
+    }
+  }
+
+  TEST(F16_GAVGPOOL_MP7p7q__NEONFP16ARITH, n_lt_8_2pass_fulltile_with_qmin) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t n = 1; n < 8; n++) {
+      GAvgPoolMicrokernelTester()
+        .m(14)
+        .n(n)
+        .qmin(128)
+        .Test(xnn_f16_gavgpool_ukernel_mp7p7q__neonfp16arith);
+    }
+  }
+
+  TEST(F16_GAVGPOOL_MP7p7q__NEONFP16ARITH, n_lt_8_2pass_subtile) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t n = 1; n < 8; n++) {
+      for (size_t m = 1; m < 7; m++) {
+        GAvgPoolMicrokernelTester()
+          .m(7 + m)
+          .n(n)
+          .Test(xnn_f16_gavgpool_ukernel_mp7p7q__neonfp16arith);
+      }
+    }
+  }
+
+  TEST(F16_GAVGPOOL_MP7p7q__NEONFP16ARITH, n_lt_8_multipass_fulltile) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t n = 1; n < 8; n++) {
+      for (size_t m = 14; m <= 35; m += 7) {
+        GAvgPoolMicrokernelTester()
+          .m(m)
+          .n(n)
+          .Test(xnn_f16_gavgpool_ukernel_mp7p7q__neonfp16arith);
+      }
+    }
+  }
+
+  TEST(F16_GAVGPOOL_MP7p7q__NEONFP16ARITH, n_lt_8_multipass_fulltile_with_x_stride) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t n = 1; n < 8; n++) {
+      for (size_t m = 14; m <= 35; m += 7) {
+        GAvgPoolMicrokernelTester()
+          .m(m)
+          .n(n)
+          .x_stride(23)
+          .Test(xnn_f16_gavgpool_ukernel_mp7p7q__neonfp16arith);
+      }
+    }
+  }
+
+  TEST(F16_GAVGPOOL_MP7p7q__NEONFP16ARITH, n_gt_8_2pass_fulltile) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t n = 9; n < 16; n++) {
+      GAvgPoolMicrokernelTester()
+        .m(14)
+        .n(n)
+        .Test(xnn_f16_gavgpool_ukernel_mp7p7q__neonfp16arith);
+    }
+  }
+
+  TEST(F16_GAVGPOOL_MP7p7q__NEONFP16ARITH, n_gt_8_2pass_fulltile_with_qmax) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t n = 9; n < 16; n++) {
+      GAvgPoolMicrokernelTester()
+        .m(14)
+        .n(n)
+        .qmax(128)
+        .Test(xnn_f16_gavgpool_ukernel_mp7p7q__neonfp16arith);
+    }
+  }
+
+  TEST(F16_GAVGPOOL_MP7p7q__NEONFP16ARITH, n_gt_8_2pass_fulltile_with_qmin) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t n = 9; n < 16; n++) {
+      GAvgPoolMicrokernelTester()
+        .m(14)
+        .n(n)
+        .qmin(128)
+        .Test(xnn_f16_gavgpool_ukernel_mp7p7q__neonfp16arith);
+    }
+  }
+
+  TEST(F16_GAVGPOOL_MP7p7q__NEONFP16ARITH, n_gt_8_2pass_subtile) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t n = 9; n < 16; n++) {
+      for (size_t m = 1; m < 7; m++) {
+        GAvgPoolMicrokernelTester()
+          .m(7 + m)
+          .n(n)
+          .Test(xnn_f16_gavgpool_ukernel_mp7p7q__neonfp16arith);
+      }
+    }
+  }
+
+  TEST(F16_GAVGPOOL_MP7p7q__NEONFP16ARITH, n_gt_8_multipass_fulltile) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t n = 9; n < 16; n++) {
+      for (size_t m = 14; m <= 35; m += 7) {
+        GAvgPoolMicrokernelTester()
+          .m(m)
+          .n(n)
+          .Test(xnn_f16_gavgpool_ukernel_mp7p7q__neonfp16arith);
+      }
+    }
+  }
+
+  TEST(F16_GAVGPOOL_MP7p7q__NEONFP16ARITH, n_gt_8_multipass_fulltile_with_x_stride) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t n = 9; n < 16; n++) {
+      for (size_t m = 14; m <= 35; m += 7) {
+        GAvgPoolMicrokernelTester()
+          .m(m)
+          .n(n)
+          .x_stride(23)
+          .Test(xnn_f16_gavgpool_ukernel_mp7p7q__neonfp16arith);
+      }
+    }
+  }
+#endif  // XNN_ARCH_ARM64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F16_GAVGPOOL_UP7__F16C, n_eq_8_fulltile) {
+    TEST_REQUIRES_X86_F16C;
+    GAvgPoolMicrokernelTester()
+      .m(7)
+      .n(8)
+      .Test(xnn_f16_gavgpool_ukernel_up7__f16c);
+  }
+
+  TEST(F16_GAVGPOOL_UP7__F16C, n_eq_8_subtile) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t m = 1; m < 7; m++) {
+      GAvgPoolMicrokernelTester()
+        .m(m)
+        .n(8)
+        .Test(xnn_f16_gavgpool_ukernel_up7__f16c);
+    }
+  }
+
+  TEST(F16_GAVGPOOL_UP7__F16C, n_eq_8_fulltile_with_x_stride) {
+    TEST_REQUIRES_X86_F16C;
+    GAvgPoolMicrokernelTester()
+      .m(7)
+      .n(8)
+      .x_stride(11)
+      .Test(xnn_f16_gavgpool_ukernel_up7__f16c);
+  }
+
+  TEST(F16_GAVGPOOL_UP7__F16C, n_eq_8_fulltile_with_qmax) {
+    TEST_REQUIRES_X86_F16C;
+    GAvgPoolMicrokernelTester()
+      .m(7)
+      .n(8)
+      .qmax(128)
+      .Test(xnn_f16_gavgpool_ukernel_up7__f16c);
+  }
+
+  TEST(F16_GAVGPOOL_UP7__F16C, n_eq_8_fulltile_with_qmin) {
+    TEST_REQUIRES_X86_F16C;
+    GAvgPoolMicrokernelTester()
+      .m(7)
+      .n(8)
+      .qmin(128)
+      .Test(xnn_f16_gavgpool_ukernel_up7__f16c);
+  }
+
+  TEST(F16_GAVGPOOL_UP7__F16C, n_div_8_fulltile) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t n = 16; n < 128; n += 24) {
+      GAvgPoolMicrokernelTester()
+        .m(7)
+        .n(n)
+        .Test(xnn_f16_gavgpool_ukernel_up7__f16c);
+    }
+  }
+
+  TEST(F16_GAVGPOOL_UP7__F16C, n_div_8_subtile) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t n = 16; n < 128; n += 24) {
+      for (size_t m = 1; m < 7; m++) {
+        GAvgPoolMicrokernelTester()
+          .m(m)
+          .n(n)
+          .Test(xnn_f16_gavgpool_ukernel_up7__f16c);
+      }
+    }
+  }
+
+  TEST(F16_GAVGPOOL_UP7__F16C, n_lt_8_fulltile) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t n = 1; n < 8; n++) {
+      GAvgPoolMicrokernelTester()
+        .m(7)
+        .n(n)
+        .Test(xnn_f16_gavgpool_ukernel_up7__f16c);
+    }
+  }
+
+  TEST(F16_GAVGPOOL_UP7__F16C, n_lt_8_subtile) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t n = 1; n < 8; n++) {
+      for (size_t m = 1; m < 7; m++) {
+        GAvgPoolMicrokernelTester()
+          .m(m)
+          .n(n)
+          .Test(xnn_f16_gavgpool_ukernel_up7__f16c);
+      }
+    }
+  }
+
+  TEST(F16_GAVGPOOL_UP7__F16C, n_lt_8_fulltile_with_qmax) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t n = 1; n < 8; n++) {
+      GAvgPoolMicrokernelTester()
+        .m(7)
+        .n(n)
+        .qmax(128)
+        .Test(xnn_f16_gavgpool_ukernel_up7__f16c);
+    }
+  }
+
+  TEST(F16_GAVGPOOL_UP7__F16C, n_lt_8_fulltile_with_qmin) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t n = 1; n < 8; n++) {
+      GAvgPoolMicrokernelTester()
+        .m(7)
+        .n(n)
+        .qmin(128)
+        .Test(xnn_f16_gavgpool_ukernel_up7__f16c);
+    }
+  }
+
+  TEST(F16_GAVGPOOL_UP7__F16C, n_gt_8_fulltile) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t n = 9; n < 16; n++) {
+      GAvgPoolMicrokernelTester()
+        .m(7)
+        .n(n)
+        .Test(xnn_f16_gavgpool_ukernel_up7__f16c);
+    }
+  }
+
+  TEST(F16_GAVGPOOL_UP7__F16C, n_gt_8_subtile) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t n = 9; n < 16; n++) {
+      for (size_t m = 1; m < 7; m++) {
+        GAvgPoolMicrokernelTester()
+          .m(m)
+          .n(n)
+          .Test(xnn_f16_gavgpool_ukernel_up7__f16c);
+      }
+    }
+  }
+
+  TEST(F16_GAVGPOOL_UP7__F16C, n_gt_8_fulltile_with_qmax) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t n = 9; n < 16; n++) {
+      GAvgPoolMicrokernelTester()
+        .m(7)
+        .n(n)
+        .qmax(128)
+        .Test(xnn_f16_gavgpool_ukernel_up7__f16c);
+    }
+  }
+
+  TEST(F16_GAVGPOOL_UP7__F16C, n_gt_8_fulltile_with_qmin) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t n = 9; n < 16; n++) {
+      GAvgPoolMicrokernelTester()
+        .m(7)
+        .n(n)
+        .qmin(128)
+        .Test(xnn_f16_gavgpool_ukernel_up7__f16c);
+    }
+  }
+
+  TEST(F16_GAVGPOOL_MP7p7q__F16C, n_eq_8_2pass_fulltile) {
+    TEST_REQUIRES_X86_F16C;
+    GAvgPoolMicrokernelTester()
+      .m(14)
+      .n(8)
+      .Test(xnn_f16_gavgpool_ukernel_mp7p7q__f16c);
+  }
+
+  TEST(F16_GAVGPOOL_MP7p7q__F16C, n_eq_8_2pass_fulltile_with_x_stride) {
+    TEST_REQUIRES_X86_F16C;
+    GAvgPoolMicrokernelTester()
+      .m(14)
+      .n(8)
+      .x_stride(11)
+      .Test(xnn_f16_gavgpool_ukernel_mp7p7q__f16c);
+  }
+
+  TEST(F16_GAVGPOOL_MP7p7q__F16C, n_eq_8_2pass_fulltile_with_qmax) {
+    TEST_REQUIRES_X86_F16C;
+    GAvgPoolMicrokernelTester()
+      .m(14)
+      .n(8)
+      .qmax(128)
+      .Test(xnn_f16_gavgpool_ukernel_mp7p7q__f16c);
+  }
+
+  TEST(F16_GAVGPOOL_MP7p7q__F16C, n_eq_8_2pass_fulltile_with_qmin) {
+    TEST_REQUIRES_X86_F16C;
+    GAvgPoolMicrokernelTester()
+      .m(14)
+      .n(8)
+      .qmin(128)
+      .Test(xnn_f16_gavgpool_ukernel_mp7p7q__f16c);
+  }
+
+  TEST(F16_GAVGPOOL_MP7p7q__F16C, n_eq_8_2pass_subtile) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t m = 1; m < 7; m++) {
+      GAvgPoolMicrokernelTester()
+        .m(7 + m)
+        .n(8)
+        .Test(xnn_f16_gavgpool_ukernel_mp7p7q__f16c);
+    }
+  }
+
+  TEST(F16_GAVGPOOL_MP7p7q__F16C, n_eq_8_2pass_subtile_with_x_stride) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t m = 1; m < 7; m++) {
+      GAvgPoolMicrokernelTester()
+        .m(7 + m)
+        .n(8)
+        .x_stride(11)
+        .Test(xnn_f16_gavgpool_ukernel_mp7p7q__f16c);
+    }
+  }
+
+  TEST(F16_GAVGPOOL_MP7p7q__F16C, n_eq_8_multipass_fulltile) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t m = 14; m <= 35; m += 7) {
+      GAvgPoolMicrokernelTester()
+        .m(m)
+        .n(8)
+        .Test(xnn_f16_gavgpool_ukernel_mp7p7q__f16c);
+    }
+  }
+
+  TEST(F16_GAVGPOOL_MP7p7q__F16C, n_eq_8_multipass_fulltile_with_x_stride) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t m = 14; m <= 35; m += 7) {
+      GAvgPoolMicrokernelTester()
+        .m(m)
+        .n(8)
+        .Test(xnn_f16_gavgpool_ukernel_mp7p7q__f16c);
+    }
+  }
+
+  TEST(F16_GAVGPOOL_MP7p7q__F16C, n_div_8_2pass_fulltile) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t n = 16; n < 128; n += 24) {
+      GAvgPoolMicrokernelTester()
+        .m(14)
+        .n(n)
+        .Test(xnn_f16_gavgpool_ukernel_mp7p7q__f16c);
+    }
+  }
+
+  TEST(F16_GAVGPOOL_MP7p7q__F16C, n_div_8_2pass_subtile) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t n = 16; n < 128; n += 24) {
+      for (size_t m = 1; m < 7; m++) {
+        GAvgPoolMicrokernelTester()
+          .m(7 + m)
+          .n(n)
+          .Test(xnn_f16_gavgpool_ukernel_mp7p7q__f16c);
+      }
+    }
+  }
+
+  TEST(F16_GAVGPOOL_MP7p7q__F16C, n_div_8_multipass_fulltile) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t n = 16; n < 128; n += 24) {
+      for (size_t m = 14; m <= 35; m += 7) {
+        GAvgPoolMicrokernelTester()
+          .m(m)
+          .n(n)
+          .Test(xnn_f16_gavgpool_ukernel_mp7p7q__f16c);
+      }
+    }
+  }
+
+  TEST(F16_GAVGPOOL_MP7p7q__F16C, n_div_8_multipass_fulltile_with_x_stride) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t n = 16; n < 128; n += 24) {
+      for (size_t m = 14; m <= 35; m += 7) {
+        GAvgPoolMicrokernelTester()
+          .m(m)
+          .n(n)
+          .x_stride(131)
+          .Test(xnn_f16_gavgpool_ukernel_mp7p7q__f16c);
+      }
+    }
+  }
+
+  TEST(F16_GAVGPOOL_MP7p7q__F16C, n_lt_8_2pass_fulltile) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t n = 1; n < 8; n++) {
+      GAvgPoolMicrokernelTester()
+        .m(14)
+        .n(n)
+        .Test(xnn_f16_gavgpool_ukernel_mp7p7q__f16c);
+    }
+  }
+
+  TEST(F16_GAVGPOOL_MP7p7q__F16C, n_lt_8_2pass_fulltile_with_qmax) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t n = 1; n < 8; n++) {
+      GAvgPoolMicrokernelTester()
+        .m(14)
+        .n(n)
+        .qmax(128)
+        .Test(xnn_f16_gavgpool_ukernel_mp7p7q__f16c);
+    }
+  }
+
+  TEST(F16_GAVGPOOL_MP7p7q__F16C, n_lt_8_2pass_fulltile_with_qmin) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t n = 1; n < 8; n++) {
+      GAvgPoolMicrokernelTester()
+        .m(14)
+        .n(n)
+        .qmin(128)
+        .Test(xnn_f16_gavgpool_ukernel_mp7p7q__f16c);
+    }
+  }
+
+  TEST(F16_GAVGPOOL_MP7p7q__F16C, n_lt_8_2pass_subtile) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t n = 1; n < 8; n++) {
+      for (size_t m = 1; m < 7; m++) {
+        GAvgPoolMicrokernelTester()
+          .m(7 + m)
+          .n(n)
+          .Test(xnn_f16_gavgpool_ukernel_mp7p7q__f16c);
+      }
+    }
+  }
+
+  TEST(F16_GAVGPOOL_MP7p7q__F16C, n_lt_8_multipass_fulltile) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t n = 1; n < 8; n++) {
+      for (size_t m = 14; m <= 35; m += 7) {
+        GAvgPoolMicrokernelTester()
+          .m(m)
+          .n(n)
+          .Test(xnn_f16_gavgpool_ukernel_mp7p7q__f16c);
+      }
+    }
+  }
+
+  TEST(F16_GAVGPOOL_MP7p7q__F16C, n_lt_8_multipass_fulltile_with_x_stride) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t n = 1; n < 8; n++) {
+      for (size_t m = 14; m <= 35; m += 7) {
+        GAvgPoolMicrokernelTester()
+          .m(m)
+          .n(n)
+          .x_stride(23)
+          .Test(xnn_f16_gavgpool_ukernel_mp7p7q__f16c);
+      }
+    }
+  }
+
+  TEST(F16_GAVGPOOL_MP7p7q__F16C, n_gt_8_2pass_fulltile) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t n = 9; n < 16; n++) {
+      GAvgPoolMicrokernelTester()
+        .m(14)
+        .n(n)
+        .Test(xnn_f16_gavgpool_ukernel_mp7p7q__f16c);
+    }
+  }
+
+  TEST(F16_GAVGPOOL_MP7p7q__F16C, n_gt_8_2pass_fulltile_with_qmax) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t n = 9; n < 16; n++) {
+      GAvgPoolMicrokernelTester()
+        .m(14)
+        .n(n)
+        .qmax(128)
+        .Test(xnn_f16_gavgpool_ukernel_mp7p7q__f16c);
+    }
+  }
+
+  TEST(F16_GAVGPOOL_MP7p7q__F16C, n_gt_8_2pass_fulltile_with_qmin) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t n = 9; n < 16; n++) {
+      GAvgPoolMicrokernelTester()
+        .m(14)
+        .n(n)
+        .qmin(128)
+        .Test(xnn_f16_gavgpool_ukernel_mp7p7q__f16c);
+    }
+  }
+
+  TEST(F16_GAVGPOOL_MP7p7q__F16C, n_gt_8_2pass_subtile) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t n = 9; n < 16; n++) {
+      for (size_t m = 1; m < 7; m++) {
+        GAvgPoolMicrokernelTester()
+          .m(7 + m)
+          .n(n)
+          .Test(xnn_f16_gavgpool_ukernel_mp7p7q__f16c);
+      }
+    }
+  }
+
+  TEST(F16_GAVGPOOL_MP7p7q__F16C, n_gt_8_multipass_fulltile) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t n = 9; n < 16; n++) {
+      for (size_t m = 14; m <= 35; m += 7) {
+        GAvgPoolMicrokernelTester()
+          .m(m)
+          .n(n)
+          .Test(xnn_f16_gavgpool_ukernel_mp7p7q__f16c);
+      }
+    }
+  }
+
+  TEST(F16_GAVGPOOL_MP7p7q__F16C, n_gt_8_multipass_fulltile_with_x_stride) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t n = 9; n < 16; n++) {
+      for (size_t m = 14; m <= 35; m += 7) {
+        GAvgPoolMicrokernelTester()
+          .m(m)
+          .n(n)
+          .x_stride(23)
+          .Test(xnn_f16_gavgpool_ukernel_mp7p7q__f16c);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+TEST(F16_GAVGPOOL_UP7__SCALAR, n_eq_1_fulltile) {
+  GAvgPoolMicrokernelTester()
+    .m(7)
+    .n(1)
+    .Test(xnn_f16_gavgpool_ukernel_up7__scalar, GAvgPoolMicrokernelTester::Variant::Scalar);
+}
+
+TEST(F16_GAVGPOOL_UP7__SCALAR, n_eq_1_subtile) {
+  for (size_t m = 1; m < 7; m++) {
+    GAvgPoolMicrokernelTester()
+      .m(m)
+      .n(1)
+      .Test(xnn_f16_gavgpool_ukernel_up7__scalar, GAvgPoolMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F16_GAVGPOOL_UP7__SCALAR, n_eq_1_fulltile_with_x_stride) {
+  GAvgPoolMicrokernelTester()
+    .m(7)
+    .n(1)
+    .x_stride(11)
+    .Test(xnn_f16_gavgpool_ukernel_up7__scalar, GAvgPoolMicrokernelTester::Variant::Scalar);
+}
+
+TEST(F16_GAVGPOOL_UP7__SCALAR, n_eq_1_fulltile_with_qmax) {
+  GAvgPoolMicrokernelTester()
+    .m(7)
+    .n(1)
+    .qmax(128)
+    .Test(xnn_f16_gavgpool_ukernel_up7__scalar, GAvgPoolMicrokernelTester::Variant::Scalar);
+}
+
+TEST(F16_GAVGPOOL_UP7__SCALAR, n_eq_1_fulltile_with_qmin) {
+  GAvgPoolMicrokernelTester()
+    .m(7)
+    .n(1)
+    .qmin(128)
+    .Test(xnn_f16_gavgpool_ukernel_up7__scalar, GAvgPoolMicrokernelTester::Variant::Scalar);
+}
+
+TEST(F16_GAVGPOOL_UP7__SCALAR, n_gt_1_fulltile) {
+  for (size_t n = 2; n < 8; n++) {
+    GAvgPoolMicrokernelTester()
+      .m(7)
+      .n(n)
+      .Test(xnn_f16_gavgpool_ukernel_up7__scalar, GAvgPoolMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F16_GAVGPOOL_UP7__SCALAR, n_gt_1_subtile) {
+  for (size_t n = 2; n < 8; n++) {
+    for (size_t m = 1; m < 7; m++) {
+      GAvgPoolMicrokernelTester()
+        .m(m)
+        .n(n)
+        .Test(xnn_f16_gavgpool_ukernel_up7__scalar, GAvgPoolMicrokernelTester::Variant::Scalar);
+    }
+  }
+}
+
+TEST(F16_GAVGPOOL_UP7__SCALAR, n_gt_1_fulltile_with_qmax) {
+  for (size_t n = 2; n < 8; n++) {
+    GAvgPoolMicrokernelTester()
+      .m(7)
+      .n(n)
+      .qmax(128)
+      .Test(xnn_f16_gavgpool_ukernel_up7__scalar, GAvgPoolMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F16_GAVGPOOL_UP7__SCALAR, n_gt_1_fulltile_with_qmin) {
+  for (size_t n = 2; n < 8; n++) {
+    GAvgPoolMicrokernelTester()
+      .m(7)
+      .n(n)
+      .qmin(128)
+      .Test(xnn_f16_gavgpool_ukernel_up7__scalar, GAvgPoolMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F16_GAVGPOOL_MP7p7q__SCALAR, n_eq_1_2pass_fulltile) {
+  GAvgPoolMicrokernelTester()
+    .m(14)
+    .n(1)
+    .Test(xnn_f16_gavgpool_ukernel_mp7p7q__scalar, GAvgPoolMicrokernelTester::Variant::Scalar);
+}
+
+TEST(F16_GAVGPOOL_MP7p7q__SCALAR, n_eq_1_2pass_fulltile_with_x_stride) {
+  GAvgPoolMicrokernelTester()
+    .m(14)
+    .n(1)
+    .x_stride(11)
+    .Test(xnn_f16_gavgpool_ukernel_mp7p7q__scalar, GAvgPoolMicrokernelTester::Variant::Scalar);
+}
+
+TEST(F16_GAVGPOOL_MP7p7q__SCALAR, n_eq_1_2pass_fulltile_with_qmax) {
+  GAvgPoolMicrokernelTester()
+    .m(14)
+    .n(1)
+    .qmax(128)
+    .Test(xnn_f16_gavgpool_ukernel_mp7p7q__scalar, GAvgPoolMicrokernelTester::Variant::Scalar);
+}
+
+TEST(F16_GAVGPOOL_MP7p7q__SCALAR, n_eq_1_2pass_fulltile_with_qmin) {
+  GAvgPoolMicrokernelTester()
+    .m(14)
+    .n(1)
+    .qmin(128)
+    .Test(xnn_f16_gavgpool_ukernel_mp7p7q__scalar, GAvgPoolMicrokernelTester::Variant::Scalar);
+}
+
+TEST(F16_GAVGPOOL_MP7p7q__SCALAR, n_eq_1_2pass_subtile) {
+  for (size_t m = 1; m < 7; m++) {
+    GAvgPoolMicrokernelTester()
+      .m(7 + m)
+      .n(1)
+        .Test(xnn_f16_gavgpool_ukernel_mp7p7q__scalar, GAvgPoolMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F16_GAVGPOOL_MP7p7q__SCALAR, n_eq_1_2pass_subtile_with_x_stride) {
+  for (size_t m = 1; m < 7; m++) {
+    GAvgPoolMicrokernelTester()
+      .m(7 + m)
+      .n(1)
+        .x_stride(11)
+      .Test(xnn_f16_gavgpool_ukernel_mp7p7q__scalar, GAvgPoolMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F16_GAVGPOOL_MP7p7q__SCALAR, n_eq_1_multipass_fulltile) {
+  for (size_t m = 14; m <= 35; m += 7) {
+    GAvgPoolMicrokernelTester()
+      .m(m)
+      .n(1)
+        .Test(xnn_f16_gavgpool_ukernel_mp7p7q__scalar, GAvgPoolMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F16_GAVGPOOL_MP7p7q__SCALAR, n_eq_1_multipass_fulltile_with_x_stride) {
+  for (size_t m = 14; m <= 35; m += 7) {
+    GAvgPoolMicrokernelTester()
+      .m(m)
+      .n(1)
+        .Test(xnn_f16_gavgpool_ukernel_mp7p7q__scalar, GAvgPoolMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F16_GAVGPOOL_MP7p7q__SCALAR, n_gt_1_2pass_fulltile) {
+  for (size_t n = 2; n < 8; n++) {
+    GAvgPoolMicrokernelTester()
+      .m(14)
+      .n(n)
+        .Test(xnn_f16_gavgpool_ukernel_mp7p7q__scalar, GAvgPoolMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F16_GAVGPOOL_MP7p7q__SCALAR, n_gt_1_2pass_fulltile_with_qmax) {
+  for (size_t n = 2; n < 8; n++) {
+    GAvgPoolMicrokernelTester()
+      .m(14)
+      .n(n)
+        .qmax(128)
+      .Test(xnn_f16_gavgpool_ukernel_mp7p7q__scalar, GAvgPoolMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F16_GAVGPOOL_MP7p7q__SCALAR, n_gt_1_2pass_fulltile_with_qmin) {
+  for (size_t n = 2; n < 8; n++) {
+    GAvgPoolMicrokernelTester()
+      .m(14)
+      .n(n)
+        .qmin(128)
+      .Test(xnn_f16_gavgpool_ukernel_mp7p7q__scalar, GAvgPoolMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F16_GAVGPOOL_MP7p7q__SCALAR, n_gt_1_2pass_subtile) {
+  for (size_t n = 2; n < 8; n++) {
+    for (size_t m = 1; m < 7; m++) {
+      GAvgPoolMicrokernelTester()
+        .m(7 + m)
+        .n(n)
+            .Test(xnn_f16_gavgpool_ukernel_mp7p7q__scalar, GAvgPoolMicrokernelTester::Variant::Scalar);
+    }
+  }
+}
+
+TEST(F16_GAVGPOOL_MP7p7q__SCALAR, n_gt_1_multipass_fulltile) {
+  for (size_t n = 2; n < 8; n++) {
+    for (size_t m = 14; m <= 35; m += 7) {
+      GAvgPoolMicrokernelTester()
+        .m(m)
+        .n(n)
+            .Test(xnn_f16_gavgpool_ukernel_mp7p7q__scalar, GAvgPoolMicrokernelTester::Variant::Scalar);
+    }
+  }
+}
+
+TEST(F16_GAVGPOOL_MP7p7q__SCALAR, n_gt_1_multipass_fulltile_with_x_stride) {
+  for (size_t n = 2; n < 8; n++) {
+    for (size_t m = 14; m <= 35; m += 7) {
+      GAvgPoolMicrokernelTester()
+        .m(m)
+        .n(n)
+            .x_stride(23)
+        .Test(xnn_f16_gavgpool_ukernel_mp7p7q__scalar, GAvgPoolMicrokernelTester::Variant::Scalar);
+    }
+  }
+}
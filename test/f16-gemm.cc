@@ -23,53 +23,53 @@
 
 
 #if XNN_ARCH_ARM64
-  TEST(F16_GEMM_4X8__NEONFP16ARITH_LD64, k_eq_4) {
+  TEST(F16_GEMM_1X8__NEONFP16ARITH_LD64, k_eq_4) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
-      .mr(4)
+      .mr(1)
       .nr(8)
       .kr(1)
       .sr(1)
-      .m(4)
+      .m(1)
       .n(8)
       .k(4)
-      .Test(xnn_f16_gemm_ukernel_4x8__neonfp16arith_ld64);
+      .Test(xnn_f16_gemm_ukernel_1x8__neonfp16arith_ld64);
   }
 
-  TEST(F16_GEMM_4X8__NEONFP16ARITH_LD64, strided_cn) {
+  TEST(F16_GEMM_1X8__NEONFP16ARITH_LD64, strided_cn) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
-      .mr(4)
+      .mr(1)
       .nr(8)
       .kr(1)
       .sr(1)
-      .m(4)
+      .m(1)
       .n(8)
       .k(4)
       .cn_stride(11)
-      .Test(xnn_f16_gemm_ukernel_4x8__neonfp16arith_ld64);
+      .Test(xnn_f16_gemm_ukernel_1x8__neonfp16arith_ld64);
   }
 
-  TEST(F16_GEMM_4X8__NEONFP16ARITH_LD64, k_eq_4_strided_a) {
+  TEST(F16_GEMM_1X8__NEONFP16ARITH_LD64, k_eq_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
-      .mr(4)
+      .mr(1)
       .nr(8)
       .kr(1)
       .sr(1)
-      .m(4)
+      .m(1)
       .n(8)
       .k(4)
       .a_stride(7)
-      .Test(xnn_f16_gemm_ukernel_4x8__neonfp16arith_ld64);
+      .Test(xnn_f16_gemm_ukernel_1x8__neonfp16arith_ld64);
   }
 
-  TEST(F16_GEMM_4X8__NEONFP16ARITH_LD64, k_eq_4_subtile) {
+  TEST(F16_GEMM_1X8__NEONFP16ARITH_LD64, k_eq_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t m = 1; m <= 4; m++) {
+    for (uint32_t m = 1; m <= 1; m++) {
       for (uint32_t n = 1; n <= 8; n++) {
         GemmMicrokernelTester()
-          .mr(4)
+          .mr(1)
           .nr(8)
           .kr(1)
           .sr(1)
@@ -77,16 +77,16 @@
           .n(n)
           .k(4)
           .iterations(1)
-          .Test(xnn_f16_gemm_ukernel_4x8__neonfp16arith_ld64);
+          .Test(xnn_f16_gemm_ukernel_1x8__neonfp16arith_ld64);
       }
     }
   }
 
-  TEST(F16_GEMM_4X8__NEONFP16ARITH_LD64, k_eq_4_subtile_m) {
+  TEST(F16_GEMM_1X8__NEONFP16ARITH_LD64, k_eq_4_subtile_m) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t m = 1; m <= 4; m++) {
+    for (uint32_t m = 1; m <= 1; m++) {
       GemmMicrokernelTester()
-        .mr(4)
+        .mr(1)
         .nr(8)
         .kr(1)
         .sr(1)
@@ -94,64 +94,64 @@
         .n(8)
         .k(4)
         .iterations(1)
-        .Test(xnn_f16_gemm_ukernel_4x8__neonfp16arith_ld64);
+        .Test(xnn_f16_gemm_ukernel_1x8__neonfp16arith_ld64);
     }
   }
 
-  TEST(F16_GEMM_4X8__NEONFP16ARITH_LD64, k_eq_4_subtile_n) {
+  TEST(F16_GEMM_1X8__NEONFP16ARITH_LD64, k_eq_4_subtile_n) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (uint32_t n = 1; n <= 8; n++) {
       GemmMicrokernelTester()
-        .mr(4)
+        .mr(1)
         .nr(8)
         .kr(1)
         .sr(1)
-        .m(4)
+        .m(1)
         .n(n)
         .k(4)
         .iterations(1)
-        .Test(xnn_f16_gemm_ukernel_4x8__neonfp16arith_ld64);
+        .Test(xnn_f16_gemm_ukernel_1x8__neonfp16arith_ld64);
     }
   }
 
-  TEST(F16_GEMM_4X8__NEONFP16ARITH_LD64, k_lt_4) {
+  TEST(F16_GEMM_1X8__NEONFP16ARITH_LD64, k_lt_4) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
-        .mr(4)
+        .mr(1)
         .nr(8)
         .kr(1)
         .sr(1)
-        .m(4)
+        .m(1)
         .n(8)
         .k(k)
-        .Test(xnn_f16_gemm_ukernel_4x8__neonfp16arith_ld64);
+        .Test(xnn_f16_gemm_ukernel_1x8__neonfp16arith_ld64);
     }
   }
 
-  TEST(F16_GEMM_4X8__NEONFP16ARITH_LD64, k_lt_4_strided_a) {
+  TEST(F16_GEMM_1X8__NEONFP16ARITH_LD64, k_lt_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
-        .mr(4)
+        .mr(1)
         .nr(8)
         .kr(1)
         .sr(1)
-        .m(4)
+        .m(1)
         .n(8)
         .k(k)
         .a_stride(7)
-        .Test(xnn_f16_gemm_ukernel_4x8__neonfp16arith_ld64);
+        .Test(xnn_f16_gemm_ukernel_1x8__neonfp16arith_ld64);
     }
   }
 
-  TEST(F16_GEMM_4X8__NEONFP16ARITH_LD64, k_lt_4_subtile) {
+  TEST(F16_GEMM_1X8__NEONFP16ARITH_LD64, k_lt_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 1; k < 4; k++) {
-      for (uint32_t m = 1; m <= 4; m++) {
+      for (uint32_t m = 1; m <= 1; m++) {
         for (uint32_t n = 1; n <= 8; n++) {
           GemmMicrokernelTester()
-            .mr(4)
+            .mr(1)
             .nr(8)
             .kr(1)
             .sr(1)
@@ -159,50 +159,50 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_ukernel_4x8__neonfp16arith_ld64);
+            .Test(xnn_f16_gemm_ukernel_1x8__neonfp16arith_ld64);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_4X8__NEONFP16ARITH_LD64, k_gt_4) {
+  TEST(F16_GEMM_1X8__NEONFP16ARITH_LD64, k_gt_4) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
-        .mr(4)
+        .mr(1)
         .nr(8)
         .kr(1)
         .sr(1)
-        .m(4)
+        .m(1)
         .n(8)
         .k(k)
-        .Test(xnn_f16_gemm_ukernel_4x8__neonfp16arith_ld64);
+        .Test(xnn_f16_gemm_ukernel_1x8__neonfp16arith_ld64);
     }
   }
 
-  TEST(F16_GEMM_4X8__NEONFP16ARITH_LD64, k_gt_4_strided_a) {
+  TEST(F16_GEMM_1X8__NEONFP16ARITH_LD64, k_gt_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
-        .mr(4)
+        .mr(1)
         .nr(8)
         .kr(1)
         .sr(1)
-        .m(4)
+        .m(1)
         .n(8)
         .k(k)
         .a_stride(11)
-        .Test(xnn_f16_gemm_ukernel_4x8__neonfp16arith_ld64);
+        .Test(xnn_f16_gemm_ukernel_1x8__neonfp16arith_ld64);
     }
   }
 
-  TEST(F16_GEMM_4X8__NEONFP16ARITH_LD64, k_gt_4_subtile) {
+  TEST(F16_GEMM_1X8__NEONFP16ARITH_LD64, k_gt_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 5; k < 8; k++) {
-      for (uint32_t m = 1; m <= 4; m++) {
+      for (uint32_t m = 1; m <= 1; m++) {
         for (uint32_t n = 1; n <= 8; n++) {
           GemmMicrokernelTester()
-            .mr(4)
+            .mr(1)
             .nr(8)
             .kr(1)
             .sr(1)
@@ -210,50 +210,50 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_ukernel_4x8__neonfp16arith_ld64);
+            .Test(xnn_f16_gemm_ukernel_1x8__neonfp16arith_ld64);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_4X8__NEONFP16ARITH_LD64, k_div_4) {
+  TEST(F16_GEMM_1X8__NEONFP16ARITH_LD64, k_div_4) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
-        .mr(4)
+        .mr(1)
         .nr(8)
         .kr(1)
         .sr(1)
-        .m(4)
+        .m(1)
         .n(8)
         .k(k)
-        .Test(xnn_f16_gemm_ukernel_4x8__neonfp16arith_ld64);
+        .Test(xnn_f16_gemm_ukernel_1x8__neonfp16arith_ld64);
     }
   }
 
-  TEST(F16_GEMM_4X8__NEONFP16ARITH_LD64, k_div_4_strided_a) {
+  TEST(F16_GEMM_1X8__NEONFP16ARITH_LD64, k_div_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
-        .mr(4)
+        .mr(1)
         .nr(8)
         .kr(1)
         .sr(1)
-        .m(4)
+        .m(1)
         .n(8)
         .k(k)
         .a_stride(43)
-        .Test(xnn_f16_gemm_ukernel_4x8__neonfp16arith_ld64);
+        .Test(xnn_f16_gemm_ukernel_1x8__neonfp16arith_ld64);
     }
   }
 
-  TEST(F16_GEMM_4X8__NEONFP16ARITH_LD64, k_div_4_subtile) {
+  TEST(F16_GEMM_1X8__NEONFP16ARITH_LD64, k_div_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 8; k <= 40; k += 4) {
-      for (uint32_t m = 1; m <= 4; m++) {
+      for (uint32_t m = 1; m <= 1; m++) {
         for (uint32_t n = 1; n <= 8; n++) {
           GemmMicrokernelTester()
-            .mr(4)
+            .mr(1)
             .nr(8)
             .kr(1)
             .sr(1)
@@ -261,72 +261,72 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_ukernel_4x8__neonfp16arith_ld64);
+            .Test(xnn_f16_gemm_ukernel_1x8__neonfp16arith_ld64);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_4X8__NEONFP16ARITH_LD64, n_gt_8) {
+  TEST(F16_GEMM_1X8__NEONFP16ARITH_LD64, n_gt_8) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(4)
+          .mr(1)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(4)
+          .m(1)
           .n(8)
           .k(k)
-          .Test(xnn_f16_gemm_ukernel_4x8__neonfp16arith_ld64);
+          .Test(xnn_f16_gemm_ukernel_1x8__neonfp16arith_ld64);
       }
     }
   }
 
-  TEST(F16_GEMM_4X8__NEONFP16ARITH_LD64, n_gt_8_strided_cn) {
+  TEST(F16_GEMM_1X8__NEONFP16ARITH_LD64, n_gt_8_strided_cn) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(4)
+          .mr(1)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(4)
+          .m(1)
           .n(8)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f16_gemm_ukernel_4x8__neonfp16arith_ld64);
+          .Test(xnn_f16_gemm_ukernel_1x8__neonfp16arith_ld64);
       }
     }
   }
 
-  TEST(F16_GEMM_4X8__NEONFP16ARITH_LD64, n_gt_8_strided_a) {
+  TEST(F16_GEMM_1X8__NEONFP16ARITH_LD64, n_gt_8_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(4)
+          .mr(1)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(4)
+          .m(1)
           .n(n)
           .k(k)
           .a_stride(23)
-          .Test(xnn_f16_gemm_ukernel_4x8__neonfp16arith_ld64);
+          .Test(xnn_f16_gemm_ukernel_1x8__neonfp16arith_ld64);
       }
     }
   }
 
-  TEST(F16_GEMM_4X8__NEONFP16ARITH_LD64, n_gt_8_subtile) {
+  TEST(F16_GEMM_1X8__NEONFP16ARITH_LD64, n_gt_8_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
-        for (uint32_t m = 1; m <= 4; m++) {
+        for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
-            .mr(4)
+            .mr(1)
             .nr(8)
             .kr(1)
             .sr(1)
@@ -334,72 +334,72 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_ukernel_4x8__neonfp16arith_ld64);
+            .Test(xnn_f16_gemm_ukernel_1x8__neonfp16arith_ld64);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_4X8__NEONFP16ARITH_LD64, n_div_8) {
+  TEST(F16_GEMM_1X8__NEONFP16ARITH_LD64, n_div_8) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(4)
+          .mr(1)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(4)
+          .m(1)
           .n(8)
           .k(k)
-          .Test(xnn_f16_gemm_ukernel_4x8__neonfp16arith_ld64);
+          .Test(xnn_f16_gemm_ukernel_1x8__neonfp16arith_ld64);
       }
     }
   }
 
-  TEST(F16_GEMM_4X8__NEONFP16ARITH_LD64, n_div_8_strided_cn) {
+  TEST(F16_GEMM_1X8__NEONFP16ARITH_LD64, n_div_8_strided_cn) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(4)
+          .mr(1)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(4)
+          .m(1)
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f16_gemm_ukernel_4x8__neonfp16arith_ld64);
+          .Test(xnn_f16_gemm_ukernel_1x8__neonfp16arith_ld64);
       }
     }
   }
 
-  TEST(F16_GEMM_4X8__NEONFP16ARITH_LD64, n_div_8_strided_a) {
+  TEST(F16_GEMM_1X8__NEONFP16ARITH_LD64, n_div_8_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(4)
+          .mr(1)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(4)
+          .m(1)
           .n(n)
           .k(k)
           .a_stride(23)
-          .Test(xnn_f16_gemm_ukernel_4x8__neonfp16arith_ld64);
+          .Test(xnn_f16_gemm_ukernel_1x8__neonfp16arith_ld64);
       }
     }
   }
 
-  TEST(F16_GEMM_4X8__NEONFP16ARITH_LD64, n_div_8_subtile) {
+  TEST(F16_GEMM_1X8__NEONFP16ARITH_LD64, n_div_8_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
-        for (uint32_t m = 1; m <= 4; m++) {
+        for (uint32_t m = 1; m <= 1; m++) {
           GemmMicrokernelTester()
-            .mr(4)
+            .mr(1)
             .nr(8)
             .kr(1)
             .sr(1)
@@ -407,19 +407,19 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_ukernel_4x8__neonfp16arith_ld64);
+            .Test(xnn_f16_gemm_ukernel_1x8__neonfp16arith_ld64);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_4X8__NEONFP16ARITH_LD64, strided_cm_subtile) {
+  TEST(F16_GEMM_1X8__NEONFP16ARITH_LD64, strided_cm_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 1; k <= 20; k += 5) {
-      for (uint32_t m = 1; m <= 4; m++) {
+      for (uint32_t m = 1; m <= 1; m++) {
         for (uint32_t n = 1; n <= 8; n++) {
           GemmMicrokernelTester()
-            .mr(4)
+            .mr(1)
             .nr(8)
             .kr(1)
             .sr(1)
@@ -428,104 +428,104 @@
             .k(k)
             .cm_stride(11)
             .iterations(1)
-            .Test(xnn_f16_gemm_ukernel_4x8__neonfp16arith_ld64);
+            .Test(xnn_f16_gemm_ukernel_1x8__neonfp16arith_ld64);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_4X8__NEONFP16ARITH_LD64, qmin) {
+  TEST(F16_GEMM_1X8__NEONFP16ARITH_LD64, qmin) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
-      .mr(4)
+      .mr(1)
       .nr(8)
       .kr(1)
       .sr(1)
-      .m(4)
+      .m(1)
       .n(8)
       .k(4)
       .qmin(128)
-      .Test(xnn_f16_gemm_ukernel_4x8__neonfp16arith_ld64);
+      .Test(xnn_f16_gemm_ukernel_1x8__neonfp16arith_ld64);
   }
 
-  TEST(F16_GEMM_4X8__NEONFP16ARITH_LD64, qmax) {
+  TEST(F16_GEMM_1X8__NEONFP16ARITH_LD64, qmax) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
-      .mr(4)
+      .mr(1)
       .nr(8)
       .kr(1)
       .sr(1)
-      .m(4)
+      .m(1)
       .n(8)
       .k(4)
       .qmax(128)
-      .Test(xnn_f16_gemm_ukernel_4x8__neonfp16arith_ld64);
+      .Test(xnn_f16_gemm_ukernel_1x8__neonfp16arith_ld64);
   }
 
-  TEST(F16_GEMM_4X8__NEONFP16ARITH_LD64, strided_cm) {
+  TEST(F16_GEMM_1X8__NEONFP16ARITH_LD64, strided_cm) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
-      .mr(4)
+      .mr(1)
       .nr(8)
       .kr(1)
       .sr(1)
-      .m(4)
+      .m(1)
       .n(8)
       .k(4)
       .cm_stride(11)
-      .Test(xnn_f16_gemm_ukernel_4x8__neonfp16arith_ld64);
+      .Test(xnn_f16_gemm_ukernel_1x8__neonfp16arith_ld64);
   }
 #endif  // XNN_ARCH_ARM64
 
 
 #if XNN_ARCH_ARM64
-  TEST(F16_GEMM_6X8__NEONFP16ARITH_LD64, k_eq_4) {
+  TEST(F16_GEMM_4X8__NEONFP16ARITH_LD64, k_eq_4) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
-      .mr(6)
+      .mr(4)
       .nr(8)
       .kr(1)
       .sr(1)
-      .m(6)
+      .m(4)
       .n(8)
       .k(4)
-      .Test(xnn_f16_gemm_ukernel_6x8__neonfp16arith_ld64);
+      .Test(xnn_f16_gemm_ukernel_4x8__neonfp16arith_ld64);
   }
 
-  TEST(F16_GEMM_6X8__NEONFP16ARITH_LD64, strided_cn) {
+  TEST(F16_GEMM_4X8__NEONFP16ARITH_LD64, strided_cn) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
-      .mr(6)
+      .mr(4)
       .nr(8)
       .kr(1)
       .sr(1)
-      .m(6)
+      .m(4)
       .n(8)
       .k(4)
       .cn_stride(11)
-      .Test(xnn_f16_gemm_ukernel_6x8__neonfp16arith_ld64);
+      .Test(xnn_f16_gemm_ukernel_4x8__neonfp16arith_ld64);
   }
 
-  TEST(F16_GEMM_6X8__NEONFP16ARITH_LD64, k_eq_4_strided_a) {
+  TEST(F16_GEMM_4X8__NEONFP16ARITH_LD64, k_eq_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
-      .mr(6)
+      .mr(4)
       .nr(8)
       .kr(1)
       .sr(1)
-      .m(6)
+      .m(4)
       .n(8)
       .k(4)
       .a_stride(7)
-      .Test(xnn_f16_gemm_ukernel_6x8__neonfp16arith_ld64);
+      .Test(xnn_f16_gemm_ukernel_4x8__neonfp16arith_ld64);
   }
 
-  TEST(F16_GEMM_6X8__NEONFP16ARITH_LD64, k_eq_4_subtile) {
+  TEST(F16_GEMM_4X8__NEONFP16ARITH_LD64, k_eq_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t m = 1; m <= 6; m++) {
+    for (uint32_t m = 1; m <= 4; m++) {
       for (uint32_t n = 1; n <= 8; n++) {
         GemmMicrokernelTester()
-          .mr(6)
+          .mr(4)
           .nr(8)
           .kr(1)
           .sr(1)
@@ -533,16 +533,16 @@
           .n(n)
           .k(4)
           .iterations(1)
-          .Test(xnn_f16_gemm_ukernel_6x8__neonfp16arith_ld64);
+          .Test(xnn_f16_gemm_ukernel_4x8__neonfp16arith_ld64);
       }
     }
   }
 
-  TEST(F16_GEMM_6X8__NEONFP16ARITH_LD64, k_eq_4_subtile_m) {
+  TEST(F16_GEMM_4X8__NEONFP16ARITH_LD64, k_eq_4_subtile_m) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t m = 1; m <= 6; m++) {
+    for (uint32_t m = 1; m <= 4; m++) {
       GemmMicrokernelTester()
-        .mr(6)
+        .mr(4)
         .nr(8)
         .kr(1)
         .sr(1)
@@ -550,64 +550,64 @@
         .n(8)
         .k(4)
         .iterations(1)
-        .Test(xnn_f16_gemm_ukernel_6x8__neonfp16arith_ld64);
+        .Test(xnn_f16_gemm_ukernel_4x8__neonfp16arith_ld64);
     }
   }
 
-  TEST(F16_GEMM_6X8__NEONFP16ARITH_LD64, k_eq_4_subtile_n) {
+  TEST(F16_GEMM_4X8__NEONFP16ARITH_LD64, k_eq_4_subtile_n) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (uint32_t n = 1; n <= 8; n++) {
       GemmMicrokernelTester()
-        .mr(6)
+        .mr(4)
         .nr(8)
         .kr(1)
         .sr(1)
-        .m(6)
+        .m(4)
         .n(n)
         .k(4)
         .iterations(1)
-        .Test(xnn_f16_gemm_ukernel_6x8__neonfp16arith_ld64);
+        .Test(xnn_f16_gemm_ukernel_4x8__neonfp16arith_ld64);
     }
   }
 
-  TEST(F16_GEMM_6X8__NEONFP16ARITH_LD64, k_lt_4) {
+  TEST(F16_GEMM_4X8__NEONFP16ARITH_LD64, k_lt_4) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
-        .mr(6)
+        .mr(4)
         .nr(8)
         .kr(1)
         .sr(1)
-        .m(6)
+        .m(4)
         .n(8)
         .k(k)
-        .Test(xnn_f16_gemm_ukernel_6x8__neonfp16arith_ld64);
+        .Test(xnn_f16_gemm_ukernel_4x8__neonfp16arith_ld64);
     }
   }
 
-  TEST(F16_GEMM_6X8__NEONFP16ARITH_LD64, k_lt_4_strided_a) {
+  TEST(F16_GEMM_4X8__NEONFP16ARITH_LD64, k_lt_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
-        .mr(6)
+        .mr(4)
         .nr(8)
         .kr(1)
         .sr(1)
-        .m(6)
+        .m(4)
         .n(8)
         .k(k)
         .a_stride(7)
-        .Test(xnn_f16_gemm_ukernel_6x8__neonfp16arith_ld64);
+        .Test(xnn_f16_gemm_ukernel_4x8__neonfp16arith_ld64);
     }
   }
 
-  TEST(F16_GEMM_6X8__NEONFP16ARITH_LD64, k_lt_4_subtile) {
+  TEST(F16_GEMM_4X8__NEONFP16ARITH_LD64, k_lt_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 1; k < 4; k++) {
-      for (uint32_t m = 1; m <= 6; m++) {
+      for (uint32_t m = 1; m <= 4; m++) {
         for (uint32_t n = 1; n <= 8; n++) {
           GemmMicrokernelTester()
-            .mr(6)
+            .mr(4)
             .nr(8)
             .kr(1)
             .sr(1)
@@ -615,50 +615,50 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_ukernel_6x8__neonfp16arith_ld64);
+            .Test(xnn_f16_gemm_ukernel_4x8__neonfp16arith_ld64);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_6X8__NEONFP16ARITH_LD64, k_gt_4) {
+  TEST(F16_GEMM_4X8__NEONFP16ARITH_LD64, k_gt_4) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
-        .mr(6)
+        .mr(4)
         .nr(8)
         .kr(1)
         .sr(1)
-        .m(6)
+        .m(4)
         .n(8)
         .k(k)
-        .Test(xnn_f16_gemm_ukernel_6x8__neonfp16arith_ld64);
+        .Test(xnn_f16_gemm_ukernel_4x8__neonfp16arith_ld64);
     }
   }
 
-  TEST(F16_GEMM_6X8__NEONFP16ARITH_LD64, k_gt_4_strided_a) {
+  TEST(F16_GEMM_4X8__NEONFP16ARITH_LD64, k_gt_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
-        .mr(6)
+        .mr(4)
         .nr(8)
         .kr(1)
         .sr(1)
-        .m(6)
+        .m(4)
         .n(8)
         .k(k)
         .a_stride(11)
-        .Test(xnn_f16_gemm_ukernel_6x8__neonfp16arith_ld64);
+        .Test(xnn_f16_gemm_ukernel_4x8__neonfp16arith_ld64);
     }
   }
 
-  TEST(F16_GEMM_6X8__NEONFP16ARITH_LD64, k_gt_4_subtile) {
+  TEST(F16_GEMM_4X8__NEONFP16ARITH_LD64, k_gt_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 5; k < 8; k++) {
-      for (uint32_t m = 1; m <= 6; m++) {
+      for (uint32_t m = 1; m <= 4; m++) {
         for (uint32_t n = 1; n <= 8; n++) {
           GemmMicrokernelTester()
-            .mr(6)
+            .mr(4)
             .nr(8)
             .kr(1)
             .sr(1)
@@ -666,50 +666,50 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_ukernel_6x8__neonfp16arith_ld64);
+            .Test(xnn_f16_gemm_ukernel_4x8__neonfp16arith_ld64);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_6X8__NEONFP16ARITH_LD64, k_div_4) {
+  TEST(F16_GEMM_4X8__NEONFP16ARITH_LD64, k_div_4) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
-        .mr(6)
+        .mr(4)
         .nr(8)
         .kr(1)
         .sr(1)
-        .m(6)
+        .m(4)
         .n(8)
         .k(k)
-        .Test(xnn_f16_gemm_ukernel_6x8__neonfp16arith_ld64);
+        .Test(xnn_f16_gemm_ukernel_4x8__neonfp16arith_ld64);
     }
   }
 
-  TEST(F16_GEMM_6X8__NEONFP16ARITH_LD64, k_div_4_strided_a) {
+  TEST(F16_GEMM_4X8__NEONFP16ARITH_LD64, k_div_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
-        .mr(6)
+        .mr(4)
         .nr(8)
         .kr(1)
         .sr(1)
-        .m(6)
+        .m(4)
         .n(8)
         .k(k)
         .a_stride(43)
-        .Test(xnn_f16_gemm_ukernel_6x8__neonfp16arith_ld64);
+        .Test(xnn_f16_gemm_ukernel_4x8__neonfp16arith_ld64);
     }
   }
 
-  TEST(F16_GEMM_6X8__NEONFP16ARITH_LD64, k_div_4_subtile) {
+  TEST(F16_GEMM_4X8__NEONFP16ARITH_LD64, k_div_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 8; k <= 40; k += 4) {
-      for (uint32_t m = 1; m <= 6; m++) {
+      for (uint32_t m = 1; m <= 4; m++) {
         for (uint32_t n = 1; n <= 8; n++) {
           GemmMicrokernelTester()
-            .mr(6)
+            .mr(4)
             .nr(8)
             .kr(1)
             .sr(1)
@@ -717,72 +717,72 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_ukernel_6x8__neonfp16arith_ld64);
+            .Test(xnn_f16_gemm_ukernel_4x8__neonfp16arith_ld64);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_6X8__NEONFP16ARITH_LD64, n_gt_8) {
+  TEST(F16_GEMM_4X8__NEONFP16ARITH_LD64, n_gt_8) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(6)
+          .mr(4)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(6)
+          .m(4)
           .n(8)
           .k(k)
-          .Test(xnn_f16_gemm_ukernel_6x8__neonfp16arith_ld64);
+          .Test(xnn_f16_gemm_ukernel_4x8__neonfp16arith_ld64);
       }
     }
   }
 
-  TEST(F16_GEMM_6X8__NEONFP16ARITH_LD64, n_gt_8_strided_cn) {
+  TEST(F16_GEMM_4X8__NEONFP16ARITH_LD64, n_gt_8_strided_cn) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(6)
+          .mr(4)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(6)
+          .m(4)
           .n(8)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f16_gemm_ukernel_6x8__neonfp16arith_ld64);
+          .Test(xnn_f16_gemm_ukernel_4x8__neonfp16arith_ld64);
       }
     }
   }
 
-  TEST(F16_GEMM_6X8__NEONFP16ARITH_LD64, n_gt_8_strided_a) {
+  TEST(F16_GEMM_4X8__NEONFP16ARITH_LD64, n_gt_8_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(6)
+          .mr(4)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(6)
+          .m(4)
           .n(n)
           .k(k)
           .a_stride(23)
-          .Test(xnn_f16_gemm_ukernel_6x8__neonfp16arith_ld64);
+          .Test(xnn_f16_gemm_ukernel_4x8__neonfp16arith_ld64);
       }
     }
   }
 
-  TEST(F16_GEMM_6X8__NEONFP16ARITH_LD64, n_gt_8_subtile) {
+  TEST(F16_GEMM_4X8__NEONFP16ARITH_LD64, n_gt_8_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
-        for (uint32_t m = 1; m <= 6; m++) {
+        for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
-            .mr(6)
+            .mr(4)
             .nr(8)
             .kr(1)
             .sr(1)
@@ -790,72 +790,72 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_ukernel_6x8__neonfp16arith_ld64);
+            .Test(xnn_f16_gemm_ukernel_4x8__neonfp16arith_ld64);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_6X8__NEONFP16ARITH_LD64, n_div_8) {
+  TEST(F16_GEMM_4X8__NEONFP16ARITH_LD64, n_div_8) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(6)
+          .mr(4)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(6)
+          .m(4)
           .n(8)
           .k(k)
-          .Test(xnn_f16_gemm_ukernel_6x8__neonfp16arith_ld64);
+          .Test(xnn_f16_gemm_ukernel_4x8__neonfp16arith_ld64);
       }
     }
   }
 
-  TEST(F16_GEMM_6X8__NEONFP16ARITH_LD64, n_div_8_strided_cn) {
+  TEST(F16_GEMM_4X8__NEONFP16ARITH_LD64, n_div_8_strided_cn) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(6)
+          .mr(4)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(6)
+          .m(4)
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f16_gemm_ukernel_6x8__neonfp16arith_ld64);
+          .Test(xnn_f16_gemm_ukernel_4x8__neonfp16arith_ld64);
       }
     }
   }
 
-  TEST(F16_GEMM_6X8__NEONFP16ARITH_LD64, n_div_8_strided_a) {
+  TEST(F16_GEMM_4X8__NEONFP16ARITH_LD64, n_div_8_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(6)
+          .mr(4)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(6)
+          .m(4)
           .n(n)
           .k(k)
           .a_stride(23)
-          .Test(xnn_f16_gemm_ukernel_6x8__neonfp16arith_ld64);
+          .Test(xnn_f16_gemm_ukernel_4x8__neonfp16arith_ld64);
       }
     }
   }
 
-  TEST(F16_GEMM_6X8__NEONFP16ARITH_LD64, n_div_8_subtile) {
+  TEST(F16_GEMM_4X8__NEONFP16ARITH_LD64, n_div_8_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
-        for (uint32_t m = 1; m <= 6; m++) {
+        for (uint32_t m = 1; m <= 4; m++) {
           GemmMicrokernelTester()
-            .mr(6)
+            .mr(4)
             .nr(8)
             .kr(1)
             .sr(1)
@@ -863,19 +863,19 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_ukernel_6x8__neonfp16arith_ld64);
+            .Test(xnn_f16_gemm_ukernel_4x8__neonfp16arith_ld64);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_6X8__NEONFP16ARITH_LD64, strided_cm_subtile) {
+  TEST(F16_GEMM_4X8__NEONFP16ARITH_LD64, strided_cm_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 1; k <= 20; k += 5) {
-      for (uint32_t m = 1; m <= 6; m++) {
+      for (uint32_t m = 1; m <= 4; m++) {
         for (uint32_t n = 1; n <= 8; n++) {
           GemmMicrokernelTester()
-            .mr(6)
+            .mr(4)
             .nr(8)
             .kr(1)
             .sr(1)
@@ -884,104 +884,104 @@
             .k(k)
             .cm_stride(11)
             .iterations(1)
-            .Test(xnn_f16_gemm_ukernel_6x8__neonfp16arith_ld64);
+            .Test(xnn_f16_gemm_ukernel_4x8__neonfp16arith_ld64);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_6X8__NEONFP16ARITH_LD64, qmin) {
+  TEST(F16_GEMM_4X8__NEONFP16ARITH_LD64, qmin) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
-      .mr(6)
+      .mr(4)
       .nr(8)
       .kr(1)
       .sr(1)
-      .m(6)
+      .m(4)
       .n(8)
       .k(4)
       .qmin(128)
-      .Test(xnn_f16_gemm_ukernel_6x8__neonfp16arith_ld64);
+      .Test(xnn_f16_gemm_ukernel_4x8__neonfp16arith_ld64);
   }
 
-  TEST(F16_GEMM_6X8__NEONFP16ARITH_LD64, qmax) {
+  TEST(F16_GEMM_4X8__NEONFP16ARITH_LD64, qmax) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
-      .mr(6)
+      .mr(4)
       .nr(8)
       .kr(1)
       .sr(1)
-      .m(6)
+      .m(4)
       .n(8)
       .k(4)
       .qmax(128)
-      .Test(xnn_f16_gemm_ukernel_6x8__neonfp16arith_ld64);
+      .Test(xnn_f16_gemm_ukernel_4x8__neonfp16arith_ld64);
   }
 
-  TEST(F16_GEMM_6X8__NEONFP16ARITH_LD64, strided_cm) {
+  TEST(F16_GEMM_4X8__NEONFP16ARITH_LD64, strided_cm) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
-      .mr(6)
+      .mr(4)
       .nr(8)
       .kr(1)
       .sr(1)
-      .m(6)
+      .m(4)
       .n(8)
       .k(4)
       .cm_stride(11)
-      .Test(xnn_f16_gemm_ukernel_6x8__neonfp16arith_ld64);
+      .Test(xnn_f16_gemm_ukernel_4x8__neonfp16arith_ld64);
   }
 #endif  // XNN_ARCH_ARM64
 
 
 #if XNN_ARCH_ARM64
-  TEST(F16_GEMM_8X8__NEONFP16ARITH_LD64, k_eq_4) {
+  TEST(F16_GEMM_6X8__NEONFP16ARITH_LD64, k_eq_4) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
-      .mr(8)
+      .mr(6)
       .nr(8)
       .kr(1)
       .sr(1)
-      .m(8)
+      .m(6)
       .n(8)
       .k(4)
-      .Test(xnn_f16_gemm_ukernel_8x8__neonfp16arith_ld64);
+      .Test(xnn_f16_gemm_ukernel_6x8__neonfp16arith_ld64);
   }
 
-  TEST(F16_GEMM_8X8__NEONFP16ARITH_LD64, strided_cn) {
+  TEST(F16_GEMM_6X8__NEONFP16ARITH_LD64, strided_cn) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
-      .mr(8)
+      .mr(6)
       .nr(8)
       .kr(1)
       .sr(1)
-      .m(8)
+      .m(6)
       .n(8)
       .k(4)
       .cn_stride(11)
-      .Test(xnn_f16_gemm_ukernel_8x8__neonfp16arith_ld64);
+      .Test(xnn_f16_gemm_ukernel_6x8__neonfp16arith_ld64);
   }
 
-  TEST(F16_GEMM_8X8__NEONFP16ARITH_LD64, k_eq_4_strided_a) {
+  TEST(F16_GEMM_6X8__NEONFP16ARITH_LD64, k_eq_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
-      .mr(8)
+      .mr(6)
       .nr(8)
       .kr(1)
       .sr(1)
-      .m(8)
+      .m(6)
       .n(8)
       .k(4)
       .a_stride(7)
-      .Test(xnn_f16_gemm_ukernel_8x8__neonfp16arith_ld64);
+      .Test(xnn_f16_gemm_ukernel_6x8__neonfp16arith_ld64);
   }
 
-  TEST(F16_GEMM_8X8__NEONFP16ARITH_LD64, k_eq_4_subtile) {
+  TEST(F16_GEMM_6X8__NEONFP16ARITH_LD64, k_eq_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t m = 1; m <= 8; m++) {
+    for (uint32_t m = 1; m <= 6; m++) {
       for (uint32_t n = 1; n <= 8; n++) {
         GemmMicrokernelTester()
-          .mr(8)
+          .mr(6)
           .nr(8)
           .kr(1)
           .sr(1)
@@ -989,16 +989,16 @@
           .n(n)
           .k(4)
           .iterations(1)
-          .Test(xnn_f16_gemm_ukernel_8x8__neonfp16arith_ld64);
+          .Test(xnn_f16_gemm_ukernel_6x8__neonfp16arith_ld64);
       }
     }
   }
 
-  TEST(F16_GEMM_8X8__NEONFP16ARITH_LD64, k_eq_4_subtile_m) {
+  TEST(F16_GEMM_6X8__NEONFP16ARITH_LD64, k_eq_4_subtile_m) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
-    for (uint32_t m = 1; m <= 8; m++) {
+    for (uint32_t m = 1; m <= 6; m++) {
       GemmMicrokernelTester()
-        .mr(8)
+        .mr(6)
         .nr(8)
         .kr(1)
         .sr(1)
@@ -1006,64 +1006,64 @@
         .n(8)
         .k(4)
         .iterations(1)
-        .Test(xnn_f16_gemm_ukernel_8x8__neonfp16arith_ld64);
+        .Test(xnn_f16_gemm_ukernel_6x8__neonfp16arith_ld64);
     }
   }
 
-  TEST(F16_GEMM_8X8__NEONFP16ARITH_LD64, k_eq_4_subtile_n) {
+  TEST(F16_GEMM_6X8__NEONFP16ARITH_LD64, k_eq_4_subtile_n) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (uint32_t n = 1; n <= 8; n++) {
       GemmMicrokernelTester()
-        .mr(8)
+        .mr(6)
         .nr(8)
         .kr(1)
         .sr(1)
-        .m(8)
+        .m(6)
         .n(n)
         .k(4)
         .iterations(1)
-        .Test(xnn_f16_gemm_ukernel_8x8__neonfp16arith_ld64);
+        .Test(xnn_f16_gemm_ukernel_6x8__neonfp16arith_ld64);
     }
   }
 
-  TEST(F16_GEMM_8X8__NEONFP16ARITH_LD64, k_lt_4) {
+  TEST(F16_GEMM_6X8__NEONFP16ARITH_LD64, k_lt_4) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
-        .mr(8)
+        .mr(6)
         .nr(8)
         .kr(1)
         .sr(1)
-        .m(8)
+        .m(6)
         .n(8)
         .k(k)
-        .Test(xnn_f16_gemm_ukernel_8x8__neonfp16arith_ld64);
+        .Test(xnn_f16_gemm_ukernel_6x8__neonfp16arith_ld64);
     }
   }
 
-  TEST(F16_GEMM_8X8__NEONFP16ARITH_LD64, k_lt_4_strided_a) {
+  TEST(F16_GEMM_6X8__NEONFP16ARITH_LD64, k_lt_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 1; k < 4; k++) {
       GemmMicrokernelTester()
-        .mr(8)
+        .mr(6)
         .nr(8)
         .kr(1)
         .sr(1)
-        .m(8)
+        .m(6)
         .n(8)
         .k(k)
         .a_stride(7)
-        .Test(xnn_f16_gemm_ukernel_8x8__neonfp16arith_ld64);
+        .Test(xnn_f16_gemm_ukernel_6x8__neonfp16arith_ld64);
     }
   }
 
-  TEST(F16_GEMM_8X8__NEONFP16ARITH_LD64, k_lt_4_subtile) {
+  TEST(F16_GEMM_6X8__NEONFP16ARITH_LD64, k_lt_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 1; k < 4; k++) {
-      for (uint32_t m = 1; m <= 8; m++) {
+      for (uint32_t m = 1; m <= 6; m++) {
         for (uint32_t n = 1; n <= 8; n++) {
           GemmMicrokernelTester()
-            .mr(8)
+            .mr(6)
             .nr(8)
             .kr(1)
             .sr(1)
@@ -1071,50 +1071,50 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_ukernel_8x8__neonfp16arith_ld64);
+            .Test(xnn_f16_gemm_ukernel_6x8__neonfp16arith_ld64);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_8X8__NEONFP16ARITH_LD64, k_gt_4) {
+  TEST(F16_GEMM_6X8__NEONFP16ARITH_LD64, k_gt_4) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
-        .mr(8)
+        .mr(6)
         .nr(8)
         .kr(1)
         .sr(1)
-        .m(8)
+        .m(6)
         .n(8)
         .k(k)
-        .Test(xnn_f16_gemm_ukernel_8x8__neonfp16arith_ld64);
+        .Test(xnn_f16_gemm_ukernel_6x8__neonfp16arith_ld64);
     }
   }
 
-  TEST(F16_GEMM_8X8__NEONFP16ARITH_LD64, k_gt_4_strided_a) {
+  TEST(F16_GEMM_6X8__NEONFP16ARITH_LD64, k_gt_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 5; k < 8; k++) {
       GemmMicrokernelTester()
-        .mr(8)
+        .mr(6)
         .nr(8)
         .kr(1)
         .sr(1)
-        .m(8)
+        .m(6)
         .n(8)
         .k(k)
         .a_stride(11)
-        .Test(xnn_f16_gemm_ukernel_8x8__neonfp16arith_ld64);
+        .Test(xnn_f16_gemm_ukernel_6x8__neonfp16arith_ld64);
     }
   }
 
-  TEST(F16_GEMM_8X8__NEONFP16ARITH_LD64, k_gt_4_subtile) {
+  TEST(F16_GEMM_6X8__NEONFP16ARITH_LD64, k_gt_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 5; k < 8; k++) {
-      for (uint32_t m = 1; m <= 8; m++) {
+      for (uint32_t m = 1; m <= 6; m++) {
         for (uint32_t n = 1; n <= 8; n++) {
           GemmMicrokernelTester()
-            .mr(8)
+            .mr(6)
             .nr(8)
             .kr(1)
             .sr(1)
@@ -1122,50 +1122,50 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_ukernel_8x8__neonfp16arith_ld64);
+            .Test(xnn_f16_gemm_ukernel_6x8__neonfp16arith_ld64);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_8X8__NEONFP16ARITH_LD64, k_div_4) {
+  TEST(F16_GEMM_6X8__NEONFP16ARITH_LD64, k_div_4) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
-        .mr(8)
+        .mr(6)
         .nr(8)
         .kr(1)
         .sr(1)
-        .m(8)
+        .m(6)
         .n(8)
         .k(k)
-        .Test(xnn_f16_gemm_ukernel_8x8__neonfp16arith_ld64);
+        .Test(xnn_f16_gemm_ukernel_6x8__neonfp16arith_ld64);
     }
   }
 
-  TEST(F16_GEMM_8X8__NEONFP16ARITH_LD64, k_div_4_strided_a) {
+  TEST(F16_GEMM_6X8__NEONFP16ARITH_LD64, k_div_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 8; k <= 40; k += 4) {
       GemmMicrokernelTester()
-        .mr(8)
+        .mr(6)
         .nr(8)
         .kr(1)
         .sr(1)
-        .m(8)
+        .m(6)
         .n(8)
         .k(k)
         .a_stride(43)
-        .Test(xnn_f16_gemm_ukernel_8x8__neonfp16arith_ld64);
+        .Test(xnn_f16_gemm_ukernel_6x8__neonfp16arith_ld64);
     }
   }
 
-  TEST(F16_GEMM_8X8__NEONFP16ARITH_LD64, k_div_4_subtile) {
+  TEST(F16_GEMM_6X8__NEONFP16ARITH_LD64, k_div_4_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 8; k <= 40; k += 4) {
-      for (uint32_t m = 1; m <= 8; m++) {
+      for (uint32_t m = 1; m <= 6; m++) {
         for (uint32_t n = 1; n <= 8; n++) {
           GemmMicrokernelTester()
-            .mr(8)
+            .mr(6)
             .nr(8)
             .kr(1)
             .sr(1)
@@ -1173,72 +1173,72 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_ukernel_8x8__neonfp16arith_ld64);
+            .Test(xnn_f16_gemm_ukernel_6x8__neonfp16arith_ld64);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_8X8__NEONFP16ARITH_LD64, n_gt_8) {
+  TEST(F16_GEMM_6X8__NEONFP16ARITH_LD64, n_gt_8) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(8)
+          .mr(6)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(8)
+          .m(6)
           .n(8)
           .k(k)
-          .Test(xnn_f16_gemm_ukernel_8x8__neonfp16arith_ld64);
+          .Test(xnn_f16_gemm_ukernel_6x8__neonfp16arith_ld64);
       }
     }
   }
 
-  TEST(F16_GEMM_8X8__NEONFP16ARITH_LD64, n_gt_8_strided_cn) {
+  TEST(F16_GEMM_6X8__NEONFP16ARITH_LD64, n_gt_8_strided_cn) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(8)
+          .mr(6)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(8)
+          .m(6)
           .n(8)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f16_gemm_ukernel_8x8__neonfp16arith_ld64);
+          .Test(xnn_f16_gemm_ukernel_6x8__neonfp16arith_ld64);
       }
     }
   }
 
-  TEST(F16_GEMM_8X8__NEONFP16ARITH_LD64, n_gt_8_strided_a) {
+  TEST(F16_GEMM_6X8__NEONFP16ARITH_LD64, n_gt_8_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(8)
+          .mr(6)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(8)
+          .m(6)
           .n(n)
           .k(k)
           .a_stride(23)
-          .Test(xnn_f16_gemm_ukernel_8x8__neonfp16arith_ld64);
+          .Test(xnn_f16_gemm_ukernel_6x8__neonfp16arith_ld64);
       }
     }
   }
 
-  TEST(F16_GEMM_8X8__NEONFP16ARITH_LD64, n_gt_8_subtile) {
+  TEST(F16_GEMM_6X8__NEONFP16ARITH_LD64, n_gt_8_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (uint32_t n = 9; n < 16; n++) {
       for (size_t k = 1; k <= 20; k += 5) {
-        for (uint32_t m = 1; m <= 8; m++) {
+        for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
-            .mr(8)
+            .mr(6)
             .nr(8)
             .kr(1)
             .sr(1)
@@ -1246,72 +1246,72 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_ukernel_8x8__neonfp16arith_ld64);
+            .Test(xnn_f16_gemm_ukernel_6x8__neonfp16arith_ld64);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_8X8__NEONFP16ARITH_LD64, n_div_8) {
+  TEST(F16_GEMM_6X8__NEONFP16ARITH_LD64, n_div_8) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(8)
+          .mr(6)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(8)
+          .m(6)
           .n(8)
           .k(k)
-          .Test(xnn_f16_gemm_ukernel_8x8__neonfp16arith_ld64);
+          .Test(xnn_f16_gemm_ukernel_6x8__neonfp16arith_ld64);
       }
     }
   }
 
-  TEST(F16_GEMM_8X8__NEONFP16ARITH_LD64, n_div_8_strided_cn) {
+  TEST(F16_GEMM_6X8__NEONFP16ARITH_LD64, n_div_8_strided_cn) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(8)
+          .mr(6)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(8)
+          .m(6)
           .n(n)
           .k(k)
           .cn_stride(11)
-          .Test(xnn_f16_gemm_ukernel_8x8__neonfp16arith_ld64);
+          .Test(xnn_f16_gemm_ukernel_6x8__neonfp16arith_ld64);
       }
     }
   }
 
-  TEST(F16_GEMM_8X8__NEONFP16ARITH_LD64, n_div_8_strided_a) {
+  TEST(F16_GEMM_6X8__NEONFP16ARITH_LD64, n_div_8_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
         GemmMicrokernelTester()
-          .mr(8)
+          .mr(6)
           .nr(8)
           .kr(1)
           .sr(1)
-          .m(8)
+          .m(6)
           .n(n)
           .k(k)
           .a_stride(23)
-          .Test(xnn_f16_gemm_ukernel_8x8__neonfp16arith_ld64);
+          .Test(xnn_f16_gemm_ukernel_6x8__neonfp16arith_ld64);
       }
     }
   }
 
-  TEST(F16_GEMM_8X8__NEONFP16ARITH_LD64, n_div_8_subtile) {
+  TEST(F16_GEMM_6X8__NEONFP16ARITH_LD64, n_div_8_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (uint32_t n = 16; n <= 24; n += 8) {
       for (size_t k = 1; k <= 20; k += 5) {
-        for (uint32_t m = 1; m <= 8; m++) {
+        for (uint32_t m = 1; m <= 6; m++) {
           GemmMicrokernelTester()
-            .mr(8)
+            .mr(6)
             .nr(8)
             .kr(1)
             .sr(1)
@@ -1319,19 +1319,19 @@
             .n(n)
             .k(k)
             .iterations(1)
-            .Test(xnn_f16_gemm_ukernel_8x8__neonfp16arith_ld64);
+            .Test(xnn_f16_gemm_ukernel_6x8__neonfp16arith_ld64);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_8X8__NEONFP16ARITH_LD64, strided_cm_subtile) {
+  TEST(F16_GEMM_6X8__NEONFP16ARITH_LD64, strided_cm_subtile) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     for (size_t k = 1; k <= 20; k += 5) {
-      for (uint32_t m = 1; m <= 8; m++) {
+      for (uint32_t m = 1; m <= 6; m++) {
         for (uint32_t n = 1; n <= 8; n++) {
           GemmMicrokernelTester()
-            .mr(8)
+            .mr(6)
             .nr(8)
             .kr(1)
             .sr(1)
@@ -1340,13 +1340,58 @@
             .k(k)
             .cm_stride(11)
             .iterations(1)
-            .Test(xnn_f16_gemm_ukernel_8x8__neonfp16arith_ld64);
+            .Test(xnn_f16_gemm_ukernel_6x8__neonfp16arith_ld64);
         }
       }
     }
   }
 
-  TEST(F16_GEMM_8X8__NEONFP16ARITH_LD64, qmin) {
+  TEST(F16_GEMM_6X8__NEONFP16ARITH_LD64, qmin) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    GemmMicrokernelTester()
+      .mr(6)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(6)
+      .n(8)
+      .k(4)
+      .qmin(128)
+      .Test(xnn_f16_gemm_ukernel_6x8__neonfp16arith_ld64);
+  }
+
+  TEST(F16_GEMM_6X8__NEONFP16ARITH_LD64, qmax) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    GemmMicrokernelTester()
+      .mr(6)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(6)
+      .n(8)
+      .k(4)
+      .qmax(128)
+      .Test(xnn_f16_gemm_ukernel_6x8__neonfp16arith_ld64);
+  }
+
+  TEST(F16_GEMM_6X8__NEONFP16ARITH_LD64, strided_cm) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    GemmMicrokernelTester()
+      .mr(6)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(6)
+      .n(8)
+      .k(4)
+      .cm_stride(11)
+      .Test(xnn_f16_gemm_ukernel_6x8__neonfp16arith_ld64);
+  }
+#endif  // XNN_ARCH_ARM64
+
+
+#if XNN_ARCH_ARM64
+  TEST(F16_GEMM_8X8__NEONFP16ARITH_LD64, k_eq_4) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
       .mr(8)
@@ -1356,11 +1401,10 @@
       .m(8)
       .n(8)
       .k(4)
-      .qmin(128)
       .Test(xnn_f16_gemm_ukernel_8x8__neonfp16arith_ld64);
   }
 
-  TEST(F16_GEMM_8X8__NEONFP16ARITH_LD64, qmax) {
+  TEST(F16_GEMM_8X8__NEONFP16ARITH_LD64, strided_cn) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
       .mr(8)
@@ -1370,11 +1414,11 @@
       .m(8)
       .n(8)
       .k(4)
-      .qmax(128)
+      .cn_stride(11)
       .Test(xnn_f16_gemm_ukernel_8x8__neonfp16arith_ld64);
   }
 
-  TEST(F16_GEMM_8X8__NEONFP16ARITH_LD64, strided_cm) {
+  TEST(F16_GEMM_8X8__NEONFP16ARITH_LD64, k_eq_4_strided_a) {
     TEST_REQUIRES_ARM_NEON_FP16_ARITH;
     GemmMicrokernelTester()
       .mr(8)
@@ -1384,7 +1428,1789 @@
       .m(8)
       .n(8)
       .k(4)
-      .cm_stride(11)
+      .a_stride(7)
       .Test(xnn_f16_gemm_ukernel_8x8__neonfp16arith_ld64);
   }
-#endif  // XNN_ARCH_ARM64
+
+  TEST(F16_GEMM_8X8__NEONFP16ARITH_LD64, k_eq_4_subtile) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (uint32_t m = 1; m <= 8; m++) {
+      for (uint32_t n = 1; n <= 8; n++) {
+        GemmMicrokernelTester()
+          .mr(8)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(m)
+          .n(n)
+          .k(4)
+          .iterations(1)
+          .Test(xnn_f16_gemm_ukernel_8x8__neonfp16arith_ld64);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_8X8__NEONFP16ARITH_LD64, k_eq_4_subtile_m) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (uint32_t m = 1; m <= 8; m++) {
+      GemmMicrokernelTester()
+        .mr(8)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(m)
+        .n(8)
+        .k(4)
+        .iterations(1)
+        .Test(xnn_f16_gemm_ukernel_8x8__neonfp16arith_ld64);
+    }
+  }
+
+  TEST(F16_GEMM_8X8__NEONFP16ARITH_LD64, k_eq_4_subtile_n) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (uint32_t n = 1; n <= 8; n++) {
+      GemmMicrokernelTester()
+        .mr(8)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(8)
+        .n(n)
+        .k(4)
+        .iterations(1)
+        .Test(xnn_f16_gemm_ukernel_8x8__neonfp16arith_ld64);
+    }
+  }
+
+  TEST(F16_GEMM_8X8__NEONFP16ARITH_LD64, k_lt_4) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t k = 1; k < 4; k++) {
+      GemmMicrokernelTester()
+        .mr(8)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(8)
+        .n(8)
+        .k(k)
+        .Test(xnn_f16_gemm_ukernel_8x8__neonfp16arith_ld64);
+    }
+  }
+
+  TEST(F16_GEMM_8X8__NEONFP16ARITH_LD64, k_lt_4_strided_a) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t k = 1; k < 4; k++) {
+      GemmMicrokernelTester()
+        .mr(8)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(8)
+        .n(8)
+        .k(k)
+        .a_stride(7)
+        .Test(xnn_f16_gemm_ukernel_8x8__neonfp16arith_ld64);
+    }
+  }
+
+  TEST(F16_GEMM_8X8__NEONFP16ARITH_LD64, k_lt_4_subtile) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t k = 1; k < 4; k++) {
+      for (uint32_t m = 1; m <= 8; m++) {
+        for (uint32_t n = 1; n <= 8; n++) {
+          GemmMicrokernelTester()
+            .mr(8)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f16_gemm_ukernel_8x8__neonfp16arith_ld64);
+        }
+      }
+    }
+  }
+
+  TEST(F16_GEMM_8X8__NEONFP16ARITH_LD64, k_gt_4) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t k = 5; k < 8; k++) {
+      GemmMicrokernelTester()
+        .mr(8)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(8)
+        .n(8)
+        .k(k)
+        .Test(xnn_f16_gemm_ukernel_8x8__neonfp16arith_ld64);
+    }
+  }
+
+  TEST(F16_GEMM_8X8__NEONFP16ARITH_LD64, k_gt_4_strided_a) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t k = 5; k < 8; k++) {
+      GemmMicrokernelTester()
+        .mr(8)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(8)
+        .n(8)
+        .k(k)
+        .a_stride(11)
+        .Test(xnn_f16_gemm_ukernel_8x8__neonfp16arith_ld64);
+    }
+  }
+
+  TEST(F16_GEMM_8X8__NEONFP16ARITH_LD64, k_gt_4_subtile) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t k = 5; k < 8; k++) {
+      for (uint32_t m = 1; m <= 8; m++) {
+        for (uint32_t n = 1; n <= 8; n++) {
+          GemmMicrokernelTester()
+            .mr(8)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f16_gemm_ukernel_8x8__neonfp16arith_ld64);
+        }
+      }
+    }
+  }
+
+  TEST(F16_GEMM_8X8__NEONFP16ARITH_LD64, k_div_4) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t k = 8; k <= 40; k += 4) {
+      GemmMicrokernelTester()
+        .mr(8)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(8)
+        .n(8)
+        .k(k)
+        .Test(xnn_f16_gemm_ukernel_8x8__neonfp16arith_ld64);
+    }
+  }
+
+  TEST(F16_GEMM_8X8__NEONFP16ARITH_LD64, k_div_4_strided_a) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t k = 8; k <= 40; k += 4) {
+      GemmMicrokernelTester()
+        .mr(8)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(8)
+        .n(8)
+        .k(k)
+        .a_stride(43)
+        .Test(xnn_f16_gemm_ukernel_8x8__neonfp16arith_ld64);
+    }
+  }
+
+  TEST(F16_GEMM_8X8__NEONFP16ARITH_LD64, k_div_4_subtile) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t k = 8; k <= 40; k += 4) {
+      for (uint32_t m = 1; m <= 8; m++) {
+        for (uint32_t n = 1; n <= 8; n++) {
+          GemmMicrokernelTester()
+            .mr(8)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f16_gemm_ukernel_8x8__neonfp16arith_ld64);
+        }
+      }
+    }
+  }
+
+  TEST(F16_GEMM_8X8__NEONFP16ARITH_LD64, n_gt_8) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        GemmMicrokernelTester()
+          .mr(8)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(8)
+          .n(8)
+          .k(k)
+          .Test(xnn_f16_gemm_ukernel_8x8__neonfp16arith_ld64);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_8X8__NEONFP16ARITH_LD64, n_gt_8_strided_cn) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        GemmMicrokernelTester()
+          .mr(8)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(8)
+          .n(8)
+          .k(k)
+          .cn_stride(11)
+          .Test(xnn_f16_gemm_ukernel_8x8__neonfp16arith_ld64);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_8X8__NEONFP16ARITH_LD64, n_gt_8_strided_a) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        GemmMicrokernelTester()
+          .mr(8)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(8)
+          .n(n)
+          .k(k)
+          .a_stride(23)
+          .Test(xnn_f16_gemm_ukernel_8x8__neonfp16arith_ld64);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_8X8__NEONFP16ARITH_LD64, n_gt_8_subtile) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        for (uint32_t m = 1; m <= 8; m++) {
+          GemmMicrokernelTester()
+            .mr(8)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f16_gemm_ukernel_8x8__neonfp16arith_ld64);
+        }
+      }
+    }
+  }
+
+  TEST(F16_GEMM_8X8__NEONFP16ARITH_LD64, n_div_8) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        GemmMicrokernelTester()
+          .mr(8)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(8)
+          .n(8)
+          .k(k)
+          .Test(xnn_f16_gemm_ukernel_8x8__neonfp16arith_ld64);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_8X8__NEONFP16ARITH_LD64, n_div_8_strided_cn) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        GemmMicrokernelTester()
+          .mr(8)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(8)
+          .n(n)
+          .k(k)
+          .cn_stride(11)
+          .Test(xnn_f16_gemm_ukernel_8x8__neonfp16arith_ld64);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_8X8__NEONFP16ARITH_LD64, n_div_8_strided_a) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        GemmMicrokernelTester()
+          .mr(8)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(8)
+          .n(n)
+          .k(k)
+          .a_stride(23)
+          .Test(xnn_f16_gemm_ukernel_8x8__neonfp16arith_ld64);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_8X8__NEONFP16ARITH_LD64, n_div_8_subtile) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        for (uint32_t m = 1; m <= 8; m++) {
+          GemmMicrokernelTester()
+            .mr(8)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f16_gemm_ukernel_8x8__neonfp16arith_ld64);
+        }
+      }
+    }
+  }
+
+  TEST(F16_GEMM_8X8__NEONFP16ARITH_LD64, strided_cm_subtile) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t k = 1; k <= 20; k += 5) {
+      for (uint32_t m = 1; m <= 8; m++) {
+        for (uint32_t n = 1; n <= 8; n++) {
+          GemmMicrokernelTester()
+            .mr(8)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .cm_stride(11)
+            .iterations(1)
+            .Test(xnn_f16_gemm_ukernel_8x8__neonfp16arith_ld64);
+        }
+      }
+    }
+  }
+
+  TEST(F16_GEMM_8X8__NEONFP16ARITH_LD64, qmin) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    GemmMicrokernelTester()
+      .mr(8)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(8)
+      .n(8)
+      .k(4)
+      .qmin(128)
+      .Test(xnn_f16_gemm_ukernel_8x8__neonfp16arith_ld64);
+  }
+
+  TEST(F16_GEMM_8X8__NEONFP16ARITH_LD64, qmax) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    GemmMicrokernelTester()
+      .mr(8)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(8)
+      .n(8)
+      .k(4)
+      .qmax(128)
+      .Test(xnn_f16_gemm_ukernel_8x8__neonfp16arith_ld64);
+  }
+
+  TEST(F16_GEMM_8X8__NEONFP16ARITH_LD64, strided_cm) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    GemmMicrokernelTester()
+      .mr(8)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(8)
+      .n(8)
+      .k(4)
+      .cm_stride(11)
+      .Test(xnn_f16_gemm_ukernel_8x8__neonfp16arith_ld64);
+  }
+#endif  // XNN_ARCH_ARM64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F16_GEMM_1X8__F16C, k_eq_1) {
+    TEST_REQUIRES_X86_F16C;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(8)
+      .k(1)
+      .Test(xnn_f16_gemm_ukernel_1x8__f16c);
+  }
+
+  TEST(F16_GEMM_1X8__F16C, strided_cn) {
+    TEST_REQUIRES_X86_F16C;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(8)
+      .k(1)
+      .cn_stride(11)
+      .Test(xnn_f16_gemm_ukernel_1x8__f16c);
+  }
+
+  TEST(F16_GEMM_1X8__F16C, k_eq_1_strided_a) {
+    TEST_REQUIRES_X86_F16C;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(8)
+      .k(1)
+      .a_stride(3)
+      .Test(xnn_f16_gemm_ukernel_1x8__f16c);
+  }
+
+  TEST(F16_GEMM_1X8__F16C, k_eq_1_subtile) {
+    TEST_REQUIRES_X86_F16C;
+    for (uint32_t m = 1; m <= 1; m++) {
+      for (uint32_t n = 1; n <= 8; n++) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(m)
+          .n(n)
+          .k(1)
+          .iterations(1)
+          .Test(xnn_f16_gemm_ukernel_1x8__f16c);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_1X8__F16C, k_eq_1_subtile_m) {
+    TEST_REQUIRES_X86_F16C;
+    for (uint32_t m = 1; m <= 1; m++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(m)
+        .n(8)
+        .k(1)
+        .iterations(1)
+        .Test(xnn_f16_gemm_ukernel_1x8__f16c);
+    }
+  }
+
+  TEST(F16_GEMM_1X8__F16C, k_eq_1_subtile_n) {
+    TEST_REQUIRES_X86_F16C;
+    for (uint32_t n = 1; n <= 8; n++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(n)
+        .k(1)
+        .iterations(1)
+        .Test(xnn_f16_gemm_ukernel_1x8__f16c);
+    }
+  }
+
+  TEST(F16_GEMM_1X8__F16C, k_gt_1) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t k = 2; k < 10; k++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(8)
+        .k(k)
+        .Test(xnn_f16_gemm_ukernel_1x8__f16c);
+    }
+  }
+
+  TEST(F16_GEMM_1X8__F16C, k_gt_1_strided_a) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t k = 2; k < 10; k++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(8)
+        .k(k)
+        .a_stride(11)
+        .Test(xnn_f16_gemm_ukernel_1x8__f16c);
+    }
+  }
+
+  TEST(F16_GEMM_1X8__F16C, k_gt_1_subtile) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t k = 2; k < 10; k++) {
+      for (uint32_t m = 1; m <= 1; m++) {
+        for (uint32_t n = 1; n <= 8; n++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f16_gemm_ukernel_1x8__f16c);
+        }
+      }
+    }
+  }
+
+  TEST(F16_GEMM_1X8__F16C, n_gt_8) {
+    TEST_REQUIRES_X86_F16C;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(8)
+          .k(k)
+          .Test(xnn_f16_gemm_ukernel_1x8__f16c);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_1X8__F16C, n_gt_8_strided_cn) {
+    TEST_REQUIRES_X86_F16C;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(8)
+          .k(k)
+          .cn_stride(11)
+          .Test(xnn_f16_gemm_ukernel_1x8__f16c);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_1X8__F16C, n_gt_8_strided_a) {
+    TEST_REQUIRES_X86_F16C;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .a_stride(7)
+          .Test(xnn_f16_gemm_ukernel_1x8__f16c);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_1X8__F16C, n_gt_8_subtile) {
+    TEST_REQUIRES_X86_F16C;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        for (uint32_t m = 1; m <= 1; m++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f16_gemm_ukernel_1x8__f16c);
+        }
+      }
+    }
+  }
+
+  TEST(F16_GEMM_1X8__F16C, n_div_8) {
+    TEST_REQUIRES_X86_F16C;
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(8)
+          .k(k)
+          .Test(xnn_f16_gemm_ukernel_1x8__f16c);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_1X8__F16C, n_div_8_strided_cn) {
+    TEST_REQUIRES_X86_F16C;
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .cn_stride(11)
+          .Test(xnn_f16_gemm_ukernel_1x8__f16c);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_1X8__F16C, n_div_8_strided_a) {
+    TEST_REQUIRES_X86_F16C;
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .a_stride(7)
+          .Test(xnn_f16_gemm_ukernel_1x8__f16c);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_1X8__F16C, n_div_8_subtile) {
+    TEST_REQUIRES_X86_F16C;
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        for (uint32_t m = 1; m <= 1; m++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f16_gemm_ukernel_1x8__f16c);
+        }
+      }
+    }
+  }
+
+  TEST(F16_GEMM_1X8__F16C, strided_cm_subtile) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t k = 1; k <= 5; k += 2) {
+      for (uint32_t m = 1; m <= 1; m++) {
+        for (uint32_t n = 1; n <= 8; n++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .cm_stride(11)
+            .iterations(1)
+            .Test(xnn_f16_gemm_ukernel_1x8__f16c);
+        }
+      }
+    }
+  }
+
+  TEST(F16_GEMM_1X8__F16C, qmin) {
+    TEST_REQUIRES_X86_F16C;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(8)
+      .k(1)
+      .qmin(128)
+      .Test(xnn_f16_gemm_ukernel_1x8__f16c);
+  }
+
+  TEST(F16_GEMM_1X8__F16C, qmax) {
+    TEST_REQUIRES_X86_F16C;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(8)
+      .k(1)
+      .qmax(128)
+      .Test(xnn_f16_gemm_ukernel_1x8__f16c);
+  }
+
+  TEST(F16_GEMM_1X8__F16C, strided_cm) {
+    TEST_REQUIRES_X86_F16C;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(8)
+      .k(1)
+      .cm_stride(11)
+      .Test(xnn_f16_gemm_ukernel_1x8__f16c);
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F16_GEMM_4X8__F16C, k_eq_1) {
+    TEST_REQUIRES_X86_F16C;
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(4)
+      .n(8)
+      .k(1)
+      .Test(xnn_f16_gemm_ukernel_4x8__f16c);
+  }
+
+  TEST(F16_GEMM_4X8__F16C, strided_cn) {
+    TEST_REQUIRES_X86_F16C;
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(4)
+      .n(8)
+      .k(1)
+      .cn_stride(11)
+      .Test(xnn_f16_gemm_ukernel_4x8__f16c);
+  }
+
+  TEST(F16_GEMM_4X8__F16C, k_eq_1_strided_a) {
+    TEST_REQUIRES_X86_F16C;
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(4)
+      .n(8)
+      .k(1)
+      .a_stride(3)
+      .Test(xnn_f16_gemm_ukernel_4x8__f16c);
+  }
+
+  TEST(F16_GEMM_4X8__F16C, k_eq_1_subtile) {
+    TEST_REQUIRES_X86_F16C;
+    for (uint32_t m = 1; m <= 4; m++) {
+      for (uint32_t n = 1; n <= 8; n++) {
+        GemmMicrokernelTester()
+          .mr(4)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(m)
+          .n(n)
+          .k(1)
+          .iterations(1)
+          .Test(xnn_f16_gemm_ukernel_4x8__f16c);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_4X8__F16C, k_eq_1_subtile_m) {
+    TEST_REQUIRES_X86_F16C;
+    for (uint32_t m = 1; m <= 4; m++) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(m)
+        .n(8)
+        .k(1)
+        .iterations(1)
+        .Test(xnn_f16_gemm_ukernel_4x8__f16c);
+    }
+  }
+
+  TEST(F16_GEMM_4X8__F16C, k_eq_1_subtile_n) {
+    TEST_REQUIRES_X86_F16C;
+    for (uint32_t n = 1; n <= 8; n++) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(4)
+        .n(n)
+        .k(1)
+        .iterations(1)
+        .Test(xnn_f16_gemm_ukernel_4x8__f16c);
+    }
+  }
+
+  TEST(F16_GEMM_4X8__F16C, k_gt_1) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t k = 2; k < 10; k++) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(4)
+        .n(8)
+        .k(k)
+        .Test(xnn_f16_gemm_ukernel_4x8__f16c);
+    }
+  }
+
+  TEST(F16_GEMM_4X8__F16C, k_gt_1_strided_a) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t k = 2; k < 10; k++) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(4)
+        .n(8)
+        .k(k)
+        .a_stride(11)
+        .Test(xnn_f16_gemm_ukernel_4x8__f16c);
+    }
+  }
+
+  TEST(F16_GEMM_4X8__F16C, k_gt_1_subtile) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t k = 2; k < 10; k++) {
+      for (uint32_t m = 1; m <= 4; m++) {
+        for (uint32_t n = 1; n <= 8; n++) {
+          GemmMicrokernelTester()
+            .mr(4)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f16_gemm_ukernel_4x8__f16c);
+        }
+      }
+    }
+  }
+
+  TEST(F16_GEMM_4X8__F16C, n_gt_8) {
+    TEST_REQUIRES_X86_F16C;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(4)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(4)
+          .n(8)
+          .k(k)
+          .Test(xnn_f16_gemm_ukernel_4x8__f16c);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_4X8__F16C, n_gt_8_strided_cn) {
+    TEST_REQUIRES_X86_F16C;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(4)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(4)
+          .n(8)
+          .k(k)
+          .cn_stride(11)
+          .Test(xnn_f16_gemm_ukernel_4x8__f16c);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_4X8__F16C, n_gt_8_strided_a) {
+    TEST_REQUIRES_X86_F16C;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(4)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(4)
+          .n(n)
+          .k(k)
+          .a_stride(7)
+          .Test(xnn_f16_gemm_ukernel_4x8__f16c);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_4X8__F16C, n_gt_8_subtile) {
+    TEST_REQUIRES_X86_F16C;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        for (uint32_t m = 1; m <= 4; m++) {
+          GemmMicrokernelTester()
+            .mr(4)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f16_gemm_ukernel_4x8__f16c);
+        }
+      }
+    }
+  }
+
+  TEST(F16_GEMM_4X8__F16C, n_div_8) {
+    TEST_REQUIRES_X86_F16C;
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(4)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(4)
+          .n(8)
+          .k(k)
+          .Test(xnn_f16_gemm_ukernel_4x8__f16c);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_4X8__F16C, n_div_8_strided_cn) {
+    TEST_REQUIRES_X86_F16C;
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(4)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(4)
+          .n(n)
+          .k(k)
+          .cn_stride(11)
+          .Test(xnn_f16_gemm_ukernel_4x8__f16c);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_4X8__F16C, n_div_8_strided_a) {
+    TEST_REQUIRES_X86_F16C;
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(4)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(4)
+          .n(n)
+          .k(k)
+          .a_stride(7)
+          .Test(xnn_f16_gemm_ukernel_4x8__f16c);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_4X8__F16C, n_div_8_subtile) {
+    TEST_REQUIRES_X86_F16C;
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        for (uint32_t m = 1; m <= 4; m++) {
+          GemmMicrokernelTester()
+            .mr(4)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f16_gemm_ukernel_4x8__f16c);
+        }
+      }
+    }
+  }
+
+  TEST(F16_GEMM_4X8__F16C, strided_cm_subtile) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t k = 1; k <= 5; k += 2) {
+      for (uint32_t m = 1; m <= 4; m++) {
+        for (uint32_t n = 1; n <= 8; n++) {
+          GemmMicrokernelTester()
+            .mr(4)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .cm_stride(11)
+            .iterations(1)
+            .Test(xnn_f16_gemm_ukernel_4x8__f16c);
+        }
+      }
+    }
+  }
+
+  TEST(F16_GEMM_4X8__F16C, qmin) {
+    TEST_REQUIRES_X86_F16C;
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(4)
+      .n(8)
+      .k(1)
+      .qmin(128)
+      .Test(xnn_f16_gemm_ukernel_4x8__f16c);
+  }
+
+  TEST(F16_GEMM_4X8__F16C, qmax) {
+    TEST_REQUIRES_X86_F16C;
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(4)
+      .n(8)
+      .k(1)
+      .qmax(128)
+      .Test(xnn_f16_gemm_ukernel_4x8__f16c);
+  }
+
+  TEST(F16_GEMM_4X8__F16C, strided_cm) {
+    TEST_REQUIRES_X86_F16C;
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(4)
+      .n(8)
+      .k(1)
+      .cm_stride(11)
+      .Test(xnn_f16_gemm_ukernel_4x8__f16c);
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+TEST(F16_GEMM_1X4__SCALAR, k_eq_1) {
+  GemmMicrokernelTester()
+    .mr(1)
+    .nr(4)
+    .kr(1)
+    .sr(1)
+    .m(1)
+    .n(4)
+    .k(1)
+    .Test(xnn_f16_gemm_ukernel_1x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+}
+
+TEST(F16_GEMM_1X4__SCALAR, strided_cn) {
+  GemmMicrokernelTester()
+    .mr(1)
+    .nr(4)
+    .kr(1)
+    .sr(1)
+    .m(1)
+    .n(4)
+    .k(1)
+    .cn_stride(7)
+    .Test(xnn_f16_gemm_ukernel_1x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+}
+
+TEST(F16_GEMM_1X4__SCALAR, k_eq_1_strided_a) {
+  GemmMicrokernelTester()
+    .mr(1)
+    .nr(4)
+    .kr(1)
+    .sr(1)
+    .m(1)
+    .n(4)
+    .k(1)
+    .a_stride(3)
+    .Test(xnn_f16_gemm_ukernel_1x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+}
+
+TEST(F16_GEMM_1X4__SCALAR, k_eq_1_subtile) {
+  for (uint32_t m = 1; m <= 1; m++) {
+    for (uint32_t n = 1; n <= 4; n++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(4)
+        .kr(1)
+        .sr(1)
+        .m(m)
+        .n(n)
+        .k(1)
+        .iterations(1)
+        .Test(xnn_f16_gemm_ukernel_1x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+    }
+  }
+}
+
+TEST(F16_GEMM_1X4__SCALAR, k_eq_1_subtile_m) {
+  for (uint32_t m = 1; m <= 1; m++) {
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(4)
+      .kr(1)
+      .sr(1)
+      .m(m)
+      .n(4)
+      .k(1)
+      .iterations(1)
+      .Test(xnn_f16_gemm_ukernel_1x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F16_GEMM_1X4__SCALAR, k_eq_1_subtile_n) {
+  for (uint32_t n = 1; n <= 4; n++) {
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(4)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(n)
+      .k(1)
+      .iterations(1)
+      .Test(xnn_f16_gemm_ukernel_1x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F16_GEMM_1X4__SCALAR, k_gt_1) {
+  for (size_t k = 2; k < 10; k++) {
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(4)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(4)
+      .k(k)
+      .Test(xnn_f16_gemm_ukernel_1x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F16_GEMM_1X4__SCALAR, k_gt_1_strided_a) {
+  for (size_t k = 2; k < 10; k++) {
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(4)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(4)
+      .k(k)
+      .a_stride(11)
+      .Test(xnn_f16_gemm_ukernel_1x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F16_GEMM_1X4__SCALAR, k_gt_1_subtile) {
+  for (size_t k = 2; k < 10; k++) {
+    for (uint32_t m = 1; m <= 1; m++) {
+      for (uint32_t n = 1; n <= 4; n++) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(4)
+          .kr(1)
+          .sr(1)
+          .m(m)
+          .n(n)
+          .k(k)
+          .iterations(1)
+          .Test(xnn_f16_gemm_ukernel_1x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+      }
+    }
+  }
+}
+
+TEST(F16_GEMM_1X4__SCALAR, n_gt_4) {
+  for (uint32_t n = 5; n < 8; n++) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(4)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(4)
+        .k(k)
+        .Test(xnn_f16_gemm_ukernel_1x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+    }
+  }
+}
+
+TEST(F16_GEMM_1X4__SCALAR, n_gt_4_strided_cn) {
+  for (uint32_t n = 5; n < 8; n++) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(4)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(4)
+        .k(k)
+        .cn_stride(7)
+        .Test(xnn_f16_gemm_ukernel_1x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+    }
+  }
+}
+
+TEST(F16_GEMM_1X4__SCALAR, n_gt_4_strided_a) {
+  for (uint32_t n = 5; n < 8; n++) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(4)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(n)
+        .k(k)
+        .a_stride(7)
+        .Test(xnn_f16_gemm_ukernel_1x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+    }
+  }
+}
+
+TEST(F16_GEMM_1X4__SCALAR, n_gt_4_subtile) {
+  for (uint32_t n = 5; n < 8; n++) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      for (uint32_t m = 1; m <= 1; m++) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(4)
+          .kr(1)
+          .sr(1)
+          .m(m)
+          .n(n)
+          .k(k)
+          .iterations(1)
+          .Test(xnn_f16_gemm_ukernel_1x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+      }
+    }
+  }
+}
+
+TEST(F16_GEMM_1X4__SCALAR, n_div_4) {
+  for (uint32_t n = 8; n <= 12; n += 4) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(4)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(4)
+        .k(k)
+        .Test(xnn_f16_gemm_ukernel_1x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+    }
+  }
+}
+
+TEST(F16_GEMM_1X4__SCALAR, n_div_4_strided_cn) {
+  for (uint32_t n = 8; n <= 12; n += 4) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(4)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(n)
+        .k(k)
+        .cn_stride(7)
+        .Test(xnn_f16_gemm_ukernel_1x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+    }
+  }
+}
+
+TEST(F16_GEMM_1X4__SCALAR, n_div_4_strided_a) {
+  for (uint32_t n = 8; n <= 12; n += 4) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(4)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(n)
+        .k(k)
+        .a_stride(7)
+        .Test(xnn_f16_gemm_ukernel_1x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+    }
+  }
+}
+
+TEST(F16_GEMM_1X4__SCALAR, n_div_4_subtile) {
+  for (uint32_t n = 8; n <= 12; n += 4) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      for (uint32_t m = 1; m <= 1; m++) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(4)
+          .kr(1)
+          .sr(1)
+          .m(m)
+          .n(n)
+          .k(k)
+          .iterations(1)
+          .Test(xnn_f16_gemm_ukernel_1x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+      }
+    }
+  }
+}
+
+TEST(F16_GEMM_1X4__SCALAR, strided_cm_subtile) {
+  for (size_t k = 1; k <= 5; k += 2) {
+    for (uint32_t m = 1; m <= 1; m++) {
+      for (uint32_t n = 1; n <= 4; n++) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(4)
+          .kr(1)
+          .sr(1)
+          .m(m)
+          .n(n)
+          .k(k)
+          .cm_stride(7)
+          .iterations(1)
+          .Test(xnn_f16_gemm_ukernel_1x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+      }
+    }
+  }
+}
+
+TEST(F16_GEMM_1X4__SCALAR, qmin) {
+  GemmMicrokernelTester()
+    .mr(1)
+    .nr(4)
+    .kr(1)
+    .sr(1)
+    .m(1)
+    .n(4)
+    .k(1)
+    .qmin(128)
+    .Test(xnn_f16_gemm_ukernel_1x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+}
+
+TEST(F16_GEMM_1X4__SCALAR, qmax) {
+  GemmMicrokernelTester()
+    .mr(1)
+    .nr(4)
+    .kr(1)
+    .sr(1)
+    .m(1)
+    .n(4)
+    .k(1)
+    .qmax(128)
+    .Test(xnn_f16_gemm_ukernel_1x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+}
+
+TEST(F16_GEMM_1X4__SCALAR, strided_cm) {
+  GemmMicrokernelTester()
+    .mr(1)
+    .nr(4)
+    .kr(1)
+    .sr(1)
+    .m(1)
+    .n(4)
+    .k(1)
+    .cm_stride(7)
+    .Test(xnn_f16_gemm_ukernel_1x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+}
+
+
+TEST(F16_GEMM_4X4__SCALAR, k_eq_1) {
+  GemmMicrokernelTester()
+    .mr(4)
+    .nr(4)
+    .kr(1)
+    .sr(1)
+    .m(4)
+    .n(4)
+    .k(1)
+    .Test(xnn_f16_gemm_ukernel_4x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+}
+
+TEST(F16_GEMM_4X4__SCALAR, strided_cn) {
+  GemmMicrokernelTester()
+    .mr(4)
+    .nr(4)
+    .kr(1)
+    .sr(1)
+    .m(4)
+    .n(4)
+    .k(1)
+    .cn_stride(7)
+    .Test(xnn_f16_gemm_ukernel_4x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+}
+
+TEST(F16_GEMM_4X4__SCALAR, k_eq_1_strided_a) {
+  GemmMicrokernelTester()
+    .mr(4)
+    .nr(4)
+    .kr(1)
+    .sr(1)
+    .m(4)
+    .n(4)
+    .k(1)
+    .a_stride(3)
+    .Test(xnn_f16_gemm_ukernel_4x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+}
+
+TEST(F16_GEMM_4X4__SCALAR, k_eq_1_subtile) {
+  for (uint32_t m = 1; m <= 4; m++) {
+    for (uint32_t n = 1; n <= 4; n++) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(4)
+        .kr(1)
+        .sr(1)
+        .m(m)
+        .n(n)
+        .k(1)
+        .iterations(1)
+        .Test(xnn_f16_gemm_ukernel_4x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+    }
+  }
+}
+
+TEST(F16_GEMM_4X4__SCALAR, k_eq_1_subtile_m) {
+  for (uint32_t m = 1; m <= 4; m++) {
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(4)
+      .kr(1)
+      .sr(1)
+      .m(m)
+      .n(4)
+      .k(1)
+      .iterations(1)
+      .Test(xnn_f16_gemm_ukernel_4x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F16_GEMM_4X4__SCALAR, k_eq_1_subtile_n) {
+  for (uint32_t n = 1; n <= 4; n++) {
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(4)
+      .kr(1)
+      .sr(1)
+      .m(4)
+      .n(n)
+      .k(1)
+      .iterations(1)
+      .Test(xnn_f16_gemm_ukernel_4x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F16_GEMM_4X4__SCALAR, k_gt_1) {
+  for (size_t k = 2; k < 10; k++) {
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(4)
+      .kr(1)
+      .sr(1)
+      .m(4)
+      .n(4)
+      .k(k)
+      .Test(xnn_f16_gemm_ukernel_4x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F16_GEMM_4X4__SCALAR, k_gt_1_strided_a) {
+  for (size_t k = 2; k < 10; k++) {
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(4)
+      .kr(1)
+      .sr(1)
+      .m(4)
+      .n(4)
+      .k(k)
+      .a_stride(11)
+      .Test(xnn_f16_gemm_ukernel_4x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F16_GEMM_4X4__SCALAR, k_gt_1_subtile) {
+  for (size_t k = 2; k < 10; k++) {
+    for (uint32_t m = 1; m <= 4; m++) {
+      for (uint32_t n = 1; n <= 4; n++) {
+        GemmMicrokernelTester()
+          .mr(4)
+          .nr(4)
+          .kr(1)
+          .sr(1)
+          .m(m)
+          .n(n)
+          .k(k)
+          .iterations(1)
+          .Test(xnn_f16_gemm_ukernel_4x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+      }
+    }
+  }
+}
+
+TEST(F16_GEMM_4X4__SCALAR, n_gt_4) {
+  for (uint32_t n = 5; n < 8; n++) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(4)
+        .kr(1)
+        .sr(1)
+        .m(4)
+        .n(4)
+        .k(k)
+        .Test(xnn_f16_gemm_ukernel_4x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+    }
+  }
+}
+
+TEST(F16_GEMM_4X4__SCALAR, n_gt_4_strided_cn) {
+  for (uint32_t n = 5; n < 8; n++) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(4)
+        .kr(1)
+        .sr(1)
+        .m(4)
+        .n(4)
+        .k(k)
+        .cn_stride(7)
+        .Test(xnn_f16_gemm_ukernel_4x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+    }
+  }
+}
+
+TEST(F16_GEMM_4X4__SCALAR, n_gt_4_strided_a) {
+  for (uint32_t n = 5; n < 8; n++) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(4)
+        .kr(1)
+        .sr(1)
+        .m(4)
+        .n(n)
+        .k(k)
+        .a_stride(7)
+        .Test(xnn_f16_gemm_ukernel_4x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+    }
+  }
+}
+
+TEST(F16_GEMM_4X4__SCALAR, n_gt_4_subtile) {
+  for (uint32_t n = 5; n < 8; n++) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      for (uint32_t m = 1; m <= 4; m++) {
+        GemmMicrokernelTester()
+          .mr(4)
+          .nr(4)
+          .kr(1)
+          .sr(1)
+          .m(m)
+          .n(n)
+          .k(k)
+          .iterations(1)
+          .Test(xnn_f16_gemm_ukernel_4x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+      }
+    }
+  }
+}
+
+TEST(F16_GEMM_4X4__SCALAR, n_div_4) {
+  for (uint32_t n = 8; n <= 12; n += 4) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(4)
+        .kr(1)
+        .sr(1)
+        .m(4)
+        .n(4)
+        .k(k)
+        .Test(xnn_f16_gemm_ukernel_4x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+    }
+  }
+}
+
+TEST(F16_GEMM_4X4__SCALAR, n_div_4_strided_cn) {
+  for (uint32_t n = 8; n <= 12; n += 4) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(4)
+        .kr(1)
+        .sr(1)
+        .m(4)
+        .n(n)
+        .k(k)
+        .cn_stride(7)
+        .Test(xnn_f16_gemm_ukernel_4x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+    }
+  }
+}
+
+TEST(F16_GEMM_4X4__SCALAR, n_div_4_strided_a) {
+  for (uint32_t n = 8; n <= 12; n += 4) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(4)
+        .kr(1)
+        .sr(1)
+        .m(4)
+        .n(n)
+        .k(k)
+        .a_stride(7)
+        .Test(xnn_f16_gemm_ukernel_4x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+    }
+  }
+}
+
+TEST(F16_GEMM_4X4__SCALAR, n_div_4_subtile) {
+  for (uint32_t n = 8; n <= 12; n += 4) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      for (uint32_t m = 1; m <= 4; m++) {
+        GemmMicrokernelTester()
+          .mr(4)
+          .nr(4)
+          .kr(1)
+          .sr(1)
+          .m(m)
+          .n(n)
+          .k(k)
+          .iterations(1)
+          .Test(xnn_f16_gemm_ukernel_4x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+      }
+    }
+  }
+}
+
+TEST(F16_GEMM_4X4__SCALAR, strided_cm_subtile) {
+  for (size_t k = 1; k <= 5; k += 2) {
+    for (uint32_t m = 1; m <= 4; m++) {
+      for (uint32_t n = 1; n <= 4; n++) {
+        GemmMicrokernelTester()
+          .mr(4)
+          .nr(4)
+          .kr(1)
+          .sr(1)
+          .m(m)
+          .n(n)
+          .k(k)
+          .cm_stride(7)
+          .iterations(1)
+          .Test(xnn_f16_gemm_ukernel_4x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+      }
+    }
+  }
+}
+
+TEST(F16_GEMM_4X4__SCALAR, qmin) {
+  GemmMicrokernelTester()
+    .mr(4)
+    .nr(4)
+    .kr(1)
+    .sr(1)
+    .m(4)
+    .n(4)
+    .k(1)
+    .qmin(128)
+    .Test(xnn_f16_gemm_ukernel_4x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+}
+
+TEST(F16_GEMM_4X4__SCALAR, qmax) {
+  GemmMicrokernelTester()
+    .mr(4)
+    .nr(4)
+    .kr(1)
+    .sr(1)
+    .m(4)
+    .n(4)
+    .k(1)
+    .qmax(128)
+    .Test(xnn_f16_gemm_ukernel_4x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+}
+
+TEST(F16_GEMM_4X4__SCALAR, strided_cm) {
+  GemmMicrokernelTester()
+    .mr(4)
+    .nr(4)
+    .kr(1)
+    .sr(1)
+    .m(4)
+    .n(4)
+    .k(1)
+    .cm_stride(7)
+    .Test(xnn_f16_gemm_ukernel_4x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+}
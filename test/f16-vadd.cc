@@ -0,0 +1,320 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <gtest/gtest.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/isa-checks.h>
+
+#include <xnnpack/vadd.h>
+#include "vadd-microkernel-tester.h"
+
+
+#if XNN_ARCH_ARM64
+  TEST(F16_VADD__NEONFP16ARITH, n_eq_4) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    VAddMicrokernelTester()
+      .n(4)
+      .Test(xnn_f16_vadd_ukernel__neonfp16arith);
+  }
+
+  TEST(F16_VADD__NEONFP16ARITH, n_eq_8) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    VAddMicrokernelTester()
+      .n(8)
+      .Test(xnn_f16_vadd_ukernel__neonfp16arith);
+  }
+
+  TEST(F16_VADD__NEONFP16ARITH, n_eq_12) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    VAddMicrokernelTester()
+      .n(12)
+      .Test(xnn_f16_vadd_ukernel__neonfp16arith);
+  }
+
+  TEST(F16_VADD__NEONFP16ARITH, n_div_8) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t n = 8; n < 128; n += 24) {
+      VAddMicrokernelTester()
+        .n(n)
+        .Test(xnn_f16_vadd_ukernel__neonfp16arith);
+    }
+  }
+
+  TEST(F16_VADD__NEONFP16ARITH, n_gt_8) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t n = 9; n < 16; n++) {
+      VAddMicrokernelTester()
+        .n(n)
+        .Test(xnn_f16_vadd_ukernel__neonfp16arith);
+    }
+  }
+
+  TEST(F16_VADD__NEONFP16ARITH, n_lt_8) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t n = 1; n < 8; n++) {
+      VAddMicrokernelTester()
+        .n(n)
+        .Test(xnn_f16_vadd_ukernel__neonfp16arith);
+    }
+  }
+
+  TEST(F16_VADD__NEONFP16ARITH, inplace_a) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t n = 1; n < 128; n += 11) {
+      VAddMicrokernelTester()
+        .iterations(1)
+        .n(n)
+        .inplace_a(true)
+        .Test(xnn_f16_vadd_ukernel__neonfp16arith);
+    }
+  }
+
+  TEST(F16_VADD__NEONFP16ARITH, inplace_b) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t n = 1; n < 128; n += 11) {
+      VAddMicrokernelTester()
+        .iterations(1)
+        .n(n)
+        .inplace_b(true)
+        .Test(xnn_f16_vadd_ukernel__neonfp16arith);
+    }
+  }
+
+  TEST(F16_VADD__NEONFP16ARITH, inplace_a_and_b) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t n = 1; n < 128; n += 11) {
+      VAddMicrokernelTester()
+        .iterations(1)
+        .n(n)
+        .inplace_a(true)
+        .inplace_b(true)
+        .Test(xnn_f16_vadd_ukernel__neonfp16arith);
+    }
+  }
+
+  TEST(F16_VADD__NEONFP16ARITH, qmin) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t n = 1; n < 128; n += 11) {
+      VAddMicrokernelTester()
+        .iterations(1)
+        .n(n)
+        .qmin(128)
+        .Test(xnn_f16_vadd_ukernel__neonfp16arith);
+    }
+  }
+
+  TEST(F16_VADD__NEONFP16ARITH, qmax) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t n = 1; n < 128; n += 11) {
+      VAddMicrokernelTester()
+        .iterations(1)
+        .n(n)
+        .qmax(128)
+        .Test(xnn_f16_vadd_ukernel__neonfp16arith);
+    }
+  }
+#endif  // XNN_ARCH_ARM64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F16_VADD__F16C, n_eq_4) {
+    TEST_REQUIRES_X86_F16C;
+    VAddMicrokernelTester()
+      .n(4)
+      .Test(xnn_f16_vadd_ukernel__f16c);
+  }
+
+  TEST(F16_VADD__F16C, n_eq_8) {
+    TEST_REQUIRES_X86_F16C;
+    VAddMicrokernelTester()
+      .n(8)
+      .Test(xnn_f16_vadd_ukernel__f16c);
+  }
+
+  TEST(F16_VADD__F16C, n_eq_12) {
+    TEST_REQUIRES_X86_F16C;
+    VAddMicrokernelTester()
+      .n(12)
+      .Test(xnn_f16_vadd_ukernel__f16c);
+  }
+
+  TEST(F16_VADD__F16C, n_div_8) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t n = 8; n < 128; n += 24) {
+      VAddMicrokernelTester()
+        .n(n)
+        .Test(xnn_f16_vadd_ukernel__f16c);
+    }
+  }
+
+  TEST(F16_VADD__F16C, n_gt_8) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t n = 9; n < 16; n++) {
+      VAddMicrokernelTester()
+        .n(n)
+        .Test(xnn_f16_vadd_ukernel__f16c);
+    }
+  }
+
+  TEST(F16_VADD__F16C, n_lt_8) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t n = 1; n < 8; n++) {
+      VAddMicrokernelTester()
+        .n(n)
+        .Test(xnn_f16_vadd_ukernel__f16c);
+    }
+  }
+
+  TEST(F16_VADD__F16C, inplace_a) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t n = 1; n < 128; n += 11) {
+      VAddMicrokernelTester()
+        .iterations(1)
+        .n(n)
+        .inplace_a(true)
+        .Test(xnn_f16_vadd_ukernel__f16c);
+    }
+  }
+
+  TEST(F16_VADD__F16C, inplace_b) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t n = 1; n < 128; n += 11) {
+      VAddMicrokernelTester()
+        .iterations(1)
+        .n(n)
+        .inplace_b(true)
+        .Test(xnn_f16_vadd_ukernel__f16c);
+    }
+  }
+
+  TEST(F16_VADD__F16C, inplace_a_and_b) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t n = 1; n < 128; n += 11) {
+      VAddMicrokernelTester()
+        .iterations(1)
+        .n(n)
+        .inplace_a(true)
+        .inplace_b(true)
+        .Test(xnn_f16_vadd_ukernel__f16c);
+    }
+  }
+
+  TEST(F16_VADD__F16C, qmin) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t n = 1; n < 128; n += 11) {
+      VAddMicrokernelTester()
+        .iterations(1)
+        .n(n)
+        .qmin(128)
+        .Test(xnn_f16_vadd_ukernel__f16c);
+    }
+  }
+
+  TEST(F16_VADD__F16C, qmax) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t n = 1; n < 128; n += 11) {
+      VAddMicrokernelTester()
+        .iterations(1)
+        .n(n)
+        .qmax(128)
+        .Test(xnn_f16_vadd_ukernel__f16c);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+TEST(F16_VADD__SCALAR, n_eq_1) {
+  VAddMicrokernelTester()
+    .n(1)
+    .Test(xnn_f16_vadd_ukernel__scalar, VAddMicrokernelTester::Variant::Scalar);
+}
+
+TEST(F16_VADD__SCALAR, n_eq_2) {
+  VAddMicrokernelTester()
+    .n(2)
+    .Test(xnn_f16_vadd_ukernel__scalar, VAddMicrokernelTester::Variant::Scalar);
+}
+
+TEST(F16_VADD__SCALAR, n_eq_3) {
+  VAddMicrokernelTester()
+    .n(3)
+    .Test(xnn_f16_vadd_ukernel__scalar, VAddMicrokernelTester::Variant::Scalar);
+}
+
+TEST(F16_VADD__SCALAR, n_div_2) {
+  for (size_t n = 2; n < 16; n += 6) {
+    VAddMicrokernelTester()
+      .n(n)
+      .Test(xnn_f16_vadd_ukernel__scalar, VAddMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F16_VADD__SCALAR, n_gt_2) {
+  for (size_t n = 3; n < 4; n++) {
+    VAddMicrokernelTester()
+      .n(n)
+      .Test(xnn_f16_vadd_ukernel__scalar, VAddMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F16_VADD__SCALAR, n_lt_2) {
+  for (size_t n = 1; n < 2; n++) {
+    VAddMicrokernelTester()
+      .n(n)
+      .Test(xnn_f16_vadd_ukernel__scalar, VAddMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F16_VADD__SCALAR, inplace_a) {
+  for (size_t n = 1; n < 16; n += 3) {
+    VAddMicrokernelTester()
+      .iterations(1)
+      .n(n)
+      .inplace_a(true)
+      .Test(xnn_f16_vadd_ukernel__scalar, VAddMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F16_VADD__SCALAR, inplace_b) {
+  for (size_t n = 1; n < 16; n += 3) {
+    VAddMicrokernelTester()
+      .iterations(1)
+      .n(n)
+      .inplace_b(true)
+      .Test(xnn_f16_vadd_ukernel__scalar, VAddMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F16_VADD__SCALAR, inplace_a_and_b) {
+  for (size_t n = 1; n < 16; n += 3) {
+    VAddMicrokernelTester()
+      .iterations(1)
+      .n(n)
+      .inplace_a(true)
+      .inplace_b(true)
+      .Test(xnn_f16_vadd_ukernel__scalar, VAddMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F16_VADD__SCALAR, qmin) {
+  for (size_t n = 1; n < 16; n += 3) {
+    VAddMicrokernelTester()
+      .iterations(1)
+      .n(n)
+      .qmin(128)
+      .Test(xnn_f16_vadd_ukernel__scalar, VAddMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F16_VADD__SCALAR, qmax) {
+  for (size_t n = 1; n < 16; n += 3) {
+    VAddMicrokernelTester()
+      .iterations(1)
+      .n(n)
+      .qmax(128)
+      .Test(xnn_f16_vadd_ukernel__scalar, VAddMicrokernelTester::Variant::Scalar);
+  }
+}
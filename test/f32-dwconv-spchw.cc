@@ -363,6 +363,360 @@
 #endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
 
 
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV_SPCHW_5X5P2__SSE, input_width_eq_4) {
+    TEST_REQUIRES_X86_SSE;
+    DWConvSpCHWMicrokernelTester()
+      .input_tuple_size(4)
+      .output_tuple_size(4)
+      .input_width(4)
+      .padding_left(2)
+      .padding_right(2)
+      .kernel_height(5)
+      .kernel_width(5)
+      .output_height(1)
+      .Test(xnn_f32_dwconv_spchw_ukernel_5x5p2__sse);
+  }
+
+  TEST(F32_DWCONV_SPCHW_5X5P2__SSE, input_width_lt_4) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t input_width = 1; input_width < 4; input_width++) {
+      DWConvSpCHWMicrokernelTester()
+        .input_tuple_size(4)
+        .output_tuple_size(4)
+        .input_width(input_width)
+        .padding_left(2)
+        .padding_right(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .output_height(1)
+        .Test(xnn_f32_dwconv_spchw_ukernel_5x5p2__sse);
+    }
+  }
+
+  TEST(F32_DWCONV_SPCHW_5X5P2__SSE, input_width_gt_4) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t input_width = 5; input_width < 8; input_width++) {
+      DWConvSpCHWMicrokernelTester()
+        .input_tuple_size(4)
+        .output_tuple_size(4)
+        .input_width(input_width)
+        .padding_left(2)
+        .padding_right(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .output_height(1)
+        .Test(xnn_f32_dwconv_spchw_ukernel_5x5p2__sse);
+    }
+  }
+
+  TEST(F32_DWCONV_SPCHW_5X5P2__SSE, input_width_div_4) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t input_width = 8; input_width < 32; input_width += 4) {
+      DWConvSpCHWMicrokernelTester()
+        .input_tuple_size(4)
+        .output_tuple_size(4)
+        .input_width(input_width)
+        .padding_left(2)
+        .padding_right(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .output_height(1)
+        .Test(xnn_f32_dwconv_spchw_ukernel_5x5p2__sse);
+    }
+  }
+
+  TEST(F32_DWCONV_SPCHW_5X5P2__SSE, input_width_stride) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t input_width = 1; input_width < 32; input_width += 3) {
+      DWConvSpCHWMicrokernelTester()
+        .input_tuple_size(4)
+        .output_tuple_size(4)
+        .input_width(input_width)
+        .input_width_stride(36)
+        .padding_left(2)
+        .padding_right(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .output_height(1)
+        .Test(xnn_f32_dwconv_spchw_ukernel_5x5p2__sse);
+    }
+  }
+
+  TEST(F32_DWCONV_SPCHW_5X5P2__SSE, input_tuple_stride) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t input_width = 1; input_width < 32; input_width += 5) {
+      DWConvSpCHWMicrokernelTester()
+        .input_tuple_size(4)
+        .output_tuple_size(4)
+        .input_width(input_width)
+        .input_width_stride(4)
+        .input_tuple_stride(3 * 4)
+        .padding_left(2)
+        .padding_right(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .output_height(1)
+        .Test(xnn_f32_dwconv_spchw_ukernel_5x5p2__sse);
+    }
+  }
+
+  TEST(F32_DWCONV_SPCHW_5X5P2__SSE, output_height_gt_1) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t output_height = 2; output_height < 5; output_height++) {
+      for (size_t input_width = 1; input_width < 32; input_width += 3) {
+        DWConvSpCHWMicrokernelTester()
+          .input_tuple_size(4)
+          .output_tuple_size(4)
+          .input_width(input_width)
+          .padding_left(2)
+          .padding_right(2)
+          .kernel_height(5)
+          .kernel_width(5)
+          .output_height(output_height)
+          .Test(xnn_f32_dwconv_spchw_ukernel_5x5p2__sse);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV_SPCHW_5X5P2__SSE, output_width_stride) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t input_width = 1; input_width < 32; input_width += 3) {
+      DWConvSpCHWMicrokernelTester()
+        .input_tuple_size(4)
+        .output_tuple_size(4)
+        .input_width(input_width)
+        .padding_left(2)
+        .padding_right(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .output_height(5)
+        .output_width_stride(36)
+        .Test(xnn_f32_dwconv_spchw_ukernel_5x5p2__sse);
+    }
+  }
+
+  TEST(F32_DWCONV_SPCHW_5X5P2__SSE, output_tuple_stride) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t input_width = 1; input_width < 32; input_width += 3) {
+      DWConvSpCHWMicrokernelTester()
+        .input_tuple_size(4)
+        .output_tuple_size(4)
+        .input_width(input_width)
+        .padding_left(2)
+        .padding_right(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .output_height(5)
+        .output_width_stride(4)
+        .output_tuple_stride(5 * 4)
+        .Test(xnn_f32_dwconv_spchw_ukernel_5x5p2__sse);
+    }
+  }
+
+  TEST(F32_DWCONV_SPCHW_5X5P2__SSE, chw_layout) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t input_width = 1; input_width < 32; input_width += 3) {
+      for (size_t output_height = 1; output_height < 32; output_height += 3) {
+        DWConvSpCHWMicrokernelTester()
+          .input_tuple_size(4)
+          .output_tuple_size(4)
+          .input_width(input_width)
+          .input_width_stride(input_width)
+          .padding_left(2)
+          .padding_right(2)
+          .kernel_height(5)
+          .kernel_width(5)
+          .output_height(5)
+          .output_width_stride(input_width)
+          .Test(xnn_f32_dwconv_spchw_ukernel_5x5p2__sse);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV_SPCHW_5X5S2P2__SSE, input_width_eq_8) {
+    TEST_REQUIRES_X86_SSE;
+    DWConvSpCHWMicrokernelTester()
+      .input_tuple_size(4)
+      .output_tuple_size(4)
+      .input_width(8)
+      .padding_left(2)
+      .padding_right(2)
+      .kernel_height(5)
+      .kernel_width(5)
+      .subsampling(2)
+      .output_height(1)
+      .Test(xnn_f32_dwconv_spchw_ukernel_5x5s2p2__sse);
+  }
+
+  TEST(F32_DWCONV_SPCHW_5X5S2P2__SSE, input_width_lt_8) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t input_width = 1; input_width < 8; input_width++) {
+      DWConvSpCHWMicrokernelTester()
+        .input_tuple_size(4)
+        .output_tuple_size(4)
+        .input_width(input_width)
+        .padding_left(2)
+        .padding_right(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .output_height(1)
+        .Test(xnn_f32_dwconv_spchw_ukernel_5x5s2p2__sse);
+    }
+  }
+
+  TEST(F32_DWCONV_SPCHW_5X5S2P2__SSE, input_width_gt_8) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t input_width = 8; input_width < 16; input_width++) {
+      DWConvSpCHWMicrokernelTester()
+        .input_tuple_size(4)
+        .output_tuple_size(4)
+        .input_width(input_width)
+        .padding_left(2)
+        .padding_right(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .output_height(1)
+        .Test(xnn_f32_dwconv_spchw_ukernel_5x5s2p2__sse);
+    }
+  }
+
+  TEST(F32_DWCONV_SPCHW_5X5S2P2__SSE, input_width_div_4) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t input_width = 16; input_width < 32; input_width += 4) {
+      DWConvSpCHWMicrokernelTester()
+        .input_tuple_size(4)
+        .output_tuple_size(4)
+        .input_width(input_width)
+        .padding_left(2)
+        .padding_right(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .output_height(1)
+        .Test(xnn_f32_dwconv_spchw_ukernel_5x5s2p2__sse);
+    }
+  }
+
+  TEST(F32_DWCONV_SPCHW_5X5S2P2__SSE, input_width_stride) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t input_width = 1; input_width < 32; input_width += 3) {
+      DWConvSpCHWMicrokernelTester()
+        .input_tuple_size(4)
+        .output_tuple_size(4)
+        .input_width(input_width)
+        .input_width_stride(36)
+        .padding_left(2)
+        .padding_right(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .output_height(1)
+        .Test(xnn_f32_dwconv_spchw_ukernel_5x5s2p2__sse);
+    }
+  }
+
+  TEST(F32_DWCONV_SPCHW_5X5S2P2__SSE, input_tuple_stride) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t input_width = 1; input_width < 32; input_width += 5) {
+      DWConvSpCHWMicrokernelTester()
+        .input_tuple_size(4)
+        .output_tuple_size(4)
+        .input_width(input_width)
+        .input_width_stride(4)
+        .input_tuple_stride(3 * 4)
+        .padding_left(2)
+        .padding_right(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .output_height(1)
+        .Test(xnn_f32_dwconv_spchw_ukernel_5x5s2p2__sse);
+    }
+  }
+
+  TEST(F32_DWCONV_SPCHW_5X5S2P2__SSE, output_height_gt_1) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t output_height = 3; output_height < 4; output_height++) {
+      for (size_t input_width = 4; input_width < 5; input_width += 3) {
+        DWConvSpCHWMicrokernelTester()
+          .input_tuple_size(4)
+          .output_tuple_size(4)
+          .input_width(input_width)
+          .padding_left(2)
+          .padding_right(2)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(2)
+          .output_height(output_height)
+          .Test(xnn_f32_dwconv_spchw_ukernel_5x5s2p2__sse);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV_SPCHW_5X5S2P2__SSE, output_width_stride) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t input_width = 1; input_width < 32; input_width += 3) {
+      DWConvSpCHWMicrokernelTester()
+        .input_tuple_size(4)
+        .output_tuple_size(4)
+        .input_width(input_width)
+        .padding_left(2)
+        .padding_right(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .output_height(5)
+        .output_width_stride(36)
+        .Test(xnn_f32_dwconv_spchw_ukernel_5x5s2p2__sse);
+    }
+  }
+
+  TEST(F32_DWCONV_SPCHW_5X5S2P2__SSE, output_tuple_stride) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t input_width = 1; input_width < 32; input_width += 3) {
+      DWConvSpCHWMicrokernelTester()
+        .input_tuple_size(4)
+        .output_tuple_size(4)
+        .input_width(input_width)
+        .padding_left(2)
+        .padding_right(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .output_height(5)
+        .output_width_stride(4)
+        .output_tuple_stride(5 * 4)
+        .Test(xnn_f32_dwconv_spchw_ukernel_5x5s2p2__sse);
+    }
+  }
+
+  TEST(F32_DWCONV_SPCHW_5X5S2P2__SSE, chw_layout) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t input_width = 1; input_width < 32; input_width += 1) {
+      DWConvSpCHWMicrokernelTester()
+        .input_tuple_size(4)
+        .output_tuple_size(4)
+        .input_width(input_width)
+        .input_width_stride(input_width)
+        .padding_left(2)
+        .padding_right(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .output_height(5)
+        .output_width_stride((input_width - 1) / 2 + 1)
+        .Test(xnn_f32_dwconv_spchw_ukernel_5x5s2p2__sse);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
 #if XNN_ARCH_ARM64
   TEST(F32_DWCONV_SPCHW_3X3P1__NEONFMA, input_width_eq_4) {
     TEST_REQUIRES_ARM_NEON_FMA;
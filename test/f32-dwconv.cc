@@ -665,187 +665,949 @@
 #endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
 
 
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  TEST(F32_DWCONV_MP4X4__NEONFMA, c_eq_4) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    DWConvMicrokernelTester()
+      .cr(4)
+      .kr(9)
+      .channels(4)
+      .Test(xnn_f32_dwconv_ukernel_mp4x4__neonfma);
+  }
+
+  TEST(F32_DWCONV_MP4X4__NEONFMA, c_div_4) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (uint32_t channels = 8; channels < 64; channels += 12) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .kr(9)
+        .channels(channels)
+        .Test(xnn_f32_dwconv_ukernel_mp4x4__neonfma);
+    }
+  }
+
+  TEST(F32_DWCONV_MP4X4__NEONFMA, c_div_4_with_qmin) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (uint32_t channels = 8; channels < 64; channels += 12) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .kr(9)
+        .channels(channels)
+        .qmin(128)
+        .Test(xnn_f32_dwconv_ukernel_mp4x4__neonfma);
+    }
+  }
+
+  TEST(F32_DWCONV_MP4X4__NEONFMA, c_div_4_with_qmax) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (uint32_t channels = 8; channels < 64; channels += 12) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .kr(9)
+        .channels(channels)
+        .qmax(128)
+        .Test(xnn_f32_dwconv_ukernel_mp4x4__neonfma);
+    }
+  }
+
+  TEST(F32_DWCONV_MP4X4__NEONFMA, c_lt_4) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (uint32_t channels = 1; channels < 4; channels++) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .kr(9)
+        .channels(channels)
+        .Test(xnn_f32_dwconv_ukernel_mp4x4__neonfma);
+    }
+  }
+
+  TEST(F32_DWCONV_MP4X4__NEONFMA, c_gt_4) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (uint32_t channels = 5; channels < 8; channels++) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .kr(9)
+        .channels(channels)
+        .Test(xnn_f32_dwconv_ukernel_mp4x4__neonfma);
+    }
+  }
+
+  TEST(F32_DWCONV_MP4X4__NEONFMA, c_gt_4_with_qmin) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (uint32_t channels = 5; channels < 8; channels++) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .kr(9)
+        .channels(channels)
+        .qmin(128)
+        .Test(xnn_f32_dwconv_ukernel_mp4x4__neonfma);
+    }
+  }
+
+  TEST(F32_DWCONV_MP4X4__NEONFMA, c_gt_4_with_qmax) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (uint32_t channels = 5; channels < 8; channels++) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .kr(9)
+        .channels(channels)
+        .qmax(128)
+        .Test(xnn_f32_dwconv_ukernel_mp4x4__neonfma);
+    }
+  }
+
+  TEST(F32_DWCONV_MP4X4__NEONFMA, multipixel) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (size_t channels = 1; channels <= 20; channels += 3) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .kr(9)
+        .channels(channels)
+        .width(3)
+        .Test(xnn_f32_dwconv_ukernel_mp4x4__neonfma);
+    }
+  }
+
+  TEST(F32_DWCONV_MP4X4__NEONFMA, multipixel_with_step) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (size_t channels = 1; channels <= 20; channels += 3) {
+      for (size_t step = 2; step <= 9; step++) {
+        DWConvMicrokernelTester()
+          .cr(4)
+          .kr(9)
+          .channels(channels)
+          .width(3)
+          .step(step)
+          .Test(xnn_f32_dwconv_ukernel_mp4x4__neonfma);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV_MP4X4__NEONFMA, multipixel_with_output_stride) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (size_t channels = 1; channels <= 20; channels += 3) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .kr(9)
+        .channels(4)
+        .width(5)
+        .output_stride(23)
+        .Test(xnn_f32_dwconv_ukernel_mp4x4__neonfma);
+    }
+  }
+
+  TEST(F32_DWCONV_MP4X4__NEONFMA, multipixel_with_qmin) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (size_t channels = 1; channels <= 20; channels += 3) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .kr(9)
+        .channels(channels)
+        .width(3)
+        .qmin(128)
+        .Test(xnn_f32_dwconv_ukernel_mp4x4__neonfma);
+    }
+  }
+
+  TEST(F32_DWCONV_MP4X4__NEONFMA, multipixel_with_qmax) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (size_t channels = 1; channels <= 20; channels += 3) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .kr(9)
+        .channels(channels)
+        .width(3)
+        .qmax(128)
+        .Test(xnn_f32_dwconv_ukernel_mp4x4__neonfma);
+    }
+  }
+
+  TEST(F32_DWCONV_MP4X4__NEONFMA, kernel_size_lt_4) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (uint32_t kernel_size = 1; kernel_size < 4; kernel_size++) {
+      for (uint32_t channels = 1; channels <= 12; channels += 3) {
+        DWConvMicrokernelTester()
+          .cr(4)
+          .kr(kernel_size)
+          .channels(channels)
+          .Test(xnn_f32_dwconv_ukernel_mp4x4__neonfma);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV_MP4X4__NEONFMA, kernel_size_eq_4) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (uint32_t channels = 1; channels <= 12; channels += 3) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .kr(4)
+        .channels(channels)
+        .Test(xnn_f32_dwconv_ukernel_mp4x4__neonfma);
+    }
+  }
+
+  TEST(F32_DWCONV_MP4X4__NEONFMA, kernel_size_div_4) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (uint32_t kernel_size = 8; kernel_size <= 16; kernel_size += 4) {
+      for (uint32_t channels = 1; channels <= 12; channels += 3) {
+        DWConvMicrokernelTester()
+          .cr(4)
+          .kr(kernel_size)
+          .channels(channels)
+          .Test(xnn_f32_dwconv_ukernel_mp4x4__neonfma);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV_MP4X4__NEONFMA, kernel_size_gt_4) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (uint32_t kernel_size = 5; kernel_size < 8; kernel_size++) {
+      for (uint32_t channels = 1; channels <= 12; channels += 3) {
+        DWConvMicrokernelTester()
+          .cr(4)
+          .kr(kernel_size)
+          .channels(channels)
+          .Test(xnn_f32_dwconv_ukernel_mp4x4__neonfma);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV_MP4X4__NEONFMA, kernel_size_eq_49) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (uint32_t channels = 1; channels <= 12; channels += 3) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .kr(49)
+        .channels(channels)
+        .width(3)
+        .step(7)
+        .Test(xnn_f32_dwconv_ukernel_mp4x4__neonfma);
+    }
+  }
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  TEST(F32_DWCONV_MP4X4__NEON, c_eq_4) {
+    TEST_REQUIRES_ARM_NEON;
+    DWConvMicrokernelTester()
+      .cr(4)
+      .kr(9)
+      .channels(4)
+      .Test(xnn_f32_dwconv_ukernel_mp4x4__neon);
+  }
+
+  TEST(F32_DWCONV_MP4X4__NEON, c_div_4) {
+    TEST_REQUIRES_ARM_NEON;
+    for (uint32_t channels = 8; channels < 64; channels += 12) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .kr(9)
+        .channels(channels)
+        .Test(xnn_f32_dwconv_ukernel_mp4x4__neon);
+    }
+  }
+
+  TEST(F32_DWCONV_MP4X4__NEON, c_div_4_with_qmin) {
+    TEST_REQUIRES_ARM_NEON;
+    for (uint32_t channels = 8; channels < 64; channels += 12) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .kr(9)
+        .channels(channels)
+        .qmin(128)
+        .Test(xnn_f32_dwconv_ukernel_mp4x4__neon);
+    }
+  }
+
+  TEST(F32_DWCONV_MP4X4__NEON, c_div_4_with_qmax) {
+    TEST_REQUIRES_ARM_NEON;
+    for (uint32_t channels = 8; channels < 64; channels += 12) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .kr(9)
+        .channels(channels)
+        .qmax(128)
+        .Test(xnn_f32_dwconv_ukernel_mp4x4__neon);
+    }
+  }
+
+  TEST(F32_DWCONV_MP4X4__NEON, c_lt_4) {
+    TEST_REQUIRES_ARM_NEON;
+    for (uint32_t channels = 1; channels < 4; channels++) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .kr(9)
+        .channels(channels)
+        .Test(xnn_f32_dwconv_ukernel_mp4x4__neon);
+    }
+  }
+
+  TEST(F32_DWCONV_MP4X4__NEON, c_gt_4) {
+    TEST_REQUIRES_ARM_NEON;
+    for (uint32_t channels = 5; channels < 8; channels++) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .kr(9)
+        .channels(channels)
+        .Test(xnn_f32_dwconv_ukernel_mp4x4__neon);
+    }
+  }
+
+  TEST(F32_DWCONV_MP4X4__NEON, c_gt_4_with_qmin) {
+    TEST_REQUIRES_ARM_NEON;
+    for (uint32_t channels = 5; channels < 8; channels++) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .kr(9)
+        .channels(channels)
+        .qmin(128)
+        .Test(xnn_f32_dwconv_ukernel_mp4x4__neon);
+    }
+  }
+
+  TEST(F32_DWCONV_MP4X4__NEON, c_gt_4_with_qmax) {
+    TEST_REQUIRES_ARM_NEON;
+    for (uint32_t channels = 5; channels < 8; channels++) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .kr(9)
+        .channels(channels)
+        .qmax(128)
+        .Test(xnn_f32_dwconv_ukernel_mp4x4__neon);
+    }
+  }
+
+  TEST(F32_DWCONV_MP4X4__NEON, multipixel) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 1; channels <= 20; channels += 3) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .kr(9)
+        .channels(channels)
+        .width(3)
+        .Test(xnn_f32_dwconv_ukernel_mp4x4__neon);
+    }
+  }
+
+  TEST(F32_DWCONV_MP4X4__NEON, multipixel_with_step) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 1; channels <= 20; channels += 3) {
+      for (size_t step = 2; step <= 9; step++) {
+        DWConvMicrokernelTester()
+          .cr(4)
+          .kr(9)
+          .channels(channels)
+          .width(3)
+          .step(step)
+          .Test(xnn_f32_dwconv_ukernel_mp4x4__neon);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV_MP4X4__NEON, multipixel_with_output_stride) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 1; channels <= 20; channels += 3) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .kr(9)
+        .channels(4)
+        .width(5)
+        .output_stride(23)
+        .Test(xnn_f32_dwconv_ukernel_mp4x4__neon);
+    }
+  }
+
+  TEST(F32_DWCONV_MP4X4__NEON, multipixel_with_qmin) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 1; channels <= 20; channels += 3) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .kr(9)
+        .channels(channels)
+        .width(3)
+        .qmin(128)
+        .Test(xnn_f32_dwconv_ukernel_mp4x4__neon);
+    }
+  }
+
+  TEST(F32_DWCONV_MP4X4__NEON, multipixel_with_qmax) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 1; channels <= 20; channels += 3) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .kr(9)
+        .channels(channels)
+        .width(3)
+        .qmax(128)
+        .Test(xnn_f32_dwconv_ukernel_mp4x4__neon);
+    }
+  }
+
+  TEST(F32_DWCONV_MP4X4__NEON, kernel_size_lt_4) {
+    TEST_REQUIRES_ARM_NEON;
+    for (uint32_t kernel_size = 1; kernel_size < 4; kernel_size++) {
+      for (uint32_t channels = 1; channels <= 12; channels += 3) {
+        DWConvMicrokernelTester()
+          .cr(4)
+          .kr(kernel_size)
+          .channels(channels)
+          .Test(xnn_f32_dwconv_ukernel_mp4x4__neon);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV_MP4X4__NEON, kernel_size_eq_4) {
+    TEST_REQUIRES_ARM_NEON;
+    for (uint32_t channels = 1; channels <= 12; channels += 3) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .kr(4)
+        .channels(channels)
+        .Test(xnn_f32_dwconv_ukernel_mp4x4__neon);
+    }
+  }
+
+  TEST(F32_DWCONV_MP4X4__NEON, kernel_size_div_4) {
+    TEST_REQUIRES_ARM_NEON;
+    for (uint32_t kernel_size = 8; kernel_size <= 16; kernel_size += 4) {
+      for (uint32_t channels = 1; channels <= 12; channels += 3) {
+        DWConvMicrokernelTester()
+          .cr(4)
+          .kr(kernel_size)
+          .channels(channels)
+          .Test(xnn_f32_dwconv_ukernel_mp4x4__neon);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV_MP4X4__NEON, kernel_size_gt_4) {
+    TEST_REQUIRES_ARM_NEON;
+    for (uint32_t kernel_size = 5; kernel_size < 8; kernel_size++) {
+      for (uint32_t channels = 1; channels <= 12; channels += 3) {
+        DWConvMicrokernelTester()
+          .cr(4)
+          .kr(kernel_size)
+          .channels(channels)
+          .Test(xnn_f32_dwconv_ukernel_mp4x4__neon);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV_MP4X4__NEON, kernel_size_eq_49) {
+    TEST_REQUIRES_ARM_NEON;
+    for (uint32_t channels = 1; channels <= 12; channels += 3) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .kr(49)
+        .channels(channels)
+        .width(3)
+        .step(7)
+        .Test(xnn_f32_dwconv_ukernel_mp4x4__neon);
+    }
+  }
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV_UP4X25__SSE, c_eq_4) {
+    TEST_REQUIRES_X86_SSE;
+    DWConvMicrokernelTester()
+      .cr(4)
+      .kr(25)
+      .channels(4)
+      .Test(xnn_f32_dwconv_ukernel_up4x25__sse);
+  }
+
+  TEST(F32_DWCONV_UP4X25__SSE, c_div_4) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t channels = 8; channels < 64; channels += 12) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .kr(25)
+        .channels(channels)
+        .Test(xnn_f32_dwconv_ukernel_up4x25__sse);
+    }
+  }
+
+  TEST(F32_DWCONV_UP4X25__SSE, c_div_4_with_qmin) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t channels = 8; channels < 64; channels += 12) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .kr(25)
+        .channels(channels)
+        .qmin(128)
+        .Test(xnn_f32_dwconv_ukernel_up4x25__sse);
+    }
+  }
+
+  TEST(F32_DWCONV_UP4X25__SSE, c_div_4_with_qmax) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t channels = 8; channels < 64; channels += 12) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .kr(25)
+        .channels(channels)
+        .qmax(128)
+        .Test(xnn_f32_dwconv_ukernel_up4x25__sse);
+    }
+  }
+
+  TEST(F32_DWCONV_UP4X25__SSE, c_lt_4) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t channels = 1; channels < 4; channels++) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .kr(25)
+        .channels(channels)
+        .Test(xnn_f32_dwconv_ukernel_up4x25__sse);
+    }
+  }
+
+  TEST(F32_DWCONV_UP4X25__SSE, c_gt_4) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t channels = 5; channels < 8; channels++) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .kr(25)
+        .channels(channels)
+        .Test(xnn_f32_dwconv_ukernel_up4x25__sse);
+    }
+  }
+
+  TEST(F32_DWCONV_UP4X25__SSE, c_gt_4_with_qmin) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t channels = 5; channels < 8; channels++) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .kr(25)
+        .channels(channels)
+        .qmin(128)
+        .Test(xnn_f32_dwconv_ukernel_up4x25__sse);
+    }
+  }
+
+  TEST(F32_DWCONV_UP4X25__SSE, c_gt_4_with_qmax) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t channels = 5; channels < 8; channels++) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .kr(25)
+        .channels(channels)
+        .qmax(128)
+        .Test(xnn_f32_dwconv_ukernel_up4x25__sse);
+    }
+  }
+
+  TEST(F32_DWCONV_UP4X25__SSE, multipixel) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 1; channels <= 20; channels += 3) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .kr(25)
+        .channels(channels)
+        .width(3)
+        .Test(xnn_f32_dwconv_ukernel_up4x25__sse);
+    }
+  }
+
+  TEST(F32_DWCONV_UP4X25__SSE, multipixel_with_step) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 1; channels <= 20; channels += 3) {
+      for (size_t step = 2; step <= 25; step++) {
+        DWConvMicrokernelTester()
+          .cr(4)
+          .kr(25)
+          .channels(channels)
+          .width(3)
+          .step(step)
+          .Test(xnn_f32_dwconv_ukernel_up4x25__sse);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV_UP4X25__SSE, multipixel_with_output_stride) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 1; channels <= 20; channels += 3) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .kr(25)
+        .channels(4)
+        .width(5)
+        .output_stride(23)
+        .Test(xnn_f32_dwconv_ukernel_up4x25__sse);
+    }
+  }
+
+  TEST(F32_DWCONV_UP4X25__SSE, multipixel_with_qmin) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 1; channels <= 20; channels += 3) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .kr(25)
+        .channels(channels)
+        .width(3)
+        .qmin(128)
+        .Test(xnn_f32_dwconv_ukernel_up4x25__sse);
+    }
+  }
+
+  TEST(F32_DWCONV_UP4X25__SSE, multipixel_with_qmax) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 1; channels <= 20; channels += 3) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .kr(25)
+        .channels(channels)
+        .width(3)
+        .qmax(128)
+        .Test(xnn_f32_dwconv_ukernel_up4x25__sse);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
 #if XNN_ARCH_X86 || XNN_ARCH_X86_64
-  TEST(F32_DWCONV_UP4X25__SSE, c_eq_4) {
+  TEST(F32_DWCONV_UP4X9__SSE, c_eq_4) {
     TEST_REQUIRES_X86_SSE;
     DWConvMicrokernelTester()
       .cr(4)
-      .kr(25)
+      .kr(9)
       .channels(4)
-      .Test(xnn_f32_dwconv_ukernel_up4x25__sse);
+      .Test(xnn_f32_dwconv_ukernel_up4x9__sse);
   }
 
-  TEST(F32_DWCONV_UP4X25__SSE, c_div_4) {
+  TEST(F32_DWCONV_UP4X9__SSE, c_div_4) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t channels = 8; channels < 64; channels += 12) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .kr(9)
+        .channels(channels)
+        .Test(xnn_f32_dwconv_ukernel_up4x9__sse);
+    }
+  }
+
+  TEST(F32_DWCONV_UP4X9__SSE, c_div_4_with_qmin) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t channels = 8; channels < 64; channels += 12) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .kr(9)
+        .channels(channels)
+        .qmin(128)
+        .Test(xnn_f32_dwconv_ukernel_up4x9__sse);
+    }
+  }
+
+  TEST(F32_DWCONV_UP4X9__SSE, c_div_4_with_qmax) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t channels = 8; channels < 64; channels += 12) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .kr(9)
+        .channels(channels)
+        .qmax(128)
+        .Test(xnn_f32_dwconv_ukernel_up4x9__sse);
+    }
+  }
+
+  TEST(F32_DWCONV_UP4X9__SSE, c_lt_4) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t channels = 1; channels < 4; channels++) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .kr(9)
+        .channels(channels)
+        .Test(xnn_f32_dwconv_ukernel_up4x9__sse);
+    }
+  }
+
+  TEST(F32_DWCONV_UP4X9__SSE, c_gt_4) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t channels = 5; channels < 8; channels++) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .kr(9)
+        .channels(channels)
+        .Test(xnn_f32_dwconv_ukernel_up4x9__sse);
+    }
+  }
+
+  TEST(F32_DWCONV_UP4X9__SSE, c_gt_4_with_qmin) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t channels = 5; channels < 8; channels++) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .kr(9)
+        .channels(channels)
+        .qmin(128)
+        .Test(xnn_f32_dwconv_ukernel_up4x9__sse);
+    }
+  }
+
+  TEST(F32_DWCONV_UP4X9__SSE, c_gt_4_with_qmax) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t channels = 5; channels < 8; channels++) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .kr(9)
+        .channels(channels)
+        .qmax(128)
+        .Test(xnn_f32_dwconv_ukernel_up4x9__sse);
+    }
+  }
+
+  TEST(F32_DWCONV_UP4X9__SSE, multipixel) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 1; channels <= 20; channels += 3) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .kr(9)
+        .channels(channels)
+        .width(3)
+        .Test(xnn_f32_dwconv_ukernel_up4x9__sse);
+    }
+  }
+
+  TEST(F32_DWCONV_UP4X9__SSE, multipixel_with_step) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 1; channels <= 20; channels += 3) {
+      for (size_t step = 2; step <= 9; step++) {
+        DWConvMicrokernelTester()
+          .cr(4)
+          .kr(9)
+          .channels(channels)
+          .width(3)
+          .step(step)
+          .Test(xnn_f32_dwconv_ukernel_up4x9__sse);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV_UP4X9__SSE, multipixel_with_output_stride) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 1; channels <= 20; channels += 3) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .kr(9)
+        .channels(4)
+        .width(5)
+        .output_stride(23)
+        .Test(xnn_f32_dwconv_ukernel_up4x9__sse);
+    }
+  }
+
+  TEST(F32_DWCONV_UP4X9__SSE, multipixel_with_qmin) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 1; channels <= 20; channels += 3) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .kr(9)
+        .channels(channels)
+        .width(3)
+        .qmin(128)
+        .Test(xnn_f32_dwconv_ukernel_up4x9__sse);
+    }
+  }
+
+  TEST(F32_DWCONV_UP4X9__SSE, multipixel_with_qmax) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 1; channels <= 20; channels += 3) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .kr(9)
+        .channels(channels)
+        .width(3)
+        .qmax(128)
+        .Test(xnn_f32_dwconv_ukernel_up4x9__sse);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV_UP4X4__SSE, c_eq_4) {
+    TEST_REQUIRES_X86_SSE;
+    DWConvMicrokernelTester()
+      .cr(4)
+      .kr(4)
+      .channels(4)
+      .Test(xnn_f32_dwconv_ukernel_up4x4__sse);
+  }
+
+  TEST(F32_DWCONV_UP4X4__SSE, c_div_4) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t channels = 8; channels < 64; channels += 12) {
       DWConvMicrokernelTester()
         .cr(4)
-        .kr(25)
+        .kr(4)
         .channels(channels)
-        .Test(xnn_f32_dwconv_ukernel_up4x25__sse);
+        .Test(xnn_f32_dwconv_ukernel_up4x4__sse);
     }
   }
 
-  TEST(F32_DWCONV_UP4X25__SSE, c_div_4_with_qmin) {
+  TEST(F32_DWCONV_UP4X4__SSE, c_div_4_with_qmin) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t channels = 8; channels < 64; channels += 12) {
       DWConvMicrokernelTester()
         .cr(4)
-        .kr(25)
+        .kr(4)
         .channels(channels)
         .qmin(128)
-        .Test(xnn_f32_dwconv_ukernel_up4x25__sse);
+        .Test(xnn_f32_dwconv_ukernel_up4x4__sse);
     }
   }
 
-  TEST(F32_DWCONV_UP4X25__SSE, c_div_4_with_qmax) {
+  TEST(F32_DWCONV_UP4X4__SSE, c_div_4_with_qmax) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t channels = 8; channels < 64; channels += 12) {
       DWConvMicrokernelTester()
         .cr(4)
-        .kr(25)
+        .kr(4)
         .channels(channels)
         .qmax(128)
-        .Test(xnn_f32_dwconv_ukernel_up4x25__sse);
+        .Test(xnn_f32_dwconv_ukernel_up4x4__sse);
     }
   }
 
-  TEST(F32_DWCONV_UP4X25__SSE, c_lt_4) {
+  TEST(F32_DWCONV_UP4X4__SSE, c_lt_4) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t channels = 1; channels < 4; channels++) {
       DWConvMicrokernelTester()
         .cr(4)
-        .kr(25)
+        .kr(4)
         .channels(channels)
-        .Test(xnn_f32_dwconv_ukernel_up4x25__sse);
+        .Test(xnn_f32_dwconv_ukernel_up4x4__sse);
     }
   }
 
-  TEST(F32_DWCONV_UP4X25__SSE, c_gt_4) {
+  TEST(F32_DWCONV_UP4X4__SSE, c_gt_4) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t channels = 5; channels < 8; channels++) {
       DWConvMicrokernelTester()
         .cr(4)
-        .kr(25)
+        .kr(4)
         .channels(channels)
-        .Test(xnn_f32_dwconv_ukernel_up4x25__sse);
+        .Test(xnn_f32_dwconv_ukernel_up4x4__sse);
     }
   }
 
-  TEST(F32_DWCONV_UP4X25__SSE, c_gt_4_with_qmin) {
+  TEST(F32_DWCONV_UP4X4__SSE, c_gt_4_with_qmin) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t channels = 5; channels < 8; channels++) {
       DWConvMicrokernelTester()
         .cr(4)
-        .kr(25)
+        .kr(4)
         .channels(channels)
         .qmin(128)
-        .Test(xnn_f32_dwconv_ukernel_up4x25__sse);
+        .Test(xnn_f32_dwconv_ukernel_up4x4__sse);
     }
   }
 
-  TEST(F32_DWCONV_UP4X25__SSE, c_gt_4_with_qmax) {
+  TEST(F32_DWCONV_UP4X4__SSE, c_gt_4_with_qmax) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t channels = 5; channels < 8; channels++) {
       DWConvMicrokernelTester()
         .cr(4)
-        .kr(25)
+        .kr(4)
         .channels(channels)
         .qmax(128)
-        .Test(xnn_f32_dwconv_ukernel_up4x25__sse);
+        .Test(xnn_f32_dwconv_ukernel_up4x4__sse);
     }
   }
 
-  TEST(F32_DWCONV_UP4X25__SSE, multipixel) {
+  TEST(F32_DWCONV_UP4X4__SSE, multipixel) {
     TEST_REQUIRES_X86_SSE;
     for (size_t channels = 1; channels <= 20; channels += 3) {
       DWConvMicrokernelTester()
         .cr(4)
-        .kr(25)
+        .kr(4)
         .channels(channels)
         .width(3)
-        .Test(xnn_f32_dwconv_ukernel_up4x25__sse);
+        .Test(xnn_f32_dwconv_ukernel_up4x4__sse);
     }
   }
 
-  TEST(F32_DWCONV_UP4X25__SSE, multipixel_with_step) {
+  TEST(F32_DWCONV_UP4X4__SSE, multipixel_with_step) {
     TEST_REQUIRES_X86_SSE;
     for (size_t channels = 1; channels <= 20; channels += 3) {
-      for (size_t step = 2; step <= 25; step++) {
+      for (size_t step = 2; step <= 4; step++) {
         DWConvMicrokernelTester()
           .cr(4)
-          .kr(25)
+          .kr(4)
           .channels(channels)
           .width(3)
           .step(step)
-          .Test(xnn_f32_dwconv_ukernel_up4x25__sse);
+          .Test(xnn_f32_dwconv_ukernel_up4x4__sse);
       }
     }
   }
 
-  TEST(F32_DWCONV_UP4X25__SSE, multipixel_with_output_stride) {
+  TEST(F32_DWCONV_UP4X4__SSE, multipixel_with_output_stride) {
     TEST_REQUIRES_X86_SSE;
     for (size_t channels = 1; channels <= 20; channels += 3) {
       DWConvMicrokernelTester()
         .cr(4)
-        .kr(25)
+        .kr(4)
         .channels(4)
         .width(5)
         .output_stride(23)
-        .Test(xnn_f32_dwconv_ukernel_up4x25__sse);
+        .Test(xnn_f32_dwconv_ukernel_up4x4__sse);
     }
   }
 
-  TEST(F32_DWCONV_UP4X25__SSE, multipixel_with_qmin) {
+  TEST(F32_DWCONV_UP4X4__SSE, multipixel_with_qmin) {
     TEST_REQUIRES_X86_SSE;
     for (size_t channels = 1; channels <= 20; channels += 3) {
       DWConvMicrokernelTester()
         .cr(4)
-        .kr(25)
+        .kr(4)
         .channels(channels)
         .width(3)
         .qmin(128)
-        .Test(xnn_f32_dwconv_ukernel_up4x25__sse);
+        .Test(xnn_f32_dwconv_ukernel_up4x4__sse);
     }
   }
 
-  TEST(F32_DWCONV_UP4X25__SSE, multipixel_with_qmax) {
+  TEST(F32_DWCONV_UP4X4__SSE, multipixel_with_qmax) {
     TEST_REQUIRES_X86_SSE;
     for (size_t channels = 1; channels <= 20; channels += 3) {
       DWConvMicrokernelTester()
         .cr(4)
-        .kr(25)
+        .kr(4)
         .channels(channels)
         .width(3)
         .qmax(128)
-        .Test(xnn_f32_dwconv_ukernel_up4x25__sse);
+        .Test(xnn_f32_dwconv_ukernel_up4x4__sse);
     }
   }
 #endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
 
 
 #if XNN_ARCH_X86 || XNN_ARCH_X86_64
-  TEST(F32_DWCONV_UP4X9__SSE, c_eq_4) {
+  TEST(F32_DWCONV_MP4X4__SSE, c_eq_4) {
     TEST_REQUIRES_X86_SSE;
     DWConvMicrokernelTester()
       .cr(4)
       .kr(9)
       .channels(4)
-      .Test(xnn_f32_dwconv_ukernel_up4x9__sse);
+      .Test(xnn_f32_dwconv_ukernel_mp4x4__sse);
   }
 
-  TEST(F32_DWCONV_UP4X9__SSE, c_div_4) {
+  TEST(F32_DWCONV_MP4X4__SSE, c_div_4) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t channels = 8; channels < 64; channels += 12) {
       DWConvMicrokernelTester()
         .cr(4)
         .kr(9)
         .channels(channels)
-        .Test(xnn_f32_dwconv_ukernel_up4x9__sse);
+        .Test(xnn_f32_dwconv_ukernel_mp4x4__sse);
     }
   }
 
-  TEST(F32_DWCONV_UP4X9__SSE, c_div_4_with_qmin) {
+  TEST(F32_DWCONV_MP4X4__SSE, c_div_4_with_qmin) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t channels = 8; channels < 64; channels += 12) {
       DWConvMicrokernelTester()
@@ -853,11 +1615,11 @@
         .kr(9)
         .channels(channels)
         .qmin(128)
-        .Test(xnn_f32_dwconv_ukernel_up4x9__sse);
+        .Test(xnn_f32_dwconv_ukernel_mp4x4__sse);
     }
   }
 
-  TEST(F32_DWCONV_UP4X9__SSE, c_div_4_with_qmax) {
+  TEST(F32_DWCONV_MP4X4__SSE, c_div_4_with_qmax) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t channels = 8; channels < 64; channels += 12) {
       DWConvMicrokernelTester()
@@ -865,33 +1627,33 @@
         .kr(9)
         .channels(channels)
         .qmax(128)
-        .Test(xnn_f32_dwconv_ukernel_up4x9__sse);
+        .Test(xnn_f32_dwconv_ukernel_mp4x4__sse);
     }
   }
 
-  TEST(F32_DWCONV_UP4X9__SSE, c_lt_4) {
+  TEST(F32_DWCONV_MP4X4__SSE, c_lt_4) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t channels = 1; channels < 4; channels++) {
       DWConvMicrokernelTester()
         .cr(4)
         .kr(9)
         .channels(channels)
-        .Test(xnn_f32_dwconv_ukernel_up4x9__sse);
+        .Test(xnn_f32_dwconv_ukernel_mp4x4__sse);
     }
   }
 
-  TEST(F32_DWCONV_UP4X9__SSE, c_gt_4) {
+  TEST(F32_DWCONV_MP4X4__SSE, c_gt_4) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t channels = 5; channels < 8; channels++) {
       DWConvMicrokernelTester()
         .cr(4)
         .kr(9)
         .channels(channels)
-        .Test(xnn_f32_dwconv_ukernel_up4x9__sse);
+        .Test(xnn_f32_dwconv_ukernel_mp4x4__sse);
     }
   }
 
-  TEST(F32_DWCONV_UP4X9__SSE, c_gt_4_with_qmin) {
+  TEST(F32_DWCONV_MP4X4__SSE, c_gt_4_with_qmin) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t channels = 5; channels < 8; channels++) {
       DWConvMicrokernelTester()
@@ -899,11 +1661,11 @@
         .kr(9)
         .channels(channels)
         .qmin(128)
-        .Test(xnn_f32_dwconv_ukernel_up4x9__sse);
+        .Test(xnn_f32_dwconv_ukernel_mp4x4__sse);
     }
   }
 
-  TEST(F32_DWCONV_UP4X9__SSE, c_gt_4_with_qmax) {
+  TEST(F32_DWCONV_MP4X4__SSE, c_gt_4_with_qmax) {
     TEST_REQUIRES_X86_SSE;
     for (uint32_t channels = 5; channels < 8; channels++) {
       DWConvMicrokernelTester()
@@ -911,11 +1673,11 @@
         .kr(9)
         .channels(channels)
         .qmax(128)
-        .Test(xnn_f32_dwconv_ukernel_up4x9__sse);
+        .Test(xnn_f32_dwconv_ukernel_mp4x4__sse);
     }
   }
 
-  TEST(F32_DWCONV_UP4X9__SSE, multipixel) {
+  TEST(F32_DWCONV_MP4X4__SSE, multipixel) {
     TEST_REQUIRES_X86_SSE;
     for (size_t channels = 1; channels <= 20; channels += 3) {
       DWConvMicrokernelTester()
@@ -923,11 +1685,11 @@
         .kr(9)
         .channels(channels)
         .width(3)
-        .Test(xnn_f32_dwconv_ukernel_up4x9__sse);
+        .Test(xnn_f32_dwconv_ukernel_mp4x4__sse);
     }
   }
 
-  TEST(F32_DWCONV_UP4X9__SSE, multipixel_with_step) {
+  TEST(F32_DWCONV_MP4X4__SSE, multipixel_with_step) {
     TEST_REQUIRES_X86_SSE;
     for (size_t channels = 1; channels <= 20; channels += 3) {
       for (size_t step = 2; step <= 9; step++) {
@@ -937,12 +1699,12 @@
           .channels(channels)
           .width(3)
           .step(step)
-          .Test(xnn_f32_dwconv_ukernel_up4x9__sse);
+          .Test(xnn_f32_dwconv_ukernel_mp4x4__sse);
       }
     }
   }
 
-  TEST(F32_DWCONV_UP4X9__SSE, multipixel_with_output_stride) {
+  TEST(F32_DWCONV_MP4X4__SSE, multipixel_with_output_stride) {
     TEST_REQUIRES_X86_SSE;
     for (size_t channels = 1; channels <= 20; channels += 3) {
       DWConvMicrokernelTester()
@@ -951,669 +1713,1017 @@
         .channels(4)
         .width(5)
         .output_stride(23)
-        .Test(xnn_f32_dwconv_ukernel_up4x9__sse);
+        .Test(xnn_f32_dwconv_ukernel_mp4x4__sse);
+    }
+  }
+
+  TEST(F32_DWCONV_MP4X4__SSE, multipixel_with_qmin) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 1; channels <= 20; channels += 3) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .kr(9)
+        .channels(channels)
+        .width(3)
+        .qmin(128)
+        .Test(xnn_f32_dwconv_ukernel_mp4x4__sse);
+    }
+  }
+
+  TEST(F32_DWCONV_MP4X4__SSE, multipixel_with_qmax) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 1; channels <= 20; channels += 3) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .kr(9)
+        .channels(channels)
+        .width(3)
+        .qmax(128)
+        .Test(xnn_f32_dwconv_ukernel_mp4x4__sse);
+    }
+  }
+
+  TEST(F32_DWCONV_MP4X4__SSE, kernel_size_lt_4) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t kernel_size = 1; kernel_size < 4; kernel_size++) {
+      for (uint32_t channels = 1; channels <= 12; channels += 3) {
+        DWConvMicrokernelTester()
+          .cr(4)
+          .kr(kernel_size)
+          .channels(channels)
+          .Test(xnn_f32_dwconv_ukernel_mp4x4__sse);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV_MP4X4__SSE, kernel_size_eq_4) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t channels = 1; channels <= 12; channels += 3) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .kr(4)
+        .channels(channels)
+        .Test(xnn_f32_dwconv_ukernel_mp4x4__sse);
+    }
+  }
+
+  TEST(F32_DWCONV_MP4X4__SSE, kernel_size_div_4) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t kernel_size = 8; kernel_size <= 16; kernel_size += 4) {
+      for (uint32_t channels = 1; channels <= 12; channels += 3) {
+        DWConvMicrokernelTester()
+          .cr(4)
+          .kr(kernel_size)
+          .channels(channels)
+          .Test(xnn_f32_dwconv_ukernel_mp4x4__sse);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV_MP4X4__SSE, kernel_size_gt_4) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t kernel_size = 5; kernel_size < 8; kernel_size++) {
+      for (uint32_t channels = 1; channels <= 12; channels += 3) {
+        DWConvMicrokernelTester()
+          .cr(4)
+          .kr(kernel_size)
+          .channels(channels)
+          .Test(xnn_f32_dwconv_ukernel_mp4x4__sse);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV_MP4X4__SSE, kernel_size_eq_49) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t channels = 1; channels <= 12; channels += 3) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .kr(49)
+        .channels(channels)
+        .width(3)
+        .step(7)
+        .Test(xnn_f32_dwconv_ukernel_mp4x4__sse);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV_MP8X4__AVX, c_eq_8) {
+    TEST_REQUIRES_X86_AVX;
+    DWConvMicrokernelTester()
+      .cr(8)
+      .kr(9)
+      .channels(8)
+      .Test(xnn_f32_dwconv_ukernel_mp8x4__avx);
+  }
+
+  TEST(F32_DWCONV_MP8X4__AVX, c_div_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t channels = 16; channels < 128; channels += 24) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(channels)
+        .Test(xnn_f32_dwconv_ukernel_mp8x4__avx);
+    }
+  }
+
+  TEST(F32_DWCONV_MP8X4__AVX, c_div_8_with_qmin) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t channels = 16; channels < 128; channels += 24) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(channels)
+        .qmin(128)
+        .Test(xnn_f32_dwconv_ukernel_mp8x4__avx);
+    }
+  }
+
+  TEST(F32_DWCONV_MP8X4__AVX, c_div_8_with_qmax) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t channels = 16; channels < 128; channels += 24) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(channels)
+        .qmax(128)
+        .Test(xnn_f32_dwconv_ukernel_mp8x4__avx);
+    }
+  }
+
+  TEST(F32_DWCONV_MP8X4__AVX, c_lt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t channels = 1; channels < 8; channels++) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(channels)
+        .Test(xnn_f32_dwconv_ukernel_mp8x4__avx);
+    }
+  }
+
+  TEST(F32_DWCONV_MP8X4__AVX, c_gt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t channels = 9; channels < 16; channels++) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(channels)
+        .Test(xnn_f32_dwconv_ukernel_mp8x4__avx);
+    }
+  }
+
+  TEST(F32_DWCONV_MP8X4__AVX, c_gt_8_with_qmin) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t channels = 9; channels < 16; channels++) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(channels)
+        .qmin(128)
+        .Test(xnn_f32_dwconv_ukernel_mp8x4__avx);
+    }
+  }
+
+  TEST(F32_DWCONV_MP8X4__AVX, c_gt_8_with_qmax) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t channels = 9; channels < 16; channels++) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(channels)
+        .qmax(128)
+        .Test(xnn_f32_dwconv_ukernel_mp8x4__avx);
+    }
+  }
+
+  TEST(F32_DWCONV_MP8X4__AVX, multipixel) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(channels)
+        .width(3)
+        .Test(xnn_f32_dwconv_ukernel_mp8x4__avx);
+    }
+  }
+
+  TEST(F32_DWCONV_MP8X4__AVX, multipixel_with_step) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      for (size_t step = 2; step <= 9; step++) {
+        DWConvMicrokernelTester()
+          .cr(8)
+          .kr(9)
+          .channels(channels)
+          .width(3)
+          .step(step)
+          .Test(xnn_f32_dwconv_ukernel_mp8x4__avx);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV_MP8X4__AVX, multipixel_with_output_stride) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(8)
+        .width(5)
+        .output_stride(43)
+        .Test(xnn_f32_dwconv_ukernel_mp8x4__avx);
+    }
+  }
+
+  TEST(F32_DWCONV_MP8X4__AVX, multipixel_with_qmin) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(channels)
+        .width(3)
+        .qmin(128)
+        .Test(xnn_f32_dwconv_ukernel_mp8x4__avx);
+    }
+  }
+
+  TEST(F32_DWCONV_MP8X4__AVX, multipixel_with_qmax) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(channels)
+        .width(3)
+        .qmax(128)
+        .Test(xnn_f32_dwconv_ukernel_mp8x4__avx);
+    }
+  }
+
+  TEST(F32_DWCONV_MP8X4__AVX, kernel_size_lt_4) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t kernel_size = 1; kernel_size < 4; kernel_size++) {
+      for (uint32_t channels = 1; channels <= 24; channels += 7) {
+        DWConvMicrokernelTester()
+          .cr(8)
+          .kr(kernel_size)
+          .channels(channels)
+          .Test(xnn_f32_dwconv_ukernel_mp8x4__avx);
+      }
     }
   }
 
-  TEST(F32_DWCONV_UP4X9__SSE, multipixel_with_qmin) {
-    TEST_REQUIRES_X86_SSE;
-    for (size_t channels = 1; channels <= 20; channels += 3) {
+  TEST(F32_DWCONV_MP8X4__AVX, kernel_size_eq_4) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t channels = 1; channels <= 24; channels += 7) {
       DWConvMicrokernelTester()
-        .cr(4)
-        .kr(9)
+        .cr(8)
+        .kr(4)
         .channels(channels)
-        .width(3)
-        .qmin(128)
-        .Test(xnn_f32_dwconv_ukernel_up4x9__sse);
+        .Test(xnn_f32_dwconv_ukernel_mp8x4__avx);
     }
   }
 
-  TEST(F32_DWCONV_UP4X9__SSE, multipixel_with_qmax) {
-    TEST_REQUIRES_X86_SSE;
-    for (size_t channels = 1; channels <= 20; channels += 3) {
+  TEST(F32_DWCONV_MP8X4__AVX, kernel_size_div_4) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t kernel_size = 8; kernel_size <= 16; kernel_size += 4) {
+      for (uint32_t channels = 1; channels <= 24; channels += 7) {
+        DWConvMicrokernelTester()
+          .cr(8)
+          .kr(kernel_size)
+          .channels(channels)
+          .Test(xnn_f32_dwconv_ukernel_mp8x4__avx);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV_MP8X4__AVX, kernel_size_gt_4) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t kernel_size = 5; kernel_size < 8; kernel_size++) {
+      for (uint32_t channels = 1; channels <= 24; channels += 7) {
+        DWConvMicrokernelTester()
+          .cr(8)
+          .kr(kernel_size)
+          .channels(channels)
+          .Test(xnn_f32_dwconv_ukernel_mp8x4__avx);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV_MP8X4__AVX, kernel_size_eq_49) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t channels = 1; channels <= 24; channels += 7) {
       DWConvMicrokernelTester()
-        .cr(4)
-        .kr(9)
+        .cr(8)
+        .kr(49)
         .channels(channels)
         .width(3)
-        .qmax(128)
-        .Test(xnn_f32_dwconv_ukernel_up4x9__sse);
+        .step(7)
+        .Test(xnn_f32_dwconv_ukernel_mp8x4__avx);
     }
   }
 #endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
 
 
-#if XNN_ARCH_X86 || XNN_ARCH_X86_64
-  TEST(F32_DWCONV_UP4X4__SSE, c_eq_4) {
-    TEST_REQUIRES_X86_SSE;
+#if !XNN_ARCH_ASMJS && !XNN_ARCH_WASM
+  TEST(F32_DWCONV_UP4X25__PSIMD, c_eq_4) {
+    TEST_REQUIRES_PSIMD;
     DWConvMicrokernelTester()
       .cr(4)
-      .kr(4)
+      .kr(25)
       .channels(4)
-      .Test(xnn_f32_dwconv_ukernel_up4x4__sse);
+      .Test(xnn_f32_dwconv_ukernel_up4x25__psimd, DWConvMicrokernelTester::Variant::Scalar);
   }
 
-  TEST(F32_DWCONV_UP4X4__SSE, c_div_4) {
-    TEST_REQUIRES_X86_SSE;
+  TEST(F32_DWCONV_UP4X25__PSIMD, c_div_4) {
+    TEST_REQUIRES_PSIMD;
     for (uint32_t channels = 8; channels < 64; channels += 12) {
       DWConvMicrokernelTester()
         .cr(4)
-        .kr(4)
+        .kr(25)
         .channels(channels)
-        .Test(xnn_f32_dwconv_ukernel_up4x4__sse);
+        .Test(xnn_f32_dwconv_ukernel_up4x25__psimd, DWConvMicrokernelTester::Variant::Scalar);
     }
   }
 
-  TEST(F32_DWCONV_UP4X4__SSE, c_div_4_with_qmin) {
-    TEST_REQUIRES_X86_SSE;
+  TEST(F32_DWCONV_UP4X25__PSIMD, c_div_4_with_qmin) {
+    TEST_REQUIRES_PSIMD;
     for (uint32_t channels = 8; channels < 64; channels += 12) {
       DWConvMicrokernelTester()
         .cr(4)
-        .kr(4)
+        .kr(25)
         .channels(channels)
         .qmin(128)
-        .Test(xnn_f32_dwconv_ukernel_up4x4__sse);
+        .Test(xnn_f32_dwconv_ukernel_up4x25__psimd, DWConvMicrokernelTester::Variant::Scalar);
     }
   }
 
-  TEST(F32_DWCONV_UP4X4__SSE, c_div_4_with_qmax) {
-    TEST_REQUIRES_X86_SSE;
+  TEST(F32_DWCONV_UP4X25__PSIMD, c_div_4_with_qmax) {
+    TEST_REQUIRES_PSIMD;
     for (uint32_t channels = 8; channels < 64; channels += 12) {
       DWConvMicrokernelTester()
         .cr(4)
-        .kr(4)
+        .kr(25)
         .channels(channels)
         .qmax(128)
-        .Test(xnn_f32_dwconv_ukernel_up4x4__sse);
+        .Test(xnn_f32_dwconv_ukernel_up4x25__psimd, DWConvMicrokernelTester::Variant::Scalar);
     }
   }
 
-  TEST(F32_DWCONV_UP4X4__SSE, c_lt_4) {
-    TEST_REQUIRES_X86_SSE;
+  TEST(F32_DWCONV_UP4X25__PSIMD, c_lt_4) {
+    TEST_REQUIRES_PSIMD;
     for (uint32_t channels = 1; channels < 4; channels++) {
       DWConvMicrokernelTester()
         .cr(4)
-        .kr(4)
+        .kr(25)
         .channels(channels)
-        .Test(xnn_f32_dwconv_ukernel_up4x4__sse);
+        .Test(xnn_f32_dwconv_ukernel_up4x25__psimd, DWConvMicrokernelTester::Variant::Scalar);
     }
   }
 
-  TEST(F32_DWCONV_UP4X4__SSE, c_gt_4) {
-    TEST_REQUIRES_X86_SSE;
+  TEST(F32_DWCONV_UP4X25__PSIMD, c_gt_4) {
+    TEST_REQUIRES_PSIMD;
     for (uint32_t channels = 5; channels < 8; channels++) {
       DWConvMicrokernelTester()
         .cr(4)
-        .kr(4)
+        .kr(25)
         .channels(channels)
-        .Test(xnn_f32_dwconv_ukernel_up4x4__sse);
+        .Test(xnn_f32_dwconv_ukernel_up4x25__psimd, DWConvMicrokernelTester::Variant::Scalar);
     }
   }
 
-  TEST(F32_DWCONV_UP4X4__SSE, c_gt_4_with_qmin) {
-    TEST_REQUIRES_X86_SSE;
+  TEST(F32_DWCONV_UP4X25__PSIMD, c_gt_4_with_qmin) {
+    TEST_REQUIRES_PSIMD;
     for (uint32_t channels = 5; channels < 8; channels++) {
       DWConvMicrokernelTester()
         .cr(4)
-        .kr(4)
+        .kr(25)
         .channels(channels)
         .qmin(128)
-        .Test(xnn_f32_dwconv_ukernel_up4x4__sse);
+        .Test(xnn_f32_dwconv_ukernel_up4x25__psimd, DWConvMicrokernelTester::Variant::Scalar);
     }
   }
 
-  TEST(F32_DWCONV_UP4X4__SSE, c_gt_4_with_qmax) {
-    TEST_REQUIRES_X86_SSE;
+  TEST(F32_DWCONV_UP4X25__PSIMD, c_gt_4_with_qmax) {
+    TEST_REQUIRES_PSIMD;
     for (uint32_t channels = 5; channels < 8; channels++) {
       DWConvMicrokernelTester()
         .cr(4)
-        .kr(4)
+        .kr(25)
         .channels(channels)
         .qmax(128)
-        .Test(xnn_f32_dwconv_ukernel_up4x4__sse);
+        .Test(xnn_f32_dwconv_ukernel_up4x25__psimd, DWConvMicrokernelTester::Variant::Scalar);
     }
   }
 
-  TEST(F32_DWCONV_UP4X4__SSE, multipixel) {
-    TEST_REQUIRES_X86_SSE;
+  TEST(F32_DWCONV_UP4X25__PSIMD, multipixel) {
+    TEST_REQUIRES_PSIMD;
     for (size_t channels = 1; channels <= 20; channels += 3) {
       DWConvMicrokernelTester()
         .cr(4)
-        .kr(4)
+        .kr(25)
         .channels(channels)
         .width(3)
-        .Test(xnn_f32_dwconv_ukernel_up4x4__sse);
+        .Test(xnn_f32_dwconv_ukernel_up4x25__psimd, DWConvMicrokernelTester::Variant::Scalar);
     }
   }
 
-  TEST(F32_DWCONV_UP4X4__SSE, multipixel_with_step) {
-    TEST_REQUIRES_X86_SSE;
+  TEST(F32_DWCONV_UP4X25__PSIMD, multipixel_with_step) {
+    TEST_REQUIRES_PSIMD;
     for (size_t channels = 1; channels <= 20; channels += 3) {
-      for (size_t step = 2; step <= 4; step++) {
+      for (size_t step = 2; step <= 25; step++) {
         DWConvMicrokernelTester()
           .cr(4)
-          .kr(4)
+          .kr(25)
           .channels(channels)
           .width(3)
           .step(step)
-          .Test(xnn_f32_dwconv_ukernel_up4x4__sse);
+          .Test(xnn_f32_dwconv_ukernel_up4x25__psimd, DWConvMicrokernelTester::Variant::Scalar);
       }
     }
   }
 
-  TEST(F32_DWCONV_UP4X4__SSE, multipixel_with_output_stride) {
-    TEST_REQUIRES_X86_SSE;
+  TEST(F32_DWCONV_UP4X25__PSIMD, multipixel_with_output_stride) {
+    TEST_REQUIRES_PSIMD;
     for (size_t channels = 1; channels <= 20; channels += 3) {
       DWConvMicrokernelTester()
         .cr(4)
-        .kr(4)
+        .kr(25)
         .channels(4)
         .width(5)
         .output_stride(23)
-        .Test(xnn_f32_dwconv_ukernel_up4x4__sse);
+        .Test(xnn_f32_dwconv_ukernel_up4x25__psimd, DWConvMicrokernelTester::Variant::Scalar);
     }
   }
 
-  TEST(F32_DWCONV_UP4X4__SSE, multipixel_with_qmin) {
-    TEST_REQUIRES_X86_SSE;
+  TEST(F32_DWCONV_UP4X25__PSIMD, multipixel_with_qmin) {
+    TEST_REQUIRES_PSIMD;
     for (size_t channels = 1; channels <= 20; channels += 3) {
       DWConvMicrokernelTester()
         .cr(4)
-        .kr(4)
+        .kr(25)
         .channels(channels)
         .width(3)
         .qmin(128)
-        .Test(xnn_f32_dwconv_ukernel_up4x4__sse);
+        .Test(xnn_f32_dwconv_ukernel_up4x25__psimd, DWConvMicrokernelTester::Variant::Scalar);
     }
   }
 
-  TEST(F32_DWCONV_UP4X4__SSE, multipixel_with_qmax) {
-    TEST_REQUIRES_X86_SSE;
+  TEST(F32_DWCONV_UP4X25__PSIMD, multipixel_with_qmax) {
+    TEST_REQUIRES_PSIMD;
     for (size_t channels = 1; channels <= 20; channels += 3) {
       DWConvMicrokernelTester()
         .cr(4)
-        .kr(4)
+        .kr(25)
         .channels(channels)
         .width(3)
         .qmax(128)
-        .Test(xnn_f32_dwconv_ukernel_up4x4__sse);
+        .Test(xnn_f32_dwconv_ukernel_up4x25__psimd, DWConvMicrokernelTester::Variant::Scalar);
     }
   }
-#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+#endif  // !XNN_ARCH_ASMJS && !XNN_ARCH_WASM
 
 
 #if !XNN_ARCH_ASMJS && !XNN_ARCH_WASM
-  TEST(F32_DWCONV_UP4X25__PSIMD, c_eq_4) {
+  TEST(F32_DWCONV_UP4X9__PSIMD, c_eq_4) {
     TEST_REQUIRES_PSIMD;
     DWConvMicrokernelTester()
       .cr(4)
-      .kr(25)
+      .kr(9)
       .channels(4)
-      .Test(xnn_f32_dwconv_ukernel_up4x25__psimd, DWConvMicrokernelTester::Variant::Scalar);
+      .Test(xnn_f32_dwconv_ukernel_up4x9__psimd, DWConvMicrokernelTester::Variant::Scalar);
   }
 
-  TEST(F32_DWCONV_UP4X25__PSIMD, c_div_4) {
+  TEST(F32_DWCONV_UP4X9__PSIMD, c_div_4) {
     TEST_REQUIRES_PSIMD;
     for (uint32_t channels = 8; channels < 64; channels += 12) {
       DWConvMicrokernelTester()
         .cr(4)
-        .kr(25)
+        .kr(9)
         .channels(channels)
-        .Test(xnn_f32_dwconv_ukernel_up4x25__psimd, DWConvMicrokernelTester::Variant::Scalar);
+        .Test(xnn_f32_dwconv_ukernel_up4x9__psimd, DWConvMicrokernelTester::Variant::Scalar);
     }
   }
 
-  TEST(F32_DWCONV_UP4X25__PSIMD, c_div_4_with_qmin) {
+  TEST(F32_DWCONV_UP4X9__PSIMD, c_div_4_with_qmin) {
     TEST_REQUIRES_PSIMD;
     for (uint32_t channels = 8; channels < 64; channels += 12) {
       DWConvMicrokernelTester()
         .cr(4)
-        .kr(25)
+        .kr(9)
         .channels(channels)
         .qmin(128)
-        .Test(xnn_f32_dwconv_ukernel_up4x25__psimd, DWConvMicrokernelTester::Variant::Scalar);
+        .Test(xnn_f32_dwconv_ukernel_up4x9__psimd, DWConvMicrokernelTester::Variant::Scalar);
     }
   }
 
-  TEST(F32_DWCONV_UP4X25__PSIMD, c_div_4_with_qmax) {
+  TEST(F32_DWCONV_UP4X9__PSIMD, c_div_4_with_qmax) {
     TEST_REQUIRES_PSIMD;
     for (uint32_t channels = 8; channels < 64; channels += 12) {
       DWConvMicrokernelTester()
         .cr(4)
-        .kr(25)
+        .kr(9)
         .channels(channels)
         .qmax(128)
-        .Test(xnn_f32_dwconv_ukernel_up4x25__psimd, DWConvMicrokernelTester::Variant::Scalar);
+        .Test(xnn_f32_dwconv_ukernel_up4x9__psimd, DWConvMicrokernelTester::Variant::Scalar);
     }
   }
 
-  TEST(F32_DWCONV_UP4X25__PSIMD, c_lt_4) {
+  TEST(F32_DWCONV_UP4X9__PSIMD, c_lt_4) {
     TEST_REQUIRES_PSIMD;
     for (uint32_t channels = 1; channels < 4; channels++) {
       DWConvMicrokernelTester()
         .cr(4)
-        .kr(25)
+        .kr(9)
         .channels(channels)
-        .Test(xnn_f32_dwconv_ukernel_up4x25__psimd, DWConvMicrokernelTester::Variant::Scalar);
+        .Test(xnn_f32_dwconv_ukernel_up4x9__psimd, DWConvMicrokernelTester::Variant::Scalar);
     }
   }
 
-  TEST(F32_DWCONV_UP4X25__PSIMD, c_gt_4) {
+  TEST(F32_DWCONV_UP4X9__PSIMD, c_gt_4) {
     TEST_REQUIRES_PSIMD;
     for (uint32_t channels = 5; channels < 8; channels++) {
       DWConvMicrokernelTester()
         .cr(4)
-        .kr(25)
+        .kr(9)
         .channels(channels)
-        .Test(xnn_f32_dwconv_ukernel_up4x25__psimd, DWConvMicrokernelTester::Variant::Scalar);
+        .Test(xnn_f32_dwconv_ukernel_up4x9__psimd, DWConvMicrokernelTester::Variant::Scalar);
     }
   }
 
-  TEST(F32_DWCONV_UP4X25__PSIMD, c_gt_4_with_qmin) {
+  TEST(F32_DWCONV_UP4X9__PSIMD, c_gt_4_with_qmin) {
     TEST_REQUIRES_PSIMD;
     for (uint32_t channels = 5; channels < 8; channels++) {
       DWConvMicrokernelTester()
         .cr(4)
-        .kr(25)
+        .kr(9)
         .channels(channels)
         .qmin(128)
-        .Test(xnn_f32_dwconv_ukernel_up4x25__psimd, DWConvMicrokernelTester::Variant::Scalar);
+        .Test(xnn_f32_dwconv_ukernel_up4x9__psimd, DWConvMicrokernelTester::Variant::Scalar);
     }
   }
 
-  TEST(F32_DWCONV_UP4X25__PSIMD, c_gt_4_with_qmax) {
+  TEST(F32_DWCONV_UP4X9__PSIMD, c_gt_4_with_qmax) {
     TEST_REQUIRES_PSIMD;
     for (uint32_t channels = 5; channels < 8; channels++) {
       DWConvMicrokernelTester()
         .cr(4)
-        .kr(25)
+        .kr(9)
         .channels(channels)
         .qmax(128)
-        .Test(xnn_f32_dwconv_ukernel_up4x25__psimd, DWConvMicrokernelTester::Variant::Scalar);
+        .Test(xnn_f32_dwconv_ukernel_up4x9__psimd, DWConvMicrokernelTester::Variant::Scalar);
     }
   }
 
-  TEST(F32_DWCONV_UP4X25__PSIMD, multipixel) {
+  TEST(F32_DWCONV_UP4X9__PSIMD, multipixel) {
     TEST_REQUIRES_PSIMD;
     for (size_t channels = 1; channels <= 20; channels += 3) {
       DWConvMicrokernelTester()
         .cr(4)
-        .kr(25)
+        .kr(9)
         .channels(channels)
         .width(3)
-        .Test(xnn_f32_dwconv_ukernel_up4x25__psimd, DWConvMicrokernelTester::Variant::Scalar);
+        .Test(xnn_f32_dwconv_ukernel_up4x9__psimd, DWConvMicrokernelTester::Variant::Scalar);
     }
   }
 
-  TEST(F32_DWCONV_UP4X25__PSIMD, multipixel_with_step) {
+  TEST(F32_DWCONV_UP4X9__PSIMD, multipixel_with_step) {
     TEST_REQUIRES_PSIMD;
     for (size_t channels = 1; channels <= 20; channels += 3) {
-      for (size_t step = 2; step <= 25; step++) {
+      for (size_t step = 2; step <= 9; step++) {
         DWConvMicrokernelTester()
           .cr(4)
-          .kr(25)
+          .kr(9)
           .channels(channels)
           .width(3)
           .step(step)
-          .Test(xnn_f32_dwconv_ukernel_up4x25__psimd, DWConvMicrokernelTester::Variant::Scalar);
+          .Test(xnn_f32_dwconv_ukernel_up4x9__psimd, DWConvMicrokernelTester::Variant::Scalar);
       }
     }
   }
 
-  TEST(F32_DWCONV_UP4X25__PSIMD, multipixel_with_output_stride) {
+  TEST(F32_DWCONV_UP4X9__PSIMD, multipixel_with_output_stride) {
     TEST_REQUIRES_PSIMD;
     for (size_t channels = 1; channels <= 20; channels += 3) {
       DWConvMicrokernelTester()
         .cr(4)
-        .kr(25)
+        .kr(9)
         .channels(4)
         .width(5)
         .output_stride(23)
-        .Test(xnn_f32_dwconv_ukernel_up4x25__psimd, DWConvMicrokernelTester::Variant::Scalar);
+        .Test(xnn_f32_dwconv_ukernel_up4x9__psimd, DWConvMicrokernelTester::Variant::Scalar);
     }
   }
 
-  TEST(F32_DWCONV_UP4X25__PSIMD, multipixel_with_qmin) {
+  TEST(F32_DWCONV_UP4X9__PSIMD, multipixel_with_qmin) {
     TEST_REQUIRES_PSIMD;
     for (size_t channels = 1; channels <= 20; channels += 3) {
       DWConvMicrokernelTester()
         .cr(4)
-        .kr(25)
+        .kr(9)
         .channels(channels)
         .width(3)
         .qmin(128)
-        .Test(xnn_f32_dwconv_ukernel_up4x25__psimd, DWConvMicrokernelTester::Variant::Scalar);
+        .Test(xnn_f32_dwconv_ukernel_up4x9__psimd, DWConvMicrokernelTester::Variant::Scalar);
     }
   }
 
-  TEST(F32_DWCONV_UP4X25__PSIMD, multipixel_with_qmax) {
+  TEST(F32_DWCONV_UP4X9__PSIMD, multipixel_with_qmax) {
     TEST_REQUIRES_PSIMD;
     for (size_t channels = 1; channels <= 20; channels += 3) {
       DWConvMicrokernelTester()
         .cr(4)
-        .kr(25)
+        .kr(9)
         .channels(channels)
         .width(3)
         .qmax(128)
-        .Test(xnn_f32_dwconv_ukernel_up4x25__psimd, DWConvMicrokernelTester::Variant::Scalar);
+        .Test(xnn_f32_dwconv_ukernel_up4x9__psimd, DWConvMicrokernelTester::Variant::Scalar);
     }
   }
 #endif  // !XNN_ARCH_ASMJS && !XNN_ARCH_WASM
 
 
 #if !XNN_ARCH_ASMJS && !XNN_ARCH_WASM
-  TEST(F32_DWCONV_UP4X9__PSIMD, c_eq_4) {
+  TEST(F32_DWCONV_UP4X4__PSIMD, c_eq_4) {
     TEST_REQUIRES_PSIMD;
     DWConvMicrokernelTester()
       .cr(4)
-      .kr(9)
+      .kr(4)
       .channels(4)
-      .Test(xnn_f32_dwconv_ukernel_up4x9__psimd, DWConvMicrokernelTester::Variant::Scalar);
+      .Test(xnn_f32_dwconv_ukernel_up4x4__psimd, DWConvMicrokernelTester::Variant::Scalar);
   }
 
-  TEST(F32_DWCONV_UP4X9__PSIMD, c_div_4) {
+  TEST(F32_DWCONV_UP4X4__PSIMD, c_div_4) {
     TEST_REQUIRES_PSIMD;
     for (uint32_t channels = 8; channels < 64; channels += 12) {
       DWConvMicrokernelTester()
         .cr(4)
-        .kr(9)
+        .kr(4)
         .channels(channels)
-        .Test(xnn_f32_dwconv_ukernel_up4x9__psimd, DWConvMicrokernelTester::Variant::Scalar);
+        .Test(xnn_f32_dwconv_ukernel_up4x4__psimd, DWConvMicrokernelTester::Variant::Scalar);
     }
   }
 
-  TEST(F32_DWCONV_UP4X9__PSIMD, c_div_4_with_qmin) {
+  TEST(F32_DWCONV_UP4X4__PSIMD, c_div_4_with_qmin) {
     TEST_REQUIRES_PSIMD;
     for (uint32_t channels = 8; channels < 64; channels += 12) {
       DWConvMicrokernelTester()
         .cr(4)
-        .kr(9)
+        .kr(4)
         .channels(channels)
         .qmin(128)
-        .Test(xnn_f32_dwconv_ukernel_up4x9__psimd, DWConvMicrokernelTester::Variant::Scalar);
+        .Test(xnn_f32_dwconv_ukernel_up4x4__psimd, DWConvMicrokernelTester::Variant::Scalar);
     }
   }
 
-  TEST(F32_DWCONV_UP4X9__PSIMD, c_div_4_with_qmax) {
+  TEST(F32_DWCONV_UP4X4__PSIMD, c_div_4_with_qmax) {
     TEST_REQUIRES_PSIMD;
     for (uint32_t channels = 8; channels < 64; channels += 12) {
       DWConvMicrokernelTester()
         .cr(4)
-        .kr(9)
+        .kr(4)
         .channels(channels)
         .qmax(128)
-        .Test(xnn_f32_dwconv_ukernel_up4x9__psimd, DWConvMicrokernelTester::Variant::Scalar);
+        .Test(xnn_f32_dwconv_ukernel_up4x4__psimd, DWConvMicrokernelTester::Variant::Scalar);
     }
   }
 
-  TEST(F32_DWCONV_UP4X9__PSIMD, c_lt_4) {
+  TEST(F32_DWCONV_UP4X4__PSIMD, c_lt_4) {
     TEST_REQUIRES_PSIMD;
     for (uint32_t channels = 1; channels < 4; channels++) {
       DWConvMicrokernelTester()
         .cr(4)
-        .kr(9)
+        .kr(4)
         .channels(channels)
-        .Test(xnn_f32_dwconv_ukernel_up4x9__psimd, DWConvMicrokernelTester::Variant::Scalar);
+        .Test(xnn_f32_dwconv_ukernel_up4x4__psimd, DWConvMicrokernelTester::Variant::Scalar);
     }
   }
 
-  TEST(F32_DWCONV_UP4X9__PSIMD, c_gt_4) {
+  TEST(F32_DWCONV_UP4X4__PSIMD, c_gt_4) {
     TEST_REQUIRES_PSIMD;
     for (uint32_t channels = 5; channels < 8; channels++) {
       DWConvMicrokernelTester()
         .cr(4)
-        .kr(9)
+        .kr(4)
         .channels(channels)
-        .Test(xnn_f32_dwconv_ukernel_up4x9__psimd, DWConvMicrokernelTester::Variant::Scalar);
+        .Test(xnn_f32_dwconv_ukernel_up4x4__psimd, DWConvMicrokernelTester::Variant::Scalar);
     }
   }
 
-  TEST(F32_DWCONV_UP4X9__PSIMD, c_gt_4_with_qmin) {
+  TEST(F32_DWCONV_UP4X4__PSIMD, c_gt_4_with_qmin) {
     TEST_REQUIRES_PSIMD;
     for (uint32_t channels = 5; channels < 8; channels++) {
       DWConvMicrokernelTester()
         .cr(4)
-        .kr(9)
+        .kr(4)
         .channels(channels)
         .qmin(128)
-        .Test(xnn_f32_dwconv_ukernel_up4x9__psimd, DWConvMicrokernelTester::Variant::Scalar);
+        .Test(xnn_f32_dwconv_ukernel_up4x4__psimd, DWConvMicrokernelTester::Variant::Scalar);
     }
   }
 
-  TEST(F32_DWCONV_UP4X9__PSIMD, c_gt_4_with_qmax) {
+  TEST(F32_DWCONV_UP4X4__PSIMD, c_gt_4_with_qmax) {
     TEST_REQUIRES_PSIMD;
     for (uint32_t channels = 5; channels < 8; channels++) {
       DWConvMicrokernelTester()
         .cr(4)
-        .kr(9)
+        .kr(4)
         .channels(channels)
         .qmax(128)
-        .Test(xnn_f32_dwconv_ukernel_up4x9__psimd, DWConvMicrokernelTester::Variant::Scalar);
+        .Test(xnn_f32_dwconv_ukernel_up4x4__psimd, DWConvMicrokernelTester::Variant::Scalar);
     }
   }
 
-  TEST(F32_DWCONV_UP4X9__PSIMD, multipixel) {
+  TEST(F32_DWCONV_UP4X4__PSIMD, multipixel) {
     TEST_REQUIRES_PSIMD;
     for (size_t channels = 1; channels <= 20; channels += 3) {
       DWConvMicrokernelTester()
         .cr(4)
-        .kr(9)
+        .kr(4)
         .channels(channels)
         .width(3)
-        .Test(xnn_f32_dwconv_ukernel_up4x9__psimd, DWConvMicrokernelTester::Variant::Scalar);
+        .Test(xnn_f32_dwconv_ukernel_up4x4__psimd, DWConvMicrokernelTester::Variant::Scalar);
     }
   }
 
-  TEST(F32_DWCONV_UP4X9__PSIMD, multipixel_with_step) {
+  TEST(F32_DWCONV_UP4X4__PSIMD, multipixel_with_step) {
     TEST_REQUIRES_PSIMD;
     for (size_t channels = 1; channels <= 20; channels += 3) {
-      for (size_t step = 2; step <= 9; step++) {
+      for (size_t step = 2; step <= 4; step++) {
         DWConvMicrokernelTester()
           .cr(4)
-          .kr(9)
+          .kr(4)
           .channels(channels)
           .width(3)
           .step(step)
-          .Test(xnn_f32_dwconv_ukernel_up4x9__psimd, DWConvMicrokernelTester::Variant::Scalar);
+          .Test(xnn_f32_dwconv_ukernel_up4x4__psimd, DWConvMicrokernelTester::Variant::Scalar);
       }
     }
   }
 
-  TEST(F32_DWCONV_UP4X9__PSIMD, multipixel_with_output_stride) {
+  TEST(F32_DWCONV_UP4X4__PSIMD, multipixel_with_output_stride) {
     TEST_REQUIRES_PSIMD;
     for (size_t channels = 1; channels <= 20; channels += 3) {
       DWConvMicrokernelTester()
         .cr(4)
-        .kr(9)
+        .kr(4)
         .channels(4)
         .width(5)
         .output_stride(23)
-        .Test(xnn_f32_dwconv_ukernel_up4x9__psimd, DWConvMicrokernelTester::Variant::Scalar);
+        .Test(xnn_f32_dwconv_ukernel_up4x4__psimd, DWConvMicrokernelTester::Variant::Scalar);
     }
   }
 
-  TEST(F32_DWCONV_UP4X9__PSIMD, multipixel_with_qmin) {
+  TEST(F32_DWCONV_UP4X4__PSIMD, multipixel_with_qmin) {
     TEST_REQUIRES_PSIMD;
     for (size_t channels = 1; channels <= 20; channels += 3) {
       DWConvMicrokernelTester()
         .cr(4)
-        .kr(9)
+        .kr(4)
         .channels(channels)
         .width(3)
         .qmin(128)
-        .Test(xnn_f32_dwconv_ukernel_up4x9__psimd, DWConvMicrokernelTester::Variant::Scalar);
+        .Test(xnn_f32_dwconv_ukernel_up4x4__psimd, DWConvMicrokernelTester::Variant::Scalar);
     }
   }
 
-  TEST(F32_DWCONV_UP4X9__PSIMD, multipixel_with_qmax) {
+  TEST(F32_DWCONV_UP4X4__PSIMD, multipixel_with_qmax) {
     TEST_REQUIRES_PSIMD;
     for (size_t channels = 1; channels <= 20; channels += 3) {
       DWConvMicrokernelTester()
         .cr(4)
-        .kr(9)
+        .kr(4)
         .channels(channels)
         .width(3)
         .qmax(128)
-        .Test(xnn_f32_dwconv_ukernel_up4x9__psimd, DWConvMicrokernelTester::Variant::Scalar);
+        .Test(xnn_f32_dwconv_ukernel_up4x4__psimd, DWConvMicrokernelTester::Variant::Scalar);
     }
   }
 #endif  // !XNN_ARCH_ASMJS && !XNN_ARCH_WASM
 
 
 #if !XNN_ARCH_ASMJS && !XNN_ARCH_WASM
-  TEST(F32_DWCONV_UP4X4__PSIMD, c_eq_4) {
+  TEST(F32_DWCONV_MP4X4__PSIMD, c_eq_4) {
     TEST_REQUIRES_PSIMD;
     DWConvMicrokernelTester()
       .cr(4)
-      .kr(4)
+      .kr(9)
       .channels(4)
-      .Test(xnn_f32_dwconv_ukernel_up4x4__psimd, DWConvMicrokernelTester::Variant::Scalar);
+      .Test(xnn_f32_dwconv_ukernel_mp4x4__psimd, DWConvMicrokernelTester::Variant::Scalar);
   }
 
-  TEST(F32_DWCONV_UP4X4__PSIMD, c_div_4) {
+  TEST(F32_DWCONV_MP4X4__PSIMD, c_div_4) {
     TEST_REQUIRES_PSIMD;
     for (uint32_t channels = 8; channels < 64; channels += 12) {
       DWConvMicrokernelTester()
         .cr(4)
-        .kr(4)
+        .kr(9)
         .channels(channels)
-        .Test(xnn_f32_dwconv_ukernel_up4x4__psimd, DWConvMicrokernelTester::Variant::Scalar);
+        .Test(xnn_f32_dwconv_ukernel_mp4x4__psimd, DWConvMicrokernelTester::Variant::Scalar);
     }
   }
 
-  TEST(F32_DWCONV_UP4X4__PSIMD, c_div_4_with_qmin) {
+  TEST(F32_DWCONV_MP4X4__PSIMD, c_div_4_with_qmin) {
     TEST_REQUIRES_PSIMD;
     for (uint32_t channels = 8; channels < 64; channels += 12) {
       DWConvMicrokernelTester()
         .cr(4)
-        .kr(4)
+        .kr(9)
         .channels(channels)
         .qmin(128)
-        .Test(xnn_f32_dwconv_ukernel_up4x4__psimd, DWConvMicrokernelTester::Variant::Scalar);
+        .Test(xnn_f32_dwconv_ukernel_mp4x4__psimd, DWConvMicrokernelTester::Variant::Scalar);
     }
   }
 
-  TEST(F32_DWCONV_UP4X4__PSIMD, c_div_4_with_qmax) {
+  TEST(F32_DWCONV_MP4X4__PSIMD, c_div_4_with_qmax) {
     TEST_REQUIRES_PSIMD;
     for (uint32_t channels = 8; channels < 64; channels += 12) {
       DWConvMicrokernelTester()
         .cr(4)
-        .kr(4)
+        .kr(9)
         .channels(channels)
         .qmax(128)
-        .Test(xnn_f32_dwconv_ukernel_up4x4__psimd, DWConvMicrokernelTester::Variant::Scalar);
+        .Test(xnn_f32_dwconv_ukernel_mp4x4__psimd, DWConvMicrokernelTester::Variant::Scalar);
     }
   }
 
-  TEST(F32_DWCONV_UP4X4__PSIMD, c_lt_4) {
+  TEST(F32_DWCONV_MP4X4__PSIMD, c_lt_4) {
     TEST_REQUIRES_PSIMD;
     for (uint32_t channels = 1; channels < 4; channels++) {
       DWConvMicrokernelTester()
         .cr(4)
-        .kr(4)
+        .kr(9)
         .channels(channels)
-        .Test(xnn_f32_dwconv_ukernel_up4x4__psimd, DWConvMicrokernelTester::Variant::Scalar);
+        .Test(xnn_f32_dwconv_ukernel_mp4x4__psimd, DWConvMicrokernelTester::Variant::Scalar);
     }
   }
 
-  TEST(F32_DWCONV_UP4X4__PSIMD, c_gt_4) {
+  TEST(F32_DWCONV_MP4X4__PSIMD, c_gt_4) {
     TEST_REQUIRES_PSIMD;
     for (uint32_t channels = 5; channels < 8; channels++) {
       DWConvMicrokernelTester()
         .cr(4)
-        .kr(4)
+        .kr(9)
         .channels(channels)
-        .Test(xnn_f32_dwconv_ukernel_up4x4__psimd, DWConvMicrokernelTester::Variant::Scalar);
+        .Test(xnn_f32_dwconv_ukernel_mp4x4__psimd, DWConvMicrokernelTester::Variant::Scalar);
     }
   }
 
-  TEST(F32_DWCONV_UP4X4__PSIMD, c_gt_4_with_qmin) {
+  TEST(F32_DWCONV_MP4X4__PSIMD, c_gt_4_with_qmin) {
     TEST_REQUIRES_PSIMD;
     for (uint32_t channels = 5; channels < 8; channels++) {
       DWConvMicrokernelTester()
         .cr(4)
-        .kr(4)
+        .kr(9)
         .channels(channels)
         .qmin(128)
-        .Test(xnn_f32_dwconv_ukernel_up4x4__psimd, DWConvMicrokernelTester::Variant::Scalar);
+        .Test(xnn_f32_dwconv_ukernel_mp4x4__psimd, DWConvMicrokernelTester::Variant::Scalar);
     }
   }
 
-  TEST(F32_DWCONV_UP4X4__PSIMD, c_gt_4_with_qmax) {
+  TEST(F32_DWCONV_MP4X4__PSIMD, c_gt_4_with_qmax) {
     TEST_REQUIRES_PSIMD;
     for (uint32_t channels = 5; channels < 8; channels++) {
       DWConvMicrokernelTester()
         .cr(4)
-        .kr(4)
+        .kr(9)
         .channels(channels)
         .qmax(128)
-        .Test(xnn_f32_dwconv_ukernel_up4x4__psimd, DWConvMicrokernelTester::Variant::Scalar);
+        .Test(xnn_f32_dwconv_ukernel_mp4x4__psimd, DWConvMicrokernelTester::Variant::Scalar);
     }
   }
 
-  TEST(F32_DWCONV_UP4X4__PSIMD, multipixel) {
+  TEST(F32_DWCONV_MP4X4__PSIMD, multipixel) {
     TEST_REQUIRES_PSIMD;
     for (size_t channels = 1; channels <= 20; channels += 3) {
       DWConvMicrokernelTester()
         .cr(4)
-        .kr(4)
+        .kr(9)
         .channels(channels)
         .width(3)
-        .Test(xnn_f32_dwconv_ukernel_up4x4__psimd, DWConvMicrokernelTester::Variant::Scalar);
+        .Test(xnn_f32_dwconv_ukernel_mp4x4__psimd, DWConvMicrokernelTester::Variant::Scalar);
     }
   }
 
-  TEST(F32_DWCONV_UP4X4__PSIMD, multipixel_with_step) {
+  TEST(F32_DWCONV_MP4X4__PSIMD, multipixel_with_step) {
     TEST_REQUIRES_PSIMD;
     for (size_t channels = 1; channels <= 20; channels += 3) {
-      for (size_t step = 2; step <= 4; step++) {
+      for (size_t step = 2; step <= 9; step++) {
         DWConvMicrokernelTester()
           .cr(4)
-          .kr(4)
+          .kr(9)
           .channels(channels)
           .width(3)
           .step(step)
-          .Test(xnn_f32_dwconv_ukernel_up4x4__psimd, DWConvMicrokernelTester::Variant::Scalar);
+          .Test(xnn_f32_dwconv_ukernel_mp4x4__psimd, DWConvMicrokernelTester::Variant::Scalar);
       }
     }
   }
 
-  TEST(F32_DWCONV_UP4X4__PSIMD, multipixel_with_output_stride) {
+  TEST(F32_DWCONV_MP4X4__PSIMD, multipixel_with_output_stride) {
     TEST_REQUIRES_PSIMD;
     for (size_t channels = 1; channels <= 20; channels += 3) {
       DWConvMicrokernelTester()
         .cr(4)
-        .kr(4)
+        .kr(9)
         .channels(4)
         .width(5)
         .output_stride(23)
-        .Test(xnn_f32_dwconv_ukernel_up4x4__psimd, DWConvMicrokernelTester::Variant::Scalar);
+        .Test(xnn_f32_dwconv_ukernel_mp4x4__psimd, DWConvMicrokernelTester::Variant::Scalar);
     }
   }
 
-  TEST(F32_DWCONV_UP4X4__PSIMD, multipixel_with_qmin) {
+  TEST(F32_DWCONV_MP4X4__PSIMD, multipixel_with_qmin) {
     TEST_REQUIRES_PSIMD;
     for (size_t channels = 1; channels <= 20; channels += 3) {
       DWConvMicrokernelTester()
         .cr(4)
-        .kr(4)
+        .kr(9)
         .channels(channels)
         .width(3)
         .qmin(128)
-        .Test(xnn_f32_dwconv_ukernel_up4x4__psimd, DWConvMicrokernelTester::Variant::Scalar);
+        .Test(xnn_f32_dwconv_ukernel_mp4x4__psimd, DWConvMicrokernelTester::Variant::Scalar);
     }
   }
 
-  TEST(F32_DWCONV_UP4X4__PSIMD, multipixel_with_qmax) {
+  TEST(F32_DWCONV_MP4X4__PSIMD, multipixel_with_qmax) {
     TEST_REQUIRES_PSIMD;
     for (size_t channels = 1; channels <= 20; channels += 3) {
       DWConvMicrokernelTester()
         .cr(4)
-        .kr(4)
+        .kr(9)
         .channels(channels)
         .width(3)
         .qmax(128)
-        .Test(xnn_f32_dwconv_ukernel_up4x4__psimd, DWConvMicrokernelTester::Variant::Scalar);
+        .Test(xnn_f32_dwconv_ukernel_mp4x4__psimd, DWConvMicrokernelTester::Variant::Scalar);
+    }
+  }
+
+  TEST(F32_DWCONV_MP4X4__PSIMD, kernel_size_lt_4) {
+    TEST_REQUIRES_PSIMD;
+    for (uint32_t kernel_size = 1; kernel_size < 4; kernel_size++) {
+      for (uint32_t channels = 1; channels <= 12; channels += 3) {
+        DWConvMicrokernelTester()
+          .cr(4)
+          .kr(kernel_size)
+          .channels(channels)
+          .Test(xnn_f32_dwconv_ukernel_mp4x4__psimd, DWConvMicrokernelTester::Variant::Scalar);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV_MP4X4__PSIMD, kernel_size_eq_4) {
+    TEST_REQUIRES_PSIMD;
+    for (uint32_t channels = 1; channels <= 12; channels += 3) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .kr(4)
+        .channels(channels)
+        .Test(xnn_f32_dwconv_ukernel_mp4x4__psimd, DWConvMicrokernelTester::Variant::Scalar);
+    }
+  }
+
+  TEST(F32_DWCONV_MP4X4__PSIMD, kernel_size_div_4) {
+    TEST_REQUIRES_PSIMD;
+    for (uint32_t kernel_size = 8; kernel_size <= 16; kernel_size += 4) {
+      for (uint32_t channels = 1; channels <= 12; channels += 3) {
+        DWConvMicrokernelTester()
+          .cr(4)
+          .kr(kernel_size)
+          .channels(channels)
+          .Test(xnn_f32_dwconv_ukernel_mp4x4__psimd, DWConvMicrokernelTester::Variant::Scalar);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV_MP4X4__PSIMD, kernel_size_gt_4) {
+    TEST_REQUIRES_PSIMD;
+    for (uint32_t kernel_size = 5; kernel_size < 8; kernel_size++) {
+      for (uint32_t channels = 1; channels <= 12; channels += 3) {
+        DWConvMicrokernelTester()
+          .cr(4)
+          .kr(kernel_size)
+          .channels(channels)
+          .Test(xnn_f32_dwconv_ukernel_mp4x4__psimd, DWConvMicrokernelTester::Variant::Scalar);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV_MP4X4__PSIMD, kernel_size_eq_49) {
+    TEST_REQUIRES_PSIMD;
+    for (uint32_t channels = 1; channels <= 12; channels += 3) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .kr(49)
+        .channels(channels)
+        .width(3)
+        .step(7)
+        .Test(xnn_f32_dwconv_ukernel_mp4x4__psimd, DWConvMicrokernelTester::Variant::Scalar);
     }
   }
 #endif  // !XNN_ARCH_ASMJS && !XNN_ARCH_WASM
@@ -1923,3 +3033,163 @@ TEST(F32_DWCONV_UP1X25__SCALAR, multipixel_with_qmax) {
       .Test(xnn_f32_dwconv_ukernel_up1x25__scalar, DWConvMicrokernelTester::Variant::Scalar);
   }
 }
+
+
+TEST(F32_DWCONV_MP1X4__SCALAR, c_eq_1) {
+  DWConvMicrokernelTester()
+    .cr(1)
+    .kr(9)
+    .channels(1)
+    .Test(xnn_f32_dwconv_ukernel_mp1x4__scalar, DWConvMicrokernelTester::Variant::Scalar);
+}
+
+TEST(F32_DWCONV_MP1X4__SCALAR, c_gt_1) {
+  for (uint32_t channels = 2; channels < 10; channels++) {
+    DWConvMicrokernelTester()
+      .cr(1)
+      .kr(9)
+      .channels(channels)
+      .Test(xnn_f32_dwconv_ukernel_mp1x4__scalar, DWConvMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F32_DWCONV_MP1X4__SCALAR, c_gt_1_with_qmin) {
+  for (uint32_t channels = 2; channels < 10; channels++) {
+    DWConvMicrokernelTester()
+      .cr(1)
+      .kr(9)
+      .channels(channels)
+      .qmin(128)
+      .Test(xnn_f32_dwconv_ukernel_mp1x4__scalar, DWConvMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F32_DWCONV_MP1X4__SCALAR, c_gt_1_with_qmax) {
+  for (uint32_t channels = 2; channels < 10; channels++) {
+    DWConvMicrokernelTester()
+      .cr(1)
+      .kr(9)
+      .channels(channels)
+      .qmax(128)
+      .Test(xnn_f32_dwconv_ukernel_mp1x4__scalar, DWConvMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F32_DWCONV_MP1X4__SCALAR, multipixel) {
+  for (size_t channels = 1; channels <= 5; channels += 1) {
+    DWConvMicrokernelTester()
+      .cr(1)
+      .kr(9)
+      .channels(channels)
+      .width(3)
+      .Test(xnn_f32_dwconv_ukernel_mp1x4__scalar, DWConvMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F32_DWCONV_MP1X4__SCALAR, multipixel_with_step) {
+  for (size_t channels = 1; channels <= 5; channels += 1) {
+    for (size_t step = 2; step <= 9; step++) {
+      DWConvMicrokernelTester()
+        .cr(1)
+        .kr(9)
+        .channels(channels)
+        .width(3)
+        .step(step)
+        .Test(xnn_f32_dwconv_ukernel_mp1x4__scalar, DWConvMicrokernelTester::Variant::Scalar);
+    }
+  }
+}
+
+TEST(F32_DWCONV_MP1X4__SCALAR, multipixel_with_output_stride) {
+  for (size_t channels = 1; channels <= 5; channels += 1) {
+    DWConvMicrokernelTester()
+      .cr(1)
+      .kr(9)
+      .channels(1)
+      .width(5)
+      .output_stride(7)
+      .Test(xnn_f32_dwconv_ukernel_mp1x4__scalar, DWConvMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F32_DWCONV_MP1X4__SCALAR, multipixel_with_qmin) {
+  for (size_t channels = 1; channels <= 5; channels += 1) {
+    DWConvMicrokernelTester()
+      .cr(1)
+      .kr(9)
+      .channels(channels)
+      .width(3)
+      .qmin(128)
+      .Test(xnn_f32_dwconv_ukernel_mp1x4__scalar, DWConvMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F32_DWCONV_MP1X4__SCALAR, multipixel_with_qmax) {
+  for (size_t channels = 1; channels <= 5; channels += 1) {
+    DWConvMicrokernelTester()
+      .cr(1)
+      .kr(9)
+      .channels(channels)
+      .width(3)
+      .qmax(128)
+      .Test(xnn_f32_dwconv_ukernel_mp1x4__scalar, DWConvMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F32_DWCONV_MP1X4__SCALAR, kernel_size_lt_4) {
+  for (uint32_t kernel_size = 1; kernel_size < 4; kernel_size++) {
+    for (uint32_t channels = 1; channels <= 3; channels += 1) {
+      DWConvMicrokernelTester()
+        .cr(1)
+        .kr(kernel_size)
+        .channels(channels)
+        .Test(xnn_f32_dwconv_ukernel_mp1x4__scalar, DWConvMicrokernelTester::Variant::Scalar);
+    }
+  }
+}
+
+TEST(F32_DWCONV_MP1X4__SCALAR, kernel_size_eq_4) {
+  for (uint32_t channels = 1; channels <= 3; channels += 1) {
+    DWConvMicrokernelTester()
+      .cr(1)
+      .kr(4)
+      .channels(channels)
+      .Test(xnn_f32_dwconv_ukernel_mp1x4__scalar, DWConvMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F32_DWCONV_MP1X4__SCALAR, kernel_size_div_4) {
+  for (uint32_t kernel_size = 8; kernel_size <= 16; kernel_size += 4) {
+    for (uint32_t channels = 1; channels <= 3; channels += 1) {
+      DWConvMicrokernelTester()
+        .cr(1)
+        .kr(kernel_size)
+        .channels(channels)
+        .Test(xnn_f32_dwconv_ukernel_mp1x4__scalar, DWConvMicrokernelTester::Variant::Scalar);
+    }
+  }
+}
+
+TEST(F32_DWCONV_MP1X4__SCALAR, kernel_size_gt_4) {
+  for (uint32_t kernel_size = 5; kernel_size < 8; kernel_size++) {
+    for (uint32_t channels = 1; channels <= 3; channels += 1) {
+      DWConvMicrokernelTester()
+        .cr(1)
+        .kr(kernel_size)
+        .channels(channels)
+        .Test(xnn_f32_dwconv_ukernel_mp1x4__scalar, DWConvMicrokernelTester::Variant::Scalar);
+    }
+  }
+}
+
+TEST(F32_DWCONV_MP1X4__SCALAR, kernel_size_eq_49) {
+  for (uint32_t channels = 1; channels <= 3; channels += 1) {
+    DWConvMicrokernelTester()
+      .cr(1)
+      .kr(49)
+      .channels(channels)
+      .width(3)
+      .step(7)
+      .Test(xnn_f32_dwconv_ukernel_mp1x4__scalar, DWConvMicrokernelTester::Variant::Scalar);
+  }
+}
@@ -0,0 +1,187 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <gtest/gtest.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/isa-checks.h>
+
+#include <xnnpack/raddstoreexpminusmax.h>
+#include "raddstoreexpminusmax-microkernel-tester.h"
+
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  TEST(F32_RADDSTOREEXPMINUSMAX__NEON_X8, n_eq_8) {
+    TEST_REQUIRES_ARM_NEON;
+    RAddStoreExpMinusMaxMicrokernelTester()
+      .n(8)
+      .Test(xnn_f32_raddstoreexpminusmax_ukernel__neon_x8);
+  }
+
+  TEST(F32_RADDSTOREEXPMINUSMAX__NEON_X8, n_div_8) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 16; n < 80; n += 8) {
+      RAddStoreExpMinusMaxMicrokernelTester()
+        .n(n)
+        .Test(xnn_f32_raddstoreexpminusmax_ukernel__neon_x8);
+    }
+  }
+
+  TEST(F32_RADDSTOREEXPMINUSMAX__NEON_X8, n_lt_8) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 1; n < 8; n++) {
+      RAddStoreExpMinusMaxMicrokernelTester()
+        .n(n)
+        .Test(xnn_f32_raddstoreexpminusmax_ukernel__neon_x8);
+    }
+  }
+
+  TEST(F32_RADDSTOREEXPMINUSMAX__NEON_X8, n_gt_8) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 9; n < 16; n++) {
+      RAddStoreExpMinusMaxMicrokernelTester()
+        .n(n)
+        .Test(xnn_f32_raddstoreexpminusmax_ukernel__neon_x8);
+    }
+  }
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_RADDSTOREEXPMINUSMAX__SSE2_X8, n_eq_8) {
+    TEST_REQUIRES_X86_SSE2;
+    RAddStoreExpMinusMaxMicrokernelTester()
+      .n(8)
+      .Test(xnn_f32_raddstoreexpminusmax_ukernel__sse2_x8);
+  }
+
+  TEST(F32_RADDSTOREEXPMINUSMAX__SSE2_X8, n_div_8) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t n = 16; n < 80; n += 8) {
+      RAddStoreExpMinusMaxMicrokernelTester()
+        .n(n)
+        .Test(xnn_f32_raddstoreexpminusmax_ukernel__sse2_x8);
+    }
+  }
+
+  TEST(F32_RADDSTOREEXPMINUSMAX__SSE2_X8, n_lt_8) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t n = 1; n < 8; n++) {
+      RAddStoreExpMinusMaxMicrokernelTester()
+        .n(n)
+        .Test(xnn_f32_raddstoreexpminusmax_ukernel__sse2_x8);
+    }
+  }
+
+  TEST(F32_RADDSTOREEXPMINUSMAX__SSE2_X8, n_gt_8) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t n = 9; n < 16; n++) {
+      RAddStoreExpMinusMaxMicrokernelTester()
+        .n(n)
+        .Test(xnn_f32_raddstoreexpminusmax_ukernel__sse2_x8);
+    }
+  }
+
+  TEST(F32_RADDSTOREEXPMINUSMAX__AVX2_X32, n_eq_32) {
+    TEST_REQUIRES_X86_AVX2;
+    TEST_REQUIRES_X86_FMA3;
+    RAddStoreExpMinusMaxMicrokernelTester()
+      .n(32)
+      .Test(xnn_f32_raddstoreexpminusmax_ukernel__avx2_x32);
+  }
+
+  TEST(F32_RADDSTOREEXPMINUSMAX__AVX2_X32, n_div_32) {
+    TEST_REQUIRES_X86_AVX2;
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t n = 64; n < 320; n += 32) {
+      RAddStoreExpMinusMaxMicrokernelTester()
+        .n(n)
+        .Test(xnn_f32_raddstoreexpminusmax_ukernel__avx2_x32);
+    }
+  }
+
+  TEST(F32_RADDSTOREEXPMINUSMAX__AVX2_X32, n_lt_32) {
+    TEST_REQUIRES_X86_AVX2;
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t n = 1; n < 32; n++) {
+      RAddStoreExpMinusMaxMicrokernelTester()
+        .n(n)
+        .Test(xnn_f32_raddstoreexpminusmax_ukernel__avx2_x32);
+    }
+  }
+
+  TEST(F32_RADDSTOREEXPMINUSMAX__AVX2_X32, n_gt_32) {
+    TEST_REQUIRES_X86_AVX2;
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t n = 33; n < 64; n++) {
+      RAddStoreExpMinusMaxMicrokernelTester()
+        .n(n)
+        .Test(xnn_f32_raddstoreexpminusmax_ukernel__avx2_x32);
+    }
+  }
+
+  TEST(F32_RADDSTOREEXPMINUSMAX__AVX512F_X64, n_eq_64) {
+    TEST_REQUIRES_X86_AVX512F;
+    RAddStoreExpMinusMaxMicrokernelTester()
+      .n(64)
+      .Test(xnn_f32_raddstoreexpminusmax_ukernel__avx512f_x64);
+  }
+
+  TEST(F32_RADDSTOREEXPMINUSMAX__AVX512F_X64, n_div_64) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t n = 128; n < 640; n += 64) {
+      RAddStoreExpMinusMaxMicrokernelTester()
+        .n(n)
+        .Test(xnn_f32_raddstoreexpminusmax_ukernel__avx512f_x64);
+    }
+  }
+
+  TEST(F32_RADDSTOREEXPMINUSMAX__AVX512F_X64, n_lt_64) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t n = 1; n < 64; n++) {
+      RAddStoreExpMinusMaxMicrokernelTester()
+        .n(n)
+        .Test(xnn_f32_raddstoreexpminusmax_ukernel__avx512f_x64);
+    }
+  }
+
+  TEST(F32_RADDSTOREEXPMINUSMAX__AVX512F_X64, n_gt_64) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t n = 65; n < 128; n++) {
+      RAddStoreExpMinusMaxMicrokernelTester()
+        .n(n)
+        .Test(xnn_f32_raddstoreexpminusmax_ukernel__avx512f_x64);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+TEST(F32_RADDSTOREEXPMINUSMAX__SCALAR_X4, n_eq_4) {
+  RAddStoreExpMinusMaxMicrokernelTester()
+    .n(4)
+    .Test(xnn_f32_raddstoreexpminusmax_ukernel__scalar_x4);
+}
+
+TEST(F32_RADDSTOREEXPMINUSMAX__SCALAR_X4, n_div_4) {
+  for (size_t n = 8; n < 40; n += 4) {
+    RAddStoreExpMinusMaxMicrokernelTester()
+      .n(n)
+      .Test(xnn_f32_raddstoreexpminusmax_ukernel__scalar_x4);
+  }
+}
+
+TEST(F32_RADDSTOREEXPMINUSMAX__SCALAR_X4, n_lt_4) {
+  for (size_t n = 1; n < 4; n++) {
+    RAddStoreExpMinusMaxMicrokernelTester()
+      .n(n)
+      .Test(xnn_f32_raddstoreexpminusmax_ukernel__scalar_x4);
+  }
+}
+
+TEST(F32_RADDSTOREEXPMINUSMAX__SCALAR_X4, n_gt_4) {
+  for (size_t n = 5; n < 8; n++) {
+    RAddStoreExpMinusMaxMicrokernelTester()
+      .n(n)
+      .Test(xnn_f32_raddstoreexpminusmax_ukernel__scalar_x4);
+  }
+}
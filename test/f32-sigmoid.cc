@@ -0,0 +1,237 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <gtest/gtest.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/isa-checks.h>
+
+#include <xnnpack/vunary.h>
+#include "vunary-microkernel-tester.h"
+
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  TEST(F32_SIGMOID__NEON_X8, n_eq_8) {
+    TEST_REQUIRES_ARM_NEON;
+    VUnOpMicrokernelTester()
+      .n(8)
+      .Test(xnn_f32_sigmoid_ukernel__neon_x8, VUnOpMicrokernelTester::OpType::Sigmoid);
+  }
+
+  TEST(F32_SIGMOID__NEON_X8, n_div_8) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 16; n < 80; n += 8) {
+      VUnOpMicrokernelTester()
+        .n(n)
+        .Test(xnn_f32_sigmoid_ukernel__neon_x8, VUnOpMicrokernelTester::OpType::Sigmoid);
+    }
+  }
+
+  TEST(F32_SIGMOID__NEON_X8, n_lt_8) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 1; n < 8; n++) {
+      VUnOpMicrokernelTester()
+        .n(n)
+        .Test(xnn_f32_sigmoid_ukernel__neon_x8, VUnOpMicrokernelTester::OpType::Sigmoid);
+    }
+  }
+
+  TEST(F32_SIGMOID__NEON_X8, n_gt_8) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 9; n < 16; n++) {
+      VUnOpMicrokernelTester()
+        .n(n)
+        .Test(xnn_f32_sigmoid_ukernel__neon_x8, VUnOpMicrokernelTester::OpType::Sigmoid);
+    }
+  }
+
+  TEST(F32_SIGMOID__NEON_X8, inplace) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 1; n <= 40; n += 7) {
+      VUnOpMicrokernelTester()
+        .n(n)
+        .inplace(true)
+        .Test(xnn_f32_sigmoid_ukernel__neon_x8, VUnOpMicrokernelTester::OpType::Sigmoid);
+    }
+  }
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_SIGMOID__SSE2_X8, n_eq_8) {
+    TEST_REQUIRES_X86_SSE2;
+    VUnOpMicrokernelTester()
+      .n(8)
+      .Test(xnn_f32_sigmoid_ukernel__sse2_x8, VUnOpMicrokernelTester::OpType::Sigmoid);
+  }
+
+  TEST(F32_SIGMOID__SSE2_X8, n_div_8) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t n = 16; n < 80; n += 8) {
+      VUnOpMicrokernelTester()
+        .n(n)
+        .Test(xnn_f32_sigmoid_ukernel__sse2_x8, VUnOpMicrokernelTester::OpType::Sigmoid);
+    }
+  }
+
+  TEST(F32_SIGMOID__SSE2_X8, n_lt_8) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t n = 1; n < 8; n++) {
+      VUnOpMicrokernelTester()
+        .n(n)
+        .Test(xnn_f32_sigmoid_ukernel__sse2_x8, VUnOpMicrokernelTester::OpType::Sigmoid);
+    }
+  }
+
+  TEST(F32_SIGMOID__SSE2_X8, n_gt_8) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t n = 9; n < 16; n++) {
+      VUnOpMicrokernelTester()
+        .n(n)
+        .Test(xnn_f32_sigmoid_ukernel__sse2_x8, VUnOpMicrokernelTester::OpType::Sigmoid);
+    }
+  }
+
+  TEST(F32_SIGMOID__SSE2_X8, inplace) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t n = 1; n <= 40; n += 7) {
+      VUnOpMicrokernelTester()
+        .n(n)
+        .inplace(true)
+        .Test(xnn_f32_sigmoid_ukernel__sse2_x8, VUnOpMicrokernelTester::OpType::Sigmoid);
+    }
+  }
+
+  TEST(F32_SIGMOID__AVX2_X16, n_eq_16) {
+    TEST_REQUIRES_X86_AVX2;
+    TEST_REQUIRES_X86_FMA3;
+    VUnOpMicrokernelTester()
+      .n(16)
+      .Test(xnn_f32_sigmoid_ukernel__avx2_x16, VUnOpMicrokernelTester::OpType::Sigmoid);
+  }
+
+  TEST(F32_SIGMOID__AVX2_X16, n_div_16) {
+    TEST_REQUIRES_X86_AVX2;
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t n = 32; n < 160; n += 16) {
+      VUnOpMicrokernelTester()
+        .n(n)
+        .Test(xnn_f32_sigmoid_ukernel__avx2_x16, VUnOpMicrokernelTester::OpType::Sigmoid);
+    }
+  }
+
+  TEST(F32_SIGMOID__AVX2_X16, n_lt_16) {
+    TEST_REQUIRES_X86_AVX2;
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t n = 1; n < 16; n++) {
+      VUnOpMicrokernelTester()
+        .n(n)
+        .Test(xnn_f32_sigmoid_ukernel__avx2_x16, VUnOpMicrokernelTester::OpType::Sigmoid);
+    }
+  }
+
+  TEST(F32_SIGMOID__AVX2_X16, n_gt_16) {
+    TEST_REQUIRES_X86_AVX2;
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t n = 17; n < 32; n++) {
+      VUnOpMicrokernelTester()
+        .n(n)
+        .Test(xnn_f32_sigmoid_ukernel__avx2_x16, VUnOpMicrokernelTester::OpType::Sigmoid);
+    }
+  }
+
+  TEST(F32_SIGMOID__AVX2_X16, inplace) {
+    TEST_REQUIRES_X86_AVX2;
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t n = 1; n <= 80; n += 15) {
+      VUnOpMicrokernelTester()
+        .n(n)
+        .inplace(true)
+        .Test(xnn_f32_sigmoid_ukernel__avx2_x16, VUnOpMicrokernelTester::OpType::Sigmoid);
+    }
+  }
+
+  TEST(F32_SIGMOID__AVX512F_X32, n_eq_32) {
+    TEST_REQUIRES_X86_AVX512F;
+    VUnOpMicrokernelTester()
+      .n(32)
+      .Test(xnn_f32_sigmoid_ukernel__avx512f_x32, VUnOpMicrokernelTester::OpType::Sigmoid);
+  }
+
+  TEST(F32_SIGMOID__AVX512F_X32, n_div_32) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t n = 64; n < 320; n += 32) {
+      VUnOpMicrokernelTester()
+        .n(n)
+        .Test(xnn_f32_sigmoid_ukernel__avx512f_x32, VUnOpMicrokernelTester::OpType::Sigmoid);
+    }
+  }
+
+  TEST(F32_SIGMOID__AVX512F_X32, n_lt_32) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t n = 1; n < 32; n++) {
+      VUnOpMicrokernelTester()
+        .n(n)
+        .Test(xnn_f32_sigmoid_ukernel__avx512f_x32, VUnOpMicrokernelTester::OpType::Sigmoid);
+    }
+  }
+
+  TEST(F32_SIGMOID__AVX512F_X32, n_gt_32) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t n = 33; n < 64; n++) {
+      VUnOpMicrokernelTester()
+        .n(n)
+        .Test(xnn_f32_sigmoid_ukernel__avx512f_x32, VUnOpMicrokernelTester::OpType::Sigmoid);
+    }
+  }
+
+  TEST(F32_SIGMOID__AVX512F_X32, inplace) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t n = 1; n <= 160; n += 31) {
+      VUnOpMicrokernelTester()
+        .n(n)
+        .inplace(true)
+        .Test(xnn_f32_sigmoid_ukernel__avx512f_x32, VUnOpMicrokernelTester::OpType::Sigmoid);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+TEST(F32_SIGMOID__SCALAR_X2, n_eq_2) {
+  VUnOpMicrokernelTester()
+    .n(2)
+    .Test(xnn_f32_sigmoid_ukernel__scalar_x2, VUnOpMicrokernelTester::OpType::Sigmoid);
+}
+
+TEST(F32_SIGMOID__SCALAR_X2, n_div_2) {
+  for (size_t n = 4; n < 20; n += 2) {
+    VUnOpMicrokernelTester()
+      .n(n)
+      .Test(xnn_f32_sigmoid_ukernel__scalar_x2, VUnOpMicrokernelTester::OpType::Sigmoid);
+  }
+}
+
+TEST(F32_SIGMOID__SCALAR_X2, n_lt_2) {
+  for (size_t n = 1; n < 2; n++) {
+    VUnOpMicrokernelTester()
+      .n(n)
+      .Test(xnn_f32_sigmoid_ukernel__scalar_x2, VUnOpMicrokernelTester::OpType::Sigmoid);
+  }
+}
+
+TEST(F32_SIGMOID__SCALAR_X2, n_gt_2) {
+  for (size_t n = 3; n < 4; n++) {
+    VUnOpMicrokernelTester()
+      .n(n)
+      .Test(xnn_f32_sigmoid_ukernel__scalar_x2, VUnOpMicrokernelTester::OpType::Sigmoid);
+  }
+}
+
+TEST(F32_SIGMOID__SCALAR_X2, inplace) {
+  for (size_t n = 1; n <= 10; n += 1) {
+    VUnOpMicrokernelTester()
+      .n(n)
+      .inplace(true)
+      .Test(xnn_f32_sigmoid_ukernel__scalar_x2, VUnOpMicrokernelTester::OpType::Sigmoid);
+  }
+}
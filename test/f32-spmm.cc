@@ -3761,6 +3761,3261 @@
 #endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
 
 
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_SPMM_4X2__SSE, k_eq_1) {
+    TEST_REQUIRES_X86_SSE;
+    SpMMMicrokernelTester()
+      .mr(4)
+      .nr(2)
+      .m(4)
+      .n(2)
+      .k(1)
+      .sparsity(0.0f)
+      .Test(xnn_f32_spmm_ukernel_4x2__sse);
+  }
+
+  TEST(F32_SPMM_4X2__SSE, k_eq_1_subtile) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 1; n <= 2; n++) {
+      SpMMMicrokernelTester()
+        .mr(4)
+        .nr(2)
+        .m(4)
+        .n(n)
+        .k(1)
+        .sparsity(0.0f)
+        .Test(xnn_f32_spmm_ukernel_4x2__sse);
+    }
+  }
+
+  TEST(F32_SPMM_4X2__SSE, k_gt_1) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t k = 2; k < 10; k++) {
+      SpMMMicrokernelTester()
+        .mr(4)
+        .nr(2)
+        .m(4)
+        .n(2)
+        .k(k)
+        .sparsity(0.0f)
+        .Test(xnn_f32_spmm_ukernel_4x2__sse);
+    }
+  }
+
+  TEST(F32_SPMM_4X2__SSE, k_gt_1_subtile) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t k = 2; k < 10; k++) {
+      for (uint32_t n = 1; n <= 2; n++) {
+        SpMMMicrokernelTester()
+          .mr(4)
+          .nr(2)
+          .m(4)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .Test(xnn_f32_spmm_ukernel_4x2__sse);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_4X2__SSE, n_gt_2) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 3; n < 10; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(4)
+          .nr(2)
+          .m(4)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .Test(xnn_f32_spmm_ukernel_4x2__sse);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_4X2__SSE, n_div_2) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 4; n <= 6; n += 2) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(4)
+          .nr(2)
+          .m(4)
+          .n(n)
+          .k(k)
+          .Test(xnn_f32_spmm_ukernel_4x2__sse);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_4X2__SSE, m_lt_4) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t m = 1; m < 4; m++) {
+      for (uint32_t n = 1; n < 10; n += 3) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(4)
+            .nr(2)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_ukernel_4x2__sse);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_4X2__SSE, m_div_4) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t m = 8; m <= 12; m += 4) {
+      for (uint32_t n = 1; n < 10; n += 3) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(4)
+            .nr(2)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_ukernel_4x2__sse);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_4X2__SSE, m_gt_4) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t m = 5; m < 8; m++) {
+      for (uint32_t n = 1; n < 10; n += 3) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(4)
+            .nr(2)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_ukernel_4x2__sse);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_4X2__SSE, qmin) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 1; n < 10; n += 3) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(4)
+          .nr(2)
+          .m(8)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .qmin(128)
+          .Test(xnn_f32_spmm_ukernel_4x2__sse);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_4X2__SSE, qmax) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 1; n < 10; n += 3) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(4)
+          .nr(2)
+          .m(8)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .qmax(128)
+          .Test(xnn_f32_spmm_ukernel_4x2__sse);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_4X2__SSE, half_sparse) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 1; n < 10; n += 3) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(4)
+          .nr(2)
+          .m(8)
+          .n(n)
+          .k(k)
+          .sparsity(0.5f)
+          .Test(xnn_f32_spmm_ukernel_4x2__sse);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_4X2__SSE, zero_weights) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 1; n < 10; n += 3) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(4)
+          .nr(2)
+          .m(8)
+          .n(n)
+          .k(k)
+          .sparsity(1.0f)
+          .Test(xnn_f32_spmm_ukernel_4x2__sse);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_SPMM_4X4__SSE, k_eq_1) {
+    TEST_REQUIRES_X86_SSE;
+    SpMMMicrokernelTester()
+      .mr(4)
+      .nr(4)
+      .m(4)
+      .n(4)
+      .k(1)
+      .sparsity(0.0f)
+      .Test(xnn_f32_spmm_ukernel_4x4__sse);
+  }
+
+  TEST(F32_SPMM_4X4__SSE, k_eq_1_subtile) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 1; n <= 4; n++) {
+      SpMMMicrokernelTester()
+        .mr(4)
+        .nr(4)
+        .m(4)
+        .n(n)
+        .k(1)
+        .sparsity(0.0f)
+        .Test(xnn_f32_spmm_ukernel_4x4__sse);
+    }
+  }
+
+  TEST(F32_SPMM_4X4__SSE, k_gt_1) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t k = 2; k < 10; k++) {
+      SpMMMicrokernelTester()
+        .mr(4)
+        .nr(4)
+        .m(4)
+        .n(4)
+        .k(k)
+        .sparsity(0.0f)
+        .Test(xnn_f32_spmm_ukernel_4x4__sse);
+    }
+  }
+
+  TEST(F32_SPMM_4X4__SSE, k_gt_1_subtile) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t k = 2; k < 10; k++) {
+      for (uint32_t n = 1; n <= 4; n++) {
+        SpMMMicrokernelTester()
+          .mr(4)
+          .nr(4)
+          .m(4)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .Test(xnn_f32_spmm_ukernel_4x4__sse);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_4X4__SSE, n_gt_4) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 5; n < 10; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(4)
+          .nr(4)
+          .m(4)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .Test(xnn_f32_spmm_ukernel_4x4__sse);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_4X4__SSE, n_div_4) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 8; n <= 12; n += 4) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(4)
+          .nr(4)
+          .m(4)
+          .n(n)
+          .k(k)
+          .Test(xnn_f32_spmm_ukernel_4x4__sse);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_4X4__SSE, m_lt_4) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t m = 1; m < 4; m++) {
+      for (uint32_t n = 1; n < 20; n += 5) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(4)
+            .nr(4)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_ukernel_4x4__sse);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_4X4__SSE, m_div_4) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t m = 8; m <= 12; m += 4) {
+      for (uint32_t n = 1; n < 20; n += 5) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(4)
+            .nr(4)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_ukernel_4x4__sse);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_4X4__SSE, m_gt_4) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t m = 5; m < 8; m++) {
+      for (uint32_t n = 1; n < 20; n += 5) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(4)
+            .nr(4)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_ukernel_4x4__sse);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_4X4__SSE, qmin) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 1; n < 20; n += 5) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(4)
+          .nr(4)
+          .m(8)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .qmin(128)
+          .Test(xnn_f32_spmm_ukernel_4x4__sse);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_4X4__SSE, qmax) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 1; n < 20; n += 5) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(4)
+          .nr(4)
+          .m(8)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .qmax(128)
+          .Test(xnn_f32_spmm_ukernel_4x4__sse);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_4X4__SSE, half_sparse) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 1; n < 20; n += 5) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(4)
+          .nr(4)
+          .m(8)
+          .n(n)
+          .k(k)
+          .sparsity(0.5f)
+          .Test(xnn_f32_spmm_ukernel_4x4__sse);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_4X4__SSE, zero_weights) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 1; n < 20; n += 5) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(4)
+          .nr(4)
+          .m(8)
+          .n(n)
+          .k(k)
+          .sparsity(1.0f)
+          .Test(xnn_f32_spmm_ukernel_4x4__sse);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_SPMM_8X2__SSE, k_eq_1) {
+    TEST_REQUIRES_X86_SSE;
+    SpMMMicrokernelTester()
+      .mr(8)
+      .nr(2)
+      .m(8)
+      .n(2)
+      .k(1)
+      .sparsity(0.0f)
+      .Test(xnn_f32_spmm_ukernel_8x2__sse);
+  }
+
+  TEST(F32_SPMM_8X2__SSE, k_eq_1_subtile) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 1; n <= 2; n++) {
+      SpMMMicrokernelTester()
+        .mr(8)
+        .nr(2)
+        .m(8)
+        .n(n)
+        .k(1)
+        .sparsity(0.0f)
+        .Test(xnn_f32_spmm_ukernel_8x2__sse);
+    }
+  }
+
+  TEST(F32_SPMM_8X2__SSE, k_gt_1) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t k = 2; k < 10; k++) {
+      SpMMMicrokernelTester()
+        .mr(8)
+        .nr(2)
+        .m(8)
+        .n(2)
+        .k(k)
+        .sparsity(0.0f)
+        .Test(xnn_f32_spmm_ukernel_8x2__sse);
+    }
+  }
+
+  TEST(F32_SPMM_8X2__SSE, k_gt_1_subtile) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t k = 2; k < 10; k++) {
+      for (uint32_t n = 1; n <= 2; n++) {
+        SpMMMicrokernelTester()
+          .mr(8)
+          .nr(2)
+          .m(8)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .Test(xnn_f32_spmm_ukernel_8x2__sse);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_8X2__SSE, n_gt_2) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 3; n < 10; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(8)
+          .nr(2)
+          .m(8)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .Test(xnn_f32_spmm_ukernel_8x2__sse);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_8X2__SSE, n_div_2) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 4; n <= 6; n += 2) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(8)
+          .nr(2)
+          .m(8)
+          .n(n)
+          .k(k)
+          .Test(xnn_f32_spmm_ukernel_8x2__sse);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_8X2__SSE, m_lt_8) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t m = 1; m < 8; m++) {
+      for (uint32_t n = 1; n < 10; n += 3) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(8)
+            .nr(2)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_ukernel_8x2__sse);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_8X2__SSE, m_div_8) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t m = 16; m <= 24; m += 8) {
+      for (uint32_t n = 1; n < 10; n += 3) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(8)
+            .nr(2)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_ukernel_8x2__sse);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_8X2__SSE, m_gt_8) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t m = 9; m < 16; m++) {
+      for (uint32_t n = 1; n < 10; n += 3) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(8)
+            .nr(2)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_ukernel_8x2__sse);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_8X2__SSE, qmin) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 1; n < 10; n += 3) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(8)
+          .nr(2)
+          .m(16)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .qmin(128)
+          .Test(xnn_f32_spmm_ukernel_8x2__sse);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_8X2__SSE, qmax) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 1; n < 10; n += 3) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(8)
+          .nr(2)
+          .m(16)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .qmax(128)
+          .Test(xnn_f32_spmm_ukernel_8x2__sse);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_8X2__SSE, half_sparse) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 1; n < 10; n += 3) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(8)
+          .nr(2)
+          .m(16)
+          .n(n)
+          .k(k)
+          .sparsity(0.5f)
+          .Test(xnn_f32_spmm_ukernel_8x2__sse);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_8X2__SSE, zero_weights) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 1; n < 10; n += 3) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(8)
+          .nr(2)
+          .m(16)
+          .n(n)
+          .k(k)
+          .sparsity(1.0f)
+          .Test(xnn_f32_spmm_ukernel_8x2__sse);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_SPMM_8X4__SSE, k_eq_1) {
+    TEST_REQUIRES_X86_SSE;
+    SpMMMicrokernelTester()
+      .mr(8)
+      .nr(4)
+      .m(8)
+      .n(4)
+      .k(1)
+      .sparsity(0.0f)
+      .Test(xnn_f32_spmm_ukernel_8x4__sse);
+  }
+
+  TEST(F32_SPMM_8X4__SSE, k_eq_1_subtile) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 1; n <= 4; n++) {
+      SpMMMicrokernelTester()
+        .mr(8)
+        .nr(4)
+        .m(8)
+        .n(n)
+        .k(1)
+        .sparsity(0.0f)
+        .Test(xnn_f32_spmm_ukernel_8x4__sse);
+    }
+  }
+
+  TEST(F32_SPMM_8X4__SSE, k_gt_1) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t k = 2; k < 10; k++) {
+      SpMMMicrokernelTester()
+        .mr(8)
+        .nr(4)
+        .m(8)
+        .n(4)
+        .k(k)
+        .sparsity(0.0f)
+        .Test(xnn_f32_spmm_ukernel_8x4__sse);
+    }
+  }
+
+  TEST(F32_SPMM_8X4__SSE, k_gt_1_subtile) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t k = 2; k < 10; k++) {
+      for (uint32_t n = 1; n <= 4; n++) {
+        SpMMMicrokernelTester()
+          .mr(8)
+          .nr(4)
+          .m(8)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .Test(xnn_f32_spmm_ukernel_8x4__sse);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_8X4__SSE, n_gt_4) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 5; n < 10; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(8)
+          .nr(4)
+          .m(8)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .Test(xnn_f32_spmm_ukernel_8x4__sse);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_8X4__SSE, n_div_4) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 8; n <= 12; n += 4) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(8)
+          .nr(4)
+          .m(8)
+          .n(n)
+          .k(k)
+          .Test(xnn_f32_spmm_ukernel_8x4__sse);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_8X4__SSE, m_lt_8) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t m = 1; m < 8; m++) {
+      for (uint32_t n = 1; n < 20; n += 5) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(8)
+            .nr(4)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_ukernel_8x4__sse);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_8X4__SSE, m_div_8) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t m = 16; m <= 24; m += 8) {
+      for (uint32_t n = 1; n < 20; n += 5) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(8)
+            .nr(4)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_ukernel_8x4__sse);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_8X4__SSE, m_gt_8) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t m = 9; m < 16; m++) {
+      for (uint32_t n = 1; n < 20; n += 5) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(8)
+            .nr(4)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_ukernel_8x4__sse);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_8X4__SSE, qmin) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 1; n < 20; n += 5) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(8)
+          .nr(4)
+          .m(16)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .qmin(128)
+          .Test(xnn_f32_spmm_ukernel_8x4__sse);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_8X4__SSE, qmax) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 1; n < 20; n += 5) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(8)
+          .nr(4)
+          .m(16)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .qmax(128)
+          .Test(xnn_f32_spmm_ukernel_8x4__sse);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_8X4__SSE, half_sparse) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 1; n < 20; n += 5) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(8)
+          .nr(4)
+          .m(16)
+          .n(n)
+          .k(k)
+          .sparsity(0.5f)
+          .Test(xnn_f32_spmm_ukernel_8x4__sse);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_8X4__SSE, zero_weights) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 1; n < 20; n += 5) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(8)
+          .nr(4)
+          .m(16)
+          .n(n)
+          .k(k)
+          .sparsity(1.0f)
+          .Test(xnn_f32_spmm_ukernel_8x4__sse);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_SPMM_16X1__SSE, k_eq_1) {
+    TEST_REQUIRES_X86_SSE;
+    SpMMMicrokernelTester()
+      .mr(16)
+      .nr(1)
+      .m(16)
+      .n(1)
+      .k(1)
+      .sparsity(0.0f)
+      .Test(xnn_f32_spmm_ukernel_16x1__sse);
+  }
+
+  TEST(F32_SPMM_16X1__SSE, k_gt_1) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t k = 2; k < 10; k++) {
+      SpMMMicrokernelTester()
+        .mr(16)
+        .nr(1)
+        .m(16)
+        .n(1)
+        .k(k)
+        .sparsity(0.0f)
+        .Test(xnn_f32_spmm_ukernel_16x1__sse);
+    }
+  }
+
+  TEST(F32_SPMM_16X1__SSE, n_gt_1) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 2; n < 10; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(16)
+          .nr(1)
+          .m(16)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .Test(xnn_f32_spmm_ukernel_16x1__sse);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_16X1__SSE, m_lt_16) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t m = 1; m < 16; m++) {
+      for (uint32_t n = 1; n < 10; n += 2) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(16)
+            .nr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_ukernel_16x1__sse);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_16X1__SSE, m_div_16) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t m = 32; m <= 48; m += 16) {
+      for (uint32_t n = 1; n < 10; n += 2) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(16)
+            .nr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_ukernel_16x1__sse);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_16X1__SSE, m_gt_16) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t m = 17; m < 32; m++) {
+      for (uint32_t n = 1; n < 10; n += 2) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(16)
+            .nr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_ukernel_16x1__sse);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_16X1__SSE, qmin) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(16)
+          .nr(1)
+          .m(32)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .qmin(128)
+          .Test(xnn_f32_spmm_ukernel_16x1__sse);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_16X1__SSE, qmax) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(16)
+          .nr(1)
+          .m(32)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .qmax(128)
+          .Test(xnn_f32_spmm_ukernel_16x1__sse);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_16X1__SSE, half_sparse) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(16)
+          .nr(1)
+          .m(32)
+          .n(n)
+          .k(k)
+          .sparsity(0.5f)
+          .Test(xnn_f32_spmm_ukernel_16x1__sse);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_16X1__SSE, zero_weights) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(16)
+          .nr(1)
+          .m(32)
+          .n(n)
+          .k(k)
+          .sparsity(1.0f)
+          .Test(xnn_f32_spmm_ukernel_16x1__sse);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_SPMM_16X2__SSE, k_eq_1) {
+    TEST_REQUIRES_X86_SSE;
+    SpMMMicrokernelTester()
+      .mr(16)
+      .nr(2)
+      .m(16)
+      .n(2)
+      .k(1)
+      .sparsity(0.0f)
+      .Test(xnn_f32_spmm_ukernel_16x2__sse);
+  }
+
+  TEST(F32_SPMM_16X2__SSE, k_eq_1_subtile) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 1; n <= 2; n++) {
+      SpMMMicrokernelTester()
+        .mr(16)
+        .nr(2)
+        .m(16)
+        .n(n)
+        .k(1)
+        .sparsity(0.0f)
+        .Test(xnn_f32_spmm_ukernel_16x2__sse);
+    }
+  }
+
+  TEST(F32_SPMM_16X2__SSE, k_gt_1) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t k = 2; k < 10; k++) {
+      SpMMMicrokernelTester()
+        .mr(16)
+        .nr(2)
+        .m(16)
+        .n(2)
+        .k(k)
+        .sparsity(0.0f)
+        .Test(xnn_f32_spmm_ukernel_16x2__sse);
+    }
+  }
+
+  TEST(F32_SPMM_16X2__SSE, k_gt_1_subtile) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t k = 2; k < 10; k++) {
+      for (uint32_t n = 1; n <= 2; n++) {
+        SpMMMicrokernelTester()
+          .mr(16)
+          .nr(2)
+          .m(16)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .Test(xnn_f32_spmm_ukernel_16x2__sse);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_16X2__SSE, n_gt_2) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 3; n < 10; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(16)
+          .nr(2)
+          .m(16)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .Test(xnn_f32_spmm_ukernel_16x2__sse);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_16X2__SSE, n_div_2) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 4; n <= 6; n += 2) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(16)
+          .nr(2)
+          .m(16)
+          .n(n)
+          .k(k)
+          .Test(xnn_f32_spmm_ukernel_16x2__sse);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_16X2__SSE, m_lt_16) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t m = 1; m < 16; m++) {
+      for (uint32_t n = 1; n < 10; n += 3) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(16)
+            .nr(2)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_ukernel_16x2__sse);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_16X2__SSE, m_div_16) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t m = 32; m <= 48; m += 16) {
+      for (uint32_t n = 1; n < 10; n += 3) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(16)
+            .nr(2)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_ukernel_16x2__sse);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_16X2__SSE, m_gt_16) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t m = 17; m < 32; m++) {
+      for (uint32_t n = 1; n < 10; n += 3) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(16)
+            .nr(2)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_ukernel_16x2__sse);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_16X2__SSE, qmin) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 1; n < 10; n += 3) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(16)
+          .nr(2)
+          .m(32)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .qmin(128)
+          .Test(xnn_f32_spmm_ukernel_16x2__sse);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_16X2__SSE, qmax) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 1; n < 10; n += 3) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(16)
+          .nr(2)
+          .m(32)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .qmax(128)
+          .Test(xnn_f32_spmm_ukernel_16x2__sse);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_16X2__SSE, half_sparse) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 1; n < 10; n += 3) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(16)
+          .nr(2)
+          .m(32)
+          .n(n)
+          .k(k)
+          .sparsity(0.5f)
+          .Test(xnn_f32_spmm_ukernel_16x2__sse);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_16X2__SSE, zero_weights) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 1; n < 10; n += 3) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(16)
+          .nr(2)
+          .m(32)
+          .n(n)
+          .k(k)
+          .sparsity(1.0f)
+          .Test(xnn_f32_spmm_ukernel_16x2__sse);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_SPMM_32X1__SSE, k_eq_1) {
+    TEST_REQUIRES_X86_SSE;
+    SpMMMicrokernelTester()
+      .mr(32)
+      .nr(1)
+      .m(32)
+      .n(1)
+      .k(1)
+      .sparsity(0.0f)
+      .Test(xnn_f32_spmm_ukernel_32x1__sse);
+  }
+
+  TEST(F32_SPMM_32X1__SSE, k_gt_1) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t k = 2; k < 10; k++) {
+      SpMMMicrokernelTester()
+        .mr(32)
+        .nr(1)
+        .m(32)
+        .n(1)
+        .k(k)
+        .sparsity(0.0f)
+        .Test(xnn_f32_spmm_ukernel_32x1__sse);
+    }
+  }
+
+  TEST(F32_SPMM_32X1__SSE, n_gt_1) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 2; n < 10; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(1)
+          .m(32)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .Test(xnn_f32_spmm_ukernel_32x1__sse);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_32X1__SSE, m_lt_32) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t m = 1; m < 32; m++) {
+      for (uint32_t n = 1; n < 10; n += 2) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(32)
+            .nr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_ukernel_32x1__sse);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_32X1__SSE, m_div_32) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t m = 64; m <= 96; m += 32) {
+      for (uint32_t n = 1; n < 10; n += 2) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(32)
+            .nr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_ukernel_32x1__sse);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_32X1__SSE, m_gt_32) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t m = 33; m < 64; m++) {
+      for (uint32_t n = 1; n < 10; n += 2) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(32)
+            .nr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_ukernel_32x1__sse);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_32X1__SSE, qmin) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(1)
+          .m(64)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .qmin(128)
+          .Test(xnn_f32_spmm_ukernel_32x1__sse);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_32X1__SSE, qmax) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(1)
+          .m(64)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .qmax(128)
+          .Test(xnn_f32_spmm_ukernel_32x1__sse);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_32X1__SSE, half_sparse) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(1)
+          .m(64)
+          .n(n)
+          .k(k)
+          .sparsity(0.5f)
+          .Test(xnn_f32_spmm_ukernel_32x1__sse);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_32X1__SSE, zero_weights) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(1)
+          .m(64)
+          .n(n)
+          .k(k)
+          .sparsity(1.0f)
+          .Test(xnn_f32_spmm_ukernel_32x1__sse);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_SPMM_8X1__FMA3, k_eq_1) {
+    TEST_REQUIRES_X86_FMA3;
+    SpMMMicrokernelTester()
+      .mr(8)
+      .nr(1)
+      .m(8)
+      .n(1)
+      .k(1)
+      .sparsity(0.0f)
+      .Test(xnn_f32_spmm_ukernel_8x1__fma3);
+  }
+
+  TEST(F32_SPMM_8X1__FMA3, k_gt_1) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 2; k < 10; k++) {
+      SpMMMicrokernelTester()
+        .mr(8)
+        .nr(1)
+        .m(8)
+        .n(1)
+        .k(k)
+        .sparsity(0.0f)
+        .Test(xnn_f32_spmm_ukernel_8x1__fma3);
+    }
+  }
+
+  TEST(F32_SPMM_8X1__FMA3, n_gt_1) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 2; n < 10; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(8)
+          .nr(1)
+          .m(8)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .Test(xnn_f32_spmm_ukernel_8x1__fma3);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_8X1__FMA3, m_lt_8) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t m = 1; m < 8; m++) {
+      for (uint32_t n = 1; n < 10; n += 2) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(8)
+            .nr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_ukernel_8x1__fma3);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_8X1__FMA3, m_div_8) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t m = 16; m <= 24; m += 8) {
+      for (uint32_t n = 1; n < 10; n += 2) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(8)
+            .nr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_ukernel_8x1__fma3);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_8X1__FMA3, m_gt_8) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t m = 9; m < 16; m++) {
+      for (uint32_t n = 1; n < 10; n += 2) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(8)
+            .nr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_ukernel_8x1__fma3);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_8X1__FMA3, qmin) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(8)
+          .nr(1)
+          .m(16)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .qmin(128)
+          .Test(xnn_f32_spmm_ukernel_8x1__fma3);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_8X1__FMA3, qmax) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(8)
+          .nr(1)
+          .m(16)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .qmax(128)
+          .Test(xnn_f32_spmm_ukernel_8x1__fma3);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_8X1__FMA3, half_sparse) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(8)
+          .nr(1)
+          .m(16)
+          .n(n)
+          .k(k)
+          .sparsity(0.5f)
+          .Test(xnn_f32_spmm_ukernel_8x1__fma3);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_8X1__FMA3, zero_weights) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(8)
+          .nr(1)
+          .m(16)
+          .n(n)
+          .k(k)
+          .sparsity(1.0f)
+          .Test(xnn_f32_spmm_ukernel_8x1__fma3);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_SPMM_16X1__FMA3, k_eq_1) {
+    TEST_REQUIRES_X86_FMA3;
+    SpMMMicrokernelTester()
+      .mr(16)
+      .nr(1)
+      .m(16)
+      .n(1)
+      .k(1)
+      .sparsity(0.0f)
+      .Test(xnn_f32_spmm_ukernel_16x1__fma3);
+  }
+
+  TEST(F32_SPMM_16X1__FMA3, k_gt_1) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 2; k < 10; k++) {
+      SpMMMicrokernelTester()
+        .mr(16)
+        .nr(1)
+        .m(16)
+        .n(1)
+        .k(k)
+        .sparsity(0.0f)
+        .Test(xnn_f32_spmm_ukernel_16x1__fma3);
+    }
+  }
+
+  TEST(F32_SPMM_16X1__FMA3, n_gt_1) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 2; n < 10; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(16)
+          .nr(1)
+          .m(16)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .Test(xnn_f32_spmm_ukernel_16x1__fma3);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_16X1__FMA3, m_lt_16) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t m = 1; m < 16; m++) {
+      for (uint32_t n = 1; n < 10; n += 2) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(16)
+            .nr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_ukernel_16x1__fma3);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_16X1__FMA3, m_div_16) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t m = 32; m <= 48; m += 16) {
+      for (uint32_t n = 1; n < 10; n += 2) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(16)
+            .nr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_ukernel_16x1__fma3);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_16X1__FMA3, m_gt_16) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t m = 17; m < 32; m++) {
+      for (uint32_t n = 1; n < 10; n += 2) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(16)
+            .nr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_ukernel_16x1__fma3);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_16X1__FMA3, qmin) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(16)
+          .nr(1)
+          .m(32)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .qmin(128)
+          .Test(xnn_f32_spmm_ukernel_16x1__fma3);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_16X1__FMA3, qmax) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(16)
+          .nr(1)
+          .m(32)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .qmax(128)
+          .Test(xnn_f32_spmm_ukernel_16x1__fma3);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_16X1__FMA3, half_sparse) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(16)
+          .nr(1)
+          .m(32)
+          .n(n)
+          .k(k)
+          .sparsity(0.5f)
+          .Test(xnn_f32_spmm_ukernel_16x1__fma3);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_16X1__FMA3, zero_weights) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(16)
+          .nr(1)
+          .m(32)
+          .n(n)
+          .k(k)
+          .sparsity(1.0f)
+          .Test(xnn_f32_spmm_ukernel_16x1__fma3);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_SPMM_16X2__FMA3, k_eq_1) {
+    TEST_REQUIRES_X86_FMA3;
+    SpMMMicrokernelTester()
+      .mr(16)
+      .nr(2)
+      .m(16)
+      .n(2)
+      .k(1)
+      .sparsity(0.0f)
+      .Test(xnn_f32_spmm_ukernel_16x2__fma3);
+  }
+
+  TEST(F32_SPMM_16X2__FMA3, k_eq_1_subtile) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n <= 2; n++) {
+      SpMMMicrokernelTester()
+        .mr(16)
+        .nr(2)
+        .m(16)
+        .n(n)
+        .k(1)
+        .sparsity(0.0f)
+        .Test(xnn_f32_spmm_ukernel_16x2__fma3);
+    }
+  }
+
+  TEST(F32_SPMM_16X2__FMA3, k_gt_1) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 2; k < 10; k++) {
+      SpMMMicrokernelTester()
+        .mr(16)
+        .nr(2)
+        .m(16)
+        .n(2)
+        .k(k)
+        .sparsity(0.0f)
+        .Test(xnn_f32_spmm_ukernel_16x2__fma3);
+    }
+  }
+
+  TEST(F32_SPMM_16X2__FMA3, k_gt_1_subtile) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 2; k < 10; k++) {
+      for (uint32_t n = 1; n <= 2; n++) {
+        SpMMMicrokernelTester()
+          .mr(16)
+          .nr(2)
+          .m(16)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .Test(xnn_f32_spmm_ukernel_16x2__fma3);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_16X2__FMA3, n_gt_2) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 3; n < 10; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(16)
+          .nr(2)
+          .m(16)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .Test(xnn_f32_spmm_ukernel_16x2__fma3);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_16X2__FMA3, n_div_2) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 4; n <= 6; n += 2) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(16)
+          .nr(2)
+          .m(16)
+          .n(n)
+          .k(k)
+          .Test(xnn_f32_spmm_ukernel_16x2__fma3);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_16X2__FMA3, m_lt_16) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t m = 1; m < 16; m++) {
+      for (uint32_t n = 1; n < 10; n += 3) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(16)
+            .nr(2)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_ukernel_16x2__fma3);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_16X2__FMA3, m_div_16) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t m = 32; m <= 48; m += 16) {
+      for (uint32_t n = 1; n < 10; n += 3) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(16)
+            .nr(2)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_ukernel_16x2__fma3);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_16X2__FMA3, m_gt_16) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t m = 17; m < 32; m++) {
+      for (uint32_t n = 1; n < 10; n += 3) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(16)
+            .nr(2)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_ukernel_16x2__fma3);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_16X2__FMA3, qmin) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n < 10; n += 3) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(16)
+          .nr(2)
+          .m(32)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .qmin(128)
+          .Test(xnn_f32_spmm_ukernel_16x2__fma3);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_16X2__FMA3, qmax) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n < 10; n += 3) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(16)
+          .nr(2)
+          .m(32)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .qmax(128)
+          .Test(xnn_f32_spmm_ukernel_16x2__fma3);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_16X2__FMA3, half_sparse) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n < 10; n += 3) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(16)
+          .nr(2)
+          .m(32)
+          .n(n)
+          .k(k)
+          .sparsity(0.5f)
+          .Test(xnn_f32_spmm_ukernel_16x2__fma3);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_16X2__FMA3, zero_weights) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n < 10; n += 3) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(16)
+          .nr(2)
+          .m(32)
+          .n(n)
+          .k(k)
+          .sparsity(1.0f)
+          .Test(xnn_f32_spmm_ukernel_16x2__fma3);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_SPMM_16X4__FMA3, k_eq_1) {
+    TEST_REQUIRES_X86_FMA3;
+    SpMMMicrokernelTester()
+      .mr(16)
+      .nr(4)
+      .m(16)
+      .n(4)
+      .k(1)
+      .sparsity(0.0f)
+      .Test(xnn_f32_spmm_ukernel_16x4__fma3);
+  }
+
+  TEST(F32_SPMM_16X4__FMA3, k_eq_1_subtile) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n <= 4; n++) {
+      SpMMMicrokernelTester()
+        .mr(16)
+        .nr(4)
+        .m(16)
+        .n(n)
+        .k(1)
+        .sparsity(0.0f)
+        .Test(xnn_f32_spmm_ukernel_16x4__fma3);
+    }
+  }
+
+  TEST(F32_SPMM_16X4__FMA3, k_gt_1) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 2; k < 10; k++) {
+      SpMMMicrokernelTester()
+        .mr(16)
+        .nr(4)
+        .m(16)
+        .n(4)
+        .k(k)
+        .sparsity(0.0f)
+        .Test(xnn_f32_spmm_ukernel_16x4__fma3);
+    }
+  }
+
+  TEST(F32_SPMM_16X4__FMA3, k_gt_1_subtile) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 2; k < 10; k++) {
+      for (uint32_t n = 1; n <= 4; n++) {
+        SpMMMicrokernelTester()
+          .mr(16)
+          .nr(4)
+          .m(16)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .Test(xnn_f32_spmm_ukernel_16x4__fma3);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_16X4__FMA3, n_gt_4) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 5; n < 10; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(16)
+          .nr(4)
+          .m(16)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .Test(xnn_f32_spmm_ukernel_16x4__fma3);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_16X4__FMA3, n_div_4) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 8; n <= 12; n += 4) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(16)
+          .nr(4)
+          .m(16)
+          .n(n)
+          .k(k)
+          .Test(xnn_f32_spmm_ukernel_16x4__fma3);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_16X4__FMA3, m_lt_16) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t m = 1; m < 16; m++) {
+      for (uint32_t n = 1; n < 20; n += 5) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(16)
+            .nr(4)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_ukernel_16x4__fma3);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_16X4__FMA3, m_div_16) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t m = 32; m <= 48; m += 16) {
+      for (uint32_t n = 1; n < 20; n += 5) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(16)
+            .nr(4)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_ukernel_16x4__fma3);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_16X4__FMA3, m_gt_16) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t m = 17; m < 32; m++) {
+      for (uint32_t n = 1; n < 20; n += 5) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(16)
+            .nr(4)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_ukernel_16x4__fma3);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_16X4__FMA3, qmin) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n < 20; n += 5) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(16)
+          .nr(4)
+          .m(32)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .qmin(128)
+          .Test(xnn_f32_spmm_ukernel_16x4__fma3);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_16X4__FMA3, qmax) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n < 20; n += 5) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(16)
+          .nr(4)
+          .m(32)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .qmax(128)
+          .Test(xnn_f32_spmm_ukernel_16x4__fma3);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_16X4__FMA3, half_sparse) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n < 20; n += 5) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(16)
+          .nr(4)
+          .m(32)
+          .n(n)
+          .k(k)
+          .sparsity(0.5f)
+          .Test(xnn_f32_spmm_ukernel_16x4__fma3);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_16X4__FMA3, zero_weights) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n < 20; n += 5) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(16)
+          .nr(4)
+          .m(32)
+          .n(n)
+          .k(k)
+          .sparsity(1.0f)
+          .Test(xnn_f32_spmm_ukernel_16x4__fma3);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_SPMM_32X1__FMA3, k_eq_1) {
+    TEST_REQUIRES_X86_FMA3;
+    SpMMMicrokernelTester()
+      .mr(32)
+      .nr(1)
+      .m(32)
+      .n(1)
+      .k(1)
+      .sparsity(0.0f)
+      .Test(xnn_f32_spmm_ukernel_32x1__fma3);
+  }
+
+  TEST(F32_SPMM_32X1__FMA3, k_gt_1) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 2; k < 10; k++) {
+      SpMMMicrokernelTester()
+        .mr(32)
+        .nr(1)
+        .m(32)
+        .n(1)
+        .k(k)
+        .sparsity(0.0f)
+        .Test(xnn_f32_spmm_ukernel_32x1__fma3);
+    }
+  }
+
+  TEST(F32_SPMM_32X1__FMA3, n_gt_1) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 2; n < 10; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(1)
+          .m(32)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .Test(xnn_f32_spmm_ukernel_32x1__fma3);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_32X1__FMA3, m_lt_32) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t m = 1; m < 32; m++) {
+      for (uint32_t n = 1; n < 10; n += 2) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(32)
+            .nr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_ukernel_32x1__fma3);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_32X1__FMA3, m_div_32) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t m = 64; m <= 96; m += 32) {
+      for (uint32_t n = 1; n < 10; n += 2) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(32)
+            .nr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_ukernel_32x1__fma3);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_32X1__FMA3, m_gt_32) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t m = 33; m < 64; m++) {
+      for (uint32_t n = 1; n < 10; n += 2) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(32)
+            .nr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_ukernel_32x1__fma3);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_32X1__FMA3, qmin) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(1)
+          .m(64)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .qmin(128)
+          .Test(xnn_f32_spmm_ukernel_32x1__fma3);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_32X1__FMA3, qmax) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(1)
+          .m(64)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .qmax(128)
+          .Test(xnn_f32_spmm_ukernel_32x1__fma3);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_32X1__FMA3, half_sparse) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(1)
+          .m(64)
+          .n(n)
+          .k(k)
+          .sparsity(0.5f)
+          .Test(xnn_f32_spmm_ukernel_32x1__fma3);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_32X1__FMA3, zero_weights) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(1)
+          .m(64)
+          .n(n)
+          .k(k)
+          .sparsity(1.0f)
+          .Test(xnn_f32_spmm_ukernel_32x1__fma3);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_SPMM_32X2__FMA3, k_eq_1) {
+    TEST_REQUIRES_X86_FMA3;
+    SpMMMicrokernelTester()
+      .mr(32)
+      .nr(2)
+      .m(32)
+      .n(2)
+      .k(1)
+      .sparsity(0.0f)
+      .Test(xnn_f32_spmm_ukernel_32x2__fma3);
+  }
+
+  TEST(F32_SPMM_32X2__FMA3, k_eq_1_subtile) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n <= 2; n++) {
+      SpMMMicrokernelTester()
+        .mr(32)
+        .nr(2)
+        .m(32)
+        .n(n)
+        .k(1)
+        .sparsity(0.0f)
+        .Test(xnn_f32_spmm_ukernel_32x2__fma3);
+    }
+  }
+
+  TEST(F32_SPMM_32X2__FMA3, k_gt_1) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 2; k < 10; k++) {
+      SpMMMicrokernelTester()
+        .mr(32)
+        .nr(2)
+        .m(32)
+        .n(2)
+        .k(k)
+        .sparsity(0.0f)
+        .Test(xnn_f32_spmm_ukernel_32x2__fma3);
+    }
+  }
+
+  TEST(F32_SPMM_32X2__FMA3, k_gt_1_subtile) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 2; k < 10; k++) {
+      for (uint32_t n = 1; n <= 2; n++) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(2)
+          .m(32)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .Test(xnn_f32_spmm_ukernel_32x2__fma3);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_32X2__FMA3, n_gt_2) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 3; n < 10; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(2)
+          .m(32)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .Test(xnn_f32_spmm_ukernel_32x2__fma3);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_32X2__FMA3, n_div_2) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 4; n <= 6; n += 2) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(2)
+          .m(32)
+          .n(n)
+          .k(k)
+          .Test(xnn_f32_spmm_ukernel_32x2__fma3);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_32X2__FMA3, m_lt_32) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t m = 1; m < 32; m++) {
+      for (uint32_t n = 1; n < 10; n += 3) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(32)
+            .nr(2)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_ukernel_32x2__fma3);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_32X2__FMA3, m_div_32) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t m = 64; m <= 96; m += 32) {
+      for (uint32_t n = 1; n < 10; n += 3) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(32)
+            .nr(2)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_ukernel_32x2__fma3);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_32X2__FMA3, m_gt_32) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t m = 33; m < 64; m++) {
+      for (uint32_t n = 1; n < 10; n += 3) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(32)
+            .nr(2)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_ukernel_32x2__fma3);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_32X2__FMA3, qmin) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n < 10; n += 3) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(2)
+          .m(64)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .qmin(128)
+          .Test(xnn_f32_spmm_ukernel_32x2__fma3);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_32X2__FMA3, qmax) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n < 10; n += 3) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(2)
+          .m(64)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .qmax(128)
+          .Test(xnn_f32_spmm_ukernel_32x2__fma3);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_32X2__FMA3, half_sparse) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n < 10; n += 3) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(2)
+          .m(64)
+          .n(n)
+          .k(k)
+          .sparsity(0.5f)
+          .Test(xnn_f32_spmm_ukernel_32x2__fma3);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_32X2__FMA3, zero_weights) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n < 10; n += 3) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(2)
+          .m(64)
+          .n(n)
+          .k(k)
+          .sparsity(1.0f)
+          .Test(xnn_f32_spmm_ukernel_32x2__fma3);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_SPMM_16X1__AVX512F, k_eq_1) {
+    TEST_REQUIRES_X86_AVX512F;
+    SpMMMicrokernelTester()
+      .mr(16)
+      .nr(1)
+      .m(16)
+      .n(1)
+      .k(1)
+      .sparsity(0.0f)
+      .Test(xnn_f32_spmm_ukernel_16x1__avx512f);
+  }
+
+  TEST(F32_SPMM_16X1__AVX512F, k_gt_1) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t k = 2; k < 10; k++) {
+      SpMMMicrokernelTester()
+        .mr(16)
+        .nr(1)
+        .m(16)
+        .n(1)
+        .k(k)
+        .sparsity(0.0f)
+        .Test(xnn_f32_spmm_ukernel_16x1__avx512f);
+    }
+  }
+
+  TEST(F32_SPMM_16X1__AVX512F, n_gt_1) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 2; n < 10; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(16)
+          .nr(1)
+          .m(16)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .Test(xnn_f32_spmm_ukernel_16x1__avx512f);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_16X1__AVX512F, m_lt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t m = 1; m < 16; m++) {
+      for (uint32_t n = 1; n < 10; n += 2) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(16)
+            .nr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_ukernel_16x1__avx512f);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_16X1__AVX512F, m_div_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t m = 32; m <= 48; m += 16) {
+      for (uint32_t n = 1; n < 10; n += 2) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(16)
+            .nr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_ukernel_16x1__avx512f);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_16X1__AVX512F, m_gt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t m = 17; m < 32; m++) {
+      for (uint32_t n = 1; n < 10; n += 2) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(16)
+            .nr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_ukernel_16x1__avx512f);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_16X1__AVX512F, qmin) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(16)
+          .nr(1)
+          .m(32)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .qmin(128)
+          .Test(xnn_f32_spmm_ukernel_16x1__avx512f);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_16X1__AVX512F, qmax) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(16)
+          .nr(1)
+          .m(32)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .qmax(128)
+          .Test(xnn_f32_spmm_ukernel_16x1__avx512f);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_16X1__AVX512F, half_sparse) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(16)
+          .nr(1)
+          .m(32)
+          .n(n)
+          .k(k)
+          .sparsity(0.5f)
+          .Test(xnn_f32_spmm_ukernel_16x1__avx512f);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_16X1__AVX512F, zero_weights) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(16)
+          .nr(1)
+          .m(32)
+          .n(n)
+          .k(k)
+          .sparsity(1.0f)
+          .Test(xnn_f32_spmm_ukernel_16x1__avx512f);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_SPMM_32X1__AVX512F, k_eq_1) {
+    TEST_REQUIRES_X86_AVX512F;
+    SpMMMicrokernelTester()
+      .mr(32)
+      .nr(1)
+      .m(32)
+      .n(1)
+      .k(1)
+      .sparsity(0.0f)
+      .Test(xnn_f32_spmm_ukernel_32x1__avx512f);
+  }
+
+  TEST(F32_SPMM_32X1__AVX512F, k_gt_1) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t k = 2; k < 10; k++) {
+      SpMMMicrokernelTester()
+        .mr(32)
+        .nr(1)
+        .m(32)
+        .n(1)
+        .k(k)
+        .sparsity(0.0f)
+        .Test(xnn_f32_spmm_ukernel_32x1__avx512f);
+    }
+  }
+
+  TEST(F32_SPMM_32X1__AVX512F, n_gt_1) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 2; n < 10; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(1)
+          .m(32)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .Test(xnn_f32_spmm_ukernel_32x1__avx512f);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_32X1__AVX512F, m_lt_32) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t m = 1; m < 32; m++) {
+      for (uint32_t n = 1; n < 10; n += 2) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(32)
+            .nr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_ukernel_32x1__avx512f);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_32X1__AVX512F, m_div_32) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t m = 64; m <= 96; m += 32) {
+      for (uint32_t n = 1; n < 10; n += 2) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(32)
+            .nr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_ukernel_32x1__avx512f);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_32X1__AVX512F, m_gt_32) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t m = 33; m < 64; m++) {
+      for (uint32_t n = 1; n < 10; n += 2) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(32)
+            .nr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_ukernel_32x1__avx512f);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_32X1__AVX512F, qmin) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(1)
+          .m(64)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .qmin(128)
+          .Test(xnn_f32_spmm_ukernel_32x1__avx512f);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_32X1__AVX512F, qmax) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(1)
+          .m(64)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .qmax(128)
+          .Test(xnn_f32_spmm_ukernel_32x1__avx512f);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_32X1__AVX512F, half_sparse) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(1)
+          .m(64)
+          .n(n)
+          .k(k)
+          .sparsity(0.5f)
+          .Test(xnn_f32_spmm_ukernel_32x1__avx512f);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_32X1__AVX512F, zero_weights) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(1)
+          .m(64)
+          .n(n)
+          .k(k)
+          .sparsity(1.0f)
+          .Test(xnn_f32_spmm_ukernel_32x1__avx512f);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_SPMM_32X2__AVX512F, k_eq_1) {
+    TEST_REQUIRES_X86_AVX512F;
+    SpMMMicrokernelTester()
+      .mr(32)
+      .nr(2)
+      .m(32)
+      .n(2)
+      .k(1)
+      .sparsity(0.0f)
+      .Test(xnn_f32_spmm_ukernel_32x2__avx512f);
+  }
+
+  TEST(F32_SPMM_32X2__AVX512F, k_eq_1_subtile) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 1; n <= 2; n++) {
+      SpMMMicrokernelTester()
+        .mr(32)
+        .nr(2)
+        .m(32)
+        .n(n)
+        .k(1)
+        .sparsity(0.0f)
+        .Test(xnn_f32_spmm_ukernel_32x2__avx512f);
+    }
+  }
+
+  TEST(F32_SPMM_32X2__AVX512F, k_gt_1) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t k = 2; k < 10; k++) {
+      SpMMMicrokernelTester()
+        .mr(32)
+        .nr(2)
+        .m(32)
+        .n(2)
+        .k(k)
+        .sparsity(0.0f)
+        .Test(xnn_f32_spmm_ukernel_32x2__avx512f);
+    }
+  }
+
+  TEST(F32_SPMM_32X2__AVX512F, k_gt_1_subtile) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t k = 2; k < 10; k++) {
+      for (uint32_t n = 1; n <= 2; n++) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(2)
+          .m(32)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .Test(xnn_f32_spmm_ukernel_32x2__avx512f);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_32X2__AVX512F, n_gt_2) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 3; n < 10; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(2)
+          .m(32)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .Test(xnn_f32_spmm_ukernel_32x2__avx512f);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_32X2__AVX512F, n_div_2) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 4; n <= 6; n += 2) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(2)
+          .m(32)
+          .n(n)
+          .k(k)
+          .Test(xnn_f32_spmm_ukernel_32x2__avx512f);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_32X2__AVX512F, m_lt_32) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t m = 1; m < 32; m++) {
+      for (uint32_t n = 1; n < 10; n += 3) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(32)
+            .nr(2)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_ukernel_32x2__avx512f);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_32X2__AVX512F, m_div_32) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t m = 64; m <= 96; m += 32) {
+      for (uint32_t n = 1; n < 10; n += 3) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(32)
+            .nr(2)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_ukernel_32x2__avx512f);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_32X2__AVX512F, m_gt_32) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t m = 33; m < 64; m++) {
+      for (uint32_t n = 1; n < 10; n += 3) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(32)
+            .nr(2)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_ukernel_32x2__avx512f);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_32X2__AVX512F, qmin) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 1; n < 10; n += 3) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(2)
+          .m(64)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .qmin(128)
+          .Test(xnn_f32_spmm_ukernel_32x2__avx512f);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_32X2__AVX512F, qmax) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 1; n < 10; n += 3) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(2)
+          .m(64)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .qmax(128)
+          .Test(xnn_f32_spmm_ukernel_32x2__avx512f);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_32X2__AVX512F, half_sparse) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 1; n < 10; n += 3) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(2)
+          .m(64)
+          .n(n)
+          .k(k)
+          .sparsity(0.5f)
+          .Test(xnn_f32_spmm_ukernel_32x2__avx512f);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_32X2__AVX512F, zero_weights) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 1; n < 10; n += 3) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(2)
+          .m(64)
+          .n(n)
+          .k(k)
+          .sparsity(1.0f)
+          .Test(xnn_f32_spmm_ukernel_32x2__avx512f);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_SPMM_32X4__AVX512F, k_eq_1) {
+    TEST_REQUIRES_X86_AVX512F;
+    SpMMMicrokernelTester()
+      .mr(32)
+      .nr(4)
+      .m(32)
+      .n(4)
+      .k(1)
+      .sparsity(0.0f)
+      .Test(xnn_f32_spmm_ukernel_32x4__avx512f);
+  }
+
+  TEST(F32_SPMM_32X4__AVX512F, k_eq_1_subtile) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 1; n <= 4; n++) {
+      SpMMMicrokernelTester()
+        .mr(32)
+        .nr(4)
+        .m(32)
+        .n(n)
+        .k(1)
+        .sparsity(0.0f)
+        .Test(xnn_f32_spmm_ukernel_32x4__avx512f);
+    }
+  }
+
+  TEST(F32_SPMM_32X4__AVX512F, k_gt_1) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t k = 2; k < 10; k++) {
+      SpMMMicrokernelTester()
+        .mr(32)
+        .nr(4)
+        .m(32)
+        .n(4)
+        .k(k)
+        .sparsity(0.0f)
+        .Test(xnn_f32_spmm_ukernel_32x4__avx512f);
+    }
+  }
+
+  TEST(F32_SPMM_32X4__AVX512F, k_gt_1_subtile) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t k = 2; k < 10; k++) {
+      for (uint32_t n = 1; n <= 4; n++) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(4)
+          .m(32)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .Test(xnn_f32_spmm_ukernel_32x4__avx512f);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_32X4__AVX512F, n_gt_4) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 5; n < 10; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(4)
+          .m(32)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .Test(xnn_f32_spmm_ukernel_32x4__avx512f);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_32X4__AVX512F, n_div_4) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 8; n <= 12; n += 4) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(4)
+          .m(32)
+          .n(n)
+          .k(k)
+          .Test(xnn_f32_spmm_ukernel_32x4__avx512f);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_32X4__AVX512F, m_lt_32) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t m = 1; m < 32; m++) {
+      for (uint32_t n = 1; n < 20; n += 5) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(32)
+            .nr(4)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_ukernel_32x4__avx512f);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_32X4__AVX512F, m_div_32) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t m = 64; m <= 96; m += 32) {
+      for (uint32_t n = 1; n < 20; n += 5) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(32)
+            .nr(4)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_ukernel_32x4__avx512f);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_32X4__AVX512F, m_gt_32) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t m = 33; m < 64; m++) {
+      for (uint32_t n = 1; n < 20; n += 5) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(32)
+            .nr(4)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_ukernel_32x4__avx512f);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_32X4__AVX512F, qmin) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 1; n < 20; n += 5) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(4)
+          .m(64)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .qmin(128)
+          .Test(xnn_f32_spmm_ukernel_32x4__avx512f);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_32X4__AVX512F, qmax) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 1; n < 20; n += 5) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(4)
+          .m(64)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .qmax(128)
+          .Test(xnn_f32_spmm_ukernel_32x4__avx512f);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_32X4__AVX512F, half_sparse) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 1; n < 20; n += 5) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(4)
+          .m(64)
+          .n(n)
+          .k(k)
+          .sparsity(0.5f)
+          .Test(xnn_f32_spmm_ukernel_32x4__avx512f);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_32X4__AVX512F, zero_weights) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 1; n < 20; n += 5) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(4)
+          .m(64)
+          .n(n)
+          .k(k)
+          .sparsity(1.0f)
+          .Test(xnn_f32_spmm_ukernel_32x4__avx512f);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
 TEST(F32_SPMM_1X1__SCALAR, k_eq_1) {
   SpMMMicrokernelTester()
     .mr(1)
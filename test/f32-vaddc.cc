@@ -0,0 +1,209 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+//
+// Auto-generated file. Do not edit!
+//   Specification: test/f32-vaddc.yaml
+//   Generator: tools/generate-vbinary-test.py
+
+
+#include <gtest/gtest.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/isa-checks.h>
+
+#include <xnnpack/vbinary.h>
+#include "vbinaryc-microkernel-tester.h"
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_VADDC__SSE_X8, n_eq_8) {
+    TEST_REQUIRES_X86_SSE;
+    VBinOpCMicrokernelTester()
+      .n(8)
+      .Test(xnn_f32_vaddc_ukernel__sse_x8, VBinOpCMicrokernelTester::OpType::AddC);
+  }
+
+  TEST(F32_VADDC__SSE_X8, n_div_8) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t n = 16; n < 80; n += 8) {
+      VBinOpCMicrokernelTester()
+        .n(n)
+        .Test(xnn_f32_vaddc_ukernel__sse_x8, VBinOpCMicrokernelTester::OpType::AddC);
+    }
+  }
+
+  TEST(F32_VADDC__SSE_X8, n_lt_8) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t n = 1; n < 8; n++) {
+      VBinOpCMicrokernelTester()
+        .n(n)
+        .Test(xnn_f32_vaddc_ukernel__sse_x8, VBinOpCMicrokernelTester::OpType::AddC);
+    }
+  }
+
+  TEST(F32_VADDC__SSE_X8, n_gt_8) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t n = 9; n < 16; n++) {
+      VBinOpCMicrokernelTester()
+        .n(n)
+        .Test(xnn_f32_vaddc_ukernel__sse_x8, VBinOpCMicrokernelTester::OpType::AddC);
+    }
+  }
+
+  TEST(F32_VADDC__SSE_X8, inplace) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t n = 1; n <= 40; n += 7) {
+      VBinOpCMicrokernelTester()
+        .n(n)
+        .inplace(true)
+        .Test(xnn_f32_vaddc_ukernel__sse_x8, VBinOpCMicrokernelTester::OpType::AddC);
+    }
+  }
+
+  TEST(F32_VADDC__SSE_X8, qmin) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t n = 1; n <= 40; n += 7) {
+      VBinOpCMicrokernelTester()
+        .n(n)
+        .qmin(128)
+        .Test(xnn_f32_vaddc_ukernel__sse_x8, VBinOpCMicrokernelTester::OpType::AddC);
+    }
+  }
+
+  TEST(F32_VADDC__SSE_X8, qmax) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t n = 1; n <= 40; n += 7) {
+      VBinOpCMicrokernelTester()
+        .n(n)
+        .qmax(128)
+        .Test(xnn_f32_vaddc_ukernel__sse_x8, VBinOpCMicrokernelTester::OpType::AddC);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if !XNN_ARCH_ASMJS && !XNN_ARCH_WASM
+  TEST(F32_VADDC__PSIMD_X8, n_eq_8) {
+    TEST_REQUIRES_PSIMD;
+    VBinOpCMicrokernelTester()
+      .n(8)
+      .Test(xnn_f32_vaddc_ukernel__psimd_x8, VBinOpCMicrokernelTester::OpType::AddC, VBinOpCMicrokernelTester::Variant::Scalar);
+  }
+
+  TEST(F32_VADDC__PSIMD_X8, n_div_8) {
+    TEST_REQUIRES_PSIMD;
+    for (size_t n = 16; n < 80; n += 8) {
+      VBinOpCMicrokernelTester()
+        .n(n)
+        .Test(xnn_f32_vaddc_ukernel__psimd_x8, VBinOpCMicrokernelTester::OpType::AddC, VBinOpCMicrokernelTester::Variant::Scalar);
+    }
+  }
+
+  TEST(F32_VADDC__PSIMD_X8, n_lt_8) {
+    TEST_REQUIRES_PSIMD;
+    for (size_t n = 1; n < 8; n++) {
+      VBinOpCMicrokernelTester()
+        .n(n)
+        .Test(xnn_f32_vaddc_ukernel__psimd_x8, VBinOpCMicrokernelTester::OpType::AddC, VBinOpCMicrokernelTester::Variant::Scalar);
+    }
+  }
+
+  TEST(F32_VADDC__PSIMD_X8, n_gt_8) {
+    TEST_REQUIRES_PSIMD;
+    for (size_t n = 9; n < 16; n++) {
+      VBinOpCMicrokernelTester()
+        .n(n)
+        .Test(xnn_f32_vaddc_ukernel__psimd_x8, VBinOpCMicrokernelTester::OpType::AddC, VBinOpCMicrokernelTester::Variant::Scalar);
+    }
+  }
+
+  TEST(F32_VADDC__PSIMD_X8, inplace) {
+    TEST_REQUIRES_PSIMD;
+    for (size_t n = 1; n <= 40; n += 7) {
+      VBinOpCMicrokernelTester()
+        .n(n)
+        .inplace(true)
+        .Test(xnn_f32_vaddc_ukernel__psimd_x8, VBinOpCMicrokernelTester::OpType::AddC, VBinOpCMicrokernelTester::Variant::Scalar);
+    }
+  }
+
+  TEST(F32_VADDC__PSIMD_X8, qmin) {
+    TEST_REQUIRES_PSIMD;
+    for (size_t n = 1; n <= 40; n += 7) {
+      VBinOpCMicrokernelTester()
+        .n(n)
+        .qmin(128)
+        .Test(xnn_f32_vaddc_ukernel__psimd_x8, VBinOpCMicrokernelTester::OpType::AddC, VBinOpCMicrokernelTester::Variant::Scalar);
+    }
+  }
+
+  TEST(F32_VADDC__PSIMD_X8, qmax) {
+    TEST_REQUIRES_PSIMD;
+    for (size_t n = 1; n <= 40; n += 7) {
+      VBinOpCMicrokernelTester()
+        .n(n)
+        .qmax(128)
+        .Test(xnn_f32_vaddc_ukernel__psimd_x8, VBinOpCMicrokernelTester::OpType::AddC, VBinOpCMicrokernelTester::Variant::Scalar);
+    }
+  }
+#endif  // !XNN_ARCH_ASMJS && !XNN_ARCH_WASM
+
+
+TEST(F32_VADDC__SCALAR_X2, n_eq_2) {
+  VBinOpCMicrokernelTester()
+    .n(2)
+    .Test(xnn_f32_vaddc_ukernel__scalar_x2, VBinOpCMicrokernelTester::OpType::AddC, VBinOpCMicrokernelTester::Variant::Scalar);
+}
+
+TEST(F32_VADDC__SCALAR_X2, n_div_2) {
+  for (size_t n = 4; n < 20; n += 2) {
+    VBinOpCMicrokernelTester()
+      .n(n)
+      .Test(xnn_f32_vaddc_ukernel__scalar_x2, VBinOpCMicrokernelTester::OpType::AddC, VBinOpCMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F32_VADDC__SCALAR_X2, n_lt_2) {
+  for (size_t n = 1; n < 2; n++) {
+    VBinOpCMicrokernelTester()
+      .n(n)
+      .Test(xnn_f32_vaddc_ukernel__scalar_x2, VBinOpCMicrokernelTester::OpType::AddC, VBinOpCMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F32_VADDC__SCALAR_X2, n_gt_2) {
+  for (size_t n = 3; n < 4; n++) {
+    VBinOpCMicrokernelTester()
+      .n(n)
+      .Test(xnn_f32_vaddc_ukernel__scalar_x2, VBinOpCMicrokernelTester::OpType::AddC, VBinOpCMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F32_VADDC__SCALAR_X2, inplace) {
+  for (size_t n = 1; n <= 10; n += 1) {
+    VBinOpCMicrokernelTester()
+      .n(n)
+      .inplace(true)
+      .Test(xnn_f32_vaddc_ukernel__scalar_x2, VBinOpCMicrokernelTester::OpType::AddC, VBinOpCMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F32_VADDC__SCALAR_X2, qmin) {
+  for (size_t n = 1; n <= 10; n += 1) {
+    VBinOpCMicrokernelTester()
+      .n(n)
+      .qmin(128)
+      .Test(xnn_f32_vaddc_ukernel__scalar_x2, VBinOpCMicrokernelTester::OpType::AddC, VBinOpCMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F32_VADDC__SCALAR_X2, qmax) {
+  for (size_t n = 1; n <= 10; n += 1) {
+    VBinOpCMicrokernelTester()
+      .n(n)
+      .qmax(128)
+      .Test(xnn_f32_vaddc_ukernel__scalar_x2, VBinOpCMicrokernelTester::OpType::AddC, VBinOpCMicrokernelTester::Variant::Scalar);
+  }
+}
\ No newline at end of file
@@ -0,0 +1,212 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+//
+// Auto-generated file. Do not edit!
+//   Specification: test/f32-vmin.yaml
+//   Generator: tools/generate-vbinary-test.py
+
+
+#include <gtest/gtest.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/isa-checks.h>
+
+#include <xnnpack/vbinary.h>
+#include "vbinary-microkernel-tester.h"
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_VMIN__SSE_X8, n_eq_8) {
+    TEST_REQUIRES_X86_SSE;
+    VBinOpMicrokernelTester()
+      .n(8)
+      .Test(xnn_f32_vmin_ukernel__sse_x8, VBinOpMicrokernelTester::OpType::Min);
+  }
+
+  TEST(F32_VMIN__SSE_X8, n_div_8) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t n = 16; n < 80; n += 8) {
+      VBinOpMicrokernelTester()
+        .n(n)
+        .Test(xnn_f32_vmin_ukernel__sse_x8, VBinOpMicrokernelTester::OpType::Min);
+    }
+  }
+
+  TEST(F32_VMIN__SSE_X8, n_lt_8) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t n = 1; n < 8; n++) {
+      VBinOpMicrokernelTester()
+        .n(n)
+        .Test(xnn_f32_vmin_ukernel__sse_x8, VBinOpMicrokernelTester::OpType::Min);
+    }
+  }
+
+  TEST(F32_VMIN__SSE_X8, n_gt_8) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t n = 9; n < 16; n++) {
+      VBinOpMicrokernelTester()
+        .n(n)
+        .Test(xnn_f32_vmin_ukernel__sse_x8, VBinOpMicrokernelTester::OpType::Min);
+    }
+  }
+
+  TEST(F32_VMIN__SSE_X8, inplace_a) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t n = 1; n <= 40; n += 7) {
+      VBinOpMicrokernelTester()
+        .n(n)
+        .inplace_a(true)
+        .Test(xnn_f32_vmin_ukernel__sse_x8, VBinOpMicrokernelTester::OpType::Min);
+    }
+  }
+
+  TEST(F32_VMIN__SSE_X8, inplace_b) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t n = 1; n <= 40; n += 7) {
+      VBinOpMicrokernelTester()
+        .n(n)
+        .inplace_b(true)
+        .Test(xnn_f32_vmin_ukernel__sse_x8, VBinOpMicrokernelTester::OpType::Min);
+    }
+  }
+
+  TEST(F32_VMIN__SSE_X8, inplace_a_and_b) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t n = 1; n <= 40; n += 7) {
+      VBinOpMicrokernelTester()
+        .n(n)
+        .inplace_a(true)
+        .inplace_b(true)
+        .Test(xnn_f32_vmin_ukernel__sse_x8, VBinOpMicrokernelTester::OpType::Min);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if !XNN_ARCH_ASMJS && !XNN_ARCH_WASM
+  TEST(F32_VMIN__PSIMD_X8, n_eq_8) {
+    TEST_REQUIRES_PSIMD;
+    VBinOpMicrokernelTester()
+      .n(8)
+      .Test(xnn_f32_vmin_ukernel__psimd_x8, VBinOpMicrokernelTester::OpType::Min, VBinOpMicrokernelTester::Variant::Scalar);
+  }
+
+  TEST(F32_VMIN__PSIMD_X8, n_div_8) {
+    TEST_REQUIRES_PSIMD;
+    for (size_t n = 16; n < 80; n += 8) {
+      VBinOpMicrokernelTester()
+        .n(n)
+        .Test(xnn_f32_vmin_ukernel__psimd_x8, VBinOpMicrokernelTester::OpType::Min, VBinOpMicrokernelTester::Variant::Scalar);
+    }
+  }
+
+  TEST(F32_VMIN__PSIMD_X8, n_lt_8) {
+    TEST_REQUIRES_PSIMD;
+    for (size_t n = 1; n < 8; n++) {
+      VBinOpMicrokernelTester()
+        .n(n)
+        .Test(xnn_f32_vmin_ukernel__psimd_x8, VBinOpMicrokernelTester::OpType::Min, VBinOpMicrokernelTester::Variant::Scalar);
+    }
+  }
+
+  TEST(F32_VMIN__PSIMD_X8, n_gt_8) {
+    TEST_REQUIRES_PSIMD;
+    for (size_t n = 9; n < 16; n++) {
+      VBinOpMicrokernelTester()
+        .n(n)
+        .Test(xnn_f32_vmin_ukernel__psimd_x8, VBinOpMicrokernelTester::OpType::Min, VBinOpMicrokernelTester::Variant::Scalar);
+    }
+  }
+
+  TEST(F32_VMIN__PSIMD_X8, inplace_a) {
+    TEST_REQUIRES_PSIMD;
+    for (size_t n = 1; n <= 40; n += 7) {
+      VBinOpMicrokernelTester()
+        .n(n)
+        .inplace_a(true)
+        .Test(xnn_f32_vmin_ukernel__psimd_x8, VBinOpMicrokernelTester::OpType::Min, VBinOpMicrokernelTester::Variant::Scalar);
+    }
+  }
+
+  TEST(F32_VMIN__PSIMD_X8, inplace_b) {
+    TEST_REQUIRES_PSIMD;
+    for (size_t n = 1; n <= 40; n += 7) {
+      VBinOpMicrokernelTester()
+        .n(n)
+        .inplace_b(true)
+        .Test(xnn_f32_vmin_ukernel__psimd_x8, VBinOpMicrokernelTester::OpType::Min, VBinOpMicrokernelTester::Variant::Scalar);
+    }
+  }
+
+  TEST(F32_VMIN__PSIMD_X8, inplace_a_and_b) {
+    TEST_REQUIRES_PSIMD;
+    for (size_t n = 1; n <= 40; n += 7) {
+      VBinOpMicrokernelTester()
+        .n(n)
+        .inplace_a(true)
+        .inplace_b(true)
+        .Test(xnn_f32_vmin_ukernel__psimd_x8, VBinOpMicrokernelTester::OpType::Min, VBinOpMicrokernelTester::Variant::Scalar);
+    }
+  }
+#endif  // !XNN_ARCH_ASMJS && !XNN_ARCH_WASM
+
+
+TEST(F32_VMIN__SCALAR_X2, n_eq_2) {
+  VBinOpMicrokernelTester()
+    .n(2)
+    .Test(xnn_f32_vmin_ukernel__scalar_x2, VBinOpMicrokernelTester::OpType::Min, VBinOpMicrokernelTester::Variant::Scalar);
+}
+
+TEST(F32_VMIN__SCALAR_X2, n_div_2) {
+  for (size_t n = 4; n < 20; n += 2) {
+    VBinOpMicrokernelTester()
+      .n(n)
+      .Test(xnn_f32_vmin_ukernel__scalar_x2, VBinOpMicrokernelTester::OpType::Min, VBinOpMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F32_VMIN__SCALAR_X2, n_lt_2) {
+  for (size_t n = 1; n < 2; n++) {
+    VBinOpMicrokernelTester()
+      .n(n)
+      .Test(xnn_f32_vmin_ukernel__scalar_x2, VBinOpMicrokernelTester::OpType::Min, VBinOpMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F32_VMIN__SCALAR_X2, n_gt_2) {
+  for (size_t n = 3; n < 4; n++) {
+    VBinOpMicrokernelTester()
+      .n(n)
+      .Test(xnn_f32_vmin_ukernel__scalar_x2, VBinOpMicrokernelTester::OpType::Min, VBinOpMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F32_VMIN__SCALAR_X2, inplace_a) {
+  for (size_t n = 1; n <= 10; n += 1) {
+    VBinOpMicrokernelTester()
+      .n(n)
+      .inplace_a(true)
+      .Test(xnn_f32_vmin_ukernel__scalar_x2, VBinOpMicrokernelTester::OpType::Min, VBinOpMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F32_VMIN__SCALAR_X2, inplace_b) {
+  for (size_t n = 1; n <= 10; n += 1) {
+    VBinOpMicrokernelTester()
+      .n(n)
+      .inplace_b(true)
+      .Test(xnn_f32_vmin_ukernel__scalar_x2, VBinOpMicrokernelTester::OpType::Min, VBinOpMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F32_VMIN__SCALAR_X2, inplace_a_and_b) {
+  for (size_t n = 1; n <= 10; n += 1) {
+    VBinOpMicrokernelTester()
+      .n(n)
+      .inplace_a(true)
+      .inplace_b(true)
+      .Test(xnn_f32_vmin_ukernel__scalar_x2, VBinOpMicrokernelTester::OpType::Min, VBinOpMicrokernelTester::Variant::Scalar);
+  }
+}
@@ -0,0 +1,239 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <gtest/gtest.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/isa-checks.h>
+
+#include <xnnpack/vquantize.h>
+#include "vquantize-microkernel-tester.h"
+
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  TEST(F32_VQUANTIZE__NEON, n_eq_16) {
+    TEST_REQUIRES_ARM_NEON;
+    VQuantizeMicrokernelTester()
+      .n(16)
+      .Test(xnn_f32_vquantize_ukernel__neon);
+  }
+
+  TEST(F32_VQUANTIZE__NEON, n_div_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 32; n < 160; n += 16) {
+      VQuantizeMicrokernelTester()
+        .n(n)
+        .Test(xnn_f32_vquantize_ukernel__neon);
+    }
+  }
+
+  TEST(F32_VQUANTIZE__NEON, n_lt_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 1; n < 16; n++) {
+      VQuantizeMicrokernelTester()
+        .n(n)
+        .Test(xnn_f32_vquantize_ukernel__neon);
+    }
+  }
+
+  TEST(F32_VQUANTIZE__NEON, n_gt_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 17; n < 32; n++) {
+      VQuantizeMicrokernelTester()
+        .n(n)
+        .Test(xnn_f32_vquantize_ukernel__neon);
+    }
+  }
+
+  TEST(F32_VQUANTIZE__NEON, zero_point) {
+    TEST_REQUIRES_ARM_NEON;
+    for (uint32_t zero_point = 0; zero_point <= 255; zero_point += 51) {
+      for (size_t n = 1; n < 80; n += 15) {
+        VQuantizeMicrokernelTester()
+          .n(n)
+          .zero_point(uint8_t(zero_point))
+          .Test(xnn_f32_vquantize_ukernel__neon);
+      }
+    }
+  }
+
+  TEST(F32_VQUANTIZE__NEON, scale) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 1; n < 80; n += 15) {
+      VQuantizeMicrokernelTester()
+        .n(n)
+        .scale(1.5f)
+        .Test(xnn_f32_vquantize_ukernel__neon);
+    }
+  }
+
+  TEST(F32_VQUANTIZE__NEON, qmin) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 1; n < 80; n += 15) {
+      VQuantizeMicrokernelTester()
+        .n(n)
+        .qmin(128)
+        .Test(xnn_f32_vquantize_ukernel__neon);
+    }
+  }
+
+  TEST(F32_VQUANTIZE__NEON, qmax) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 1; n < 80; n += 15) {
+      VQuantizeMicrokernelTester()
+        .n(n)
+        .qmax(128)
+        .Test(xnn_f32_vquantize_ukernel__neon);
+    }
+  }
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_VQUANTIZE__SSE2, n_eq_16) {
+    TEST_REQUIRES_X86_SSE2;
+    VQuantizeMicrokernelTester()
+      .n(16)
+      .Test(xnn_f32_vquantize_ukernel__sse2);
+  }
+
+  TEST(F32_VQUANTIZE__SSE2, n_div_16) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t n = 32; n < 160; n += 16) {
+      VQuantizeMicrokernelTester()
+        .n(n)
+        .Test(xnn_f32_vquantize_ukernel__sse2);
+    }
+  }
+
+  TEST(F32_VQUANTIZE__SSE2, n_lt_16) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t n = 1; n < 16; n++) {
+      VQuantizeMicrokernelTester()
+        .n(n)
+        .Test(xnn_f32_vquantize_ukernel__sse2);
+    }
+  }
+
+  TEST(F32_VQUANTIZE__SSE2, n_gt_16) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t n = 17; n < 32; n++) {
+      VQuantizeMicrokernelTester()
+        .n(n)
+        .Test(xnn_f32_vquantize_ukernel__sse2);
+    }
+  }
+
+  TEST(F32_VQUANTIZE__SSE2, zero_point) {
+    TEST_REQUIRES_X86_SSE2;
+    for (uint32_t zero_point = 0; zero_point <= 255; zero_point += 51) {
+      for (size_t n = 1; n < 80; n += 15) {
+        VQuantizeMicrokernelTester()
+          .n(n)
+          .zero_point(uint8_t(zero_point))
+          .Test(xnn_f32_vquantize_ukernel__sse2);
+      }
+    }
+  }
+
+  TEST(F32_VQUANTIZE__SSE2, scale) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t n = 1; n < 80; n += 15) {
+      VQuantizeMicrokernelTester()
+        .n(n)
+        .scale(1.5f)
+        .Test(xnn_f32_vquantize_ukernel__sse2);
+    }
+  }
+
+  TEST(F32_VQUANTIZE__SSE2, qmin) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t n = 1; n < 80; n += 15) {
+      VQuantizeMicrokernelTester()
+        .n(n)
+        .qmin(128)
+        .Test(xnn_f32_vquantize_ukernel__sse2);
+    }
+  }
+
+  TEST(F32_VQUANTIZE__SSE2, qmax) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t n = 1; n < 80; n += 15) {
+      VQuantizeMicrokernelTester()
+        .n(n)
+        .qmax(128)
+        .Test(xnn_f32_vquantize_ukernel__sse2);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+TEST(F32_VQUANTIZE__SCALAR, n_eq_4) {
+  VQuantizeMicrokernelTester()
+    .n(4)
+    .Test(xnn_f32_vquantize_ukernel__scalar, VQuantizeMicrokernelTester::Variant::Scalar);
+}
+
+TEST(F32_VQUANTIZE__SCALAR, n_div_4) {
+  for (size_t n = 8; n < 40; n += 4) {
+    VQuantizeMicrokernelTester()
+      .n(n)
+      .Test(xnn_f32_vquantize_ukernel__scalar, VQuantizeMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F32_VQUANTIZE__SCALAR, n_lt_4) {
+  for (size_t n = 1; n < 4; n++) {
+    VQuantizeMicrokernelTester()
+      .n(n)
+      .Test(xnn_f32_vquantize_ukernel__scalar, VQuantizeMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F32_VQUANTIZE__SCALAR, n_gt_4) {
+  for (size_t n = 5; n < 8; n++) {
+    VQuantizeMicrokernelTester()
+      .n(n)
+      .Test(xnn_f32_vquantize_ukernel__scalar, VQuantizeMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F32_VQUANTIZE__SCALAR, zero_point) {
+  for (uint32_t zero_point = 0; zero_point <= 255; zero_point += 51) {
+    for (size_t n = 1; n < 20; n += 3) {
+      VQuantizeMicrokernelTester()
+        .n(n)
+        .zero_point(uint8_t(zero_point))
+        .Test(xnn_f32_vquantize_ukernel__scalar, VQuantizeMicrokernelTester::Variant::Scalar);
+    }
+  }
+}
+
+TEST(F32_VQUANTIZE__SCALAR, scale) {
+  for (size_t n = 1; n < 20; n += 3) {
+    VQuantizeMicrokernelTester()
+      .n(n)
+      .scale(1.5f)
+      .Test(xnn_f32_vquantize_ukernel__scalar, VQuantizeMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F32_VQUANTIZE__SCALAR, qmin) {
+  for (size_t n = 1; n < 20; n += 3) {
+    VQuantizeMicrokernelTester()
+      .n(n)
+      .qmin(128)
+      .Test(xnn_f32_vquantize_ukernel__scalar, VQuantizeMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F32_VQUANTIZE__SCALAR, qmax) {
+  for (size_t n = 1; n < 20; n += 3) {
+    VQuantizeMicrokernelTester()
+      .n(n)
+      .qmax(128)
+      .Test(xnn_f32_vquantize_ukernel__scalar, VQuantizeMicrokernelTester::Variant::Scalar);
+  }
+}
@@ -0,0 +1,358 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <gtest/gtest.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/isa-checks.h>
+
+#include <xnnpack/winograd.h>
+#include "winograd-microkernel-tester.h"
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_WINOGRAD_INPUT_6X6__SSE, channels_eq_4) {
+    TEST_REQUIRES_X86_SSE;
+    WinogradMicrokernelTester()
+      .channels(4)
+      .Test(xnn_f32_winograd_input_ukernel_6x6__sse);
+  }
+
+  TEST(F32_WINOGRAD_INPUT_6X6__SSE, channels_lt_4) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 1; channels < 4; channels++) {
+      WinogradMicrokernelTester()
+        .channels(channels)
+        .Test(xnn_f32_winograd_input_ukernel_6x6__sse);
+    }
+  }
+
+  TEST(F32_WINOGRAD_INPUT_6X6__SSE, channels_gt_4) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 5; channels < 40; channels += 3) {
+      WinogradMicrokernelTester()
+        .channels(channels)
+        .Test(xnn_f32_winograd_input_ukernel_6x6__sse);
+    }
+  }
+
+  TEST(F32_WINOGRAD_INPUT_6X6__SSE, input_stride) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 1; channels < 20; channels += 3) {
+      WinogradMicrokernelTester()
+        .channels(channels)
+        .input_stride(23)
+        .Test(xnn_f32_winograd_input_ukernel_6x6__sse);
+    }
+  }
+
+  TEST(F32_WINOGRAD_INPUT_6X6__SSE, output_stride) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 1; channels < 20; channels += 3) {
+      WinogradMicrokernelTester()
+        .channels(channels)
+        .output_stride(23)
+        .Test(xnn_f32_winograd_input_ukernel_6x6__sse);
+    }
+  }
+
+  TEST(F32_WINOGRAD_OUTPUT_4X4__SSE, channels_eq_4) {
+    TEST_REQUIRES_X86_SSE;
+    WinogradMicrokernelTester()
+      .channels(4)
+      .Test(xnn_f32_winograd_output_ukernel_4x4__sse);
+  }
+
+  TEST(F32_WINOGRAD_OUTPUT_4X4__SSE, channels_lt_4) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 1; channels < 4; channels++) {
+      WinogradMicrokernelTester()
+        .channels(channels)
+        .Test(xnn_f32_winograd_output_ukernel_4x4__sse);
+    }
+  }
+
+  TEST(F32_WINOGRAD_OUTPUT_4X4__SSE, channels_gt_4) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 5; channels < 40; channels += 3) {
+      WinogradMicrokernelTester()
+        .channels(channels)
+        .Test(xnn_f32_winograd_output_ukernel_4x4__sse);
+    }
+  }
+
+  TEST(F32_WINOGRAD_OUTPUT_4X4__SSE, subtile) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t rows = 1; rows <= 4; rows++) {
+      for (size_t columns = 1; columns <= 4; columns++) {
+        for (size_t channels = 1; channels < 20; channels += 3) {
+          WinogradMicrokernelTester()
+            .rows(rows)
+            .columns(columns)
+            .channels(channels)
+            .iterations(1)
+            .Test(xnn_f32_winograd_output_ukernel_4x4__sse);
+        }
+      }
+    }
+  }
+
+  TEST(F32_WINOGRAD_OUTPUT_4X4__SSE, strides) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 1; channels < 20; channels += 3) {
+      WinogradMicrokernelTester()
+        .channels(channels)
+        .input_stride(23)
+        .output_stride(29)
+        .Test(xnn_f32_winograd_output_ukernel_4x4__sse);
+    }
+  }
+
+  TEST(F32_WINOGRAD_OUTPUT_4X4__SSE, qmin) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 1; channels < 20; channels += 3) {
+      WinogradMicrokernelTester()
+        .channels(channels)
+        .qmin(128)
+        .Test(xnn_f32_winograd_output_ukernel_4x4__sse);
+    }
+  }
+
+  TEST(F32_WINOGRAD_OUTPUT_4X4__SSE, qmax) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 1; channels < 20; channels += 3) {
+      WinogradMicrokernelTester()
+        .channels(channels)
+        .qmax(128)
+        .Test(xnn_f32_winograd_output_ukernel_4x4__sse);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if !XNN_ARCH_ASMJS && !XNN_ARCH_WASM
+  TEST(F32_WINOGRAD_INPUT_6X6__PSIMD, channels_eq_4) {
+    TEST_REQUIRES_PSIMD;
+    WinogradMicrokernelTester()
+      .channels(4)
+      .Test(xnn_f32_winograd_input_ukernel_6x6__psimd);
+  }
+
+  TEST(F32_WINOGRAD_INPUT_6X6__PSIMD, channels_lt_4) {
+    TEST_REQUIRES_PSIMD;
+    for (size_t channels = 1; channels < 4; channels++) {
+      WinogradMicrokernelTester()
+        .channels(channels)
+        .Test(xnn_f32_winograd_input_ukernel_6x6__psimd);
+    }
+  }
+
+  TEST(F32_WINOGRAD_INPUT_6X6__PSIMD, channels_gt_4) {
+    TEST_REQUIRES_PSIMD;
+    for (size_t channels = 5; channels < 40; channels += 3) {
+      WinogradMicrokernelTester()
+        .channels(channels)
+        .Test(xnn_f32_winograd_input_ukernel_6x6__psimd);
+    }
+  }
+
+  TEST(F32_WINOGRAD_INPUT_6X6__PSIMD, input_stride) {
+    TEST_REQUIRES_PSIMD;
+    for (size_t channels = 1; channels < 20; channels += 3) {
+      WinogradMicrokernelTester()
+        .channels(channels)
+        .input_stride(23)
+        .Test(xnn_f32_winograd_input_ukernel_6x6__psimd);
+    }
+  }
+
+  TEST(F32_WINOGRAD_INPUT_6X6__PSIMD, output_stride) {
+    TEST_REQUIRES_PSIMD;
+    for (size_t channels = 1; channels < 20; channels += 3) {
+      WinogradMicrokernelTester()
+        .channels(channels)
+        .output_stride(23)
+        .Test(xnn_f32_winograd_input_ukernel_6x6__psimd);
+    }
+  }
+
+  TEST(F32_WINOGRAD_OUTPUT_4X4__PSIMD, channels_eq_4) {
+    TEST_REQUIRES_PSIMD;
+    WinogradMicrokernelTester()
+      .channels(4)
+      .Test(xnn_f32_winograd_output_ukernel_4x4__psimd, WinogradMicrokernelTester::Variant::Scalar);
+  }
+
+  TEST(F32_WINOGRAD_OUTPUT_4X4__PSIMD, channels_lt_4) {
+    TEST_REQUIRES_PSIMD;
+    for (size_t channels = 1; channels < 4; channels++) {
+      WinogradMicrokernelTester()
+        .channels(channels)
+        .Test(xnn_f32_winograd_output_ukernel_4x4__psimd, WinogradMicrokernelTester::Variant::Scalar);
+    }
+  }
+
+  TEST(F32_WINOGRAD_OUTPUT_4X4__PSIMD, channels_gt_4) {
+    TEST_REQUIRES_PSIMD;
+    for (size_t channels = 5; channels < 40; channels += 3) {
+      WinogradMicrokernelTester()
+        .channels(channels)
+        .Test(xnn_f32_winograd_output_ukernel_4x4__psimd, WinogradMicrokernelTester::Variant::Scalar);
+    }
+  }
+
+  TEST(F32_WINOGRAD_OUTPUT_4X4__PSIMD, subtile) {
+    TEST_REQUIRES_PSIMD;
+    for (size_t rows = 1; rows <= 4; rows++) {
+      for (size_t columns = 1; columns <= 4; columns++) {
+        for (size_t channels = 1; channels < 20; channels += 3) {
+          WinogradMicrokernelTester()
+            .rows(rows)
+            .columns(columns)
+            .channels(channels)
+            .iterations(1)
+            .Test(xnn_f32_winograd_output_ukernel_4x4__psimd, WinogradMicrokernelTester::Variant::Scalar);
+        }
+      }
+    }
+  }
+
+  TEST(F32_WINOGRAD_OUTPUT_4X4__PSIMD, strides) {
+    TEST_REQUIRES_PSIMD;
+    for (size_t channels = 1; channels < 20; channels += 3) {
+      WinogradMicrokernelTester()
+        .channels(channels)
+        .input_stride(23)
+        .output_stride(29)
+        .Test(xnn_f32_winograd_output_ukernel_4x4__psimd, WinogradMicrokernelTester::Variant::Scalar);
+    }
+  }
+
+  TEST(F32_WINOGRAD_OUTPUT_4X4__PSIMD, qmin) {
+    TEST_REQUIRES_PSIMD;
+    for (size_t channels = 1; channels < 20; channels += 3) {
+      WinogradMicrokernelTester()
+        .channels(channels)
+        .qmin(128)
+        .Test(xnn_f32_winograd_output_ukernel_4x4__psimd, WinogradMicrokernelTester::Variant::Scalar);
+    }
+  }
+
+  TEST(F32_WINOGRAD_OUTPUT_4X4__PSIMD, qmax) {
+    TEST_REQUIRES_PSIMD;
+    for (size_t channels = 1; channels < 20; channels += 3) {
+      WinogradMicrokernelTester()
+        .channels(channels)
+        .qmax(128)
+        .Test(xnn_f32_winograd_output_ukernel_4x4__psimd, WinogradMicrokernelTester::Variant::Scalar);
+    }
+  }
+#endif  // !XNN_ARCH_ASMJS && !XNN_ARCH_WASM
+
+
+TEST(F32_WINOGRAD_INPUT_6X6__SCALAR, channels_eq_4) {
+  WinogradMicrokernelTester()
+    .channels(4)
+    .Test(xnn_f32_winograd_input_ukernel_6x6__scalar);
+}
+
+TEST(F32_WINOGRAD_INPUT_6X6__SCALAR, channels_lt_4) {
+  for (size_t channels = 1; channels < 4; channels++) {
+    WinogradMicrokernelTester()
+      .channels(channels)
+      .Test(xnn_f32_winograd_input_ukernel_6x6__scalar);
+  }
+}
+
+TEST(F32_WINOGRAD_INPUT_6X6__SCALAR, channels_gt_4) {
+  for (size_t channels = 5; channels < 40; channels += 3) {
+    WinogradMicrokernelTester()
+      .channels(channels)
+      .Test(xnn_f32_winograd_input_ukernel_6x6__scalar);
+  }
+}
+
+TEST(F32_WINOGRAD_INPUT_6X6__SCALAR, input_stride) {
+  for (size_t channels = 1; channels < 20; channels += 3) {
+    WinogradMicrokernelTester()
+      .channels(channels)
+      .input_stride(23)
+      .Test(xnn_f32_winograd_input_ukernel_6x6__scalar);
+  }
+}
+
+TEST(F32_WINOGRAD_INPUT_6X6__SCALAR, output_stride) {
+  for (size_t channels = 1; channels < 20; channels += 3) {
+    WinogradMicrokernelTester()
+      .channels(channels)
+      .output_stride(23)
+      .Test(xnn_f32_winograd_input_ukernel_6x6__scalar);
+  }
+}
+
+TEST(F32_WINOGRAD_OUTPUT_4X4__SCALAR, channels_eq_4) {
+  WinogradMicrokernelTester()
+    .channels(4)
+    .Test(xnn_f32_winograd_output_ukernel_4x4__scalar, WinogradMicrokernelTester::Variant::Scalar);
+}
+
+TEST(F32_WINOGRAD_OUTPUT_4X4__SCALAR, channels_lt_4) {
+  for (size_t channels = 1; channels < 4; channels++) {
+    WinogradMicrokernelTester()
+      .channels(channels)
+      .Test(xnn_f32_winograd_output_ukernel_4x4__scalar, WinogradMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F32_WINOGRAD_OUTPUT_4X4__SCALAR, channels_gt_4) {
+  for (size_t channels = 5; channels < 40; channels += 3) {
+    WinogradMicrokernelTester()
+      .channels(channels)
+      .Test(xnn_f32_winograd_output_ukernel_4x4__scalar, WinogradMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F32_WINOGRAD_OUTPUT_4X4__SCALAR, subtile) {
+  for (size_t rows = 1; rows <= 4; rows++) {
+    for (size_t columns = 1; columns <= 4; columns++) {
+      for (size_t channels = 1; channels < 20; channels += 3) {
+        WinogradMicrokernelTester()
+          .rows(rows)
+          .columns(columns)
+          .channels(channels)
+          .iterations(1)
+          .Test(xnn_f32_winograd_output_ukernel_4x4__scalar, WinogradMicrokernelTester::Variant::Scalar);
+      }
+    }
+  }
+}
+
+TEST(F32_WINOGRAD_OUTPUT_4X4__SCALAR, strides) {
+  for (size_t channels = 1; channels < 20; channels += 3) {
+    WinogradMicrokernelTester()
+      .channels(channels)
+      .input_stride(23)
+      .output_stride(29)
+      .Test(xnn_f32_winograd_output_ukernel_4x4__scalar, WinogradMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F32_WINOGRAD_OUTPUT_4X4__SCALAR, qmin) {
+  for (size_t channels = 1; channels < 20; channels += 3) {
+    WinogradMicrokernelTester()
+      .channels(channels)
+      .qmin(128)
+      .Test(xnn_f32_winograd_output_ukernel_4x4__scalar, WinogradMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F32_WINOGRAD_OUTPUT_4X4__SCALAR, qmax) {
+  for (size_t channels = 1; channels < 20; channels += 3) {
+    WinogradMicrokernelTester()
+      .channels(channels)
+      .qmax(128)
+      .Test(xnn_f32_winograd_output_ukernel_4x4__scalar, WinogradMicrokernelTester::Variant::Scalar);
+  }
+}
@@ -10,14 +10,19 @@
 
 #include <gtest/gtest.h>
 
+#include <cassert>
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <algorithm>
 #include <cmath>
 #include <functional>
+#include <memory>
 #include <random>
 #include <vector>
 
+#include <fp16.h>
+#include <pthreadpool.h>
 #include <xnnpack.h>
 
 
@@ -101,6 +106,43 @@ class FullyConnectedOperatorTester {
     return this->qmax_;
   }
 
+  inline FullyConnectedOperatorTester& num_threads(size_t num_threads) {
+    assert(num_threads != 0);
+    this->num_threads_ = num_threads;
+    return *this;
+  }
+
+  inline size_t num_threads() const {
+    return this->num_threads_;
+  }
+
+  inline FullyConnectedOperatorTester& sparsity(float sparsity) {
+    this->sparsity_ = sparsity;
+    return *this;
+  }
+
+  inline float sparsity() const {
+    return this->sparsity_;
+  }
+
+  inline FullyConnectedOperatorTester& load_packed_weights(bool load_packed_weights) {
+    this->load_packed_weights_ = load_packed_weights;
+    return *this;
+  }
+
+  inline bool load_packed_weights() const {
+    return this->load_packed_weights_;
+  }
+
+  inline FullyConnectedOperatorTester& flags(uint32_t flags) {
+    this->flags_ = flags;
+    return *this;
+  }
+
+  inline uint32_t flags() const {
+    return this->flags_;
+  }
+
   inline FullyConnectedOperatorTester& iterations(size_t iterations) {
     this->iterations_ = iterations;
     return *this;
@@ -209,10 +251,326 @@ class FullyConnectedOperatorTester {
     }
   }
 
+  void TestQ8C() const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto s32rng = std::bind(std::uniform_int_distribution<int32_t>(-10000, 10000), rng);
+    auto u8rng = std::bind(std::uniform_int_distribution<uint8_t>(), rng);
+    auto scalerng = std::bind(std::uniform_real_distribution<float>(0.5f, 1.0f), rng);
+
+    std::vector<uint8_t> input(XNN_EXTRA_BYTES / sizeof(uint8_t) +
+      (batch_size() - 1) * input_stride() + input_channels());
+    std::vector<uint8_t> kernel(output_channels() * input_channels());
+    std::vector<int32_t> bias(output_channels());
+    std::vector<float> kernel_scale(output_channels());
+    std::vector<uint8_t> output((batch_size() - 1) * output_stride() + output_channels());
+    std::vector<int32_t> accumulators(batch_size() * output_channels());
+    std::vector<double> output_ref(batch_size() * output_channels());
+
+    const uint8_t input_zero_point = 127;
+    const uint8_t kernel_zero_point = 127;
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(u8rng));
+      std::generate(kernel.begin(), kernel.end(), std::ref(u8rng));
+      std::generate(bias.begin(), bias.end(), std::ref(s32rng));
+      std::generate(kernel_scale.begin(), kernel_scale.end(), std::ref(scalerng));
+      std::fill(output.begin(), output.end(), 0xA5);
+      std::fill(accumulators.begin(), accumulators.end(), 0);
+
+      // Compute reference results, without renormalization.
+      for (size_t i = 0; i < batch_size(); i++) {
+        for (size_t oc = 0; oc < output_channels(); oc++) {
+          accumulators[i * output_channels() + oc] = bias[oc];
+        }
+      }
+      for (size_t i = 0; i < batch_size(); i++) {
+        for (size_t oc = 0; oc < output_channels(); oc++) {
+          for (size_t ic = 0; ic < input_channels(); ic++) {
+            accumulators[i * output_channels() + oc] +=
+              (int32_t(input[i * input_stride() + ic]) - int32_t(input_zero_point)) *
+              (int32_t(kernel[oc * input_channels() + ic]) - int32_t(kernel_zero_point));
+          }
+        }
+      }
+
+      // Compute renormalization parameters.
+      const int32_t accumulated_min = *std::min_element(accumulators.cbegin(), accumulators.cend());
+      const int32_t accumulated_max = *std::max_element(accumulators.cbegin(), accumulators.cend());
+
+      const double output_scale = double(uint32_t(accumulated_max - accumulated_min)) / 255.0;
+      const uint8_t output_zero_point = uint8_t(std::max(std::min(
+        lrint(127.5 - 0.5 * double(accumulated_min + accumulated_max) / output_scale),
+        long(std::numeric_limits<uint8_t>::max())), long(std::numeric_limits<uint8_t>::min())));
+
+      // Renormalize reference results.
+      for (size_t i = 0; i < accumulators.size(); i++) {
+        const size_t c = i % output_channels();
+        output_ref[i] = std::max<double>(std::min<double>(
+          double(accumulators[i]) * double(kernel_scale[c]) / output_scale,
+          double(qmax()) - output_zero_point), double(qmin()) - output_zero_point);
+      }
+
+      // Create, setup, run, and destroy Fully Connected operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize());
+      xnn_operator_t fully_connected_op = nullptr;
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_create_fully_connected_nc_q8c(
+          input_channels(), output_channels(),
+          input_stride(), output_stride(),
+          input_zero_point, 1.0f /* input scale */,
+          kernel_zero_point, kernel_scale.data(),
+          kernel.data(), bias.data(),
+          output_zero_point, output_scale, qmin(), qmax(),
+          0, &fully_connected_op));
+
+      // Smart pointer to automatically delete fully_connected_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_fully_connected_op(fully_connected_op, xnn_delete_operator);
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_fully_connected_nc_q8c(
+          fully_connected_op,
+          batch_size(),
+          input.data(), output.data(),
+          nullptr /* thread pool */));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(fully_connected_op, nullptr /* thread pool */));
+
+      // Verify results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        for (size_t c = 0; c < output_channels(); c++) {
+          ASSERT_LE(int32_t(output[i * output_stride() + c]), int32_t(qmax()))
+            << "batch index = " << i << ", channel = " << c;
+          ASSERT_GE(int32_t(output[i * output_stride() + c]), int32_t(qmin()))
+            << "batch index = " << i << ", channel = " << c;
+          ASSERT_NEAR(
+              output_ref[i * output_channels() + c],
+              double(output[i * output_stride() + c]) - double(output_zero_point),
+              0.9)
+            << "batch index = " << i << ", channel = " << c;
+        }
+      }
+    }
+  }
+
+  void TestQ8DQ() const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto f32rng = std::bind(std::uniform_real_distribution<float>(-1.0f, 1.0f), rng);
+
+    std::vector<float> input(XNN_EXTRA_BYTES / sizeof(float) +
+      (batch_size() - 1) * input_stride() + input_channels());
+    std::vector<float> kernel(output_channels() * input_channels());
+    std::vector<float> bias(output_channels());
+    std::vector<float> output((batch_size() - 1) * output_stride() + output_channels());
+    std::vector<float> output_ref(batch_size() * output_channels());
+    std::vector<float> output_tolerance(batch_size() * output_channels());
+
+    pthreadpool_t threadpool = nullptr;
+    if (num_threads() > 1) {
+      threadpool = pthreadpool_create(num_threads());
+      ASSERT_NE(nullptr, threadpool);
+    }
+    std::unique_ptr<pthreadpool, decltype(&pthreadpool_destroy)> auto_threadpool(threadpool, pthreadpool_destroy);
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(f32rng));
+      std::generate(kernel.begin(), kernel.end(), std::ref(f32rng));
+      std::generate(bias.begin(), bias.end(), std::ref(f32rng));
+      std::fill(output.begin(), output.end(), nanf(""));
+
+      // Compute reference results in F32 arithmetic.
+      for (size_t i = 0; i < batch_size(); i++) {
+        for (size_t oc = 0; oc < output_channels(); oc++) {
+          double acc = bias[oc];
+          for (size_t ic = 0; ic < input_channels(); ic++) {
+            acc += double(input[i * input_stride() + ic]) * double(kernel[oc * input_channels() + ic]);
+          }
+          output_ref[i * output_channels() + oc] = float(acc);
+        }
+      }
+
+      // Bound the error of 8-bit quantization: the kernel is quantized with a single scale over its range, and every
+      // input row is quantized with a scale over its absolute maximum. Rounding errors are at most half of the scales.
+      const float kernel_min = std::min(*std::min_element(kernel.cbegin(), kernel.cend()), 0.0f);
+      const float kernel_max = std::max(*std::max_element(kernel.cbegin(), kernel.cend()), 0.0f);
+      const float kernel_scale = (kernel_max - kernel_min) / 255.0f;
+      for (size_t i = 0; i < batch_size(); i++) {
+        float input_absmax = 0.0f;
+        for (size_t ic = 0; ic < input_channels(); ic++) {
+          input_absmax = std::max(input_absmax, std::abs(input[i * input_stride() + ic]));
+        }
+        const float input_scale = input_absmax / 127.0f;
+        for (size_t oc = 0; oc < output_channels(); oc++) {
+          double tolerance = 1.0e-5 * std::abs(output_ref[i * output_channels() + oc]);
+          for (size_t ic = 0; ic < input_channels(); ic++) {
+            tolerance += 0.5 * double(kernel_scale) * std::abs(double(input[i * input_stride() + ic])) +
+              0.5 * double(input_scale) * std::abs(double(kernel[oc * input_channels() + ic])) +
+              0.25 * double(input_scale) * double(kernel_scale);
+          }
+          output_tolerance[i * output_channels() + oc] = float(tolerance);
+        }
+      }
+
+      // Compute clamping parameters.
+      const float accumulated_min = *std::min_element(output_ref.cbegin(), output_ref.cend());
+      const float accumulated_max = *std::max_element(output_ref.cbegin(), output_ref.cend());
+
+      const float output_min = accumulated_min + (accumulated_max - accumulated_min) / 255.0f * float(qmin());
+      const float output_max = accumulated_max - (accumulated_max - accumulated_min) / 255.0f * float(255 - qmax());
+
+      // Clamp reference results.
+      for (float& value : output_ref) {
+        value = std::max(std::min(value, output_max), output_min);
+      }
+
+      // Create, setup, run, and destroy Fully Connected operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize());
+      xnn_operator_t fully_connected_op = nullptr;
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_create_fully_connected_nc_q8dq(
+          input_channels(), output_channels(),
+          input_stride(), output_stride(),
+          kernel.data(), bias.data(),
+          output_min, output_max,
+          0, &fully_connected_op));
+
+      // Smart pointer to automatically delete fully_connected_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_fully_connected_op(fully_connected_op, xnn_delete_operator);
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_fully_connected_nc_q8dq(
+          fully_connected_op,
+          batch_size(),
+          input.data(), output.data(),
+          threadpool));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(fully_connected_op, threadpool));
+
+      // Verify results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        for (size_t c = 0; c < output_channels(); c++) {
+          ASSERT_LE(output[i * output_stride() + c], output_max)
+            << "batch index = " << i << ", channel = " << c;
+          ASSERT_GE(output[i * output_stride() + c], output_min)
+            << "batch index = " << i << ", channel = " << c;
+          ASSERT_NEAR(
+              output_ref[i * output_channels() + c],
+              output[i * output_stride() + c],
+              output_tolerance[i * output_channels() + c])
+            << "batch index = " << i << ", channel = " << c;
+        }
+      }
+    }
+  }
+
+  void TestF16() const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto f32rng = std::bind(std::uniform_real_distribution<float>(0.1f, 1.0f), rng);
+    auto f16rng = std::bind(fp16_ieee_from_fp32_value, f32rng);
+
+    std::vector<uint16_t> input(XNN_EXTRA_BYTES / sizeof(uint16_t) +
+      (batch_size() - 1) * input_stride() + input_channels());
+    std::vector<uint16_t> kernel(output_channels() * input_channels());
+    std::vector<uint16_t> bias(output_channels());
+    std::vector<uint16_t> output((batch_size() - 1) * output_stride() + output_channels());
+    std::vector<float> output_ref(batch_size() * output_channels());
+
+    pthreadpool_t threadpool = nullptr;
+    if (num_threads() > 1) {
+      threadpool = pthreadpool_create(num_threads());
+      ASSERT_NE(nullptr, threadpool);
+    }
+    std::unique_ptr<pthreadpool, decltype(&pthreadpool_destroy)> auto_threadpool(threadpool, pthreadpool_destroy);
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(f16rng));
+      std::generate(kernel.begin(), kernel.end(), std::ref(f16rng));
+      std::generate(bias.begin(), bias.end(), std::ref(f16rng));
+      std::fill(output.begin(), output.end(), UINT16_C(0x7E00) /* NaN */);
+
+      // Compute reference results, without clamping.
+      for (size_t i = 0; i < batch_size(); i++) {
+        for (size_t oc = 0; oc < output_channels(); oc++) {
+          output_ref[i * output_channels() + oc] = fp16_ieee_to_fp32_value(bias[oc]);
+        }
+      }
+      for (size_t i = 0; i < batch_size(); i++) {
+        for (size_t oc = 0; oc < output_channels(); oc++) {
+          for (size_t ic = 0; ic < input_channels(); ic++) {
+            output_ref[i * output_channels() + oc] +=
+              fp16_ieee_to_fp32_value(input[i * input_stride() + ic]) *
+              fp16_ieee_to_fp32_value(kernel[oc * input_channels() + ic]);
+          }
+        }
+      }
+
+      // Compute clamping parameters, rounded to half precision.
+      const float accumulated_min = *std::min_element(output_ref.cbegin(), output_ref.cend());
+      const float accumulated_max = *std::max_element(output_ref.cbegin(), output_ref.cend());
+
+      const float output_min = fp16_ieee_to_fp32_value(fp16_ieee_from_fp32_value(
+        accumulated_min + (accumulated_max - accumulated_min) / 255.0f * float(qmin())));
+      const float output_max = fp16_ieee_to_fp32_value(fp16_ieee_from_fp32_value(
+        accumulated_max - (accumulated_max - accumulated_min) / 255.0f * float(255 - qmax())));
+
+      // Clamp reference results.
+      for (float& value : output_ref) {
+        value = std::max(std::min(value, output_max), output_min);
+      }
+
+      // Create, setup, run, and destroy Fully Connected operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize());
+      xnn_operator_t fully_connected_op = nullptr;
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_create_fully_connected_nc_f16(
+          input_channels(), output_channels(),
+          input_stride(), output_stride(),
+          kernel.data(), bias.data(),
+          output_min, output_max,
+          0, &fully_connected_op));
+
+      // Smart pointer to automatically delete fully_connected_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_fully_connected_op(fully_connected_op, xnn_delete_operator);
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_fully_connected_nc_f16(
+          fully_connected_op,
+          batch_size(),
+          input.data(), output.data(),
+          threadpool));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(fully_connected_op, threadpool));
+
+      // Verify results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        for (size_t c = 0; c < output_channels(); c++) {
+          ASSERT_LE(fp16_ieee_to_fp32_value(output[i * output_stride() + c]), output_max)
+            << "batch index = " << i << ", channel = " << c;
+          ASSERT_GE(fp16_ieee_to_fp32_value(output[i * output_stride() + c]), output_min)
+            << "batch index = " << i << ", channel = " << c;
+          ASSERT_NEAR(
+              output_ref[i * output_channels() + c],
+              fp16_ieee_to_fp32_value(output[i * output_stride() + c]),
+              1.0e-2 * std::abs(output_ref[i * output_channels() + c]))
+            << "batch index = " << i << ", channel = " << c;
+        }
+      }
+    }
+  }
+
   void TestF32() const {
     std::random_device random_device;
     auto rng = std::mt19937(random_device());
     auto f32rng = std::bind(std::uniform_real_distribution<float>(0.1f, 1.0f), rng);
+    auto prng = std::bind(std::uniform_real_distribution<float>(), rng);
 
     std::vector<float> input(XNN_EXTRA_BYTES / sizeof(float) +
       (batch_size() - 1) * input_stride() + input_channels());
@@ -221,12 +579,44 @@ class FullyConnectedOperatorTester {
     std::vector<float> output((batch_size() - 1) * output_stride() + output_channels());
     std::vector<float> output_ref(batch_size() * output_channels());
 
+    pthreadpool_t threadpool = nullptr;
+    if (num_threads() > 1) {
+      threadpool = pthreadpool_create(num_threads());
+      ASSERT_NE(nullptr, threadpool);
+    }
+    std::unique_ptr<pthreadpool, decltype(&pthreadpool_destroy)> auto_threadpool(threadpool, pthreadpool_destroy);
+
     for (size_t iteration = 0; iteration < iterations(); iteration++) {
       std::generate(input.begin(), input.end(), std::ref(f32rng));
       std::generate(kernel.begin(), kernel.end(), std::ref(f32rng));
+      for (float& k : kernel) {
+        if (prng() < sparsity()) {
+          k = 0.0f;
+        }
+      }
       std::generate(bias.begin(), bias.end(), std::ref(f32rng));
       std::fill(output.begin(), output.end(), nanf(""));
 
+      // Reference results use the weights as the operator stores them, i.e. rounded to half-precision or quantized
+      // symmetrically to 8 bits with per-channel scales.
+      std::vector<float> kernel_ref(kernel);
+      if (flags() & XNN_FLAG_FP16_WEIGHTS) {
+        for (float& k : kernel_ref) {
+          k = fp16_ieee_to_fp32_value(fp16_ieee_from_fp32_value(k));
+        }
+      } else if (flags() & XNN_FLAG_INT8_WEIGHTS) {
+        for (size_t oc = 0; oc < output_channels(); oc++) {
+          float* k_row = kernel_ref.data() + oc * input_channels();
+          float k_absmax = 0.0f;
+          for (size_t ic = 0; ic < input_channels(); ic++) {
+            k_absmax = std::max(k_absmax, std::abs(k_row[ic]));
+          }
+          for (size_t ic = 0; ic < input_channels(); ic++) {
+            k_row[ic] = float(lrintf(k_row[ic] * (127.0f / k_absmax))) * (k_absmax / 127.0f);
+          }
+        }
+      }
+
       // Compute reference results, without renormalization.
       for (size_t i = 0; i < batch_size(); i++) {
         for (size_t oc = 0; oc < output_channels(); oc++) {
@@ -237,7 +627,7 @@ class FullyConnectedOperatorTester {
         for (size_t oc = 0; oc < output_channels(); oc++) {
           for (size_t ic = 0; ic < input_channels(); ic++) {
             output_ref[i * output_channels() + oc] +=
-              input[i * input_stride() + ic] * kernel[oc * input_channels() + ic];
+              input[i * input_stride() + ic] * kernel_ref[oc * input_channels() + ic];
           }
         }
       }
@@ -264,20 +654,45 @@ class FullyConnectedOperatorTester {
           input_stride(), output_stride(),
           kernel.data(), bias.data(),
           output_min, output_max,
-          0, &fully_connected_op));
+          flags(), &fully_connected_op));
 
       // Smart pointer to automatically delete fully_connected_op.
       std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_fully_connected_op(fully_connected_op, xnn_delete_operator);
 
+      // Blob with serialized packed weights, aligned as required by xnn_create_fully_connected_nc_f32_from_packed_weights.
+      std::vector<uint8_t> packed_weights_storage;
+      if (load_packed_weights()) {
+        size_t packed_weights_size = 0;
+        ASSERT_EQ(xnn_status_success,
+          xnn_get_operator_packed_weights_size(fully_connected_op, &packed_weights_size));
+        packed_weights_storage.resize(packed_weights_size + 64);
+        void* packed_weights = reinterpret_cast<void*>(
+          (reinterpret_cast<uintptr_t>(packed_weights_storage.data()) + 63) & ~uintptr_t(63));
+        ASSERT_EQ(xnn_status_success,
+          xnn_export_operator_packed_weights(fully_connected_op, packed_weights_size, packed_weights));
+
+        // Replace the operator with the one which uses serialized packed weights in-place.
+        auto_fully_connected_op.reset();
+        fully_connected_op = nullptr;
+        ASSERT_EQ(xnn_status_success,
+          xnn_create_fully_connected_nc_f32_from_packed_weights(
+            input_channels(), output_channels(),
+            input_stride(), output_stride(),
+            packed_weights, packed_weights_size,
+            output_min, output_max,
+            flags(), &fully_connected_op));
+        auto_fully_connected_op.reset(fully_connected_op);
+      }
+
       ASSERT_EQ(xnn_status_success,
         xnn_setup_fully_connected_nc_f32(
           fully_connected_op,
           batch_size(),
           input.data(), output.data(),
-          nullptr /* thread pool */));
+          threadpool));
 
       ASSERT_EQ(xnn_status_success,
-        xnn_run_operator(fully_connected_op, nullptr /* thread pool */));
+        xnn_run_operator(fully_connected_op, threadpool));
 
       // Verify results.
       for (size_t i = 0; i < batch_size(); i++) {
@@ -304,5 +719,9 @@ class FullyConnectedOperatorTester {
   size_t batch_size_{1};
   uint8_t qmin_{0};
   uint8_t qmax_{255};
+  size_t num_threads_{1};
+  float sparsity_{0.0f};
+  bool load_packed_weights_{false};
+  uint32_t flags_{0};
   size_t iterations_{1};
 };
@@ -8,6 +8,12 @@
 
 #include <gtest/gtest.h>
 
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <vector>
+
 #include "fully-connected-operator-tester.h"
 
 
@@ -109,6 +115,218 @@ TEST(FULLY_CONNECTED_OP_Q8, small_batch_with_output_stride) {
     .TestQ8();
 }
 
+TEST(FULLY_CONNECTED_OP_Q8C, unit_batch) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .iterations(3)
+    .TestQ8C();
+}
+
+TEST(FULLY_CONNECTED_OP_Q8C, unit_batch_with_qmin) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .qmin(128)
+    .iterations(3)
+    .TestQ8C();
+}
+
+TEST(FULLY_CONNECTED_OP_Q8C, unit_batch_with_qmax) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .qmax(128)
+    .iterations(3)
+    .TestQ8C();
+}
+
+TEST(FULLY_CONNECTED_OP_Q8C, small_batch) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .iterations(3)
+    .TestQ8C();
+}
+
+TEST(FULLY_CONNECTED_OP_Q8C, small_batch_with_input_stride) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .input_stride(28)
+    .output_channels(19)
+    .iterations(3)
+    .TestQ8C();
+}
+
+TEST(FULLY_CONNECTED_OP_Q8C, small_batch_with_output_stride) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .output_stride(29)
+    .iterations(3)
+    .TestQ8C();
+}
+
+TEST(FULLY_CONNECTED_OP_Q8DQ, unit_batch) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .iterations(3)
+    .TestQ8DQ();
+}
+
+TEST(FULLY_CONNECTED_OP_Q8DQ, unit_batch_with_qmin) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .qmin(128)
+    .iterations(3)
+    .TestQ8DQ();
+}
+
+TEST(FULLY_CONNECTED_OP_Q8DQ, unit_batch_with_qmax) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .qmax(128)
+    .iterations(3)
+    .TestQ8DQ();
+}
+
+TEST(FULLY_CONNECTED_OP_Q8DQ, small_batch) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .iterations(3)
+    .TestQ8DQ();
+}
+
+TEST(FULLY_CONNECTED_OP_Q8DQ, small_batch_with_input_stride) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .input_stride(28)
+    .output_channels(19)
+    .iterations(3)
+    .TestQ8DQ();
+}
+
+TEST(FULLY_CONNECTED_OP_Q8DQ, small_batch_with_output_stride) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .output_stride(29)
+    .iterations(3)
+    .TestQ8DQ();
+}
+
+TEST(FULLY_CONNECTED_OP_Q8DQ, large_input_channels) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(1000)
+    .output_channels(19)
+    .iterations(3)
+    .TestQ8DQ();
+}
+
+TEST(FULLY_CONNECTED_OP_Q8DQ, small_batch_multithreaded) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(37)
+    .num_threads(4)
+    .iterations(3)
+    .TestQ8DQ();
+}
+
+TEST(FULLY_CONNECTED_OP_F16, unit_batch) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .iterations(3)
+    .TestF16();
+}
+
+TEST(FULLY_CONNECTED_OP_F16, unit_batch_with_qmin) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .qmin(128)
+    .iterations(3)
+    .TestF16();
+}
+
+TEST(FULLY_CONNECTED_OP_F16, unit_batch_with_qmax) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .qmax(128)
+    .iterations(3)
+    .TestF16();
+}
+
+TEST(FULLY_CONNECTED_OP_F16, small_batch) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .iterations(3)
+    .TestF16();
+}
+
+TEST(FULLY_CONNECTED_OP_F16, small_batch_with_input_stride) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .input_stride(28)
+    .output_channels(19)
+    .iterations(3)
+    .TestF16();
+}
+
+TEST(FULLY_CONNECTED_OP_F16, small_batch_with_output_stride) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .output_stride(29)
+    .iterations(3)
+    .TestF16();
+}
+
+TEST(FULLY_CONNECTED_OP_F16, large_batch) {
+  FullyConnectedOperatorTester()
+    .batch_size(67)
+    .input_channels(23)
+    .output_channels(19)
+    .iterations(3)
+    .TestF16();
+}
+
+TEST(FULLY_CONNECTED_OP_F16, small_batch_multithreaded) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .num_threads(4)
+    .iterations(3)
+    .TestF16();
+}
+
 TEST(FULLY_CONNECTED_OP_F32, unit_batch) {
   FullyConnectedOperatorTester()
     .batch_size(1)
@@ -206,3 +424,525 @@ TEST(FULLY_CONNECTED_OP_F32, small_batch_with_output_stride) {
     .iterations(3)
     .TestF32();
 }
+
+TEST(FULLY_CONNECTED_OP_F32, large_batch) {
+  FullyConnectedOperatorTester()
+    .batch_size(67)
+    .input_channels(23)
+    .output_channels(19)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_OP_F32, large_batch_with_qmin) {
+  FullyConnectedOperatorTester()
+    .batch_size(67)
+    .input_channels(23)
+    .output_channels(19)
+    .qmin(128)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_OP_F32, large_batch_with_qmax) {
+  FullyConnectedOperatorTester()
+    .batch_size(67)
+    .input_channels(23)
+    .output_channels(19)
+    .qmax(128)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_OP_F32, large_batch_with_input_stride) {
+  FullyConnectedOperatorTester()
+    .batch_size(67)
+    .input_channels(23)
+    .input_stride(28)
+    .output_channels(19)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_OP_F32, large_batch_with_output_stride) {
+  FullyConnectedOperatorTester()
+    .batch_size(67)
+    .input_channels(23)
+    .output_channels(19)
+    .output_stride(29)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_OP_F32, large_batch_with_large_weights) {
+  FullyConnectedOperatorTester()
+    .batch_size(29)
+    .input_channels(1031)
+    .output_channels(613)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_OP_F32, large_batch_with_large_weights_and_qmax) {
+  FullyConnectedOperatorTester()
+    .batch_size(29)
+    .input_channels(1031)
+    .output_channels(613)
+    .qmax(128)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_OP_F32, large_batch_with_large_weights_and_strides) {
+  FullyConnectedOperatorTester()
+    .batch_size(29)
+    .input_channels(1031)
+    .input_stride(1043)
+    .output_channels(613)
+    .output_stride(617)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_OP_F32, unit_batch_with_split_k) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(1031)
+    .output_channels(19)
+    .num_threads(4)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_OP_F32, unit_batch_with_split_k_and_qmin) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(1031)
+    .output_channels(19)
+    .qmin(128)
+    .num_threads(4)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_OP_F32, unit_batch_with_split_k_and_qmax) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(1031)
+    .output_channels(19)
+    .qmax(128)
+    .num_threads(4)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_OP_F32, small_batch_with_split_k) {
+  FullyConnectedOperatorTester()
+    .batch_size(3)
+    .input_channels(1031)
+    .output_channels(19)
+    .num_threads(4)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_OP_F32, small_batch_with_split_k_and_strides) {
+  FullyConnectedOperatorTester()
+    .batch_size(3)
+    .input_channels(1031)
+    .input_stride(1043)
+    .output_channels(19)
+    .output_stride(29)
+    .num_threads(4)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_OP_F32, small_batch_with_split_k_and_two_slices) {
+  FullyConnectedOperatorTester()
+    .batch_size(3)
+    .input_channels(600)
+    .output_channels(19)
+    .num_threads(4)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_OP_F32, unit_batch_with_packed_weights) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .load_packed_weights(true)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_OP_F32, large_batch_with_packed_weights_and_strides) {
+  FullyConnectedOperatorTester()
+    .batch_size(128)
+    .input_channels(1031)
+    .input_stride(1043)
+    .output_channels(137)
+    .output_stride(151)
+    .load_packed_weights(true)
+    .iterations(1)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_OP_F32, unit_batch_with_fp16_weights) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .flags(XNN_FLAG_FP16_WEIGHTS)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_OP_F32, large_batch_with_fp16_weights_and_strides) {
+  FullyConnectedOperatorTester()
+    .batch_size(128)
+    .input_channels(1031)
+    .input_stride(1043)
+    .output_channels(137)
+    .output_stride(151)
+    .flags(XNN_FLAG_FP16_WEIGHTS)
+    .iterations(1)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_OP_F32, unit_batch_with_int8_weights) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .flags(XNN_FLAG_INT8_WEIGHTS)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_OP_F32, large_batch_with_int8_weights_and_qmin) {
+  FullyConnectedOperatorTester()
+    .batch_size(128)
+    .input_channels(1031)
+    .output_channels(137)
+    .qmin(128)
+    .flags(XNN_FLAG_INT8_WEIGHTS)
+    .iterations(1)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_OP_F32, small_batch_with_int8_weights_multithreaded) {
+  FullyConnectedOperatorTester()
+    .batch_size(3)
+    .input_channels(1031)
+    .output_channels(67)
+    .flags(XNN_FLAG_INT8_WEIGHTS)
+    .num_threads(4)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_OP_F32, unit_batch_with_fp16_weights_and_packed_weights) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .flags(XNN_FLAG_FP16_WEIGHTS)
+    .load_packed_weights(true)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_OP_F32, small_batch_with_int8_weights_and_packed_weights) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .flags(XNN_FLAG_INT8_WEIGHTS)
+    .load_packed_weights(true)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_OP_F32, unit_batch_with_sparse_weights) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .sparsity(0.8f)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_OP_F32, small_batch_with_sparse_weights) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .sparsity(0.8f)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_OP_F32, small_batch_with_sparse_weights_and_qmin) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .sparsity(0.8f)
+    .qmin(128)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_OP_F32, small_batch_with_sparse_weights_and_qmax) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .sparsity(0.8f)
+    .qmax(128)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_OP_F32, large_batch_with_sparse_weights_and_strides) {
+  FullyConnectedOperatorTester()
+    .batch_size(37)
+    .input_channels(123)
+    .input_stride(131)
+    .output_channels(67)
+    .output_stride(71)
+    .sparsity(0.9f)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_OP_F32, large_batch_with_sparse_weights_multithreaded) {
+  FullyConnectedOperatorTester()
+    .batch_size(128)
+    .input_channels(123)
+    .output_channels(67)
+    .sparsity(0.9f)
+    .num_threads(4)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_OP_F32, large_batch_with_dense_weights_above_sparsity_threshold) {
+  FullyConnectedOperatorTester()
+    .batch_size(37)
+    .input_channels(123)
+    .output_channels(67)
+    .sparsity(0.5f)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_OP_F32, compressed_weights_with_invalid_parameters) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  std::vector<float> kernel(19 * 23, 1.0f);
+  const std::vector<float> bias(19);
+  const float inf = std::numeric_limits<float>::infinity();
+
+  xnn_operator_t fully_connected_op = nullptr;
+  // Mutually exclusive flags.
+  EXPECT_EQ(xnn_status_invalid_parameter,
+    xnn_create_fully_connected_nc_f32(
+      23, 19, 23, 19, kernel.data(), bias.data(), -inf, +inf,
+      XNN_FLAG_FP16_WEIGHTS | XNN_FLAG_INT8_WEIGHTS, &fully_connected_op));
+  // Non-finite weights can't be quantized.
+  kernel[42] = inf;
+  EXPECT_EQ(xnn_status_invalid_parameter,
+    xnn_create_fully_connected_nc_f32(
+      23, 19, 23, 19, kernel.data(), bias.data(), -inf, +inf, XNN_FLAG_INT8_WEIGHTS, &fully_connected_op));
+  kernel[42] = 1.0f;
+
+  ASSERT_EQ(xnn_status_success,
+    xnn_create_fully_connected_nc_f32(
+      23, 19, 23, 19, kernel.data(), bias.data(), -inf, +inf, XNN_FLAG_INT8_WEIGHTS, &fully_connected_op));
+  std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_fully_connected_op(fully_connected_op, xnn_delete_operator);
+
+  size_t packed_weights_size = 0;
+  ASSERT_EQ(xnn_status_success,
+    xnn_get_operator_packed_weights_size(fully_connected_op, &packed_weights_size));
+  std::vector<uint8_t> packed_weights_storage(packed_weights_size + 64);
+  uint8_t* packed_weights = reinterpret_cast<uint8_t*>(
+    (reinterpret_cast<uintptr_t>(packed_weights_storage.data()) + 63) & ~uintptr_t(63));
+  ASSERT_EQ(xnn_status_success,
+    xnn_export_operator_packed_weights(fully_connected_op, packed_weights_size, packed_weights));
+
+  // INT8 weights loaded as F32 or FP16 weights.
+  xnn_operator_t loaded_op = nullptr;
+  EXPECT_NE(xnn_status_success,
+    xnn_create_fully_connected_nc_f32_from_packed_weights(
+      23, 19, 23, 19, packed_weights, packed_weights_size, -inf, +inf, 0, &loaded_op));
+  EXPECT_NE(xnn_status_success,
+    xnn_create_fully_connected_nc_f32_from_packed_weights(
+      23, 19, 23, 19, packed_weights, packed_weights_size, -inf, +inf, XNN_FLAG_FP16_WEIGHTS, &loaded_op));
+}
+
+TEST(FULLY_CONNECTED_OP_F32, packed_weights_with_mismatched_parameters) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  const std::vector<float> kernel(19 * 23, 1.0f);
+  const std::vector<float> bias(19);
+  const float inf = std::numeric_limits<float>::infinity();
+
+  xnn_operator_t fully_connected_op = nullptr;
+  ASSERT_EQ(xnn_status_success,
+    xnn_create_fully_connected_nc_f32(
+      23, 19, 23, 19, kernel.data(), bias.data(), -inf, +inf, 0, &fully_connected_op));
+  std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_fully_connected_op(fully_connected_op, xnn_delete_operator);
+
+  size_t packed_weights_size = 0;
+  ASSERT_EQ(xnn_status_success,
+    xnn_get_operator_packed_weights_size(fully_connected_op, &packed_weights_size));
+  std::vector<uint8_t> packed_weights_storage(packed_weights_size + 64);
+  uint8_t* packed_weights = reinterpret_cast<uint8_t*>(
+    (reinterpret_cast<uintptr_t>(packed_weights_storage.data()) + 63) & ~uintptr_t(63));
+  ASSERT_EQ(xnn_status_invalid_parameter,
+    xnn_export_operator_packed_weights(fully_connected_op, packed_weights_size - 1, packed_weights));
+  ASSERT_EQ(xnn_status_success,
+    xnn_export_operator_packed_weights(fully_connected_op, packed_weights_size, packed_weights));
+
+  xnn_operator_t loaded_op = nullptr;
+  // Different number of input channels.
+  EXPECT_EQ(xnn_status_invalid_parameter,
+    xnn_create_fully_connected_nc_f32_from_packed_weights(
+      24, 19, 24, 19, packed_weights, packed_weights_size, -inf, +inf, 0, &loaded_op));
+  // Truncated blob.
+  EXPECT_EQ(xnn_status_invalid_parameter,
+    xnn_create_fully_connected_nc_f32_from_packed_weights(
+      23, 19, 23, 19, packed_weights, packed_weights_size - 1, -inf, +inf, 0, &loaded_op));
+  // Misaligned blob.
+  EXPECT_EQ(xnn_status_invalid_parameter,
+    xnn_create_fully_connected_nc_f32_from_packed_weights(
+      23, 19, 23, 19, packed_weights + 4, packed_weights_size, -inf, +inf, 0, &loaded_op));
+  // Unsupported version.
+  packed_weights[4] += 1;
+  EXPECT_EQ(xnn_status_unsupported_parameter,
+    xnn_create_fully_connected_nc_f32_from_packed_weights(
+      23, 19, 23, 19, packed_weights, packed_weights_size, -inf, +inf, 0, &loaded_op));
+  packed_weights[4] -= 1;
+
+  ASSERT_EQ(xnn_status_success,
+    xnn_create_fully_connected_nc_f32_from_packed_weights(
+      23, 19, 23, 19, packed_weights, packed_weights_size, -inf, +inf, 0, &loaded_op));
+  ASSERT_EQ(xnn_status_success, xnn_delete_operator(loaded_op));
+}
+
+TEST(FULLY_CONNECTED_OP_F32, profile) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  const size_t batch_size = 5;
+  const size_t input_channels = 23;
+  const size_t output_channels = 19;
+  const std::vector<float> input(batch_size * input_channels + XNN_EXTRA_BYTES / sizeof(float));
+  const std::vector<float> kernel(output_channels * input_channels, 1.0f);
+  const std::vector<float> bias(output_channels);
+  std::vector<float> output(batch_size * output_channels);
+  const float inf = std::numeric_limits<float>::infinity();
+
+  xnn_operator_t fully_connected_op = nullptr;
+  ASSERT_EQ(xnn_status_success,
+    xnn_create_fully_connected_nc_f32(
+      input_channels, output_channels, input_channels, output_channels,
+      kernel.data(), bias.data(), -inf, +inf, 0, &fully_connected_op));
+  std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_fully_connected_op(fully_connected_op, xnn_delete_operator);
+
+  xnn_operator_profile profile;
+  EXPECT_EQ(xnn_status_invalid_state, xnn_get_operator_profile(fully_connected_op, &profile));
+
+  ASSERT_EQ(xnn_status_success,
+    xnn_setup_fully_connected_nc_f32(
+      fully_connected_op, batch_size, input.data(), output.data(), nullptr /* thread pool */));
+  ASSERT_EQ(xnn_status_success, xnn_run_operator(fully_connected_op, nullptr /* thread pool */));
+
+  // Runs are not recorded until profiling is enabled.
+  ASSERT_EQ(xnn_status_success, xnn_get_operator_profile(fully_connected_op, &profile));
+  EXPECT_EQ(0, profile.run_count);
+  EXPECT_EQ(2 * batch_size * input_channels * output_channels, profile.flops);
+  EXPECT_EQ(
+    sizeof(float) * (batch_size * input_channels + batch_size * output_channels +
+      output_channels * input_channels + output_channels),
+    profile.bytes);
+  EXPECT_STREQ("Fully Connected (NC, F32)", profile.operator_name);
+  EXPECT_STREQ("GEMM", profile.ukernel_name);
+  EXPECT_NE(0, profile.mr);
+  EXPECT_NE(0, profile.nr);
+  EXPECT_EQ(1, profile.num_passes);
+
+  ASSERT_EQ(xnn_status_success, xnn_enable_operator_profiling(fully_connected_op, true));
+  for (size_t iteration = 0; iteration < 3; iteration++) {
+    ASSERT_EQ(xnn_status_success, xnn_run_operator(fully_connected_op, nullptr /* thread pool */));
+  }
+  ASSERT_EQ(xnn_status_success, xnn_get_operator_profile(fully_connected_op, &profile));
+  EXPECT_EQ(3, profile.run_count);
+  EXPECT_EQ(1, profile.num_threads);
+  EXPECT_LE(profile.min_time_ns, profile.last_time_ns);
+  EXPECT_LE(profile.min_time_ns * 3, profile.total_time_ns);
+
+  // Enabling profiling again resets the statistics.
+  ASSERT_EQ(xnn_status_success, xnn_enable_operator_profiling(fully_connected_op, true));
+  ASSERT_EQ(xnn_status_success, xnn_get_operator_profile(fully_connected_op, &profile));
+  EXPECT_EQ(0, profile.run_count);
+  EXPECT_EQ(0, profile.total_time_ns);
+}
+
+TEST(FULLY_CONNECTED_OP_F32, profile_with_sparse_weights) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  const size_t batch_size = 5;
+  const size_t input_channels = 23;
+  const size_t output_channels = 19;
+  const std::vector<float> input(batch_size * input_channels + XNN_EXTRA_BYTES / sizeof(float));
+  // Diagonal kernel: one non-zero per output channel, too scattered for blocked SpMM micro-kernels.
+  std::vector<float> kernel(output_channels * input_channels);
+  for (size_t oc = 0; oc < output_channels; oc++) {
+    kernel[oc * input_channels + oc] = 1.0f;
+  }
+  const std::vector<float> bias(output_channels);
+  std::vector<float> output(batch_size * output_channels);
+  const float inf = std::numeric_limits<float>::infinity();
+
+  xnn_operator_t fully_connected_op = nullptr;
+  ASSERT_EQ(xnn_status_success,
+    xnn_create_fully_connected_nc_f32(
+      input_channels, output_channels, input_channels, output_channels,
+      kernel.data(), bias.data(), -inf, +inf, 0, &fully_connected_op));
+  std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_fully_connected_op(fully_connected_op, xnn_delete_operator);
+
+  ASSERT_EQ(xnn_status_success,
+    xnn_setup_fully_connected_nc_f32(
+      fully_connected_op, batch_size, input.data(), output.data(), nullptr /* thread pool */));
+  ASSERT_EQ(xnn_status_success, xnn_run_operator(fully_connected_op, nullptr /* thread pool */));
+
+  xnn_operator_profile profile;
+  ASSERT_EQ(xnn_status_success, xnn_get_operator_profile(fully_connected_op, &profile));
+  if (strcmp(profile.ukernel_name, "SpMM") != 0) {
+    // SpMM micro-kernels are not available on this architecture.
+    GTEST_SKIP();
+  }
+  EXPECT_NE(0, profile.mr);
+  EXPECT_EQ(2 * batch_size * output_channels, profile.flops);
+  EXPECT_EQ(
+    sizeof(float) * (batch_size * input_channels + batch_size * output_channels + output_channels + output_channels) +
+      sizeof(int32_t) * output_channels,
+    profile.bytes);
+
+  // Sparse weights have no serializable representation.
+  size_t packed_weights_size = 0;
+  EXPECT_EQ(xnn_status_unsupported_parameter,
+    xnn_get_operator_packed_weights_size(fully_connected_op, &packed_weights_size));
+
+  // Sparse representation can be disabled to keep the weights serializable.
+  xnn_operator_t dense_op = nullptr;
+  ASSERT_EQ(xnn_status_success,
+    xnn_create_fully_connected_nc_f32(
+      input_channels, output_channels, input_channels, output_channels,
+      kernel.data(), bias.data(), -inf, +inf, XNN_FLAG_DISABLE_SPARSE_WEIGHTS, &dense_op));
+  std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_dense_op(dense_op, xnn_delete_operator);
+  ASSERT_EQ(xnn_status_success,
+    xnn_setup_fully_connected_nc_f32(
+      dense_op, batch_size, input.data(), output.data(), nullptr /* thread pool */));
+  ASSERT_EQ(xnn_status_success, xnn_get_operator_profile(dense_op, &profile));
+  EXPECT_STREQ("GEMM", profile.ukernel_name);
+  EXPECT_EQ(xnn_status_success, xnn_get_operator_packed_weights_size(dense_op, &packed_weights_size));
+}
@@ -19,6 +19,8 @@
 #include <random>
 #include <vector>
 
+#include <fp16.h>
+
 #include <xnnpack.h>
 #include <xnnpack/AlignedAllocator.h>
 #include <xnnpack/params.h>
@@ -425,6 +427,126 @@ class GAvgPoolMicrokernelTester {
     }
   }
 
+  void Test(xnn_f16_gavgpool_up_ukernel_function gavgpool, Variant variant = Variant::Native) const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto f32rng = std::bind(std::uniform_real_distribution<float>(), rng);
+    auto f16rng = std::bind(fp16_ieee_from_fp32_value, f32rng);
+
+    std::vector<uint16_t> x((m() - 1) * x_stride() + n() + XNN_EXTRA_BYTES / sizeof(uint16_t));
+    std::vector<uint16_t> zero(n() + XNN_EXTRA_BYTES / sizeof(uint16_t));
+    std::vector<uint16_t> y(n());
+    std::vector<float> y_ref(n());
+
+    std::fill(zero.begin(), zero.end(), 0);
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(x.begin(), x.end(), std::ref(f16rng));
+      std::fill(y.begin(), y.end(), UINT16_C(0x7E00) /* NaN */);
+
+      // Compute reference results, without clamping.
+      for (size_t j = 0; j < n(); j++) {
+        float acc = 0.0f;
+        for (size_t i = 0; i < m(); i++) {
+          acc += fp16_ieee_to_fp32_value(x[i * x_stride() + j]);
+        }
+        y_ref[j] = acc / float(m());
+      }
+
+      // Compute clamping parameters, rounded to half precision.
+      const float accumulated_min = *std::min_element(y_ref.cbegin(), y_ref.cend());
+      const float accumulated_max = *std::max_element(y_ref.cbegin(), y_ref.cend());
+      const float accumulated_range = accumulated_max - accumulated_min;
+      const float y_min = fp16_ieee_to_fp32_value(fp16_ieee_from_fp32_value(accumulated_min + float(qmin()) / 255.0f * accumulated_range));
+      const float y_max = fp16_ieee_to_fp32_value(fp16_ieee_from_fp32_value(accumulated_max - float(255 - qmax()) / 255.0f * accumulated_range));
+
+      // Clamp reference results.
+      for (float& y_value : y_ref) {
+        y_value = std::max(std::min(y_value, y_max), y_min);
+      }
+
+      // Prepare micro-kernel parameters.
+      const xnn_f16_output_params params = xnn_compute_f16_output_params(1.0f / float(m()), y_min, y_max);
+
+      // Call optimized micro-kernel.
+      gavgpool(m(), n(),
+        x.data(), x_stride() * sizeof(uint16_t),
+        zero.data(),
+        y.data(),
+        &params);
+
+      // Verify results.
+      for (size_t i = 0; i < n(); i++) {
+        ASSERT_LE(fp16_ieee_to_fp32_value(y[i]), y_max)
+          << "at position " << i << ", m = " << m() << ", n = " << n();
+        ASSERT_GE(fp16_ieee_to_fp32_value(y[i]), y_min)
+          << "at position " << i << ", m = " << m() << ", n = " << n();
+        ASSERT_NEAR(fp16_ieee_to_fp32_value(y[i]), y_ref[i], std::abs(y_ref[i]) * 1.0e-2f)
+          << "at position " << i << ", m = " << m() << ", n = " << n();
+      }
+    }
+  }
+
+  void Test(xnn_f16_gavgpool_mp_ukernel_function gavgpool, Variant variant = Variant::Native) const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto f32rng = std::bind(std::uniform_real_distribution<float>(), rng);
+    auto f16rng = std::bind(fp16_ieee_from_fp32_value, f32rng);
+
+    std::vector<uint16_t> x((m() - 1) * x_stride() + n() + XNN_EXTRA_BYTES / sizeof(uint16_t));
+    std::vector<float, AlignedAllocator<float, 16>> buf(n() + XNN_EXTRA_BYTES / sizeof(uint16_t));
+    std::vector<uint16_t> zero(n() + XNN_EXTRA_BYTES / sizeof(uint16_t));
+    std::vector<uint16_t> y(n());
+    std::vector<float> y_ref(n());
+
+    std::fill(zero.begin(), zero.end(), 0);
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(x.begin(), x.end(), std::ref(f16rng));
+      std::fill(y.begin(), y.end(), UINT16_C(0x7E00) /* NaN */);
+
+      // Compute reference results, without clamping.
+      for (size_t j = 0; j < n(); j++) {
+        float acc = 0.0f;
+        for (size_t i = 0; i < m(); i++) {
+          acc += fp16_ieee_to_fp32_value(x[i * x_stride() + j]);
+        }
+        y_ref[j] = acc / float(m());
+      }
+
+      // Compute clamping parameters, rounded to half precision.
+      const float accumulated_min = *std::min_element(y_ref.cbegin(), y_ref.cend());
+      const float accumulated_max = *std::max_element(y_ref.cbegin(), y_ref.cend());
+      const float accumulated_range = accumulated_max - accumulated_min;
+      const float y_min = fp16_ieee_to_fp32_value(fp16_ieee_from_fp32_value(accumulated_min + float(qmin()) / 255.0f * accumulated_range));
+      const float y_max = fp16_ieee_to_fp32_value(fp16_ieee_from_fp32_value(accumulated_max - float(255 - qmax()) / 255.0f * accumulated_range));
+
+      // Clamp reference results.
+      for (float& y_value : y_ref) {
+        y_value = std::max(std::min(y_value, y_max), y_min);
+      }
+
+      // Prepare micro-kernel parameters.
+      const xnn_f16_output_params params = xnn_compute_f16_output_params(1.0f / float(m()), y_min, y_max);
+
+      // Call optimized micro-kernel.
+      gavgpool(m(), n(),
+        x.data(), x_stride() * sizeof(uint16_t),
+        zero.data(),
+        buf.data(),
+        y.data(),
+        &params);
+
+      // Verify results.
+      for (size_t i = 0; i < n(); i++) {
+        ASSERT_LE(fp16_ieee_to_fp32_value(y[i]), y_max)
+          << "at position " << i << ", m = " << m() << ", n = " << n();
+        ASSERT_GE(fp16_ieee_to_fp32_value(y[i]), y_min)
+          << "at position " << i << ", m = " << m() << ", n = " << n();
+        ASSERT_NEAR(fp16_ieee_to_fp32_value(y[i]), y_ref[i], std::abs(y_ref[i]) * 1.0e-2f)
+          << "at position " << i << ", m = " << m() << ", n = " << n();
+      }
+    }
+  }
+
  private:
   size_t m_{1};
   size_t n_{1};
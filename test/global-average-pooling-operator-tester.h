@@ -18,6 +18,8 @@
 #include <random>
 #include <vector>
 
+#include <fp16.h>
+
 #include <xnnpack.h>
 
 
@@ -214,6 +216,82 @@ class GlobalAveragePoolingOperatorTester {
     }
   }
 
+  void TestF16() const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto f32rng = std::bind(std::uniform_real_distribution<float>(), rng);
+    auto f16rng = std::bind(fp16_ieee_from_fp32_value, f32rng);
+
+    std::vector<uint16_t> input((batch_size() * width() - 1) * input_stride() + channels() + XNN_EXTRA_BYTES / sizeof(uint16_t));
+    std::vector<uint16_t> output(batch_size() * output_stride());
+    std::vector<float> output_ref(batch_size() * channels());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(f16rng));
+      std::fill(output.begin(), output.end(), UINT16_C(0x7E00) /* NaN */);
+
+      // Compute reference results, without clamping.
+      for (size_t i = 0; i < batch_size(); i++) {
+        for (size_t j = 0; j < channels(); j++) {
+          float acc = 0.0f;
+          for (size_t k = 0; k < width(); k++) {
+            acc += fp16_ieee_to_fp32_value(input[(i * width() + k) * input_stride() + j]);
+          }
+          output_ref[i * channels() + j] = acc / float(width());
+        }
+      }
+
+      // Compute clamping parameters, rounded to half precision.
+      const float accumulated_min = *std::min_element(output_ref.cbegin(), output_ref.cend());
+      const float accumulated_max = *std::max_element(output_ref.cbegin(), output_ref.cend());
+      const float accumulated_range = accumulated_max - accumulated_min;
+      const float output_min = accumulated_range == 0.0f ?
+        -std::numeric_limits<float>::infinity() :
+        fp16_ieee_to_fp32_value(fp16_ieee_from_fp32_value(accumulated_min + accumulated_range / 255.0f * float(qmin())));
+      const float output_max = accumulated_range == 0.0f ?
+        +std::numeric_limits<float>::infinity() :
+        fp16_ieee_to_fp32_value(fp16_ieee_from_fp32_value(accumulated_max - accumulated_range / 255.0f * float(255 - qmax())));
+
+      // Clamp reference results.
+      for (float& value : output_ref) {
+        value = std::max(std::min(value, output_max), output_min);
+      }
+
+      // Create, setup, run, and destroy Global Average Pooling operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize());
+      xnn_operator_t global_average_pooling_op = nullptr;
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_create_global_average_pooling_nwc_f16(
+          channels(), input_stride(), output_stride(),
+          output_min, output_max,
+          0, &global_average_pooling_op));
+      ASSERT_NE(nullptr, global_average_pooling_op);
+
+      // Smart pointer to automatically delete global_average_pooling_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_global_average_pooling_op(global_average_pooling_op, xnn_delete_operator);
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_global_average_pooling_nwc_f16(
+          global_average_pooling_op,
+          batch_size(), width(),
+          input.data(), output.data(),
+          nullptr /* thread pool */));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(global_average_pooling_op, nullptr /* thread pool */));
+
+      // Verify results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        for (size_t c = 0; c < channels(); c++) {
+          ASSERT_LE(fp16_ieee_to_fp32_value(output[i * output_stride() + c]), output_max);
+          ASSERT_GE(fp16_ieee_to_fp32_value(output[i * output_stride() + c]), output_min);
+          ASSERT_NEAR(fp16_ieee_to_fp32_value(output[i * output_stride() + c]), output_ref[i * channels() + c], std::abs(output_ref[i * channels() + c]) * 1.0e-2f) <<
+            "in batch index " << i << ", channel " << c;
+        }
+      }
+    }
+  }
+
   void TestF32() const {
     std::random_device random_device;
     auto rng = std::mt19937(random_device());
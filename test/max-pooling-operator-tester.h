@@ -383,6 +383,24 @@ class MaxPoolingOperatorTester {
     return this->qmax_;
   }
 
+  inline MaxPoolingOperatorTester& compact_indirection(bool compact_indirection) {
+    this->compact_indirection_ = compact_indirection;
+    return *this;
+  }
+
+  inline bool compact_indirection() const {
+    return this->compact_indirection_;
+  }
+
+  inline MaxPoolingOperatorTester& double_buffering(bool double_buffering) {
+    this->double_buffering_ = double_buffering;
+    return *this;
+  }
+
+  inline bool double_buffering() const {
+    return this->double_buffering_;
+  }
+
   inline MaxPoolingOperatorTester& iterations(size_t iterations) {
     this->iterations_ = iterations;
     return *this;
@@ -440,7 +458,7 @@ class MaxPoolingOperatorTester {
           dilation_height(), dilation_width(),
           channels(), input_pixel_stride(), output_pixel_stride(),
           qmin(), qmax(),
-          0, &max_pooling_op));
+          compact_indirection() ? XNN_FLAG_COMPACT_INDIRECTION : 0, &max_pooling_op));
       ASSERT_NE(nullptr, max_pooling_op);
 
       // Smart pointer to automatically delete max_pooling_op.
@@ -535,7 +553,7 @@ class MaxPoolingOperatorTester {
           dilation_height(), dilation_width(),
           channels(), input_pixel_stride(), output_pixel_stride(),
           output_min, output_max,
-          0, &max_pooling_op));
+          compact_indirection() ? XNN_FLAG_COMPACT_INDIRECTION : 0, &max_pooling_op));
       ASSERT_NE(nullptr, max_pooling_op);
 
       // Smart pointer to automatically delete max_pooling_op.
@@ -622,7 +640,7 @@ class MaxPoolingOperatorTester {
           dilation_height(), dilation_width(),
           channels(), input_pixel_stride(), output_pixel_stride(),
           qmin(), qmax(),
-          0, &max_pooling_op));
+          compact_indirection() ? XNN_FLAG_COMPACT_INDIRECTION : 0, &max_pooling_op));
       ASSERT_NE(nullptr, max_pooling_op);
 
       // Smart pointer to automatically delete max_pooling_op.
@@ -653,6 +671,12 @@ class MaxPoolingOperatorTester {
         }
       }
 
+      if (double_buffering()) {
+        // Run the second time on different buffers, as if the caller alternated between two sets of buffers.
+        std::vector<uint8_t>(input.size()).swap(input);
+        std::vector<uint8_t>(output.size()).swap(output);
+      }
+
       // Re-generate data for the second run.
       std::generate(input.begin(), input.end(), std::ref(u8rng));
       std::fill(output.begin(), output.end(), 0xA5);
@@ -776,7 +800,7 @@ class MaxPoolingOperatorTester {
           dilation_height(), dilation_width(),
           channels(), input_pixel_stride(), output_pixel_stride(),
           output_min, output_max,
-          0, &max_pooling_op));
+          compact_indirection() ? XNN_FLAG_COMPACT_INDIRECTION : 0, &max_pooling_op));
       ASSERT_NE(nullptr, max_pooling_op);
 
       // Smart pointer to automatically delete max_pooling_op.
@@ -807,6 +831,12 @@ class MaxPoolingOperatorTester {
         }
       }
 
+      if (double_buffering()) {
+        // Run the second time on different buffers, as if the caller alternated between two sets of buffers.
+        std::vector<float>(input.size()).swap(input);
+        std::vector<float>(output.size()).swap(output);
+      }
+
       // Re-generate data for the second run.
       std::generate(input.begin(), input.end(), std::ref(f32rng));
       std::fill(output.begin(), output.end(), 0xA5);
@@ -885,5 +915,7 @@ class MaxPoolingOperatorTester {
   size_t next_batch_size_{0};
   uint8_t qmin_{0};
   uint8_t qmax_{255};
+  bool compact_indirection_{false};
+  bool double_buffering_{false};
   size_t iterations_{1};
 };
@@ -745,6 +745,129 @@ TEST(MAX_POOLING_OP_U8, setup_swap_height_and_width) {
     .TestSetupU8();
 }
 
+TEST(MAX_POOLING_OP_U8, setup_double_buffering) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  MaxPoolingOperatorTester()
+    .batch_size(3)
+    .input_height(8)
+    .input_width(8)
+    .pooling_height(5)
+    .pooling_width(3)
+    .channels(24)
+    .double_buffering(true)
+    .TestSetupU8();
+}
+
+TEST(MAX_POOLING_OP_U8, setup_double_buffering_decreasing_batch) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  MaxPoolingOperatorTester()
+    .batch_size(5)
+    .next_batch_size(3)
+    .input_height(8)
+    .input_width(8)
+    .pooling_height(5)
+    .pooling_width(3)
+    .channels(24)
+    .double_buffering(true)
+    .TestSetupU8();
+}
+
+TEST(MAX_POOLING_OP_U8, setup_double_buffering_increasing_batch) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  MaxPoolingOperatorTester()
+    .batch_size(3)
+    .next_batch_size(5)
+    .input_height(8)
+    .input_width(8)
+    .pooling_height(5)
+    .pooling_width(3)
+    .channels(24)
+    .double_buffering(true)
+    .TestSetupU8();
+}
+
+TEST(MAX_POOLING_OP_U8, setup_double_buffering_small_pool) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  MaxPoolingOperatorTester()
+    .batch_size(3)
+    .input_height(8)
+    .input_width(8)
+    .pooling_height(2)
+    .pooling_width(2)
+    .channels(24)
+    .double_buffering(true)
+    .TestSetupU8();
+}
+
+TEST(MAX_POOLING_OP_U8, compact_indirection_small_pool_with_padding) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  MaxPoolingOperatorTester()
+    .batch_size(3)
+    .input_size(7, 9)
+    .padding(1)
+    .pooling_size(3)
+    .stride(2)
+    .channels(19)
+    .compact_indirection(true)
+    .TestU8();
+}
+
+TEST(MAX_POOLING_OP_U8, compact_indirection_large_pool_with_dilation) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  MaxPoolingOperatorTester()
+    .batch_size(3)
+    .input_size(19, 17)
+    .pooling_size(5, 4)
+    .dilation(2)
+    .channels(19)
+    .compact_indirection(true)
+    .TestU8();
+}
+
+TEST(MAX_POOLING_OP_U8, setup_compact_indirection) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  MaxPoolingOperatorTester()
+    .batch_size(3)
+    .next_batch_size(5)
+    .input_height(8)
+    .input_width(8)
+    .pooling_height(5)
+    .pooling_width(3)
+    .channels(24)
+    .compact_indirection(true)
+    .double_buffering(true)
+    .TestSetupU8();
+}
+
+TEST(MAX_POOLING_OP_U8, setup_compact_indirection_changing_height) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  MaxPoolingOperatorTester()
+    .batch_size(3)
+    .input_height(8)
+    .input_width(8)
+    .next_input_height(11)
+    .pooling_height(3)
+    .pooling_width(3)
+    .channels(24)
+    .compact_indirection(true)
+    .TestSetupU8();
+}
+
+TEST(MAX_POOLING_OP_U8, setup_compact_indirection_wide) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  MaxPoolingOperatorTester()
+    .batch_size(2)
+    .input_height(4)
+    .input_width(700)
+    .padding(1)
+    .pooling_height(3)
+    .pooling_width(3)
+    .stride(1)
+    .channels(5)
+    .compact_indirection(true)
+    .TestSetupU8();
+}
+
 TEST(MAX_POOLING_OP_F32, unit_batch_small_1xM_pool) {
   ASSERT_EQ(xnn_status_success, xnn_initialize());
   for (size_t channels = 1; channels <= 100; channels += 15) {
@@ -1476,3 +1599,141 @@ TEST(MAX_POOLING_OP_F32, setup_swap_height_and_width) {
     .channels(24)
     .TestSetupF32();
 }
+
+TEST(MAX_POOLING_OP_F32, setup_double_buffering) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  MaxPoolingOperatorTester()
+    .batch_size(3)
+    .input_height(8)
+    .input_width(8)
+    .pooling_height(5)
+    .pooling_width(3)
+    .channels(24)
+    .double_buffering(true)
+    .TestSetupF32();
+}
+
+TEST(MAX_POOLING_OP_F32, setup_double_buffering_decreasing_batch) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  MaxPoolingOperatorTester()
+    .batch_size(5)
+    .next_batch_size(3)
+    .input_height(8)
+    .input_width(8)
+    .pooling_height(5)
+    .pooling_width(3)
+    .channels(24)
+    .double_buffering(true)
+    .TestSetupF32();
+}
+
+TEST(MAX_POOLING_OP_F32, setup_double_buffering_increasing_batch) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  MaxPoolingOperatorTester()
+    .batch_size(3)
+    .next_batch_size(5)
+    .input_height(8)
+    .input_width(8)
+    .pooling_height(5)
+    .pooling_width(3)
+    .channels(24)
+    .double_buffering(true)
+    .TestSetupF32();
+}
+
+TEST(MAX_POOLING_OP_F32, setup_double_buffering_small_pool) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  MaxPoolingOperatorTester()
+    .batch_size(3)
+    .input_height(8)
+    .input_width(8)
+    .pooling_height(2)
+    .pooling_width(2)
+    .channels(24)
+    .double_buffering(true)
+    .TestSetupF32();
+}
+
+TEST(MAX_POOLING_OP_F32, setup_double_buffering_wide) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  MaxPoolingOperatorTester()
+    .batch_size(2)
+    .input_height(4)
+    .input_width(700)
+    .padding(1)
+    .pooling_height(3)
+    .pooling_width(3)
+    .stride(1)
+    .channels(5)
+    .double_buffering(true)
+    .TestSetupF32();
+}
+
+TEST(MAX_POOLING_OP_F32, compact_indirection_small_pool_with_padding) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  MaxPoolingOperatorTester()
+    .batch_size(3)
+    .input_size(7, 9)
+    .padding(1)
+    .pooling_size(3)
+    .stride(2)
+    .channels(19)
+    .compact_indirection(true)
+    .TestF32();
+}
+
+TEST(MAX_POOLING_OP_F32, compact_indirection_large_pool_with_dilation) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  MaxPoolingOperatorTester()
+    .batch_size(3)
+    .input_size(19, 17)
+    .pooling_size(5, 4)
+    .dilation(2)
+    .channels(19)
+    .compact_indirection(true)
+    .TestF32();
+}
+
+TEST(MAX_POOLING_OP_F32, setup_compact_indirection) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  MaxPoolingOperatorTester()
+    .batch_size(3)
+    .next_batch_size(5)
+    .input_height(8)
+    .input_width(8)
+    .pooling_height(5)
+    .pooling_width(3)
+    .channels(24)
+    .compact_indirection(true)
+    .double_buffering(true)
+    .TestSetupF32();
+}
+
+TEST(MAX_POOLING_OP_F32, setup_compact_indirection_changing_height) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  MaxPoolingOperatorTester()
+    .batch_size(3)
+    .input_height(8)
+    .input_width(8)
+    .next_input_height(11)
+    .pooling_height(3)
+    .pooling_width(3)
+    .channels(24)
+    .compact_indirection(true)
+    .TestSetupF32();
+}
+
+TEST(MAX_POOLING_OP_F32, setup_compact_indirection_wide) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  MaxPoolingOperatorTester()
+    .batch_size(2)
+    .input_height(4)
+    .input_width(700)
+    .padding(1)
+    .pooling_height(3)
+    .pooling_width(3)
+    .stride(1)
+    .channels(5)
+    .compact_indirection(true)
+    .TestSetupF32();
+}
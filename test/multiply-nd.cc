@@ -0,0 +1,649 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <gtest/gtest.h>
+
+#include "binary-elementwise-operator-tester.h"
+
+constexpr size_t kDim1 = 2;
+constexpr size_t kDim2 = 3;
+constexpr size_t kDim3 = 4;
+constexpr size_t kDim4 = 5;
+constexpr size_t kDim5 = 6;
+constexpr size_t kDim6 = 7;
+
+
+TEST(MULTIPLY_ND_Q8, 0d_x_0d) {
+  BinaryElementwiseOperatorTester()
+    .operation_type(BinaryElementwiseOperatorTester::OperationType::Multiply)
+    .TestQ8();
+}
+
+
+TEST(MULTIPLY_ND_Q8, 1d_x_0d) {
+  for (uint32_t bm1 = 0; bm1 < (uint32_t(1) << 1); bm1++) {
+    const bool input1_broadcast_dim0 = bm1 & (uint32_t(1) << 0);
+    const size_t input1_dim0 = input1_broadcast_dim0 ? 1 : kDim6;
+    BinaryElementwiseOperatorTester()
+      .operation_type(BinaryElementwiseOperatorTester::OperationType::Multiply)
+      .input1_shape({input1_dim0})
+      .TestQ8();
+  }
+}
+
+
+TEST(MULTIPLY_ND_Q8, 0d_x_1d) {
+  for (uint32_t bm2 = 0; bm2 < (uint32_t(1) << 1); bm2++) {
+    const bool input2_broadcast_dim0 = bm2 & (uint32_t(1) << 0);
+    const size_t input2_dim0 = input2_broadcast_dim0 ? 1 : kDim6;
+    BinaryElementwiseOperatorTester()
+      .operation_type(BinaryElementwiseOperatorTester::OperationType::Multiply)
+      .input2_shape({input2_dim0})
+      .TestQ8();
+  }
+}
+
+
+TEST(MULTIPLY_ND_Q8, 1d_x_1d) {
+  for (uint32_t bm1 = 0; bm1 < (uint32_t(1) << 1); bm1++) {
+    for (uint32_t bm2 = 0; bm2 < (uint32_t(1) << 1); bm2++) {
+      const bool input1_broadcast_dim0 = bm1 & (uint32_t(1) << 0);
+      const bool input2_broadcast_dim0 = bm2 & (uint32_t(1) << 0);
+      const size_t input1_dim0 = input1_broadcast_dim0 ? 1 : kDim6;
+      const size_t input2_dim0 = input2_broadcast_dim0 ? 1 : kDim6;
+      BinaryElementwiseOperatorTester()
+        .operation_type(BinaryElementwiseOperatorTester::OperationType::Multiply)
+        .input1_shape({input1_dim0})
+        .input2_shape({input2_dim0})
+        .TestQ8();
+    }
+  }
+}
+
+
+TEST(MULTIPLY_ND_Q8, 0d_x_2d) {
+  for (uint32_t bm2 = 0; bm2 < (uint32_t(1) << 2); bm2++) {
+    const bool input2_broadcast_dim0 = bm2 & (uint32_t(1) << 0);
+    const bool input2_broadcast_dim1 = bm2 & (uint32_t(1) << 1);
+    const size_t input2_dim0 = input2_broadcast_dim0 ? 1 : kDim6;
+    const size_t input2_dim1 = input2_broadcast_dim1 ? 1 : kDim5;
+    BinaryElementwiseOperatorTester()
+      .operation_type(BinaryElementwiseOperatorTester::OperationType::Multiply)
+      .input2_shape({input2_dim1, input2_dim0})
+      .TestQ8();
+  }
+}
+
+
+TEST(MULTIPLY_ND_Q8, 1d_x_2d) {
+  for (uint32_t bm1 = 0; bm1 < (uint32_t(1) << 1); bm1++) {
+    for (uint32_t bm2 = 0; bm2 < (uint32_t(1) << 2); bm2++) {
+      const bool input1_broadcast_dim0 = bm1 & (uint32_t(1) << 0);
+      const bool input2_broadcast_dim0 = bm2 & (uint32_t(1) << 0);
+      const bool input2_broadcast_dim1 = bm2 & (uint32_t(1) << 1);
+      const size_t input1_dim0 = input1_broadcast_dim0 ? 1 : kDim6;
+      const size_t input2_dim0 = input2_broadcast_dim0 ? 1 : kDim6;
+      const size_t input2_dim1 = input2_broadcast_dim1 ? 1 : kDim5;
+      BinaryElementwiseOperatorTester()
+        .operation_type(BinaryElementwiseOperatorTester::OperationType::Multiply)
+        .input1_shape({input1_dim0})
+        .input2_shape({input2_dim1, input2_dim0})
+        .TestQ8();
+    }
+  }
+}
+
+
+TEST(MULTIPLY_ND_Q8, 2d_x_0d) {
+  for (uint32_t bm1 = 0; bm1 < (uint32_t(1) << 2); bm1++) {
+    const bool input1_broadcast_dim0 = bm1 & (uint32_t(1) << 0);
+    const bool input1_broadcast_dim1 = bm1 & (uint32_t(1) << 1);
+    const size_t input1_dim0 = input1_broadcast_dim0 ? 1 : kDim6;
+    const size_t input1_dim1 = input1_broadcast_dim1 ? 1 : kDim5;
+    BinaryElementwiseOperatorTester()
+      .operation_type(BinaryElementwiseOperatorTester::OperationType::Multiply)
+      .input1_shape({input1_dim1, input1_dim0})
+      .TestQ8();
+  }
+}
+
+
+TEST(MULTIPLY_ND_Q8, 2d_x_1d) {
+  for (uint32_t bm1 = 0; bm1 < (uint32_t(1) << 2); bm1++) {
+    for (uint32_t bm2 = 0; bm2 < (uint32_t(1) << 1); bm2++) {
+      const bool input1_broadcast_dim0 = bm1 & (uint32_t(1) << 0);
+      const bool input1_broadcast_dim1 = bm1 & (uint32_t(1) << 1);
+      const bool input2_broadcast_dim0 = bm2 & (uint32_t(1) << 0);
+      const size_t input1_dim0 = input1_broadcast_dim0 ? 1 : kDim6;
+      const size_t input1_dim1 = input1_broadcast_dim1 ? 1 : kDim5;
+      const size_t input2_dim0 = input2_broadcast_dim0 ? 1 : kDim6;
+      BinaryElementwiseOperatorTester()
+        .operation_type(BinaryElementwiseOperatorTester::OperationType::Multiply)
+        .input1_shape({input1_dim1, input1_dim0})
+        .input2_shape({input2_dim0})
+        .TestQ8();
+    }
+  }
+}
+
+
+TEST(MULTIPLY_ND_Q8, 2d_x_2d) {
+  for (uint32_t bm1 = 0; bm1 < (uint32_t(1) << 2); bm1++) {
+    for (uint32_t bm2 = 0; bm2 < (uint32_t(1) << 2); bm2++) {
+      const bool input1_broadcast_dim0 = bm1 & (uint32_t(1) << 0);
+      const bool input1_broadcast_dim1 = bm1 & (uint32_t(1) << 1);
+      const bool input2_broadcast_dim0 = bm2 & (uint32_t(1) << 0);
+      const bool input2_broadcast_dim1 = bm2 & (uint32_t(1) << 1);
+      const size_t input1_dim0 = input1_broadcast_dim0 ? 1 : kDim6;
+      const size_t input1_dim1 = input1_broadcast_dim1 ? 1 : kDim5;
+      const size_t input2_dim0 = input2_broadcast_dim0 ? 1 : kDim6;
+      const size_t input2_dim1 = input2_broadcast_dim1 ? 1 : kDim5;
+      BinaryElementwiseOperatorTester()
+        .operation_type(BinaryElementwiseOperatorTester::OperationType::Multiply)
+        .input1_shape({input1_dim1, input1_dim0})
+        .input2_shape({input2_dim1, input2_dim0})
+        .TestQ8();
+    }
+  }
+}
+
+
+TEST(MULTIPLY_ND_Q8, 3d_x_3d) {
+  for (uint32_t bm1 = 0; bm1 < (uint32_t(1) << 3); bm1++) {
+    for (uint32_t bm2 = 0; bm2 < (uint32_t(1) << 3); bm2++) {
+      const bool input1_broadcast_dim0 = bm1 & (uint32_t(1) << 0);
+      const bool input1_broadcast_dim1 = bm1 & (uint32_t(1) << 1);
+      const bool input1_broadcast_dim2 = bm1 & (uint32_t(1) << 2);
+      const bool input2_broadcast_dim0 = bm2 & (uint32_t(1) << 0);
+      const bool input2_broadcast_dim1 = bm2 & (uint32_t(1) << 1);
+      const bool input2_broadcast_dim2 = bm2 & (uint32_t(1) << 2);
+      const size_t input1_dim0 = input1_broadcast_dim0 ? 1 : kDim6;
+      const size_t input1_dim1 = input1_broadcast_dim1 ? 1 : kDim5;
+      const size_t input1_dim2 = input1_broadcast_dim2 ? 1 : kDim4;
+      const size_t input2_dim0 = input2_broadcast_dim0 ? 1 : kDim6;
+      const size_t input2_dim1 = input2_broadcast_dim1 ? 1 : kDim5;
+      const size_t input2_dim2 = input2_broadcast_dim2 ? 1 : kDim4;
+      BinaryElementwiseOperatorTester()
+        .operation_type(BinaryElementwiseOperatorTester::OperationType::Multiply)
+        .input1_shape({input1_dim2, input1_dim1, input1_dim0})
+        .input2_shape({input2_dim2, input2_dim1, input2_dim0})
+        .TestQ8();
+    }
+  }
+}
+
+
+TEST(MULTIPLY_ND_Q8, 4d_x_4d) {
+  for (uint32_t bm1 = 0; bm1 < (uint32_t(1) << 4); bm1++) {
+    for (uint32_t bm2 = 0; bm2 < (uint32_t(1) << 4); bm2++) {
+      const bool input1_broadcast_dim0 = bm1 & (uint32_t(1) << 0);
+      const bool input1_broadcast_dim1 = bm1 & (uint32_t(1) << 1);
+      const bool input1_broadcast_dim2 = bm1 & (uint32_t(1) << 2);
+      const bool input1_broadcast_dim3 = bm1 & (uint32_t(1) << 3);
+      const bool input2_broadcast_dim0 = bm2 & (uint32_t(1) << 0);
+      const bool input2_broadcast_dim1 = bm2 & (uint32_t(1) << 1);
+      const bool input2_broadcast_dim2 = bm2 & (uint32_t(1) << 2);
+      const bool input2_broadcast_dim3 = bm2 & (uint32_t(1) << 3);
+      const size_t input1_dim0 = input1_broadcast_dim0 ? 1 : kDim6;
+      const size_t input1_dim1 = input1_broadcast_dim1 ? 1 : kDim5;
+      const size_t input1_dim2 = input1_broadcast_dim2 ? 1 : kDim4;
+      const size_t input1_dim3 = input1_broadcast_dim3 ? 1 : kDim3;
+      const size_t input2_dim0 = input2_broadcast_dim0 ? 1 : kDim6;
+      const size_t input2_dim1 = input2_broadcast_dim1 ? 1 : kDim5;
+      const size_t input2_dim2 = input2_broadcast_dim2 ? 1 : kDim4;
+      const size_t input2_dim3 = input2_broadcast_dim3 ? 1 : kDim3;
+      BinaryElementwiseOperatorTester()
+        .operation_type(BinaryElementwiseOperatorTester::OperationType::Multiply)
+        .input1_shape({input1_dim3, input1_dim2, input1_dim1, input1_dim0})
+        .input2_shape({input2_dim3, input2_dim2, input2_dim1, input2_dim0})
+        .TestQ8();
+    }
+  }
+}
+
+
+TEST(MULTIPLY_ND_Q8, 5d_x_5d) {
+  for (uint32_t bm1 = 0; bm1 < (uint32_t(1) << 5); bm1++) {
+    for (uint32_t bm2 = 0; bm2 < (uint32_t(1) << 5); bm2++) {
+      const bool input1_broadcast_dim0 = bm1 & (uint32_t(1) << 0);
+      const bool input1_broadcast_dim1 = bm1 & (uint32_t(1) << 1);
+      const bool input1_broadcast_dim2 = bm1 & (uint32_t(1) << 2);
+      const bool input1_broadcast_dim3 = bm1 & (uint32_t(1) << 3);
+      const bool input1_broadcast_dim4 = bm1 & (uint32_t(1) << 4);
+      const bool input2_broadcast_dim0 = bm2 & (uint32_t(1) << 0);
+      const bool input2_broadcast_dim1 = bm2 & (uint32_t(1) << 1);
+      const bool input2_broadcast_dim2 = bm2 & (uint32_t(1) << 2);
+      const bool input2_broadcast_dim3 = bm2 & (uint32_t(1) << 3);
+      const bool input2_broadcast_dim4 = bm2 & (uint32_t(1) << 4);
+      const size_t input1_dim0 = input1_broadcast_dim0 ? 1 : kDim6;
+      const size_t input1_dim1 = input1_broadcast_dim1 ? 1 : kDim5;
+      const size_t input1_dim2 = input1_broadcast_dim2 ? 1 : kDim4;
+      const size_t input1_dim3 = input1_broadcast_dim3 ? 1 : kDim3;
+      const size_t input1_dim4 = input1_broadcast_dim4 ? 1 : kDim2;
+      const size_t input2_dim0 = input2_broadcast_dim0 ? 1 : kDim6;
+      const size_t input2_dim1 = input2_broadcast_dim1 ? 1 : kDim5;
+      const size_t input2_dim2 = input2_broadcast_dim2 ? 1 : kDim4;
+      const size_t input2_dim3 = input2_broadcast_dim3 ? 1 : kDim3;
+      const size_t input2_dim4 = input2_broadcast_dim4 ? 1 : kDim2;
+      BinaryElementwiseOperatorTester()
+        .operation_type(BinaryElementwiseOperatorTester::OperationType::Multiply)
+        .input1_shape({input1_dim4, input1_dim3, input1_dim2, input1_dim1, input1_dim0})
+        .input2_shape({input2_dim4, input2_dim3, input2_dim2, input2_dim1, input2_dim0})
+        .iterations(1)
+        .TestQ8();
+    }
+  }
+}
+
+
+TEST(MULTIPLY_ND_Q8, 6d_x_6d) {
+  for (uint32_t bm1 = 0; bm1 < (uint32_t(1) << 6); bm1++) {
+    for (uint32_t bm2 = 0; bm2 < (uint32_t(1) << 6); bm2++) {
+      const bool input1_broadcast_dim0 = bm1 & (uint32_t(1) << 0);
+      const bool input1_broadcast_dim1 = bm1 & (uint32_t(1) << 1);
+      const bool input1_broadcast_dim2 = bm1 & (uint32_t(1) << 2);
+      const bool input1_broadcast_dim3 = bm1 & (uint32_t(1) << 3);
+      const bool input1_broadcast_dim4 = bm1 & (uint32_t(1) << 4);
+      const bool input1_broadcast_dim5 = bm1 & (uint32_t(1) << 5);
+      const bool input2_broadcast_dim0 = bm2 & (uint32_t(1) << 0);
+      const bool input2_broadcast_dim1 = bm2 & (uint32_t(1) << 1);
+      const bool input2_broadcast_dim2 = bm2 & (uint32_t(1) << 2);
+      const bool input2_broadcast_dim3 = bm2 & (uint32_t(1) << 3);
+      const bool input2_broadcast_dim4 = bm2 & (uint32_t(1) << 4);
+      const bool input2_broadcast_dim5 = bm2 & (uint32_t(1) << 5);
+      const size_t input1_dim0 = input1_broadcast_dim0 ? 1 : kDim6;
+      const size_t input1_dim1 = input1_broadcast_dim1 ? 1 : kDim5;
+      const size_t input1_dim2 = input1_broadcast_dim2 ? 1 : kDim4;
+      const size_t input1_dim3 = input1_broadcast_dim3 ? 1 : kDim3;
+      const size_t input1_dim4 = input1_broadcast_dim4 ? 1 : kDim2;
+      const size_t input1_dim5 = input1_broadcast_dim5 ? 1 : kDim1;
+      const size_t input2_dim0 = input2_broadcast_dim0 ? 1 : kDim6;
+      const size_t input2_dim1 = input2_broadcast_dim1 ? 1 : kDim5;
+      const size_t input2_dim2 = input2_broadcast_dim2 ? 1 : kDim4;
+      const size_t input2_dim3 = input2_broadcast_dim3 ? 1 : kDim3;
+      const size_t input2_dim4 = input2_broadcast_dim4 ? 1 : kDim2;
+      const size_t input2_dim5 = input2_broadcast_dim5 ? 1 : kDim1;
+      BinaryElementwiseOperatorTester()
+        .operation_type(BinaryElementwiseOperatorTester::OperationType::Multiply)
+        .input1_shape({input1_dim5, input1_dim4, input1_dim3, input1_dim2, input1_dim1, input1_dim0})
+        .input2_shape({input2_dim5, input2_dim4, input2_dim3, input2_dim2, input2_dim1, input2_dim0})
+        .iterations(1)
+        .TestQ8();
+    }
+  }
+}
+
+
+TEST(MULTIPLY_ND_Q8, qmin) {
+  BinaryElementwiseOperatorTester()
+    .operation_type(BinaryElementwiseOperatorTester::OperationType::Multiply)
+    .input1_shape({kDim5, kDim6})
+    .input2_shape({kDim6})
+    .qmin(128)
+    .TestQ8();
+}
+
+
+TEST(MULTIPLY_ND_Q8, qmax) {
+  BinaryElementwiseOperatorTester()
+    .operation_type(BinaryElementwiseOperatorTester::OperationType::Multiply)
+    .input1_shape({kDim5, kDim6})
+    .input2_shape({kDim6})
+    .qmax(128)
+    .TestQ8();
+}
+
+
+TEST(MULTIPLY_ND_Q8, input1_zero_point) {
+  for (int32_t input1_zero_point = 0; input1_zero_point <= 255; input1_zero_point += 51) {
+    BinaryElementwiseOperatorTester()
+      .operation_type(BinaryElementwiseOperatorTester::OperationType::Multiply)
+      .input1_shape({kDim5, kDim6})
+      .input2_shape({kDim6})
+      .input1_zero_point(uint8_t(input1_zero_point))
+      .TestQ8();
+  }
+}
+
+
+TEST(MULTIPLY_ND_Q8, input2_zero_point) {
+  for (int32_t input2_zero_point = 0; input2_zero_point <= 255; input2_zero_point += 51) {
+    BinaryElementwiseOperatorTester()
+      .operation_type(BinaryElementwiseOperatorTester::OperationType::Multiply)
+      .input1_shape({kDim5, kDim6})
+      .input2_shape({kDim6})
+      .input2_zero_point(uint8_t(input2_zero_point))
+      .TestQ8();
+  }
+}
+
+
+TEST(MULTIPLY_ND_Q8, output_zero_point) {
+  for (int32_t output_zero_point = 0; output_zero_point <= 255; output_zero_point += 51) {
+    BinaryElementwiseOperatorTester()
+      .operation_type(BinaryElementwiseOperatorTester::OperationType::Multiply)
+      .input1_shape({kDim5, kDim6})
+      .input2_shape({kDim6})
+      .output_zero_point(uint8_t(output_zero_point))
+      .TestQ8();
+  }
+}
+
+
+TEST(MULTIPLY_ND_Q8, input1_scale) {
+  for (float input1_scale = 0.1f; input1_scale < 1.0f; input1_scale *= 1.7f) {
+    BinaryElementwiseOperatorTester()
+      .operation_type(BinaryElementwiseOperatorTester::OperationType::Multiply)
+      .input1_shape({kDim5, kDim6})
+      .input2_shape({kDim6})
+      .input1_scale(input1_scale)
+      .TestQ8();
+  }
+}
+
+
+TEST(MULTIPLY_ND_Q8, input2_scale) {
+  for (float input2_scale = 0.1f; input2_scale < 1.0f; input2_scale *= 1.7f) {
+    BinaryElementwiseOperatorTester()
+      .operation_type(BinaryElementwiseOperatorTester::OperationType::Multiply)
+      .input1_shape({kDim5, kDim6})
+      .input2_shape({kDim6})
+      .input2_scale(input2_scale)
+      .TestQ8();
+  }
+}
+
+
+TEST(MULTIPLY_ND_Q8, output_scale) {
+  for (float output_scale = 1.0f; output_scale < 100.0f; output_scale *= 1.7f) {
+    BinaryElementwiseOperatorTester()
+      .operation_type(BinaryElementwiseOperatorTester::OperationType::Multiply)
+      .input1_shape({kDim5, kDim6})
+      .input2_shape({kDim6})
+      .output_scale(output_scale)
+      .TestQ8();
+  }
+}
+
+
+TEST(MULTIPLY_ND_F32, 0d_x_0d) {
+  BinaryElementwiseOperatorTester()
+    .operation_type(BinaryElementwiseOperatorTester::OperationType::Multiply)
+    .TestF32();
+}
+
+
+TEST(MULTIPLY_ND_F32, 1d_x_0d) {
+  for (uint32_t bm1 = 0; bm1 < (uint32_t(1) << 1); bm1++) {
+    const bool input1_broadcast_dim0 = bm1 & (uint32_t(1) << 0);
+    const size_t input1_dim0 = input1_broadcast_dim0 ? 1 : kDim6;
+    BinaryElementwiseOperatorTester()
+      .operation_type(BinaryElementwiseOperatorTester::OperationType::Multiply)
+      .input1_shape({input1_dim0})
+      .TestF32();
+  }
+}
+
+
+TEST(MULTIPLY_ND_F32, 0d_x_1d) {
+  for (uint32_t bm2 = 0; bm2 < (uint32_t(1) << 1); bm2++) {
+    const bool input2_broadcast_dim0 = bm2 & (uint32_t(1) << 0);
+    const size_t input2_dim0 = input2_broadcast_dim0 ? 1 : kDim6;
+    BinaryElementwiseOperatorTester()
+      .operation_type(BinaryElementwiseOperatorTester::OperationType::Multiply)
+      .input2_shape({input2_dim0})
+      .TestF32();
+  }
+}
+
+
+TEST(MULTIPLY_ND_F32, 1d_x_1d) {
+  for (uint32_t bm1 = 0; bm1 < (uint32_t(1) << 1); bm1++) {
+    for (uint32_t bm2 = 0; bm2 < (uint32_t(1) << 1); bm2++) {
+      const bool input1_broadcast_dim0 = bm1 & (uint32_t(1) << 0);
+      const bool input2_broadcast_dim0 = bm2 & (uint32_t(1) << 0);
+      const size_t input1_dim0 = input1_broadcast_dim0 ? 1 : kDim6;
+      const size_t input2_dim0 = input2_broadcast_dim0 ? 1 : kDim6;
+      BinaryElementwiseOperatorTester()
+        .operation_type(BinaryElementwiseOperatorTester::OperationType::Multiply)
+        .input1_shape({input1_dim0})
+        .input2_shape({input2_dim0})
+        .TestF32();
+    }
+  }
+}
+
+
+TEST(MULTIPLY_ND_F32, 0d_x_2d) {
+  for (uint32_t bm2 = 0; bm2 < (uint32_t(1) << 2); bm2++) {
+    const bool input2_broadcast_dim0 = bm2 & (uint32_t(1) << 0);
+    const bool input2_broadcast_dim1 = bm2 & (uint32_t(1) << 1);
+    const size_t input2_dim0 = input2_broadcast_dim0 ? 1 : kDim6;
+    const size_t input2_dim1 = input2_broadcast_dim1 ? 1 : kDim5;
+    BinaryElementwiseOperatorTester()
+      .operation_type(BinaryElementwiseOperatorTester::OperationType::Multiply)
+      .input2_shape({input2_dim1, input2_dim0})
+      .TestF32();
+  }
+}
+
+
+TEST(MULTIPLY_ND_F32, 1d_x_2d) {
+  for (uint32_t bm1 = 0; bm1 < (uint32_t(1) << 1); bm1++) {
+    for (uint32_t bm2 = 0; bm2 < (uint32_t(1) << 2); bm2++) {
+      const bool input1_broadcast_dim0 = bm1 & (uint32_t(1) << 0);
+      const bool input2_broadcast_dim0 = bm2 & (uint32_t(1) << 0);
+      const bool input2_broadcast_dim1 = bm2 & (uint32_t(1) << 1);
+      const size_t input1_dim0 = input1_broadcast_dim0 ? 1 : kDim6;
+      const size_t input2_dim0 = input2_broadcast_dim0 ? 1 : kDim6;
+      const size_t input2_dim1 = input2_broadcast_dim1 ? 1 : kDim5;
+      BinaryElementwiseOperatorTester()
+        .operation_type(BinaryElementwiseOperatorTester::OperationType::Multiply)
+        .input1_shape({input1_dim0})
+        .input2_shape({input2_dim1, input2_dim0})
+        .TestF32();
+    }
+  }
+}
+
+
+TEST(MULTIPLY_ND_F32, 2d_x_0d) {
+  for (uint32_t bm1 = 0; bm1 < (uint32_t(1) << 2); bm1++) {
+    const bool input1_broadcast_dim0 = bm1 & (uint32_t(1) << 0);
+    const bool input1_broadcast_dim1 = bm1 & (uint32_t(1) << 1);
+    const size_t input1_dim0 = input1_broadcast_dim0 ? 1 : kDim6;
+    const size_t input1_dim1 = input1_broadcast_dim1 ? 1 : kDim5;
+    BinaryElementwiseOperatorTester()
+      .operation_type(BinaryElementwiseOperatorTester::OperationType::Multiply)
+      .input1_shape({input1_dim1, input1_dim0})
+      .TestF32();
+  }
+}
+
+
+TEST(MULTIPLY_ND_F32, 2d_x_1d) {
+  for (uint32_t bm1 = 0; bm1 < (uint32_t(1) << 2); bm1++) {
+    for (uint32_t bm2 = 0; bm2 < (uint32_t(1) << 1); bm2++) {
+      const bool input1_broadcast_dim0 = bm1 & (uint32_t(1) << 0);
+      const bool input1_broadcast_dim1 = bm1 & (uint32_t(1) << 1);
+      const bool input2_broadcast_dim0 = bm2 & (uint32_t(1) << 0);
+      const size_t input1_dim0 = input1_broadcast_dim0 ? 1 : kDim6;
+      const size_t input1_dim1 = input1_broadcast_dim1 ? 1 : kDim5;
+      const size_t input2_dim0 = input2_broadcast_dim0 ? 1 : kDim6;
+      BinaryElementwiseOperatorTester()
+        .operation_type(BinaryElementwiseOperatorTester::OperationType::Multiply)
+        .input1_shape({input1_dim1, input1_dim0})
+        .input2_shape({input2_dim0})
+        .TestF32();
+    }
+  }
+}
+
+
+TEST(MULTIPLY_ND_F32, 2d_x_2d) {
+  for (uint32_t bm1 = 0; bm1 < (uint32_t(1) << 2); bm1++) {
+    for (uint32_t bm2 = 0; bm2 < (uint32_t(1) << 2); bm2++) {
+      const bool input1_broadcast_dim0 = bm1 & (uint32_t(1) << 0);
+      const bool input1_broadcast_dim1 = bm1 & (uint32_t(1) << 1);
+      const bool input2_broadcast_dim0 = bm2 & (uint32_t(1) << 0);
+      const bool input2_broadcast_dim1 = bm2 & (uint32_t(1) << 1);
+      const size_t input1_dim0 = input1_broadcast_dim0 ? 1 : kDim6;
+      const size_t input1_dim1 = input1_broadcast_dim1 ? 1 : kDim5;
+      const size_t input2_dim0 = input2_broadcast_dim0 ? 1 : kDim6;
+      const size_t input2_dim1 = input2_broadcast_dim1 ? 1 : kDim5;
+      BinaryElementwiseOperatorTester()
+        .operation_type(BinaryElementwiseOperatorTester::OperationType::Multiply)
+        .input1_shape({input1_dim1, input1_dim0})
+        .input2_shape({input2_dim1, input2_dim0})
+        .TestF32();
+    }
+  }
+}
+
+
+TEST(MULTIPLY_ND_F32, 3d_x_3d) {
+  for (uint32_t bm1 = 0; bm1 < (uint32_t(1) << 3); bm1++) {
+    for (uint32_t bm2 = 0; bm2 < (uint32_t(1) << 3); bm2++) {
+      const bool input1_broadcast_dim0 = bm1 & (uint32_t(1) << 0);
+      const bool input1_broadcast_dim1 = bm1 & (uint32_t(1) << 1);
+      const bool input1_broadcast_dim2 = bm1 & (uint32_t(1) << 2);
+      const bool input2_broadcast_dim0 = bm2 & (uint32_t(1) << 0);
+      const bool input2_broadcast_dim1 = bm2 & (uint32_t(1) << 1);
+      const bool input2_broadcast_dim2 = bm2 & (uint32_t(1) << 2);
+      const size_t input1_dim0 = input1_broadcast_dim0 ? 1 : kDim6;
+      const size_t input1_dim1 = input1_broadcast_dim1 ? 1 : kDim5;
+      const size_t input1_dim2 = input1_broadcast_dim2 ? 1 : kDim4;
+      const size_t input2_dim0 = input2_broadcast_dim0 ? 1 : kDim6;
+      const size_t input2_dim1 = input2_broadcast_dim1 ? 1 : kDim5;
+      const size_t input2_dim2 = input2_broadcast_dim2 ? 1 : kDim4;
+      BinaryElementwiseOperatorTester()
+        .operation_type(BinaryElementwiseOperatorTester::OperationType::Multiply)
+        .input1_shape({input1_dim2, input1_dim1, input1_dim0})
+        .input2_shape({input2_dim2, input2_dim1, input2_dim0})
+        .TestF32();
+    }
+  }
+}
+
+
+TEST(MULTIPLY_ND_F32, 4d_x_4d) {
+  for (uint32_t bm1 = 0; bm1 < (uint32_t(1) << 4); bm1++) {
+    for (uint32_t bm2 = 0; bm2 < (uint32_t(1) << 4); bm2++) {
+      const bool input1_broadcast_dim0 = bm1 & (uint32_t(1) << 0);
+      const bool input1_broadcast_dim1 = bm1 & (uint32_t(1) << 1);
+      const bool input1_broadcast_dim2 = bm1 & (uint32_t(1) << 2);
+      const bool input1_broadcast_dim3 = bm1 & (uint32_t(1) << 3);
+      const bool input2_broadcast_dim0 = bm2 & (uint32_t(1) << 0);
+      const bool input2_broadcast_dim1 = bm2 & (uint32_t(1) << 1);
+      const bool input2_broadcast_dim2 = bm2 & (uint32_t(1) << 2);
+      const bool input2_broadcast_dim3 = bm2 & (uint32_t(1) << 3);
+      const size_t input1_dim0 = input1_broadcast_dim0 ? 1 : kDim6;
+      const size_t input1_dim1 = input1_broadcast_dim1 ? 1 : kDim5;
+      const size_t input1_dim2 = input1_broadcast_dim2 ? 1 : kDim4;
+      const size_t input1_dim3 = input1_broadcast_dim3 ? 1 : kDim3;
+      const size_t input2_dim0 = input2_broadcast_dim0 ? 1 : kDim6;
+      const size_t input2_dim1 = input2_broadcast_dim1 ? 1 : kDim5;
+      const size_t input2_dim2 = input2_broadcast_dim2 ? 1 : kDim4;
+      const size_t input2_dim3 = input2_broadcast_dim3 ? 1 : kDim3;
+      BinaryElementwiseOperatorTester()
+        .operation_type(BinaryElementwiseOperatorTester::OperationType::Multiply)
+        .input1_shape({input1_dim3, input1_dim2, input1_dim1, input1_dim0})
+        .input2_shape({input2_dim3, input2_dim2, input2_dim1, input2_dim0})
+        .TestF32();
+    }
+  }
+}
+
+
+TEST(MULTIPLY_ND_F32, 5d_x_5d) {
+  for (uint32_t bm1 = 0; bm1 < (uint32_t(1) << 5); bm1++) {
+    for (uint32_t bm2 = 0; bm2 < (uint32_t(1) << 5); bm2++) {
+      const bool input1_broadcast_dim0 = bm1 & (uint32_t(1) << 0);
+      const bool input1_broadcast_dim1 = bm1 & (uint32_t(1) << 1);
+      const bool input1_broadcast_dim2 = bm1 & (uint32_t(1) << 2);
+      const bool input1_broadcast_dim3 = bm1 & (uint32_t(1) << 3);
+      const bool input1_broadcast_dim4 = bm1 & (uint32_t(1) << 4);
+      const bool input2_broadcast_dim0 = bm2 & (uint32_t(1) << 0);
+      const bool input2_broadcast_dim1 = bm2 & (uint32_t(1) << 1);
+      const bool input2_broadcast_dim2 = bm2 & (uint32_t(1) << 2);
+      const bool input2_broadcast_dim3 = bm2 & (uint32_t(1) << 3);
+      const bool input2_broadcast_dim4 = bm2 & (uint32_t(1) << 4);
+      const size_t input1_dim0 = input1_broadcast_dim0 ? 1 : kDim6;
+      const size_t input1_dim1 = input1_broadcast_dim1 ? 1 : kDim5;
+      const size_t input1_dim2 = input1_broadcast_dim2 ? 1 : kDim4;
+      const size_t input1_dim3 = input1_broadcast_dim3 ? 1 : kDim3;
+      const size_t input1_dim4 = input1_broadcast_dim4 ? 1 : kDim2;
+      const size_t input2_dim0 = input2_broadcast_dim0 ? 1 : kDim6;
+      const size_t input2_dim1 = input2_broadcast_dim1 ? 1 : kDim5;
+      const size_t input2_dim2 = input2_broadcast_dim2 ? 1 : kDim4;
+      const size_t input2_dim3 = input2_broadcast_dim3 ? 1 : kDim3;
+      const size_t input2_dim4 = input2_broadcast_dim4 ? 1 : kDim2;
+      BinaryElementwiseOperatorTester()
+        .operation_type(BinaryElementwiseOperatorTester::OperationType::Multiply)
+        .input1_shape({input1_dim4, input1_dim3, input1_dim2, input1_dim1, input1_dim0})
+        .input2_shape({input2_dim4, input2_dim3, input2_dim2, input2_dim1, input2_dim0})
+        .iterations(1)
+        .TestF32();
+    }
+  }
+}
+
+
+TEST(MULTIPLY_ND_F32, 6d_x_6d) {
+  for (uint32_t bm1 = 0; bm1 < (uint32_t(1) << 6); bm1++) {
+    for (uint32_t bm2 = 0; bm2 < (uint32_t(1) << 6); bm2++) {
+      const bool input1_broadcast_dim0 = bm1 & (uint32_t(1) << 0);
+      const bool input1_broadcast_dim1 = bm1 & (uint32_t(1) << 1);
+      const bool input1_broadcast_dim2 = bm1 & (uint32_t(1) << 2);
+      const bool input1_broadcast_dim3 = bm1 & (uint32_t(1) << 3);
+      const bool input1_broadcast_dim4 = bm1 & (uint32_t(1) << 4);
+      const bool input1_broadcast_dim5 = bm1 & (uint32_t(1) << 5);
+      const bool input2_broadcast_dim0 = bm2 & (uint32_t(1) << 0);
+      const bool input2_broadcast_dim1 = bm2 & (uint32_t(1) << 1);
+      const bool input2_broadcast_dim2 = bm2 & (uint32_t(1) << 2);
+      const bool input2_broadcast_dim3 = bm2 & (uint32_t(1) << 3);
+      const bool input2_broadcast_dim4 = bm2 & (uint32_t(1) << 4);
+      const bool input2_broadcast_dim5 = bm2 & (uint32_t(1) << 5);
+      const size_t input1_dim0 = input1_broadcast_dim0 ? 1 : kDim6;
+      const size_t input1_dim1 = input1_broadcast_dim1 ? 1 : kDim5;
+      const size_t input1_dim2 = input1_broadcast_dim2 ? 1 : kDim4;
+      const size_t input1_dim3 = input1_broadcast_dim3 ? 1 : kDim3;
+      const size_t input1_dim4 = input1_broadcast_dim4 ? 1 : kDim2;
+      const size_t input1_dim5 = input1_broadcast_dim5 ? 1 : kDim1;
+      const size_t input2_dim0 = input2_broadcast_dim0 ? 1 : kDim6;
+      const size_t input2_dim1 = input2_broadcast_dim1 ? 1 : kDim5;
+      const size_t input2_dim2 = input2_broadcast_dim2 ? 1 : kDim4;
+      const size_t input2_dim3 = input2_broadcast_dim3 ? 1 : kDim3;
+      const size_t input2_dim4 = input2_broadcast_dim4 ? 1 : kDim2;
+      const size_t input2_dim5 = input2_broadcast_dim5 ? 1 : kDim1;
+      BinaryElementwiseOperatorTester()
+        .operation_type(BinaryElementwiseOperatorTester::OperationType::Multiply)
+        .input1_shape({input1_dim5, input1_dim4, input1_dim3, input1_dim2, input1_dim1, input1_dim0})
+        .input2_shape({input2_dim5, input2_dim4, input2_dim3, input2_dim2, input2_dim1, input2_dim0})
+        .iterations(1)
+        .TestF32();
+    }
+  }
+}
+
+
+TEST(MULTIPLY_ND_F32, qmin) {
+  BinaryElementwiseOperatorTester()
+    .operation_type(BinaryElementwiseOperatorTester::OperationType::Multiply)
+    .input1_shape({kDim5, kDim6})
+    .input2_shape({kDim6})
+    .qmin(128)
+    .TestF32();
+}
+
+
+TEST(MULTIPLY_ND_F32, qmax) {
+  BinaryElementwiseOperatorTester()
+    .operation_type(BinaryElementwiseOperatorTester::OperationType::Multiply)
+    .input1_shape({kDim5, kDim6})
+    .input2_shape({kDim6})
+    .qmax(128)
+    .TestF32();
+}
@@ -394,28 +394,465 @@
 #endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
 
 
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  TEST(Q8_DWCONV_MP8X4__NEON, c_eq_8) {
+    TEST_REQUIRES_ARM_NEON;
+    DWConvMicrokernelTester()
+      .cr(8)
+      .kr(9)
+      .channels(8)
+      .Test(xnn_q8_dwconv_ukernel_mp8x4__neon);
+  }
+
+  TEST(Q8_DWCONV_MP8X4__NEON, c_div_8) {
+    TEST_REQUIRES_ARM_NEON;
+    for (uint32_t channels = 16; channels < 128; channels += 24) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(channels)
+        .Test(xnn_q8_dwconv_ukernel_mp8x4__neon);
+    }
+  }
+
+  TEST(Q8_DWCONV_MP8X4__NEON, c_div_8_with_qmin) {
+    TEST_REQUIRES_ARM_NEON;
+    for (uint32_t channels = 16; channels < 128; channels += 24) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(channels)
+        .qmin(128)
+        .Test(xnn_q8_dwconv_ukernel_mp8x4__neon);
+    }
+  }
+
+  TEST(Q8_DWCONV_MP8X4__NEON, c_div_8_with_qmax) {
+    TEST_REQUIRES_ARM_NEON;
+    for (uint32_t channels = 16; channels < 128; channels += 24) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(channels)
+        .qmax(128)
+        .Test(xnn_q8_dwconv_ukernel_mp8x4__neon);
+    }
+  }
+
+  TEST(Q8_DWCONV_MP8X4__NEON, c_lt_8) {
+    TEST_REQUIRES_ARM_NEON;
+    for (uint32_t channels = 1; channels < 8; channels++) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(channels)
+        .Test(xnn_q8_dwconv_ukernel_mp8x4__neon);
+    }
+  }
+
+  TEST(Q8_DWCONV_MP8X4__NEON, c_gt_8) {
+    TEST_REQUIRES_ARM_NEON;
+    for (uint32_t channels = 9; channels < 16; channels++) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(channels)
+        .Test(xnn_q8_dwconv_ukernel_mp8x4__neon);
+    }
+  }
+
+  TEST(Q8_DWCONV_MP8X4__NEON, c_gt_8_with_qmin) {
+    TEST_REQUIRES_ARM_NEON;
+    for (uint32_t channels = 9; channels < 16; channels++) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(channels)
+        .qmin(128)
+        .Test(xnn_q8_dwconv_ukernel_mp8x4__neon);
+    }
+  }
+
+  TEST(Q8_DWCONV_MP8X4__NEON, c_gt_8_with_qmax) {
+    TEST_REQUIRES_ARM_NEON;
+    for (uint32_t channels = 9; channels < 16; channels++) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(channels)
+        .qmax(128)
+        .Test(xnn_q8_dwconv_ukernel_mp8x4__neon);
+    }
+  }
+
+  TEST(Q8_DWCONV_MP8X4__NEON, multipixel) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(channels)
+        .width(3)
+        .Test(xnn_q8_dwconv_ukernel_mp8x4__neon);
+    }
+  }
+
+  TEST(Q8_DWCONV_MP8X4__NEON, multipixel_with_step) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      for (size_t step = 2; step <= 9; step++) {
+        DWConvMicrokernelTester()
+          .cr(8)
+          .kr(9)
+          .channels(channels)
+          .width(3)
+          .step(step)
+          .Test(xnn_q8_dwconv_ukernel_mp8x4__neon);
+      }
+    }
+  }
+
+  TEST(Q8_DWCONV_MP8X4__NEON, multipixel_with_output_stride) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(8)
+        .width(5)
+        .output_stride(43)
+        .Test(xnn_q8_dwconv_ukernel_mp8x4__neon);
+    }
+  }
+
+  TEST(Q8_DWCONV_MP8X4__NEON, multipixel_with_qmin) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(channels)
+        .width(3)
+        .qmin(128)
+        .Test(xnn_q8_dwconv_ukernel_mp8x4__neon);
+    }
+  }
+
+  TEST(Q8_DWCONV_MP8X4__NEON, multipixel_with_qmax) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(channels)
+        .width(3)
+        .qmax(128)
+        .Test(xnn_q8_dwconv_ukernel_mp8x4__neon);
+    }
+  }
+
+  TEST(Q8_DWCONV_MP8X4__NEON, kernel_size_lt_4) {
+    TEST_REQUIRES_ARM_NEON;
+    for (uint32_t kernel_size = 1; kernel_size < 4; kernel_size++) {
+      for (uint32_t channels = 1; channels <= 24; channels += 7) {
+        DWConvMicrokernelTester()
+          .cr(8)
+          .kr(kernel_size)
+          .channels(channels)
+          .Test(xnn_q8_dwconv_ukernel_mp8x4__neon);
+      }
+    }
+  }
+
+  TEST(Q8_DWCONV_MP8X4__NEON, kernel_size_eq_4) {
+    TEST_REQUIRES_ARM_NEON;
+    for (uint32_t channels = 1; channels <= 24; channels += 7) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(4)
+        .channels(channels)
+        .Test(xnn_q8_dwconv_ukernel_mp8x4__neon);
+    }
+  }
+
+  TEST(Q8_DWCONV_MP8X4__NEON, kernel_size_div_4) {
+    TEST_REQUIRES_ARM_NEON;
+    for (uint32_t kernel_size = 8; kernel_size <= 16; kernel_size += 4) {
+      for (uint32_t channels = 1; channels <= 24; channels += 7) {
+        DWConvMicrokernelTester()
+          .cr(8)
+          .kr(kernel_size)
+          .channels(channels)
+          .Test(xnn_q8_dwconv_ukernel_mp8x4__neon);
+      }
+    }
+  }
+
+  TEST(Q8_DWCONV_MP8X4__NEON, kernel_size_gt_4) {
+    TEST_REQUIRES_ARM_NEON;
+    for (uint32_t kernel_size = 5; kernel_size < 8; kernel_size++) {
+      for (uint32_t channels = 1; channels <= 24; channels += 7) {
+        DWConvMicrokernelTester()
+          .cr(8)
+          .kr(kernel_size)
+          .channels(channels)
+          .Test(xnn_q8_dwconv_ukernel_mp8x4__neon);
+      }
+    }
+  }
+
+  TEST(Q8_DWCONV_MP8X4__NEON, kernel_size_eq_49) {
+    TEST_REQUIRES_ARM_NEON;
+    for (uint32_t channels = 1; channels <= 24; channels += 7) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(49)
+        .channels(channels)
+        .width(3)
+        .step(7)
+        .Test(xnn_q8_dwconv_ukernel_mp8x4__neon);
+    }
+  }
+
+  TEST(Q8_DWCONV_MP8X4__NEON, input_zero_point_only) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(channels)
+        .width(3)
+        .input_zero_point(255)
+        .kernel_zero_point(0)
+        .Test(xnn_q8_dwconv_ukernel_mp8x4__neon);
+    }
+  }
+
+  TEST(Q8_DWCONV_MP8X4__NEON, kernel_zero_point_only) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(channels)
+        .width(3)
+        .input_zero_point(0)
+        .kernel_zero_point(255)
+        .Test(xnn_q8_dwconv_ukernel_mp8x4__neon);
+    }
+  }
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(Q8_DWCONV_UP8X9__SSE2, c_eq_8) {
+    TEST_REQUIRES_X86_SSE2;
+    DWConvMicrokernelTester()
+      .cr(8)
+      .kr(9)
+      .channels(8)
+      .Test(xnn_q8_dwconv_ukernel_up8x9__sse2);
+  }
+
+  TEST(Q8_DWCONV_UP8X9__SSE2, c_div_8) {
+    TEST_REQUIRES_X86_SSE2;
+    for (uint32_t channels = 16; channels < 128; channels += 24) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(channels)
+        .Test(xnn_q8_dwconv_ukernel_up8x9__sse2);
+    }
+  }
+
+  TEST(Q8_DWCONV_UP8X9__SSE2, c_div_8_with_qmin) {
+    TEST_REQUIRES_X86_SSE2;
+    for (uint32_t channels = 16; channels < 128; channels += 24) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(channels)
+        .qmin(128)
+        .Test(xnn_q8_dwconv_ukernel_up8x9__sse2);
+    }
+  }
+
+  TEST(Q8_DWCONV_UP8X9__SSE2, c_div_8_with_qmax) {
+    TEST_REQUIRES_X86_SSE2;
+    for (uint32_t channels = 16; channels < 128; channels += 24) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(channels)
+        .qmax(128)
+        .Test(xnn_q8_dwconv_ukernel_up8x9__sse2);
+    }
+  }
+
+  TEST(Q8_DWCONV_UP8X9__SSE2, c_lt_8) {
+    TEST_REQUIRES_X86_SSE2;
+    for (uint32_t channels = 1; channels < 8; channels++) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(channels)
+        .Test(xnn_q8_dwconv_ukernel_up8x9__sse2);
+    }
+  }
+
+  TEST(Q8_DWCONV_UP8X9__SSE2, c_gt_8) {
+    TEST_REQUIRES_X86_SSE2;
+    for (uint32_t channels = 9; channels < 16; channels++) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(channels)
+        .Test(xnn_q8_dwconv_ukernel_up8x9__sse2);
+    }
+  }
+
+  TEST(Q8_DWCONV_UP8X9__SSE2, c_gt_8_with_qmin) {
+    TEST_REQUIRES_X86_SSE2;
+    for (uint32_t channels = 9; channels < 16; channels++) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(channels)
+        .qmin(128)
+        .Test(xnn_q8_dwconv_ukernel_up8x9__sse2);
+    }
+  }
+
+  TEST(Q8_DWCONV_UP8X9__SSE2, c_gt_8_with_qmax) {
+    TEST_REQUIRES_X86_SSE2;
+    for (uint32_t channels = 9; channels < 16; channels++) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(channels)
+        .qmax(128)
+        .Test(xnn_q8_dwconv_ukernel_up8x9__sse2);
+    }
+  }
+
+  TEST(Q8_DWCONV_UP8X9__SSE2, multipixel) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(channels)
+        .width(3)
+        .Test(xnn_q8_dwconv_ukernel_up8x9__sse2);
+    }
+  }
+
+  TEST(Q8_DWCONV_UP8X9__SSE2, multipixel_with_step) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      for (size_t step = 2; step <= 9; step++) {
+        DWConvMicrokernelTester()
+          .cr(8)
+          .kr(9)
+          .channels(channels)
+          .width(3)
+          .step(step)
+          .Test(xnn_q8_dwconv_ukernel_up8x9__sse2);
+      }
+    }
+  }
+
+  TEST(Q8_DWCONV_UP8X9__SSE2, multipixel_with_output_stride) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(8)
+        .width(5)
+        .output_stride(43)
+        .Test(xnn_q8_dwconv_ukernel_up8x9__sse2);
+    }
+  }
+
+  TEST(Q8_DWCONV_UP8X9__SSE2, multipixel_with_qmin) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(channels)
+        .width(3)
+        .qmin(128)
+        .Test(xnn_q8_dwconv_ukernel_up8x9__sse2);
+    }
+  }
+
+  TEST(Q8_DWCONV_UP8X9__SSE2, multipixel_with_qmax) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(channels)
+        .width(3)
+        .qmax(128)
+        .Test(xnn_q8_dwconv_ukernel_up8x9__sse2);
+    }
+  }
+
+  TEST(Q8_DWCONV_UP8X9__SSE2, input_zero_point_only) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(channels)
+        .width(3)
+        .input_zero_point(255)
+        .kernel_zero_point(0)
+        .Test(xnn_q8_dwconv_ukernel_up8x9__sse2);
+    }
+  }
+
+  TEST(Q8_DWCONV_UP8X9__SSE2, kernel_zero_point_only) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(channels)
+        .width(3)
+        .input_zero_point(0)
+        .kernel_zero_point(255)
+        .Test(xnn_q8_dwconv_ukernel_up8x9__sse2);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
 #if XNN_ARCH_X86 || XNN_ARCH_X86_64
-  TEST(Q8_DWCONV_UP8X9__SSE2, c_eq_8) {
+  TEST(Q8_DWCONV_MP8X4__SSE2, c_eq_8) {
     TEST_REQUIRES_X86_SSE2;
     DWConvMicrokernelTester()
       .cr(8)
       .kr(9)
       .channels(8)
-      .Test(xnn_q8_dwconv_ukernel_up8x9__sse2);
+      .Test(xnn_q8_dwconv_ukernel_mp8x4__sse2);
   }
 
-  TEST(Q8_DWCONV_UP8X9__SSE2, c_div_8) {
+  TEST(Q8_DWCONV_MP8X4__SSE2, c_div_8) {
     TEST_REQUIRES_X86_SSE2;
     for (uint32_t channels = 16; channels < 128; channels += 24) {
       DWConvMicrokernelTester()
         .cr(8)
         .kr(9)
         .channels(channels)
-        .Test(xnn_q8_dwconv_ukernel_up8x9__sse2);
+        .Test(xnn_q8_dwconv_ukernel_mp8x4__sse2);
     }
   }
 
-  TEST(Q8_DWCONV_UP8X9__SSE2, c_div_8_with_qmin) {
+  TEST(Q8_DWCONV_MP8X4__SSE2, c_div_8_with_qmin) {
     TEST_REQUIRES_X86_SSE2;
     for (uint32_t channels = 16; channels < 128; channels += 24) {
       DWConvMicrokernelTester()
@@ -423,11 +860,11 @@
         .kr(9)
         .channels(channels)
         .qmin(128)
-        .Test(xnn_q8_dwconv_ukernel_up8x9__sse2);
+        .Test(xnn_q8_dwconv_ukernel_mp8x4__sse2);
     }
   }
 
-  TEST(Q8_DWCONV_UP8X9__SSE2, c_div_8_with_qmax) {
+  TEST(Q8_DWCONV_MP8X4__SSE2, c_div_8_with_qmax) {
     TEST_REQUIRES_X86_SSE2;
     for (uint32_t channels = 16; channels < 128; channels += 24) {
       DWConvMicrokernelTester()
@@ -435,33 +872,33 @@
         .kr(9)
         .channels(channels)
         .qmax(128)
-        .Test(xnn_q8_dwconv_ukernel_up8x9__sse2);
+        .Test(xnn_q8_dwconv_ukernel_mp8x4__sse2);
     }
   }
 
-  TEST(Q8_DWCONV_UP8X9__SSE2, c_lt_8) {
+  TEST(Q8_DWCONV_MP8X4__SSE2, c_lt_8) {
     TEST_REQUIRES_X86_SSE2;
     for (uint32_t channels = 1; channels < 8; channels++) {
       DWConvMicrokernelTester()
         .cr(8)
         .kr(9)
         .channels(channels)
-        .Test(xnn_q8_dwconv_ukernel_up8x9__sse2);
+        .Test(xnn_q8_dwconv_ukernel_mp8x4__sse2);
     }
   }
 
-  TEST(Q8_DWCONV_UP8X9__SSE2, c_gt_8) {
+  TEST(Q8_DWCONV_MP8X4__SSE2, c_gt_8) {
     TEST_REQUIRES_X86_SSE2;
     for (uint32_t channels = 9; channels < 16; channels++) {
       DWConvMicrokernelTester()
         .cr(8)
         .kr(9)
         .channels(channels)
-        .Test(xnn_q8_dwconv_ukernel_up8x9__sse2);
+        .Test(xnn_q8_dwconv_ukernel_mp8x4__sse2);
     }
   }
 
-  TEST(Q8_DWCONV_UP8X9__SSE2, c_gt_8_with_qmin) {
+  TEST(Q8_DWCONV_MP8X4__SSE2, c_gt_8_with_qmin) {
     TEST_REQUIRES_X86_SSE2;
     for (uint32_t channels = 9; channels < 16; channels++) {
       DWConvMicrokernelTester()
@@ -469,11 +906,11 @@
         .kr(9)
         .channels(channels)
         .qmin(128)
-        .Test(xnn_q8_dwconv_ukernel_up8x9__sse2);
+        .Test(xnn_q8_dwconv_ukernel_mp8x4__sse2);
     }
   }
 
-  TEST(Q8_DWCONV_UP8X9__SSE2, c_gt_8_with_qmax) {
+  TEST(Q8_DWCONV_MP8X4__SSE2, c_gt_8_with_qmax) {
     TEST_REQUIRES_X86_SSE2;
     for (uint32_t channels = 9; channels < 16; channels++) {
       DWConvMicrokernelTester()
@@ -481,11 +918,11 @@
         .kr(9)
         .channels(channels)
         .qmax(128)
-        .Test(xnn_q8_dwconv_ukernel_up8x9__sse2);
+        .Test(xnn_q8_dwconv_ukernel_mp8x4__sse2);
     }
   }
 
-  TEST(Q8_DWCONV_UP8X9__SSE2, multipixel) {
+  TEST(Q8_DWCONV_MP8X4__SSE2, multipixel) {
     TEST_REQUIRES_X86_SSE2;
     for (size_t channels = 1; channels <= 40; channels += 7) {
       DWConvMicrokernelTester()
@@ -493,11 +930,11 @@
         .kr(9)
         .channels(channels)
         .width(3)
-        .Test(xnn_q8_dwconv_ukernel_up8x9__sse2);
+        .Test(xnn_q8_dwconv_ukernel_mp8x4__sse2);
     }
   }
 
-  TEST(Q8_DWCONV_UP8X9__SSE2, multipixel_with_step) {
+  TEST(Q8_DWCONV_MP8X4__SSE2, multipixel_with_step) {
     TEST_REQUIRES_X86_SSE2;
     for (size_t channels = 1; channels <= 40; channels += 7) {
       for (size_t step = 2; step <= 9; step++) {
@@ -507,12 +944,12 @@
           .channels(channels)
           .width(3)
           .step(step)
-          .Test(xnn_q8_dwconv_ukernel_up8x9__sse2);
+          .Test(xnn_q8_dwconv_ukernel_mp8x4__sse2);
       }
     }
   }
 
-  TEST(Q8_DWCONV_UP8X9__SSE2, multipixel_with_output_stride) {
+  TEST(Q8_DWCONV_MP8X4__SSE2, multipixel_with_output_stride) {
     TEST_REQUIRES_X86_SSE2;
     for (size_t channels = 1; channels <= 40; channels += 7) {
       DWConvMicrokernelTester()
@@ -521,11 +958,11 @@
         .channels(8)
         .width(5)
         .output_stride(43)
-        .Test(xnn_q8_dwconv_ukernel_up8x9__sse2);
+        .Test(xnn_q8_dwconv_ukernel_mp8x4__sse2);
     }
   }
 
-  TEST(Q8_DWCONV_UP8X9__SSE2, multipixel_with_qmin) {
+  TEST(Q8_DWCONV_MP8X4__SSE2, multipixel_with_qmin) {
     TEST_REQUIRES_X86_SSE2;
     for (size_t channels = 1; channels <= 40; channels += 7) {
       DWConvMicrokernelTester()
@@ -534,11 +971,11 @@
         .channels(channels)
         .width(3)
         .qmin(128)
-        .Test(xnn_q8_dwconv_ukernel_up8x9__sse2);
+        .Test(xnn_q8_dwconv_ukernel_mp8x4__sse2);
     }
   }
 
-  TEST(Q8_DWCONV_UP8X9__SSE2, multipixel_with_qmax) {
+  TEST(Q8_DWCONV_MP8X4__SSE2, multipixel_with_qmax) {
     TEST_REQUIRES_X86_SSE2;
     for (size_t channels = 1; channels <= 40; channels += 7) {
       DWConvMicrokernelTester()
@@ -547,11 +984,74 @@
         .channels(channels)
         .width(3)
         .qmax(128)
-        .Test(xnn_q8_dwconv_ukernel_up8x9__sse2);
+        .Test(xnn_q8_dwconv_ukernel_mp8x4__sse2);
     }
   }
 
-  TEST(Q8_DWCONV_UP8X9__SSE2, input_zero_point_only) {
+  TEST(Q8_DWCONV_MP8X4__SSE2, kernel_size_lt_4) {
+    TEST_REQUIRES_X86_SSE2;
+    for (uint32_t kernel_size = 1; kernel_size < 4; kernel_size++) {
+      for (uint32_t channels = 1; channels <= 24; channels += 7) {
+        DWConvMicrokernelTester()
+          .cr(8)
+          .kr(kernel_size)
+          .channels(channels)
+          .Test(xnn_q8_dwconv_ukernel_mp8x4__sse2);
+      }
+    }
+  }
+
+  TEST(Q8_DWCONV_MP8X4__SSE2, kernel_size_eq_4) {
+    TEST_REQUIRES_X86_SSE2;
+    for (uint32_t channels = 1; channels <= 24; channels += 7) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(4)
+        .channels(channels)
+        .Test(xnn_q8_dwconv_ukernel_mp8x4__sse2);
+    }
+  }
+
+  TEST(Q8_DWCONV_MP8X4__SSE2, kernel_size_div_4) {
+    TEST_REQUIRES_X86_SSE2;
+    for (uint32_t kernel_size = 8; kernel_size <= 16; kernel_size += 4) {
+      for (uint32_t channels = 1; channels <= 24; channels += 7) {
+        DWConvMicrokernelTester()
+          .cr(8)
+          .kr(kernel_size)
+          .channels(channels)
+          .Test(xnn_q8_dwconv_ukernel_mp8x4__sse2);
+      }
+    }
+  }
+
+  TEST(Q8_DWCONV_MP8X4__SSE2, kernel_size_gt_4) {
+    TEST_REQUIRES_X86_SSE2;
+    for (uint32_t kernel_size = 5; kernel_size < 8; kernel_size++) {
+      for (uint32_t channels = 1; channels <= 24; channels += 7) {
+        DWConvMicrokernelTester()
+          .cr(8)
+          .kr(kernel_size)
+          .channels(channels)
+          .Test(xnn_q8_dwconv_ukernel_mp8x4__sse2);
+      }
+    }
+  }
+
+  TEST(Q8_DWCONV_MP8X4__SSE2, kernel_size_eq_49) {
+    TEST_REQUIRES_X86_SSE2;
+    for (uint32_t channels = 1; channels <= 24; channels += 7) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(49)
+        .channels(channels)
+        .width(3)
+        .step(7)
+        .Test(xnn_q8_dwconv_ukernel_mp8x4__sse2);
+    }
+  }
+
+  TEST(Q8_DWCONV_MP8X4__SSE2, input_zero_point_only) {
     TEST_REQUIRES_X86_SSE2;
     for (size_t channels = 1; channels <= 40; channels += 7) {
       DWConvMicrokernelTester()
@@ -561,11 +1061,11 @@
         .width(3)
         .input_zero_point(255)
         .kernel_zero_point(0)
-        .Test(xnn_q8_dwconv_ukernel_up8x9__sse2);
+        .Test(xnn_q8_dwconv_ukernel_mp8x4__sse2);
     }
   }
 
-  TEST(Q8_DWCONV_UP8X9__SSE2, kernel_zero_point_only) {
+  TEST(Q8_DWCONV_MP8X4__SSE2, kernel_zero_point_only) {
     TEST_REQUIRES_X86_SSE2;
     for (size_t channels = 1; channels <= 40; channels += 7) {
       DWConvMicrokernelTester()
@@ -575,7 +1075,7 @@
         .width(3)
         .input_zero_point(0)
         .kernel_zero_point(255)
-        .Test(xnn_q8_dwconv_ukernel_up8x9__sse2);
+        .Test(xnn_q8_dwconv_ukernel_mp8x4__sse2);
     }
   }
 #endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
@@ -706,4 +1206,189 @@ TEST(Q8_DWCONV_UP1X9__SCALAR, kernel_zero_point_only) {
       .kernel_zero_point(255)
       .Test(xnn_q8_dwconv_ukernel_up1x9__scalar, DWConvMicrokernelTester::Variant::Scalar);
   }
+}
+
+TEST(Q8_DWCONV_MP1X4__SCALAR, c_eq_1) {
+  DWConvMicrokernelTester()
+    .cr(1)
+    .kr(9)
+    .channels(1)
+    .Test(xnn_q8_dwconv_ukernel_mp1x4__scalar, DWConvMicrokernelTester::Variant::Scalar);
+}
+
+TEST(Q8_DWCONV_MP1X4__SCALAR, c_gt_1) {
+  for (uint32_t channels = 2; channels < 10; channels++) {
+    DWConvMicrokernelTester()
+      .cr(1)
+      .kr(9)
+      .channels(channels)
+      .Test(xnn_q8_dwconv_ukernel_mp1x4__scalar, DWConvMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(Q8_DWCONV_MP1X4__SCALAR, c_gt_1_with_qmin) {
+  for (uint32_t channels = 2; channels < 10; channels++) {
+    DWConvMicrokernelTester()
+      .cr(1)
+      .kr(9)
+      .channels(channels)
+      .qmin(128)
+      .Test(xnn_q8_dwconv_ukernel_mp1x4__scalar, DWConvMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(Q8_DWCONV_MP1X4__SCALAR, c_gt_1_with_qmax) {
+  for (uint32_t channels = 2; channels < 10; channels++) {
+    DWConvMicrokernelTester()
+      .cr(1)
+      .kr(9)
+      .channels(channels)
+      .qmax(128)
+      .Test(xnn_q8_dwconv_ukernel_mp1x4__scalar, DWConvMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(Q8_DWCONV_MP1X4__SCALAR, multipixel) {
+  for (size_t channels = 1; channels <= 5; channels += 1) {
+    DWConvMicrokernelTester()
+      .cr(1)
+      .kr(9)
+      .channels(channels)
+      .width(3)
+      .Test(xnn_q8_dwconv_ukernel_mp1x4__scalar, DWConvMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(Q8_DWCONV_MP1X4__SCALAR, multipixel_with_step) {
+  for (size_t channels = 1; channels <= 5; channels += 1) {
+    for (size_t step = 2; step <= 9; step++) {
+      DWConvMicrokernelTester()
+        .cr(1)
+        .kr(9)
+        .channels(channels)
+        .width(3)
+        .step(step)
+        .Test(xnn_q8_dwconv_ukernel_mp1x4__scalar, DWConvMicrokernelTester::Variant::Scalar);
+    }
+  }
+}
+
+TEST(Q8_DWCONV_MP1X4__SCALAR, multipixel_with_output_stride) {
+  for (size_t channels = 1; channels <= 5; channels += 1) {
+    DWConvMicrokernelTester()
+      .cr(1)
+      .kr(9)
+      .channels(1)
+      .width(5)
+      .output_stride(7)
+      .Test(xnn_q8_dwconv_ukernel_mp1x4__scalar, DWConvMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(Q8_DWCONV_MP1X4__SCALAR, multipixel_with_qmin) {
+  for (size_t channels = 1; channels <= 5; channels += 1) {
+    DWConvMicrokernelTester()
+      .cr(1)
+      .kr(9)
+      .channels(channels)
+      .width(3)
+      .qmin(128)
+      .Test(xnn_q8_dwconv_ukernel_mp1x4__scalar, DWConvMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(Q8_DWCONV_MP1X4__SCALAR, multipixel_with_qmax) {
+  for (size_t channels = 1; channels <= 5; channels += 1) {
+    DWConvMicrokernelTester()
+      .cr(1)
+      .kr(9)
+      .channels(channels)
+      .width(3)
+      .qmax(128)
+      .Test(xnn_q8_dwconv_ukernel_mp1x4__scalar, DWConvMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(Q8_DWCONV_MP1X4__SCALAR, kernel_size_lt_4) {
+  for (uint32_t kernel_size = 1; kernel_size < 4; kernel_size++) {
+    for (uint32_t channels = 1; channels <= 3; channels += 1) {
+      DWConvMicrokernelTester()
+        .cr(1)
+        .kr(kernel_size)
+        .channels(channels)
+        .Test(xnn_q8_dwconv_ukernel_mp1x4__scalar, DWConvMicrokernelTester::Variant::Scalar);
+    }
+  }
+}
+
+TEST(Q8_DWCONV_MP1X4__SCALAR, kernel_size_eq_4) {
+  for (uint32_t channels = 1; channels <= 3; channels += 1) {
+    DWConvMicrokernelTester()
+      .cr(1)
+      .kr(4)
+      .channels(channels)
+      .Test(xnn_q8_dwconv_ukernel_mp1x4__scalar, DWConvMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(Q8_DWCONV_MP1X4__SCALAR, kernel_size_div_4) {
+  for (uint32_t kernel_size = 8; kernel_size <= 16; kernel_size += 4) {
+    for (uint32_t channels = 1; channels <= 3; channels += 1) {
+      DWConvMicrokernelTester()
+        .cr(1)
+        .kr(kernel_size)
+        .channels(channels)
+        .Test(xnn_q8_dwconv_ukernel_mp1x4__scalar, DWConvMicrokernelTester::Variant::Scalar);
+    }
+  }
+}
+
+TEST(Q8_DWCONV_MP1X4__SCALAR, kernel_size_gt_4) {
+  for (uint32_t kernel_size = 5; kernel_size < 8; kernel_size++) {
+    for (uint32_t channels = 1; channels <= 3; channels += 1) {
+      DWConvMicrokernelTester()
+        .cr(1)
+        .kr(kernel_size)
+        .channels(channels)
+        .Test(xnn_q8_dwconv_ukernel_mp1x4__scalar, DWConvMicrokernelTester::Variant::Scalar);
+    }
+  }
+}
+
+TEST(Q8_DWCONV_MP1X4__SCALAR, kernel_size_eq_49) {
+  for (uint32_t channels = 1; channels <= 3; channels += 1) {
+    DWConvMicrokernelTester()
+      .cr(1)
+      .kr(49)
+      .channels(channels)
+      .width(3)
+      .step(7)
+      .Test(xnn_q8_dwconv_ukernel_mp1x4__scalar, DWConvMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(Q8_DWCONV_MP1X4__SCALAR, input_zero_point_only) {
+  for (size_t channels = 1; channels <= 5; channels += 1) {
+    DWConvMicrokernelTester()
+      .cr(1)
+      .kr(9)
+      .channels(channels)
+      .width(3)
+      .input_zero_point(255)
+      .kernel_zero_point(0)
+      .Test(xnn_q8_dwconv_ukernel_mp1x4__scalar, DWConvMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(Q8_DWCONV_MP1X4__SCALAR, kernel_zero_point_only) {
+  for (size_t channels = 1; channels <= 5; channels += 1) {
+    DWConvMicrokernelTester()
+      .cr(1)
+      .kr(9)
+      .channels(channels)
+      .width(3)
+      .input_zero_point(0)
+      .kernel_zero_point(255)
+      .Test(xnn_q8_dwconv_ukernel_mp1x4__scalar, DWConvMicrokernelTester::Variant::Scalar);
+  }
 }
\ No newline at end of file
@@ -12,6 +12,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <cstddef>
 #include <cstdlib>
 #include <functional>
@@ -23,6 +24,11 @@
 
 class RMaxMicrokernelTester {
  public:
+  enum class OpType {
+    Max,
+    AbsMax,
+  };
+
   inline RMaxMicrokernelTester& n(size_t n) {
     assert(n != 0);
     this->n_ = n;
@@ -66,10 +72,11 @@ class RMaxMicrokernelTester {
     }
   }
 
-  void Test(xnn_f32_rmax_ukernel_function rmax) const {
+  void Test(xnn_f32_rmax_ukernel_function rmax, OpType op_type = OpType::Max) const {
     std::random_device random_device;
     auto rng = std::mt19937(random_device());
-    auto f32rng = std::bind(std::uniform_real_distribution<float>(), rng);
+    auto f32rng = std::bind(
+      std::uniform_real_distribution<float>(op_type == OpType::AbsMax ? -1.0f : 0.0f, 1.0f), rng);
 
     std::vector<float> x(n());
     for (size_t iteration = 0; iteration < iterations(); iteration++) {
@@ -78,7 +85,14 @@ class RMaxMicrokernelTester {
       // Compute reference results.
       float y_ref = 0;
       for (size_t i = 0; i < n(); i++) {
-        y_ref = std::max(y_ref, x[i]);
+        switch (op_type) {
+          case OpType::Max:
+            y_ref = std::max(y_ref, x[i]);
+            break;
+          case OpType::AbsMax:
+            y_ref = std::max(y_ref, std::abs(x[i]));
+            break;
+        }
       }
 
       // Call optimized micro-kernel.
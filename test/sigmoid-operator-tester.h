@@ -129,6 +129,65 @@ class SigmoidOperatorTester {
     return this->iterations_;
   }
 
+  void TestF32() const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto f32rng = std::bind(std::uniform_real_distribution<float>(-25.0f, 25.0f), rng);
+
+    std::vector<float> input(XNN_EXTRA_BYTES / sizeof(float) +
+      (batch_size() - 1) * input_stride() + channels());
+    std::vector<float> output((batch_size() - 1) * output_stride() + channels());
+    std::vector<double> output_ref(batch_size() * channels());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(f32rng));
+      std::fill(output.begin(), output.end(), std::nanf(""));
+
+      // Compute reference results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        for (size_t c = 0; c < channels(); c++) {
+          const double x = input[i * input_stride() + c];
+          const double exp_x = std::exp(x);
+          const double sigmoid_x = exp_x / (1.0 + exp_x);
+          output_ref[i * channels() + c] = sigmoid_x;
+        }
+      }
+
+      // Create, setup, run, and destroy Sigmoid operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize());
+      xnn_operator_t sigmoid_op = nullptr;
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_create_sigmoid_nc_f32(
+          channels(), input_stride(), output_stride(),
+          0, &sigmoid_op));
+      ASSERT_NE(nullptr, sigmoid_op);
+
+      // Smart pointer to automatically delete sigmoid_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_sigmoid_op(sigmoid_op, xnn_delete_operator);
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_sigmoid_nc_f32(
+          sigmoid_op,
+          batch_size(),
+          input.data(), output.data(),
+          nullptr /* thread pool */));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(sigmoid_op, nullptr /* thread pool */));
+
+      // Verify results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        for (size_t c = 0; c < channels(); c++) {
+          ASSERT_NEAR(
+            double(output[i * output_stride() + c]),
+            output_ref[i * channels() + c],
+            output_ref[i * channels() + c] * 5.0e-6)
+            << "at position " << i << ", batch size = " << batch_size() << ", channels = " << channels();
+        }
+      }
+    }
+  }
+
   void TestQ8() const {
     std::random_device random_device;
     auto rng = std::mt19937(random_device());
@@ -142,3 +142,103 @@ TEST(SOFTARGMAX_OP, strided_batch_with_input_and_output_stride) {
       .TestQ8();
   }
 }
+
+TEST(SOFTMAX_OP_F32, single_class) {
+  SoftArgMaxOperatorTester()
+    .batch_size(1)
+    .channels(1)
+    .iterations(100)
+    .TestF32();
+}
+
+TEST(SOFTMAX_OP_F32, two_classes) {
+  SoftArgMaxOperatorTester()
+    .batch_size(1)
+    .channels(2)
+    .iterations(100)
+    .TestF32();
+}
+
+TEST(SOFTMAX_OP_F32, many_classes) {
+  for (size_t channels = 3; channels < 100; channels++) {
+    SoftArgMaxOperatorTester()
+      .batch_size(1)
+      .channels(channels)
+      .iterations(1)
+      .TestF32();
+  }
+}
+
+TEST(SOFTMAX_OP_F32, cifar_classes) {
+  // CIFAR-10
+  SoftArgMaxOperatorTester()
+    .batch_size(1)
+    .channels(10)
+    .iterations(15)
+    .TestF32();
+  // CIFAR-100
+  SoftArgMaxOperatorTester()
+    .batch_size(1)
+    .channels(100)
+    .iterations(15)
+    .TestF32();
+}
+
+TEST(SOFTMAX_OP_F32, imagenet_classes) {
+  // ImageNet-1K
+  SoftArgMaxOperatorTester()
+    .batch_size(1)
+    .channels(1000)
+    .iterations(10)
+    .TestF32();
+  // ImageNet-22K
+  SoftArgMaxOperatorTester()
+    .batch_size(1)
+    .channels(21841)
+    .iterations(10)
+    .TestF32();
+}
+
+TEST(SOFTMAX_OP_F32, small_batch) {
+  for (size_t channels = 1; channels < 100; channels += 5) {
+    SoftArgMaxOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .iterations(3)
+      .TestF32();
+  }
+}
+
+TEST(SOFTMAX_OP_F32, small_batch_with_input_stride) {
+  for (size_t channels = 1; channels < 100; channels += 5) {
+    SoftArgMaxOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .input_stride(129)
+      .iterations(3)
+      .TestF32();
+  }
+}
+
+TEST(SOFTMAX_OP_F32, small_batch_with_output_stride) {
+  for (size_t channels = 1; channels < 100; channels += 5) {
+    SoftArgMaxOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .output_stride(117)
+      .iterations(3)
+      .TestF32();
+  }
+}
+
+TEST(SOFTMAX_OP_F32, strided_batch_with_input_and_output_stride) {
+  for (size_t channels = 1; channels < 100; channels += 5) {
+    SoftArgMaxOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .input_stride(129)
+      .output_stride(117)
+      .iterations(3)
+      .TestF32();
+  }
+}
@@ -0,0 +1,415 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <xnnpack.h>
+#include <xnnpack/subgraph.h>
+
+
+namespace {
+
+class SubgraphTester {
+ public:
+  explicit SubgraphTester(uint32_t external_value_ids) {
+    EXPECT_EQ(xnn_status_success, xnn_initialize());
+    EXPECT_EQ(xnn_status_success, xnn_create_subgraph(external_value_ids, 0 /* flags */, &subgraph_));
+  }
+
+  ~SubgraphTester() {
+    xnn_delete_runtime(runtime_);
+    xnn_delete_subgraph(subgraph_);
+  }
+
+  uint32_t AddTensor(std::vector<size_t> dims, const float* data = nullptr) {
+    uint32_t id = XNN_INVALID_VALUE_ID;
+    EXPECT_EQ(xnn_status_success,
+      xnn_define_tensor_value(subgraph_, xnn_datatype_fp32, dims.size(), dims.data(), data,
+        XNN_INVALID_VALUE_ID, 0 /* flags */, &id));
+    return id;
+  }
+
+  uint32_t AddExternalTensor(std::vector<size_t> dims, uint32_t external_id, uint32_t flags) {
+    uint32_t id = XNN_INVALID_VALUE_ID;
+    EXPECT_EQ(xnn_status_success,
+      xnn_define_tensor_value(subgraph_, xnn_datatype_fp32, dims.size(), dims.data(), nullptr,
+        external_id, flags, &id));
+    return id;
+  }
+
+  xnn_subgraph_t subgraph() const {
+    return subgraph_;
+  }
+
+  xnn_runtime_t CreateRuntime() {
+    EXPECT_EQ(xnn_status_success, xnn_create_runtime(subgraph_, nullptr /* thread pool */, 0 /* flags */, &runtime_));
+    return runtime_;
+  }
+
+ private:
+  xnn_subgraph_t subgraph_ = nullptr;
+  xnn_runtime_t runtime_ = nullptr;
+};
+
+std::vector<float> RandomVector(size_t size, std::mt19937& rng) {
+  auto f32rng = std::bind(std::uniform_real_distribution<float>(-1.0f, 1.0f), std::ref(rng));
+  std::vector<float> data(size);
+  std::generate(data.begin(), data.end(), std::ref(f32rng));
+  return data;
+}
+
+}  // namespace
+
+
+TEST(SUBGRAPH, conv_dwconv_add_clamp_gavgpool_fc) {
+  std::random_device random_device;
+  auto rng = std::mt19937(random_device());
+
+  const size_t batch_size = 2;
+  const size_t height = 9;
+  const size_t width = 7;
+  const size_t input_channels = 5;
+  const size_t channels = 12;
+  const size_t output_channels = 10;
+  const float inf = std::numeric_limits<float>::infinity();
+
+  std::vector<float> input = RandomVector(batch_size * height * width * input_channels + XNN_EXTRA_BYTES / sizeof(float), rng);
+  const std::vector<float> conv_filter = RandomVector(channels * 3 * 3 * input_channels, rng);
+  const std::vector<float> conv_bias = RandomVector(channels, rng);
+  const std::vector<float> dwconv_filter = RandomVector(3 * 3 * channels, rng);
+  const std::vector<float> dwconv_bias = RandomVector(channels, rng);
+  const std::vector<float> fc_filter = RandomVector(output_channels * channels, rng);
+  const std::vector<float> fc_bias = RandomVector(output_channels, rng);
+
+  // Reference: the same chain wired by hand with individually allocated activations.
+  std::vector<float> conv_output(batch_size * height * width * channels + XNN_EXTRA_BYTES / sizeof(float));
+  std::vector<float> dwconv_output(batch_size * height * width * channels + XNN_EXTRA_BYTES / sizeof(float));
+  std::vector<float> add_output(batch_size * height * width * channels + XNN_EXTRA_BYTES / sizeof(float));
+  std::vector<float> clamp_output(batch_size * height * width * channels + XNN_EXTRA_BYTES / sizeof(float));
+  std::vector<float> gavgpool_output(batch_size * channels + XNN_EXTRA_BYTES / sizeof(float));
+  std::vector<float> reference_output(batch_size * output_channels);
+  {
+    ASSERT_EQ(xnn_status_success, xnn_initialize());
+    std::array<xnn_operator_t, 6> ops;
+    ASSERT_EQ(xnn_status_success,
+      xnn_create_convolution2d_nhwc_f32(
+        1, 1, 1, 1, 3, 3, 1, 1, 1, 1,
+        1, input_channels, channels, input_channels, channels,
+        conv_filter.data(), conv_bias.data(), -inf, +inf, 0, &ops[0]));
+    ASSERT_EQ(xnn_status_success,
+      xnn_create_convolution2d_nhwc_f32(
+        1, 1, 1, 1, 3, 3, 1, 1, 1, 1,
+        channels, 1, 1, channels, channels,
+        dwconv_filter.data(), dwconv_bias.data(), -inf, +inf, XNN_FLAG_DEPTHWISE_CONVOLUTION, &ops[1]));
+    ASSERT_EQ(xnn_status_success,
+      xnn_create_add_nc_f32(channels, channels, channels, channels, -inf, +inf, 0, &ops[2]));
+    ASSERT_EQ(xnn_status_success,
+      xnn_create_clamp_nc_f32(channels, channels, channels, 0.0f, 6.0f, 0, &ops[3]));
+    ASSERT_EQ(xnn_status_success,
+      xnn_create_global_average_pooling_nwc_f32(channels, channels, channels, -inf, +inf, 0, &ops[4]));
+    ASSERT_EQ(xnn_status_success,
+      xnn_create_fully_connected_nc_f32(
+        channels, output_channels, channels, output_channels,
+        fc_filter.data(), fc_bias.data(), -inf, +inf, 0, &ops[5]));
+
+    ASSERT_EQ(xnn_status_success,
+      xnn_setup_convolution2d_nhwc_f32(
+        ops[0], batch_size, height, width, input.data(), conv_output.data(), nullptr /* thread pool */));
+    ASSERT_EQ(xnn_status_success,
+      xnn_setup_convolution2d_nhwc_f32(
+        ops[1], batch_size, height, width, conv_output.data(), dwconv_output.data(), nullptr /* thread pool */));
+    ASSERT_EQ(xnn_status_success,
+      xnn_setup_add_nc_f32(
+        ops[2], batch_size * height * width, dwconv_output.data(), conv_output.data(), add_output.data(),
+        nullptr /* thread pool */));
+    ASSERT_EQ(xnn_status_success,
+      xnn_setup_clamp_nc_f32(
+        ops[3], batch_size * height * width, add_output.data(), clamp_output.data(), nullptr /* thread pool */));
+    ASSERT_EQ(xnn_status_success,
+      xnn_setup_global_average_pooling_nwc_f32(
+        ops[4], batch_size, height * width, clamp_output.data(), gavgpool_output.data(), nullptr /* thread pool */));
+    ASSERT_EQ(xnn_status_success,
+      xnn_setup_fully_connected_nc_f32(
+        ops[5], batch_size, gavgpool_output.data(), reference_output.data(), nullptr /* thread pool */));
+
+    for (xnn_operator_t op : ops) {
+      ASSERT_EQ(xnn_status_success, xnn_run_operator(op, nullptr /* thread pool */));
+      ASSERT_EQ(xnn_status_success, xnn_delete_operator(op));
+    }
+  }
+
+  SubgraphTester tester(2);
+  const uint32_t input_id = tester.AddExternalTensor(
+    {batch_size, height, width, input_channels}, 0, XNN_VALUE_FLAG_EXTERNAL_INPUT);
+  const uint32_t output_id = tester.AddExternalTensor(
+    {batch_size, output_channels}, 1, XNN_VALUE_FLAG_EXTERNAL_OUTPUT);
+  const uint32_t conv_filter_id = tester.AddTensor({channels, 3, 3, input_channels}, conv_filter.data());
+  const uint32_t conv_bias_id = tester.AddTensor({channels}, conv_bias.data());
+  const uint32_t dwconv_filter_id = tester.AddTensor({1, 3, 3, channels}, dwconv_filter.data());
+  const uint32_t dwconv_bias_id = tester.AddTensor({channels}, dwconv_bias.data());
+  const uint32_t fc_filter_id = tester.AddTensor({output_channels, channels}, fc_filter.data());
+  const uint32_t fc_bias_id = tester.AddTensor({output_channels}, fc_bias.data());
+  const uint32_t conv_output_id = tester.AddTensor({batch_size, height, width, channels});
+  const uint32_t dwconv_output_id = tester.AddTensor({batch_size, height, width, channels});
+  const uint32_t add_output_id = tester.AddTensor({batch_size, height, width, channels});
+  const uint32_t clamp_output_id = tester.AddTensor({batch_size, height, width, channels});
+  const uint32_t gavgpool_output_id = tester.AddTensor({batch_size, 1, 1, channels});
+
+  xnn_subgraph_t subgraph = tester.subgraph();
+  ASSERT_EQ(xnn_status_success,
+    xnn_define_convolution_2d(
+      subgraph, 1, 1, 1, 1, 3, 3, 1, 1, 1, 1, 1, input_channels, channels, -inf, +inf,
+      input_id, conv_filter_id, conv_bias_id, conv_output_id, 0 /* flags */));
+  ASSERT_EQ(xnn_status_success,
+    xnn_define_depthwise_convolution_2d(
+      subgraph, 1, 1, 1, 1, 3, 3, 1, 1, 1, 1, 1, channels, -inf, +inf,
+      conv_output_id, dwconv_filter_id, dwconv_bias_id, dwconv_output_id, 0 /* flags */));
+  ASSERT_EQ(xnn_status_success,
+    xnn_define_add2(subgraph, -inf, +inf, dwconv_output_id, conv_output_id, add_output_id, 0 /* flags */));
+  ASSERT_EQ(xnn_status_success,
+    xnn_define_clamp(subgraph, 0.0f, 6.0f, add_output_id, clamp_output_id, 0 /* flags */));
+  ASSERT_EQ(xnn_status_success,
+    xnn_define_global_average_pooling_2d(subgraph, -inf, +inf, clamp_output_id, gavgpool_output_id, 0 /* flags */));
+  ASSERT_EQ(xnn_status_success,
+    xnn_define_fully_connected(
+      subgraph, -inf, +inf, gavgpool_output_id, fc_filter_id, fc_bias_id, output_id, 0 /* flags */));
+
+  xnn_runtime_t runtime = tester.CreateRuntime();
+  ASSERT_NE(nullptr, runtime);
+
+  // Conv output is live until the Add node, so at most three large activations are live at once.
+  const size_t activation_size = batch_size * height * width * channels * sizeof(float);
+  EXPECT_LT(runtime->workspace_size, 4 * activation_size);
+  EXPECT_GE(runtime->workspace_size, 3 * activation_size);
+
+  std::vector<float> output(batch_size * output_channels);
+  const std::array<xnn_external_value, 2> external = {{
+    {input_id, input.data()},
+    {output_id, output.data()},
+  }};
+  ASSERT_EQ(xnn_status_success, xnn_setup_runtime(runtime, external.size(), external.data()));
+  ASSERT_EQ(xnn_status_success, xnn_invoke_runtime(runtime));
+
+  for (size_t i = 0; i < output.size(); i++) {
+    ASSERT_NEAR(reference_output[i], output[i], 1.0e-5f * std::abs(reference_output[i])) << "at " << i;
+  }
+}
+
+TEST(SUBGRAPH, maxpool_avgpool_hardswish) {
+  std::random_device random_device;
+  auto rng = std::mt19937(random_device());
+
+  const size_t batch_size = 3;
+  const size_t height = 12;
+  const size_t width = 10;
+  const size_t channels = 7;
+  const float inf = std::numeric_limits<float>::infinity();
+
+  std::vector<float> input = RandomVector(batch_size * height * width * channels + XNN_EXTRA_BYTES / sizeof(float), rng);
+
+  std::vector<float> maxpool_output(batch_size * (height / 2) * (width / 2) * channels + XNN_EXTRA_BYTES / sizeof(float));
+  std::vector<float> avgpool_output(batch_size * (height / 2) * (width / 2) * channels + XNN_EXTRA_BYTES / sizeof(float));
+  std::vector<float> reference_output(batch_size * (height / 2) * (width / 2) * channels);
+  {
+    ASSERT_EQ(xnn_status_success, xnn_initialize());
+    std::array<xnn_operator_t, 3> ops;
+    ASSERT_EQ(xnn_status_success,
+      xnn_create_max_pooling2d_nhwc_f32(
+        0, 0, 0, 0, 2, 2, 2, 2, 1, 1, channels, channels, channels, -inf, +inf, 0, &ops[0]));
+    ASSERT_EQ(xnn_status_success,
+      xnn_create_average_pooling2d_nhwc_f32(
+        1, 1, 1, 1, 3, 3, 1, 1, channels, channels, channels, -inf, +inf, 0, &ops[1]));
+    ASSERT_EQ(xnn_status_success,
+      xnn_create_hardswish_nc_f32(channels, channels, channels, 0, &ops[2]));
+
+    ASSERT_EQ(xnn_status_success,
+      xnn_setup_max_pooling2d_nhwc_f32(
+        ops[0], batch_size, height, width, input.data(), maxpool_output.data(), nullptr /* thread pool */));
+    ASSERT_EQ(xnn_status_success,
+      xnn_setup_average_pooling2d_nhwc_f32(
+        ops[1], batch_size, height / 2, width / 2, maxpool_output.data(), avgpool_output.data(),
+        nullptr /* thread pool */));
+    ASSERT_EQ(xnn_status_success,
+      xnn_setup_hardswish_nc_f32(
+        ops[2], batch_size * (height / 2) * (width / 2), avgpool_output.data(), reference_output.data(),
+        nullptr /* thread pool */));
+
+    for (xnn_operator_t op : ops) {
+      ASSERT_EQ(xnn_status_success, xnn_run_operator(op, nullptr /* thread pool */));
+      ASSERT_EQ(xnn_status_success, xnn_delete_operator(op));
+    }
+  }
+
+  SubgraphTester tester(2);
+  const uint32_t input_id = tester.AddExternalTensor(
+    {batch_size, height, width, channels}, 0, XNN_VALUE_FLAG_EXTERNAL_INPUT);
+  const uint32_t output_id = tester.AddExternalTensor(
+    {batch_size, height / 2, width / 2, channels}, 1, XNN_VALUE_FLAG_EXTERNAL_OUTPUT);
+  const uint32_t maxpool_output_id = tester.AddTensor({batch_size, height / 2, width / 2, channels});
+  const uint32_t avgpool_output_id = tester.AddTensor({batch_size, height / 2, width / 2, channels});
+
+  xnn_subgraph_t subgraph = tester.subgraph();
+  ASSERT_EQ(xnn_status_success,
+    xnn_define_max_pooling_2d(
+      subgraph, 0, 0, 0, 0, 2, 2, 2, 2, 1, 1, -inf, +inf, input_id, maxpool_output_id, 0 /* flags */));
+  ASSERT_EQ(xnn_status_success,
+    xnn_define_average_pooling_2d(
+      subgraph, 1, 1, 1, 1, 3, 3, 1, 1, -inf, +inf, maxpool_output_id, avgpool_output_id, 0 /* flags */));
+  ASSERT_EQ(xnn_status_success,
+    xnn_define_hardswish(subgraph, avgpool_output_id, output_id, 0 /* flags */));
+
+  xnn_runtime_t runtime = tester.CreateRuntime();
+  ASSERT_NE(nullptr, runtime);
+
+  std::vector<float> output(reference_output.size());
+  const std::array<xnn_external_value, 2> external = {{
+    {input_id, input.data()},
+    {output_id, output.data()},
+  }};
+  ASSERT_EQ(xnn_status_success, xnn_setup_runtime(runtime, external.size(), external.data()));
+  ASSERT_EQ(xnn_status_success, xnn_invoke_runtime(runtime));
+
+  for (size_t i = 0; i < output.size(); i++) {
+    ASSERT_NEAR(reference_output[i], output[i], 1.0e-6f * std::abs(reference_output[i])) << "at " << i;
+  }
+}
+
+TEST(SUBGRAPH, memory_planner_reuses_memory) {
+  const size_t batch_size = 4;
+  const size_t channels = 37;
+  const size_t num_nodes = 10;
+
+  SubgraphTester tester(2);
+  const uint32_t input_id = tester.AddExternalTensor({batch_size, channels}, 0, XNN_VALUE_FLAG_EXTERNAL_INPUT);
+  const uint32_t output_id = tester.AddExternalTensor({batch_size, channels}, 1, XNN_VALUE_FLAG_EXTERNAL_OUTPUT);
+
+  // A chain of Clamp nodes needs only two internal activations at any time.
+  uint32_t last_id = input_id;
+  for (size_t n = 0; n + 1 < num_nodes; n++) {
+    const uint32_t next_id = tester.AddTensor({batch_size, channels});
+    ASSERT_EQ(xnn_status_success,
+      xnn_define_clamp(tester.subgraph(), -1.0f + float(n) * 0.05f, 1.0f, last_id, next_id, 0 /* flags */));
+    last_id = next_id;
+  }
+  ASSERT_EQ(xnn_status_success,
+    xnn_define_clamp(tester.subgraph(), -0.5f, 0.5f, last_id, output_id, 0 /* flags */));
+
+  xnn_runtime_t runtime = tester.CreateRuntime();
+  ASSERT_NE(nullptr, runtime);
+
+  const size_t activation_size = batch_size * channels * sizeof(float);
+  EXPECT_LT(runtime->workspace_size, 3 * activation_size);
+
+  std::vector<float> input(batch_size * channels + XNN_EXTRA_BYTES / sizeof(float));
+  for (size_t i = 0; i < input.size(); i++) {
+    input[i] = float(int32_t(i % 7) - 3) * 0.25f;
+  }
+  std::vector<float> output(batch_size * channels);
+  const std::array<xnn_external_value, 2> external = {{
+    {input_id, input.data()},
+    {output_id, output.data()},
+  }};
+  ASSERT_EQ(xnn_status_success, xnn_setup_runtime(runtime, external.size(), external.data()));
+  ASSERT_EQ(xnn_status_success, xnn_invoke_runtime(runtime));
+
+  for (size_t i = 0; i < output.size(); i++) {
+    ASSERT_EQ(std::min(std::max(input[i], -0.5f), 0.5f), output[i]) << "at " << i;
+  }
+}
+
+TEST(SUBGRAPH, invalid_graphs) {
+  const float inf = std::numeric_limits<float>::infinity();
+  const std::vector<float> filter(4 * 3 * 3 * 2);
+  const std::vector<float> bias(4);
+
+  SubgraphTester tester(2);
+  xnn_subgraph_t subgraph = tester.subgraph();
+  const uint32_t input_id = tester.AddExternalTensor({1, 5, 5, 2}, 0, XNN_VALUE_FLAG_EXTERNAL_INPUT);
+  const uint32_t output_id = tester.AddExternalTensor({1, 5, 5, 4}, 1, XNN_VALUE_FLAG_EXTERNAL_OUTPUT);
+  const uint32_t filter_id = tester.AddTensor({4, 3, 3, 2}, filter.data());
+  const uint32_t dynamic_filter_id = tester.AddTensor({4, 3, 3, 2});
+  const uint32_t bias_id = tester.AddTensor({4}, bias.data());
+  const uint32_t orphan_id = tester.AddTensor({1, 5, 5, 4});
+
+  // External IDs must be within the reserved range, and can be defined only once.
+  uint32_t id = XNN_INVALID_VALUE_ID;
+  const size_t dims[1] = { 4 };
+  EXPECT_EQ(xnn_status_invalid_parameter,
+    xnn_define_tensor_value(subgraph, xnn_datatype_fp32, 1, dims, nullptr, 2, 0, &id));
+  EXPECT_EQ(xnn_status_invalid_parameter,
+    xnn_define_tensor_value(subgraph, xnn_datatype_fp32, 1, dims, nullptr, 0, 0, &id));
+
+  // Filters must be static.
+  EXPECT_EQ(xnn_status_unsupported_parameter,
+    xnn_define_convolution_2d(
+      subgraph, 1, 1, 1, 1, 3, 3, 1, 1, 1, 1, 1, 2, 4, -inf, +inf,
+      input_id, dynamic_filter_id, bias_id, output_id, 0 /* flags */));
+
+  // Output shape must match the convolution parameters.
+  EXPECT_EQ(xnn_status_invalid_parameter,
+    xnn_define_convolution_2d(
+      subgraph, 0, 0, 0, 0, 3, 3, 1, 1, 1, 1, 1, 2, 4, -inf, +inf,
+      input_id, filter_id, bias_id, output_id, 0 /* flags */));
+
+  // External inputs can not be produced by a node.
+  EXPECT_EQ(xnn_status_invalid_parameter,
+    xnn_define_clamp(subgraph, 0.0f, 1.0f, output_id, input_id, 0 /* flags */));
+
+  ASSERT_EQ(xnn_status_success,
+    xnn_define_clamp(subgraph, 0.0f, 1.0f, orphan_id, output_id, 0 /* flags */));
+
+  // Values can be produced only once.
+  EXPECT_EQ(xnn_status_invalid_parameter,
+    xnn_define_convolution_2d(
+      subgraph, 1, 1, 1, 1, 3, 3, 1, 1, 1, 1, 1, 2, 4, -inf, +inf,
+      input_id, filter_id, bias_id, output_id, 0 /* flags */));
+
+  // The input of the Clamp node is never produced.
+  xnn_runtime_t runtime = nullptr;
+  EXPECT_EQ(xnn_status_invalid_parameter,
+    xnn_create_runtime(subgraph, nullptr /* thread pool */, 0 /* flags */, &runtime));
+}
+
+TEST(SUBGRAPH, invalid_external_values) {
+  SubgraphTester tester(2);
+  const uint32_t input_id = tester.AddExternalTensor({3, 8}, 0, XNN_VALUE_FLAG_EXTERNAL_INPUT);
+  const uint32_t output_id = tester.AddExternalTensor({3, 8}, 1, XNN_VALUE_FLAG_EXTERNAL_OUTPUT);
+  const uint32_t internal_id = tester.AddTensor({3, 8});
+  ASSERT_EQ(xnn_status_success,
+    xnn_define_hardswish(tester.subgraph(), input_id, internal_id, 0 /* flags */));
+  ASSERT_EQ(xnn_status_success,
+    xnn_define_clamp(tester.subgraph(), -1.0f, 1.0f, internal_id, output_id, 0 /* flags */));
+
+  xnn_runtime_t runtime = tester.CreateRuntime();
+  ASSERT_NE(nullptr, runtime);
+
+  std::vector<float> input(3 * 8 + XNN_EXTRA_BYTES / sizeof(float));
+  std::vector<float> output(3 * 8);
+  const std::array<xnn_external_value, 2> internal = {{
+    {input_id, input.data()},
+    {internal_id, output.data()},
+  }};
+  EXPECT_EQ(xnn_status_invalid_parameter, xnn_setup_runtime(runtime, internal.size(), internal.data()));
+
+  const std::array<xnn_external_value, 1> incomplete = {{
+    {input_id, input.data()},
+  }};
+  EXPECT_EQ(xnn_status_invalid_parameter, xnn_setup_runtime(runtime, incomplete.size(), incomplete.data()));
+
+  const std::array<xnn_external_value, 2> external = {{
+    {input_id, input.data()},
+    {output_id, output.data()},
+  }};
+  EXPECT_EQ(xnn_status_success, xnn_setup_runtime(runtime, external.size(), external.data()));
+}
@@ -8,10 +8,161 @@
 
 #include <gtest/gtest.h>
 
+#include <xnnpack/common.h>
+#include <xnnpack/isa-checks.h>
+
 #include <xnnpack/lut.h>
 #include "lut-norm-microkernel-tester.h"
 
 
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  TEST(U8_LUT32NORM__NEON, n_eq_16) {
+    TEST_REQUIRES_ARM_NEON;
+    LUTNormMicrokernelTester()
+      .n(16)
+      .Test(xnn_u8_lut32norm_ukernel__neon);
+  }
+
+  TEST(U8_LUT32NORM__NEON, n_div_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 32; n < 160; n += 16) {
+      LUTNormMicrokernelTester()
+        .n(n)
+        .Test(xnn_u8_lut32norm_ukernel__neon);
+    }
+  }
+
+  TEST(U8_LUT32NORM__NEON, n_lt_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 1; n < 16; n++) {
+      LUTNormMicrokernelTester()
+        .n(n)
+        .Test(xnn_u8_lut32norm_ukernel__neon);
+    }
+  }
+
+  TEST(U8_LUT32NORM__NEON, n_gt_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 17; n < 32; n++) {
+      LUTNormMicrokernelTester()
+        .n(n)
+        .Test(xnn_u8_lut32norm_ukernel__neon);
+    }
+  }
+
+  TEST(U8_LUT32NORM__NEON, n_eq_16_inplace) {
+    TEST_REQUIRES_ARM_NEON;
+    LUTNormMicrokernelTester()
+      .n(16)
+      .inplace(true)
+      .Test(xnn_u8_lut32norm_ukernel__neon);
+  }
+
+  TEST(U8_LUT32NORM__NEON, n_div_16_inplace) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 32; n < 160; n += 16) {
+      LUTNormMicrokernelTester()
+        .n(n)
+        .inplace(true)
+        .Test(xnn_u8_lut32norm_ukernel__neon);
+    }
+  }
+
+  TEST(U8_LUT32NORM__NEON, n_lt_16_inplace) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 1; n < 16; n++) {
+      LUTNormMicrokernelTester()
+        .n(n)
+        .inplace(true)
+        .Test(xnn_u8_lut32norm_ukernel__neon);
+    }
+  }
+
+  TEST(U8_LUT32NORM__NEON, n_gt_16_inplace) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 17; n < 32; n++) {
+      LUTNormMicrokernelTester()
+        .n(n)
+        .inplace(true)
+        .Test(xnn_u8_lut32norm_ukernel__neon);
+    }
+  }
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(U8_LUT32NORM__SSE2, n_eq_16) {
+    TEST_REQUIRES_X86_SSE2;
+    LUTNormMicrokernelTester()
+      .n(16)
+      .Test(xnn_u8_lut32norm_ukernel__sse2);
+  }
+
+  TEST(U8_LUT32NORM__SSE2, n_div_16) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t n = 32; n < 160; n += 16) {
+      LUTNormMicrokernelTester()
+        .n(n)
+        .Test(xnn_u8_lut32norm_ukernel__sse2);
+    }
+  }
+
+  TEST(U8_LUT32NORM__SSE2, n_lt_16) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t n = 1; n < 16; n++) {
+      LUTNormMicrokernelTester()
+        .n(n)
+        .Test(xnn_u8_lut32norm_ukernel__sse2);
+    }
+  }
+
+  TEST(U8_LUT32NORM__SSE2, n_gt_16) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t n = 17; n < 32; n++) {
+      LUTNormMicrokernelTester()
+        .n(n)
+        .Test(xnn_u8_lut32norm_ukernel__sse2);
+    }
+  }
+
+  TEST(U8_LUT32NORM__SSE2, n_eq_16_inplace) {
+    TEST_REQUIRES_X86_SSE2;
+    LUTNormMicrokernelTester()
+      .n(16)
+      .inplace(true)
+      .Test(xnn_u8_lut32norm_ukernel__sse2);
+  }
+
+  TEST(U8_LUT32NORM__SSE2, n_div_16_inplace) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t n = 32; n < 160; n += 16) {
+      LUTNormMicrokernelTester()
+        .n(n)
+        .inplace(true)
+        .Test(xnn_u8_lut32norm_ukernel__sse2);
+    }
+  }
+
+  TEST(U8_LUT32NORM__SSE2, n_lt_16_inplace) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t n = 1; n < 16; n++) {
+      LUTNormMicrokernelTester()
+        .n(n)
+        .inplace(true)
+        .Test(xnn_u8_lut32norm_ukernel__sse2);
+    }
+  }
+
+  TEST(U8_LUT32NORM__SSE2, n_gt_16_inplace) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t n = 17; n < 32; n++) {
+      LUTNormMicrokernelTester()
+        .n(n)
+        .inplace(true)
+        .Test(xnn_u8_lut32norm_ukernel__sse2);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
 TEST(U8_LUT32NORM__SCALAR, n_eq_1) {
   LUTNormMicrokernelTester()
     .n(1)
@@ -268,6 +268,15 @@ class UnpoolingOperatorTester {
     }
   }
 
+  inline UnpoolingOperatorTester& double_buffering(bool double_buffering) {
+    this->double_buffering_ = double_buffering;
+    return *this;
+  }
+
+  inline bool double_buffering() const {
+    return this->double_buffering_;
+  }
+
   inline UnpoolingOperatorTester& iterations(size_t iterations) {
     this->iterations_ = iterations;
     return *this;
@@ -429,6 +438,13 @@ class UnpoolingOperatorTester {
         }
       }
 
+      if (double_buffering()) {
+        // Run the second time on different buffers, as if the caller alternated between two sets of buffers.
+        std::vector<uint32_t>(input.size()).swap(input);
+        std::vector<uint32_t>(index.size()).swap(index);
+        std::vector<uint32_t>(output.size()).swap(output);
+      }
+
       // Re-generate data for the second run.
       std::generate(input.begin(), input.end(), std::ref(u32rng));
       std::generate(index.begin(), index.end(), std::ref(idx_rng));
@@ -494,5 +510,6 @@ class UnpoolingOperatorTester {
   size_t next_input_height_{0};
   size_t next_input_width_{0};
   size_t next_batch_size_{0};
+  bool double_buffering_{false};
   size_t iterations_{1};
 };
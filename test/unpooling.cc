@@ -295,3 +295,44 @@ TEST(UNPOOLING_OP_X32, setup_swap_height_and_width) {
     .channels(24)
     .TestSetupX32();
 }
+
+TEST(UNPOOLING_OP_X32, setup_double_buffering) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  UnpoolingOperatorTester()
+    .batch_size(3)
+    .input_height(4)
+    .input_width(4)
+    .pooling_height(5)
+    .pooling_width(3)
+    .channels(24)
+    .double_buffering(true)
+    .TestSetupX32();
+}
+
+TEST(UNPOOLING_OP_X32, setup_double_buffering_decreasing_batch) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  UnpoolingOperatorTester()
+    .batch_size(5)
+    .next_batch_size(3)
+    .input_height(4)
+    .input_width(4)
+    .pooling_height(5)
+    .pooling_width(3)
+    .channels(24)
+    .double_buffering(true)
+    .TestSetupX32();
+}
+
+TEST(UNPOOLING_OP_X32, setup_double_buffering_increasing_batch) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize());
+  UnpoolingOperatorTester()
+    .batch_size(3)
+    .next_batch_size(5)
+    .input_height(4)
+    .input_width(4)
+    .pooling_height(5)
+    .pooling_width(3)
+    .channels(24)
+    .double_buffering(true)
+    .TestSetupX32();
+}
@@ -18,6 +18,8 @@
 #include <random>
 #include <vector>
 
+#include <fp16.h>
+
 #include <xnnpack.h>
 #include <xnnpack/params.h>
 #include <xnnpack/requantization.h>
@@ -58,6 +60,15 @@ class VAddMicrokernelTester {
     return this->inplace_b_;
   }
 
+  inline VAddMicrokernelTester& broadcast_b(bool broadcast_b) {
+    this->broadcast_b_ = broadcast_b;
+    return *this;
+  }
+
+  inline bool broadcast_b() const {
+    return this->broadcast_b_;
+  }
+
   inline VAddMicrokernelTester& a_scale(float a_scale) {
     assert(a_scale > 0.0f);
     assert(std::isnormal(a_scale));
@@ -190,12 +201,13 @@ class VAddMicrokernelTester {
 
       // Compute reference results.
       for (size_t i = 0; i < n(); i++) {
+        const uint8_t b_value = b_data[broadcast_b() ? 0 : i];
         y_fp[i] = float(y_zero_point()) +
           float(int32_t(a_data[i]) - int32_t(a_zero_point())) * (a_scale() / y_scale()) +
-          float(int32_t(b_data[i]) - int32_t(b_zero_point())) * (b_scale() / y_scale());
+          float(int32_t(b_value) - int32_t(b_zero_point())) * (b_scale() / y_scale());
         y_fp[i] = std::min<float>(y_fp[i], float(qmax()));
         y_fp[i] = std::max<float>(y_fp[i], float(qmin()));
-        y_ref[i] = xnn_add_quantize(a_data[i], b_data[i], scalar_quantization_params);
+        y_ref[i] = xnn_add_quantize(a_data[i], b_value, scalar_quantization_params);
       }
 
       // Call optimized micro-kernel.
@@ -273,10 +285,59 @@ class VAddMicrokernelTester {
     }
   }
 
+  void Test(xnn_f16_vadd_ukernel_function vadd, Variant variant = Variant::Native) const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto f32rng = std::bind(std::uniform_real_distribution<float>(0.0f, 1.0f), rng);
+    auto f16rng = std::bind(fp16_ieee_from_fp32_value, f32rng);
+
+    std::vector<uint16_t> a(n() + XNN_EXTRA_BYTES / sizeof(uint16_t));
+    std::vector<uint16_t> b(n() + XNN_EXTRA_BYTES / sizeof(uint16_t));
+    std::vector<uint16_t> y(n() + (inplace_a() || inplace_b() ? XNN_EXTRA_BYTES / sizeof(uint16_t) : 0));
+    std::vector<float> y_ref(n());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(a.begin(), a.end(), std::ref(f16rng));
+      std::generate(b.begin(), b.end(), std::ref(f16rng));
+      if (inplace_a() || inplace_b()) {
+        std::generate(y.begin(), y.end(), std::ref(f16rng));
+      } else {
+        std::fill(y.begin(), y.end(), UINT16_C(0x7E00) /* NaN */);
+      }
+      const uint16_t* a_data = inplace_a() ? y.data() : a.data();
+      const uint16_t* b_data = inplace_b() ? y.data() : b.data();
+
+      // Compute reference results.
+      for (size_t i = 0; i < n(); i++) {
+        y_ref[i] = fp16_ieee_to_fp32_value(a_data[i]) + fp16_ieee_to_fp32_value(b_data[i]);
+      }
+      const float accumulated_min = *std::min_element(y_ref.cbegin(), y_ref.cend());
+      const float accumulated_max = *std::max_element(y_ref.cbegin(), y_ref.cend());
+      const float accumulated_range = accumulated_max - accumulated_min;
+      const float y_max = fp16_ieee_to_fp32_value(fp16_ieee_from_fp32_value(accumulated_max - accumulated_range / 255.0f * float(255 - qmax())));
+      const float y_min = fp16_ieee_to_fp32_value(fp16_ieee_from_fp32_value(accumulated_min + accumulated_range / 255.0f * float(qmin())));
+      for (size_t i = 0; i < n(); i++) {
+        y_ref[i] = std::max<float>(std::min<float>(y_ref[i], y_max), y_min);
+      }
+
+      // Prepare output parameters.
+      const xnn_f16_output_params output_params = xnn_compute_f16_output_params(1.0f, y_min, y_max);
+
+      // Call optimized micro-kernel.
+      vadd(n() * sizeof(uint16_t), a_data, b_data, y.data(), &output_params);
+
+      // Verify results.
+      for (size_t i = 0; i < n(); i++) {
+        ASSERT_NEAR(fp16_ieee_to_fp32_value(y[i]), y_ref[i], std::abs(y_ref[i]) * 1.0e-2f)
+          << "at " << i << ", n = " << n();
+      }
+    }
+  }
+
  private:
   size_t n_{1};
   bool inplace_a_{false};
   bool inplace_b_{false};
+  bool broadcast_b_{false};
   float a_scale_{0.75f};
   float b_scale_{1.25f};
   float y_scale_{0.96875f};
@@ -9,6 +9,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <cstddef>
 #include <cstdlib>
 #include <functional>
@@ -55,6 +56,75 @@ class VMulMicrokernelTester {
     return this->inplace_b_;
   }
 
+  inline VMulMicrokernelTester& broadcast_b(bool broadcast_b) {
+    this->broadcast_b_ = broadcast_b;
+    return *this;
+  }
+
+  inline bool broadcast_b() const {
+    return this->broadcast_b_;
+  }
+
+  inline VMulMicrokernelTester& a_scale(float a_scale) {
+    assert(a_scale > 0.0f);
+    assert(std::isnormal(a_scale));
+    this->a_scale_ = a_scale;
+    return *this;
+  }
+
+  inline float a_scale() const {
+    return this->a_scale_;
+  }
+
+  inline VMulMicrokernelTester& a_zero_point(uint8_t a_zero_point) {
+    this->a_zero_point_ = a_zero_point;
+    return *this;
+  }
+
+  inline uint8_t a_zero_point() const {
+    return this->a_zero_point_;
+  }
+
+  inline VMulMicrokernelTester& b_scale(float b_scale) {
+    assert(b_scale > 0.0f);
+    assert(std::isnormal(b_scale));
+    this->b_scale_ = b_scale;
+    return *this;
+  }
+
+  inline float b_scale() const {
+    return this->b_scale_;
+  }
+
+  inline VMulMicrokernelTester& b_zero_point(uint8_t b_zero_point) {
+    this->b_zero_point_ = b_zero_point;
+    return *this;
+  }
+
+  inline uint8_t b_zero_point() const {
+    return this->b_zero_point_;
+  }
+
+  inline VMulMicrokernelTester& y_scale(float y_scale) {
+    assert(y_scale > 0.0f);
+    assert(std::isnormal(y_scale));
+    this->y_scale_ = y_scale;
+    return *this;
+  }
+
+  inline float y_scale() const {
+    return this->y_scale_;
+  }
+
+  inline VMulMicrokernelTester& y_zero_point(uint8_t y_zero_point) {
+    this->y_zero_point_ = y_zero_point;
+    return *this;
+  }
+
+  inline uint8_t y_zero_point() const {
+    return this->y_zero_point_;
+  }
+
   inline VMulMicrokernelTester& qmin(uint8_t qmin) {
     this->qmin_ = qmin;
     return *this;
@@ -82,6 +152,73 @@ class VMulMicrokernelTester {
     return this->iterations_;
   }
 
+  void Test(xnn_q8_vmul_ukernel_function vmul, Variant variant = Variant::Native) const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto u8rng = std::bind(std::uniform_int_distribution<uint8_t>(), rng);
+
+    std::vector<uint8_t> a(n() + XNN_EXTRA_BYTES / sizeof(uint8_t));
+    std::vector<uint8_t> b(n() + XNN_EXTRA_BYTES / sizeof(uint8_t));
+    std::vector<uint8_t> y(n() + (inplace_a() || inplace_b() ? XNN_EXTRA_BYTES / sizeof(uint8_t) : 0));
+    std::vector<float> y_fp(n());
+    std::vector<uint8_t> y_ref(n());
+    const float product_scale = a_scale() * b_scale() / y_scale();
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(a.begin(), a.end(), std::ref(u8rng));
+      std::generate(b.begin(), b.end(), std::ref(u8rng));
+      if (inplace_a() || inplace_b()) {
+        std::generate(y.begin(), y.end(), std::ref(u8rng));
+      } else {
+        std::fill(y.begin(), y.end(), 0xA5);
+      }
+      const uint8_t* a_data = inplace_a() ? y.data() : a.data();
+      const uint8_t* b_data = inplace_b() ? y.data() : b.data();
+
+      // Prepare quantization parameters.
+      xnn_q8_gemm_params quantization_params = { };
+      switch (variant) {
+        case Variant::Native:
+          quantization_params = xnn_compute_q8_gemm_params(
+            a_zero_point(), b_zero_point(), product_scale, y_zero_point(), qmin(), qmax());
+          break;
+        case Variant::Scalar:
+          quantization_params = xnn_compute_scalar_q8_gemm_params(
+            a_zero_point(), b_zero_point(), product_scale, y_zero_point(), qmin(), qmax());
+          break;
+      }
+      const xnn_q8_gemm_params scalar_quantization_params =
+        xnn_compute_scalar_q8_gemm_params(
+          a_zero_point(), b_zero_point(), product_scale, y_zero_point(), qmin(), qmax());
+
+      // Compute reference results.
+      for (size_t i = 0; i < n(); i++) {
+        const uint8_t b_value = b_data[broadcast_b() ? 0 : i];
+        y_fp[i] = float(y_zero_point()) + product_scale *
+          float(int32_t(a_data[i]) - int32_t(a_zero_point())) *
+          float(int32_t(b_value) - int32_t(b_zero_point()));
+        y_fp[i] = std::min<float>(y_fp[i], float(qmax()));
+        y_fp[i] = std::max<float>(y_fp[i], float(qmin()));
+        y_ref[i] = xnn_mul_quantize(a_data[i], b_value, scalar_quantization_params);
+      }
+
+      // Call optimized micro-kernel.
+      vmul(n(), a_data, b_data, y.data(), &quantization_params);
+
+      // Verify results.
+      for (size_t i = 0; i < n(); i++) {
+        ASSERT_LE(uint32_t(y[i]), uint32_t(qmax()))
+          << "at " << i << ", n = " << n();
+        ASSERT_GE(uint32_t(y[i]), uint32_t(qmin()))
+          << "at " << i << ", n = " << n();
+        // Q31 fixed-point requantization rounds twice, so the result may be off by up to 0.75 from the exact value.
+        ASSERT_NEAR(float(int32_t(y[i])), y_fp[i], 0.8f)
+          << "at " << i << ", n = " << n();
+        ASSERT_EQ(uint32_t(y_ref[i]), uint32_t(y[i]))
+          << "at " << i << ", n = " << n();
+      }
+    }
+  }
+
   void Test(xnn_f32_vmul_ukernel_function vmul, Variant variant = Variant::Native) const {
     std::random_device random_device;
     auto rng = std::mt19937(random_device());
@@ -144,6 +281,13 @@ class VMulMicrokernelTester {
   size_t n_{1};
   bool inplace_a_{false};
   bool inplace_b_{false};
+  bool broadcast_b_{false};
+  float a_scale_{0.75f};
+  float b_scale_{1.25f};
+  float y_scale_{1.5f};
+  uint8_t a_zero_point_{121};
+  uint8_t b_zero_point_{127};
+  uint8_t y_zero_point_{133};
   uint8_t qmin_{0};
   uint8_t qmax_{255};
   size_t iterations_{15};
@@ -0,0 +1,135 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include <xnnpack.h>
+#include <xnnpack/params.h>
+#include <xnnpack/requantization.h>
+
+
+class VQuantizeMicrokernelTester {
+ public:
+  enum class Variant {
+    Native,
+    Scalar,
+  };
+
+  inline VQuantizeMicrokernelTester& n(size_t n) {
+    assert(n != 0);
+    this->n_ = n;
+    return *this;
+  }
+
+  inline size_t n() const {
+    return this->n_;
+  }
+
+  inline VQuantizeMicrokernelTester& scale(float scale) {
+    assert(scale > 0.0f);
+    assert(std::isnormal(scale));
+    this->scale_ = scale;
+    return *this;
+  }
+
+  inline float scale() const {
+    return this->scale_;
+  }
+
+  inline VQuantizeMicrokernelTester& zero_point(uint8_t zero_point) {
+    this->zero_point_ = zero_point;
+    return *this;
+  }
+
+  inline uint8_t zero_point() const {
+    return this->zero_point_;
+  }
+
+  inline VQuantizeMicrokernelTester& qmin(uint8_t qmin) {
+    this->qmin_ = qmin;
+    return *this;
+  }
+
+  inline uint8_t qmin() const {
+    return this->qmin_;
+  }
+
+  inline VQuantizeMicrokernelTester& qmax(uint8_t qmax) {
+    this->qmax_ = qmax;
+    return *this;
+  }
+
+  inline uint8_t qmax() const {
+    return this->qmax_;
+  }
+
+  inline VQuantizeMicrokernelTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void Test(xnn_f32_vquantize_ukernel_function vquantize, Variant variant = Variant::Native) const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto f32rng = std::bind(std::uniform_real_distribution<float>(-1.0f, 1.0f), rng);
+
+    std::vector<float> x(n() + XNN_EXTRA_BYTES / sizeof(float));
+    std::vector<uint8_t> y(n());
+    std::vector<uint8_t> y_ref(n());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(x.begin(), x.end(), std::ref(f32rng));
+      std::fill(y.begin(), y.end(), 0xA5);
+
+      // Prepare quantization parameters.
+      union xnn_f32_q8_quantization_params quantization_params = { };
+      switch (variant) {
+        case Variant::Native:
+          quantization_params = xnn_compute_f32_q8_quantization_params(scale(), zero_point(), qmin(), qmax());
+          break;
+        case Variant::Scalar:
+          quantization_params = xnn_compute_scalar_f32_q8_quantization_params(scale(), zero_point(), qmin(), qmax());
+          break;
+      }
+
+      // Compute reference results.
+      for (size_t i = 0; i < n(); i++) {
+        const long y_value = std::lrint(x[i] * scale()) + long(zero_point());
+        y_ref[i] = uint8_t(std::max<long>(std::min<long>(y_value, long(qmax())), long(qmin())));
+      }
+
+      // Call optimized micro-kernel.
+      vquantize(n() * sizeof(float), x.data(), y.data(), &quantization_params);
+
+      // Verify results.
+      for (size_t i = 0; i < n(); i++) {
+        ASSERT_EQ(uint32_t(y_ref[i]), uint32_t(y[i]))
+          << "at position " << i << ", n = " << n() << ", x = " << x[i];
+      }
+    }
+  }
+
+ private:
+  size_t n_{1};
+  float scale_{200.0f};
+  uint8_t zero_point_{128};
+  uint8_t qmin_{0};
+  uint8_t qmax_{255};
+  size_t iterations_{15};
+};
@@ -0,0 +1,109 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include <xnnpack.h>
+#include <xnnpack/params.h>
+
+
+class VUnOpMicrokernelTester {
+ public:
+  enum class OpType {
+    Sigmoid,
+    TanH,
+  };
+
+  inline VUnOpMicrokernelTester& n(size_t n) {
+    assert(n != 0);
+    this->n_ = n;
+    return *this;
+  }
+
+  inline size_t n() const {
+    return this->n_;
+  }
+
+  inline VUnOpMicrokernelTester& inplace(bool inplace) {
+    this->inplace_ = inplace;
+    return *this;
+  }
+
+  inline bool inplace() const {
+    return this->inplace_;
+  }
+
+  inline VUnOpMicrokernelTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void Test(xnn_f32_vunary_ukernel_function vunary, OpType op_type) const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    // The input range covers the saturation regions of both functions.
+    auto f32rng = std::bind(
+      std::uniform_real_distribution<float>(op_type == OpType::Sigmoid ? -25.0f : -10.0f,
+                                            op_type == OpType::Sigmoid ? 25.0f : 10.0f),
+      rng);
+
+    std::vector<float> x(n() + XNN_EXTRA_BYTES / sizeof(float));
+    std::vector<float> y(n() + (inplace() ? XNN_EXTRA_BYTES / sizeof(float) : 0));
+    std::vector<double> y_ref(n());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(x.begin(), x.end(), std::ref(f32rng));
+      if (inplace()) {
+        std::generate(y.begin(), y.end(), std::ref(f32rng));
+      } else {
+        std::fill(y.begin(), y.end(), std::nanf(""));
+      }
+      const float* x_data = inplace() ? y.data() : x.data();
+
+      // Compute reference results.
+      for (size_t i = 0; i < n(); i++) {
+        switch (op_type) {
+          case OpType::Sigmoid:
+          {
+            const double e = std::exp(double(x_data[i]));
+            y_ref[i] = e / (1.0 + e);
+            break;
+          }
+          case OpType::TanH:
+            y_ref[i] = std::tanh(double(x_data[i]));
+            break;
+        }
+      }
+
+      // Call optimized micro-kernel.
+      vunary(n() * sizeof(float), x_data, y.data(), nullptr);
+
+      // Verify results.
+      for (size_t i = 0; i < n(); i++) {
+        ASSERT_NEAR(y[i], y_ref[i], std::abs(y_ref[i]) * 5.0e-6)
+          << "at position " << i << ", n = " << n() << ", x[i] = " << x_data[i];
+      }
+    }
+  }
+
+ private:
+  size_t n_{1};
+  bool inplace_{false};
+  size_t iterations_{15};
+};
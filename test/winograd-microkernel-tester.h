@@ -0,0 +1,248 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include <xnnpack.h>
+#include <xnnpack/params.h>
+#include <xnnpack/requantization.h>
+
+
+class WinogradMicrokernelTester {
+ public:
+  enum class Variant {
+    Native,
+    Scalar,
+  };
+
+  inline WinogradMicrokernelTester& channels(size_t channels) {
+    assert(channels != 0);
+    this->channels_ = channels;
+    return *this;
+  }
+
+  inline size_t channels() const {
+    return this->channels_;
+  }
+
+  inline WinogradMicrokernelTester& rows(size_t rows) {
+    assert(rows != 0);
+    assert(rows <= 4);
+    this->rows_ = rows;
+    return *this;
+  }
+
+  inline size_t rows() const {
+    return this->rows_;
+  }
+
+  inline WinogradMicrokernelTester& columns(size_t columns) {
+    assert(columns != 0);
+    assert(columns <= 4);
+    this->columns_ = columns;
+    return *this;
+  }
+
+  inline size_t columns() const {
+    return this->columns_;
+  }
+
+  inline WinogradMicrokernelTester& input_stride(size_t input_stride) {
+    this->input_stride_ = input_stride;
+    return *this;
+  }
+
+  inline size_t input_stride() const {
+    return this->input_stride_ == 0 ? channels() : this->input_stride_;
+  }
+
+  inline WinogradMicrokernelTester& output_stride(size_t output_stride) {
+    this->output_stride_ = output_stride;
+    return *this;
+  }
+
+  inline size_t output_stride() const {
+    return this->output_stride_ == 0 ? channels() : this->output_stride_;
+  }
+
+  inline WinogradMicrokernelTester& qmin(uint8_t qmin) {
+    this->qmin_ = qmin;
+    return *this;
+  }
+
+  inline uint8_t qmin() const {
+    return this->qmin_;
+  }
+
+  inline WinogradMicrokernelTester& qmax(uint8_t qmax) {
+    this->qmax_ = qmax;
+    return *this;
+  }
+
+  inline uint8_t qmax() const {
+    return this->qmax_;
+  }
+
+  inline WinogradMicrokernelTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void Test(xnn_f32_winograd_input_ukernel_function winograd_input) const {
+    // Winograd F(4x4, 3x3) input transform matrix B^T.
+    static const float kBT[6][6] = {
+      { 4.0f,  0.0f, -5.0f,  0.0f, 1.0f, 0.0f },
+      { 0.0f, -4.0f, -4.0f,  1.0f, 1.0f, 0.0f },
+      { 0.0f,  4.0f, -4.0f, -1.0f, 1.0f, 0.0f },
+      { 0.0f, -2.0f, -1.0f,  2.0f, 1.0f, 0.0f },
+      { 0.0f,  2.0f, -1.0f, -2.0f, 1.0f, 0.0f },
+      { 0.0f,  4.0f,  0.0f, -5.0f, 0.0f, 1.0f },
+    };
+
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto f32rng = std::bind(std::uniform_real_distribution<float>(-1.0f, 1.0f), rng);
+
+    std::vector<float> input(35 * input_stride() + channels() + XNN_EXTRA_BYTES / sizeof(float));
+    std::vector<const float*> window(36);
+    std::vector<float> output(35 * output_stride() + channels());
+    std::vector<double> output_ref(36 * channels());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(f32rng));
+      std::fill(output.begin(), output.end(), nanf(""));
+
+      // Shuffle window pointers to check that the micro-kernel doesn't assume any input layout.
+      for (size_t i = 0; i < 36; i++) {
+        window[i] = input.data() + i * input_stride();
+      }
+      std::shuffle(window.begin(), window.end(), rng);
+
+      // Compute reference results: V := B^T d B.
+      for (size_t c = 0; c < channels(); c++) {
+        for (size_t i = 0; i < 6; i++) {
+          for (size_t j = 0; j < 6; j++) {
+            double v = 0.0;
+            for (size_t y = 0; y < 6; y++) {
+              for (size_t x = 0; x < 6; x++) {
+                v += double(kBT[i][y]) * double(kBT[j][x]) * double(window[y * 6 + x][c]);
+              }
+            }
+            output_ref[(i * 6 + j) * channels() + c] = v;
+          }
+        }
+      }
+
+      // Call optimized micro-kernel.
+      winograd_input(channels(), window.data(), output.data(), output_stride() * sizeof(float));
+
+      // Verify results.
+      for (size_t p = 0; p < 36; p++) {
+        for (size_t c = 0; c < channels(); c++) {
+          ASSERT_NEAR(output[p * output_stride() + c], output_ref[p * channels() + c], 1.0e-4)
+            << "at position " << p << ", channel " << c << " / " << channels();
+        }
+      }
+    }
+  }
+
+  void Test(xnn_f32_winograd_output_ukernel_function winograd_output, Variant variant = Variant::Native) const {
+    // Winograd F(4x4, 3x3) output transform matrix A^T.
+    static const float kAT[4][6] = {
+      { 1.0f, 1.0f,  1.0f, 1.0f,  1.0f, 0.0f },
+      { 0.0f, 1.0f, -1.0f, 2.0f, -2.0f, 0.0f },
+      { 0.0f, 1.0f,  1.0f, 4.0f,  4.0f, 0.0f },
+      { 0.0f, 1.0f, -1.0f, 8.0f, -8.0f, 1.0f },
+    };
+
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto f32rng = std::bind(std::uniform_real_distribution<float>(-1.0f, 1.0f), rng);
+
+    std::vector<float> input(35 * input_stride() + channels() + XNN_EXTRA_BYTES / sizeof(float));
+    std::vector<float> output(((rows() - 1) * 4 + columns() - 1) * output_stride() + channels());
+    std::vector<float> output_ref(rows() * columns() * channels());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(f32rng));
+      std::fill(output.begin(), output.end(), nanf(""));
+
+      // Compute reference results: Y := A^T M A.
+      for (size_t y = 0; y < rows(); y++) {
+        for (size_t x = 0; x < columns(); x++) {
+          for (size_t c = 0; c < channels(); c++) {
+            double v = 0.0;
+            for (size_t i = 0; i < 6; i++) {
+              for (size_t j = 0; j < 6; j++) {
+                v += double(kAT[y][i]) * double(kAT[x][j]) * double(input[(i * 6 + j) * input_stride() + c]);
+              }
+            }
+            output_ref[(y * columns() + x) * channels() + c] = float(v);
+          }
+        }
+      }
+      const float accumulated_min = *std::min_element(output_ref.cbegin(), output_ref.cend());
+      const float accumulated_max = *std::max_element(output_ref.cbegin(), output_ref.cend());
+      const float accumulated_range = accumulated_max - accumulated_min;
+      const float output_max = accumulated_max - accumulated_range / 255.0f * float(255 - qmax());
+      const float output_min = accumulated_min + accumulated_range / 255.0f * float(qmin());
+      for (float& output_value : output_ref) {
+        output_value = std::max<float>(std::min<float>(output_value, output_max), output_min);
+      }
+
+      // Prepare output parameters.
+      xnn_f32_output_params output_params = { };
+      switch (variant) {
+        case Variant::Native:
+          output_params = xnn_compute_f32_output_params(output_min, output_max);
+          break;
+        case Variant::Scalar:
+          output_params = xnn_compute_scalar_f32_output_params(output_min, output_max);
+          break;
+      }
+
+      // Call optimized micro-kernel. The output tile is 4 pixels wide, and only the top-left rows x columns pixels are
+      // written.
+      winograd_output(
+        rows(), columns(), channels(),
+        input.data(), input_stride() * sizeof(float),
+        output.data(), 4 * output_stride() * sizeof(float), output_stride() * sizeof(float),
+        &output_params);
+
+      // Verify results.
+      for (size_t y = 0; y < rows(); y++) {
+        for (size_t x = 0; x < columns(); x++) {
+          for (size_t c = 0; c < channels(); c++) {
+            ASSERT_NEAR(output[(y * 4 + x) * output_stride() + c], output_ref[(y * columns() + x) * channels() + c], 1.0e-3f)
+              << "at pixel (" << x << ", " << y << "), channel " << c << " / " << channels();
+          }
+        }
+      }
+    }
+  }
+
+ private:
+  size_t channels_{1};
+  size_t rows_{4};
+  size_t columns_{4};
+  size_t input_stride_{0};
+  size_t output_stride_{0};
+  uint8_t qmin_{0};
+  uint8_t qmax_{255};
+  size_t iterations_{15};
+};
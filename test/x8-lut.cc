@@ -8,10 +8,235 @@
 
 #include <gtest/gtest.h>
 
+#include <xnnpack/common.h>
+#include <xnnpack/isa-checks.h>
+
 #include <xnnpack/lut.h>
 #include "lut-microkernel-tester.h"
 
 
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  TEST(X8_LUT__NEON_X16, n_eq_16) {
+    TEST_REQUIRES_ARM_NEON;
+    LUTMicrokernelTester()
+      .n(16)
+      .Test(xnn_x8_lut_ukernel__neon_x16);
+  }
+
+  TEST(X8_LUT__NEON_X16, n_div_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 32; n < 160; n += 16) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__neon_x16);
+    }
+  }
+
+  TEST(X8_LUT__NEON_X16, n_lt_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 1; n < 16; n++) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__neon_x16);
+    }
+  }
+
+  TEST(X8_LUT__NEON_X16, n_gt_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 17; n < 32; n++) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__neon_x16);
+    }
+  }
+
+  TEST(X8_LUT__NEON_X16, n_eq_16_inplace) {
+    TEST_REQUIRES_ARM_NEON;
+    LUTMicrokernelTester()
+      .n(16)
+      .inplace(true)
+      .Test(xnn_x8_lut_ukernel__neon_x16);
+  }
+
+  TEST(X8_LUT__NEON_X16, n_div_16_inplace) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 32; n < 160; n += 16) {
+      LUTMicrokernelTester()
+        .n(n)
+        .inplace(true)
+        .Test(xnn_x8_lut_ukernel__neon_x16);
+    }
+  }
+
+  TEST(X8_LUT__NEON_X16, n_lt_16_inplace) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 1; n < 16; n++) {
+      LUTMicrokernelTester()
+        .n(n)
+        .inplace(true)
+        .Test(xnn_x8_lut_ukernel__neon_x16);
+    }
+  }
+
+  TEST(X8_LUT__NEON_X16, n_gt_16_inplace) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 17; n < 32; n++) {
+      LUTMicrokernelTester()
+        .n(n)
+        .inplace(true)
+        .Test(xnn_x8_lut_ukernel__neon_x16);
+    }
+  }
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(X8_LUT__SSSE3_X16, n_eq_16) {
+    TEST_REQUIRES_X86_SSSE3;
+    LUTMicrokernelTester()
+      .n(16)
+      .Test(xnn_x8_lut_ukernel__ssse3_x16);
+  }
+
+  TEST(X8_LUT__SSSE3_X16, n_div_16) {
+    TEST_REQUIRES_X86_SSSE3;
+    for (size_t n = 32; n < 160; n += 16) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__ssse3_x16);
+    }
+  }
+
+  TEST(X8_LUT__SSSE3_X16, n_lt_16) {
+    TEST_REQUIRES_X86_SSSE3;
+    for (size_t n = 1; n < 16; n++) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__ssse3_x16);
+    }
+  }
+
+  TEST(X8_LUT__SSSE3_X16, n_gt_16) {
+    TEST_REQUIRES_X86_SSSE3;
+    for (size_t n = 17; n < 32; n++) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__ssse3_x16);
+    }
+  }
+
+  TEST(X8_LUT__SSSE3_X16, n_eq_16_inplace) {
+    TEST_REQUIRES_X86_SSSE3;
+    LUTMicrokernelTester()
+      .n(16)
+      .inplace(true)
+      .Test(xnn_x8_lut_ukernel__ssse3_x16);
+  }
+
+  TEST(X8_LUT__SSSE3_X16, n_div_16_inplace) {
+    TEST_REQUIRES_X86_SSSE3;
+    for (size_t n = 32; n < 160; n += 16) {
+      LUTMicrokernelTester()
+        .n(n)
+        .inplace(true)
+        .Test(xnn_x8_lut_ukernel__ssse3_x16);
+    }
+  }
+
+  TEST(X8_LUT__SSSE3_X16, n_lt_16_inplace) {
+    TEST_REQUIRES_X86_SSSE3;
+    for (size_t n = 1; n < 16; n++) {
+      LUTMicrokernelTester()
+        .n(n)
+        .inplace(true)
+        .Test(xnn_x8_lut_ukernel__ssse3_x16);
+    }
+  }
+
+  TEST(X8_LUT__SSSE3_X16, n_gt_16_inplace) {
+    TEST_REQUIRES_X86_SSSE3;
+    for (size_t n = 17; n < 32; n++) {
+      LUTMicrokernelTester()
+        .n(n)
+        .inplace(true)
+        .Test(xnn_x8_lut_ukernel__ssse3_x16);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(X8_LUT__AVX2_X32, n_eq_32) {
+    TEST_REQUIRES_X86_AVX2;
+    LUTMicrokernelTester()
+      .n(32)
+      .Test(xnn_x8_lut_ukernel__avx2_x32);
+  }
+
+  TEST(X8_LUT__AVX2_X32, n_div_32) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 64; n < 320; n += 32) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__avx2_x32);
+    }
+  }
+
+  TEST(X8_LUT__AVX2_X32, n_lt_32) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 1; n < 32; n++) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__avx2_x32);
+    }
+  }
+
+  TEST(X8_LUT__AVX2_X32, n_gt_32) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 33; n < 64; n++) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__avx2_x32);
+    }
+  }
+
+  TEST(X8_LUT__AVX2_X32, n_eq_32_inplace) {
+    TEST_REQUIRES_X86_AVX2;
+    LUTMicrokernelTester()
+      .n(32)
+      .inplace(true)
+      .Test(xnn_x8_lut_ukernel__avx2_x32);
+  }
+
+  TEST(X8_LUT__AVX2_X32, n_div_32_inplace) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 64; n < 320; n += 32) {
+      LUTMicrokernelTester()
+        .n(n)
+        .inplace(true)
+        .Test(xnn_x8_lut_ukernel__avx2_x32);
+    }
+  }
+
+  TEST(X8_LUT__AVX2_X32, n_lt_32_inplace) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 1; n < 32; n++) {
+      LUTMicrokernelTester()
+        .n(n)
+        .inplace(true)
+        .Test(xnn_x8_lut_ukernel__avx2_x32);
+    }
+  }
+
+  TEST(X8_LUT__AVX2_X32, n_gt_32_inplace) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 33; n < 64; n++) {
+      LUTMicrokernelTester()
+        .n(n)
+        .inplace(true)
+        .Test(xnn_x8_lut_ukernel__avx2_x32);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
 TEST(X8_LUT__SCALAR, n_eq_1) {
   LUTMicrokernelTester()
     .n(1)
@@ -54,6 +54,7 @@ ISA_TO_ARCH_MAP = {
   "sse": ["x86", "x86-64"],
   "sse2": ["x86", "x86-64"],
   "avx": ["x86", "x86-64"],
+  "f16c": ["x86", "x86-64"],
   "avx512f": ["x86", "x86-64"],
   "psimd": [],
 }
@@ -65,6 +66,7 @@ ISA_TO_CHECK_MAP = {
   "sse": "TEST_REQUIRES_X86_SSE",
   "sse2": "TEST_REQUIRES_X86_SSE2",
   "avx": "TEST_REQUIRES_X86_AVX",
+  "f16c": "TEST_REQUIRES_X86_F16C",
   "avx512f": "TEST_REQUIRES_X86_AVX512F",
   "psimd": "TEST_REQUIRES_PSIMD",
 }
@@ -74,7 +76,8 @@ def split_ukernel_name(name):
   common_name, target_name = name.split("__", 1)
   common_parts = common_name.split("_")
   param_spec = common_parts[-1]
-  assert param_spec.startswith("up")
+  assert param_spec.startswith("up") or param_spec.startswith("mp")
+  multipass = param_spec.startswith("mp")
   cr, kr = map(int, param_spec[2:].split("x"))
   arch = list()
   isa = None
@@ -85,7 +88,7 @@ def split_ukernel_name(name):
       isa = target_part
   if isa and not arch:
     arch = ISA_TO_ARCH_MAP[isa]
-  return cr, kr, arch, isa
+  return cr, kr, multipass, arch, isa
 
 
 DWCONV_TEST_CODE = """\
@@ -270,7 +273,76 @@ TEST(${TEST_NAME}, multipixel_with_qmax) {
   }
 }
 
-$if DATATYPE == "q8":
+$if IS_MULTIPASS:
+  TEST(${TEST_NAME}, kernel_size_lt_${QR}) {
+    $if ISA_CHECK:
+      ${ISA_CHECK};
+    for (uint32_t kernel_size = 1; kernel_size < ${QR}; kernel_size++) {
+      for (uint32_t channels = 1; channels <= ${CBLOCK * 3}; channels += ${max(1, CBLOCK - 1)}) {
+        DWConvMicrokernelTester()
+          .cr(${CR})
+          .kr(kernel_size)
+          .channels(channels)
+          .Test(${", ".join(TEST_ARGS)});
+      }
+    }
+  }
+
+  TEST(${TEST_NAME}, kernel_size_eq_${QR}) {
+    $if ISA_CHECK:
+      ${ISA_CHECK};
+    for (uint32_t channels = 1; channels <= ${CBLOCK * 3}; channels += ${max(1, CBLOCK - 1)}) {
+      DWConvMicrokernelTester()
+        .cr(${CR})
+        .kr(${QR})
+        .channels(channels)
+        .Test(${", ".join(TEST_ARGS)});
+    }
+  }
+
+  TEST(${TEST_NAME}, kernel_size_div_${QR}) {
+    $if ISA_CHECK:
+      ${ISA_CHECK};
+    for (uint32_t kernel_size = ${QR * 2}; kernel_size <= ${QR * 4}; kernel_size += ${QR}) {
+      for (uint32_t channels = 1; channels <= ${CBLOCK * 3}; channels += ${max(1, CBLOCK - 1)}) {
+        DWConvMicrokernelTester()
+          .cr(${CR})
+          .kr(kernel_size)
+          .channels(channels)
+          .Test(${", ".join(TEST_ARGS)});
+      }
+    }
+  }
+
+  TEST(${TEST_NAME}, kernel_size_gt_${QR}) {
+    $if ISA_CHECK:
+      ${ISA_CHECK};
+    for (uint32_t kernel_size = ${QR + 1}; kernel_size < ${QR * 2}; kernel_size++) {
+      for (uint32_t channels = 1; channels <= ${CBLOCK * 3}; channels += ${max(1, CBLOCK - 1)}) {
+        DWConvMicrokernelTester()
+          .cr(${CR})
+          .kr(kernel_size)
+          .channels(channels)
+          .Test(${", ".join(TEST_ARGS)});
+      }
+    }
+  }
+
+  TEST(${TEST_NAME}, kernel_size_eq_49) {
+    $if ISA_CHECK:
+      ${ISA_CHECK};
+    for (uint32_t channels = 1; channels <= ${CBLOCK * 3}; channels += ${max(1, CBLOCK - 1)}) {
+      DWConvMicrokernelTester()
+        .cr(${CR})
+        .kr(49)
+        .channels(channels)
+        .width(3)
+        .step(7)
+        .Test(${", ".join(TEST_ARGS)});
+    }
+  }
+
+$if DATATYPE in ["q8", "q8c"]:
   TEST(${TEST_NAME}, input_zero_point_only) {
     $if ISA_CHECK:
       ${ISA_CHECK};
@@ -303,15 +375,19 @@ $if DATATYPE == "q8":
 """
 
 
-def generate_test_cases(ukernel, cr, kr, c_block, is_pipelined, isa):
+def generate_test_cases(ukernel, cr, kr, c_block, is_multipass, is_pipelined, isa):
   """Generates all tests cases for a DWCONV micro-kernel.
 
   Args:
     ukernel: C name of the micro-kernel function.
     cr: CR parameter of the DWCONV micro-kernel.
-    kr: KR parameter of the DWCONV micro-kernel.
+    kr: KR parameter of the unipass DWCONV micro-kernel, or QR parameter (number
+        of kernel taps per pass) of the multipass DWCONV micro-kernel.
     k_block: Number of C values processed per one iteration of the main loop of
              the micro-kernel.
+    is_multipass: Indicates if the micro-kernel processes an arbitrary number
+                  of kernel taps in multiple passes. Generic test cases use a
+                  kernel with two full passes and one remainder tap.
     is_pipelined: Indicates if the micro-kernel is implemented with software
                   pipelining. Additional test cases are generated for software
                   pipelined micro-kernels to separately test prologue + epiloque
@@ -333,7 +409,9 @@ def generate_test_cases(ukernel, cr, kr, c_block, is_pipelined, isa):
       "UKERNEL_TYPE": ukernel_type.upper(),
       "DATATYPE": datatype,
       "CR": cr,
-      "KR": kr,
+      "KR": 2 * kr + 1 if is_multipass else kr,
+      "QR": kr,
+      "IS_MULTIPASS": is_multipass,
       "CBLOCK": c_block,
       "ADJCBLOCK": 2 * c_block if is_pipelined else c_block,
       "IS_PIPELINED": is_pipelined,
@@ -377,12 +455,12 @@ def main(args):
     for ukernel_spec in spec_yaml:
       name = ukernel_spec["name"]
       pipelined = bool(ukernel_spec.get("pipelined", False))
-      cr, kr, arch, isa = split_ukernel_name(name)
+      cr, kr, multipass, arch, isa = split_ukernel_name(name)
 
       # specification can override architecture
       arch = ukernel_spec.get("arch", arch)
 
-      test_case = generate_test_cases(name, cr, kr, cr, pipelined, isa)
+      test_case = generate_test_cases(name, cr, kr, cr, multipass, pipelined, isa)
       test_case = remove_duplicate_newlines(test_case)
       tests += "\n\n"
       if arch:
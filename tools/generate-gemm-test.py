@@ -49,10 +49,15 @@ ARCH_TO_MACRO_MAP = {
 ISA_TO_ARCH_MAP = {
   "neon": ["aarch32", "aarch64"],
   "neonfma": ["aarch32", "aarch64"],
+  "neonfp16": ["aarch32", "aarch64"],
   "neonfp16arith": ["aarch32", "aarch64"],
   "sse": ["x86", "x86-64"],
   "sse2": ["x86", "x86-64"],
+  "sse41": ["x86", "x86-64"],
   "avx": ["x86", "x86-64"],
+  "f16c": ["x86", "x86-64"],
+  "avx2": ["x86", "x86-64"],
+  "fma3": ["x86", "x86-64"],
   "avx512f": ["x86", "x86-64"],
   "psimd": [],
 }
@@ -60,10 +65,15 @@ ISA_TO_ARCH_MAP = {
 ISA_TO_CHECK_MAP = {
   "neon": "TEST_REQUIRES_ARM_NEON",
   "neonfma": "TEST_REQUIRES_ARM_NEON_FMA",
+  "neonfp16": "TEST_REQUIRES_ARM_NEON_FP16",
   "neonfp16arith": "TEST_REQUIRES_ARM_NEON_FP16_ARITH",
   "sse": "TEST_REQUIRES_X86_SSE",
   "sse2": "TEST_REQUIRES_X86_SSE2",
+  "sse41": "TEST_REQUIRES_X86_SSE41",
   "avx": "TEST_REQUIRES_X86_AVX",
+  "f16c": "TEST_REQUIRES_X86_F16C",
+  "avx2": "TEST_REQUIRES_X86_AVX2",
+  "fma3": "TEST_REQUIRES_X86_FMA3",
   "avx512f": "TEST_REQUIRES_X86_AVX512F",
   "psimd": "TEST_REQUIRES_PSIMD",
 }
@@ -754,7 +764,7 @@ TEST(${TEST_NAME}, strided_cm) {
     .Test(${", ".join(TEST_ARGS)});
 }
 
-$if DATATYPE == "q8":
+$if DATATYPE in ["q8", "q8c", "q8dq"]:
   TEST(${TEST_NAME}, no_a_zero_point) {
     $if ISA_CHECK:
       ${ISA_CHECK};
@@ -832,7 +842,10 @@ def generate_test_cases(ukernel, mr, nr, kr, sr,
     Code for the test case.
   """
   _, test_name = ukernel.split("_", 1)
-  _, datatype, ukernel_type, _ = ukernel.split("_", 3)
+  # The datatype may span several components, e.g. xnn_f32_f16w_gemm_ukernel_*
+  common_parts = ukernel.split("_ukernel_", 1)[0].split("_")
+  datatype = "_".join(common_parts[1:-1])
+  ukernel_type = common_parts[-1]
   test_args = [ukernel]
   if not isa or isa == "psimd":
     test_args.append("GemmMicrokernelTester::Variant::Scalar")
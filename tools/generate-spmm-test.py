@@ -53,6 +53,7 @@ ISA_TO_ARCH_MAP = {
   "sse": ["x86", "x86-64"],
   "sse2": ["x86", "x86-64"],
   "avx": ["x86", "x86-64"],
+  "fma3": ["x86", "x86-64"],
   "avx512f": ["x86", "x86-64"],
   "psimd": [],
 }
@@ -64,6 +65,7 @@ ISA_TO_CHECK_MAP = {
   "sse": "TEST_REQUIRES_X86_SSE",
   "sse2": "TEST_REQUIRES_X86_SSE2",
   "avx": "TEST_REQUIRES_X86_AVX",
+  "fma3": "TEST_REQUIRES_X86_FMA3",
   "avx512f": "TEST_REQUIRES_X86_AVX512F",
   "psimd": "TEST_REQUIRES_PSIMD",
 }
@@ -0,0 +1,318 @@
+#!/usr/bin/env python
+# Copyright 2019 Google LLC
+#
+# This source code is licensed under the BSD-style license found in the
+# LICENSE file in the root directory of this source tree.
+
+import argparse
+import codecs
+import os
+import re
+import sys
+import yaml
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from primes import next_prime
+import xngen
+
+
+parser = argparse.ArgumentParser(description='XNNPACK generator')
+parser.add_argument("-s", "--spec", metavar="FILE", required=True,
+                    help="Spec (YAML) file")
+parser.add_argument("-o", "--output", metavar="FILE", required=True,
+                    help='Output (C++ source) file')
+parser.add_argument("-t", "--tester", metavar="TESTER", required=True,
+                    choices=["VBinOpMicrokernelTester", "VBinOpCMicrokernelTester"],
+                    help="Tester class to be used in the generated test")
+parser.set_defaults(defines=list())
+
+
+def indent(text):
+  return "\n".join(map(lambda t: "  " + t if t else t, text.splitlines()))
+
+
+def remove_duplicate_newlines(text):
+  filtered_lines = list()
+  last_newline = False
+  for line in text.splitlines():
+    is_newline = len(line.strip()) == 0
+    if not is_newline or not last_newline:
+      filtered_lines.append(line)
+    last_newline = is_newline
+  return "\n".join(filtered_lines)
+
+
+ARCH_TO_MACRO_MAP = {
+  "aarch32": "XNN_ARCH_ARM",
+  "aarch64": "XNN_ARCH_ARM64",
+  "x86": "XNN_ARCH_X86",
+  "x86-64": "XNN_ARCH_X86_64",
+}
+
+ISA_TO_ARCH_MAP = {
+  "neon": ["aarch32", "aarch64"],
+  "neonfma": ["aarch32", "aarch64"],
+  "neonfp16arith": ["aarch32", "aarch64"],
+  "sse": ["x86", "x86-64"],
+  "sse2": ["x86", "x86-64"],
+  "avx": ["x86", "x86-64"],
+  "avx512f": ["x86", "x86-64"],
+  "psimd": [],
+}
+
+ISA_TO_CHECK_MAP = {
+  "neon": "TEST_REQUIRES_ARM_NEON",
+  "neonfma": "TEST_REQUIRES_ARM_NEON_FMA",
+  "neonfp16arith": "TEST_REQUIRES_ARM_NEON_FP16_ARITH",
+  "sse": "TEST_REQUIRES_X86_SSE",
+  "sse2": "TEST_REQUIRES_X86_SSE2",
+  "avx": "TEST_REQUIRES_X86_AVX",
+  "avx512f": "TEST_REQUIRES_X86_AVX512F",
+  "psimd": "TEST_REQUIRES_PSIMD",
+}
+
+
+def split_ukernel_name(name):
+  match = re.match(r"^xnn_(f16|f32)_v(add|div|max|min|mul|sub|addc|divc|rdivc|maxc|minc|mulc|subc|rsubc)_ukernel__(.+)_x(\d+)$", name)
+  assert match is not None
+  op_type = {
+    "add": "Add",
+    "div": "Div",
+    "max": "Max",
+    "min": "Min",
+    "mul": "Mul",
+    "sub": "Sub",
+    "addc": "AddC",
+    "divc": "DivC",
+    "rdivc": "RDivC",
+    "maxc": "MaxC",
+    "minc": "MinC",
+    "mulc": "MulC",
+    "subc": "SubC",
+    "rsubc": "RSubC",
+  }[match.group(2)]
+  batch_tile = int(match.group(4))
+
+  arch = list()
+  isa = None
+  target_name = match.group(3)
+  for target_part in target_name.split("_"):
+    if target_part in ARCH_TO_MACRO_MAP:
+      arch = [target_part]
+    elif target_part in ISA_TO_ARCH_MAP:
+      isa = target_part
+  if isa and not arch:
+    arch = ISA_TO_ARCH_MAP[isa]
+  return op_type, batch_tile, arch, isa
+
+
+BINOP_TEST_TEMPLATE = """\
+TEST(${TEST_NAME}, n_eq_${BATCH_TILE}) {
+  $if ISA_CHECK:
+    ${ISA_CHECK};
+  ${TESTER}()
+    .n(${BATCH_TILE})
+    .Test(${", ".join(TEST_ARGS)});
+}
+
+$if BATCH_TILE > 1:
+  TEST(${TEST_NAME}, n_div_${BATCH_TILE}) {
+    $if ISA_CHECK:
+      ${ISA_CHECK};
+    for (size_t n = ${BATCH_TILE*2}; n < ${BATCH_TILE*10}; n += ${BATCH_TILE}) {
+      ${TESTER}()
+        .n(n)
+        .Test(${", ".join(TEST_ARGS)});
+    }
+  }
+
+  TEST(${TEST_NAME}, n_lt_${BATCH_TILE}) {
+    $if ISA_CHECK:
+      ${ISA_CHECK};
+    for (size_t n = 1; n < ${BATCH_TILE}; n++) {
+      ${TESTER}()
+        .n(n)
+        .Test(${", ".join(TEST_ARGS)});
+    }
+  }
+
+TEST(${TEST_NAME}, n_gt_${BATCH_TILE}) {
+  $if ISA_CHECK:
+    ${ISA_CHECK};
+  for (size_t n = ${BATCH_TILE+1}; n < ${10 if BATCH_TILE == 1 else BATCH_TILE*2}; n++) {
+    ${TESTER}()
+      .n(n)
+      .Test(${", ".join(TEST_ARGS)});
+  }
+}
+
+$if TESTER == "VBinOpCMicrokernelTester":
+  TEST(${TEST_NAME}, inplace) {
+    $if ISA_CHECK:
+      ${ISA_CHECK};
+    for (size_t n = 1; n <= ${BATCH_TILE*5}; n += ${max(1, BATCH_TILE-1)}) {
+      ${TESTER}()
+        .n(n)
+        .inplace(true)
+        .Test(${", ".join(TEST_ARGS)});
+    }
+  }
+$else:
+  TEST(${TEST_NAME}, inplace_a) {
+    $if ISA_CHECK:
+      ${ISA_CHECK};
+    for (size_t n = 1; n <= ${BATCH_TILE*5}; n += ${max(1, BATCH_TILE-1)}) {
+      ${TESTER}()
+        .n(n)
+        .inplace_a(true)
+        .Test(${", ".join(TEST_ARGS)});
+    }
+  }
+
+  TEST(${TEST_NAME}, inplace_b) {
+    $if ISA_CHECK:
+      ${ISA_CHECK};
+    for (size_t n = 1; n <= ${BATCH_TILE*5}; n += ${max(1, BATCH_TILE-1)}) {
+      ${TESTER}()
+        .n(n)
+        .inplace_b(true)
+        .Test(${", ".join(TEST_ARGS)});
+    }
+  }
+
+  TEST(${TEST_NAME}, inplace_a_and_b) {
+    $if ISA_CHECK:
+      ${ISA_CHECK};
+    for (size_t n = 1; n <= ${BATCH_TILE*5}; n += ${max(1, BATCH_TILE-1)}) {
+      ${TESTER}()
+        .n(n)
+        .inplace_a(true)
+        .inplace_b(true)
+        .Test(${", ".join(TEST_ARGS)});
+    }
+  }
+
+$if CLAMP:
+  TEST(${TEST_NAME}, qmin) {
+    $if ISA_CHECK:
+      ${ISA_CHECK};
+    for (size_t n = 1; n <= ${BATCH_TILE*5}; n += ${max(1, BATCH_TILE-1)}) {
+      ${TESTER}()
+        .n(n)
+        .qmin(128)
+        .Test(${", ".join(TEST_ARGS)});
+    }
+  }
+
+  TEST(${TEST_NAME}, qmax) {
+    $if ISA_CHECK:
+      ${ISA_CHECK};
+    for (size_t n = 1; n <= ${BATCH_TILE*5}; n += ${max(1, BATCH_TILE-1)}) {
+      ${TESTER}()
+        .n(n)
+        .qmax(128)
+        .Test(${", ".join(TEST_ARGS)});
+    }
+  }
+"""
+
+
+def generate_test_cases(ukernel, op_type, batch_tile, isa, tester):
+  """Generates all tests cases for a Vector Binary Operation micro-kernel.
+
+  Args:
+    ukernel: C name of the micro-kernel function.
+    op_type: Operation type (ADD/MUL/SUB/etc).
+    batch_tile: Number of batch elements processed per one iteration of the
+                inner loop of the micro-kernel.
+    isa: instruction set required to run the micro-kernel. Generated unit test
+         will skip execution if the host processor doesn't support this ISA.
+    tester: C++ name of the tester class.
+
+  Returns:
+    Code for the test case.
+  """
+  _, test_name = ukernel.split("_", 1)
+  _, datatype, _ = ukernel.split("_", 2)
+  test_args = [
+    ukernel,
+    "%s::OpType::%s" % (tester, op_type),
+  ]
+  if not isa or isa == "psimd":
+    test_args.append("%s::Variant::Scalar" % tester)
+  return xngen.preprocess(BINOP_TEST_TEMPLATE, {
+      "TEST_NAME": test_name.upper().replace("UKERNEL_", ""),
+      "TEST_ARGS": test_args,
+      "TESTER": tester,
+      "DATATYPE": datatype,
+      "BATCH_TILE": batch_tile,
+      "CLAMP": op_type not in ["Max", "Min", "MaxC", "MinC"],
+      "ISA_CHECK": ISA_TO_CHECK_MAP.get(isa, ""),
+      "next_prime": next_prime,
+    })
+
+
+def main(args):
+  options = parser.parse_args(args)
+
+  with codecs.open(options.spec, "r", encoding="utf-8") as spec_file:
+    spec_yaml = yaml.safe_load(spec_file)
+    if not isinstance(spec_yaml, list):
+      raise ValueError("expected a list of micro-kernels in the spec")
+
+    tester_header = {
+      "VBinOpMicrokernelTester": "vbinary-microkernel-tester.h",
+      "VBinOpCMicrokernelTester": "vbinaryc-microkernel-tester.h",
+    }[options.tester]
+
+    tests = """\
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+//
+// Auto-generated file. Do not edit!
+//   Specification: {specification}
+//   Generator: {generator}
+
+
+#include <gtest/gtest.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/isa-checks.h>
+
+#include <xnnpack/vbinary.h>
+#include "{tester_header}"
+""".format(specification=options.spec, generator=sys.argv[0],
+           tester_header=tester_header)
+
+    for ukernel_spec in spec_yaml:
+      name = ukernel_spec["name"]
+      op_type, batch_tile, arch, isa = split_ukernel_name(name)
+
+      # specification can override architecture
+      arch = ukernel_spec.get("arch", arch)
+
+      test_case = generate_test_cases(name, op_type, batch_tile, isa,
+                                      options.tester)
+      test_case = remove_duplicate_newlines(test_case)
+      tests += "\n\n"
+      if arch:
+        guard_macro = " || ".join(map(ARCH_TO_MACRO_MAP.get, arch))
+        tests += "#if %s\n" % guard_macro
+        tests += indent(test_case) + "\n"
+        tests += "#endif  // %s\n" % guard_macro
+      elif isa == "psimd":
+        guard_macro = "!XNN_ARCH_ASMJS && !XNN_ARCH_WASM"
+        tests += "#if %s\n" % guard_macro
+        tests += indent(test_case) + "\n"
+        tests += "#endif  // %s\n" % guard_macro
+      else:
+        tests += test_case
+
+    with codecs.open(options.output, "w", encoding="utf-8") as output_file:
+      output_file.write(tests)
+
+
+if __name__ == "__main__":
+  main(sys.argv[1:])